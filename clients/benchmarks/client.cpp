@@ -94,6 +94,18 @@ bool display_timing_info_is_stdout_disabled()
 
 int main(int argc, char* argv[])
 {
+    //
+    // Print the version, including the git revision, used to key stored results.
+    //
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!strcmp(argv[i], "--version"))
+        {
+            std::cout << rocsparse_get_version() << std::endl;
+            return 0;
+        }
+    }
+
     if(rocsparse_bench_app::applies(argc, argv))
     {
         try
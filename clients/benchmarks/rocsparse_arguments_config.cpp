@@ -42,10 +42,16 @@ rocsparse_arguments_config::rocsparse_arguments_config()
         this->dimx           = static_cast<rocsparse_int>(0);
         this->dimy           = static_cast<rocsparse_int>(0);
         this->dimz           = static_cast<rocsparse_int>(0);
+        this->stencil        = static_cast<rocsparse_int>(0);
+        this->dof            = static_cast<rocsparse_int>(0);
+        this->permute        = static_cast<rocsparse_int>(0);
         this->ll             = static_cast<rocsparse_int>(0);
         this->l              = static_cast<rocsparse_int>(0);
         this->u              = static_cast<rocsparse_int>(0);
         this->uu             = static_cast<rocsparse_int>(0);
+        this->skew           = static_cast<double>(0);
+        this->avg_degree     = static_cast<rocsparse_int>(0);
+        this->symmetrize     = static_cast<rocsparse_int>(0);
         this->index_type_I   = static_cast<rocsparse_indextype>(0);
         this->index_type_J   = static_cast<rocsparse_indextype>(0);
         this->compute_type   = static_cast<rocsparse_datatype>(0);
@@ -189,6 +195,19 @@ void rocsparse_arguments_config::set_description(options_description& desc)
      "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
      "will override parameters -m, -n, -z and --mtx.")
 
+    ("stencil",
+     value<rocsparse_int>(&this->stencil)->default_value(0), "assemble "
+     "3D 7, 19 or 27 point stencil matrix with dimensions <dimx dimy dimz> and dof unknowns "
+     "per node, instead of the 27 point laplacian.")
+
+    ("dof",
+     value<rocsparse_int>(&this->dof)->default_value(1), "number of unknowns per node "
+     "of the --stencil matrix, use --blockdim dof for BSR.")
+
+    ("permute",
+     value<rocsparse_int>(&this->permute)->default_value(0), "randomly renumber the nodes "
+     "of the --stencil matrix (0 or 1).")
+
     ("diag_ll",
      value<rocsparse_int>(&this->ll)->default_value(0), "assemble "
      "pentadiagonal matrix with stencil <ll l u, uu>.")
@@ -205,6 +224,24 @@ void rocsparse_arguments_config::set_description(options_description& desc)
      value<rocsparse_int>(&this->uu)->default_value(0), "assemble "
      "pentadiagonal matrix with stencil <ll l u, uu>.")
 
+    ("graph",
+     value<std::string>(&this->b_graph)->default_value(""), "assemble "
+     "the matrix of a scale-free graph with -m rows and -n columns: rmat, powerlaw. This will "
+     "override parameter -z.")
+
+    ("skew",
+     value<double>(&this->skew)->default_value(0.0), "skew of the --graph matrix, the probability "
+     "a of the R-MAT quadrants or the exponent of the power law. 0 selects the default "
+     "(0.57 for rmat, 2.1 for powerlaw).")
+
+    ("avg_degree",
+     value<rocsparse_int>(&this->avg_degree)->default_value(16), "average number of "
+     "entries sampled per row of the --graph matrix.")
+
+    ("symmetrize",
+     value<rocsparse_int>(&this->symmetrize)->default_value(0), "symmetrize the pattern of "
+     "the --graph matrix (0 or 1).")
+
     ("alpha",
      value<double>(&this->alpha)->default_value(1.0), "specifies the scalar alpha")
 
@@ -517,6 +554,10 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
     strcpy(this->filename, this->b_rocalution.c_str());
     this->matrix = rocsparse_matrix_file_rocalution;
   }
+  else if(this->dimx != 0 && this->dimy != 0 && this->dimz != 0 && this->stencil != 0)
+  {
+    this->matrix = rocsparse_matrix_stencil_3d;
+  }
   else if(this->dimx != 0 && this->dimy != 0 && this->dimz != 0)
   {
     this->matrix = rocsparse_matrix_laplace_3d;
@@ -538,6 +579,19 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
   {
     this->matrix = rocsparse_matrix_pentadiagonal;
   }
+  else if(this->b_graph == "rmat")
+  {
+    this->matrix = rocsparse_matrix_rmat;
+  }
+  else if(this->b_graph == "powerlaw")
+  {
+    this->matrix = rocsparse_matrix_powerlaw;
+  }
+  else if(this->b_graph != "")
+  {
+    std::cerr << "Invalid value for --graph" << std::endl;
+    return -1;
+  }
   else
   {
     this->matrix = rocsparse_matrix_random;
@@ -782,6 +836,10 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
       {
 	this->matrix = rocsparse_matrix_file_rocalution;
       }
+    else if (!strcmp(q,".cbin"))
+      {
+	this->matrix = rocsparse_matrix_file_chunked;
+      }
   }
   else if(b_rocsparseio != "")
   {
@@ -793,6 +851,10 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
     strcpy(this->filename, b_rocalution.c_str());
     this->matrix = rocsparse_matrix_file_rocalution;
   }
+  else if(this->dimx != 0 && this->dimy != 0 && this->dimz != 0 && this->stencil != 0)
+  {
+    this->matrix = rocsparse_matrix_stencil_3d;
+  }
   else if(this->dimx != 0 && this->dimy != 0 && this->dimz != 0)
   {
     this->matrix = rocsparse_matrix_laplace_3d;
@@ -806,6 +868,19 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
     strcpy(this->filename, b_matrixmarket.c_str());
     this->matrix = rocsparse_matrix_file_mtx;
   }
+  else if(this->b_graph == "rmat")
+  {
+    this->matrix = rocsparse_matrix_rmat;
+  }
+  else if(this->b_graph == "powerlaw")
+  {
+    this->matrix = rocsparse_matrix_powerlaw;
+  }
+  else if(this->b_graph != "")
+  {
+    std::cerr << "Invalid value for --graph" << std::endl;
+    return -1;
+  }
   else
   {
     this->matrix = rocsparse_matrix_random;
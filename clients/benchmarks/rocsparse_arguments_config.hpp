@@ -43,6 +43,7 @@ private:
     std::string   b_rocalution{};
     std::string   b_rocsparseio{};
     std::string   b_file{};
+    std::string   b_graph{};
     char          b_transA{};
     char          b_transB{};
     int           b_baseA{};
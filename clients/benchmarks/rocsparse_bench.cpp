@@ -126,6 +126,11 @@ rocsparse_int rocsparse_bench::get_device_id() const
     return this->config.device_id;
 }
 
+char rocsparse_bench::get_precision() const
+{
+    return this->config.precision;
+}
+
 // This is used for backward compatibility.
 void rocsparse_bench::info_devices(std::ostream& out_) const
 {
@@ -107,6 +107,7 @@ public:
     rocsparse_bench& operator()(int& argc, char**& argv);
     rocsparse_status run();
     rocsparse_int    get_device_id() const;
+    char             get_precision() const;
     void             info_devices(std::ostream& out_) const;
 };
 
@@ -39,6 +39,8 @@ rocsparse_bench_app_base::rocsparse_bench_app_base(int argc, char** argv)
 rocsparse_status rocsparse_bench_app_base::run_case(int isample, int irun, int argc, char** argv)
 {
     rocsparse_bench bench(argc, argv);
+    this->m_bench_timing[isample].precision = bench.get_precision();
+    this->m_device                          = bench.get_device_id();
     return bench.run();
 }
 
@@ -179,6 +181,15 @@ void rocsparse_bench_app::export_item(std::ostream& out, rocsparse_bench_timing_
         out << "    \"bandwidth\": [\"" << gbs << "\", \"" << interval_gbs[0] << "\", \""
             << interval_gbs[1] << "\"]";
 
+        out << ",";
+        this->export_samples(out, item);
+
+        if(is_roofline())
+        {
+            out << ",";
+            this->export_roofline(out, item.precision, gflops, gbs);
+        }
+
         if(!no_rawdata())
         {
             out << ",";
@@ -196,6 +207,13 @@ void rocsparse_bench_app::export_item(std::ostream& out, rocsparse_bench_timing_
             << item.gflops[0] << "\"]," << std::endl;
         out << "\"bandwidth\": [\"" << item.gbs[0] << "\", \"" << item.gbs[0] << "\", \""
             << item.gbs[0] << "\"]";
+        out << ",";
+        this->export_samples(out, item);
+        if(is_roofline())
+        {
+            out << ",";
+            this->export_roofline(out, item.precision, item.gflops[0], item.gbs[0]);
+        }
         if(!no_rawdata())
         {
             out << ",";
@@ -208,6 +226,49 @@ void rocsparse_bench_app::export_item(std::ostream& out, rocsparse_bench_timing_
     }
 }
 
+void rocsparse_bench_app::export_samples(std::ostream&                           out,
+                                         const rocsparse_bench_timing_t::item_t& item)
+{
+    //
+    // The measurement of each run, for the statistical comparison of results.
+    //
+    auto export_vector = [&out](const char* name, const std::vector<double>& v) {
+        out << "\"" << name << "\": [";
+        for(size_t i = 0; i < v.size(); ++i)
+        {
+            out << ((i > 0) ? ", \"" : "\"") << v[i] << "\"";
+        }
+        out << "]";
+    };
+
+    out << std::endl << "    \"samples\": {";
+    export_vector("time", item.msec);
+    out << ", ";
+    export_vector("flops", item.gflops);
+    out << ", ";
+    export_vector("bandwidth", item.gbs);
+    out << "}";
+}
+
+void rocsparse_bench_app::export_roofline(std::ostream& out,
+                                          char          precision,
+                                          double        gflops,
+                                          double        gbs)
+{
+    //
+    // The flops and bytes models share the same time, their ratio is the arithmetic intensity.
+    //
+    const double peak_gflops = this->m_roofline.peak_gflops(precision);
+    const double intensity   = (gbs > 0.0) ? gflops / gbs : 0.0;
+    const double bandwidth_fraction
+        = (this->m_roofline.bandwidth > 0.0) ? gbs / this->m_roofline.bandwidth : 0.0;
+    const double flops_fraction = (peak_gflops > 0.0) ? gflops / peak_gflops : 0.0;
+
+    out << std::endl
+        << "    \"roofline\": {\"intensity\": \"" << intensity << "\", \"bandwidth\": \""
+        << bandwidth_fraction << "\", \"flops\": \"" << flops_fraction << "\"}";
+}
+
 rocsparse_status rocsparse_bench_app::export_file()
 {
     const char* ofilename = this->m_bench_cmdlines.get_ofilename();
@@ -228,6 +289,25 @@ rocsparse_status rocsparse_bench_app::export_file()
 
     rocsparse_status status;
 
+    //
+    // Peaks of the device, measured once and cached on disk.
+    //
+    if(is_roofline())
+    {
+        status = rocsparse_bench_roofline::get(
+            this->m_device, rocsparse_bench_roofline::default_cache_filename(), this->m_roofline);
+        if(status != rocsparse_status_success)
+        {
+            std::cerr << "rocsparse_bench_roofline::get failed at line " << __LINE__ << std::endl;
+            return status;
+        }
+
+        std::cout << "// roofline: peak bandwidth " << this->m_roofline.bandwidth
+                  << " GB/s, peak compute " << this->m_roofline.gflops_single
+                  << " GFlop/s (single), " << this->m_roofline.gflops_double
+                  << " GFlop/s (double)" << std::endl;
+    }
+
     //
     // Write header.
     //
@@ -324,6 +404,15 @@ rocsparse_status rocsparse_bench_app::define_results_json(std::ostream& out)
     gpu_config g(prop);
     g.print_json(out);
 
+    if(is_roofline())
+    {
+        out << std::endl
+            << "\"roofline\": {" << std::endl
+            << "  \"bandwidth\"    : \"" << this->m_roofline.bandwidth << "\"," << std::endl
+            << "  \"flops single\" : \"" << this->m_roofline.gflops_single << "\"," << std::endl
+            << "  \"flops double\" : \"" << this->m_roofline.gflops_double << "\"}," << std::endl;
+    }
+
     out << std::endl << "\"cmdline\": \"" << this->m_initial_argv[0];
 
     for(int i = 1; i < this->m_initial_argc; ++i)
@@ -25,6 +25,7 @@
 
 #include "rocsparse-types.h"
 #include "rocsparse_bench_cmdlines.hpp"
+#include "rocsparse_bench_roofline.hpp"
 #include <iostream>
 #include <vector>
 
@@ -116,6 +117,7 @@ struct rocsparse_bench_timing_t
     struct item_t
     {
         int                      m_nruns{};
+        char                     precision{'s'};
         std::vector<double>      msec{};
         std::vector<double>      gflops{};
         std::vector<double>      gbs{};
@@ -219,6 +221,11 @@ protected:
 
     bool m_stdout_disabled{true};
 
+    //
+    // Device of the last case run.
+    //
+    int m_device{};
+
     static int save_initial_cmdline(int argc, char** argv, char*** argv_)
     {
         argv_[0] = new char*[argc];
@@ -261,6 +268,10 @@ public:
     {
         return m_bench_cmdlines.no_rawdata();
     }
+    bool is_roofline() const
+    {
+        return m_bench_cmdlines.is_roofline();
+    }
 
     //
     // @brief Run cases.
@@ -310,7 +321,12 @@ public:
     }
 
 protected:
+    rocsparse_bench_roofline m_roofline{};
+
     void             export_item(std::ostream& out, rocsparse_bench_timing_t::item_t& item);
+    void             export_roofline(std::ostream& out, char precision, double gflops, double gbs);
+    void             export_samples(std::ostream&                           out,
+                                    const rocsparse_bench_timing_t::item_t& item);
     rocsparse_status define_case_json(std::ostream& out, int isample, int argc, char** argv);
     rocsparse_status close_case_json(std::ostream& out, int isample, int argc, char** argv);
     rocsparse_status define_results_json(std::ostream& out);
@@ -48,6 +48,10 @@ bool rocsparse_bench_cmdlines::no_rawdata() const
 {
     return this->m_cmd.no_rawdata();
 };
+bool rocsparse_bench_cmdlines::is_roofline() const
+{
+    return this->m_cmd.is_roofline();
+};
 
 //
 // @brief Get the number of runs per sample.
@@ -96,6 +96,7 @@
 // option: --bench-o, output filename.
 // option: --bench-n, number of runs.
 // option: --bench-std, prevent from standard output to be disabled.
+// option: --roofline, report the achieved fraction of the peak bandwidth and compute.
 //
 
 class rocsparse_bench_cmdlines
@@ -204,6 +205,11 @@ private:
             return this->m_no_rawdata;
         }
 
+        bool is_roofline() const
+        {
+            return this->m_is_roofline;
+        }
+
         //
         // Constructor.
         //
@@ -255,6 +261,8 @@ private:
 
             this->m_is_stdout_disabled = (false == detect_flag(argc, argv, "--bench-std"));
 
+            this->m_is_roofline = detect_flag(argc, argv, "--roofline");
+
             int jarg = -1;
             for(int iarg = 1; iarg < argc; ++iarg)
             {
@@ -277,6 +285,10 @@ private:
                     {
                         ++iarg;
                     }
+                    else if(!strcmp(argv[iarg], "--roofline"))
+                    {
+                        ++iarg;
+                    }
                     else if(!strcmp(argv[iarg], "--bench-o"))
                     {
                         iarg += 2;
@@ -564,6 +576,7 @@ private:
         int                      m_nsamples;
         bool                     m_is_stdout_disabled{true};
         bool                     m_no_rawdata{};
+        bool                     m_is_roofline{};
         const char*              m_ofilename{};
     };
 
@@ -592,6 +605,11 @@ public:
         out << "--bench-o          output JSON file, (default = a.json)" << std::endl;
         out << "--bench-n          number of runs, (default = 1)" << std::endl;
         out << "--bench-no-rawdata do not export raw data." << std::endl;
+        out << "--roofline         export the arithmetic intensity and the fractions of the peak"
+            << std::endl;
+        out << "                   bandwidth and compute, measured once and cached in" << std::endl;
+        out << "                   ROCSPARSE_CLIENTS_ROOFLINE_CACHE." << std::endl;
+        out << "--version          print the rocSPARSE version and git revision." << std::endl;
         out << "" << std::endl;
         out << "Example:" << std::endl;
         out << "rocsparse-bench -f csrmv --bench-x -M 10 20 30 40" << std::endl;
@@ -614,6 +632,7 @@ public:
     int         get_noptions() const;
     bool        is_stdout_disabled() const;
     bool        no_rawdata() const;
+    bool        is_roofline() const;
 
     //
     // @brief Get the number of runs per sample.
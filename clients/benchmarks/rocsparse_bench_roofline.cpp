@@ -0,0 +1,510 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_bench_roofline.hpp"
+#include "rocsparse_clients_envariables.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <hip/hip_runtime.h>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#ifdef WIN32
+#include <io.h>
+#include <process.h>
+#include <sys/locking.h>
+#else
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#define ROOFLINE_HIP_CHECK(expr_)                                                          \
+    do                                                                                     \
+    {                                                                                      \
+        const hipError_t err_ = (expr_);                                                   \
+        if(err_ != hipSuccess)                                                             \
+        {                                                                                  \
+            std::cerr << "rocsparse_bench_roofline: " << hipGetErrorString(err_) << " at " \
+                      << __FILE__ << ":" << __LINE__ << std::endl;                         \
+            return rocsparse_status_internal_error;                                        \
+        }                                                                                  \
+    } while(false)
+
+//
+// Events and device arrays released on every return path.
+//
+struct roofline_events
+{
+    hipEvent_t start{};
+    hipEvent_t stop{};
+
+    ~roofline_events()
+    {
+        if(this->start != nullptr)
+        {
+            (void)hipEventDestroy(this->start);
+        }
+        if(this->stop != nullptr)
+        {
+            (void)hipEventDestroy(this->stop);
+        }
+    }
+};
+
+template <typename T>
+struct roofline_array
+{
+    T* data{};
+
+    ~roofline_array()
+    {
+        if(this->data != nullptr)
+        {
+            (void)hipFree(this->data);
+        }
+    }
+
+    hipError_t malloc(size_t size)
+    {
+        return hipMalloc(&this->data, sizeof(T) * size);
+    }
+};
+
+static constexpr int s_roofline_block_size = 256;
+static constexpr int s_roofline_nruns      = 20;
+static constexpr int s_roofline_fma_loop   = 512;
+
+template <typename T>
+__launch_bounds__(s_roofline_block_size) __global__
+    void roofline_copy(size_t size, const T* __restrict__ x, T* __restrict__ y)
+{
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < size;
+        i += hipGridDim_x * hipBlockDim_x)
+    {
+        y[i] = x[i];
+    }
+}
+
+template <typename T>
+__launch_bounds__(s_roofline_block_size) __global__ void roofline_triad(
+    size_t size, T s, const T* __restrict__ x, const T* __restrict__ y, T* __restrict__ z)
+{
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < size;
+        i += hipGridDim_x * hipBlockDim_x)
+    {
+        z[i] = x[i] + s * y[i];
+    }
+}
+
+// Eight independent chains to hide the latency of the fused multiply-adds.
+template <typename T>
+__launch_bounds__(s_roofline_block_size) __global__ void roofline_fma(T a, T b, T* out)
+{
+    T c[8];
+    for(int k = 0; k < 8; ++k)
+    {
+        c[k] = static_cast<T>(hipThreadIdx_x + k);
+    }
+
+    for(int j = 0; j < s_roofline_fma_loop; ++j)
+    {
+#pragma unroll
+        for(int k = 0; k < 8; ++k)
+        {
+            c[k] = fma(c[k], a, b);
+        }
+    }
+
+    T sum = static_cast<T>(0);
+    for(int k = 0; k < 8; ++k)
+    {
+        sum += c[k];
+    }
+
+    // Never true, prevents the compiler from eliminating the chains.
+    if(sum == static_cast<T>(-1))
+    {
+        out[hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x] = sum;
+    }
+}
+
+//
+// Best time in milliseconds of a launch over s_roofline_nruns runs.
+//
+template <typename F>
+static rocsparse_status roofline_time(F&& launch, double& best_ms)
+{
+    roofline_events events;
+    ROOFLINE_HIP_CHECK(hipEventCreate(&events.start));
+    ROOFLINE_HIP_CHECK(hipEventCreate(&events.stop));
+
+    // Warm up.
+    launch();
+    ROOFLINE_HIP_CHECK(hipGetLastError());
+    ROOFLINE_HIP_CHECK(hipDeviceSynchronize());
+
+    best_ms = 0.0;
+    for(int irun = 0; irun < s_roofline_nruns; ++irun)
+    {
+        ROOFLINE_HIP_CHECK(hipEventRecord(events.start));
+        launch();
+        ROOFLINE_HIP_CHECK(hipEventRecord(events.stop));
+        ROOFLINE_HIP_CHECK(hipEventSynchronize(events.stop));
+
+        float ms;
+        ROOFLINE_HIP_CHECK(hipEventElapsedTime(&ms, events.start, events.stop));
+        best_ms = (irun == 0) ? ms : std::min(best_ms, static_cast<double>(ms));
+    }
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status roofline_bandwidth(const hipDeviceProp_t& prop, double& bandwidth)
+{
+    // Three arrays of at most 256MB, and at most half of the device memory.
+    size_t size = size_t(1) << 25;
+    while(size > (size_t(1) << 16) && 3 * size * sizeof(double) > prop.totalGlobalMem / 2)
+    {
+        size /= 2;
+    }
+
+    roofline_array<double> x;
+    roofline_array<double> y;
+    roofline_array<double> z;
+    ROOFLINE_HIP_CHECK(x.malloc(size));
+    ROOFLINE_HIP_CHECK(y.malloc(size));
+    ROOFLINE_HIP_CHECK(z.malloc(size));
+    ROOFLINE_HIP_CHECK(hipMemset(x.data, 0, sizeof(double) * size));
+    ROOFLINE_HIP_CHECK(hipMemset(y.data, 0, sizeof(double) * size));
+
+    const dim3 blocks(prop.multiProcessorCount * 32);
+    const dim3 threads(s_roofline_block_size);
+
+    double copy_ms, triad_ms;
+
+    rocsparse_status status = roofline_time(
+        [&]() {
+            hipLaunchKernelGGL(
+                (roofline_copy<double>), blocks, threads, 0, 0, size, x.data, z.data);
+        },
+        copy_ms);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    status = roofline_time(
+        [&]() {
+            hipLaunchKernelGGL((roofline_triad<double>),
+                               blocks,
+                               threads,
+                               0,
+                               0,
+                               size,
+                               3.0,
+                               x.data,
+                               y.data,
+                               z.data);
+        },
+        triad_ms);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    const double copy_bytes  = 2.0 * sizeof(double) * size;
+    const double triad_bytes = 3.0 * sizeof(double) * size;
+    bandwidth = std::max(copy_bytes / (copy_ms * 1e6), triad_bytes / (triad_ms * 1e6));
+    return rocsparse_status_success;
+}
+
+template <typename T>
+static rocsparse_status roofline_gflops(const hipDeviceProp_t& prop, double& gflops)
+{
+    const dim3 blocks(prop.multiProcessorCount * 64);
+    const dim3 threads(s_roofline_block_size);
+
+    roofline_array<T> out;
+    ROOFLINE_HIP_CHECK(out.malloc(size_t(blocks.x) * threads.x));
+
+    double           ms;
+    rocsparse_status status = roofline_time(
+        [&]() {
+            hipLaunchKernelGGL((roofline_fma<T>),
+                               blocks,
+                               threads,
+                               0,
+                               0,
+                               static_cast<T>(0.999),
+                               static_cast<T>(0.001),
+                               out.data);
+        },
+        ms);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    const double flops = 2.0 * 8 * s_roofline_fma_loop * double(blocks.x) * threads.x;
+    gflops             = flops / (ms * 1e6);
+    return rocsparse_status_success;
+}
+
+//
+// Key of a device in the cache, the architecture and the PCI location.
+//
+static std::string roofline_key(int device)
+{
+    hipDeviceProp_t prop;
+    if(hipGetDeviceProperties(&prop, device) != hipSuccess)
+    {
+        return "";
+    }
+
+    std::ostringstream key;
+    key << prop.gcnArchName << "@" << prop.pciDomainID << ":" << prop.pciBusID << ":"
+        << prop.pciDeviceID;
+
+    // The architecture name may contain features, spaces would break the cache format.
+    std::string s = key.str();
+    std::replace(s.begin(), s.end(), ' ', '_');
+    return s;
+}
+
+rocsparse_status rocsparse_bench_roofline::measure(int device, rocsparse_bench_roofline& peaks)
+{
+    hipDeviceProp_t prop;
+    ROOFLINE_HIP_CHECK(hipSetDevice(device));
+    ROOFLINE_HIP_CHECK(hipGetDeviceProperties(&prop, device));
+
+    rocsparse_status status = roofline_bandwidth(prop, peaks.bandwidth);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    status = roofline_gflops<float>(prop, peaks.gflops_single);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    return roofline_gflops<double>(prop, peaks.gflops_double);
+}
+
+//
+// Cache lookup, one line per device: key bandwidth gflops_single gflops_double.
+// The lines of the other devices are returned, corrupted lines are dropped.
+//
+static bool roofline_read(const std::string&        cache_filename,
+                          const std::string&        key,
+                          rocsparse_bench_roofline& peaks,
+                          std::vector<std::string>& lines)
+{
+    bool found = false;
+
+    std::ifstream in(cache_filename);
+    std::string   line;
+    while(std::getline(in, line))
+    {
+        std::istringstream       iss(line);
+        std::string              line_key;
+        rocsparse_bench_roofline cached;
+        if(!(iss >> line_key >> cached.bandwidth >> cached.gflops_single >> cached.gflops_double))
+        {
+            continue;
+        }
+
+        if(line_key == key)
+        {
+            peaks = cached;
+            found = true;
+        }
+        else
+        {
+            lines.push_back(line);
+        }
+    }
+
+    return found;
+}
+
+//
+// Exclusive lock of the cache between the processes updating it, held until
+// destruction. Failing to lock is not an error, the update is then skipped.
+//
+class roofline_lock
+{
+public:
+    explicit roofline_lock(const std::string& filename)
+    {
+#ifdef WIN32
+        this->m_fd = _open(filename.c_str(), _O_CREAT | _O_RDWR, _S_IREAD | _S_IWRITE);
+        if(this->m_fd >= 0 && _locking(this->m_fd, _LK_LOCK, 1) != 0)
+#else
+        this->m_fd = open(filename.c_str(), O_CREAT | O_RDWR, 0644);
+        if(this->m_fd >= 0 && flock(this->m_fd, LOCK_EX) != 0)
+#endif
+        {
+            this->close();
+        }
+    }
+
+    ~roofline_lock()
+    {
+        this->close();
+    }
+
+    bool locked() const
+    {
+        return this->m_fd >= 0;
+    }
+
+    roofline_lock(const roofline_lock&) = delete;
+    roofline_lock& operator=(const roofline_lock&) = delete;
+
+private:
+    void close()
+    {
+        if(this->m_fd >= 0)
+        {
+#ifdef WIN32
+            _close(this->m_fd);
+#else
+            // Closing the descriptor releases the lock.
+            ::close(this->m_fd);
+#endif
+            this->m_fd = -1;
+        }
+    }
+
+    int m_fd{-1};
+};
+
+//
+// Add the peaks of a device to the cache. The cache is read again under the
+// lock to keep the entries added by other processes, and replaced by renaming
+// a temporary file such that readers never see a partial cache.
+//
+static void roofline_write(const std::string&              cache_filename,
+                           const std::string&              key,
+                           const rocsparse_bench_roofline& peaks)
+{
+    roofline_lock lock(cache_filename + ".lock");
+    if(!lock.locked())
+    {
+        std::cerr << "// rocsparse_bench_roofline: cannot lock cache '" << cache_filename << "'"
+                  << std::endl;
+        return;
+    }
+
+    std::vector<std::string> lines;
+    rocsparse_bench_roofline previous;
+    roofline_read(cache_filename, key, previous, lines);
+
+    std::ostringstream entry;
+    entry << key << " " << peaks.bandwidth << " " << peaks.gflops_single << " "
+          << peaks.gflops_double;
+    lines.push_back(entry.str());
+
+#ifdef WIN32
+    const int pid = _getpid();
+#else
+    const int pid = getpid();
+#endif
+    const std::string tmp_filename = cache_filename + "." + std::to_string(pid) + ".tmp";
+
+    {
+        std::ofstream out(tmp_filename, std::ios::trunc);
+        for(const auto& line : lines)
+        {
+            out << line << std::endl;
+        }
+
+        if(!out)
+        {
+            std::cerr << "// rocsparse_bench_roofline: cannot write cache '" << cache_filename
+                      << "'" << std::endl;
+            out.close();
+            std::remove(tmp_filename.c_str());
+            return;
+        }
+    }
+
+#ifdef WIN32
+    // Renaming does not replace an existing file on Windows.
+    std::remove(cache_filename.c_str());
+#endif
+    if(std::rename(tmp_filename.c_str(), cache_filename.c_str()) != 0)
+    {
+        std::cerr << "// rocsparse_bench_roofline: cannot write cache '" << cache_filename << "'"
+                  << std::endl;
+        std::remove(tmp_filename.c_str());
+    }
+}
+
+rocsparse_status rocsparse_bench_roofline::get(int                       device,
+                                               const std::string&        cache_filename,
+                                               rocsparse_bench_roofline& peaks)
+{
+    const std::string key = roofline_key(device);
+    if(key.empty())
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    std::vector<std::string> lines;
+    if(roofline_read(cache_filename, key, peaks, lines))
+    {
+        return rocsparse_status_success;
+    }
+
+    std::cout << "// rocsparse_bench_roofline: measuring the peaks of device " << device << " ("
+              << key << ")" << std::endl;
+
+    rocsparse_status status = rocsparse_bench_roofline::measure(device, peaks);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    // Failing to update the cache is not an error.
+    roofline_write(cache_filename, key, peaks);
+    return rocsparse_status_success;
+}
+
+std::string rocsparse_bench_roofline::default_cache_filename()
+{
+    if(rocsparse_clients_envariables::is_defined(rocsparse_clients_envariables::ROOFLINE_CACHE))
+    {
+        return rocsparse_clients_envariables::get(rocsparse_clients_envariables::ROOFLINE_CACHE);
+    }
+
+    const char* home = getenv("HOME");
+    return std::string((home != nullptr) ? home : ".") + "/.rocsparse_bench_roofline";
+}
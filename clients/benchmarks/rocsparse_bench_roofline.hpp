@@ -0,0 +1,72 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse-types.h"
+
+#include <string>
+
+//
+// @brief Peak performance of a device, as measured by STREAM-style micro-benchmarks.
+// @details
+// The bandwidth is the best of a copy and a triad kernel over arrays much larger than the
+// caches, the compute peaks are obtained from chains of independent fused multiply-adds.
+// Measuring takes a few seconds, the peaks are therefore cached on disk, keyed by the device
+// architecture and PCI location, and reused by subsequent sessions.
+//
+struct rocsparse_bench_roofline
+{
+    // GB/s
+    double bandwidth{};
+    // GFlop/s
+    double gflops_single{};
+    double gflops_double{};
+
+    //
+    // @brief Peak compute of a precision, 's', 'd', 'c' or 'z'.
+    //
+    double peak_gflops(char precision) const
+    {
+        return (precision == 'd' || precision == 'z') ? this->gflops_double : this->gflops_single;
+    }
+
+    //
+    // @brief Get the peaks of a device, from the cache if present, otherwise measure them and
+    // update the cache.
+    //
+    static rocsparse_status
+        get(int device, const std::string& cache_filename, rocsparse_bench_roofline& peaks);
+
+    //
+    // @brief Measure the peaks of a device.
+    //
+    static rocsparse_status measure(int device, rocsparse_bench_roofline& peaks);
+
+    //
+    // @brief Default cache filename, ROCSPARSE_CLIENTS_ROOFLINE_CACHE if defined, otherwise
+    // $HOME/.rocsparse_bench_roofline.
+    //
+    static std::string default_cache_filename();
+};
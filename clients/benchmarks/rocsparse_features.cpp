@@ -0,0 +1,233 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+//
+// rocsparse-features computes, on the host, the sparsity features of any matrix the
+// factories can load, to be joined with rocsparse-bench timings by
+// scripts/rocsparse-bench-features.py.
+//
+
+#include "display.hpp"
+#include "rocsparse_arguments_config.hpp"
+#include "rocsparse_matrix_factory.hpp"
+#include "rocsparse_matrix_features.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//
+// REQUIRED ROUTINES:
+// - rocsparse_record_timing
+// - rocsparse_record_output
+// - rocsparse_record_output_legend
+// - display_timing_info_is_stdout_disabled
+//
+bool display_timing_info_is_stdout_disabled()
+{
+    return false;
+}
+
+rocsparse_status rocsparse_record_output(const std::string& s)
+{
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_record_output_legend(const std::string& s)
+{
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_record_timing(double msec, double gflops, double gbs)
+{
+    return rocsparse_status_success;
+}
+
+//
+// Name of the matrix, identical to the 'import' column of rocsparse-bench.
+//
+static std::string features_matrix_name(const Arguments& arg)
+{
+    if(rocsparse_arguments_has_datafile(arg))
+    {
+        char matrixname[64];
+        rocsparse_get_matrixname(&arg.filename[0], &matrixname[0]);
+        return matrixname;
+    }
+    return rocsparse_matrix2string(arg.matrix);
+}
+
+template <typename T, typename I, typename J>
+static void features_compute(const Arguments& arg, rocsparse_matrix_features& features)
+{
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    host_vector<I> csr_row_ptr;
+    host_vector<J> csr_col_ind;
+    host_vector<T> csr_val;
+
+    J M = arg.M;
+    J N = arg.N;
+    I nnz;
+    matrix_factory.init_csr(csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, arg.baseA);
+
+    features.compute(
+        M, N, nnz, csr_row_ptr.data(), csr_col_ind.data(), csr_val.data(), arg.baseA);
+}
+
+template <typename T>
+static void features_compute(const rocsparse_arguments_config& config,
+                             rocsparse_matrix_features&        features)
+{
+    switch(config.indextype)
+    {
+    case 's':
+    {
+        features_compute<T, int32_t, int32_t>(config, features);
+        return;
+    }
+    case 'm':
+    {
+        features_compute<T, int64_t, int32_t>(config, features);
+        return;
+    }
+    case 'd':
+    {
+        features_compute<T, int64_t, int64_t>(config, features);
+        return;
+    }
+    }
+    throw rocsparse_status_invalid_value;
+}
+
+static void features_compute(const rocsparse_arguments_config& config,
+                             rocsparse_matrix_features&        features)
+{
+    switch(config.precision)
+    {
+    case 's':
+    {
+        features_compute<float>(config, features);
+        return;
+    }
+    case 'd':
+    {
+        features_compute<double>(config, features);
+        return;
+    }
+    case 'c':
+    {
+        features_compute<rocsparse_float_complex>(config, features);
+        return;
+    }
+    case 'z':
+    {
+        features_compute<rocsparse_double_complex>(config, features);
+        return;
+    }
+    }
+    throw rocsparse_status_invalid_value;
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        rocsparse_arguments_config config;
+        options_description        desc("rocsparse-features command line options");
+        std::string                output;
+        std::string                format;
+
+        config.set_description(desc);
+        desc.add_options()
+            // clang-format off
+        ("features-output",
+         value<std::string>(&output)->default_value(""),
+         "Output file, CSV lines are appended and the header is written only to new files "
+         "(default: standard output)")
+
+        ("features-format",
+         value<std::string>(&format)->default_value("csv"),
+         "Output format, csv or json (default: csv)");
+        // clang-format on
+
+        const int i = config.parse(argc, argv, desc);
+        if(i == -1)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(i == -2)
+        {
+            return 0;
+        }
+
+        if(format != "csv" && format != "json")
+        {
+            std::cerr << "Invalid value for --features-format" << std::endl;
+            return rocsparse_status_invalid_value;
+        }
+
+        rocsparse_matrix_features features;
+        features.name = features_matrix_name(config);
+        features_compute(config, features);
+
+        std::ofstream file;
+        bool          header = true;
+        if(!output.empty())
+        {
+            if(format == "csv")
+            {
+                std::ifstream in(output);
+                header = !in || in.peek() == std::ifstream::traits_type::eof();
+            }
+
+            file.open(output, (format == "csv") ? std::ios::app : std::ios::trunc);
+            if(!file)
+            {
+                std::cerr << "Cannot open '" << output << "'" << std::endl;
+                return rocsparse_status_internal_error;
+            }
+        }
+
+        std::ostream& out = output.empty() ? std::cout : file;
+        if(format == "csv")
+        {
+            if(header)
+            {
+                rocsparse_matrix_features::write_csv_header(out);
+            }
+            features.write_csv(out);
+        }
+        else
+        {
+            features.write_json(out);
+        }
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    return 0;
+}
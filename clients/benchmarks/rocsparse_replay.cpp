@@ -0,0 +1,820 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+//
+// rocsparse-replay re-executes, with timing, the calls recorded in a capture
+// directory written with ROCSPARSE_LAYER including rocsparse_layer_mode_capture.
+//
+
+#include "rocsparse.hpp"
+#include "rocsparse_capture_reader.hpp"
+#include "utility.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//
+// REQUIRED ROUTINES:
+// - rocsparse_record_timing
+// - rocsparse_record_output
+// - rocsparse_record_output_legend
+// - display_timing_info_is_stdout_disabled
+//
+bool display_timing_info_is_stdout_disabled()
+{
+    return false;
+}
+
+rocsparse_status rocsparse_record_output(const std::string& s)
+{
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_record_output_legend(const std::string& s)
+{
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_record_timing(double msec, double gflops, double gbs)
+{
+    return rocsparse_status_success;
+}
+
+using replay_operand_t = rocsparse_capture_reader::operand_t;
+using replay_arrays    = std::vector<std::unique_ptr<device_vector<char>>>;
+
+struct replay_matrix
+{
+    // Device arrays and descriptor, uploaded on first use
+    replay_arrays                          arrays;
+    std::unique_ptr<rocsparse_local_spmat> descr;
+    bool                                   failed{};
+};
+
+struct replay_options
+{
+    std::string directory;
+    int         device{};
+    int         iters{10};
+    int         warmup{2};
+};
+
+struct replay_result
+{
+    std::string matrix;
+    int64_t     rows{};
+    int64_t     cols{};
+    int64_t     nnz{};
+    double      time_us{};
+    double      flops{};
+};
+
+//
+// Array of an operand, with its number of entries per batch, the stride
+// between its batches and the size of its entries, the layout the library
+// captures the operand with.
+//
+struct replay_array_t
+{
+    int64_t count;
+    int64_t stride;
+    size_t  size;
+};
+
+static int64_t replay_int(const rocsparse_capture_reader::call_t& call, size_t i)
+{
+    return std::strtoll(call.args[i].c_str(), nullptr, 10);
+}
+
+static int64_t replay_batch_count(const replay_operand_t& op)
+{
+    return std::max<int64_t>(op.get("batch_count"), 1);
+}
+
+// Number of entries of a sparse matrix, the ones of the blocks included
+static int64_t replay_nnz(const replay_operand_t& op)
+{
+    const int64_t block_dim = op.get("block_dim");
+    return (rocsparse_format(op.get("format")) == rocsparse_format_bsr)
+               ? op.get("nnz") * block_dim * block_dim
+               : op.get("nnz");
+}
+
+//
+// Layout of the arrays of an operand, none if the operand cannot be replayed:
+// ELL and COO AoS matrices are captured as COO matrices and BELL matrices
+// without their values.
+//
+static std::vector<replay_array_t> replay_layout(const replay_operand_t& op)
+{
+    const size_t val_size
+        = rocsparse_capture_reader::sizeof_datatype(rocsparse_datatype(op.get("data_type")));
+
+    if(op.kind == "dnvec")
+    {
+        return {{op.get("size"), op.get("batch_stride"), val_size}};
+    }
+    else if(op.kind == "dnmat")
+    {
+        const bool    column = (rocsparse_order(op.get("order")) == rocsparse_order_column);
+        const int64_t m      = column ? op.get("rows") : op.get("cols");
+        const int64_t n      = column ? op.get("cols") : op.get("rows");
+        const int64_t count  = (m > 0 && n > 0) ? op.get("ld") * (n - 1) + m : 0;
+
+        return {{count, op.get("batch_stride"), val_size}};
+    }
+    else if(op.kind != "spmat")
+    {
+        return {};
+    }
+
+    const size_t row_size
+        = rocsparse_capture_reader::sizeof_indextype(rocsparse_indextype(op.get("row_type")));
+    const size_t col_size
+        = rocsparse_capture_reader::sizeof_indextype(rocsparse_indextype(op.get("col_type")));
+    const int64_t offsets = op.get("offsets_batch_stride");
+    const int64_t indices = op.get("columns_values_batch_stride");
+    const int64_t entries = op.get("batch_stride");
+    const int64_t rows    = op.get("rows");
+    const int64_t cols    = op.get("cols");
+    const int64_t nnz     = op.get("nnz");
+
+    switch(rocsparse_format(op.get("format")))
+    {
+    case rocsparse_format_csr:
+    case rocsparse_format_bsr:
+    {
+        return {{rows + 1, offsets, row_size},
+                {nnz, indices, col_size},
+                {replay_nnz(op), indices, val_size}};
+    }
+    case rocsparse_format_csc:
+    {
+        return {{cols + 1, offsets, col_size}, {nnz, indices, row_size}, {nnz, indices, val_size}};
+    }
+    case rocsparse_format_coo:
+    {
+        return {{nnz, entries, row_size}, {nnz, entries, col_size}, {nnz, entries, val_size}};
+    }
+    case rocsparse_format_coo_aos:
+    case rocsparse_format_ell:
+    case rocsparse_format_bell:
+    {
+        return {};
+    }
+    }
+    return {};
+}
+
+// Ones of the given type
+static void replay_ones(rocsparse_datatype type, std::vector<char>& h)
+{
+    const size_t size = rocsparse_capture_reader::sizeof_datatype(type);
+    for(size_t i = 0; size > 0 && i + size <= h.size(); i += size)
+    {
+        char* p = h.data() + i;
+        switch(type)
+        {
+        case rocsparse_datatype_f32_r:
+        case rocsparse_datatype_f32_c:
+        {
+            const float one = 1.0f;
+            std::memcpy(p, &one, sizeof(one));
+            break;
+        }
+        case rocsparse_datatype_f64_r:
+        case rocsparse_datatype_f64_c:
+        {
+            const double one = 1.0;
+            std::memcpy(p, &one, sizeof(one));
+            break;
+        }
+        case rocsparse_datatype_i8_r:
+        case rocsparse_datatype_u8_r:
+        case rocsparse_datatype_i32_r:
+        case rocsparse_datatype_u32_r:
+        {
+            p[0] = 1;
+            break;
+        }
+        }
+    }
+}
+
+//
+// Device arrays of an operand, with the recorded values of all its batches, or
+// ones for the dense operands captured without their values. False if the
+// operand cannot be replayed.
+//
+static bool replay_upload(const rocsparse_capture_reader& reader,
+                          const replay_operand_t&         op,
+                          replay_arrays&                  arrays)
+{
+    const std::vector<replay_array_t> layout = replay_layout(op);
+    if(layout.empty())
+    {
+        return false;
+    }
+
+    const int64_t batch_count = replay_batch_count(op);
+
+    std::vector<std::vector<char>> h(layout.size());
+    for(size_t k = 0; k < layout.size(); ++k)
+    {
+        const replay_array_t& a    = layout[k];
+        const int64_t         span = (a.count > 0) ? (batch_count - 1) * a.stride + a.count : 0;
+        h[k].resize(std::max<int64_t>(span, 1) * a.size, 0);
+    }
+
+    bool recorded = false;
+#ifdef ROCSPARSEIO
+    if(op.data())
+    {
+        for(int64_t b = 0; b < batch_count; ++b)
+        {
+            std::vector<std::vector<char>> values;
+            if(!reader.read_values(op, b, values) || values.size() != layout.size())
+            {
+                return false;
+            }
+
+            for(size_t k = 0; k < layout.size(); ++k)
+            {
+                const replay_array_t& a = layout[k];
+                if(values[k].size() != a.count * a.size)
+                {
+                    return false;
+                }
+                std::memcpy(
+                    h[k].data() + b * a.stride * a.size, values[k].data(), values[k].size());
+            }
+        }
+        recorded = true;
+    }
+#endif
+
+    if(!recorded)
+    {
+        if(op.kind != "dnvec" && op.kind != "dnmat")
+        {
+            return false;
+        }
+        replay_ones(rocsparse_datatype(op.get("data_type")), h[0]);
+    }
+
+    arrays.clear();
+    for(const std::vector<char>& array : h)
+    {
+        arrays.emplace_back(new device_vector<char>(array.size()));
+        CHECK_HIP_ERROR(
+            hipMemcpy(*arrays.back(), array.data(), array.size(), hipMemcpyHostToDevice));
+    }
+    return true;
+}
+
+static rocsparse_spmat_descr replay_spmat(const rocsparse_capture_reader& reader,
+                                          const replay_operand_t&         op,
+                                          replay_matrix&                  A)
+{
+    if(A.descr != nullptr)
+    {
+        return *A.descr;
+    }
+
+    if(A.failed || !replay_upload(reader, op, A.arrays))
+    {
+        A.failed = true;
+        return nullptr;
+    }
+
+    const rocsparse_format     format    = rocsparse_format(op.get("format"));
+    const rocsparse_indextype  row_type  = rocsparse_indextype(op.get("row_type"));
+    const rocsparse_indextype  col_type  = rocsparse_indextype(op.get("col_type"));
+    const rocsparse_datatype   data_type = rocsparse_datatype(op.get("data_type"));
+    const rocsparse_index_base idx_base  = rocsparse_index_base(op.get("idx_base"));
+    const int64_t              rows      = op.get("rows");
+    const int64_t              cols      = op.get("cols");
+    const int64_t              nnz       = op.get("nnz");
+    const int64_t              count     = replay_batch_count(op);
+
+    char* p0 = *A.arrays[0];
+    char* p1 = *A.arrays[1];
+    char* p2 = *A.arrays[2];
+
+    switch(format)
+    {
+    case rocsparse_format_coo:
+    {
+        A.descr.reset(
+            new rocsparse_local_spmat(rows, cols, nnz, p0, p1, p2, row_type, idx_base, data_type));
+        if(count > 1)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_coo_set_strided_batch(*A.descr, count, op.get("batch_stride")));
+        }
+        break;
+    }
+    case rocsparse_format_csr:
+    case rocsparse_format_csc:
+    {
+        // CSR has its offsets in the row array, CSC in the column array
+        const bool csr = (format == rocsparse_format_csr);
+        A.descr.reset(new rocsparse_local_spmat(rows,
+                                                cols,
+                                                nnz,
+                                                p0,
+                                                p1,
+                                                p2,
+                                                csr ? row_type : col_type,
+                                                csr ? col_type : row_type,
+                                                idx_base,
+                                                data_type,
+                                                format));
+        if(count > 1)
+        {
+            const int64_t offsets = op.get("offsets_batch_stride");
+            const int64_t indices = op.get("columns_values_batch_stride");
+            CHECK_ROCSPARSE_ERROR(
+                csr ? rocsparse_csr_set_strided_batch(*A.descr, count, offsets, indices)
+                    : rocsparse_csc_set_strided_batch(*A.descr, count, offsets, indices));
+        }
+        break;
+    }
+    case rocsparse_format_bsr:
+    {
+        A.descr.reset(new rocsparse_local_spmat(rows,
+                                                cols,
+                                                nnz,
+                                                rocsparse_direction(op.get("block_dir")),
+                                                op.get("block_dim"),
+                                                p0,
+                                                p1,
+                                                p2,
+                                                row_type,
+                                                col_type,
+                                                idx_base,
+                                                data_type,
+                                                format));
+        if(count > 1)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_bsr_set_strided_batch(*A.descr,
+                                                count,
+                                                op.get("offsets_batch_stride"),
+                                                op.get("columns_values_batch_stride")));
+        }
+        break;
+    }
+    case rocsparse_format_coo_aos:
+    case rocsparse_format_ell:
+    case rocsparse_format_bell:
+    {
+        A.failed = true;
+        return nullptr;
+    }
+    }
+
+    // The attributes of the matrix descriptor, if the matrix had one
+    if(op.keys.count("matrix_type") != 0)
+    {
+        const rocsparse_matrix_type  matrix_type  = rocsparse_matrix_type(op.get("matrix_type"));
+        const rocsparse_fill_mode    fill_mode    = rocsparse_fill_mode(op.get("fill_mode"));
+        const rocsparse_diag_type    diag_type    = rocsparse_diag_type(op.get("diag_type"));
+        const rocsparse_storage_mode storage_mode = rocsparse_storage_mode(op.get("storage_mode"));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+            *A.descr, rocsparse_spmat_matrix_type, &matrix_type, sizeof(matrix_type)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+            *A.descr, rocsparse_spmat_fill_mode, &fill_mode, sizeof(fill_mode)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+            *A.descr, rocsparse_spmat_diag_type, &diag_type, sizeof(diag_type)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+            *A.descr, rocsparse_spmat_storage_mode, &storage_mode, sizeof(storage_mode)));
+    }
+
+    return *A.descr;
+}
+
+static std::unique_ptr<rocsparse_local_dnvec> replay_dnvec(const rocsparse_capture_reader& reader,
+                                                           const replay_operand_t&         op,
+                                                           replay_arrays&                  arrays)
+{
+    if(!replay_upload(reader, op, arrays))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<rocsparse_local_dnvec> x(new rocsparse_local_dnvec(
+        op.get("size"), (char*)*arrays[0], rocsparse_datatype(op.get("data_type"))));
+
+    const int64_t count = replay_batch_count(op);
+    if(count > 1)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(*x, count, op.get("batch_stride")));
+    }
+    return x;
+}
+
+static std::unique_ptr<rocsparse_local_dnmat> replay_dnmat(const rocsparse_capture_reader& reader,
+                                                           const replay_operand_t&         op,
+                                                           replay_arrays&                  arrays)
+{
+    if(!replay_upload(reader, op, arrays))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<rocsparse_local_dnmat> B(
+        new rocsparse_local_dnmat(op.get("rows"),
+                                  op.get("cols"),
+                                  op.get("ld"),
+                                  (char*)*arrays[0],
+                                  rocsparse_datatype(op.get("data_type")),
+                                  rocsparse_order(op.get("order"))));
+
+    const int64_t count = replay_batch_count(op);
+    if(count > 1)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(*B, count, op.get("batch_stride")));
+    }
+    return B;
+}
+
+//
+// Operand an argument of a call refers to, nullptr if it is not an operand of
+// the given kind.
+//
+static const replay_operand_t* replay_operand(const rocsparse_capture_reader&         reader,
+                                              const rocsparse_capture_reader::call_t& call,
+                                              size_t                                  i,
+                                              const char*                             kind)
+{
+    const replay_operand_t* op = reader.operand(call.args[i]);
+    return (op != nullptr && op->kind == kind) ? op : nullptr;
+}
+
+//
+// Time the compute stage, after the buffer size and preprocess stages.
+//
+template <typename F>
+static double replay_time(rocsparse_handle handle, const replay_options& options, F compute)
+{
+    hipStream_t stream;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(handle, &stream));
+
+    for(int i = 0; i < options.warmup; ++i)
+    {
+        compute();
+    }
+
+    const double t0 = get_time_us_sync(stream);
+    for(int i = 0; i < options.iters; ++i)
+    {
+        compute();
+    }
+    const double t1 = get_time_us_sync(stream);
+
+    return (t1 - t0) / std::max(options.iters, 1);
+}
+
+//
+// The arguments of rocsparse_spmv, in the order of the trace log, are trans,
+// alpha, mat, x, beta, y, compute_type, alg, stage, buffer_size and
+// temp_buffer.
+//
+static bool replay_spmv(rocsparse_handle                        handle,
+                        const replay_options&                   options,
+                        const rocsparse_capture_reader&         reader,
+                        const rocsparse_capture_reader::call_t& call,
+                        std::map<std::string, replay_matrix>&   matrices,
+                        replay_result&                          result)
+{
+    const replay_operand_t* opA = replay_operand(reader, call, 2, "spmat");
+    const replay_operand_t* opx = replay_operand(reader, call, 3, "dnvec");
+    const replay_operand_t* opy = replay_operand(reader, call, 5, "dnvec");
+
+    unsigned char alpha[16];
+    unsigned char beta[16];
+    if(opA == nullptr || opx == nullptr || opy == nullptr
+       || !rocsparse_capture_reader::scalar(call.args[1], alpha)
+       || !rocsparse_capture_reader::scalar(call.args[4], beta))
+    {
+        return false;
+    }
+
+    const rocsparse_operation trans = rocsparse_operation(replay_int(call, 0));
+    const rocsparse_datatype  ctype = rocsparse_datatype(replay_int(call, 6));
+    const rocsparse_spmv_alg  alg   = rocsparse_spmv_alg(replay_int(call, 7));
+
+    rocsparse_spmat_descr mat = replay_spmat(reader, *opA, matrices[opA->id]);
+
+    replay_arrays dx;
+    replay_arrays dy;
+    auto          x = replay_dnvec(reader, *opx, dx);
+    auto          y = replay_dnvec(reader, *opy, dy);
+    if(mat == nullptr || x == nullptr || y == nullptr)
+    {
+        return false;
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    size_t buffer_size = 0;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         trans,
+                                         alpha,
+                                         mat,
+                                         *x,
+                                         beta,
+                                         *y,
+                                         ctype,
+                                         alg,
+                                         rocsparse_spmv_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    device_vector<char> buffer(std::max<size_t>(buffer_size, 1));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         trans,
+                                         alpha,
+                                         mat,
+                                         *x,
+                                         beta,
+                                         *y,
+                                         ctype,
+                                         alg,
+                                         rocsparse_spmv_stage_preprocess,
+                                         &buffer_size,
+                                         buffer));
+
+    result.time_us = replay_time(handle, options, [&]() {
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                             trans,
+                                             alpha,
+                                             mat,
+                                             *x,
+                                             beta,
+                                             *y,
+                                             ctype,
+                                             alg,
+                                             rocsparse_spmv_stage_compute,
+                                             &buffer_size,
+                                             buffer));
+    });
+
+    result.matrix = opA->id;
+    result.rows   = opA->get("rows");
+    result.cols   = opA->get("cols");
+    result.nnz    = opA->get("nnz");
+    result.flops  = 2.0 * replay_nnz(*opA) * replay_batch_count(*opy);
+    return true;
+}
+
+//
+// The arguments of rocsparse_spmm, in the order of the trace log, are trans_A,
+// trans_B, alpha, mat_A, mat_B, beta, mat_C, compute_type, alg, stage,
+// buffer_size and temp_buffer.
+//
+static bool replay_spmm(rocsparse_handle                        handle,
+                        const replay_options&                   options,
+                        const rocsparse_capture_reader&         reader,
+                        const rocsparse_capture_reader::call_t& call,
+                        std::map<std::string, replay_matrix>&   matrices,
+                        replay_result&                          result)
+{
+    const replay_operand_t* opA = replay_operand(reader, call, 3, "spmat");
+    const replay_operand_t* opB = replay_operand(reader, call, 4, "dnmat");
+    const replay_operand_t* opC = replay_operand(reader, call, 6, "dnmat");
+
+    unsigned char alpha[16];
+    unsigned char beta[16];
+    if(opA == nullptr || opB == nullptr || opC == nullptr
+       || !rocsparse_capture_reader::scalar(call.args[2], alpha)
+       || !rocsparse_capture_reader::scalar(call.args[5], beta))
+    {
+        return false;
+    }
+
+    const rocsparse_operation trans_A = rocsparse_operation(replay_int(call, 0));
+    const rocsparse_operation trans_B = rocsparse_operation(replay_int(call, 1));
+    const rocsparse_datatype  ctype   = rocsparse_datatype(replay_int(call, 7));
+    const rocsparse_spmm_alg  alg     = rocsparse_spmm_alg(replay_int(call, 8));
+
+    rocsparse_spmat_descr mat = replay_spmat(reader, *opA, matrices[opA->id]);
+
+    replay_arrays dB;
+    replay_arrays dC;
+    auto          B = replay_dnmat(reader, *opB, dB);
+    auto          C = replay_dnmat(reader, *opC, dC);
+    if(mat == nullptr || B == nullptr || C == nullptr)
+    {
+        return false;
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    size_t buffer_size = 0;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         alpha,
+                                         mat,
+                                         *B,
+                                         beta,
+                                         *C,
+                                         ctype,
+                                         alg,
+                                         rocsparse_spmm_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    device_vector<char> buffer(std::max<size_t>(buffer_size, 1));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         alpha,
+                                         mat,
+                                         *B,
+                                         beta,
+                                         *C,
+                                         ctype,
+                                         alg,
+                                         rocsparse_spmm_stage_preprocess,
+                                         &buffer_size,
+                                         buffer));
+
+    result.time_us = replay_time(handle, options, [&]() {
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
+                                             trans_A,
+                                             trans_B,
+                                             alpha,
+                                             mat,
+                                             *B,
+                                             beta,
+                                             *C,
+                                             ctype,
+                                             alg,
+                                             rocsparse_spmm_stage_compute,
+                                             &buffer_size,
+                                             buffer));
+    });
+
+    result.matrix = opA->id;
+    result.rows   = opA->get("rows");
+    result.cols   = opA->get("cols");
+    result.nnz    = opA->get("nnz");
+    result.flops  = 2.0 * replay_nnz(*opA) * opC->get("cols") * replay_batch_count(*opC);
+    return true;
+}
+
+static void replay_usage(const char* name)
+{
+    std::cout << "usage: " << name << " [options] directory" << std::endl
+              << std::endl
+              << "Re-execute the calls recorded in a rocsparse capture directory." << std::endl
+              << std::endl
+              << "options:" << std::endl
+              << "  --device <id>       device to run on (default 0)" << std::endl
+              << "  --iters <n>         timed iterations per call (default 10)" << std::endl
+              << "  --warmup <n>        untimed iterations per call (default 2)" << std::endl
+              << "  --help              print this help" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    replay_options options;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+
+        if(arg == "--help" || arg == "-h")
+        {
+            replay_usage(argv[0]);
+            return 0;
+        }
+        else if(arg == "--device" && i + 1 < argc)
+        {
+            options.device = std::atoi(argv[++i]);
+        }
+        else if(arg == "--iters" && i + 1 < argc)
+        {
+            options.iters = std::atoi(argv[++i]);
+        }
+        else if(arg == "--warmup" && i + 1 < argc)
+        {
+            options.warmup = std::atoi(argv[++i]);
+        }
+        else if(options.directory.empty() && arg[0] != '-')
+        {
+            options.directory = arg;
+        }
+        else
+        {
+            replay_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if(options.directory.empty())
+    {
+        replay_usage(argv[0]);
+        return 1;
+    }
+
+    rocsparse_capture_reader reader;
+    if(!reader.read(options.directory))
+    {
+        return 1;
+    }
+
+    std::cout << "rocsparse-replay: " << reader.calls.size() << " calls, "
+              << reader.operands.size() << " operands" << std::endl;
+
+    CHECK_HIP_ERROR(hipSetDevice(options.device));
+
+    rocsparse_local_handle handle;
+
+    std::cout << std::setw(6) << "call" << std::setw(16) << "routine" << std::setw(18) << "matrix"
+              << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(14) << "nnz"
+              << std::setw(14) << "time_us" << std::setw(12) << "GFlop/s" << std::endl;
+
+    std::map<std::string, replay_matrix> matrices;
+    std::map<std::string, int64_t>       skipped;
+
+    for(size_t i = 0; i < reader.calls.size(); ++i)
+    {
+        const rocsparse_capture_reader::call_t& call = reader.calls[i];
+
+        // The buffer size and preprocess stages are replayed with the compute stage
+        replay_result result;
+        bool          replayed = false;
+        if(call.routine == "rocsparse_spmv" && call.args.size() >= 9)
+        {
+            if(replay_int(call, 8) != rocsparse_spmv_stage_compute)
+            {
+                continue;
+            }
+            replayed = replay_spmv(handle, options, reader, call, matrices, result);
+        }
+        else if(call.routine == "rocsparse_spmm" && call.args.size() >= 10)
+        {
+            if(replay_int(call, 9) != rocsparse_spmm_stage_compute)
+            {
+                continue;
+            }
+            replayed = replay_spmm(handle, options, reader, call, matrices, result);
+        }
+
+        if(!replayed)
+        {
+            ++skipped[call.routine];
+            continue;
+        }
+
+        std::cout << std::setw(6) << i << std::setw(16) << call.routine << std::setw(18)
+                  << result.matrix.substr(0, 16) << std::setw(12) << result.rows << std::setw(12)
+                  << result.cols << std::setw(14) << result.nnz << std::setw(14) << std::fixed
+                  << std::setprecision(2) << result.time_us << std::setw(12)
+                  << result.flops / (result.time_us * 1e3) << std::endl;
+    }
+
+    // Routines that are not replayed, or calls whose operands were not captured
+    for(const auto& it : skipped)
+    {
+        std::cerr << "rocsparse-replay: " << it.second << " calls of " << it.first
+                  << " are not replayed" << std::endl;
+    }
+
+    return 0;
+}
@@ -23,14 +23,22 @@
  * ************************************************************************ */
 #include "rocsparse_check.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #ifdef GOOGLE_TEST
 #include <gtest/gtest.h>
 #endif
 
 #ifndef GOOGLE_TEST
 
-#include <iostream>
-
 #define ASSERT_TRUE(cond)                                      \
     do                                                         \
     {                                                          \
@@ -41,400 +49,601 @@
         }                                                      \
     } while(0)
 
-#define ASSERT_EQ(state1, state2)                                                              \
-    do                                                                                         \
-    {                                                                                          \
-        if(state1 != state2)                                                                   \
-        {                                                                                      \
-            std::cerr.precision(16);                                                           \
-            std::cerr << "ASSERT_EQ(" << state1 << ", " << state2 << ") failed." << std::endl; \
-            exit(EXIT_FAILURE);                                                                \
-        }                                                                                      \
-    } while(0)
-
-#define ASSERT_FLOAT_EQ ASSERT_EQ
-#define ASSERT_DOUBLE_EQ ASSERT_EQ
 #endif
 
-#define ASSERT_FLOAT_COMPLEX_EQ(a, b)                \
-    do                                               \
-    {                                                \
-        ASSERT_FLOAT_EQ(std::real(a), std::real(b)); \
-        ASSERT_FLOAT_EQ(std::imag(a), std::imag(b)); \
-    } while(0)
+#define MAX_TOL_MULTIPLIER 4
 
-#define ASSERT_DOUBLE_COMPLEX_EQ(a, b)                \
-    do                                                \
-    {                                                 \
-        ASSERT_DOUBLE_EQ(std::real(a), std::real(b)); \
-        ASSERT_DOUBLE_EQ(std::imag(a), std::imag(b)); \
-    } while(0)
+//
+// Largest distance in units in the last place of equal floating point
+// entries, the tolerance of ASSERT_FLOAT_EQ and ASSERT_DOUBLE_EQ.
+//
+#ifdef GOOGLE_TEST
+static constexpr double rocsparse_check_max_ulps = 4;
+#else
+static constexpr double rocsparse_check_max_ulps = 0;
+#endif
 
-#define ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, UNIT_ASSERT_EQ)  \
-    do                                                              \
-    {                                                               \
-        for(int64_t j = 0; j < N; ++j)                              \
-            for(int64_t i = 0; i < M; ++i)                          \
-                if(rocsparse_isnan(A[i + j * LDA]))                 \
-                {                                                   \
-                    ASSERT_TRUE(rocsparse_isnan(B[i + j * LDB]));   \
-                }                                                   \
-                else                                                \
-                {                                                   \
-                    UNIT_ASSERT_EQ(A[i + j * LDA], B[i + j * LDB]); \
-                }                                                   \
-    } while(0)
+//
+// Number of entries compared by a task, and number of mismatches reported.
+//
+static constexpr int64_t rocsparse_check_chunk_size     = 1 << 14;
+static constexpr int64_t rocsparse_check_max_mismatches = 8;
+
+//
+// Entries are scored from their real components, complex entries have two
+// components.
+//
+template <typename T>
+struct rocsparse_check_traits
+{
+    using real_t                             = T;
+    static constexpr int64_t num_components = 1;
+};
 
 template <>
-void unit_check_general(
-    int64_t M, int64_t N, const float* A, int64_t LDA, const float* B, int64_t LDB)
+struct rocsparse_check_traits<rocsparse_float_complex>
 {
-    ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, ASSERT_FLOAT_EQ);
-}
+    using real_t                             = float;
+    static constexpr int64_t num_components = 2;
+};
 
 template <>
-void unit_check_general(
-    int64_t M, int64_t N, const double* A, int64_t LDA, const double* B, int64_t LDB)
+struct rocsparse_check_traits<rocsparse_double_complex>
 {
-    ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, ASSERT_DOUBLE_EQ);
+    using real_t                             = double;
+    static constexpr int64_t num_components = 2;
+};
+
+//
+// Distance in units in the last place, +0 and -0 are equal.
+//
+template <typename U, typename R>
+static inline double rocsparse_check_ulps(R a, R b)
+{
+    static constexpr U sign = U(1) << (8 * sizeof(U) - 1);
+
+    U ua;
+    U ub;
+    memcpy(&ua, &a, sizeof(U));
+    memcpy(&ub, &b, sizeof(U));
+    ua = (ua & sign) ? ~ua + 1 : (ua | sign);
+    ub = (ub & sign) ? ~ub + 1 : (ub | sign);
+    return static_cast<double>((ua > ub) ? ua - ub : ub - ua);
 }
 
-template <>
-void unit_check_general(int64_t                        M,
-                        int64_t                        N,
-                        const rocsparse_float_complex* A,
-                        int64_t                        LDA,
-                        const rocsparse_float_complex* B,
-                        int64_t                        LDB)
+static inline double rocsparse_check_ulps(float a, float b)
 {
-    ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, ASSERT_FLOAT_COMPLEX_EQ);
+    return rocsparse_check_ulps<uint32_t>(a, b);
 }
 
-template <>
-void unit_check_general(int64_t                         M,
-                        int64_t                         N,
-                        const rocsparse_double_complex* A,
-                        int64_t                         LDA,
-                        const rocsparse_double_complex* B,
-                        int64_t                         LDB)
+static inline double rocsparse_check_ulps(double a, double b)
 {
-    ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, ASSERT_DOUBLE_COMPLEX_EQ);
+    return rocsparse_check_ulps<uint64_t>(a, b);
 }
 
-template <>
-void unit_check_general(
-    int64_t M, int64_t N, const int8_t* A, int64_t LDA, const int8_t* B, int64_t LDB)
+//
+// Score of a component for unit_check, the distance in units in the last
+// place for floating point components. A NaN of a requires a NaN of b.
+//
+template <typename R>
+static inline double rocsparse_check_unit_score(R a, R b)
 {
-    ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, ASSERT_EQ);
+    return (a == b) ? 0.0 : std::numeric_limits<double>::infinity();
 }
 
-template <>
-void unit_check_general(
-    int64_t M, int64_t N, const int32_t* A, int64_t LDA, const int32_t* B, int64_t LDB)
+template <typename R>
+static inline double rocsparse_check_unit_score_floating(R a, R b)
 {
-    ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, ASSERT_EQ);
+    return std::isnan(a) ? (std::isnan(b) ? 0.0 : std::numeric_limits<double>::infinity())
+                         : (std::isnan(b) ? std::numeric_limits<double>::infinity()
+                                          : rocsparse_check_ulps(a, b));
 }
 
-template <>
-void unit_check_general(
-    int64_t M, int64_t N, const int64_t* A, int64_t LDA, const int64_t* B, int64_t LDB)
+static inline double rocsparse_check_unit_score(float a, float b)
 {
-    ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, ASSERT_EQ);
+    return rocsparse_check_unit_score_floating(a, b);
 }
-template <>
-void unit_check_general(
-    int64_t M, int64_t N, const size_t* A, int64_t LDA, const size_t* B, int64_t LDB)
+
+static inline double rocsparse_check_unit_score(double a, double b)
 {
-    ROCSPARSE_UNIT_CHECK(M, N, A, LDA, B, LDB, ASSERT_EQ);
+    return rocsparse_check_unit_score_floating(a, b);
 }
 
-template <>
-void unit_check_enum(const rocsparse_index_base a, const rocsparse_index_base b)
+//
+// Score of a finite component of a for near_check, the multiple of the
+// tolerance max(|a| tol, 10 eps) reached by |a - b|. A NaN of b fails.
+//
+template <typename R>
+static inline double rocsparse_check_near_score(R a, R b, R)
 {
-    ASSERT_TRUE(a == b);
+    return rocsparse_check_unit_score(a, b);
 }
 
-template <>
-void unit_check_enum(const rocsparse_order a, const rocsparse_order b)
+template <typename R>
+static inline double rocsparse_check_near_score_floating(R a, R b, R tol)
 {
-    ASSERT_TRUE(a == b);
+    const R      compare_val = std::max(std::abs(a * tol), 10 * std::numeric_limits<R>::epsilon());
+    const double score       = static_cast<double>(std::abs(a - b) / compare_val);
+    return std::isnan(score) ? std::numeric_limits<double>::infinity() : score;
 }
 
-template <>
-void unit_check_enum(const rocsparse_direction a, const rocsparse_direction b)
+static inline double rocsparse_check_near_score(float a, float b, float tol)
 {
-    ASSERT_TRUE(a == b);
+    return rocsparse_check_near_score_floating(a, b, tol);
 }
 
-template <>
-void unit_check_enum(const rocsparse_datatype a, const rocsparse_datatype b)
+static inline double rocsparse_check_near_score(double a, double b, double tol)
 {
-    ASSERT_TRUE(a == b);
+    return rocsparse_check_near_score_floating(a, b, tol);
 }
 
-template <>
-void unit_check_enum(const rocsparse_indextype a, const rocsparse_indextype b)
+//
+// Scores of the entries. A NaN entry of a, with a NaN component, requires a
+// NaN entry of b and, for near_check, an infinite entry of a requires an
+// infinite entry of b. Other entries get the largest score of their
+// components.
+//
+template <typename T>
+static inline double rocsparse_check_unit_entry_score(const T& a, const T& b)
 {
-    ASSERT_TRUE(a == b);
+    using R                    = typename rocsparse_check_traits<T>::real_t;
+    static constexpr int64_t C = rocsparse_check_traits<T>::num_components;
+
+    if(rocsparse_isnan(a))
+    {
+        return rocsparse_isnan(b) ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+
+    const R* ra    = reinterpret_cast<const R*>(&a);
+    const R* rb    = reinterpret_cast<const R*>(&b);
+    double   score = 0;
+    for(int64_t c = 0; c < C; ++c)
+    {
+        score = std::max(score, rocsparse_check_unit_score(ra[c], rb[c]));
+    }
+    return score;
 }
 
-#define MAX_TOL_MULTIPLIER 4
+template <typename T, typename R>
+static inline double rocsparse_check_near_entry_score(const T& a, const T& b, R tol)
+{
+    static constexpr int64_t C = rocsparse_check_traits<T>::num_components;
 
-template <typename T>
-void near_check_general_template(int64_t            M,
-                                 int64_t            N,
-                                 const T*           A,
-                                 int64_t            LDA,
-                                 const T*           B,
-                                 int64_t            LDB,
-                                 floating_data_t<T> tol = default_tolerance<T>::value)
+    if(rocsparse_isnan(a))
+    {
+        return rocsparse_isnan(b) ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+
+    if(rocsparse_isinf(a))
+    {
+        return rocsparse_isinf(b) ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+
+    const R* ra    = reinterpret_cast<const R*>(&a);
+    const R* rb    = reinterpret_cast<const R*>(&b);
+    double   score = 0;
+    for(int64_t c = 0; c < C; ++c)
+    {
+        score = std::max(score, rocsparse_check_near_score(ra[c], rb[c], tol));
+    }
+    return score;
+}
+
+//
+// Call f(i, j, size) for the runs of consecutive entries of the columns of an
+// array of M rows covered by the entries [begin, end) in column major order.
+//
+template <typename F>
+static inline void rocsparse_check_runs(int64_t M, int64_t begin, int64_t end, F&& f)
 {
-    int tolm = 1;
-    for(int64_t j = 0; j < N; ++j)
+    int64_t i = begin % M;
+    int64_t j = begin / M;
+    while(begin < end)
     {
-        for(int64_t i = 0; i < M; ++i)
-        {
-            T compare_val
-                = std::max(std::abs(A[i + j * LDA] * tol), 10 * std::numeric_limits<T>::epsilon());
-#ifdef GOOGLE_TEST
-            if(rocsparse_isnan(A[i + j * LDA]))
-            {
-                ASSERT_TRUE(rocsparse_isnan(B[i + j * LDB]));
-            }
-            else if(rocsparse_isinf(A[i + j * LDA]))
-            {
-                ASSERT_TRUE(rocsparse_isinf(B[i + j * LDB]));
-            }
-            else
-            {
-                int k;
-                for(k = 1; k <= MAX_TOL_MULTIPLIER; ++k)
-                {
-                    if(std::abs(A[i + j * LDA] - B[i + j * LDB]) <= compare_val * k)
-                    {
-                        break;
-                    }
-                }
+        const int64_t size = std::min(M - i, end - begin);
+        f(i, j, size);
+        begin += size;
+        i = 0;
+        ++j;
+    }
+}
 
-                if(k > MAX_TOL_MULTIPLIER)
-                {
-                    ASSERT_NEAR(A[i + j * LDA], B[i + j * LDB], compare_val);
-                }
-                tolm = std::max(tolm, k);
-            }
-#else
+//
+// Number of failing entries, with a score above limit, and largest score of
+// the passing entries, reduced in parallel over chunks of entries and
+// vectorized along the columns.
+//
+template <typename T, typename F>
+static void rocsparse_check_reduce(int64_t  M,
+                                   int64_t  N,
+                                   const T* A,
+                                   int64_t  LDA,
+                                   const T* B,
+                                   int64_t  LDB,
+                                   double   limit,
+                                   F        score,
+                                   int64_t& nfails,
+                                   double&  worst)
+{
+    const int64_t size    = M * N;
+    const int64_t nchunks = (size - 1) / rocsparse_check_chunk_size + 1;
 
-            int k;
-            for(k = 1; k <= MAX_TOL_MULTIPLIER; ++k)
-            {
-                if(std::abs(A[i + j * LDA] - B[i + j * LDB]) <= compare_val * k)
-                {
-                    break;
-                }
-            }
+    int64_t fails   = 0;
+    double  largest = 0;
 
-            if(k > MAX_TOL_MULTIPLIER)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : fails) reduction(max : largest)
+#endif
+    for(int64_t chunk = 0; chunk < nchunks; ++chunk)
+    {
+        const int64_t begin = chunk * rocsparse_check_chunk_size;
+        const int64_t end   = std::min(begin + rocsparse_check_chunk_size, size);
+        rocsparse_check_runs(M, begin, end, [&](int64_t i, int64_t j, int64_t run) {
+            const T* __restrict__ a = A + i + j * LDA;
+            const T* __restrict__ b = B + i + j * LDB;
+
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : fails) reduction(max : largest)
+#endif
+            for(int64_t k = 0; k < run; ++k)
             {
-                std::cerr.precision(12);
-                std::cerr << "ASSERT_NEAR(" << A[i + j * LDA] << ", " << B[i + j * LDB]
-                          << ") failed: " << std::abs(A[i + j * LDA] - B[i + j * LDB])
-                          << " exceeds permissive range [" << compare_val << ","
-                          << compare_val * MAX_TOL_MULTIPLIER << " ]" << std::endl;
-                exit(EXIT_FAILURE);
+                const double s  = score(a[k], b[k]);
+                const bool   ok = (s <= limit);
+                fails += !ok;
+                largest = std::max(largest, ok ? s : 0.0);
             }
-            tolm = std::max(tolm, k);
-#endif
-        }
+        });
     }
 
-    if(tolm > 1)
+    nfails = fails;
+    worst  = largest;
+}
+
+//
+// Diagnostic of failing arrays, computed only when a check fails.
+//
+struct rocsparse_check_diagnostic
+{
+    int64_t nfails{};
+    double  max_abs{};
+    int64_t max_abs_index{-1};
+    double  max_rel{};
+    int64_t max_rel_index{-1};
+
+    //
+    // Distances in units in the last place of the floating point components,
+    // 0, 1, 2-4, 5-16, 17-256, 257-65536, larger, and not comparable.
+    //
+    int64_t histogram[8]{};
+
+    //
+    // First failing entries, in column major order.
+    //
+    std::vector<int64_t> mismatches;
+};
+
+static inline int rocsparse_check_histogram_bin(double ulps)
+{
+    static const double bounds[6] = {0, 1, 4, 16, 256, 65536};
+    for(int bin = 0; bin < 6; ++bin)
     {
-        std::cerr << "WARNING near_check has been permissive with a tolerance multiplier equal to "
-                  << tolm << std::endl;
+        if(ulps <= bounds[bin])
+        {
+            return bin;
+        }
     }
+    return std::isfinite(ulps) ? 6 : 7;
 }
 
-template <>
-void near_check_general_template(int64_t                        M,
-                                 int64_t                        N,
-                                 const rocsparse_float_complex* A,
-                                 int64_t                        LDA,
-                                 const rocsparse_float_complex* B,
-                                 int64_t                        LDB,
-                                 float                          tol)
+template <typename T, typename F>
+static void rocsparse_check_diagnose(int64_t                     M,
+                                     int64_t                     N,
+                                     const T*                    A,
+                                     int64_t                     LDA,
+                                     const T*                    B,
+                                     int64_t                     LDB,
+                                     double                      limit,
+                                     F                           score,
+                                     rocsparse_check_diagnostic& diagnostic)
 {
-    int tolm = 1;
-    for(int64_t j = 0; j < N; ++j)
+    using R                    = typename rocsparse_check_traits<T>::real_t;
+    static constexpr int64_t C = rocsparse_check_traits<T>::num_components;
+
+    const int64_t size    = M * N;
+    const int64_t nchunks = (size - 1) / rocsparse_check_chunk_size + 1;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        for(int64_t i = 0; i < M; ++i)
+        rocsparse_check_diagnostic local;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(int64_t chunk = 0; chunk < nchunks; ++chunk)
         {
-            rocsparse_float_complex compare_val
-                = rocsparse_float_complex(std::max(std::abs(std::real(A[i + j * LDA]) * tol),
-                                                   10 * std::numeric_limits<float>::epsilon()),
-                                          std::max(std::abs(std::imag(A[i + j * LDA]) * tol),
-                                                   10 * std::numeric_limits<float>::epsilon()));
-#ifdef GOOGLE_TEST
-            if(rocsparse_isnan(A[i + j * LDA]))
-            {
-                ASSERT_TRUE(rocsparse_isnan(B[i + j * LDB]));
-            }
-            else if(rocsparse_isinf(A[i + j * LDA]))
-            {
-                ASSERT_TRUE(rocsparse_isinf(B[i + j * LDB]));
-            }
-            else
-            {
-                int k;
-                for(k = 1; k <= MAX_TOL_MULTIPLIER; ++k)
+            const int64_t begin = chunk * rocsparse_check_chunk_size;
+            const int64_t end   = std::min(begin + rocsparse_check_chunk_size, size);
+            rocsparse_check_runs(M, begin, end, [&](int64_t i, int64_t j, int64_t run) {
+                for(int64_t k = 0; k < run; ++k)
                 {
-                    if(std::abs(std::real(A[i + j * LDA]) - std::real(B[i + j * LDB]))
-                           <= std::real(compare_val) * k
-                       && std::abs(std::imag(A[i + j * LDA]) - std::imag(B[i + j * LDB]))
-                              <= std::imag(compare_val) * k)
+                    const int64_t index = i + k + j * M;
+                    const T&      ak    = A[i + k + j * LDA];
+                    const T&      bk    = B[i + k + j * LDB];
+                    if(!(score(ak, bk) <= limit))
                     {
-                        break;
+                        ++local.nfails;
+                        if(local.mismatches.size() < rocsparse_check_max_mismatches)
+                        {
+                            local.mismatches.push_back(index);
+                        }
                     }
-                }
 
-                if(k > MAX_TOL_MULTIPLIER)
-                {
-                    ASSERT_NEAR(std::real(A[i + j * LDA]),
-                                std::real(B[i + j * LDB]),
-                                std::real(compare_val));
-                    ASSERT_NEAR(std::imag(A[i + j * LDA]),
-                                std::imag(B[i + j * LDB]),
-                                std::imag(compare_val));
+                    const R* a = reinterpret_cast<const R*>(&ak);
+                    const R* b = reinterpret_cast<const R*>(&bk);
+                    for(int64_t c = 0; c < C; ++c)
+                    {
+                        const double abs_error
+                            = std::abs(static_cast<double>(a[c]) - static_cast<double>(b[c]));
+                        if(abs_error > local.max_abs)
+                        {
+                            local.max_abs       = abs_error;
+                            local.max_abs_index = index;
+                        }
+
+                        const double rel_error = abs_error / std::abs(static_cast<double>(a[c]));
+                        if(a[c] != 0 && rel_error > local.max_rel)
+                        {
+                            local.max_rel       = rel_error;
+                            local.max_rel_index = index;
+                        }
+
+                        if(std::is_floating_point<R>::value)
+                        {
+                            ++local.histogram[rocsparse_check_histogram_bin(
+                                rocsparse_check_unit_score(a[c], b[c]))];
+                        }
+                    }
                 }
-                tolm = std::max(tolm, k);
-            }
-#else
+            });
+        }
 
-            int k;
-            for(k = 1; k <= MAX_TOL_MULTIPLIER; ++k)
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            diagnostic.nfails += local.nfails;
+            if(local.max_abs > diagnostic.max_abs)
             {
-                if(std::abs(std::real(A[i + j * LDA]) - std::real(B[i + j * LDB]))
-                       <= std::real(compare_val) * k
-                   && std::abs(std::imag(A[i + j * LDA]) - std::imag(B[i + j * LDB]))
-                          <= std::imag(compare_val) * k)
-                {
-                    break;
-                }
+                diagnostic.max_abs       = local.max_abs;
+                diagnostic.max_abs_index = local.max_abs_index;
             }
-
-            if(k > MAX_TOL_MULTIPLIER)
+            if(local.max_rel > diagnostic.max_rel)
             {
-                std::cerr.precision(16);
-                std::cerr << "ASSERT_NEAR(" << A[i + j * LDA] << ", " << B[i + j * LDB]
-                          << ") failed: " << std::abs(A[i + j * LDA] - B[i + j * LDB])
-                          << " exceeds permissive range [" << compare_val << ","
-                          << compare_val * MAX_TOL_MULTIPLIER << " ]" << std::endl;
-                exit(EXIT_FAILURE);
+                diagnostic.max_rel       = local.max_rel;
+                diagnostic.max_rel_index = local.max_rel_index;
             }
-            tolm = std::max(tolm, k);
-#endif
+            for(int b = 0; b < 8; ++b)
+            {
+                diagnostic.histogram[b] += local.histogram[b];
+            }
+            diagnostic.mismatches.insert(
+                diagnostic.mismatches.end(), local.mismatches.begin(), local.mismatches.end());
         }
     }
 
-    if(tolm > 1)
+    std::sort(diagnostic.mismatches.begin(), diagnostic.mismatches.end());
+    diagnostic.mismatches.erase(
+        std::unique(diagnostic.mismatches.begin(), diagnostic.mismatches.end()),
+        diagnostic.mismatches.end());
+    if(diagnostic.mismatches.size() > rocsparse_check_max_mismatches)
     {
-        std::cerr << "WARNING near_check has been permissive with a tolerance multiplier equal to "
-                  << tolm << std::endl;
+        diagnostic.mismatches.resize(rocsparse_check_max_mismatches);
     }
 }
 
-template <>
-void near_check_general_template(int64_t                         M,
-                                 int64_t                         N,
-                                 const rocsparse_double_complex* A,
-                                 int64_t                         LDA,
-                                 const rocsparse_double_complex* B,
-                                 int64_t                         LDB,
-                                 double                          tol)
+static void rocsparse_check_fail(const std::string& message)
 {
-    int tolm = 1;
-    for(int64_t j = 0; j < N; ++j)
-    {
-        for(int64_t i = 0; i < M; ++i)
-        {
-            rocsparse_double_complex compare_val
-                = rocsparse_double_complex(std::max(std::abs(std::real(A[i + j * LDA]) * tol),
-                                                    10 * std::numeric_limits<double>::epsilon()),
-                                           std::max(std::abs(std::imag(A[i + j * LDA]) * tol),
-                                                    10 * std::numeric_limits<double>::epsilon()));
 #ifdef GOOGLE_TEST
-            if(rocsparse_isnan(A[i + j * LDA]))
-            {
-                ASSERT_TRUE(rocsparse_isnan(B[i + j * LDB]));
-            }
-            else if(rocsparse_isinf(A[i + j * LDA]))
-            {
-                ASSERT_TRUE(rocsparse_isinf(B[i + j * LDB]));
-            }
-            else
-            {
-                int k;
-                for(k = 1; k <= MAX_TOL_MULTIPLIER; ++k)
-                {
-                    if(std::abs(std::real(A[i + j * LDA]) - std::real(B[i + j * LDB]))
-                           <= std::real(compare_val) * k
-                       && std::abs(std::imag(A[i + j * LDA]) - std::imag(B[i + j * LDB]))
-                              <= std::imag(compare_val) * k)
-                    {
-                        break;
-                    }
-                }
-
-                if(k > MAX_TOL_MULTIPLIER)
-                {
-                    ASSERT_NEAR(std::real(A[i + j * LDA]),
-                                std::real(B[i + j * LDB]),
-                                std::real(compare_val));
-                    ASSERT_NEAR(std::imag(A[i + j * LDA]),
-                                std::imag(B[i + j * LDB]),
-                                std::imag(compare_val));
-                }
-                tolm = std::max(tolm, k);
-            }
+    FAIL() << message;
 #else
+    std::cerr << message << std::endl;
+    exit(EXIT_FAILURE);
+#endif
+}
 
-            int k;
-            for(k = 1; k <= MAX_TOL_MULTIPLIER; ++k)
-            {
-                if(std::abs(std::real(A[i + j * LDA]) - std::real(B[i + j * LDB]))
-                       <= std::real(compare_val) * k
-                   && std::abs(std::imag(A[i + j * LDA]) - std::imag(B[i + j * LDB]))
-                          <= std::imag(compare_val) * k)
-                {
-                    break;
-                }
-            }
+//
+// Compare the m x n arrays A and B, the check fails with a single assertion
+// describing the mismatches if an entry of B has a score above limit.
+// Return the largest score of the entries.
+//
+template <typename T, typename F>
+static double rocsparse_check_arrays(const char*        name,
+                                     const std::string& criterion,
+                                     int64_t            M,
+                                     int64_t            N,
+                                     const T*           A,
+                                     int64_t            LDA,
+                                     const T*           B,
+                                     int64_t            LDB,
+                                     double             limit,
+                                     F                  score)
+{
+    using R        = typename rocsparse_check_traits<T>::real_t;
+    int64_t nfails = 0;
+    double  worst  = 0;
 
-            if(k > MAX_TOL_MULTIPLIER)
-            {
-                std::cerr.precision(16);
-                std::cerr << "ASSERT_NEAR(" << A[i + j * LDA] << ", " << B[i + j * LDB]
-                          << ") failed: " << std::abs(A[i + j * LDA] - B[i + j * LDB])
-                          << " exceeds permissive range [" << compare_val << ","
-                          << compare_val * MAX_TOL_MULTIPLIER << " ]" << std::endl;
-                exit(EXIT_FAILURE);
-            }
-            tolm = std::max(tolm, k);
-#endif
+    if(M <= 0 || N <= 0)
+    {
+        return worst;
+    }
+
+    rocsparse_check_reduce(M, N, A, LDA, B, LDB, limit, score, nfails, worst);
+    if(nfails == 0)
+    {
+        return worst;
+    }
+
+    rocsparse_check_diagnostic diagnostic;
+    rocsparse_check_diagnose(M, N, A, LDA, B, LDB, limit, score, diagnostic);
+
+    std::ostringstream message;
+    message.precision(std::numeric_limits<R>::max_digits10);
+    message << name << " failed: " << diagnostic.nfails << " of " << M * N << " entries of the "
+            << M << " x " << N << " arrays " << criterion << std::endl;
+
+    const auto location = [M](int64_t index) {
+        std::ostringstream out;
+        out << "(" << index % M << ", " << index / M << ")";
+        return out.str();
+    };
+
+    message << "  max absolute error " << diagnostic.max_abs;
+    if(diagnostic.max_abs_index >= 0)
+    {
+        message << " at " << location(diagnostic.max_abs_index);
+    }
+    message << ", max relative error " << diagnostic.max_rel;
+    if(diagnostic.max_rel_index >= 0)
+    {
+        message << " at " << location(diagnostic.max_rel_index);
+    }
+    message << std::endl;
+
+    if(std::is_floating_point<R>::value)
+    {
+        static const char* bins[8]
+            = {"0", "1", "2-4", "5-16", "17-256", "257-65536", ">65536", "nan/inf"};
+        message << "  ULP distances:";
+        for(int bin = 0; bin < 8; ++bin)
+        {
+            message << ((bin > 0) ? ", " : " ") << bins[bin] << ": " << diagnostic.histogram[bin];
         }
+        message << std::endl;
     }
 
-    if(tolm > 1)
+    message << "  first mismatches:" << std::endl;
+    for(const int64_t index : diagnostic.mismatches)
     {
-        std::cerr << "WARNING near_check has been permissive with a tolerance multiplier equal to "
-                  << tolm << std::endl;
+        const int64_t i = index % M;
+        const int64_t j = index / M;
+        message << "    " << location(index) << ": " << A[i + j * LDA] << " vs " << B[i + j * LDB]
+                << std::endl;
     }
+
+    rocsparse_check_fail(message.str());
+    return worst;
+}
+
+template <typename T>
+void unit_check_general(int64_t M, int64_t N, const T* A, int64_t LDA, const T* B, int64_t LDB)
+{
+    using R = typename rocsparse_check_traits<T>::real_t;
+
+    const double limit = std::is_floating_point<R>::value ? rocsparse_check_max_ulps : 0;
+
+    std::ostringstream criterion;
+    if(limit > 0)
+    {
+        criterion << "differ by more than " << limit << " ULPs";
+    }
+    else
+    {
+        criterion << "differ";
+    }
+
+    rocsparse_check_arrays("unit_check",
+                           criterion.str(),
+                           M,
+                           N,
+                           A,
+                           LDA,
+                           B,
+                           LDB,
+                           limit,
+                           [](const T& a, const T& b) {
+                               return rocsparse_check_unit_entry_score(a, b);
+                           });
+}
+
+#define INSTANTIATE(TYPE)                                                                   \
+    template void unit_check_general(                                                       \
+        int64_t M, int64_t N, const TYPE* A, int64_t LDA, const TYPE* B, int64_t LDB)
+
+INSTANTIATE(int8_t);
+INSTANTIATE(int32_t);
+INSTANTIATE(int64_t);
+INSTANTIATE(size_t);
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+
+#undef INSTANTIATE
+
+template <>
+void unit_check_enum(const rocsparse_index_base a, const rocsparse_index_base b)
+{
+    ASSERT_TRUE(a == b);
+}
+
+template <>
+void unit_check_enum(const rocsparse_order a, const rocsparse_order b)
+{
+    ASSERT_TRUE(a == b);
+}
+
+template <>
+void unit_check_enum(const rocsparse_direction a, const rocsparse_direction b)
+{
+    ASSERT_TRUE(a == b);
+}
+
+template <>
+void unit_check_enum(const rocsparse_datatype a, const rocsparse_datatype b)
+{
+    ASSERT_TRUE(a == b);
+}
+
+template <>
+void unit_check_enum(const rocsparse_indextype a, const rocsparse_indextype b)
+{
+    ASSERT_TRUE(a == b);
 }
 
 template <typename T>
 void near_check_general(
     int64_t M, int64_t N, const T* A, int64_t LDA, const T* B, int64_t LDB, floating_data_t<T> tol)
 {
-    near_check_general_template(M, N, A, LDA, B, LDB, tol);
+    using R = typename rocsparse_check_traits<T>::real_t;
+
+    //
+    // The tolerance is relaxed up to MAX_TOL_MULTIPLIER times, with a warning.
+    //
+    std::ostringstream criterion;
+    criterion << "exceed " << MAX_TOL_MULTIPLIER << " times the tolerance " << tol;
+
+    const double worst = rocsparse_check_arrays(
+        "near_check",
+        criterion.str(),
+        M,
+        N,
+        A,
+        LDA,
+        B,
+        LDB,
+        MAX_TOL_MULTIPLIER,
+        [tol](const T& a, const T& b) {
+            return rocsparse_check_near_entry_score(a, b, static_cast<R>(tol));
+        });
+
+    const int tolm = std::max(1, static_cast<int>(std::ceil(worst)));
+    if(tolm > 1)
+    {
+        std::cerr << "WARNING near_check has been permissive with a tolerance multiplier equal to "
+                  << tolm << std::endl;
+    }
 }
 
 #define INSTANTIATE(TYPE)                                       \
@@ -0,0 +1,331 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_chunked.hpp"
+#include "rocsparse_clients_envariables.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef WIN32
+#include <io.h>
+#include <mutex>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef ROCSPARSE_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+rocsparse_status rocsparse_chunked_get_codec(rocsparse_chunked_codec* codec, int* level)
+{
+#ifdef ROCSPARSE_WITH_ZSTD
+    codec[0] = rocsparse_chunked_codec_zstd;
+    level[0] = 3;
+#else
+    codec[0] = rocsparse_chunked_codec_none;
+    level[0] = 0;
+#endif
+
+    if(!rocsparse_clients_envariables::is_defined(rocsparse_clients_envariables::CHUNKED_CODEC))
+    {
+        return rocsparse_status_success;
+    }
+
+    const char* env
+        = rocsparse_clients_envariables::get(rocsparse_clients_envariables::CHUNKED_CODEC);
+    if(!strcmp(env, "none"))
+    {
+        codec[0] = rocsparse_chunked_codec_none;
+        level[0] = 0;
+        return rocsparse_status_success;
+    }
+
+    if(!strncmp(env, "zstd", 4) && (env[4] == '\0' || env[4] == ':'))
+    {
+#ifdef ROCSPARSE_WITH_ZSTD
+        codec[0] = rocsparse_chunked_codec_zstd;
+        level[0] = (env[4] == ':') ? atoi(env + 5) : 3;
+        return rocsparse_status_success;
+#else
+        std::cerr << "rocsparse_chunked_get_codec: zstd is not available" << std::endl;
+        return rocsparse_status_not_implemented;
+#endif
+    }
+
+    std::cerr << "rocsparse_chunked_get_codec: invalid codec '" << env << "'" << std::endl;
+    return rocsparse_status_invalid_value;
+}
+
+rocsparse_status rocsparse_chunked_compress(rocsparse_chunked_codec  codec,
+                                            int                      level,
+                                            const std::vector<char>& raw,
+                                            std::vector<char>&       out,
+                                            rocsparse_chunked_codec* used)
+{
+    used[0] = rocsparse_chunked_codec_none;
+    switch(codec)
+    {
+    case rocsparse_chunked_codec_none:
+    {
+        return rocsparse_status_success;
+    }
+    case rocsparse_chunked_codec_zstd:
+    {
+#ifdef ROCSPARSE_WITH_ZSTD
+        out.resize(ZSTD_compressBound(raw.size()));
+        const size_t size = ZSTD_compress(out.data(), out.size(), raw.data(), raw.size(), level);
+        if(ZSTD_isError(size))
+        {
+            std::cerr << "rocsparse_chunked_compress: " << ZSTD_getErrorName(size) << std::endl;
+            return rocsparse_status_internal_error;
+        }
+
+        //
+        // Keep the chunk raw if compression does not pay off.
+        //
+        if(size < raw.size())
+        {
+            out.resize(size);
+            used[0] = rocsparse_chunked_codec_zstd;
+        }
+        return rocsparse_status_success;
+#else
+        return rocsparse_status_not_implemented;
+#endif
+    }
+    }
+    return rocsparse_status_invalid_value;
+}
+
+int rocsparse_chunked_open(const char* filename)
+{
+#ifdef WIN32
+    return _open(filename, _O_RDONLY | _O_BINARY);
+#else
+    return open(filename, O_RDONLY);
+#endif
+}
+
+void rocsparse_chunked_close(int fd)
+{
+#ifdef WIN32
+    _close(fd);
+#else
+    close(fd);
+#endif
+}
+
+//
+// Positioned read, the file offset is shared between threads on Windows and
+// reads are serialized.
+//
+static rocsparse_status rocsparse_chunked_pread(int fd, void* data, size_t size, uint64_t offset)
+{
+    char* p = static_cast<char*>(data);
+    while(size > 0)
+    {
+#ifdef WIN32
+        static std::mutex           mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+        int64_t                     count = -1;
+        if(_lseeki64(fd, offset, SEEK_SET) >= 0)
+        {
+            count = _read(fd, p, static_cast<unsigned int>(std::min(size, size_t(1) << 30)));
+        }
+#else
+        const ssize_t count = pread(fd, p, size, static_cast<off_t>(offset));
+#endif
+        if(count <= 0)
+        {
+            return rocsparse_status_internal_error;
+        }
+        p += count;
+        size -= count;
+        offset += count;
+    }
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_chunked_read_chunk(int                            fd,
+                                              const rocsparse_chunked_entry& entry,
+                                              std::vector<char>&             buffer,
+                                              std::vector<char>&             raw)
+{
+    switch(entry.codec)
+    {
+    case rocsparse_chunked_codec_none:
+    {
+        if(entry.size != entry.raw_size)
+        {
+            return rocsparse_status_internal_error;
+        }
+        raw.resize(entry.raw_size);
+        return rocsparse_chunked_pread(fd, raw.data(), entry.size, entry.offset);
+    }
+    case rocsparse_chunked_codec_zstd:
+    {
+#ifdef ROCSPARSE_WITH_ZSTD
+        buffer.resize(entry.size);
+        rocsparse_status status
+            = rocsparse_chunked_pread(fd, buffer.data(), entry.size, entry.offset);
+        if(status != rocsparse_status_success)
+        {
+            return status;
+        }
+
+        raw.resize(entry.raw_size);
+        const size_t size = ZSTD_decompress(raw.data(), raw.size(), buffer.data(), buffer.size());
+        if(ZSTD_isError(size) || size != entry.raw_size)
+        {
+            return rocsparse_status_internal_error;
+        }
+        return rocsparse_status_success;
+#else
+        std::cerr << "rocsparse_chunked_read_chunk: zstd is not available" << std::endl;
+        return rocsparse_status_not_implemented;
+#endif
+    }
+    }
+    return rocsparse_status_internal_error;
+}
+
+rocsparse_status rocsparse_chunked_write_header(FILE* file, const rocsparse_chunked_header& header)
+{
+    if(1 != fwrite(&header, sizeof(header), 1, file))
+    {
+        return rocsparse_status_internal_error;
+    }
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_chunked_write_index(FILE*                                       file,
+                                               uint64_t                                    offset,
+                                               const std::vector<rocsparse_chunked_entry>& index)
+{
+    rocsparse_chunked_footer footer;
+    footer.index_offset = offset;
+    footer.nchunks      = index.size();
+
+    if(index.size() != fwrite(index.data(), sizeof(rocsparse_chunked_entry), index.size(), file))
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    if(1 != fwrite(&footer, sizeof(footer), 1, file))
+    {
+        return rocsparse_status_internal_error;
+    }
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_chunked_read_index(int                                   fd,
+                                              rocsparse_chunked_header&             header,
+                                              std::vector<rocsparse_chunked_entry>& index)
+{
+    rocsparse_status status;
+
+#ifdef WIN32
+    struct _stat64 st;
+    if(_fstat64(fd, &st) != 0)
+#else
+    struct stat st;
+    if(fstat(fd, &st) != 0)
+#endif
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    const uint64_t file_size = st.st_size;
+    if(file_size < sizeof(rocsparse_chunked_header) + sizeof(rocsparse_chunked_footer))
+    {
+        std::cerr << "rocsparse_chunked_read_index: file is too small" << std::endl;
+        return rocsparse_status_invalid_size;
+    }
+
+    //
+    // Header.
+    //
+    const rocsparse_chunked_header ref_header;
+    status = rocsparse_chunked_pread(fd, &header, sizeof(header), 0);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    if(memcmp(header.magic, ref_header.magic, sizeof(header.magic))
+       || header.version != ref_header.version)
+    {
+        std::cerr << "rocsparse_chunked_read_index: invalid header" << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    //
+    // Footer.
+    //
+    const rocsparse_chunked_footer ref_footer;
+    rocsparse_chunked_footer       footer;
+    status = rocsparse_chunked_pread(fd, &footer, sizeof(footer), file_size - sizeof(footer));
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    if(memcmp(footer.magic, ref_footer.magic, sizeof(footer.magic))
+       || footer.index_offset + footer.nchunks * sizeof(rocsparse_chunked_entry) + sizeof(footer)
+              != file_size)
+    {
+        std::cerr << "rocsparse_chunked_read_index: invalid footer" << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    //
+    // Index.
+    //
+    index.resize(footer.nchunks);
+    status = rocsparse_chunked_pread(
+        fd, index.data(), footer.nchunks * sizeof(rocsparse_chunked_entry), footer.index_offset);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    for(const auto& entry : index)
+    {
+        if(entry.row_begin > entry.row_end || entry.nnz_begin > entry.nnz_end
+           || entry.offset + entry.size > footer.index_offset)
+        {
+            std::cerr << "rocsparse_chunked_read_index: invalid index" << std::endl;
+            return rocsparse_status_invalid_value;
+        }
+    }
+    return rocsparse_status_success;
+}
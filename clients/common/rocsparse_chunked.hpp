@@ -0,0 +1,208 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CHUNKED_HPP
+#define ROCSPARSE_CHUNKED_HPP
+
+#include "rocsparse.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//
+// Chunked container of sparse matrices (.cbin), the chunked and compressed
+// variant of the rocsparseio binary format. A file is laid out as
+//
+//   header | chunk 0 | ... | chunk nchunks - 1 | index | footer
+//
+// A chunk holds a range of rows (or columns) of a CSX or GEBSX matrix, or a
+// range of entries of a COO matrix. It stores the raw values followed by the
+// delta encoded indices as variable length integers, and is optionally
+// compressed. The index gives the row range, the entry range and the location
+// of every chunk, such that chunks can be decoded concurrently or selectively.
+//
+
+//
+// Number of entries (or blocks) of a chunk, and maximum number of rows.
+//
+static constexpr int64_t rocsparse_chunked_chunk_size = 1 << 18;
+
+typedef enum rocsparse_chunked_format_ : uint32_t
+{
+    rocsparse_chunked_format_csx   = 0,
+    rocsparse_chunked_format_gebsx = 1,
+    rocsparse_chunked_format_coo   = 2
+} rocsparse_chunked_format;
+
+typedef enum rocsparse_chunked_codec_ : uint32_t
+{
+    rocsparse_chunked_codec_none = 0,
+    rocsparse_chunked_codec_zstd = 1
+} rocsparse_chunked_codec;
+
+struct rocsparse_chunked_header
+{
+    char     magic[8]{'R', 'O', 'C', 'S', 'P', 'C', 'H', 'K'};
+    uint32_t version{1};
+    uint32_t format{};
+    uint32_t dir{};
+    uint32_t dirb{};
+    uint32_t base{};
+    uint32_t ptr_type{};
+    uint32_t ind_type{};
+    uint32_t val_type{};
+
+    //
+    // Dimensions and number of entries, in blocks for GEBSX.
+    //
+    uint64_t m{};
+    uint64_t n{};
+    uint64_t nnz{};
+    uint64_t row_block_dim{1};
+    uint64_t col_block_dim{1};
+};
+
+struct rocsparse_chunked_entry
+{
+    //
+    // Range of rows (or columns), equal to the range of entries for COO.
+    //
+    uint64_t row_begin{};
+    uint64_t row_end{};
+
+    //
+    // Range of entries (or blocks).
+    //
+    uint64_t nnz_begin{};
+    uint64_t nnz_end{};
+
+    //
+    // Location in the file, size before compression and codec.
+    //
+    uint64_t offset{};
+    uint64_t size{};
+    uint64_t raw_size{};
+    uint32_t codec{};
+    uint32_t reserved{};
+};
+
+struct rocsparse_chunked_footer
+{
+    uint64_t index_offset{};
+    uint64_t nchunks{};
+    char     magic[8]{'R', 'O', 'C', 'S', 'P', 'I', 'D', 'X'};
+};
+
+//
+// Codec used to write chunks, from ROCSPARSE_CLIENTS_CHUNKED_CODEC
+// (none or zstd[:level], default zstd:3 when available).
+//
+rocsparse_status rocsparse_chunked_get_codec(rocsparse_chunked_codec* codec, int* level);
+
+//
+// Compress a chunk, the chunk is stored raw if it does not shrink.
+//
+rocsparse_status rocsparse_chunked_compress(rocsparse_chunked_codec  codec,
+                                            int                      level,
+                                            const std::vector<char>& raw,
+                                            std::vector<char>&       out,
+                                            rocsparse_chunked_codec* used);
+
+//
+// Open a chunked file for reading, return a negative value on failure.
+//
+int  rocsparse_chunked_open(const char* filename);
+void rocsparse_chunked_close(int fd);
+
+//
+// Read and decompress a chunk, safe to call concurrently.
+//
+rocsparse_status rocsparse_chunked_read_chunk(int                            fd,
+                                              const rocsparse_chunked_entry& entry,
+                                              std::vector<char>&             buffer,
+                                              std::vector<char>&             raw);
+
+//
+// Write the header, or the index and the footer.
+//
+rocsparse_status rocsparse_chunked_write_header(FILE* file, const rocsparse_chunked_header& header);
+rocsparse_status rocsparse_chunked_write_index(FILE*                                       file,
+                                               uint64_t                                    offset,
+                                               const std::vector<rocsparse_chunked_entry>& index);
+
+//
+// Read the header and the index.
+//
+rocsparse_status rocsparse_chunked_read_index(int                                   fd,
+                                              rocsparse_chunked_header&             header,
+                                              std::vector<rocsparse_chunked_entry>& index);
+
+//
+// Variable length encoding of unsigned integers, 7 bits per byte.
+//
+inline void rocsparse_chunked_put_varint(std::vector<char>& out, uint64_t x)
+{
+    while(x >= 0x80)
+    {
+        out.push_back(static_cast<char>((x & 0x7F) | 0x80));
+        x >>= 7;
+    }
+    out.push_back(static_cast<char>(x));
+}
+
+inline const char* rocsparse_chunked_get_varint(const char* p, const char* end, uint64_t& x)
+{
+    x         = 0;
+    int shift = 0;
+    while(p < end && shift < 64)
+    {
+        const uint8_t b = static_cast<uint8_t>(*p++);
+        x |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if((b & 0x80) == 0)
+        {
+            return p;
+        }
+        shift += 7;
+    }
+    return nullptr;
+}
+
+//
+// Zigzag encoding of signed deltas.
+//
+inline uint64_t rocsparse_chunked_zigzag(int64_t x)
+{
+    return (static_cast<uint64_t>(x) << 1) ^ static_cast<uint64_t>(x >> 63);
+}
+
+inline int64_t rocsparse_chunked_unzigzag(uint64_t x)
+{
+    return static_cast<int64_t>(x >> 1) ^ -static_cast<int64_t>(x & 1);
+}
+
+#endif // HEADER
@@ -41,10 +41,21 @@ static constexpr size_t s_var_string_size
 
 static constexpr const char* s_var_bool_names[s_var_bool_size] = {"ROCSPARSE_CLIENTS_VERBOSE"};
 static constexpr const char* s_var_string_names[s_var_string_size]
-    = {"ROCSPARSE_CLIENTS_MATRICES_DIR"};
+    = {"ROCSPARSE_CLIENTS_MATRICES_DIR",
+       "ROCSPARSE_CLIENTS_ROOFLINE_CACHE",
+       "ROCSPARSE_CLIENTS_MATRIX_CACHE_SIZE",
+       "ROCSPARSE_CLIENTS_CHUNKED_CODEC",
+       "ROCSPARSE_CLIENTS_HOST_MEMORY"};
 static constexpr const char* s_var_bool_descriptions[s_var_bool_size] = {"0: disabled, 1: enabled"};
 static constexpr const char* s_var_string_descriptions[s_var_string_size]
-    = {"Full path of the matrices directory"};
+    = {"Full path of the matrices directory",
+       "Full path of the roofline peaks cache file (default = $HOME/.rocsparse_bench_roofline)",
+       "Size in megabytes of the cache of host matrices of the matrix factory (default = 1024 "
+       "for rocsparse-test, 0 otherwise, 0: disabled)",
+       "Codec of the chunks of exported .cbin files, none or zstd[:level] (default = zstd:3 if "
+       "available, none otherwise)",
+       "Storage of large host arrays, default, hugepages[:transparent] or mmap[:directory] "
+       "(default = default)"};
 
 ///
 /// @brief Grab an environment variable value.
@@ -172,6 +183,10 @@ private:
             switch(tag)
             {
             case rocsparse_clients_envariables::MATRICES_DIR:
+            case rocsparse_clients_envariables::ROOFLINE_CACHE:
+            case rocsparse_clients_envariables::MATRIX_CACHE_SIZE:
+            case rocsparse_clients_envariables::CHUNKED_CODEC:
+            case rocsparse_clients_envariables::HOST_MEMORY:
             {
                 const bool success = rocsparse_getenv(s_var_string_names[tag],
                                                       this->m_var_string_defined[tag],
@@ -211,6 +226,10 @@ private:
                 switch(tag)
                 {
                 case rocsparse_clients_envariables::MATRICES_DIR:
+                case rocsparse_clients_envariables::ROOFLINE_CACHE:
+                case rocsparse_clients_envariables::MATRIX_CACHE_SIZE:
+                case rocsparse_clients_envariables::CHUNKED_CODEC:
+                case rocsparse_clients_envariables::HOST_MEMORY:
                 {
                     const std::string v = this->m_var_string[tag];
                     std::cout << ""
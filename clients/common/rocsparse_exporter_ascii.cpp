@@ -23,6 +23,8 @@
  * ************************************************************************ */
 
 #include "rocsparse_exporter_ascii.hpp"
+#include "rocsparse_exporter_text.hpp"
+
 template <typename X, typename Y>
 rocsparse_status rocsparse_type_conversion(const X& x, Y& y);
 
@@ -46,8 +48,37 @@ rocsparse_exporter_ascii::rocsparse_exporter_ascii(const std::string& filename_)
     }
 }
 
-template <typename T>
-void convert_array(int nnz, const void* data, void* mem);
+//
+// Values are written as with std::ostream, complex numbers as (x,y).
+//
+static void rocsparse_exporter_ascii_append(std::string& s, float x)
+{
+    rocsparse_exporter_text_append_real(s, x);
+}
+
+static void rocsparse_exporter_ascii_append(std::string& s, double x)
+{
+    rocsparse_exporter_text_append_real(s, x);
+}
+
+static void rocsparse_exporter_ascii_append(std::string& s, const rocsparse_float_complex& x)
+{
+    s.push_back('(');
+    rocsparse_exporter_text_append_real(s, std::real(x));
+    s.push_back(',');
+    rocsparse_exporter_text_append_real(s, std::imag(x));
+    s.push_back(')');
+}
+
+static void rocsparse_exporter_ascii_append(std::string& s, const rocsparse_double_complex& x)
+{
+    s.push_back('(');
+    rocsparse_exporter_text_append_real(s, std::real(x));
+    s.push_back(',');
+    rocsparse_exporter_text_append_real(s, std::imag(x));
+    s.push_back(')');
+}
+
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_exporter_ascii::write_sparse_csx(rocsparse_direction dir_,
                                                             J                   m_,
@@ -58,45 +89,70 @@ rocsparse_status rocsparse_exporter_ascii::write_sparse_csx(rocsparse_direction
                                                             const T* __restrict__ val_,
                                                             rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
-    {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return status;
     }
+
+    std::ostringstream header;
     if(dir_ == rocsparse_direction_row)
     {
-        out << "matrix: sparse_csr" << std::endl;
+        header << "matrix: sparse_csr" << std::endl;
     }
     else
     {
-        out << "matrix: sparse_csc" << std::endl;
+        header << "matrix: sparse_csc" << std::endl;
     }
 
-    out << "dir: " << dir_ << std::endl;
-    out << "m: " << m_ << std::endl;
-    out << "n: " << n_ << std::endl;
-    out << "nnz: " << nnz_ << std::endl;
-    out << "base: " << base_ << std::endl;
-    const char* dir  = (dir_ == rocsparse_direction_row) ? "row" : "col";
-    const char* odir = (dir_ == rocsparse_direction_row) ? "col" : "row";
-    J           L    = (dir_ == rocsparse_direction_row) ? m_ : n_;
-    for(J i = 0; i < L; ++i)
+    header << "dir: " << dir_ << std::endl;
+    header << "m: " << m_ << std::endl;
+    header << "n: " << n_ << std::endl;
+    header << "nnz: " << nnz_ << std::endl;
+    header << "base: " << base_ << std::endl;
+    status = out.write(header.str());
+    if(status != rocsparse_status_success)
     {
-        out << dir << ": " << i << std::endl;
-        for(int k = ptr_[i]; k < ptr_[i + 1]; ++k)
+        return status;
+    }
+
+    //
+    // Chunks are ranges of rows (or columns) holding about
+    // rocsparse_exporter_text_chunk_size entries on average.
+    //
+    const char*   dir  = (dir_ == rocsparse_direction_row) ? "row: " : "col: ";
+    const char*   odir = (dir_ == rocsparse_direction_row) ? " col = " : " row = ";
+    const int64_t L    = (dir_ == rocsparse_direction_row) ? m_ : n_;
+    const int64_t size
+        = std::max(int64_t(1),
+                   rocsparse_exporter_text_chunk_size * L / std::max(int64_t(nnz_), int64_t(1)));
+    const int64_t nchunks = (L + size - 1) / size;
+
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const int64_t end = std::min(chunk * size + size, L);
+        for(int64_t i = chunk * size; i < end; ++i)
         {
-            out << " " << odir << " = " << (ind_[k - base_] - base_) << ", val =  " << val_[k]
-                << std::endl;
+            buffer += dir;
+            rocsparse_exporter_text_append_integer(buffer, i);
+            buffer.push_back('\n');
+            for(I k = ptr_[i] - base_; k < ptr_[i + 1] - base_; ++k)
+            {
+                buffer += odir;
+                rocsparse_exporter_text_append_integer(buffer, ind_[k] - base_);
+                buffer += ", val =  ";
+                rocsparse_exporter_ascii_append(buffer, val_[k]);
+                buffer.push_back('\n');
+            }
         }
+    };
+
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
+    {
+        return status;
     }
-    out.close();
-    return rocsparse_status_success;
+    return out.close();
 }
 
 template <typename T, typename I, typename J>
@@ -112,103 +168,130 @@ rocsparse_status rocsparse_exporter_ascii::write_sparse_gebsx(rocsparse_directio
                                                               const T* __restrict__ val_,
                                                               rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return status;
     }
+
+    std::ostringstream header;
     if(dir_ == rocsparse_direction_row)
     {
-        out << "matrix: sparse_gebsr" << std::endl;
+        header << "matrix: sparse_gebsr" << std::endl;
     }
     else
     {
-        out << "matrix: sparse_gebsc" << std::endl;
+        header << "matrix: sparse_gebsc" << std::endl;
     }
 
-    out << "dir: " << dir_ << std::endl;
-    out << "dirb: " << dirb_ << std::endl;
-    out << "mb: " << mb_ << std::endl;
-    out << "nb: " << nb_ << std::endl;
-    out << "nnzb: " << nnzb_ << std::endl;
-    out << "bm: " << bm_ << std::endl;
-    out << "bn: " << bn_ << std::endl;
-    out << "base: " << base_ << std::endl;
-    out.close();
-    return rocsparse_status_success;
+    header << "dir: " << dir_ << std::endl;
+    header << "dirb: " << dirb_ << std::endl;
+    header << "mb: " << mb_ << std::endl;
+    header << "nb: " << nb_ << std::endl;
+    header << "nnzb: " << nnzb_ << std::endl;
+    header << "bm: " << bm_ << std::endl;
+    header << "bn: " << bn_ << std::endl;
+    header << "base: " << base_ << std::endl;
+    status = out.write(header.str());
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+    return out.close();
 }
 
 template <typename T, typename I>
 rocsparse_status
     rocsparse_exporter_ascii::write_dense_vector(I nmemb_, const T* __restrict__ x_, I incx_)
 {
-    std::ofstream out(this->m_filename);
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
+        return status;
     }
-    else
+
+    std::ostringstream header;
+    header << "matrix: dense_vector" << std::endl;
+    header << "m: " << nmemb_ << std::endl;
+    header << "data: " << std::endl;
+    status = out.write(header.str());
+    if(status != rocsparse_status_success)
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return status;
     }
 
-    out << "matrix: dense_vector" << std::endl;
-    out << "m: " << nmemb_ << std::endl;
-    out << "data: " << std::endl;
-    for(I i = 0; i < nmemb_; ++i)
+    const int64_t size    = rocsparse_exporter_text_chunk_size;
+    const int64_t nchunks = (static_cast<int64_t>(nmemb_) + size - 1) / size;
+
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const int64_t end = std::min(chunk * size + size, int64_t(nmemb_));
+        for(int64_t i = chunk * size; i < end; ++i)
+        {
+            rocsparse_exporter_ascii_append(buffer, x_[incx_ * i]);
+            buffer.push_back('\n');
+        }
+    };
+
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
     {
-        out << x_[incx_ * i] << std::endl;
+        return status;
     }
-    out.close();
-    return rocsparse_status_success;
+    return out.close();
 }
 
 template <typename T, typename I>
 rocsparse_status rocsparse_exporter_ascii::write_dense_matrix(
     rocsparse_order order_, I m_, I n_, const T* __restrict__ x_, I ld_)
 {
-    std::ofstream out(this->m_filename);
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
+        return status;
     }
-    else
+
+    std::ostringstream header;
+    header << "matrix: dense_matrix" << std::endl;
+    header << "order: " << order_ << std::endl;
+    header << "m: " << m_ << std::endl;
+    header << "n: " << n_ << std::endl;
+    header << "data: " << std::endl;
+    status = out.write(header.str());
+    if(status != rocsparse_status_success)
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return status;
     }
 
-    out << "matrix: dense_matrix" << std::endl;
-    out << "order: " << order_ << std::endl;
-    out << "m: " << m_ << std::endl;
-    out << "n: " << n_ << std::endl;
-    out << "data: " << std::endl;
-    for(I i = 0; i < m_; ++i)
-    {
-        for(I j = 0; j < n_; ++j)
+    //
+    // Chunks are ranges of rows.
+    //
+    const int64_t ncols   = std::max(int64_t(n_), int64_t(1));
+    const int64_t size    = std::max(int64_t(1), rocsparse_exporter_text_chunk_size / ncols);
+    const int64_t nchunks = (static_cast<int64_t>(m_) + size - 1) / size;
+
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const int64_t end = std::min(chunk * size + size, int64_t(m_));
+        for(int64_t i = chunk * size; i < end; ++i)
         {
-            if(order_ == rocsparse_order_row)
-            {
-                out << " " << x_[ld_ * j + i];
-            }
-            else
+            for(int64_t j = 0; j < n_; ++j)
             {
-                out << " " << x_[ld_ * i + j];
+                buffer.push_back(' ');
+                rocsparse_exporter_ascii_append(
+                    buffer, (order_ == rocsparse_order_row) ? x_[ld_ * i + j] : x_[ld_ * j + i]);
             }
+            buffer.push_back('\n');
         }
-        out << std::endl;
+    };
+
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
+    {
+        return status;
     }
-    out.close();
-    return rocsparse_status_success;
+    return out.close();
 }
 
 template <typename T, typename I>
@@ -220,7 +303,48 @@ rocsparse_status rocsparse_exporter_ascii::write_sparse_coo(I m_,
                                                             const T* __restrict__ val_,
                                                             rocsparse_index_base base_)
 {
-    return rocsparse_status_not_implemented;
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    std::ostringstream header;
+    header << "matrix: sparse_coo" << std::endl;
+    header << "m: " << m_ << std::endl;
+    header << "n: " << n_ << std::endl;
+    header << "nnz: " << nnz_ << std::endl;
+    header << "base: " << base_ << std::endl;
+    status = out.write(header.str());
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    const int64_t size    = rocsparse_exporter_text_chunk_size;
+    const int64_t nchunks = (static_cast<int64_t>(nnz_) + size - 1) / size;
+
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const int64_t end = std::min(chunk * size + size, int64_t(nnz_));
+        for(int64_t k = chunk * size; k < end; ++k)
+        {
+            buffer += " row = ";
+            rocsparse_exporter_text_append_integer(buffer, row_ind_[k] - base_);
+            buffer += ", col = ";
+            rocsparse_exporter_text_append_integer(buffer, col_ind_[k] - base_);
+            buffer += ", val =  ";
+            rocsparse_exporter_ascii_append(buffer, val_[k]);
+            buffer.push_back('\n');
+        }
+    };
+
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+    return out.close();
 }
 
 #define INSTANTIATE_TIJ(T, I, J)                                                                  \
@@ -0,0 +1,442 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_exporter_chunked.hpp"
+#include "rocsparse_chunked.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+rocsparse_exporter_chunked::~rocsparse_exporter_chunked()
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        std::cout << "Export done." << std::endl;
+    }
+}
+
+rocsparse_exporter_chunked::rocsparse_exporter_chunked(const std::string& filename_)
+    : m_filename(filename_)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        std::cout << "Opening file '" << this->m_filename << "' ... " << std::endl;
+    }
+}
+
+//
+// Encode batches of chunks in parallel and write them in order, the offsets,
+// sizes and codecs of the chunks are recorded in the index.
+//
+template <typename F>
+static rocsparse_status
+    rocsparse_exporter_chunked_write_chunks(FILE*                                 file,
+                                            const rocsparse_chunked_header&       header,
+                                            std::vector<rocsparse_chunked_entry>& index,
+                                            F                                     encode)
+{
+    rocsparse_chunked_codec codec;
+    int                     level;
+    rocsparse_status        status = rocsparse_chunked_get_codec(&codec, &level);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    status = rocsparse_chunked_write_header(file, header);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    int nthreads = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+
+    const int64_t                  nchunks    = index.size();
+    const int64_t                  batch_size = 2 * static_cast<int64_t>(nthreads);
+    std::vector<std::vector<char>> raw(batch_size);
+    std::vector<std::vector<char>> compressed(batch_size);
+    std::vector<rocsparse_status>  statuses(batch_size);
+
+    uint64_t offset = sizeof(rocsparse_chunked_header);
+    for(int64_t batch_begin = 0; batch_begin < nchunks; batch_begin += batch_size)
+    {
+        const int64_t batch_end = std::min(batch_begin + batch_size, nchunks);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t chunk = batch_begin; chunk < batch_end; ++chunk)
+        {
+            const int64_t           i = chunk - batch_begin;
+            rocsparse_chunked_codec used;
+            raw[i].clear();
+            encode(index[chunk], raw[i]);
+            statuses[i] = rocsparse_chunked_compress(codec, level, raw[i], compressed[i], &used);
+            index[chunk].codec    = used;
+            index[chunk].raw_size = raw[i].size();
+        }
+
+        for(int64_t chunk = batch_begin; chunk < batch_end; ++chunk)
+        {
+            const int64_t i = chunk - batch_begin;
+            if(statuses[i] != rocsparse_status_success)
+            {
+                return statuses[i];
+            }
+
+            const std::vector<char>& data
+                = (index[chunk].codec == rocsparse_chunked_codec_none) ? raw[i] : compressed[i];
+            index[chunk].offset = offset;
+            index[chunk].size   = data.size();
+            if(data.size() != fwrite(data.data(), 1, data.size(), file))
+            {
+                return rocsparse_status_internal_error;
+            }
+            offset += data.size();
+        }
+    }
+
+    return rocsparse_chunked_write_index(file, offset, index);
+}
+
+template <typename F>
+static rocsparse_status
+    rocsparse_exporter_chunked_write(const std::string&                    filename,
+                                     const rocsparse_chunked_header&       header,
+                                     std::vector<rocsparse_chunked_entry>& index,
+                                     F                                     encode)
+{
+    FILE* file = fopen(filename.c_str(), "wb");
+    if(!file)
+    {
+        std::cerr << "cannot open file '" << filename << "' " << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    rocsparse_status status = rocsparse_exporter_chunked_write_chunks(file, header, index, encode);
+    if(fclose(file) != 0 && status == rocsparse_status_success)
+    {
+        status = rocsparse_status_internal_error;
+    }
+    return status;
+}
+
+//
+// Group consecutive rows (or columns) into chunks of about
+// rocsparse_chunked_chunk_size entries, a chunk holds at least one row.
+//
+template <typename I, typename J>
+static void rocsparse_exporter_chunked_split(J                                     L,
+                                             const I* __restrict__ ptr,
+                                             std::vector<rocsparse_chunked_entry>& index)
+{
+    const int64_t size = rocsparse_chunked_chunk_size;
+    int64_t       row  = 0;
+    while(row < L)
+    {
+        const int64_t last   = std::min(static_cast<int64_t>(L), row + size);
+        const int64_t target = static_cast<int64_t>(ptr[row]) + size;
+        int64_t       end    = std::upper_bound(ptr + row + 1, ptr + last + 1, target) - ptr - 1;
+        end                  = std::max(end, row + 1);
+
+        rocsparse_chunked_entry entry;
+        entry.row_begin = row;
+        entry.row_end   = end;
+        entry.nnz_begin = ptr[row] - ptr[0];
+        entry.nnz_end   = ptr[end] - ptr[0];
+        index.push_back(entry);
+        row = end;
+    }
+}
+
+//
+// Values, lengths of the rows (or columns) and delta encoded indices of a
+// chunk of a CSX or GEBSX matrix.
+//
+template <typename T, typename I, typename J>
+static void rocsparse_exporter_chunked_encode_csx(const rocsparse_chunked_entry& entry,
+                                                  std::vector<char>&             raw,
+                                                  int64_t                        block_size,
+                                                  const I* __restrict__ ptr,
+                                                  const J* __restrict__ ind,
+                                                  const T* __restrict__ val,
+                                                  rocsparse_index_base base)
+{
+    const size_t nnz   = entry.nnz_end - entry.nnz_begin;
+    const size_t bytes = nnz * block_size * sizeof(T);
+    raw.reserve(bytes + 2 * nnz + (entry.row_end - entry.row_begin));
+    raw.resize(bytes);
+    if(bytes > 0)
+    {
+        memcpy(raw.data(), val + entry.nnz_begin * block_size, bytes);
+    }
+
+    for(uint64_t row = entry.row_begin; row < entry.row_end; ++row)
+    {
+        rocsparse_chunked_put_varint(raw, ptr[row + 1] - ptr[row]);
+    }
+
+    for(uint64_t row = entry.row_begin; row < entry.row_end; ++row)
+    {
+        int64_t prev = 0;
+        for(I k = ptr[row] - ptr[0]; k < ptr[row + 1] - ptr[0]; ++k)
+        {
+            const int64_t j = static_cast<int64_t>(ind[k]) - base;
+            rocsparse_chunked_put_varint(raw, rocsparse_chunked_zigzag(j - prev));
+            prev = j;
+        }
+    }
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_exporter_chunked::write_sparse_csx(rocsparse_direction dir_,
+                                                              J                   m_,
+                                                              J                   n_,
+                                                              I                   nnz_,
+                                                              const I* __restrict__ ptr_,
+                                                              const J* __restrict__ ind_,
+                                                              const T* __restrict__ val_,
+                                                              rocsparse_index_base base_)
+{
+    if(dir_ != rocsparse_direction_row && dir_ != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    rocsparse_chunked_header header;
+    header.format   = rocsparse_chunked_format_csx;
+    header.dir      = dir_;
+    header.base     = base_;
+    header.ptr_type = get_indextype<I>();
+    header.ind_type = get_indextype<J>();
+    header.val_type = get_datatype<T>();
+    header.m        = m_;
+    header.n        = n_;
+    header.nnz      = nnz_;
+
+    std::vector<rocsparse_chunked_entry> index;
+    rocsparse_exporter_chunked_split((dir_ == rocsparse_direction_row) ? m_ : n_, ptr_, index);
+
+    auto encode = [=](const rocsparse_chunked_entry& entry, std::vector<char>& raw) {
+        rocsparse_exporter_chunked_encode_csx(entry, raw, 1, ptr_, ind_, val_, base_);
+    };
+    return rocsparse_exporter_chunked_write(this->m_filename, header, index, encode);
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_exporter_chunked::write_sparse_gebsx(rocsparse_direction dir_,
+                                                                rocsparse_direction dirb_,
+                                                                J                   mb_,
+                                                                J                   nb_,
+                                                                I                   nnzb_,
+                                                                J                   block_dim_row_,
+                                                                J block_dim_column_,
+                                                                const I* __restrict__ ptr_,
+                                                                const J* __restrict__ ind_,
+                                                                const T* __restrict__ val_,
+                                                                rocsparse_index_base base_)
+{
+    if(dir_ != rocsparse_direction_row && dir_ != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    rocsparse_chunked_header header;
+    header.format        = rocsparse_chunked_format_gebsx;
+    header.dir           = dir_;
+    header.dirb          = dirb_;
+    header.base          = base_;
+    header.ptr_type      = get_indextype<I>();
+    header.ind_type      = get_indextype<J>();
+    header.val_type      = get_datatype<T>();
+    header.m             = mb_;
+    header.n             = nb_;
+    header.nnz           = nnzb_;
+    header.row_block_dim = block_dim_row_;
+    header.col_block_dim = block_dim_column_;
+
+    std::vector<rocsparse_chunked_entry> index;
+    rocsparse_exporter_chunked_split((dir_ == rocsparse_direction_row) ? mb_ : nb_, ptr_, index);
+
+    const int64_t block_size = static_cast<int64_t>(block_dim_row_) * block_dim_column_;
+    auto          encode = [=](const rocsparse_chunked_entry& entry, std::vector<char>& raw) {
+        rocsparse_exporter_chunked_encode_csx(entry, raw, block_size, ptr_, ind_, val_, base_);
+    };
+    return rocsparse_exporter_chunked_write(this->m_filename, header, index, encode);
+}
+
+template <typename T, typename I>
+rocsparse_status rocsparse_exporter_chunked::write_sparse_coo(I m_,
+                                                              I n_,
+                                                              I nnz_,
+                                                              const I* __restrict__ row_ind_,
+                                                              const I* __restrict__ col_ind_,
+                                                              const T* __restrict__ val_,
+                                                              rocsparse_index_base base_)
+{
+    rocsparse_chunked_header header;
+    header.format   = rocsparse_chunked_format_coo;
+    header.base     = base_;
+    header.ptr_type = get_indextype<I>();
+    header.ind_type = get_indextype<I>();
+    header.val_type = get_datatype<T>();
+    header.m        = m_;
+    header.n        = n_;
+    header.nnz      = nnz_;
+
+    //
+    // Chunks are ranges of entries.
+    //
+    const int64_t                        size = rocsparse_chunked_chunk_size;
+    std::vector<rocsparse_chunked_entry> index;
+    for(int64_t begin = 0; begin < static_cast<int64_t>(nnz_); begin += size)
+    {
+        rocsparse_chunked_entry entry;
+        entry.row_begin = entry.nnz_begin = begin;
+        entry.row_end = entry.nnz_end = std::min(begin + size, static_cast<int64_t>(nnz_));
+        index.push_back(entry);
+    }
+
+    //
+    // Row indices are delta encoded, column indices are delta encoded within
+    // a row.
+    //
+    auto encode = [=](const rocsparse_chunked_entry& entry, std::vector<char>& raw) {
+        const size_t nnz   = entry.nnz_end - entry.nnz_begin;
+        const size_t bytes = nnz * sizeof(T);
+        raw.reserve(bytes + 3 * nnz);
+        raw.resize(bytes);
+        if(bytes > 0)
+        {
+            memcpy(raw.data(), val_ + entry.nnz_begin, bytes);
+        }
+
+        int64_t prev_i = 0;
+        int64_t prev_j = 0;
+        for(uint64_t k = entry.nnz_begin; k < entry.nnz_end; ++k)
+        {
+            const int64_t i = static_cast<int64_t>(row_ind_[k]) - base_;
+            const int64_t j = static_cast<int64_t>(col_ind_[k]) - base_;
+            if(i != prev_i)
+            {
+                prev_j = 0;
+            }
+            rocsparse_chunked_put_varint(raw, rocsparse_chunked_zigzag(i - prev_i));
+            rocsparse_chunked_put_varint(raw, rocsparse_chunked_zigzag(j - prev_j));
+            prev_i = i;
+            prev_j = j;
+        }
+    };
+    return rocsparse_exporter_chunked_write(this->m_filename, header, index, encode);
+}
+
+template <typename T, typename I>
+rocsparse_status
+    rocsparse_exporter_chunked::write_dense_vector(I nmemb_, const T* __restrict__ x_, I incx_)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename T, typename I>
+rocsparse_status rocsparse_exporter_chunked::write_dense_matrix(
+    rocsparse_order order_, I m_, I n_, const T* __restrict__ x_, I ld_)
+{
+    return rocsparse_status_not_implemented;
+}
+
+#define INSTANTIATE_TIJ(T, I, J)                                              \
+    template rocsparse_status rocsparse_exporter_chunked::write_sparse_csx(   \
+        rocsparse_direction,                                                  \
+        J,                                                                    \
+        J,                                                                    \
+        I,                                                                    \
+        const I* __restrict__,                                                \
+        const J* __restrict__,                                                \
+        const T* __restrict__,                                                \
+        rocsparse_index_base);                                                \
+    template rocsparse_status rocsparse_exporter_chunked::write_sparse_gebsx( \
+        rocsparse_direction,                                                  \
+        rocsparse_direction,                                                  \
+        J,                                                                    \
+        J,                                                                    \
+        I,                                                                    \
+        J,                                                                    \
+        J,                                                                    \
+        const I* __restrict__,                                                \
+        const J* __restrict__,                                                \
+        const T* __restrict__,                                                \
+        rocsparse_index_base)
+
+#define INSTANTIATE_TI(T, I)                                                  \
+    template rocsparse_status rocsparse_exporter_chunked::write_dense_vector( \
+        I, const T* __restrict__, I);                                         \
+    template rocsparse_status rocsparse_exporter_chunked::write_dense_matrix( \
+        rocsparse_order, I, I, const T* __restrict__, I);                     \
+    template rocsparse_status rocsparse_exporter_chunked::write_sparse_coo(   \
+        I,                                                                    \
+        I,                                                                    \
+        I,                                                                    \
+        const I* __restrict__,                                                \
+        const I* __restrict__,                                                \
+        const T* __restrict__,                                                \
+        rocsparse_index_base)
+
+INSTANTIATE_TIJ(float, int32_t, int32_t);
+INSTANTIATE_TIJ(float, int64_t, int32_t);
+INSTANTIATE_TIJ(float, int64_t, int64_t);
+
+INSTANTIATE_TIJ(double, int32_t, int32_t);
+INSTANTIATE_TIJ(double, int64_t, int32_t);
+INSTANTIATE_TIJ(double, int64_t, int64_t);
+
+INSTANTIATE_TIJ(rocsparse_float_complex, int32_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_float_complex, int64_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_float_complex, int64_t, int64_t);
+
+INSTANTIATE_TIJ(rocsparse_double_complex, int32_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int64_t);
+
+INSTANTIATE_TI(float, int32_t);
+INSTANTIATE_TI(float, int64_t);
+
+INSTANTIATE_TI(double, int32_t);
+INSTANTIATE_TI(double, int64_t);
+
+INSTANTIATE_TI(rocsparse_float_complex, int32_t);
+INSTANTIATE_TI(rocsparse_float_complex, int64_t);
+
+INSTANTIATE_TI(rocsparse_double_complex, int32_t);
+INSTANTIATE_TI(rocsparse_double_complex, int64_t);
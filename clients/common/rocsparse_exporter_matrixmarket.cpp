@@ -23,6 +23,8 @@
  * ************************************************************************ */
 
 #include "rocsparse_exporter_matrixmarket.hpp"
+#include "rocsparse_exporter_text.hpp"
+
 template <typename X, typename Y>
 rocsparse_status rocsparse_type_conversion(const X& x, Y& y);
 
@@ -45,6 +47,21 @@ rocsparse_exporter_matrixmarket::rocsparse_exporter_matrixmarket(const std::stri
     }
 }
 
+//
+// Banner line of a matrix market file.
+//
+template <typename T>
+static std::string rocsparse_exporter_matrixmarket_banner(const char* format)
+{
+    std::string banner = std::string("%%MatrixMarket matrix ") + format;
+    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
+        banner += " complex";
+    else
+        banner += " real";
+    banner += " general\n";
+    return banner;
+}
+
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_csx(rocsparse_direction dir_,
                                                                    J                   m_,
@@ -55,81 +72,68 @@ rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_csx(rocsparse_dir
                                                                    const T* __restrict__ val_,
                                                                    rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
+    if(dir_ != rocsparse_direction_row && dir_ != rocsparse_direction_column)
     {
-        return rocsparse_status_internal_error;
+        return rocsparse_status_invalid_value;
     }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
+        return status;
     }
-    else
+
+    std::string header = rocsparse_exporter_matrixmarket_banner<T>("coordinate");
+    rocsparse_exporter_text_append_integer(header, m_);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, n_);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, nnz_);
+    header.push_back('\n');
+    status = out.write(header);
+    if(status != rocsparse_status_success)
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return status;
     }
 
-    out << "%%MatrixMarket matrix coordinate ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << m_ << " " << n_ << " " << nnz_ << std::endl;
-    switch(dir_)
-    {
-    case rocsparse_direction_row:
-    {
-        for(J i = 0; i < m_; ++i)
+    //
+    // Chunks are ranges of entries, the row (or column) holding the first entry
+    // of a chunk is found by bisection.
+    //
+    const J       L       = (dir_ == rocsparse_direction_row) ? m_ : n_;
+    const int64_t size    = rocsparse_exporter_text_chunk_size;
+    const int64_t nchunks = (static_cast<int64_t>(nnz_) + size - 1) / size;
+
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const I  begin = static_cast<I>(chunk * size);
+        const I  end   = static_cast<I>(std::min(chunk * size + size, int64_t(nnz_)));
+        const I* first = std::upper_bound(ptr_, ptr_ + L + 1, begin + base_);
+        J        i     = static_cast<J>(first - ptr_) - 1;
+        for(I at = begin; at < end; ++at)
         {
-            for(I at = ptr_[i] - base_; at < ptr_[i + 1] - base_; ++at)
+            while(at >= ptr_[i + 1] - base_)
             {
-                J j = ind_[at] - base_;
-                T x = val_[at];
-                out << (i + 1) << " " << (j + 1);
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                {
-                    out << " " << std::real(x) << " " << std::imag(x);
-                }
-                else
-                {
-                    out << " " << x;
-                }
-                out << std::endl;
+                ++i;
             }
+            const J j = ind_[at] - base_;
+            rocsparse_exporter_text_append_integer(
+                buffer, ((dir_ == rocsparse_direction_row) ? i : j) + int64_t(1));
+            buffer.push_back(' ');
+            rocsparse_exporter_text_append_integer(
+                buffer, ((dir_ == rocsparse_direction_row) ? j : i) + int64_t(1));
+            buffer.push_back(' ');
+            rocsparse_exporter_text_append_scalar(buffer, val_[at]);
+            buffer.push_back('\n');
         }
-        out.close();
-        return rocsparse_status_success;
-    }
-    case rocsparse_direction_column:
+    };
+
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
     {
-        for(J j = 0; j < n_; ++j)
-        {
-            for(I at = ptr_[j] - base_; at < ptr_[j + 1] - base_; ++at)
-            {
-                J i = ind_[at] - base_;
-                T x = val_[at];
-                out << (i + 1) << " " << (j + 1);
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                {
-                    out << " " << std::real(x) << " " << std::imag(x);
-                }
-                else
-                {
-                    out << " " << x;
-                }
-                out << std::endl;
-            }
-        }
-        out.close();
-        return rocsparse_status_success;
+        return status;
     }
-    }
-    return rocsparse_status_invalid_value;
+    return out.close();
 }
 
 template <typename T, typename I, typename J>
@@ -145,274 +149,176 @@ rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_gebsx(rocsparse_d
                                                                      const T* __restrict__ val_,
                                                                      rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
+    if(dir_ != rocsparse_direction_row && dir_ != rocsparse_direction_column)
     {
-        return rocsparse_status_internal_error;
+        return rocsparse_status_invalid_value;
     }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
+        return status;
     }
-    else
+
+    const int64_t bm = block_dim_row_;
+    const int64_t bn = block_dim_column_;
+
+    std::string header = rocsparse_exporter_matrixmarket_banner<T>("coordinate");
+    rocsparse_exporter_text_append_integer(header, mb_ * bm);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, nb_ * bn);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, nnzb_ * bm * bn);
+    header.push_back('\n');
+    status = out.write(header);
+    if(status != rocsparse_status_success)
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return status;
     }
 
-    out << "%%MatrixMarket matrix coordinate ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << mb_ * block_dim_row_ << " " << nb_ * block_dim_column_ << " "
-        << nnzb_ * block_dim_row_ * block_dim_column_ << std::endl;
-    switch(dir_)
-    {
-    case rocsparse_direction_row:
-    {
-        for(J ib = 0; ib < mb_; ++ib)
+    //
+    // Chunks are ranges of blocks, the block row (or block column) holding the
+    // first block of a chunk is found by bisection.
+    //
+    const J       L       = (dir_ == rocsparse_direction_row) ? mb_ : nb_;
+    const int64_t size    = std::max(int64_t(1), rocsparse_exporter_text_chunk_size / (bm * bn));
+    const int64_t nchunks = (static_cast<int64_t>(nnzb_) + size - 1) / size;
+
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const I  begin = static_cast<I>(chunk * size);
+        const I  end   = static_cast<I>(std::min(chunk * size + size, int64_t(nnzb_)));
+        const I* first = std::upper_bound(ptr_, ptr_ + L + 1, begin + base_);
+        J        b     = static_cast<J>(first - ptr_) - 1;
+        for(I at = begin; at < end; ++at)
         {
-            I i = ib * block_dim_row_;
-            for(I at = ptr_[ib] - base_; at < ptr_[ib + 1] - base_; ++at)
+            while(at >= ptr_[b + 1] - base_)
             {
-                J j = (ind_[at] - base_) * block_dim_column_;
-                switch(dirb_)
-                {
-                case rocsparse_direction_row:
-                {
-                    for(J k = 0; k < block_dim_row_; ++k)
-                    {
-                        for(J l = 0; l < block_dim_column_; ++l)
-                        {
-                            auto v = val_[at * block_dim_row_ * block_dim_column_
-                                          + block_dim_column_ * k + l];
-                            out << (i + k) << " " << (j + l);
-                            if(std::is_same<T, rocsparse_float_complex>()
-                               || std::is_same<T, rocsparse_double_complex>())
-                            {
-                                out << " " << std::real(v) << " " << std::imag(v);
-                            }
-                            else
-                            {
-                                out << " " << v;
-                            }
-                            out << std::endl;
-                        }
-                    }
-                    break;
-                }
-                case rocsparse_direction_column:
-                {
-                    for(J k = 0; k < block_dim_row_; ++k)
-                    {
-                        for(J l = 0; l < block_dim_column_; ++l)
-                        {
-                            auto v = val_[at * block_dim_row_ * block_dim_column_
-                                          + block_dim_row_ * l + k];
-                            out << (i + k) << " " << (j + l);
-                            if(std::is_same<T, rocsparse_float_complex>()
-                               || std::is_same<T, rocsparse_double_complex>())
-                            {
-                                out << " " << std::real(v) << " " << std::imag(v);
-                            }
-                            else
-                            {
-                                out << " " << v;
-                            }
-                            out << std::endl;
-                        }
-                    }
-                    break;
-                }
-                }
+                ++b;
             }
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
-
-    case rocsparse_direction_column:
-    {
-        for(J jb = 0; jb < nb_; ++jb)
-        {
-            I j = jb * block_dim_column_;
-            for(I at = ptr_[jb] - base_; at < ptr_[jb + 1] - base_; ++at)
+            const J       c = ind_[at] - base_;
+            const int64_t i = ((dir_ == rocsparse_direction_row) ? b : c) * bm;
+            const int64_t j = ((dir_ == rocsparse_direction_row) ? c : b) * bn;
+            for(int64_t k = 0; k < bm; ++k)
             {
-                J i = (ind_[at] - base_) * block_dim_row_;
-                switch(dirb_)
+                for(int64_t l = 0; l < bn; ++l)
                 {
-
-                case rocsparse_direction_row:
-                {
-                    for(J k = 0; k < block_dim_row_; ++k)
-                    {
-                        for(J l = 0; l < block_dim_column_; ++l)
-                        {
-                            auto v = val_[at * block_dim_row_ * block_dim_column_
-                                          + block_dim_column_ * k + l];
-                            out << (i + k) << " " << (j + l);
-                            if(std::is_same<T, rocsparse_float_complex>()
-                               || std::is_same<T, rocsparse_double_complex>())
-                            {
-                                out << " " << std::real(v) << " " << std::imag(v);
-                            }
-                            else
-                            {
-                                out << " " << v;
-                            }
-                            out << std::endl;
-                        }
-                    }
-                    break;
-                }
-
-                case rocsparse_direction_column:
-                {
-                    for(J k = 0; k < block_dim_row_; ++k)
-                    {
-                        for(J l = 0; l < block_dim_column_; ++l)
-                        {
-                            auto v = val_[at * block_dim_row_ * block_dim_column_
-                                          + block_dim_row_ * l + k];
-                            out << (i + k) << " " << (j + l);
-                            if(std::is_same<T, rocsparse_float_complex>()
-                               || std::is_same<T, rocsparse_double_complex>())
-                            {
-                                out << " " << std::real(v) << " " << std::imag(v);
-                            }
-                            else
-                            {
-                                out << " " << v;
-                            }
-                            out << std::endl;
-                        }
-                    }
-                    break;
-                }
+                    const T v = val_[at * bm * bn
+                                     + ((dirb_ == rocsparse_direction_row) ? (bn * k + l)
+                                                                           : (bm * l + k))];
+                    rocsparse_exporter_text_append_integer(buffer, i + k + 1);
+                    buffer.push_back(' ');
+                    rocsparse_exporter_text_append_integer(buffer, j + l + 1);
+                    buffer.push_back(' ');
+                    rocsparse_exporter_text_append_scalar(buffer, v);
+                    buffer.push_back('\n');
                 }
             }
         }
-        out.close();
-        return rocsparse_status_success;
-    }
-    }
-    return rocsparse_status_invalid_value;
+    };
 
-    std::cerr << "rocsparse_exporter_matrixmarket, gebsx not supported." << std::endl;
-    return rocsparse_status_not_implemented;
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+    return out.close();
 }
 
 template <typename T, typename I>
 rocsparse_status
     rocsparse_exporter_matrixmarket::write_dense_vector(I nmemb_, const T* __restrict__ x_, I incx_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        return rocsparse_status_internal_error;
+        return status;
     }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
-    {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
+
+    std::string header = rocsparse_exporter_matrixmarket_banner<T>("array");
+    rocsparse_exporter_text_append_integer(header, nmemb_);
+    header += " 1\n";
+    status = out.write(header);
+    if(status != rocsparse_status_success)
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return status;
     }
 
-    out << "%%MatrixMarket matrix array ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << nmemb_ << " 1" << std::endl;
-    for(I i = 0; i < nmemb_; ++i)
-    {
-        if(std::is_same<T, rocsparse_float_complex>()
-           || std::is_same<T, rocsparse_double_complex>())
-        {
-            out << std::real(x_[i * incx_]) << " " << std::imag(x_[i * incx_]) << std::endl;
-        }
-        else
+    const int64_t size    = rocsparse_exporter_text_chunk_size;
+    const int64_t nchunks = (static_cast<int64_t>(nmemb_) + size - 1) / size;
+
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const int64_t end = std::min(chunk * size + size, int64_t(nmemb_));
+        for(int64_t i = chunk * size; i < end; ++i)
         {
-            out << x_[i * incx_] << std::endl;
+            rocsparse_exporter_text_append_scalar(buffer, x_[i * incx_]);
+            buffer.push_back('\n');
         }
+    };
+
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
+    {
+        return status;
     }
-    out.close();
-    return rocsparse_status_success;
+    return out.close();
 }
 
 template <typename T, typename I>
 rocsparse_status rocsparse_exporter_matrixmarket::write_dense_matrix(
     rocsparse_order order_, I m_, I n_, const T* __restrict__ x_, I ld_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
+    if(order_ != rocsparse_order_row && order_ != rocsparse_order_column)
     {
-        return rocsparse_status_internal_error;
+        return rocsparse_status_invalid_value;
     }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
+        return status;
     }
-    else
+
+    std::string header = rocsparse_exporter_matrixmarket_banner<T>("array");
+    rocsparse_exporter_text_append_integer(header, m_);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, n_);
+    header.push_back('\n');
+    status = out.write(header);
+    if(status != rocsparse_status_success)
     {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return status;
     }
 
-    out << "%%MatrixMarket matrix array ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << m_ << " " << n_ << std::endl;
-    switch(order_)
-    {
-    case rocsparse_order_row:
-    {
-        for(I i = 0; i < m_; ++i)
+    //
+    // Chunks are ranges of rows.
+    //
+    const int64_t ncols   = std::max(int64_t(n_), int64_t(1));
+    const int64_t size    = std::max(int64_t(1), rocsparse_exporter_text_chunk_size / ncols);
+    const int64_t nchunks = (static_cast<int64_t>(m_) + size - 1) / size;
+
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const int64_t end = std::min(chunk * size + size, int64_t(m_));
+        for(int64_t i = chunk * size; i < end; ++i)
         {
-            for(I j = 0; j < n_; ++j)
+            for(int64_t j = 0; j < n_; ++j)
             {
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                    out << " " << std::real(x_[i * ld_ + j]) << " " << std::imag(x_[i * ld_ + j]);
-                else
-                    out << " " << x_[i * ld_ + j];
+                buffer.push_back(' ');
+                const T x = (order_ == rocsparse_order_row) ? x_[i * ld_ + j] : x_[j * ld_ + i];
+                rocsparse_exporter_text_append_scalar(buffer, x);
             }
-            out << std::endl;
+            buffer.push_back('\n');
         }
-        out.close();
-        return rocsparse_status_success;
-    }
-    case rocsparse_order_column:
+    };
+
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
     {
-        for(I i = 0; i < m_; ++i)
-        {
-            for(I j = 0; j < n_; ++j)
-            {
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                    out << " " << std::real(x_[j * ld_ + i]) << " " << std::imag(x_[j * ld_ + i]);
-                else
-                    out << " " << x_[j * ld_ + i];
-            }
-            out << std::endl;
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
+        return status;
     }
-    return rocsparse_status_invalid_value;
+    return out.close();
 }
 
 template <typename T, typename I>
@@ -424,48 +330,48 @@ rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_coo(I m_,
                                                                    const T* __restrict__ val_,
                                                                    rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
+    rocsparse_exporter_text_stream out;
+    rocsparse_status               status = out.open(this->m_filename);
+    if(status != rocsparse_status_success)
     {
-        return rocsparse_status_internal_error;
+        return status;
     }
 
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    std::string header = rocsparse_exporter_matrixmarket_banner<T>("coordinate");
+    rocsparse_exporter_text_append_integer(header, m_);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, n_);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, nnz_);
+    header.push_back('\n');
+    status = out.write(header);
+    if(status != rocsparse_status_success)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
+        return status;
     }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
-    }
-
-    out << "%%MatrixMarket matrix coordinate ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
 
-    out << " general" << std::endl;
-    out << m_ << " " << n_ << " " << nnz_ << std::endl;
+    const int64_t size    = rocsparse_exporter_text_chunk_size;
+    const int64_t nchunks = (static_cast<int64_t>(nnz_) + size - 1) / size;
 
-    for(I i = 0; i < nnz_; ++i)
-    {
-        out << ((row_ind_[i] - base_) + 1) << " " << ((col_ind_[i] - base_) + 1);
-        if(std::is_same<T, rocsparse_float_complex>()
-           || std::is_same<T, rocsparse_double_complex>())
-        {
-            out << " " << std::real(val_[i]) << " " << std::imag(val_[i]) << std::endl;
-        }
-        else
+    auto format = [=](int64_t chunk, std::string& buffer) {
+        const int64_t end = std::min(chunk * size + size, int64_t(nnz_));
+        for(int64_t k = chunk * size; k < end; ++k)
         {
-            out << " " << val_[i] << std::endl;
+            rocsparse_exporter_text_append_integer(buffer, (row_ind_[k] - base_) + int64_t(1));
+            buffer.push_back(' ');
+            rocsparse_exporter_text_append_integer(buffer, (col_ind_[k] - base_) + int64_t(1));
+            buffer.push_back(' ');
+            rocsparse_exporter_text_append_scalar(buffer, val_[k]);
+            buffer.push_back('\n');
         }
-    }
+    };
 
-    out.close();
-    return rocsparse_status_success;
+    status = rocsparse_exporter_text_write_chunks(out, nchunks, format);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+    return out.close();
 }
 
 #define INSTANTIATE_TIJ(T, I, J)                                                   \
@@ -0,0 +1,454 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_exporter_text.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+//
+// Shortest round-trip formatting of floating point numbers with the Grisu2
+// algorithm, see F. Loitsch, "Printing floating-point numbers quickly and
+// accurately with integers", PLDI 2010. The digits generated always read back
+// to the same value and are the shortest ones for almost all inputs.
+//
+
+//
+// Floating point number f * 2^e with a 64 bits significand.
+//
+struct rocsparse_diyfp
+{
+    uint64_t f;
+    int      e;
+
+    static rocsparse_diyfp sub(const rocsparse_diyfp& x, const rocsparse_diyfp& y)
+    {
+        return {x.f - y.f, x.e};
+    }
+
+    //
+    // Upper 64 bits of the 128 bits product, rounded.
+    //
+    static rocsparse_diyfp mul(const rocsparse_diyfp& x, const rocsparse_diyfp& y)
+    {
+        const uint64_t u_lo = x.f & 0xFFFFFFFFu;
+        const uint64_t u_hi = x.f >> 32;
+        const uint64_t v_lo = y.f & 0xFFFFFFFFu;
+        const uint64_t v_hi = y.f >> 32;
+
+        const uint64_t p0 = u_lo * v_lo;
+        const uint64_t p1 = u_lo * v_hi;
+        const uint64_t p2 = u_hi * v_lo;
+        const uint64_t p3 = u_hi * v_hi;
+
+        uint64_t q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+        q += uint64_t(1) << 31;
+
+        return {p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32), x.e + y.e + 64};
+    }
+
+    static rocsparse_diyfp normalize(rocsparse_diyfp x)
+    {
+        while((x.f >> 63) == 0)
+        {
+            x.f <<= 1;
+            x.e--;
+        }
+        return x;
+    }
+
+    static rocsparse_diyfp normalize_to(const rocsparse_diyfp& x, int e)
+    {
+        return {x.f << (x.e - e), e};
+    }
+};
+
+//
+// Normalized value and boundaries m- and m+ of the rounding interval, with
+// the exponent of m+.
+//
+template <typename T, typename B>
+static void rocsparse_diyfp_boundaries(T                value,
+                                       rocsparse_diyfp& w,
+                                       rocsparse_diyfp& m_minus,
+                                       rocsparse_diyfp& m_plus)
+{
+    static constexpr int      precision  = std::numeric_limits<T>::digits;
+    static constexpr int      bias       = std::numeric_limits<T>::max_exponent - 1 + precision - 1;
+    static constexpr int      min_exp    = 1 - bias;
+    static constexpr uint64_t hidden_bit = uint64_t(1) << (precision - 1);
+
+    B bits;
+    memcpy(&bits, &value, sizeof(B));
+
+    const uint64_t E = bits >> (precision - 1);
+    const uint64_t F = bits & (hidden_bit - 1);
+
+    const rocsparse_diyfp v = (E == 0) ? rocsparse_diyfp{F, min_exp}
+                                       : rocsparse_diyfp{F + hidden_bit, int(E) - bias};
+
+    //
+    // The lower boundary is closer when the significand is a power of two.
+    //
+    const bool closer = (F == 0 && E > 1);
+
+    m_plus  = rocsparse_diyfp::normalize({2 * v.f + 1, v.e - 1});
+    m_minus = rocsparse_diyfp::normalize_to(
+        closer ? rocsparse_diyfp{4 * v.f - 1, v.e - 2} : rocsparse_diyfp{2 * v.f - 1, v.e - 1},
+        m_plus.e);
+    w = rocsparse_diyfp::normalize(v);
+}
+
+//
+// Cached power c = f * 2^e ~= 10^k such that the product with a normalized
+// number of binary exponent e lies in [2^-60, 2^-32).
+//
+struct rocsparse_cached_power
+{
+    uint64_t f;
+    int      e;
+    int      k;
+};
+
+static rocsparse_cached_power rocsparse_get_cached_power(int e)
+{
+    static constexpr rocsparse_cached_power cached_powers[] = {
+        {0xAB70FE17C79AC6CA, -1060, -300},
+        {0xFF77B1FCBEBCDC4F, -1034, -292},
+        {0xBE5691EF416BD60C, -1007, -284},
+        {0x8DD01FAD907FFC3C, -980, -276},
+        {0xD3515C2831559A83, -954, -268},
+        {0x9D71AC8FADA6C9B5, -927, -260},
+        {0xEA9C227723EE8BCB, -901, -252},
+        {0xAECC49914078536D, -874, -244},
+        {0x823C12795DB6CE57, -847, -236},
+        {0xC21094364DFB5637, -821, -228},
+        {0x9096EA6F3848984F, -794, -220},
+        {0xD77485CB25823AC7, -768, -212},
+        {0xA086CFCD97BF97F4, -741, -204},
+        {0xEF340A98172AACE5, -715, -196},
+        {0xB23867FB2A35B28E, -688, -188},
+        {0x84C8D4DFD2C63F3B, -661, -180},
+        {0xC5DD44271AD3CDBA, -635, -172},
+        {0x936B9FCEBB25C996, -608, -164},
+        {0xDBAC6C247D62A584, -582, -156},
+        {0xA3AB66580D5FDAF6, -555, -148},
+        {0xF3E2F893DEC3F126, -529, -140},
+        {0xB5B5ADA8AAFF80B8, -502, -132},
+        {0x87625F056C7C4A8B, -475, -124},
+        {0xC9BCFF6034C13053, -449, -116},
+        {0x964E858C91BA2655, -422, -108},
+        {0xDFF9772470297EBD, -396, -100},
+        {0xA6DFBD9FB8E5B88F, -369, -92},
+        {0xF8A95FCF88747D94, -343, -84},
+        {0xB94470938FA89BCF, -316, -76},
+        {0x8A08F0F8BF0F156B, -289, -68},
+        {0xCDB02555653131B6, -263, -60},
+        {0x993FE2C6D07B7FAC, -236, -52},
+        {0xE45C10C42A2B3B06, -210, -44},
+        {0xAA242499697392D3, -183, -36},
+        {0xFD87B5F28300CA0E, -157, -28},
+        {0xBCE5086492111AEB, -130, -20},
+        {0x8CBCCC096F5088CC, -103, -12},
+        {0xD1B71758E219652C, -77, -4},
+        {0x9C40000000000000, -50, 4},
+        {0xE8D4A51000000000, -24, 12},
+        {0xAD78EBC5AC620000, 3, 20},
+        {0x813F3978F8940984, 30, 28},
+        {0xC097CE7BC90715B3, 56, 36},
+        {0x8F7E32CE7BEA5C70, 83, 44},
+        {0xD5D238A4ABE98068, 109, 52},
+        {0x9F4F2726179A2245, 136, 60},
+        {0xED63A231D4C4FB27, 162, 68},
+        {0xB0DE65388CC8ADA8, 189, 76},
+        {0x83C7088E1AAB65DB, 216, 84},
+        {0xC45D1DF942711D9A, 242, 92},
+        {0x924D692CA61BE758, 269, 100},
+        {0xDA01EE641A708DEA, 295, 108},
+        {0xA26DA3999AEF774A, 322, 116},
+        {0xF209787BB47D6B85, 348, 124},
+        {0xB454E4A179DD1877, 375, 132},
+        {0x865B86925B9BC5C2, 402, 140},
+        {0xC83553C5C8965D3D, 428, 148},
+        {0x952AB45CFA97A0B3, 455, 156},
+        {0xDE469FBD99A05FE3, 481, 164},
+        {0xA59BC234DB398C25, 508, 172},
+        {0xF6C69A72A3989F5C, 534, 180},
+        {0xB7DCBF5354E9BECE, 561, 188},
+        {0x88FCF317F22241E2, 588, 196},
+        {0xCC20CE9BD35C78A5, 614, 204},
+        {0x98165AF37B2153DF, 641, 212},
+        {0xE2A0B5DC971F303A, 667, 220},
+        {0xA8D9D1535CE3B396, 694, 228},
+        {0xFB9B7CD9A4A7443C, 720, 236},
+        {0xBB764C4CA7A44410, 747, 244},
+        {0x8BAB8EEFB6409C1A, 774, 252},
+        {0xD01FEF10A657842C, 800, 260},
+        {0x9B10A4E5E9913129, 827, 268},
+        {0xE7109BFBA19C0C9D, 853, 276},
+        {0xAC2820D9623BF429, 880, 284},
+        {0x80444B5E7AA7CF85, 907, 292},
+        {0xBF21E44003ACDD2D, 933, 300},
+        {0x8E679C2F5E44FF8F, 960, 308},
+        {0xD433179D9C8CB841, 986, 316},
+        {0x9E19DB92B4E31BA9, 1013, 324},
+    };
+
+    static constexpr int alpha    = -60;
+    static constexpr int min_k    = -300;
+    static constexpr int k_stepsz = 8;
+
+    const int f     = alpha - e - 1;
+    const int k     = (f * 78913) / (1 << 18) + (f > 0);
+    const int index = (-min_k + k + (k_stepsz - 1)) / k_stepsz;
+    return cached_powers[index];
+}
+
+//
+// Largest power of ten pow10 <= n, returns the number of digits of n.
+//
+static int rocsparse_find_largest_pow10(uint32_t n, uint32_t& pow10)
+{
+    int      digits = 10;
+    uint32_t p      = 1000000000u;
+    while(digits > 1 && n < p)
+    {
+        p /= 10;
+        --digits;
+    }
+    pow10 = p;
+    return digits;
+}
+
+//
+// Move the last digit down while the result gets closer to w.
+//
+static void rocsparse_grisu2_round(
+    char* buffer, int length, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k)
+{
+    while(rest < dist && delta - rest >= ten_k
+          && (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
+    {
+        buffer[length - 1]--;
+        rest += ten_k;
+    }
+}
+
+//
+// Generate the digits of w in the interval [M-, M+].
+//
+static void rocsparse_grisu2_digit_gen(char*           buffer,
+                                       int&            length,
+                                       int&            decimal_exponent,
+                                       rocsparse_diyfp M_minus,
+                                       rocsparse_diyfp w,
+                                       rocsparse_diyfp M_plus)
+{
+    uint64_t delta = rocsparse_diyfp::sub(M_plus, M_minus).f;
+    uint64_t dist  = rocsparse_diyfp::sub(M_plus, w).f;
+
+    const int      shift = -M_plus.e;
+    const uint64_t one   = uint64_t(1) << shift;
+
+    uint32_t p1 = static_cast<uint32_t>(M_plus.f >> shift);
+    uint64_t p2 = M_plus.f & (one - 1);
+
+    //
+    // Integral part.
+    //
+    uint32_t pow10;
+    int      n = rocsparse_find_largest_pow10(p1, pow10);
+    while(n > 0)
+    {
+        buffer[length++] = static_cast<char>('0' + p1 / pow10);
+        p1 %= pow10;
+        --n;
+
+        const uint64_t rest = (uint64_t(p1) << shift) + p2;
+        if(rest <= delta)
+        {
+            decimal_exponent += n;
+            rocsparse_grisu2_round(buffer, length, dist, delta, rest, uint64_t(pow10) << shift);
+            return;
+        }
+        pow10 /= 10;
+    }
+
+    //
+    // Fractional part.
+    //
+    int m = 0;
+    for(;;)
+    {
+        p2 *= 10;
+        buffer[length++] = static_cast<char>('0' + (p2 >> shift));
+        p2 &= one - 1;
+        ++m;
+        delta *= 10;
+        dist *= 10;
+        if(p2 <= delta)
+        {
+            break;
+        }
+    }
+    decimal_exponent -= m;
+    rocsparse_grisu2_round(buffer, length, dist, delta, p2, one);
+}
+
+//
+// Digits and decimal exponent of a positive finite value.
+//
+template <typename T, typename B>
+static void rocsparse_grisu2(char* buffer, int& length, int& decimal_exponent, T value)
+{
+    rocsparse_diyfp w, m_minus, m_plus;
+    rocsparse_diyfp_boundaries<T, B>(value, w, m_minus, m_plus);
+
+    const rocsparse_cached_power cached = rocsparse_get_cached_power(m_plus.e);
+    const rocsparse_diyfp        c{cached.f, cached.e};
+
+    const rocsparse_diyfp c_w       = rocsparse_diyfp::mul(w, c);
+    const rocsparse_diyfp c_m_minus = rocsparse_diyfp::mul(m_minus, c);
+    const rocsparse_diyfp c_m_plus  = rocsparse_diyfp::mul(m_plus, c);
+
+    //
+    // Shrink the interval by one unit to absorb the rounding errors.
+    //
+    const rocsparse_diyfp M_minus{c_m_minus.f + 1, c_m_minus.e};
+    const rocsparse_diyfp M_plus{c_m_plus.f - 1, c_m_plus.e};
+
+    length           = 0;
+    decimal_exponent = -cached.k;
+    rocsparse_grisu2_digit_gen(buffer, length, decimal_exponent, M_minus, c_w, M_plus);
+}
+
+//
+// Write digits * 10^decimal_exponent in fixed notation for moderate exponents
+// and in the scientific notation of printf("%g") otherwise.
+//
+static int
+    rocsparse_format_digits(char* buffer, const char* digits, int length, int decimal_exponent)
+{
+    char*     p = buffer;
+    const int k = length + decimal_exponent;
+    if(k > -4 && k <= 15)
+    {
+        if(k <= 0)
+        {
+            *p++ = '0';
+            *p++ = '.';
+            for(int i = k; i < 0; ++i)
+            {
+                *p++ = '0';
+            }
+            memcpy(p, digits, length);
+            p += length;
+        }
+        else if(k < length)
+        {
+            memcpy(p, digits, k);
+            p += k;
+            *p++ = '.';
+            memcpy(p, digits + k, length - k);
+            p += length - k;
+        }
+        else
+        {
+            memcpy(p, digits, length);
+            p += length;
+            for(int i = length; i < k; ++i)
+            {
+                *p++ = '0';
+            }
+        }
+        return static_cast<int>(p - buffer);
+    }
+
+    *p++ = digits[0];
+    if(length > 1)
+    {
+        *p++ = '.';
+        memcpy(p, digits + 1, length - 1);
+        p += length - 1;
+    }
+    int e = k - 1;
+    *p++  = 'e';
+    *p++  = (e < 0) ? '-' : '+';
+    e     = (e < 0) ? -e : e;
+    if(e >= 100)
+    {
+        *p++ = static_cast<char>('0' + e / 100);
+        e %= 100;
+    }
+    *p++ = static_cast<char>('0' + e / 10);
+    *p++ = static_cast<char>('0' + e % 10);
+    return static_cast<int>(p - buffer);
+}
+
+template <typename T, typename B>
+static int rocsparse_format_real(char* buffer, T x)
+{
+    if(std::isnan(x))
+    {
+        memcpy(buffer, "nan", 3);
+        return 3;
+    }
+
+    char* p = buffer;
+    if(std::signbit(x))
+    {
+        *p++ = '-';
+        x    = -x;
+    }
+
+    if(std::isinf(x))
+    {
+        memcpy(p, "inf", 3);
+        return static_cast<int>(p - buffer) + 3;
+    }
+
+    if(x == 0)
+    {
+        *p++ = '0';
+        return static_cast<int>(p - buffer);
+    }
+
+    char digits[32];
+    int  length, decimal_exponent;
+    rocsparse_grisu2<T, B>(digits, length, decimal_exponent, x);
+    p += rocsparse_format_digits(p, digits, length, decimal_exponent);
+    return static_cast<int>(p - buffer);
+}
+
+int rocsparse_exporter_text_format_real(char* buffer, float x)
+{
+    return rocsparse_format_real<float, uint32_t>(buffer, x);
+}
+
+int rocsparse_exporter_text_format_real(char* buffer, double x)
+{
+    return rocsparse_format_real<double, uint64_t>(buffer, x);
+}
@@ -209,8 +209,8 @@ void host_bsrmv(rocsparse_direction  dir,
 
         if(bsr_dim == 2)
         {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum0(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum1(WFSIZE, static_cast<T>(0));
 
             for(I j = row_begin; j < row_end; j += WFSIZE)
             {
@@ -290,7 +290,7 @@ void host_bsrmv(rocsparse_direction  dir,
         {
             for(J bi = 0; bi < bsr_dim; ++bi)
             {
-                std::vector<T> sum(WFSIZE, static_cast<T>(0));
+                host_vector<T> sum(WFSIZE, static_cast<T>(0));
 
                 for(I j = row_begin; j < row_end; ++j)
                 {
@@ -434,8 +434,8 @@ void host_bsrxmv(rocsparse_direction  dir,
 
         if(bsr_dim == 2)
         {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum0(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum1(WFSIZE, static_cast<T>(0));
 
             for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
             {
@@ -503,7 +503,7 @@ void host_bsrxmv(rocsparse_direction  dir,
         {
             for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
             {
-                std::vector<T> sum(WFSIZE, static_cast<T>(0));
+                host_vector<T> sum(WFSIZE, static_cast<T>(0));
 
                 for(rocsparse_int j = row_begin; j < row_end; ++j)
                 {
@@ -656,8 +656,8 @@ void host_gebsrmv(rocsparse_direction  dir,
 
         if(row_block_dim == 2)
         {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum0(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum1(WFSIZE, static_cast<T>(0));
 
             for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
             {
@@ -720,9 +720,9 @@ void host_gebsrmv(rocsparse_direction  dir,
         }
         else if(row_block_dim == 3)
         {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum2(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum0(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum1(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum2(WFSIZE, static_cast<T>(0));
 
             for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
             {
@@ -797,10 +797,10 @@ void host_gebsrmv(rocsparse_direction  dir,
         }
         else if(row_block_dim == 4)
         {
-            std::vector<T> sum0(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum1(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum2(WFSIZE, static_cast<T>(0));
-            std::vector<T> sum3(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum0(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum1(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum2(WFSIZE, static_cast<T>(0));
+            host_vector<T> sum3(WFSIZE, static_cast<T>(0));
 
             for(rocsparse_int j = row_begin; j < row_end; j += WFSIZE)
             {
@@ -889,7 +889,7 @@ void host_gebsrmv(rocsparse_direction  dir,
         {
             for(rocsparse_int bi = 0; bi < row_block_dim; ++bi)
             {
-                std::vector<T> sum(WFSIZE, static_cast<T>(0));
+                host_vector<T> sum(WFSIZE, static_cast<T>(0));
 
                 for(rocsparse_int j = row_begin; j < row_end; ++j)
                 {
@@ -1227,9 +1227,9 @@ void host_bsrsv(rocsparse_operation  trans,
     else if(trans == rocsparse_operation_transpose)
     {
         // Transpose matrix
-        std::vector<rocsparse_int> bsrt_row_ptr;
-        std::vector<rocsparse_int> bsrt_col_ind;
-        std::vector<T>             bsrt_val;
+        host_vector<rocsparse_int> bsrt_row_ptr;
+        host_vector<rocsparse_int> bsrt_col_ind;
+        host_vector<T>             bsrt_val;
 
         host_bsr_to_bsc(mb,
                         mb,
@@ -1462,7 +1462,7 @@ static void host_csrmv_general(rocsparse_operation  trans,
                 I row_begin = csr_row_ptr[i] - base;
                 I row_end   = csr_row_ptr[i + 1] - base;
 
-                std::vector<T> sum(WF_SIZE, static_cast<T>(0));
+                host_vector<T> sum(WF_SIZE, static_cast<T>(0));
 
                 for(I j = row_begin; j < row_end; j += WF_SIZE)
                 {
@@ -1605,7 +1605,7 @@ static void host_csrmv_symmetric(rocsparse_operation  trans,
             I row_begin = csr_row_ptr[i] - base;
             I row_end   = csr_row_ptr[i + 1] - base;
 
-            std::vector<T> sum(WF_SIZE, static_cast<T>(0));
+            host_vector<T> sum(WF_SIZE, static_cast<T>(0));
 
             for(I j = row_begin; j < row_end; j += WF_SIZE)
             {
@@ -1860,7 +1860,7 @@ static void host_csr_lsolve(J                    M,
     hipGetDevice(&dev);
     hipGetDeviceProperties(&prop, dev);
 
-    std::vector<T> temp(prop.warpSize);
+    host_vector<T> temp(prop.warpSize);
 
     // Process lower triangular part
     for(J row = 0; row < M; ++row)
@@ -1967,7 +1967,7 @@ static void host_csr_usolve(J                    M,
     hipGetDevice(&dev);
     hipGetDeviceProperties(&prop, dev);
 
-    std::vector<T> temp(prop.warpSize);
+    host_vector<T> temp(prop.warpSize);
 
     // Process upper triangular part
     for(J row = M - 1; row >= 0; --row)
@@ -2105,9 +2105,9 @@ void host_csrsv(rocsparse_operation  trans,
             || trans == rocsparse_operation_conjugate_transpose)
     {
         // Transpose matrix
-        std::vector<I> csrt_row_ptr(M + 1);
-        std::vector<J> csrt_col_ind(nnz);
-        std::vector<T> csrt_val(nnz);
+        host_vector<I> csrt_row_ptr(M + 1);
+        host_vector<J> csrt_col_ind(nnz);
+        host_vector<T> csrt_val(nnz);
 
         host_csr_to_csc(M,
                         M,
@@ -2165,16 +2165,76 @@ void host_csrsv(rocsparse_operation  trans,
     *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
 }
 
+// Merge the pivot of one batch into the first pivot found across all batches
+template <typename J>
+static void host_batched_pivot(J* pivot, J batch_pivot)
+{
+    if(batch_pivot != -1)
+    {
+        *pivot = (*pivot == -1) ? batch_pivot : std::min(*pivot, batch_pivot);
+    }
+}
+
+template <typename I, typename J, typename T>
+void host_csrsv_batched(rocsparse_operation  trans,
+                        J                    M,
+                        I                    nnz,
+                        J                    batch_count,
+                        T                    alpha,
+                        const I*             csr_row_ptr,
+                        const J*             csr_col_ind,
+                        const T*             csr_val,
+                        int64_t              val_batch_stride,
+                        const T*             x,
+                        int64_t              x_batch_stride,
+                        T*                   y,
+                        int64_t              y_batch_stride,
+                        rocsparse_diag_type  diag_type,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_index_base base,
+                        J*                   struct_pivot,
+                        J*                   numeric_pivot)
+{
+    // All batches share the sparsity pattern, the pivots are the first
+    // pivots found across all batches
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    for(J i = 0; i < batch_count; ++i)
+    {
+        J batch_struct_pivot;
+        J batch_numeric_pivot;
+
+        host_csrsv(trans,
+                   M,
+                   nnz,
+                   alpha,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   csr_val + val_batch_stride * i,
+                   x + x_batch_stride * i,
+                   y + y_batch_stride * i,
+                   diag_type,
+                   fill_mode,
+                   base,
+                   &batch_struct_pivot,
+                   &batch_numeric_pivot);
+
+        host_batched_pivot(struct_pivot, batch_struct_pivot);
+        host_batched_pivot(numeric_pivot, batch_numeric_pivot);
+    }
+}
+
 template <typename I, typename T>
 void host_coosv(rocsparse_operation   trans,
                 I                     M,
                 int64_t               nnz,
                 T                     alpha,
-                const std::vector<I>& coo_row_ind,
-                const std::vector<I>& coo_col_ind,
-                const std::vector<T>& coo_val,
-                const std::vector<T>& x,
-                std::vector<T>&       y,
+                const host_vector<I>& coo_row_ind,
+                const host_vector<I>& coo_col_ind,
+                const host_vector<T>& coo_val,
+                const host_vector<T>& x,
+                host_vector<T>&       y,
                 rocsparse_diag_type   diag_type,
                 rocsparse_fill_mode   fill_mode,
                 rocsparse_index_base  base,
@@ -2183,7 +2243,7 @@ void host_coosv(rocsparse_operation   trans,
 {
     if(std::is_same<I, int32_t>() && nnz < std::numeric_limits<int32_t>::max())
     {
-        std::vector<int32_t> csr_row_ptr(M + 1);
+        host_vector<int32_t> csr_row_ptr(M + 1);
 
         host_coo_to_csr<int32_t, I>(M, nnz, coo_row_ind.data(), csr_row_ptr, base);
 
@@ -2204,7 +2264,7 @@ void host_coosv(rocsparse_operation   trans,
     }
     else
     {
-        std::vector<int64_t> csr_row_ptr(M + 1);
+        host_vector<int64_t> csr_row_ptr(M + 1);
 
         host_coo_to_csr(M, nnz, coo_row_ind.data(), csr_row_ptr, base);
 
@@ -2225,6 +2285,51 @@ void host_coosv(rocsparse_operation   trans,
     }
 }
 
+template <typename I, typename T>
+void host_coosv_batched(rocsparse_operation  trans,
+                        I                    M,
+                        int64_t              nnz,
+                        I                    batch_count,
+                        T                    alpha,
+                        const I*             coo_row_ind,
+                        const I*             coo_col_ind,
+                        const T*             coo_val,
+                        int64_t              val_batch_stride,
+                        const T*             x,
+                        int64_t              x_batch_stride,
+                        T*                   y,
+                        int64_t              y_batch_stride,
+                        rocsparse_diag_type  diag_type,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_index_base base,
+                        I*                   struct_pivot,
+                        I*                   numeric_pivot)
+{
+    // All batches share the sparsity pattern, convert it once
+    host_vector<int64_t> csr_row_ptr(M + 1);
+
+    host_coo_to_csr(M, nnz, coo_row_ind, csr_row_ptr, base);
+
+    host_csrsv_batched(trans,
+                       M,
+                       nnz,
+                       batch_count,
+                       alpha,
+                       csr_row_ptr.data(),
+                       coo_col_ind,
+                       coo_val,
+                       val_batch_stride,
+                       x,
+                       x_batch_stride,
+                       y,
+                       y_batch_stride,
+                       diag_type,
+                       fill_mode,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
+}
+
 template <typename T, typename I, typename A, typename X, typename Y>
 void host_ellmv(rocsparse_operation  trans,
                 I                    M,
@@ -2309,6 +2414,151 @@ void host_ellmv(rocsparse_operation  trans,
     }
 }
 
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+void host_csrmv_strided_batched(rocsparse_operation  trans,
+                                J                    M,
+                                J                    N,
+                                I                    nnz,
+                                J                    batch_count,
+                                T                    alpha,
+                                const I*             csr_row_ptr,
+                                const J*             csr_col_ind,
+                                const A*             csr_val,
+                                int64_t              val_batch_stride,
+                                const X*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                Y*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base)
+{
+    for(J b = 0; b < batch_count; ++b)
+    {
+        host_csrmv(trans,
+                   M,
+                   N,
+                   nnz,
+                   alpha,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   csr_val + val_batch_stride * b,
+                   x + x_batch_stride * b,
+                   beta,
+                   y + y_batch_stride * b,
+                   base,
+                   rocsparse_matrix_type_general,
+                   rocsparse_spmv_alg_csr_stream,
+                   false);
+    }
+}
+
+template <typename T, typename I, typename A, typename X, typename Y>
+void host_coomv_strided_batched(rocsparse_operation  trans,
+                                I                    M,
+                                I                    N,
+                                int64_t              nnz,
+                                I                    batch_count,
+                                T                    alpha,
+                                const I*             coo_row_ind,
+                                const I*             coo_col_ind,
+                                const A*             coo_val,
+                                int64_t              val_batch_stride,
+                                const X*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                Y*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base)
+{
+    for(I b = 0; b < batch_count; ++b)
+    {
+        host_coomv(trans,
+                   M,
+                   N,
+                   nnz,
+                   alpha,
+                   coo_row_ind,
+                   coo_col_ind,
+                   coo_val + val_batch_stride * b,
+                   x + x_batch_stride * b,
+                   beta,
+                   y + y_batch_stride * b,
+                   base);
+    }
+}
+
+template <typename T, typename I, typename A, typename X, typename Y>
+void host_ellmv_strided_batched(rocsparse_operation  trans,
+                                I                    M,
+                                I                    N,
+                                I                    batch_count,
+                                T                    alpha,
+                                const I*             ell_col_ind,
+                                const A*             ell_val,
+                                int64_t              val_batch_stride,
+                                I                    ell_width,
+                                const X*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                Y*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base)
+{
+    for(I b = 0; b < batch_count; ++b)
+    {
+        host_ellmv(trans,
+                   M,
+                   N,
+                   alpha,
+                   ell_col_ind,
+                   ell_val + val_batch_stride * b,
+                   ell_width,
+                   x + x_batch_stride * b,
+                   beta,
+                   y + y_batch_stride * b,
+                   base);
+    }
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+void host_bsrmv_strided_batched(rocsparse_direction  dir,
+                                rocsparse_operation  trans,
+                                J                    mb,
+                                J                    nb,
+                                I                    nnzb,
+                                J                    batch_count,
+                                T                    alpha,
+                                const I*             bsr_row_ptr,
+                                const J*             bsr_col_ind,
+                                const A*             bsr_val,
+                                int64_t              val_batch_stride,
+                                J                    bsr_dim,
+                                const X*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                Y*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base)
+{
+    for(J b = 0; b < batch_count; ++b)
+    {
+        host_bsrmv(dir,
+                   trans,
+                   mb,
+                   nb,
+                   nnzb,
+                   alpha,
+                   bsr_row_ptr,
+                   bsr_col_ind,
+                   bsr_val + val_batch_stride * b,
+                   bsr_dim,
+                   x + x_batch_stride * b,
+                   beta,
+                   y + y_batch_stride * b,
+                   base);
+    }
+}
+
 template <typename T>
 void host_hybmv(rocsparse_operation  trans,
                 rocsparse_int        M,
@@ -3417,9 +3667,9 @@ void host_csrsm(J                    M,
             || transA == rocsparse_operation_conjugate_transpose)
     {
         // Transpose matrix
-        std::vector<I> csrt_row_ptr(M + 1);
-        std::vector<J> csrt_col_ind(nnz);
-        std::vector<T> csrt_val(nnz);
+        host_vector<I> csrt_row_ptr(M + 1);
+        host_vector<J> csrt_col_ind(nnz);
+        host_vector<T> csrt_val(nnz);
 
         host_csr_to_csc<I, J, T>(M,
                                  M,
@@ -3501,7 +3751,7 @@ void host_coosm(I                    M,
 {
     if(std::is_same<I, int32_t>() && nnz < std::numeric_limits<int32_t>::max())
     {
-        std::vector<int32_t> csr_row_ptr(M + 1);
+        host_vector<int32_t> csr_row_ptr(M + 1);
 
         host_coo_to_csr<int32_t, I>(M, nnz, coo_row_ind, csr_row_ptr, base);
 
@@ -3524,7 +3774,7 @@ void host_coosm(I                    M,
     }
     else
     {
-        std::vector<int64_t> csr_row_ptr(M + 1);
+        host_vector<int64_t> csr_row_ptr(M + 1);
 
         host_coo_to_csr(M, nnz, coo_row_ind, csr_row_ptr, base);
 
@@ -3547,6 +3797,106 @@ void host_coosm(I                    M,
     }
 }
 
+template <typename I, typename J, typename T>
+void host_csrsm_batched(J                    M,
+                        J                    nrhs,
+                        I                    nnz,
+                        J                    batch_count,
+                        rocsparse_operation  transA,
+                        rocsparse_operation  transB,
+                        T                    alpha,
+                        const I*             csr_row_ptr,
+                        const J*             csr_col_ind,
+                        const T*             csr_val,
+                        int64_t              val_batch_stride,
+                        T*                   B,
+                        J                    ldb,
+                        int64_t              B_batch_stride,
+                        rocsparse_diag_type  diag_type,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_index_base base,
+                        J*                   struct_pivot,
+                        J*                   numeric_pivot)
+{
+    // All batches share the sparsity pattern, the pivots are the first
+    // pivots found across all batches
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    for(J i = 0; i < batch_count; ++i)
+    {
+        J batch_struct_pivot;
+        J batch_numeric_pivot;
+
+        host_csrsm(M,
+                   nrhs,
+                   nnz,
+                   transA,
+                   transB,
+                   alpha,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   csr_val + val_batch_stride * i,
+                   B + B_batch_stride * i,
+                   ldb,
+                   diag_type,
+                   fill_mode,
+                   base,
+                   &batch_struct_pivot,
+                   &batch_numeric_pivot);
+
+        host_batched_pivot(struct_pivot, batch_struct_pivot);
+        host_batched_pivot(numeric_pivot, batch_numeric_pivot);
+    }
+}
+
+template <typename I, typename T>
+void host_coosm_batched(I                    M,
+                        I                    nrhs,
+                        int64_t              nnz,
+                        I                    batch_count,
+                        rocsparse_operation  transA,
+                        rocsparse_operation  transB,
+                        T                    alpha,
+                        const I*             coo_row_ind,
+                        const I*             coo_col_ind,
+                        const T*             coo_val,
+                        int64_t              val_batch_stride,
+                        T*                   B,
+                        I                    ldb,
+                        int64_t              B_batch_stride,
+                        rocsparse_diag_type  diag_type,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_index_base base,
+                        I*                   struct_pivot,
+                        I*                   numeric_pivot)
+{
+    // All batches share the sparsity pattern, convert it once
+    host_vector<int64_t> csr_row_ptr(M + 1);
+
+    host_coo_to_csr(M, nnz, coo_row_ind, csr_row_ptr, base);
+
+    host_csrsm_batched(M,
+                       nrhs,
+                       nnz,
+                       batch_count,
+                       transA,
+                       transB,
+                       alpha,
+                       csr_row_ptr.data(),
+                       coo_col_ind,
+                       coo_val,
+                       val_batch_stride,
+                       B,
+                       ldb,
+                       B_batch_stride,
+                       diag_type,
+                       fill_mode,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
+}
+
 template <typename T>
 void host_bsrsm(rocsparse_int       mb,
                 rocsparse_int       nrhs,
@@ -3619,9 +3969,9 @@ void host_bsrsm(rocsparse_int       mb,
     else if(transA == rocsparse_operation_transpose)
     {
         // Transpose matrix
-        std::vector<rocsparse_int> bsrt_row_ptr(mb + 1);
-        std::vector<rocsparse_int> bsrt_col_ind(nnzb);
-        std::vector<T>             bsrt_val(nnzb * bsr_dim * bsr_dim);
+        host_vector<rocsparse_int> bsrt_row_ptr(mb + 1);
+        host_vector<rocsparse_int> bsrt_col_ind(nnzb);
+        host_vector<T>             bsrt_val(nnzb * bsr_dim * bsr_dim);
 
         host_bsr_to_bsc(mb,
                         mb,
@@ -3841,7 +4191,7 @@ void host_bsrgemm(rocsparse_direction  dir,
 #pragma omp parallel
 #endif
     {
-        std::vector<I> nnzb(Nb, -1);
+        host_vector<I> nnzb(Nb, -1);
 
         int nthreads = 1;
         int tid      = 0;
@@ -4058,8 +4408,8 @@ void host_bsrgemm(rocsparse_direction  dir,
 
     I nnzb = bsr_row_ptr_C[Mb] - base_C;
 
-    std::vector<J> col(nnzb);
-    std::vector<T> val(block_dim * block_dim * nnzb);
+    host_vector<J> col(nnzb);
+    host_vector<T> val(block_dim * block_dim * nnzb);
 
     memcpy(col.data(), bsr_col_ind_C, sizeof(J) * nnzb);
     memcpy(val.data(), bsr_val_C, sizeof(T) * block_dim * block_dim * nnzb);
@@ -4073,7 +4423,7 @@ void host_bsrgemm(rocsparse_direction  dir,
         I row_end   = bsr_row_ptr_C[i + 1] - base_C;
         J row_nnzb  = row_end - row_begin;
 
-        std::vector<J> perm(row_nnzb);
+        host_vector<J> perm(row_nnzb);
         for(J j = 0; j < row_nnzb; ++j)
         {
             perm[j] = j;
@@ -4166,7 +4516,7 @@ void host_bsrgeam(rocsparse_direction  dir,
 #pragma omp parallel
 #endif
     {
-        std::vector<rocsparse_int> nnzb(Nb, -1);
+        host_vector<rocsparse_int> nnzb(Nb, -1);
 
 #ifdef _OPENMP
         rocsparse_int nthreads = omp_get_num_threads();
@@ -4289,8 +4639,8 @@ void host_bsrgeam(rocsparse_direction  dir,
 
     rocsparse_int nnzb = bsr_row_ptr_C[Mb] - base_C;
 
-    std::vector<rocsparse_int> col(nnzb);
-    std::vector<T>             val(block_dim * block_dim * nnzb);
+    host_vector<rocsparse_int> col(nnzb);
+    host_vector<T>             val(block_dim * block_dim * nnzb);
 
     std::copy(bsr_col_ind_C, bsr_col_ind_C + nnzb, col.begin());
     std::copy(bsr_val_C, bsr_val_C + block_dim * block_dim * nnzb, val.begin());
@@ -4304,7 +4654,7 @@ void host_bsrgeam(rocsparse_direction  dir,
         rocsparse_int row_end   = bsr_row_ptr_C[i + 1] - base_C;
         rocsparse_int row_nnzb  = row_end - row_begin;
 
-        std::vector<rocsparse_int> perm(row_nnzb);
+        host_vector<rocsparse_int> perm(row_nnzb);
         for(rocsparse_int j = 0; j < row_nnzb; ++j)
         {
             perm[j] = j;
@@ -4360,7 +4710,7 @@ void host_csrgeam_nnz(rocsparse_int        M,
 #pragma omp parallel
 #endif
     {
-        std::vector<rocsparse_int> nnz(N, -1);
+        host_vector<rocsparse_int> nnz(N, -1);
 
 #ifdef _OPENMP
         rocsparse_int nthreads = omp_get_num_threads();
@@ -4444,7 +4794,7 @@ void host_csrgeam(rocsparse_int        M,
 #pragma omp parallel
 #endif
     {
-        std::vector<rocsparse_int> nnz(N, -1);
+        host_vector<rocsparse_int> nnz(N, -1);
 
 #ifdef _OPENMP
         rocsparse_int nthreads = omp_get_num_threads();
@@ -4514,8 +4864,8 @@ void host_csrgeam(rocsparse_int        M,
 
     rocsparse_int nnz = csr_row_ptr_C[M] - base_C;
 
-    std::vector<rocsparse_int> col(nnz);
-    std::vector<T>             val(nnz);
+    host_vector<rocsparse_int> col(nnz);
+    host_vector<T>             val(nnz);
 
     std::copy(csr_col_ind_C, csr_col_ind_C + nnz, col.begin());
     std::copy(csr_val_C, csr_val_C + nnz, val.begin());
@@ -4529,7 +4879,7 @@ void host_csrgeam(rocsparse_int        M,
         rocsparse_int row_end   = csr_row_ptr_C[i + 1] - base_C;
         rocsparse_int row_nnz   = row_end - row_begin;
 
-        std::vector<rocsparse_int> perm(row_nnz);
+        host_vector<rocsparse_int> perm(row_nnz);
         for(rocsparse_int j = 0; j < row_nnz; ++j)
         {
             perm[j] = j;
@@ -4610,7 +4960,7 @@ void host_csrgemm_nnz(J                    M,
 #pragma omp parallel
 #endif
     {
-        std::vector<J> nnz(N, -1);
+        host_vector<J> nnz(N, -1);
 
         int nthreads = 1;
         int tid      = 0;
@@ -4733,7 +5083,7 @@ void host_csrgemm(J                    M,
 #pragma omp parallel
 #endif
     {
-        std::vector<I> nnz(N, -1);
+        host_vector<I> nnz(N, -1);
 
         int nthreads = 1;
         int tid      = 0;
@@ -4827,8 +5177,8 @@ void host_csrgemm(J                    M,
 
     I nnz = csr_row_ptr_C[M] - base_C;
 
-    std::vector<J> col(nnz);
-    std::vector<T> val(nnz);
+    host_vector<J> col(nnz);
+    host_vector<T> val(nnz);
 
     memcpy(col.data(), csr_col_ind_C, sizeof(J) * nnz);
     memcpy(val.data(), csr_val_C, sizeof(T) * nnz);
@@ -4842,7 +5192,7 @@ void host_csrgemm(J                    M,
         I row_end   = csr_row_ptr_C[i + 1] - base_C;
         J row_nnz   = row_end - row_begin;
 
-        std::vector<J> perm(row_nnz);
+        host_vector<J> perm(row_nnz);
         for(J j = 0; j < row_nnz; ++j)
         {
             perm[j] = j;
@@ -5158,9 +5508,9 @@ template <typename T>
 void host_bsric0(rocsparse_direction               direction,
                  rocsparse_int                     Mb,
                  rocsparse_int                     block_dim,
-                 const std::vector<rocsparse_int>& bsr_row_ptr,
-                 const std::vector<rocsparse_int>& bsr_col_ind,
-                 std::vector<T>&                   bsr_val,
+                 const host_vector<rocsparse_int>& bsr_row_ptr,
+                 const host_vector<rocsparse_int>& bsr_col_ind,
+                 host_vector<T>&                   bsr_val,
                  rocsparse_index_base              base,
                  rocsparse_int*                    struct_pivot,
                  rocsparse_int*                    numeric_pivot)
@@ -5173,9 +5523,9 @@ void host_bsric0(rocsparse_direction               direction,
     *numeric_pivot = -1;
 
     // pointer of upper part of each row
-    std::vector<rocsparse_int> diag_block_offset(Mb);
-    std::vector<rocsparse_int> diag_offset(M, -1);
-    std::vector<rocsparse_int> nnz_entries(M, -1);
+    host_vector<rocsparse_int> diag_block_offset(Mb);
+    host_vector<rocsparse_int> diag_offset(M, -1);
+    host_vector<rocsparse_int> nnz_entries(M, -1);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -5387,9 +5737,9 @@ void host_bsric0(rocsparse_direction               direction,
 template <typename T, typename U>
 void host_bsrilu0(rocsparse_direction               dir,
                   rocsparse_int                     mb,
-                  const std::vector<rocsparse_int>& bsr_row_ptr,
-                  const std::vector<rocsparse_int>& bsr_col_ind,
-                  std::vector<T>&                   bsr_val,
+                  const host_vector<rocsparse_int>& bsr_row_ptr,
+                  const host_vector<rocsparse_int>& bsr_col_ind,
+                  host_vector<T>&                   bsr_val,
                   rocsparse_int                     bsr_dim,
                   rocsparse_index_base              base,
                   rocsparse_int*                    struct_pivot,
@@ -5404,8 +5754,8 @@ void host_bsrilu0(rocsparse_direction               dir,
     *numeric_pivot = mb + 1;
 
     // Temporary vector to hold diagonal offset to access diagonal BSR block
-    std::vector<rocsparse_int> diag_offset(mb);
-    std::vector<rocsparse_int> nnz_entries(mb, -1);
+    host_vector<rocsparse_int> diag_offset(mb);
+    host_vector<rocsparse_int> nnz_entries(mb, -1);
 
     // First diagonal block is index 0
     diag_offset[0] = 0;
@@ -5600,9 +5950,9 @@ void host_bsrilu0(rocsparse_direction               dir,
 
 template <typename T>
 void host_csric0(rocsparse_int                     M,
-                 const std::vector<rocsparse_int>& csr_row_ptr,
-                 const std::vector<rocsparse_int>& csr_col_ind,
-                 std::vector<T>&                   csr_val,
+                 const host_vector<rocsparse_int>& csr_row_ptr,
+                 const host_vector<rocsparse_int>& csr_col_ind,
+                 host_vector<T>&                   csr_val,
                  rocsparse_index_base              base,
                  rocsparse_int*                    struct_pivot,
                  rocsparse_int*                    numeric_pivot)
@@ -5612,8 +5962,8 @@ void host_csric0(rocsparse_int                     M,
     *numeric_pivot = -1;
 
     // pointer of upper part of each row
-    std::vector<rocsparse_int> diag_offset(M);
-    std::vector<rocsparse_int> nnz_entries(M, 0);
+    host_vector<rocsparse_int> diag_offset(M);
+    host_vector<rocsparse_int> nnz_entries(M, 0);
 
     // ai = 0 to N loop over all rows
     for(rocsparse_int ai = 0; ai < M; ++ai)
@@ -5712,9 +6062,9 @@ void host_csric0(rocsparse_int                     M,
 
 template <typename T, typename U>
 void host_csrilu0(rocsparse_int                     M,
-                  const std::vector<rocsparse_int>& csr_row_ptr,
-                  const std::vector<rocsparse_int>& csr_col_ind,
-                  std::vector<T>&                   csr_val,
+                  const host_vector<rocsparse_int>& csr_row_ptr,
+                  const host_vector<rocsparse_int>& csr_col_ind,
+                  host_vector<T>&                   csr_val,
                   rocsparse_index_base              base,
                   rocsparse_int*                    struct_pivot,
                   rocsparse_int*                    numeric_pivot,
@@ -5727,8 +6077,8 @@ void host_csrilu0(rocsparse_int                     M,
     *numeric_pivot = -1;
 
     // pointer of upper part of each row
-    std::vector<rocsparse_int> diag_offset(M);
-    std::vector<rocsparse_int> nnz_entries(M, 0);
+    host_vector<rocsparse_int> diag_offset(M);
+    host_vector<rocsparse_int> nnz_entries(M, 0);
 
     // ai = 0 to N loop over all rows
     for(rocsparse_int ai = 0; ai < M; ++ai)
@@ -5821,10 +6171,10 @@ void host_csrilu0(rocsparse_int                     M,
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
                         rocsparse_int         n,
-                        const std::vector<T>& dl,
-                        const std::vector<T>& d,
-                        const std::vector<T>& du,
-                        std::vector<T>&       B,
+                        const host_vector<T>& dl,
+                        const host_vector<T>& d,
+                        const host_vector<T>& du,
+                        host_vector<T>&       B,
                         rocsparse_int         ldb)
 {
     //
@@ -5842,16 +6192,16 @@ void host_gtsv_no_pivot(rocsparse_int         m,
     {
         rocsparse_int stride = 1;
 
-        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> sa(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> sb(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> sc(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
 
-        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> x(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> a(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> b(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> c(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> x(BLOCKSIZE, static_cast<T>(0));
 
         for(rocsparse_int i = 0; i < m; i++)
         {
@@ -5930,10 +6280,10 @@ void host_gtsv_no_pivot(rocsparse_int         m,
 // Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
 template <typename T>
 void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
-                                      const std::vector<T>& dl,
-                                      const std::vector<T>& d,
-                                      const std::vector<T>& du,
-                                      std::vector<T>&       x,
+                                      const host_vector<T>& dl,
+                                      const host_vector<T>& d,
+                                      const host_vector<T>& du,
+                                      host_vector<T>&       x,
                                       rocsparse_int         batch_count,
                                       rocsparse_int         batch_stride)
 {
@@ -5952,16 +6302,16 @@ void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
     {
         rocsparse_int stride = 1;
 
-        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> sa(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> sb(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> sc(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
 
-        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> y(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> a(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> b(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> c(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
+        host_vector<T> y(BLOCKSIZE, static_cast<T>(0));
 
         for(rocsparse_int i = 0; i < m; i++)
         {
@@ -6046,8 +6396,8 @@ void host_gtsv_interleaved_batch_thomas(rocsparse_int m,
                                         rocsparse_int batch_count,
                                         rocsparse_int batch_stride)
 {
-    std::vector<T> c1(m * batch_count, 0);
-    std::vector<T> x1(m * batch_count, 0);
+    host_vector<T> c1(m * batch_count, 0);
+    host_vector<T> x1(m * batch_count, 0);
 
     // Forward elimination
 #ifdef _OPENMP
@@ -6111,11 +6461,11 @@ void host_gtsv_interleaved_batch_lu(rocsparse_int m,
                                     rocsparse_int batch_count,
                                     rocsparse_int batch_stride)
 {
-    std::vector<T>             l(m * batch_count, 0);
-    std::vector<T>             u0(m * batch_count, 0);
-    std::vector<T>             u1(m * batch_count, 0);
-    std::vector<T>             u2(m * batch_count, 0);
-    std::vector<rocsparse_int> p(m * batch_count, 0);
+    host_vector<T>             l(m * batch_count, 0);
+    host_vector<T>             u0(m * batch_count, 0);
+    host_vector<T>             u1(m * batch_count, 0);
+    host_vector<T>             u2(m * batch_count, 0);
+    host_vector<rocsparse_int> p(m * batch_count, 0);
 
     for(rocsparse_int i = 0; i < m; i++)
     {
@@ -6187,7 +6537,7 @@ void host_gtsv_interleaved_batch_lu(rocsparse_int m,
     }
 
     // Forward elimination (L * x_new = x_old)
-    std::vector<rocsparse_int> start(batch_count, 0);
+    host_vector<rocsparse_int> start(batch_count, 0);
     for(rocsparse_int i = 1; i < m; i++)
     {
 #ifdef _OPENMP
@@ -6246,9 +6596,9 @@ void host_gtsv_interleaved_batch_qr(rocsparse_int m,
                                     rocsparse_int batch_count,
                                     rocsparse_int batch_stride)
 {
-    std::vector<T> r0(m * batch_count, 0);
-    std::vector<T> r1(m * batch_count, 0);
-    std::vector<T> r2(m * batch_count, 0);
+    host_vector<T> r0(m * batch_count, 0);
+    host_vector<T> r1(m * batch_count, 0);
+    host_vector<T> r2(m * batch_count, 0);
 
     for(rocsparse_int i = 0; i < m; i++)
     {
@@ -6384,8 +6734,8 @@ void host_gpsv_interleaved_batch_qr(rocsparse_int m,
                                     rocsparse_int batch_count,
                                     rocsparse_int batch_stride)
 {
-    std::vector<T> r3(m * batch_count, 0);
-    std::vector<T> r4(m * batch_count, 0);
+    host_vector<T> r3(m * batch_count, 0);
+    host_vector<T> r4(m * batch_count, 0);
 
     // Reduce A = Q*R where Q is orthonormal and R is upper triangular
     // This means when solving A * x          = b
@@ -6663,14 +7013,14 @@ rocsparse_status host_nnz(rocsparse_direction dirA,
 template <typename T>
 void host_prune_dense2csr(rocsparse_int               m,
                           rocsparse_int               n,
-                          const std::vector<T>&       A,
+                          const host_vector<T>&       A,
                           rocsparse_int               lda,
                           rocsparse_index_base        base,
                           T                           threshold,
                           rocsparse_int&              nnz,
-                          std::vector<T>&             csr_val,
-                          std::vector<rocsparse_int>& csr_row_ptr,
-                          std::vector<rocsparse_int>& csr_col_ind)
+                          host_vector<T>&             csr_val,
+                          host_vector<rocsparse_int>& csr_row_ptr,
+                          host_vector<rocsparse_int>& csr_col_ind)
 {
     csr_row_ptr.resize(m + 1, 0);
     csr_row_ptr[0] = base;
@@ -6718,21 +7068,21 @@ void host_prune_dense2csr(rocsparse_int               m,
 template <typename T>
 void host_prune_dense2csr_by_percentage(rocsparse_int               m,
                                         rocsparse_int               n,
-                                        const std::vector<T>&       A,
+                                        const host_vector<T>&       A,
                                         rocsparse_int               lda,
                                         rocsparse_index_base        base,
                                         T                           percentage,
                                         rocsparse_int&              nnz,
-                                        std::vector<T>&             csr_val,
-                                        std::vector<rocsparse_int>& csr_row_ptr,
-                                        std::vector<rocsparse_int>& csr_col_ind)
+                                        host_vector<T>&             csr_val,
+                                        host_vector<rocsparse_int>& csr_row_ptr,
+                                        host_vector<rocsparse_int>& csr_col_ind)
 {
     rocsparse_int nnz_A = m * n;
     rocsparse_int pos   = std::ceil(nnz_A * (percentage / 100)) - 1;
     pos                 = std::min(pos, nnz_A - 1);
     pos                 = std::max(pos, 0);
 
-    std::vector<T> sorted_A(m * n);
+    host_vector<T> sorted_A(m * n);
     for(rocsparse_int i = 0; i < n; i++)
     {
         for(rocsparse_int j = 0; j < m; j++)
@@ -6917,13 +7267,13 @@ template <typename I, typename T>
 void host_dense_to_coo(I                     m,
                        I                     n,
                        rocsparse_index_base  base,
-                       const std::vector<T>& A,
+                       const host_vector<T>& A,
                        I                     ld,
                        rocsparse_order       order,
-                       const std::vector<I>& nnz_per_row,
-                       std::vector<T>&       coo_val,
-                       std::vector<I>&       coo_row_ind,
-                       std::vector<I>&       coo_col_ind)
+                       const host_vector<I>& nnz_per_row,
+                       host_vector<T>&       coo_val,
+                       host_vector<I>&       coo_row_ind,
+                       host_vector<I>&       coo_col_ind)
 {
     // Find number of non-zeros in dense matrix
     int nnz = 0;
@@ -6973,10 +7323,10 @@ void host_coo_to_dense(I                     m,
                        I                     n,
                        I                     nnz,
                        rocsparse_index_base  base,
-                       const std::vector<T>& coo_val,
-                       const std::vector<I>& coo_row_ind,
-                       const std::vector<I>& coo_col_ind,
-                       std::vector<T>&       A,
+                       const host_vector<T>& coo_val,
+                       const host_vector<I>& coo_row_ind,
+                       const host_vector<I>& coo_col_ind,
+                       host_vector<T>&       A,
                        I                     ld,
                        rocsparse_order       order)
 {
@@ -7029,9 +7379,9 @@ void host_csr_to_csc(J                    M,
                      const I*             csr_row_ptr,
                      const J*             csr_col_ind,
                      const T*             csr_val,
-                     std::vector<J>&      csc_row_ind,
-                     std::vector<I>&      csc_col_ptr,
-                     std::vector<T>&      csc_val,
+                     host_vector<J>&      csc_row_ind,
+                     host_vector<I>&      csc_col_ptr,
+                     host_vector<T>&      csc_val,
                      rocsparse_action     action,
                      rocsparse_index_base base)
 {
@@ -7083,14 +7433,14 @@ void host_bsr_to_csr(rocsparse_direction               direction,
                      rocsparse_int                     mb,
                      rocsparse_int                     nb,
                      rocsparse_int                     nnzb,
-                     const std::vector<T>&             bsr_val,
-                     const std::vector<rocsparse_int>& bsr_row_ptr,
-                     const std::vector<rocsparse_int>& bsr_col_ind,
+                     const host_vector<T>&             bsr_val,
+                     const host_vector<rocsparse_int>& bsr_row_ptr,
+                     const host_vector<rocsparse_int>& bsr_col_ind,
                      rocsparse_int                     block_dim,
                      rocsparse_index_base              bsr_base,
-                     std::vector<T>&                   csr_val,
-                     std::vector<rocsparse_int>&       csr_row_ptr,
-                     std::vector<rocsparse_int>&       csr_col_ind,
+                     host_vector<T>&                   csr_val,
+                     host_vector<rocsparse_int>&       csr_row_ptr,
+                     host_vector<rocsparse_int>&       csr_col_ind,
                      rocsparse_index_base              csr_base)
 {
     return host_gebsr_to_csr(direction,
@@ -7114,14 +7464,14 @@ void host_csr_to_bsr(rocsparse_direction               direction,
                      rocsparse_int                     m,
                      rocsparse_int                     n,
                      rocsparse_int                     nnz,
-                     const std::vector<T>&             csr_val,
-                     const std::vector<rocsparse_int>& csr_row_ptr,
-                     const std::vector<rocsparse_int>& csr_col_ind,
+                     const host_vector<T>&             csr_val,
+                     const host_vector<rocsparse_int>& csr_row_ptr,
+                     const host_vector<rocsparse_int>& csr_col_ind,
                      rocsparse_int                     block_dim,
                      rocsparse_index_base              csr_base,
-                     std::vector<T>&                   bsr_val,
-                     std::vector<rocsparse_int>&       bsr_row_ptr,
-                     std::vector<rocsparse_int>&       bsr_col_ind,
+                     host_vector<T>&                   bsr_val,
+                     host_vector<rocsparse_int>&       bsr_row_ptr,
+                     host_vector<rocsparse_int>&       bsr_col_ind,
                      rocsparse_index_base              bsr_base)
 {
     return host_csr_to_gebsr(direction,
@@ -7145,22 +7495,22 @@ void host_csr_to_gebsr(rocsparse_direction               direction,
                        rocsparse_int                     m,
                        rocsparse_int                     n,
                        rocsparse_int                     nnz,
-                       const std::vector<T>&             csr_val,
-                       const std::vector<rocsparse_int>& csr_row_ptr,
-                       const std::vector<rocsparse_int>& csr_col_ind,
+                       const host_vector<T>&             csr_val,
+                       const host_vector<rocsparse_int>& csr_row_ptr,
+                       const host_vector<rocsparse_int>& csr_col_ind,
                        rocsparse_int                     row_block_dim,
                        rocsparse_int                     col_block_dim,
                        rocsparse_index_base              csr_base,
-                       std::vector<T>&                   bsr_val,
-                       std::vector<rocsparse_int>&       bsr_row_ptr,
-                       std::vector<rocsparse_int>&       bsr_col_ind,
+                       host_vector<T>&                   bsr_val,
+                       host_vector<rocsparse_int>&       bsr_row_ptr,
+                       host_vector<rocsparse_int>&       bsr_col_ind,
                        rocsparse_index_base              bsr_base)
 {
     rocsparse_int mb = (m + row_block_dim - 1) / row_block_dim;
 
     bsr_row_ptr.resize(mb + 1, 0);
 
-    std::vector<rocsparse_int> temp(nnz);
+    host_vector<rocsparse_int> temp(nnz);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -7300,14 +7650,14 @@ template <typename T>
 void host_gebsr_to_gebsc(rocsparse_int                     Mb,
                          rocsparse_int                     Nb,
                          rocsparse_int                     nnzb,
-                         const std::vector<rocsparse_int>& bsr_row_ptr,
-                         const std::vector<rocsparse_int>& bsr_col_ind,
-                         const std::vector<T>&             bsr_val,
+                         const host_vector<rocsparse_int>& bsr_row_ptr,
+                         const host_vector<rocsparse_int>& bsr_col_ind,
+                         const host_vector<T>&             bsr_val,
                          rocsparse_int                     row_block_dim,
                          rocsparse_int                     col_block_dim,
-                         std::vector<rocsparse_int>&       bsc_row_ind,
-                         std::vector<rocsparse_int>&       bsc_col_ptr,
-                         std::vector<T>&                   bsc_val,
+                         host_vector<rocsparse_int>&       bsc_row_ind,
+                         host_vector<rocsparse_int>&       bsc_col_ptr,
+                         host_vector<T>&                   bsc_val,
                          rocsparse_action                  action,
                          rocsparse_index_base              base)
 {
@@ -7366,15 +7716,15 @@ void host_gebsr_to_csr(rocsparse_direction               direction,
                        rocsparse_int                     mb,
                        rocsparse_int                     nb,
                        rocsparse_int                     nnzb,
-                       const std::vector<T>&             bsr_val,
-                       const std::vector<rocsparse_int>& bsr_row_ptr,
-                       const std::vector<rocsparse_int>& bsr_col_ind,
+                       const host_vector<T>&             bsr_val,
+                       const host_vector<rocsparse_int>& bsr_row_ptr,
+                       const host_vector<rocsparse_int>& bsr_col_ind,
                        rocsparse_int                     row_block_dim,
                        rocsparse_int                     col_block_dim,
                        rocsparse_index_base              bsr_base,
-                       std::vector<T>&                   csr_val,
-                       std::vector<rocsparse_int>&       csr_row_ptr,
-                       std::vector<rocsparse_int>&       csr_col_ind,
+                       host_vector<T>&                   csr_val,
+                       host_vector<rocsparse_int>&       csr_row_ptr,
+                       host_vector<rocsparse_int>&       csr_col_ind,
                        rocsparse_index_base              csr_base)
 {
     rocsparse_int m   = mb * row_block_dim;
@@ -7447,15 +7797,15 @@ void host_gebsr_to_gebsr(rocsparse_direction               direction,
                          rocsparse_int                     mb,
                          rocsparse_int                     nb,
                          rocsparse_int                     nnzb,
-                         const std::vector<T>&             bsr_val_A,
-                         const std::vector<rocsparse_int>& bsr_row_ptr_A,
-                         const std::vector<rocsparse_int>& bsr_col_ind_A,
+                         const host_vector<T>&             bsr_val_A,
+                         const host_vector<rocsparse_int>& bsr_row_ptr_A,
+                         const host_vector<rocsparse_int>& bsr_col_ind_A,
                          rocsparse_int                     row_block_dim_A,
                          rocsparse_int                     col_block_dim_A,
                          rocsparse_index_base              base_A,
-                         std::vector<T>&                   bsr_val_C,
-                         std::vector<rocsparse_int>&       bsr_row_ptr_C,
-                         std::vector<rocsparse_int>&       bsr_col_ind_C,
+                         host_vector<T>&                   bsr_val_C,
+                         host_vector<rocsparse_int>&       bsr_row_ptr_C,
+                         host_vector<rocsparse_int>&       bsr_col_ind_C,
                          rocsparse_int                     row_block_dim_C,
                          rocsparse_int                     col_block_dim_C,
                          rocsparse_index_base              base_C)
@@ -7464,9 +7814,9 @@ void host_gebsr_to_gebsr(rocsparse_direction               direction,
     rocsparse_int n = nb * col_block_dim_A;
 
     // convert GEBSR to CSR format
-    std::vector<rocsparse_int> csr_row_ptr;
-    std::vector<rocsparse_int> csr_col_ind;
-    std::vector<T>             csr_val;
+    host_vector<rocsparse_int> csr_row_ptr;
+    host_vector<rocsparse_int> csr_col_ind;
+    host_vector<T>             csr_val;
 
     host_gebsr_to_csr(direction,
                       mb,
@@ -7510,9 +7860,9 @@ void host_bsr_to_bsc(rocsparse_int               mb,
                      const rocsparse_int*        bsr_row_ptr,
                      const rocsparse_int*        bsr_col_ind,
                      const T*                    bsr_val,
-                     std::vector<rocsparse_int>& bsc_row_ind,
-                     std::vector<rocsparse_int>& bsc_col_ptr,
-                     std::vector<T>&             bsc_val,
+                     host_vector<rocsparse_int>& bsc_row_ind,
+                     host_vector<rocsparse_int>& bsc_col_ptr,
+                     host_vector<T>&             bsc_val,
                      rocsparse_index_base        bsr_base,
                      rocsparse_index_base        bsc_base)
 {
@@ -7570,16 +7920,16 @@ void host_bsr_to_bsc(rocsparse_int               mb,
 template <typename T>
 void host_csr_to_hyb(rocsparse_int                     M,
                      rocsparse_int                     nnz,
-                     const std::vector<rocsparse_int>& csr_row_ptr,
-                     const std::vector<rocsparse_int>& csr_col_ind,
-                     const std::vector<T>&             csr_val,
-                     std::vector<rocsparse_int>&       ell_col_ind,
-                     std::vector<T>&                   ell_val,
+                     const host_vector<rocsparse_int>& csr_row_ptr,
+                     const host_vector<rocsparse_int>& csr_col_ind,
+                     const host_vector<T>&             csr_val,
+                     host_vector<rocsparse_int>&       ell_col_ind,
+                     host_vector<T>&                   ell_val,
                      rocsparse_int&                    ell_width,
                      rocsparse_int&                    ell_nnz,
-                     std::vector<rocsparse_int>&       coo_row_ind,
-                     std::vector<rocsparse_int>&       coo_col_ind,
-                     std::vector<T>&                   coo_val,
+                     host_vector<rocsparse_int>&       coo_row_ind,
+                     host_vector<rocsparse_int>&       coo_col_ind,
+                     host_vector<T>&                   coo_val,
                      rocsparse_int&                    coo_nnz,
                      rocsparse_hyb_partition           part,
                      rocsparse_index_base              base)
@@ -7673,12 +8023,12 @@ template <typename T>
 void host_csr_to_csr_compress(rocsparse_int                     M,
                               rocsparse_int                     N,
                               rocsparse_int                     nnz,
-                              const std::vector<rocsparse_int>& csr_row_ptr_A,
-                              const std::vector<rocsparse_int>& csr_col_ind_A,
-                              const std::vector<T>&             csr_val_A,
-                              std::vector<rocsparse_int>&       csr_row_ptr_C,
-                              std::vector<rocsparse_int>&       csr_col_ind_C,
-                              std::vector<T>&                   csr_val_C,
+                              const host_vector<rocsparse_int>& csr_row_ptr_A,
+                              const host_vector<rocsparse_int>& csr_col_ind_A,
+                              const host_vector<T>&             csr_val_A,
+                              host_vector<rocsparse_int>&       csr_row_ptr_C,
+                              host_vector<rocsparse_int>&       csr_col_ind_C,
+                              host_vector<T>&                   csr_val_C,
                               rocsparse_index_base              base,
                               T                                 tol)
 {
@@ -7688,7 +8038,7 @@ void host_csr_to_csr_compress(rocsparse_int                     M,
     }
 
     // find how many entries will be in each compressed CSR matrix row
-    std::vector<rocsparse_int> nnz_per_row(M);
+    host_vector<rocsparse_int> nnz_per_row(M);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -7758,13 +8108,13 @@ template <typename T>
 void host_prune_csr_to_csr(rocsparse_int                     M,
                            rocsparse_int                     N,
                            rocsparse_int                     nnz_A,
-                           const std::vector<rocsparse_int>& csr_row_ptr_A,
-                           const std::vector<rocsparse_int>& csr_col_ind_A,
-                           const std::vector<T>&             csr_val_A,
+                           const host_vector<rocsparse_int>& csr_row_ptr_A,
+                           const host_vector<rocsparse_int>& csr_col_ind_A,
+                           const host_vector<T>&             csr_val_A,
                            rocsparse_int&                    nnz_C,
-                           std::vector<rocsparse_int>&       csr_row_ptr_C,
-                           std::vector<rocsparse_int>&       csr_col_ind_C,
-                           std::vector<T>&                   csr_val_C,
+                           host_vector<rocsparse_int>&       csr_row_ptr_C,
+                           host_vector<rocsparse_int>&       csr_col_ind_C,
+                           host_vector<T>&                   csr_val_C,
                            rocsparse_index_base              csr_base_A,
                            rocsparse_index_base              csr_base_C,
                            T                                 threshold)
@@ -7820,13 +8170,13 @@ template <typename T>
 void host_prune_csr_to_csr_by_percentage(rocsparse_int                     M,
                                          rocsparse_int                     N,
                                          rocsparse_int                     nnz_A,
-                                         const std::vector<rocsparse_int>& csr_row_ptr_A,
-                                         const std::vector<rocsparse_int>& csr_col_ind_A,
-                                         const std::vector<T>&             csr_val_A,
+                                         const host_vector<rocsparse_int>& csr_row_ptr_A,
+                                         const host_vector<rocsparse_int>& csr_col_ind_A,
+                                         const host_vector<T>&             csr_val_A,
                                          rocsparse_int&                    nnz_C,
-                                         std::vector<rocsparse_int>&       csr_row_ptr_C,
-                                         std::vector<rocsparse_int>&       csr_col_ind_C,
-                                         std::vector<T>&                   csr_val_C,
+                                         host_vector<rocsparse_int>&       csr_row_ptr_C,
+                                         host_vector<rocsparse_int>&       csr_col_ind_C,
+                                         host_vector<T>&                   csr_val_C,
                                          rocsparse_index_base              csr_base_A,
                                          rocsparse_index_base              csr_base_C,
                                          T                                 percentage)
@@ -7835,7 +8185,7 @@ void host_prune_csr_to_csr_by_percentage(rocsparse_int                     M,
     pos               = std::min(pos, nnz_A - 1);
     pos               = std::max(pos, 0);
 
-    std::vector<T> sorted_A(nnz_A);
+    host_vector<T> sorted_A(nnz_A);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -7867,12 +8217,12 @@ void host_prune_csr_to_csr_by_percentage(rocsparse_int                     M,
 template <typename T>
 void host_ell_to_csr(rocsparse_int                     M,
                      rocsparse_int                     N,
-                     const std::vector<rocsparse_int>& ell_col_ind,
-                     const std::vector<T>&             ell_val,
+                     const host_vector<rocsparse_int>& ell_col_ind,
+                     const host_vector<T>&             ell_val,
                      rocsparse_int                     ell_width,
-                     std::vector<rocsparse_int>&       csr_row_ptr,
-                     std::vector<rocsparse_int>&       csr_col_ind,
-                     std::vector<T>&                   csr_val,
+                     host_vector<rocsparse_int>&       csr_row_ptr,
+                     host_vector<rocsparse_int>&       csr_col_ind,
+                     host_vector<T>&                   csr_val,
                      rocsparse_int&                    csr_nnz,
                      rocsparse_index_base              ell_base,
                      rocsparse_index_base              csr_base)
@@ -7939,21 +8289,21 @@ void host_ell_to_csr(rocsparse_int                     M,
 template <typename T>
 void host_coosort_by_column(rocsparse_int               M,
                             rocsparse_int               nnz,
-                            std::vector<rocsparse_int>& coo_row_ind,
-                            std::vector<rocsparse_int>& coo_col_ind,
-                            std::vector<T>&             coo_val)
+                            host_vector<rocsparse_int>& coo_row_ind,
+                            host_vector<rocsparse_int>& coo_col_ind,
+                            host_vector<T>&             coo_val)
 {
     // Permutation vector
-    std::vector<rocsparse_int> perm(nnz);
+    host_vector<rocsparse_int> perm(nnz);
 
     for(rocsparse_int i = 0; i < nnz; ++i)
     {
         perm[i] = i;
     }
 
-    std::vector<rocsparse_int> tmp_row(nnz);
-    std::vector<rocsparse_int> tmp_col(nnz);
-    std::vector<T>             tmp_val(nnz);
+    host_vector<rocsparse_int> tmp_row(nnz);
+    host_vector<rocsparse_int> tmp_col(nnz);
+    host_vector<T>             tmp_val(nnz);
 
     tmp_row = coo_row_ind;
     tmp_col = coo_col_ind;
@@ -8269,17 +8619,17 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
     template void             host_bsric0<TYPE>(rocsparse_direction               direction,                  \
                                     rocsparse_int                     Mb,                         \
                                     rocsparse_int                     block_dim,                  \
-                                    const std::vector<rocsparse_int>& bsr_row_ptr,                \
-                                    const std::vector<rocsparse_int>& bsr_col_ind,                \
-                                    std::vector<TYPE>&                bsr_val,                    \
+                                    const host_vector<rocsparse_int>& bsr_row_ptr,                \
+                                    const host_vector<rocsparse_int>& bsr_col_ind,                \
+                                    host_vector<TYPE>&                bsr_val,                    \
                                     rocsparse_index_base              base,                       \
                                     rocsparse_int*                    struct_pivot,               \
                                     rocsparse_int*                    numeric_pivot);                                \
     template void             host_bsrilu0<TYPE>(rocsparse_direction               dir,                       \
                                      rocsparse_int                     mb,                        \
-                                     const std::vector<rocsparse_int>& bsr_row_ptr,               \
-                                     const std::vector<rocsparse_int>& bsr_col_ind,               \
-                                     std::vector<TYPE>&                bsr_val,                   \
+                                     const host_vector<rocsparse_int>& bsr_row_ptr,               \
+                                     const host_vector<rocsparse_int>& bsr_col_ind,               \
+                                     host_vector<TYPE>&                bsr_val,                   \
                                      rocsparse_int                     bsr_dim,                   \
                                      rocsparse_index_base              base,                      \
                                      rocsparse_int*                    struct_pivot,              \
@@ -8288,16 +8638,16 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                      floating_data_t<TYPE>             boost_tol,                 \
                                      TYPE                              boost_val);                                             \
     template void             host_csric0<TYPE>(rocsparse_int                     M,                          \
-                                    const std::vector<rocsparse_int>& csr_row_ptr,                \
-                                    const std::vector<rocsparse_int>& csr_col_ind,                \
-                                    std::vector<TYPE>&                csr_val,                    \
+                                    const host_vector<rocsparse_int>& csr_row_ptr,                \
+                                    const host_vector<rocsparse_int>& csr_col_ind,                \
+                                    host_vector<TYPE>&                csr_val,                    \
                                     rocsparse_index_base              base,                       \
                                     rocsparse_int*                    struct_pivot,               \
                                     rocsparse_int*                    numeric_pivot);                                \
     template void             host_csrilu0<TYPE>(rocsparse_int                     M,                         \
-                                     const std::vector<rocsparse_int>& csr_row_ptr,               \
-                                     const std::vector<rocsparse_int>& csr_col_ind,               \
-                                     std::vector<TYPE>&                csr_val,                   \
+                                     const host_vector<rocsparse_int>& csr_row_ptr,               \
+                                     const host_vector<rocsparse_int>& csr_col_ind,               \
+                                     host_vector<TYPE>&                csr_val,                   \
                                      rocsparse_index_base              base,                      \
                                      rocsparse_int*                    struct_pivot,              \
                                      rocsparse_int*                    numeric_pivot,             \
@@ -8306,16 +8656,16 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                      TYPE                              boost_val);                                             \
     template void             host_gtsv_no_pivot<TYPE>(rocsparse_int            m,                            \
                                            rocsparse_int            n,                            \
-                                           const std::vector<TYPE>& dl,                           \
-                                           const std::vector<TYPE>& d,                            \
-                                           const std::vector<TYPE>& du,                           \
-                                           std::vector<TYPE>&       B,                            \
+                                           const host_vector<TYPE>& dl,                           \
+                                           const host_vector<TYPE>& d,                            \
+                                           const host_vector<TYPE>& du,                           \
+                                           host_vector<TYPE>&       B,                            \
                                            rocsparse_int            ldb);                                    \
     template void             host_gtsv_no_pivot_strided_batch<TYPE>(rocsparse_int            m,              \
-                                                         const std::vector<TYPE>& dl,             \
-                                                         const std::vector<TYPE>& d,              \
-                                                         const std::vector<TYPE>& du,             \
-                                                         std::vector<TYPE>&       x,              \
+                                                         const host_vector<TYPE>& dl,             \
+                                                         const host_vector<TYPE>& d,              \
+                                                         const host_vector<TYPE>& du,             \
+                                                         host_vector<TYPE>&       x,              \
                                                          rocsparse_int            batch_count,    \
                                                          rocsparse_int            batch_stride);             \
     template void             host_gtsv_interleaved_batch<TYPE>(rocsparse_gtsv_interleaved_alg algo,          \
@@ -8347,82 +8697,82 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                         rocsparse_int                     mb,                     \
                                         rocsparse_int                     nb,                     \
                                         rocsparse_int                     nnzb,                   \
-                                        const std::vector<TYPE>&          bsr_val,                \
-                                        const std::vector<rocsparse_int>& bsr_row_ptr,            \
-                                        const std::vector<rocsparse_int>& bsr_col_ind,            \
+                                        const host_vector<TYPE>&          bsr_val,                \
+                                        const host_vector<rocsparse_int>& bsr_row_ptr,            \
+                                        const host_vector<rocsparse_int>& bsr_col_ind,            \
                                         rocsparse_int                     block_dim,              \
                                         rocsparse_index_base              bsr_base,               \
-                                        std::vector<TYPE>&                csr_val,                \
-                                        std::vector<rocsparse_int>&       csr_row_ptr,            \
-                                        std::vector<rocsparse_int>&       csr_col_ind,            \
+                                        host_vector<TYPE>&                csr_val,                \
+                                        host_vector<rocsparse_int>&       csr_row_ptr,            \
+                                        host_vector<rocsparse_int>&       csr_col_ind,            \
                                         rocsparse_index_base              csr_base);                           \
     template void             host_csr_to_bsr<TYPE>(rocsparse_direction               direction,              \
                                         rocsparse_int                     m,                      \
                                         rocsparse_int                     n,                      \
                                         rocsparse_int                     nnz,                    \
-                                        const std::vector<TYPE>&          csr_val,                \
-                                        const std::vector<rocsparse_int>& csr_row_ptr,            \
-                                        const std::vector<rocsparse_int>& csr_col_ind,            \
+                                        const host_vector<TYPE>&          csr_val,                \
+                                        const host_vector<rocsparse_int>& csr_row_ptr,            \
+                                        const host_vector<rocsparse_int>& csr_col_ind,            \
                                         rocsparse_int                     block_dim,              \
                                         rocsparse_index_base              csr_base,               \
-                                        std::vector<TYPE>&                bsr_val,                \
-                                        std::vector<rocsparse_int>&       bsr_row_ptr,            \
-                                        std::vector<rocsparse_int>&       bsr_col_ind,            \
+                                        host_vector<TYPE>&                bsr_val,                \
+                                        host_vector<rocsparse_int>&       bsr_row_ptr,            \
+                                        host_vector<rocsparse_int>&       bsr_col_ind,            \
                                         rocsparse_index_base              bsr_base);                           \
     template void             host_csr_to_gebsr<TYPE>(rocsparse_direction               direction,            \
                                           rocsparse_int                     m,                    \
                                           rocsparse_int                     n,                    \
                                           rocsparse_int                     nnz,                  \
-                                          const std::vector<TYPE>&          csr_val,              \
-                                          const std::vector<rocsparse_int>& csr_row_ptr,          \
-                                          const std::vector<rocsparse_int>& csr_col_ind,          \
+                                          const host_vector<TYPE>&          csr_val,              \
+                                          const host_vector<rocsparse_int>& csr_row_ptr,          \
+                                          const host_vector<rocsparse_int>& csr_col_ind,          \
                                           rocsparse_int                     row_block_dim,        \
                                           rocsparse_int                     col_block_dim,        \
                                           rocsparse_index_base              csr_base,             \
-                                          std::vector<TYPE>&                bsr_val,              \
-                                          std::vector<rocsparse_int>&       bsr_row_ptr,          \
-                                          std::vector<rocsparse_int>&       bsr_col_ind,          \
+                                          host_vector<TYPE>&                bsr_val,              \
+                                          host_vector<rocsparse_int>&       bsr_row_ptr,          \
+                                          host_vector<rocsparse_int>&       bsr_col_ind,          \
                                           rocsparse_index_base              bsr_base);                         \
     template void             host_gebsr_to_gebsc<TYPE>(rocsparse_int                     Mb,                 \
                                             rocsparse_int                     Nb,                 \
                                             rocsparse_int                     nnzb,               \
-                                            const std::vector<rocsparse_int>& bsr_row_ptr,        \
-                                            const std::vector<rocsparse_int>& bsr_col_ind,        \
-                                            const std::vector<TYPE>&          bsr_val,            \
+                                            const host_vector<rocsparse_int>& bsr_row_ptr,        \
+                                            const host_vector<rocsparse_int>& bsr_col_ind,        \
+                                            const host_vector<TYPE>&          bsr_val,            \
                                             rocsparse_int                     row_block_dim,      \
                                             rocsparse_int                     col_block_dim,      \
-                                            std::vector<rocsparse_int>&       bsc_row_ind,        \
-                                            std::vector<rocsparse_int>&       bsc_col_ptr,        \
-                                            std::vector<TYPE>&                bsc_val,            \
+                                            host_vector<rocsparse_int>&       bsc_row_ind,        \
+                                            host_vector<rocsparse_int>&       bsc_col_ptr,        \
+                                            host_vector<TYPE>&                bsc_val,            \
                                             rocsparse_action                  action,             \
                                             rocsparse_index_base              base);                           \
     template void             host_gebsr_to_csr<TYPE>(rocsparse_direction               direction,            \
                                           rocsparse_int                     mb,                   \
                                           rocsparse_int                     nb,                   \
                                           rocsparse_int                     nnzb,                 \
-                                          const std::vector<TYPE>&          bsr_val,              \
-                                          const std::vector<rocsparse_int>& bsr_row_ptr,          \
-                                          const std::vector<rocsparse_int>& bsr_col_ind,          \
+                                          const host_vector<TYPE>&          bsr_val,              \
+                                          const host_vector<rocsparse_int>& bsr_row_ptr,          \
+                                          const host_vector<rocsparse_int>& bsr_col_ind,          \
                                           rocsparse_int                     row_block_dim,        \
                                           rocsparse_int                     col_block_dim,        \
                                           rocsparse_index_base              bsr_base,             \
-                                          std::vector<TYPE>&                csr_val,              \
-                                          std::vector<rocsparse_int>&       csr_row_ptr,          \
-                                          std::vector<rocsparse_int>&       csr_col_ind,          \
+                                          host_vector<TYPE>&                csr_val,              \
+                                          host_vector<rocsparse_int>&       csr_row_ptr,          \
+                                          host_vector<rocsparse_int>&       csr_col_ind,          \
                                           rocsparse_index_base              csr_base);                         \
     template void             host_gebsr_to_gebsr<TYPE>(rocsparse_direction               direction,          \
                                             rocsparse_int                     mb,                 \
                                             rocsparse_int                     nb,                 \
                                             rocsparse_int                     nnzb,               \
-                                            const std::vector<TYPE>&          bsr_val_A,          \
-                                            const std::vector<rocsparse_int>& bsr_row_ptr_A,      \
-                                            const std::vector<rocsparse_int>& bsr_col_ind_A,      \
+                                            const host_vector<TYPE>&          bsr_val_A,          \
+                                            const host_vector<rocsparse_int>& bsr_row_ptr_A,      \
+                                            const host_vector<rocsparse_int>& bsr_col_ind_A,      \
                                             rocsparse_int                     row_block_dim_A,    \
                                             rocsparse_int                     col_block_dim_A,    \
                                             rocsparse_index_base              base_A,             \
-                                            std::vector<TYPE>&                bsr_val_C,          \
-                                            std::vector<rocsparse_int>&       bsr_row_ptr_C,      \
-                                            std::vector<rocsparse_int>&       bsr_col_ind_C,      \
+                                            host_vector<TYPE>&                bsr_val_C,          \
+                                            host_vector<rocsparse_int>&       bsr_row_ptr_C,      \
+                                            host_vector<rocsparse_int>&       bsr_col_ind_C,      \
                                             rocsparse_int                     row_block_dim_C,    \
                                             rocsparse_int                     col_block_dim_C,    \
                                             rocsparse_index_base              base_C);                         \
@@ -8433,65 +8783,65 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                         const rocsparse_int*        bsr_row_ptr,                  \
                                         const rocsparse_int*        bsr_col_ind,                  \
                                         const TYPE*                 bsr_val,                      \
-                                        std::vector<rocsparse_int>& bsc_row_ind,                  \
-                                        std::vector<rocsparse_int>& bsc_col_ptr,                  \
-                                        std::vector<TYPE>&          bsc_val,                      \
+                                        host_vector<rocsparse_int>& bsc_row_ind,                  \
+                                        host_vector<rocsparse_int>& bsc_col_ptr,                  \
+                                        host_vector<TYPE>&          bsc_val,                      \
                                         rocsparse_index_base        bsr_base,                     \
                                         rocsparse_index_base        bsc_base);                           \
     template void             host_csr_to_hyb<TYPE>(rocsparse_int                     M,                      \
                                         rocsparse_int                     nnz,                    \
-                                        const std::vector<rocsparse_int>& csr_row_ptr,            \
-                                        const std::vector<rocsparse_int>& csr_col_ind,            \
-                                        const std::vector<TYPE>&          csr_val,                \
-                                        std::vector<rocsparse_int>&       ell_col_ind,            \
-                                        std::vector<TYPE>&                ell_val,                \
+                                        const host_vector<rocsparse_int>& csr_row_ptr,            \
+                                        const host_vector<rocsparse_int>& csr_col_ind,            \
+                                        const host_vector<TYPE>&          csr_val,                \
+                                        host_vector<rocsparse_int>&       ell_col_ind,            \
+                                        host_vector<TYPE>&                ell_val,                \
                                         rocsparse_int&                    ell_width,              \
                                         rocsparse_int&                    ell_nnz,                \
-                                        std::vector<rocsparse_int>&       coo_row_ind,            \
-                                        std::vector<rocsparse_int>&       coo_col_ind,            \
-                                        std::vector<TYPE>&                coo_val,                \
+                                        host_vector<rocsparse_int>&       coo_row_ind,            \
+                                        host_vector<rocsparse_int>&       coo_col_ind,            \
+                                        host_vector<TYPE>&                coo_val,                \
                                         rocsparse_int&                    coo_nnz,                \
                                         rocsparse_hyb_partition           part,                   \
                                         rocsparse_index_base              base);                               \
     template void             host_csr_to_csr_compress<TYPE>(rocsparse_int                     M,             \
                                                  rocsparse_int                     N,             \
                                                  rocsparse_int                     nnz,           \
-                                                 const std::vector<rocsparse_int>& csr_row_ptr_A, \
-                                                 const std::vector<rocsparse_int>& csr_col_ind_A, \
-                                                 const std::vector<TYPE>&          csr_val_A,     \
-                                                 std::vector<rocsparse_int>&       csr_row_ptr_C, \
-                                                 std::vector<rocsparse_int>&       csr_col_ind_C, \
-                                                 std::vector<TYPE>&                csr_val_C,     \
+                                                 const host_vector<rocsparse_int>& csr_row_ptr_A, \
+                                                 const host_vector<rocsparse_int>& csr_col_ind_A, \
+                                                 const host_vector<TYPE>&          csr_val_A,     \
+                                                 host_vector<rocsparse_int>&       csr_row_ptr_C, \
+                                                 host_vector<rocsparse_int>&       csr_col_ind_C, \
+                                                 host_vector<TYPE>&                csr_val_C,     \
                                                  rocsparse_index_base              base,          \
                                                  TYPE                              tol);                                       \
     template void             host_ell_to_csr<TYPE>(rocsparse_int                     M,                      \
                                         rocsparse_int                     N,                      \
-                                        const std::vector<rocsparse_int>& ell_col_ind,            \
-                                        const std::vector<TYPE>&          ell_val,                \
+                                        const host_vector<rocsparse_int>& ell_col_ind,            \
+                                        const host_vector<TYPE>&          ell_val,                \
                                         rocsparse_int                     ell_width,              \
-                                        std::vector<rocsparse_int>&       csr_row_ptr,            \
-                                        std::vector<rocsparse_int>&       csr_col_ind,            \
-                                        std::vector<TYPE>&                csr_val,                \
+                                        host_vector<rocsparse_int>&       csr_row_ptr,            \
+                                        host_vector<rocsparse_int>&       csr_col_ind,            \
+                                        host_vector<TYPE>&                csr_val,                \
                                         rocsparse_int&                    csr_nnz,                \
                                         rocsparse_index_base              ell_base,               \
                                         rocsparse_index_base              csr_base);                           \
     template void             host_coosort_by_column<TYPE>(rocsparse_int M,                                   \
                                                rocsparse_int nnz,                                 \
-                                               std::vector<rocsparse_int> & coo_row_ind,          \
-                                               std::vector<rocsparse_int> & coo_col_ind,          \
-                                               std::vector<TYPE> & coo_val);
+                                               host_vector<rocsparse_int> & coo_row_ind,          \
+                                               host_vector<rocsparse_int> & coo_col_ind,          \
+                                               host_vector<TYPE> & coo_val);
 
 #define INSTANTIATE_T_REAL_ONLY(TYPE)                                                          \
     template void host_prune_csr_to_csr<TYPE>(rocsparse_int                     M,             \
                                               rocsparse_int                     N,             \
                                               rocsparse_int                     nnz_A,         \
-                                              const std::vector<rocsparse_int>& csr_row_ptr_A, \
-                                              const std::vector<rocsparse_int>& csr_col_ind_A, \
-                                              const std::vector<TYPE>&          csr_val_A,     \
+                                              const host_vector<rocsparse_int>& csr_row_ptr_A, \
+                                              const host_vector<rocsparse_int>& csr_col_ind_A, \
+                                              const host_vector<TYPE>&          csr_val_A,     \
                                               rocsparse_int&                    nnz_C,         \
-                                              std::vector<rocsparse_int>&       csr_row_ptr_C, \
-                                              std::vector<rocsparse_int>&       csr_col_ind_C, \
-                                              std::vector<TYPE>&                csr_val_C,     \
+                                              host_vector<rocsparse_int>&       csr_row_ptr_C, \
+                                              host_vector<rocsparse_int>&       csr_col_ind_C, \
+                                              host_vector<TYPE>&                csr_val_C,     \
                                               rocsparse_index_base              csr_base_A,    \
                                               rocsparse_index_base              csr_base_C,    \
                                               TYPE                              threshold);                                 \
@@ -8499,37 +8849,37 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
         rocsparse_int                     M,                                                   \
         rocsparse_int                     N,                                                   \
         rocsparse_int                     nnz_A,                                               \
-        const std::vector<rocsparse_int>& csr_row_ptr_A,                                       \
-        const std::vector<rocsparse_int>& csr_col_ind_A,                                       \
-        const std::vector<TYPE>&          csr_val_A,                                           \
+        const host_vector<rocsparse_int>& csr_row_ptr_A,                                       \
+        const host_vector<rocsparse_int>& csr_col_ind_A,                                       \
+        const host_vector<TYPE>&          csr_val_A,                                           \
         rocsparse_int&                    nnz_C,                                               \
-        std::vector<rocsparse_int>&       csr_row_ptr_C,                                       \
-        std::vector<rocsparse_int>&       csr_col_ind_C,                                       \
-        std::vector<TYPE>&                csr_val_C,                                           \
+        host_vector<rocsparse_int>&       csr_row_ptr_C,                                       \
+        host_vector<rocsparse_int>&       csr_col_ind_C,                                       \
+        host_vector<TYPE>&                csr_val_C,                                           \
         rocsparse_index_base              csr_base_A,                                          \
         rocsparse_index_base              csr_base_C,                                          \
         TYPE                              percentage);                                                                      \
     template void host_prune_dense2csr<TYPE>(rocsparse_int               m,                    \
                                              rocsparse_int               n,                    \
-                                             const std::vector<TYPE>&    A,                    \
+                                             const host_vector<TYPE>&    A,                    \
                                              rocsparse_int               lda,                  \
                                              rocsparse_index_base        base,                 \
                                              TYPE                        threshold,            \
                                              rocsparse_int&              nnz,                  \
-                                             std::vector<TYPE>&          csr_val,              \
-                                             std::vector<rocsparse_int>& csr_row_ptr,          \
-                                             std::vector<rocsparse_int>& csr_col_ind);         \
+                                             host_vector<TYPE>&          csr_val,              \
+                                             host_vector<rocsparse_int>& csr_row_ptr,          \
+                                             host_vector<rocsparse_int>& csr_col_ind);         \
     template void host_prune_dense2csr_by_percentage<TYPE>(                                    \
         rocsparse_int               m,                                                         \
         rocsparse_int               n,                                                         \
-        const std::vector<TYPE>&    A,                                                         \
+        const host_vector<TYPE>&    A,                                                         \
         rocsparse_int               lda,                                                       \
         rocsparse_index_base        base,                                                      \
         TYPE                        percentage,                                                \
         rocsparse_int&              nnz,                                                       \
-        std::vector<TYPE>&          csr_val,                                                   \
-        std::vector<rocsparse_int>& csr_row_ptr,                                               \
-        std::vector<rocsparse_int>& csr_col_ind);
+        host_vector<TYPE>&          csr_val,                                                   \
+        host_vector<rocsparse_int>& csr_row_ptr,                                               \
+        host_vector<rocsparse_int>& csr_col_ind);
 
 #define INSTANTIATE_IT(ITYPE, TTYPE)                                                     \
     template void host_gemvi<ITYPE, TTYPE>(ITYPE                M,                       \
@@ -8547,36 +8897,73 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                   ITYPE                     n,           \
                                                   ITYPE                     nnz,         \
                                                   rocsparse_index_base      base,        \
-                                                  const std::vector<TTYPE>& coo_val,     \
-                                                  const std::vector<ITYPE>& coo_row_ind, \
-                                                  const std::vector<ITYPE>& coo_col_ind, \
-                                                  std::vector<TTYPE>&       A,           \
+                                                  const host_vector<TTYPE>& coo_val,     \
+                                                  const host_vector<ITYPE>& coo_row_ind, \
+                                                  const host_vector<ITYPE>& coo_col_ind, \
+                                                  host_vector<TTYPE>&       A,           \
                                                   ITYPE                     ld,          \
                                                   rocsparse_order           order);                \
     template void host_dense_to_coo<ITYPE, TTYPE>(ITYPE                     m,           \
                                                   ITYPE                     n,           \
                                                   rocsparse_index_base      base,        \
-                                                  const std::vector<TTYPE>& A,           \
+                                                  const host_vector<TTYPE>& A,           \
                                                   ITYPE                     ld,          \
                                                   rocsparse_order           order,       \
-                                                  const std::vector<ITYPE>& nnz_per_row, \
-                                                  std::vector<TTYPE>&       coo_val,     \
-                                                  std::vector<ITYPE>&       coo_row_ind, \
-                                                  std::vector<ITYPE>&       coo_col_ind);      \
+                                                  const host_vector<ITYPE>& nnz_per_row, \
+                                                  host_vector<TTYPE>&       coo_val,     \
+                                                  host_vector<ITYPE>&       coo_row_ind, \
+                                                  host_vector<ITYPE>&       coo_col_ind);      \
     template void host_coosv<ITYPE, TTYPE>(rocsparse_operation       trans,              \
                                            ITYPE                     M,                  \
                                            int64_t                   nnz,                \
                                            TTYPE                     alpha,              \
-                                           const std::vector<ITYPE>& coo_row_ind,        \
-                                           const std::vector<ITYPE>& coo_col_ind,        \
-                                           const std::vector<TTYPE>& coo_val,            \
-                                           const std::vector<TTYPE>& x,                  \
-                                           std::vector<TTYPE>&       y,                  \
+                                           const host_vector<ITYPE>& coo_row_ind,        \
+                                           const host_vector<ITYPE>& coo_col_ind,        \
+                                           const host_vector<TTYPE>& coo_val,            \
+                                           const host_vector<TTYPE>& x,                  \
+                                           host_vector<TTYPE>&       y,                  \
                                            rocsparse_diag_type       diag_type,          \
                                            rocsparse_fill_mode       fill_mode,          \
                                            rocsparse_index_base      base,               \
                                            ITYPE*                    struct_pivot,       \
                                            ITYPE*                    numeric_pivot);                        \
+    template void host_coosv_batched<ITYPE, TTYPE>(rocsparse_operation  trans,            \
+                                                   ITYPE                M,                \
+                                                   int64_t              nnz,              \
+                                                   ITYPE                batch_count,      \
+                                                   TTYPE                alpha,            \
+                                                   const ITYPE*         coo_row_ind,      \
+                                                   const ITYPE*         coo_col_ind,      \
+                                                   const TTYPE*         coo_val,          \
+                                                   int64_t              val_batch_stride, \
+                                                   const TTYPE*         x,                \
+                                                   int64_t              x_batch_stride,   \
+                                                   TTYPE*               y,                \
+                                                   int64_t              y_batch_stride,   \
+                                                   rocsparse_diag_type  diag_type,        \
+                                                   rocsparse_fill_mode  fill_mode,        \
+                                                   rocsparse_index_base base,             \
+                                                   ITYPE*               struct_pivot,     \
+                                                   ITYPE*               numeric_pivot);   \
+    template void host_coosm_batched<ITYPE, TTYPE>(ITYPE                M,                \
+                                                   ITYPE                nrhs,             \
+                                                   int64_t              nnz,              \
+                                                   ITYPE                batch_count,      \
+                                                   rocsparse_operation  transA,           \
+                                                   rocsparse_operation  transB,           \
+                                                   TTYPE                alpha,            \
+                                                   const ITYPE*         coo_row_ind,      \
+                                                   const ITYPE*         coo_col_ind,      \
+                                                   const TTYPE*         coo_val,          \
+                                                   int64_t              val_batch_stride, \
+                                                   TTYPE*               B,                \
+                                                   ITYPE                ldb,              \
+                                                   int64_t              B_batch_stride,   \
+                                                   rocsparse_diag_type  diag_type,        \
+                                                   rocsparse_fill_mode  fill_mode,        \
+                                                   rocsparse_index_base base,             \
+                                                   ITYPE*               struct_pivot,     \
+                                                   ITYPE*               numeric_pivot);   \
     template void host_coomm<TTYPE, ITYPE>(ITYPE                M,                       \
                                            ITYPE                N,                       \
                                            ITYPE                K,                       \
@@ -8656,9 +9043,9 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                        const ITYPE*         csr_row_ptr,       \
                                                        const JTYPE*         csr_col_ind,       \
                                                        const TTYPE*         csr_val,           \
-                                                       std::vector<JTYPE>&  csc_row_ind,       \
-                                                       std::vector<ITYPE>&  csc_col_ptr,       \
-                                                       std::vector<TTYPE>&  csc_val,           \
+                                                       host_vector<JTYPE>&  csc_row_ind,       \
+                                                       host_vector<ITYPE>&  csc_col_ptr,       \
+                                                       host_vector<TTYPE>&  csc_val,           \
                                                        rocsparse_action     action,            \
                                                        rocsparse_index_base base);             \
     template void host_csrsv<ITYPE, JTYPE, TTYPE>(rocsparse_operation  trans,                  \
@@ -8675,6 +9062,24 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                   rocsparse_index_base base,                   \
                                                   JTYPE*               struct_pivot,           \
                                                   JTYPE*               numeric_pivot);                       \
+    template void host_csrsv_batched<ITYPE, JTYPE, TTYPE>(rocsparse_operation  trans,          \
+                                                          JTYPE                M,              \
+                                                          ITYPE                nnz,            \
+                                                          JTYPE                batch_count,    \
+                                                          TTYPE                alpha,          \
+                                                          const ITYPE*         csr_row_ptr,    \
+                                                          const JTYPE*         csr_col_ind,    \
+                                                          const TTYPE*         csr_val,        \
+                                                          int64_t              val_batch_stride, \
+                                                          const TTYPE*         x,              \
+                                                          int64_t              x_batch_stride, \
+                                                          TTYPE*               y,              \
+                                                          int64_t              y_batch_stride, \
+                                                          rocsparse_diag_type  diag_type,      \
+                                                          rocsparse_fill_mode  fill_mode,      \
+                                                          rocsparse_index_base base,           \
+                                                          JTYPE*               struct_pivot,   \
+                                                          JTYPE*               numeric_pivot); \
     template void host_csrmm<TTYPE, ITYPE, JTYPE>(JTYPE                M,                      \
                                                   JTYPE                N,                      \
                                                   JTYPE                K,                      \
@@ -8755,6 +9160,25 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                           ITYPE                batch_stride_C, \
                                                           rocsparse_order      order,          \
                                                           rocsparse_index_base base);          \
+    template void host_csrsm_batched<ITYPE, JTYPE, TTYPE>(JTYPE                M,               \
+                                                          JTYPE                nrhs,            \
+                                                          ITYPE                nnz,             \
+                                                          JTYPE                batch_count,     \
+                                                          rocsparse_operation  transA,          \
+                                                          rocsparse_operation  transB,          \
+                                                          TTYPE                alpha,           \
+                                                          const ITYPE*         csr_row_ptr,     \
+                                                          const JTYPE*         csr_col_ind,     \
+                                                          const TTYPE*         csr_val,         \
+                                                          int64_t              val_batch_stride,\
+                                                          TTYPE*               B,               \
+                                                          JTYPE                ldb,             \
+                                                          int64_t              B_batch_stride,  \
+                                                          rocsparse_diag_type  diag_type,       \
+                                                          rocsparse_fill_mode  fill_mode,       \
+                                                          rocsparse_index_base base,            \
+                                                          JTYPE*               struct_pivot,    \
+                                                          JTYPE*               numeric_pivot);  \
     template void host_csrsm<ITYPE, JTYPE, TTYPE>(JTYPE                M,                      \
                                                   JTYPE                nrhs,                   \
                                                   ITYPE                nnz,                    \
@@ -8929,7 +9353,41 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                              rocsparse_index_base  base,             \
                              rocsparse_matrix_type matrix_type,      \
                              rocsparse_spmv_alg    algo,             \
-                             bool                  force_conj)
+                             bool                  force_conj);      \
+    template void host_csrmv_strided_batched(rocsparse_operation  trans,            \
+                                             JTYPE                M,                \
+                                             JTYPE                N,                \
+                                             ITYPE                nnz,              \
+                                             JTYPE                batch_count,      \
+                                             TTYPE                alpha,            \
+                                             const ITYPE*         csr_row_ptr,      \
+                                             const JTYPE*         csr_col_ind,      \
+                                             const ATYPE*         csr_val,          \
+                                             int64_t              val_batch_stride, \
+                                             const XTYPE*         x,                \
+                                             int64_t              x_batch_stride,   \
+                                             TTYPE                beta,             \
+                                             YTYPE*               y,                \
+                                             int64_t              y_batch_stride,   \
+                                             rocsparse_index_base base);            \
+    template void host_bsrmv_strided_batched(rocsparse_direction  dir,              \
+                                             rocsparse_operation  trans,            \
+                                             JTYPE                mb,               \
+                                             JTYPE                nb,               \
+                                             ITYPE                nnzb,             \
+                                             JTYPE                batch_count,      \
+                                             TTYPE                alpha,            \
+                                             const ITYPE*         bsr_row_ptr,      \
+                                             const JTYPE*         bsr_col_ind,      \
+                                             const ATYPE*         bsr_val,          \
+                                             int64_t              val_batch_stride, \
+                                             JTYPE                bsr_dim,          \
+                                             const XTYPE*         x,                \
+                                             int64_t              x_batch_stride,   \
+                                             TTYPE                beta,             \
+                                             YTYPE*               y,                \
+                                             int64_t              y_batch_stride,   \
+                                             rocsparse_index_base base)
 
 #define INSTANTIATE_IAXYT(ITYPE, ATYPE, XTYPE, YTYPE, TTYPE)   \
     template void host_coomv(rocsparse_operation  trans,       \
@@ -8965,7 +9423,38 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                              const XTYPE*         x,           \
                              TTYPE                beta,        \
                              YTYPE*               y,           \
-                             rocsparse_index_base base);
+                             rocsparse_index_base base);       \
+    template void host_coomv_strided_batched(rocsparse_operation  trans,            \
+                                             ITYPE                M,                \
+                                             ITYPE                N,                \
+                                             int64_t              nnz,              \
+                                             ITYPE                batch_count,      \
+                                             TTYPE                alpha,            \
+                                             const ITYPE*         coo_row_ind,      \
+                                             const ITYPE*         coo_col_ind,      \
+                                             const ATYPE*         coo_val,          \
+                                             int64_t              val_batch_stride, \
+                                             const XTYPE*         x,                \
+                                             int64_t              x_batch_stride,   \
+                                             TTYPE                beta,             \
+                                             YTYPE*               y,                \
+                                             int64_t              y_batch_stride,   \
+                                             rocsparse_index_base base);            \
+    template void host_ellmv_strided_batched(rocsparse_operation  trans,            \
+                                             ITYPE                M,                \
+                                             ITYPE                N,                \
+                                             ITYPE                batch_count,      \
+                                             TTYPE                alpha,            \
+                                             const ITYPE*         ell_col_ind,      \
+                                             const ATYPE*         ell_val,          \
+                                             int64_t              val_batch_stride, \
+                                             ITYPE                ell_width,        \
+                                             const XTYPE*         x,                \
+                                             int64_t              x_batch_stride,   \
+                                             TTYPE                beta,             \
+                                             YTYPE*               y,                \
+                                             int64_t              y_batch_stride,   \
+                                             rocsparse_index_base base)
 
 INSTANTIATE_GATHER_SCATTER(int32_t, int8_t);
 INSTANTIATE_GATHER_SCATTER(int32_t, float);
@@ -0,0 +1,327 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_host_memory.hpp"
+#include "rocsparse_clients_envariables.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+
+#ifndef WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+struct rocsparse_host_memory_config
+{
+    rocsparse_host_memory_policy policy{rocsparse_host_memory_policy_default};
+    bool                         hugetlb{true};
+    std::string                  directory{};
+};
+
+static rocsparse_host_memory_config rocsparse_host_memory_parse_config(const char* env)
+{
+    rocsparse_host_memory_config config;
+    if(env == nullptr || !strcmp(env, "default"))
+    {
+        return config;
+    }
+
+#ifdef WIN32
+    std::cerr << "rocsparse_host_memory: ROCSPARSE_CLIENTS_HOST_MEMORY=" << env
+              << " is not supported on this platform, using default" << std::endl;
+    return config;
+#else
+    if(!strcmp(env, "hugepages") || !strcmp(env, "hugepages:transparent"))
+    {
+        config.policy  = rocsparse_host_memory_policy_hugepages;
+        config.hugetlb = (env[9] == '\0');
+        return config;
+    }
+
+    if(!strncmp(env, "mmap", 4) && (env[4] == '\0' || env[4] == ':'))
+    {
+        config.policy = rocsparse_host_memory_policy_mmap;
+        if(env[4] == ':' && env[5] != '\0')
+        {
+            config.directory = env + 5;
+        }
+        else
+        {
+            const char* tmpdir = getenv("TMPDIR");
+            config.directory   = (tmpdir != nullptr && tmpdir[0] != '\0') ? tmpdir : "/tmp";
+        }
+        return config;
+    }
+
+    std::cerr << "rocsparse_host_memory: invalid ROCSPARSE_CLIENTS_HOST_MEMORY=" << env
+              << ", expecting default, hugepages[:transparent] or mmap[:directory], using "
+                 "default"
+              << std::endl;
+    return config;
+#endif
+}
+
+static rocsparse_host_memory_config rocsparse_host_memory_parse_environment()
+{
+    return rocsparse_host_memory_parse_config(
+        rocsparse_clients_envariables::is_defined(rocsparse_clients_envariables::HOST_MEMORY)
+            ? rocsparse_clients_envariables::get(rocsparse_clients_envariables::HOST_MEMORY)
+            : nullptr);
+}
+
+static rocsparse_host_memory_config& rocsparse_host_memory_get_config()
+{
+    static rocsparse_host_memory_config config = rocsparse_host_memory_parse_environment();
+    return config;
+}
+
+//
+// Mappings of the hugepages and mmap policies with their lengths and backings,
+// s_host_memory_used tells whether the registry has to be searched at all.
+//
+struct rocsparse_host_memory_mapping
+{
+    size_t                        length;
+    rocsparse_host_memory_backing backing;
+};
+
+static std::mutex                                     s_host_memory_mutex;
+static std::map<void*, rocsparse_host_memory_mapping> s_host_memory_mappings;
+static std::atomic<bool>                              s_host_memory_used{false};
+
+rocsparse_host_memory_policy rocsparse_host_memory_get_policy()
+{
+    return rocsparse_host_memory_get_config().policy;
+}
+
+void rocsparse_host_memory_set_policy(const char* value)
+{
+    rocsparse_host_memory_get_config() = (value != nullptr)
+                                             ? rocsparse_host_memory_parse_config(value)
+                                             : rocsparse_host_memory_parse_environment();
+}
+
+void* rocsparse_host_memory_allocate(size_t nbytes)
+{
+    const rocsparse_host_memory_config& config = rocsparse_host_memory_get_config();
+    if(config.policy == rocsparse_host_memory_policy_default
+       || nbytes < rocsparse_host_memory_threshold)
+    {
+        return nullptr;
+    }
+
+#ifdef WIN32
+    return nullptr;
+#else
+    void*                         p       = MAP_FAILED;
+    size_t                        length  = nbytes;
+    rocsparse_host_memory_backing backing = rocsparse_host_memory_backing_none;
+    switch(config.policy)
+    {
+    case rocsparse_host_memory_policy_default:
+    {
+        return nullptr;
+    }
+
+    case rocsparse_host_memory_policy_hugepages:
+    {
+        //
+        // Reserved huge pages first, the length must be a multiple of their size.
+        //
+        length = ((nbytes - 1) / rocsparse_host_memory_threshold + 1)
+                 * rocsparse_host_memory_threshold;
+#ifdef MAP_HUGETLB
+        if(config.hugetlb)
+        {
+            p       = mmap(nullptr,
+                     length,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                     -1,
+                     0);
+            backing = rocsparse_host_memory_backing_hugetlb;
+        }
+#endif
+        //
+        // Transparent huge pages otherwise.
+        //
+        if(p == MAP_FAILED)
+        {
+            p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            backing = rocsparse_host_memory_backing_transparent;
+#ifdef MADV_HUGEPAGE
+            if(p != MAP_FAILED)
+            {
+                madvise(p, length, MADV_HUGEPAGE);
+            }
+#endif
+        }
+        break;
+    }
+
+    case rocsparse_host_memory_policy_mmap:
+    {
+        std::string path = config.directory + "/rocsparse_host_memory_XXXXXX";
+        const int   fd   = mkstemp(&path[0]);
+        if(fd < 0)
+        {
+            std::cerr << "rocsparse_host_memory_allocate: cannot create a file in "
+                      << config.directory << std::endl;
+            return nullptr;
+        }
+
+        //
+        // The file is removed with its last mapping.
+        //
+        unlink(path.c_str());
+        if(ftruncate(fd, static_cast<off_t>(nbytes)) == 0)
+        {
+            p = mmap(nullptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        backing = rocsparse_host_memory_backing_file;
+        break;
+    }
+    }
+
+    if(p == MAP_FAILED)
+    {
+        std::cerr << "rocsparse_host_memory_allocate: cannot map " << nbytes << " bytes"
+                  << std::endl;
+        return nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_host_memory_mutex);
+        s_host_memory_mappings[p] = {length, backing};
+        s_host_memory_used        = true;
+    }
+
+    rocsparse_host_memory_first_touch(p, nbytes);
+    return p;
+#endif
+}
+
+bool rocsparse_host_memory_free(void* p)
+{
+    if(p == nullptr || !s_host_memory_used)
+    {
+        return false;
+    }
+
+#ifdef WIN32
+    return false;
+#else
+    size_t length;
+    {
+        std::lock_guard<std::mutex> lock(s_host_memory_mutex);
+        auto                        it = s_host_memory_mappings.find(p);
+        if(it == s_host_memory_mappings.end())
+        {
+            return false;
+        }
+        length = it->second.length;
+        s_host_memory_mappings.erase(it);
+    }
+
+    munmap(p, length);
+    return true;
+#endif
+}
+
+rocsparse_host_memory_backing rocsparse_host_memory_get_backing(const void* p)
+{
+    if(p == nullptr || !s_host_memory_used)
+    {
+        return rocsparse_host_memory_backing_none;
+    }
+
+    //
+    // The mapping starting last at or before p.
+    //
+    std::lock_guard<std::mutex> lock(s_host_memory_mutex);
+    auto                        it = s_host_memory_mappings.upper_bound(const_cast<void*>(p));
+    if(it == s_host_memory_mappings.begin())
+    {
+        return rocsparse_host_memory_backing_none;
+    }
+
+    --it;
+    const char* begin = static_cast<const char*>(it->first);
+    return (static_cast<const char*>(p) < begin + it->second.length)
+               ? it->second.backing
+               : rocsparse_host_memory_backing_none;
+}
+
+void rocsparse_host_memory_first_touch(void* p, size_t nbytes)
+{
+    if(p == nullptr || nbytes == 0)
+    {
+        return;
+    }
+
+#ifdef WIN32
+    const uintptr_t page = 4096;
+#else
+    const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+#endif
+
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(p);
+    const uintptr_t end   = begin + nbytes;
+
+#if !defined(WIN32) && defined(MADV_HUGEPAGE)
+    if(rocsparse_host_memory_get_policy() == rocsparse_host_memory_policy_hugepages)
+    {
+        //
+        // madvise needs a page aligned range.
+        //
+        const uintptr_t first = (begin + page - 1) / page * page;
+        const uintptr_t last  = end / page * page;
+        if(last > first)
+        {
+            madvise(reinterpret_cast<void*>(first), last - first, MADV_HUGEPAGE);
+        }
+    }
+#endif
+
+    //
+    // One write per page, at the first byte of the range in the first page.
+    //
+    const int64_t npages = static_cast<int64_t>((end - 1) / page - begin / page + 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t i = 0; i < npages; ++i)
+    {
+        const uintptr_t q = (begin / page + i) * page;
+        *reinterpret_cast<volatile char*>(q < begin ? begin : q) = 0;
+    }
+}
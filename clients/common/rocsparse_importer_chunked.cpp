@@ -0,0 +1,839 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_importer_chunked.hpp"
+
+rocsparse_importer_chunked::~rocsparse_importer_chunked()
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        std::cout << "Import done." << std::endl;
+    }
+
+    if(this->m_fd >= 0)
+    {
+        rocsparse_chunked_close(this->m_fd);
+    }
+}
+
+rocsparse_importer_chunked::rocsparse_importer_chunked(const std::string& filename_)
+    : m_filename(filename_)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        std::cout << "Opening file '" << this->m_filename << "' ... " << std::endl;
+    }
+
+    this->m_fd = rocsparse_chunked_open(this->m_filename.c_str());
+    if(this->m_fd < 0)
+    {
+        std::cerr << "cannot open file '" << this->m_filename << "'" << std::endl;
+        throw rocsparse_status_internal_error;
+    }
+
+    rocsparse_status status
+        = rocsparse_chunked_read_index(this->m_fd, this->m_header, this->m_index);
+    if(status != rocsparse_status_success)
+    {
+        std::cerr << "invalid chunked file '" << this->m_filename << "'" << std::endl;
+        rocsparse_chunked_close(this->m_fd);
+        throw status;
+    }
+}
+
+//
+// Size of the values stored in a chunked file.
+//
+static size_t rocsparse_importer_chunked_datatype_size(uint32_t val_type)
+{
+    switch(val_type)
+    {
+    case rocsparse_datatype_i8_r:
+        return sizeof(int8_t);
+    case rocsparse_datatype_f32_r:
+        return sizeof(float);
+    case rocsparse_datatype_f64_r:
+        return sizeof(double);
+    case rocsparse_datatype_f32_c:
+        return sizeof(rocsparse_float_complex);
+    case rocsparse_datatype_f64_c:
+        return sizeof(rocsparse_double_complex);
+    }
+    return 0;
+}
+
+//
+// Copy values to the requested type, complex values cannot be imported into
+// real arrays.
+//
+template <typename T, typename V>
+static rocsparse_status rocsparse_importer_chunked_copy(size_t size, T* x, const V* y)
+{
+    rocsparse_importer_copy_mixed_arrays(size, x, y);
+    return rocsparse_status_success;
+}
+
+template <typename T>
+static rocsparse_status rocsparse_importer_chunked_copy(size_t size, T* x, const T* y)
+{
+    memcpy(x, y, sizeof(T) * size);
+    return rocsparse_status_success;
+}
+
+template <typename V>
+static rocsparse_status
+    rocsparse_importer_chunked_copy_complex(size_t size, rocsparse_float_complex* x, const V* y)
+{
+    rocsparse_importer_copy_mixed_arrays(size, x, y);
+    return rocsparse_status_success;
+}
+
+template <typename V>
+static rocsparse_status
+    rocsparse_importer_chunked_copy_complex(size_t size, rocsparse_double_complex* x, const V* y)
+{
+    rocsparse_importer_copy_mixed_arrays(size, x, y);
+    return rocsparse_status_success;
+}
+
+template <typename T, typename V>
+static rocsparse_status rocsparse_importer_chunked_copy_complex(size_t size, T* x, const V* y)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename T>
+static rocsparse_status
+    rocsparse_importer_chunked_values(uint32_t val_type, size_t size, T* x, const char* y)
+{
+    switch(val_type)
+    {
+    case rocsparse_datatype_i8_r:
+        return rocsparse_importer_chunked_copy(size, x, (const int8_t*)y);
+    case rocsparse_datatype_f32_r:
+        return rocsparse_importer_chunked_copy(size, x, (const float*)y);
+    case rocsparse_datatype_f64_r:
+        return rocsparse_importer_chunked_copy(size, x, (const double*)y);
+    case rocsparse_datatype_f32_c:
+        return rocsparse_importer_chunked_copy_complex(size, x, (const rocsparse_float_complex*)y);
+    case rocsparse_datatype_f64_c:
+        return rocsparse_importer_chunked_copy_complex(size, x, (const rocsparse_double_complex*)y);
+    }
+    return rocsparse_status_invalid_value;
+}
+
+//
+// Check that the chunks cover the rows (or columns) and the entries of the
+// matrix in order.
+//
+static rocsparse_status
+    rocsparse_importer_chunked_check_index(const std::vector<rocsparse_chunked_entry>& index,
+                                           uint64_t                                    L,
+                                           uint64_t                                    nnz)
+{
+    uint64_t row = 0;
+    uint64_t k   = 0;
+    for(const auto& entry : index)
+    {
+        if(entry.row_begin != row || entry.nnz_begin != k)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        row = entry.row_end;
+        k   = entry.nnz_end;
+    }
+    return (row == L && k == nnz) ? rocsparse_status_success : rocsparse_status_invalid_value;
+}
+
+//
+// Decode a chunk of a CSX or GEBSX matrix, the arrays start at the first row
+// and the first entry of the chunk and the offsets are shifted by shift.
+//
+template <typename T, typename I, typename J>
+static rocsparse_status
+    rocsparse_importer_chunked_decode_csx(const rocsparse_chunked_header& header,
+                                          const rocsparse_chunked_entry&  entry,
+                                          const std::vector<char>&        raw,
+                                          uint64_t                        shift,
+                                          I* __restrict__ ptr,
+                                          J* __restrict__ ind,
+                                          T* __restrict__ val)
+{
+    const size_t val_size   = rocsparse_importer_chunked_datatype_size(header.val_type);
+    const size_t block_size = header.row_block_dim * header.col_block_dim;
+    const size_t nnz        = entry.nnz_end - entry.nnz_begin;
+    const size_t bytes      = nnz * block_size * val_size;
+    if(raw.size() < bytes)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    rocsparse_status status
+        = rocsparse_importer_chunked_values(header.val_type, nnz * block_size, val, raw.data());
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    const char*    p     = raw.data() + bytes;
+    const char*    end   = raw.data() + raw.size();
+    const I        base  = static_cast<I>(header.base);
+    const J        jbase = static_cast<J>(header.base);
+    const uint64_t nrows = entry.row_end - entry.row_begin;
+
+    uint64_t k = entry.nnz_begin;
+    for(uint64_t row = 0; row < nrows; ++row)
+    {
+        uint64_t length;
+        p = rocsparse_chunked_get_varint(p, end, length);
+        if(p == nullptr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        ptr[row] = static_cast<I>(k - shift) + base;
+        k += length;
+    }
+
+    if(k != entry.nnz_end)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    k = 0;
+    for(uint64_t row = 0; row < nrows; ++row)
+    {
+        const uint64_t k_end
+            = (row + 1 < nrows) ? (ptr[row + 1] - base) + shift - entry.nnz_begin : nnz;
+        int64_t prev = 0;
+        for(; k < k_end; ++k)
+        {
+            uint64_t delta;
+            p = rocsparse_chunked_get_varint(p, end, delta);
+            if(p == nullptr)
+            {
+                return rocsparse_status_invalid_value;
+            }
+            prev += rocsparse_chunked_unzigzag(delta);
+            ind[k] = static_cast<J>(prev) + jbase;
+        }
+    }
+
+    return (p == end) ? rocsparse_status_success : rocsparse_status_invalid_value;
+}
+
+//
+// Offset of a row inside a chunk, from the row lengths stored after the values.
+//
+static rocsparse_status
+    rocsparse_importer_chunked_row_offset(int                             fd,
+                                          const rocsparse_chunked_header& header,
+                                          const rocsparse_chunked_entry&  entry,
+                                          uint64_t                        row,
+                                          uint64_t&                       k)
+{
+    if(row == entry.row_begin || row == entry.row_end)
+    {
+        k = (row == entry.row_begin) ? entry.nnz_begin : entry.nnz_end;
+        return rocsparse_status_success;
+    }
+
+    std::vector<char> buffer;
+    std::vector<char> raw;
+    rocsparse_status  status = rocsparse_chunked_read_chunk(fd, entry, buffer, raw);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    const size_t val_size   = rocsparse_importer_chunked_datatype_size(header.val_type);
+    const size_t block_size = header.row_block_dim * header.col_block_dim;
+    const size_t bytes      = (entry.nnz_end - entry.nnz_begin) * block_size * val_size;
+    if(raw.size() < bytes)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    const char* p   = raw.data() + bytes;
+    const char* end = raw.data() + raw.size();
+
+    k = entry.nnz_begin;
+    for(uint64_t i = entry.row_begin; i < row; ++i)
+    {
+        uint64_t length;
+        p = rocsparse_chunked_get_varint(p, end, length);
+        if(p == nullptr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        k += length;
+    }
+
+    return (k <= entry.nnz_end) ? rocsparse_status_success : rocsparse_status_invalid_value;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_chunks_csx(I* ptr, J* ind, T* val)
+{
+    const uint64_t L = (this->m_header.dir == rocsparse_direction_row) ? this->m_header.m
+                                                                       : this->m_header.n;
+
+    rocsparse_status status
+        = rocsparse_importer_chunked_check_index(this->m_index, L, this->m_header.nnz);
+    if(status != rocsparse_status_success)
+    {
+        std::cerr << "invalid index of chunked file '" << this->m_filename << "'" << std::endl;
+        return status;
+    }
+
+    if(rocsparse_importer_chunked_datatype_size(this->m_header.val_type) == 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    const size_t block_size = this->m_header.row_block_dim * this->m_header.col_block_dim;
+
+    //
+    // Chunks are read, decompressed and decoded concurrently, each of them at
+    // its own position in the arrays.
+    //
+    const int64_t                 nchunks = this->m_index.size();
+    std::vector<rocsparse_status> statuses(nchunks, rocsparse_status_success);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<char> buffer;
+        std::vector<char> raw;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int64_t chunk = 0; chunk < nchunks; ++chunk)
+        {
+            const rocsparse_chunked_entry& entry = this->m_index[chunk];
+            statuses[chunk] = rocsparse_chunked_read_chunk(this->m_fd, entry, buffer, raw);
+            if(statuses[chunk] == rocsparse_status_success)
+            {
+                statuses[chunk] = rocsparse_importer_chunked_decode_csx(
+                    this->m_header,
+                    entry,
+                    raw,
+                    0,
+                    ptr + entry.row_begin,
+                    ind + entry.nnz_begin,
+                    val + entry.nnz_begin * block_size);
+            }
+        }
+    }
+
+    for(int64_t chunk = 0; chunk < nchunks; ++chunk)
+    {
+        if(statuses[chunk] != rocsparse_status_success)
+        {
+            std::cerr << "cannot decode chunk " << chunk << " of file '" << this->m_filename << "'"
+                      << std::endl;
+            return statuses[chunk];
+        }
+    }
+
+    ptr[L] = static_cast<I>(this->m_header.nnz) + static_cast<I>(this->m_header.base);
+    return rocsparse_status_success;
+}
+
+template <typename I>
+rocsparse_status rocsparse_importer_chunked::import_sparse_coo(I*                    m,
+                                                               I*                    n,
+                                                               int64_t*              nnz,
+                                                               rocsparse_index_base* base)
+{
+    if(this->m_header.format != rocsparse_chunked_format_coo)
+    {
+        std::cerr << "file '" << this->m_filename << "' does not hold a coo matrix" << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    rocsparse_status status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.m), m[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.n), n[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.nnz), nnz[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    base[0] = static_cast<rocsparse_index_base>(this->m_header.base);
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I>
+rocsparse_status rocsparse_importer_chunked::import_sparse_coo(I* row_ind, I* col_ind, T* val)
+{
+    rocsparse_status status = rocsparse_importer_chunked_check_index(
+        this->m_index, this->m_header.nnz, this->m_header.nnz);
+    if(status != rocsparse_status_success)
+    {
+        std::cerr << "invalid index of chunked file '" << this->m_filename << "'" << std::endl;
+        return status;
+    }
+
+    const size_t val_size = rocsparse_importer_chunked_datatype_size(this->m_header.val_type);
+    if(val_size == 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    const int64_t                 nchunks = this->m_index.size();
+    const I                       base    = static_cast<I>(this->m_header.base);
+    std::vector<rocsparse_status> statuses(nchunks, rocsparse_status_success);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<char> buffer;
+        std::vector<char> raw;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int64_t chunk = 0; chunk < nchunks; ++chunk)
+        {
+            const rocsparse_chunked_entry& entry = this->m_index[chunk];
+            rocsparse_status& chunk_status       = statuses[chunk];
+
+            chunk_status = rocsparse_chunked_read_chunk(this->m_fd, entry, buffer, raw);
+            if(chunk_status != rocsparse_status_success)
+            {
+                continue;
+            }
+
+            const size_t nnz   = entry.nnz_end - entry.nnz_begin;
+            const size_t bytes = nnz * val_size;
+            if(raw.size() < bytes)
+            {
+                chunk_status = rocsparse_status_invalid_value;
+                continue;
+            }
+
+            chunk_status = rocsparse_importer_chunked_values(
+                this->m_header.val_type, nnz, val + entry.nnz_begin, raw.data());
+            if(chunk_status != rocsparse_status_success)
+            {
+                continue;
+            }
+
+            const char* p      = raw.data() + bytes;
+            const char* end    = raw.data() + raw.size();
+            int64_t     prev_i = 0;
+            int64_t     prev_j = 0;
+            for(uint64_t k = entry.nnz_begin; k < entry.nnz_end && p != nullptr; ++k)
+            {
+                uint64_t delta_i;
+                uint64_t delta_j;
+                p = rocsparse_chunked_get_varint(p, end, delta_i);
+                p = (p == nullptr) ? p : rocsparse_chunked_get_varint(p, end, delta_j);
+                if(p != nullptr)
+                {
+                    const int64_t i = prev_i + rocsparse_chunked_unzigzag(delta_i);
+                    if(i != prev_i)
+                    {
+                        prev_j = 0;
+                    }
+                    prev_i     = i;
+                    prev_j     = prev_j + rocsparse_chunked_unzigzag(delta_j);
+                    row_ind[k] = static_cast<I>(prev_i) + base;
+                    col_ind[k] = static_cast<I>(prev_j) + base;
+                }
+            }
+
+            if(p != end)
+            {
+                chunk_status = rocsparse_status_invalid_value;
+            }
+        }
+    }
+
+    for(int64_t chunk = 0; chunk < nchunks; ++chunk)
+    {
+        if(statuses[chunk] != rocsparse_status_success)
+        {
+            std::cerr << "cannot decode chunk " << chunk << " of file '" << this->m_filename << "'"
+                      << std::endl;
+            return statuses[chunk];
+        }
+    }
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_gebsx(rocsparse_direction*  dir,
+                                                                 rocsparse_direction*  dirb,
+                                                                 J*                    mb,
+                                                                 J*                    nb,
+                                                                 I*                    nnzb,
+                                                                 J* block_dim_row,
+                                                                 J* block_dim_column,
+                                                                 rocsparse_index_base* base)
+{
+    if(this->m_header.format != rocsparse_chunked_format_gebsx)
+    {
+        std::cerr << "file '" << this->m_filename << "' does not hold a gebsx matrix" << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    rocsparse_status status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.m), mb[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.n), nb[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.nnz), nnzb[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.row_block_dim),
+                                       block_dim_row[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.col_block_dim),
+                                       block_dim_column[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    dir[0]  = static_cast<rocsparse_direction>(this->m_header.dir);
+    dirb[0] = static_cast<rocsparse_direction>(this->m_header.dirb);
+    base[0] = static_cast<rocsparse_index_base>(this->m_header.base);
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_gebsx(I* ptr, J* ind, T* val)
+{
+    return this->import_chunks_csx(ptr, ind, val);
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_csx(
+    rocsparse_direction* dir, J* m, J* n, I* nnz, rocsparse_index_base* base)
+{
+    if(this->m_header.format != rocsparse_chunked_format_csx)
+    {
+        std::cerr << "file '" << this->m_filename << "' does not hold a csx matrix" << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    rocsparse_status status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.m), m[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.n), n[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(static_cast<size_t>(this->m_header.nnz), nnz[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    dir[0]  = static_cast<rocsparse_direction>(this->m_header.dir);
+    base[0] = static_cast<rocsparse_index_base>(this->m_header.base);
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_csx(I* ptr, J* ind, T* val)
+{
+    return this->import_chunks_csx(ptr, ind, val);
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_csx_rows(J row_begin,
+                                                                    J row_end,
+                                                                    rocsparse_direction*  dir,
+                                                                    J*                    m,
+                                                                    J*                    n,
+                                                                    I*                    nnz,
+                                                                    rocsparse_index_base* base)
+{
+    if(row_begin < 0 || row_end < row_begin)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    I                global_nnz;
+    rocsparse_status status = this->import_sparse_csx(dir, m, n, &global_nnz, base);
+    if(status != rocsparse_status_success)
+        return status;
+
+    const uint64_t L = (this->m_header.dir == rocsparse_direction_row) ? this->m_header.m
+                                                                       : this->m_header.n;
+
+    status = rocsparse_importer_chunked_check_index(this->m_index, L, this->m_header.nnz);
+    if(status != rocsparse_status_success)
+    {
+        std::cerr << "invalid index of chunked file '" << this->m_filename << "'" << std::endl;
+        return status;
+    }
+
+    if(rocsparse_importer_chunked_datatype_size(this->m_header.val_type) == 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    this->m_row_begin = std::min(static_cast<uint64_t>(row_begin), L);
+    this->m_row_end   = std::min(static_cast<uint64_t>(row_end), L);
+
+    //
+    // Select the chunks overlapping the slab, only the chunks holding its
+    // bounds are read to count its entries.
+    //
+    const auto first = std::upper_bound(this->m_index.begin(),
+                                        this->m_index.end(),
+                                        this->m_row_begin,
+                                        [](uint64_t row, const rocsparse_chunked_entry& entry) {
+                                            return row < entry.row_end;
+                                        });
+    const auto last  = std::lower_bound(this->m_index.begin(),
+                                       this->m_index.end(),
+                                       this->m_row_end,
+                                       [](const rocsparse_chunked_entry& entry, uint64_t row) {
+                                           return entry.row_end < row;
+                                       });
+
+    this->m_chunk_begin = first - this->m_index.begin();
+    this->m_chunk_end   = (this->m_row_begin < this->m_row_end) ? (last - this->m_index.begin()) + 1
+                                                                : this->m_chunk_begin;
+
+    this->m_nnz_begin = this->m_header.nnz;
+    if(this->m_chunk_begin < this->m_index.size())
+    {
+        status = rocsparse_importer_chunked_row_offset(this->m_fd,
+                                                       this->m_header,
+                                                       this->m_index[this->m_chunk_begin],
+                                                       this->m_row_begin,
+                                                       this->m_nnz_begin);
+        if(status != rocsparse_status_success)
+            return status;
+    }
+
+    this->m_nnz_end = this->m_nnz_begin;
+    if(this->m_chunk_begin < this->m_chunk_end)
+    {
+        status = rocsparse_importer_chunked_row_offset(this->m_fd,
+                                                       this->m_header,
+                                                       this->m_index[this->m_chunk_end - 1],
+                                                       this->m_row_end,
+                                                       this->m_nnz_end);
+        if(status != rocsparse_status_success)
+            return status;
+    }
+
+    return rocsparse_type_conversion(static_cast<size_t>(this->m_nnz_end - this->m_nnz_begin),
+                                     nnz[0]);
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_csx_rows(I* ptr, J* ind, T* val)
+{
+    const size_t   block_size = this->m_header.row_block_dim * this->m_header.col_block_dim;
+    const uint64_t row_begin  = this->m_row_begin;
+    const uint64_t row_end    = this->m_row_end;
+    const uint64_t nnz_begin  = this->m_nnz_begin;
+
+    //
+    // Chunks inside the slab are decoded in place, the chunks holding its
+    // bounds are decoded aside and only their rows of the slab are copied.
+    //
+    const int64_t                 chunk_begin = this->m_chunk_begin;
+    const int64_t                 chunk_end   = this->m_chunk_end;
+    std::vector<rocsparse_status> statuses(chunk_end - chunk_begin, rocsparse_status_success);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<char>    buffer;
+        std::vector<char>    raw;
+        host_vector<int64_t> tmp_ptr;
+        host_vector<J>       tmp_ind;
+        host_vector<T>       tmp_val;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int64_t chunk = chunk_begin; chunk < chunk_end; ++chunk)
+        {
+            const rocsparse_chunked_entry& entry        = this->m_index[chunk];
+            rocsparse_status&              chunk_status = statuses[chunk - chunk_begin];
+
+            chunk_status = rocsparse_chunked_read_chunk(this->m_fd, entry, buffer, raw);
+            if(chunk_status != rocsparse_status_success)
+            {
+                continue;
+            }
+
+            if(entry.row_begin >= row_begin && entry.row_end <= row_end)
+            {
+                chunk_status = rocsparse_importer_chunked_decode_csx(
+                    this->m_header,
+                    entry,
+                    raw,
+                    nnz_begin,
+                    ptr + (entry.row_begin - row_begin),
+                    ind + (entry.nnz_begin - nnz_begin),
+                    val + (entry.nnz_begin - nnz_begin) * block_size);
+                continue;
+            }
+
+            const uint64_t nrows = entry.row_end - entry.row_begin;
+            const uint64_t nnz   = entry.nnz_end - entry.nnz_begin;
+            tmp_ptr.resize(nrows + 1);
+            tmp_ind.resize(nnz);
+            tmp_val.resize(nnz * block_size);
+
+            chunk_status = rocsparse_importer_chunked_decode_csx(this->m_header,
+                                                                 entry,
+                                                                 raw,
+                                                                 entry.nnz_begin,
+                                                                 tmp_ptr.data(),
+                                                                 tmp_ind.data(),
+                                                                 tmp_val.data());
+            if(chunk_status != rocsparse_status_success)
+            {
+                continue;
+            }
+
+            const int64_t  base = this->m_header.base;
+            const uint64_t r0   = std::max(entry.row_begin, row_begin);
+            const uint64_t r1   = std::min(entry.row_end, row_end);
+            tmp_ptr[nrows]      = nnz + base;
+
+            const uint64_t k0     = tmp_ptr[r0 - entry.row_begin] - base;
+            const uint64_t k1     = tmp_ptr[r1 - entry.row_begin] - base;
+            const int64_t  offset = static_cast<int64_t>(entry.nnz_begin - nnz_begin);
+            for(uint64_t row = r0; row < r1; ++row)
+            {
+                ptr[row - row_begin] = static_cast<I>(tmp_ptr[row - entry.row_begin] + offset);
+            }
+
+            const uint64_t shift = entry.nnz_begin + k0 - nnz_begin;
+            std::copy(tmp_ind.begin() + k0, tmp_ind.begin() + k1, ind + shift);
+            std::copy(tmp_val.begin() + k0 * block_size,
+                      tmp_val.begin() + k1 * block_size,
+                      val + shift * block_size);
+        }
+    }
+
+    for(int64_t chunk = chunk_begin; chunk < chunk_end; ++chunk)
+    {
+        if(statuses[chunk - chunk_begin] != rocsparse_status_success)
+        {
+            std::cerr << "cannot decode chunk " << chunk << " of file '" << this->m_filename << "'"
+                      << std::endl;
+            return statuses[chunk - chunk_begin];
+        }
+    }
+
+    ptr[row_end - row_begin] = static_cast<I>(this->m_nnz_end - nnz_begin)
+                               + static_cast<I>(this->m_header.base);
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE_TIJ(T, I, J)                                                              \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_csx(I*, J*, T*);      \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_csx_rows(I*, J*, T*); \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_gebsx(I*, J*, T*)
+
+#define INSTANTIATE_TI(T, I)                                                 \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_coo( \
+        I* row_ind, I* col_ind, T* val)
+
+#define INSTANTIATE_I(I)                                                     \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_coo( \
+        I* m, I* n, int64_t* nnz, rocsparse_index_base* base)
+
+#define INSTANTIATE_IJ(I, J)                                                      \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_csx(      \
+        rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                 \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_csx_rows( \
+        J, J, rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);           \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_gebsx(    \
+        rocsparse_direction*, rocsparse_direction*, J*, J*, I*, J*, J*, rocsparse_index_base*)
+
+INSTANTIATE_I(int32_t);
+INSTANTIATE_I(int64_t);
+
+INSTANTIATE_IJ(int32_t, int32_t);
+INSTANTIATE_IJ(int64_t, int32_t);
+INSTANTIATE_IJ(int64_t, int64_t);
+
+INSTANTIATE_TIJ(int8_t, int32_t, int32_t);
+INSTANTIATE_TIJ(int8_t, int64_t, int32_t);
+INSTANTIATE_TIJ(int8_t, int64_t, int64_t);
+
+INSTANTIATE_TIJ(float, int32_t, int32_t);
+INSTANTIATE_TIJ(float, int64_t, int32_t);
+INSTANTIATE_TIJ(float, int64_t, int64_t);
+
+INSTANTIATE_TIJ(double, int32_t, int32_t);
+INSTANTIATE_TIJ(double, int64_t, int32_t);
+INSTANTIATE_TIJ(double, int64_t, int64_t);
+
+INSTANTIATE_TIJ(rocsparse_float_complex, int32_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_float_complex, int64_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_float_complex, int64_t, int64_t);
+
+INSTANTIATE_TIJ(rocsparse_double_complex, int32_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int64_t);
+
+INSTANTIATE_TI(int8_t, int32_t);
+INSTANTIATE_TI(int8_t, int64_t);
+
+INSTANTIATE_TI(float, int32_t);
+INSTANTIATE_TI(float, int64_t);
+
+INSTANTIATE_TI(double, int32_t);
+INSTANTIATE_TI(double, int64_t);
+
+INSTANTIATE_TI(rocsparse_float_complex, int32_t);
+INSTANTIATE_TI(rocsparse_float_complex, int64_t);
+
+INSTANTIATE_TI(rocsparse_double_complex, int32_t);
+INSTANTIATE_TI(rocsparse_double_complex, int64_t);
@@ -0,0 +1,100 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_IMPORTER_CHUNKED_HPP
+#define ROCSPARSE_IMPORTER_CHUNKED_HPP
+
+#include "rocsparse_chunked.hpp"
+#include "rocsparse_importer.hpp"
+
+class rocsparse_importer_chunked : public rocsparse_importer<rocsparse_importer_chunked>
+{
+protected:
+    std::string                          m_filename{};
+    int                                  m_fd{-1};
+    rocsparse_chunked_header             m_header{};
+    std::vector<rocsparse_chunked_entry> m_index{};
+
+public:
+    ~rocsparse_importer_chunked();
+    using IMPL = rocsparse_importer_chunked;
+    rocsparse_importer_chunked(const std::string& filename_);
+
+public:
+    template <typename I = rocsparse_int>
+    rocsparse_status import_sparse_coo(I* m, I* n, int64_t* nnz, rocsparse_index_base* base);
+
+    template <typename T, typename I = rocsparse_int>
+    rocsparse_status import_sparse_coo(I* row_ind, I* col_ind, T* val);
+
+public:
+    template <typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_gebsx(rocsparse_direction*  dir,
+                                         rocsparse_direction*  dirb,
+                                         J*                    mb,
+                                         J*                    nb,
+                                         I*                    nnzb,
+                                         J*                    block_dim_row,
+                                         J*                    block_dim_column,
+                                         rocsparse_index_base* base);
+
+    template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_gebsx(I* ptr, J* ind, T* val);
+
+public:
+    template <typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status
+        import_sparse_csx(rocsparse_direction* dir, J* m, J* n, I* nnz, rocsparse_index_base* base);
+
+    template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx(I* ptr, J* ind, T* val);
+
+    template <typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(J                     row_begin,
+                                            J                     row_end,
+                                            rocsparse_direction*  dir,
+                                            J*                    m,
+                                            J*                    n,
+                                            I*                    nnz,
+                                            rocsparse_index_base* base);
+
+    template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(I* ptr, J* ind, T* val);
+
+private:
+    uint64_t m_row_begin{};
+    uint64_t m_row_end{};
+    uint64_t m_nnz_begin{};
+    uint64_t m_nnz_end{};
+    size_t   m_chunk_begin{};
+    size_t   m_chunk_end{};
+
+private:
+    template <typename T, typename I, typename J>
+    rocsparse_status import_chunks_csx(I* ptr, J* ind, T* val);
+};
+
+#endif // HEADER
@@ -23,6 +23,7 @@
  * ************************************************************************ */
 #pragma once
 
+#include "rocsparse_importer_chunked.hpp"
 #include "rocsparse_importer_matrixmarket.hpp"
 #include "rocsparse_importer_rocalution.hpp"
 #include "rocsparse_importer_rocsparseio.hpp"
@@ -22,9 +22,19 @@
  *
  * ************************************************************************ */
 #include "rocsparse_importer_matrixmarket.hpp"
+#include <algorithm>
+#include <cinttypes>
+#include <fstream>
+#include <limits>
 #include <stdio.h>
-rocsparse_importer_matrixmarket::rocsparse_importer_matrixmarket(const std::string& filename_)
+rocsparse_importer_matrixmarket::rocsparse_importer_matrixmarket(const std::string&  filename_,
+                                                                 rocsparse_direction dirb_,
+                                                                 int64_t             row_block_dim_,
+                                                                 int64_t             col_block_dim_)
     : m_filename(filename_)
+    , m_dirb(dirb_)
+    , m_row_block_dim(row_block_dim_)
+    , m_col_block_dim(col_block_dim_)
 {
 }
 
@@ -69,60 +79,8 @@ static inline void read_mtx_value(std::istringstream&       is,
     val = {real, imag};
 }
 
-template <typename I, typename J>
-rocsparse_status
-
-    rocsparse_importer_matrixmarket::import_sparse_csx(
-        rocsparse_direction* dir, J* m, J* n, I* nnz, rocsparse_index_base* base)
-{
-    return rocsparse_status_not_implemented;
-}
-
-template <typename T, typename I, typename J>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(I* ptr, J* ind, T* val)
-{
-    return rocsparse_status_not_implemented;
-}
-
-template <typename I, typename J>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(rocsparse_direction* dir,
-                                                                      rocsparse_direction* dirb,
-                                                                      J*                   mb,
-                                                                      J*                   nb,
-                                                                      I*                   nnzb,
-                                                                      J* block_dim_row,
-                                                                      J* block_dim_column,
-                                                                      rocsparse_index_base* base)
-{
-    return rocsparse_status_not_implemented;
-}
-
-template <typename T, typename I, typename J>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(I* ptr, J* ind, T* val)
-{
-    return rocsparse_status_not_implemented;
-}
-
-template <typename I>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*                    m,
-                                                                    I*                    n,
-                                                                    int64_t*              nnz,
-                                                                    rocsparse_index_base* base)
+void rocsparse_importer_matrixmarket::read_banner(const char* line)
 {
-    char line[1024];
-    f = fopen(this->m_filename.c_str(), "r");
-    if(!f)
-    {
-        std::cerr << "rocsparse_importer_matrixmarket::import_sparse_coo: cannot open file '"
-                  << this->m_filename << "' " << std::endl;
-        return rocsparse_status_internal_error;
-    }
-    // Check for banner
-    if(!fgets(line, 1024, f))
-    {
-        throw rocsparse_status_internal_error;
-    }
-
     char banner[16];
     char array[16];
     char coord[16];
@@ -177,6 +135,732 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*
 
     // Symmetric flag
     this->m_symm = !strcmp(type, "symmetric");
+}
+
+//
+// Size of the blocks of entries read by a row range import, the first entry
+// of each block forms a sampled newline index of the file.
+//
+static constexpr int64_t rocsparse_importer_matrixmarket_block_size = 1 << 20;
+
+static inline void parse_mtx_value(const char* p, int8_t& val)
+{
+    val = static_cast<int8_t>(strtod(p, nullptr));
+}
+
+static inline void parse_mtx_value(const char* p, float& val)
+{
+    val = strtof(p, nullptr);
+}
+
+static inline void parse_mtx_value(const char* p, double& val)
+{
+    val = strtod(p, nullptr);
+}
+
+static inline void parse_mtx_value(const char* p, rocsparse_float_complex& val)
+{
+    char*       q;
+    const float real = strtof(p, &q);
+    const float imag = strtof(q, nullptr);
+
+    val = {real, imag};
+}
+
+static inline void parse_mtx_value(const char* p, rocsparse_double_complex& val)
+{
+    char*        q;
+    const double real = strtod(p, &q);
+    const double imag = strtod(q, nullptr);
+
+    val = {real, imag};
+}
+
+//
+// Read the entries in [begin, end) of the file and call f(row, col, value)
+// for each of them, value points to the remainder of the line.
+//
+template <typename F>
+static rocsparse_status rocsparse_importer_matrixmarket_parse_block(
+    std::ifstream& in, int64_t begin, int64_t end, std::vector<char>& buffer, F&& f)
+{
+    const int64_t size = end - begin;
+    buffer.resize(size + 1);
+    in.seekg(begin);
+    in.read(buffer.data(), size);
+    if(!in)
+    {
+        return rocsparse_status_internal_error;
+    }
+    buffer[size] = '\0';
+
+    char*       p    = buffer.data();
+    const char* last = p + size;
+    while(p < last)
+    {
+        char* eol = (char*)memchr(p, '\n', last - p);
+        if(eol != nullptr)
+        {
+            *eol = '\0';
+        }
+
+        char* q = p + strspn(p, " \t\r");
+        if(*q != '\0' && *q != '%')
+        {
+            char*         r;
+            const int64_t row = strtoll(q, &r, 10);
+            char*         v;
+            const int64_t col = strtoll(r, &v, 10);
+            if(r == q || v == r)
+            {
+                return rocsparse_status_internal_error;
+            }
+            f(row, col, v);
+        }
+
+        p = (eol != nullptr) ? eol + 1 : buffer.data() + size;
+    }
+
+    return rocsparse_status_success;
+}
+
+//
+// Call f(r, i, j) for the entry (i, j) of the file and for its transpose in a
+// symmetric matrix, if they lie in the compressed rows [row_begin, row_end)
+// of row_dim rows. r is the compressed row relative to row_begin, i and j are
+// 0-based.
+//
+template <typename F>
+static inline void rocsparse_importer_matrixmarket_contributions(int64_t i,
+                                                                 int64_t j,
+                                                                 bool    symm,
+                                                                 int64_t row_dim,
+                                                                 int64_t row_begin,
+                                                                 int64_t row_end,
+                                                                 F&&     f)
+{
+    const int64_t r = (i - 1) / row_dim;
+    if(r >= row_begin && r < row_end)
+    {
+        f(r - row_begin, i - 1, j - 1);
+    }
+
+    if(symm && i != j)
+    {
+        const int64_t s = (j - 1) / row_dim;
+        if(s >= row_begin && s < row_end)
+        {
+            f(s - row_begin, j - 1, i - 1);
+        }
+    }
+}
+
+//
+// Count the entries of each compressed row and set m_blocks to the blocks
+// holding entries of these rows. Without an index every block is scanned,
+// since the entries may come in any order, and the bounds of the rows of each
+// block are recorded. With an index only the blocks whose bounds meet the rows
+// are scanned.
+//
+rocsparse_status rocsparse_importer_matrixmarket::scan_blocks()
+{
+    const int64_t nblocks   = this->m_offsets.size() - 1;
+    const int64_t row_dim   = this->m_row_dim;
+    const int64_t row_begin = this->m_row_begin;
+    const int64_t row_end   = this->m_row_end;
+    const bool    symm      = this->m_symm;
+    const bool    indexed   = (this->m_row_lo.size() == static_cast<size_t>(nblocks));
+    int64_t*      counts    = this->m_ptr.data() + 1;
+
+    // 1-based rows of the file in the compressed rows.
+    const int64_t first = row_begin * row_dim + 1;
+    const int64_t last  = row_end * row_dim;
+
+    std::vector<int64_t> candidates;
+    for(int64_t b = 0; b < nblocks; ++b)
+    {
+        if(!indexed || (this->m_row_lo[b] <= last && this->m_row_hi[b] >= first))
+        {
+            candidates.push_back(b);
+        }
+    }
+
+    const int64_t                 ncandidates = candidates.size();
+    std::vector<int>              hits(ncandidates, 0);
+    std::vector<int64_t>          lo(ncandidates, std::numeric_limits<int64_t>::max());
+    std::vector<int64_t>          hi(ncandidates, std::numeric_limits<int64_t>::min());
+    std::vector<rocsparse_status> statuses(ncandidates, rocsparse_status_success);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::ifstream     in(this->m_filename, std::ios::in | std::ios::binary);
+        std::vector<char> buffer;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int64_t c = 0; c < ncandidates; ++c)
+        {
+            if(!in.is_open())
+            {
+                statuses[c] = rocsparse_status_internal_error;
+                continue;
+            }
+
+            const int64_t b   = candidates[c];
+            int           hit = 0;
+
+            statuses[c] = rocsparse_importer_matrixmarket_parse_block(
+                in,
+                this->m_offsets[b],
+                this->m_offsets[b + 1],
+                buffer,
+                [&](int64_t i, int64_t j, const char*) {
+                    lo[c] = std::min(lo[c], symm ? std::min(i, j) : i);
+                    hi[c] = std::max(hi[c], symm ? std::max(i, j) : i);
+                    rocsparse_importer_matrixmarket_contributions(
+                        i, j, symm, row_dim, row_begin, row_end, [&](int64_t r, int64_t, int64_t) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                            ++counts[r];
+                            hit = 1;
+                        });
+                });
+
+            hits[c] = hit;
+        }
+    }
+
+    this->m_blocks.clear();
+    for(int64_t c = 0; c < ncandidates; ++c)
+    {
+        if(statuses[c] != rocsparse_status_success)
+        {
+            std::cerr << "cannot read entries of file '" << this->m_filename << "'" << std::endl;
+            return statuses[c];
+        }
+
+        if(hits[c])
+        {
+            this->m_blocks.push_back(candidates[c]);
+        }
+    }
+
+    if(!indexed)
+    {
+        this->m_row_lo.assign(lo.begin(), lo.end());
+        this->m_row_hi.assign(hi.begin(), hi.end());
+    }
+
+    return rocsparse_status_success;
+}
+
+//
+// First pass of an import: read the header, sample the file and count the
+// entries of the compressed rows [row_begin, row_end), each of row_dim rows.
+//
+rocsparse_status
+    rocsparse_importer_matrixmarket::index_rows(int64_t row_begin, int64_t row_end, int64_t row_dim)
+{
+    std::ifstream in(this->m_filename, std::ios::in | std::ios::binary);
+    if(!in.is_open())
+    {
+        std::cerr << "rocsparse_importer_matrixmarket: cannot open file '" << this->m_filename
+                  << "' " << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    std::string line;
+    if(!std::getline(in, line))
+    {
+        throw rocsparse_status_internal_error;
+    }
+
+    this->read_banner(line.c_str());
+
+    // Skip comments
+    while(std::getline(in, line))
+    {
+        if(line[0] != '%')
+        {
+            break;
+        }
+    }
+
+    // Read dimensions
+    int64_t inrow;
+    int64_t incol;
+    int64_t innz;
+    if(sscanf(line.c_str(), "%" SCNd64 " %" SCNd64 " %" SCNd64, &inrow, &incol, &innz) != 3)
+    {
+        throw rocsparse_status_internal_error;
+    }
+
+    const int64_t position = in.eof() ? -1 : static_cast<int64_t>(in.tellg());
+    in.clear();
+    in.seekg(0, std::ios::end);
+    const int64_t data_end   = in.tellg();
+    const int64_t data_begin = (position < 0) ? data_end : position;
+
+    const int64_t mrows = (inrow + row_dim - 1) / row_dim;
+    this->m_m           = inrow;
+    this->m_n           = incol;
+    this->m_row_dim     = row_dim;
+    this->m_row_begin   = std::min(row_begin, mrows);
+    this->m_row_end     = std::min(row_end, mrows);
+
+    //
+    // Sample the entries every block size bytes, a block starts after the
+    // first newline following its sample. The index of a previous import is
+    // kept.
+    //
+    if(this->m_offsets.size() < 2 || this->m_offsets.front() != data_begin
+       || this->m_offsets.back() != data_end)
+    {
+        this->m_row_lo.clear();
+        this->m_row_hi.clear();
+        this->m_offsets.assign(1, data_begin);
+        for(int64_t pos = data_begin + rocsparse_importer_matrixmarket_block_size; pos < data_end;
+            pos += rocsparse_importer_matrixmarket_block_size)
+        {
+            char window[1024];
+            in.seekg(pos - 1);
+            in.read(window, sizeof(window));
+            const char* eol = (const char*)memchr(window, '\n', in.gcount());
+            in.clear();
+
+            const int64_t offset = (eol != nullptr) ? pos + (eol - window) : data_end;
+            if(offset > this->m_offsets.back() && offset < data_end)
+            {
+                this->m_offsets.push_back(offset);
+            }
+        }
+        this->m_offsets.push_back(data_end);
+    }
+
+    this->m_ptr.assign(this->m_row_end - this->m_row_begin + 1, 0);
+    rocsparse_status status = this->scan_blocks();
+    if(status != rocsparse_status_success)
+        return status;
+
+    for(size_t r = 1; r < this->m_ptr.size(); ++r)
+    {
+        this->m_ptr[r] += this->m_ptr[r - 1];
+    }
+
+    return rocsparse_status_success;
+}
+
+//
+// Call f(r, i, j, value) concurrently for the entries of the indexed rows.
+//
+template <typename F>
+rocsparse_status rocsparse_importer_matrixmarket::for_each_entry(F&& f)
+{
+    const int64_t nblocks   = this->m_blocks.size();
+    const int64_t row_dim   = this->m_row_dim;
+    const int64_t row_begin = this->m_row_begin;
+    const int64_t row_end   = this->m_row_end;
+    const bool    symm      = this->m_symm;
+
+    std::vector<rocsparse_status> statuses(nblocks, rocsparse_status_success);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::ifstream     in(this->m_filename, std::ios::in | std::ios::binary);
+        std::vector<char> buffer;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int64_t b = 0; b < nblocks; ++b)
+        {
+            if(!in.is_open())
+            {
+                statuses[b] = rocsparse_status_internal_error;
+                continue;
+            }
+
+            statuses[b] = rocsparse_importer_matrixmarket_parse_block(
+                in,
+                this->m_offsets[this->m_blocks[b]],
+                this->m_offsets[this->m_blocks[b] + 1],
+                buffer,
+                [&](int64_t i, int64_t j, const char* value) {
+                    rocsparse_importer_matrixmarket_contributions(
+                        i,
+                        j,
+                        symm,
+                        row_dim,
+                        row_begin,
+                        row_end,
+                        [&](int64_t r, int64_t ci, int64_t cj) { f(r, ci, cj, value); });
+                });
+        }
+    }
+
+    for(int64_t b = 0; b < nblocks; ++b)
+    {
+        if(statuses[b] != rocsparse_status_success)
+        {
+            std::cerr << "cannot read entries of file '" << this->m_filename << "'" << std::endl;
+            return statuses[b];
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(
+    rocsparse_direction* dir, J* m, J* n, I* nnz, rocsparse_index_base* base)
+{
+    return this->import_sparse_csx_rows(
+        static_cast<J>(0), std::numeric_limits<J>::max(), dir, m, n, nnz, base);
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(I* ptr, J* ind, T* val)
+{
+    return this->import_sparse_csx_rows(ptr, ind, val);
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx_rows(J row_begin,
+                                                                         J row_end,
+                                                                         rocsparse_direction* dir,
+                                                                         J*                   m,
+                                                                         J*                   n,
+                                                                         I*                   nnz,
+                                                                         rocsparse_index_base* base)
+{
+    if(row_begin < 0 || row_end < row_begin)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    rocsparse_status status = this->index_rows(row_begin, row_end, 1);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_m, m[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_n, n[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_ptr.back(), nnz[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    dir[0]  = rocsparse_direction_row;
+    base[0] = rocsparse_index_base_one;
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx_rows(I* ptr, J* ind, T* val)
+{
+    const int64_t  nrows   = this->m_row_end - this->m_row_begin;
+    const int64_t* offsets = this->m_ptr.data();
+    const bool     pattern = !strcmp(this->m_data, "pattern");
+
+    //
+    // Second pass, the entries are stored at the position of their row.
+    //
+    host_vector<int64_t> next(offsets, offsets + nrows);
+    int                  overflow = 0;
+
+    rocsparse_status status
+        = this->for_each_entry([&](int64_t r, int64_t, int64_t j, const char* value) {
+              int64_t k;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+              k = next[r]++;
+              if(k >= offsets[r + 1])
+              {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                  overflow = 1;
+                  return;
+              }
+
+              ind[k] = static_cast<J>(j + 1);
+              if(pattern)
+              {
+                  val[k] = static_cast<T>(1);
+              }
+              else
+              {
+                  parse_mtx_value(value, val[k]);
+              }
+          });
+    if(status != rocsparse_status_success)
+        return status;
+
+    for(int64_t r = 0; r < nrows && !overflow; ++r)
+    {
+        overflow = (next[r] != offsets[r + 1]);
+    }
+
+    if(overflow)
+    {
+        std::cerr << "entries of file '" << this->m_filename << "' changed during the import"
+                  << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    //
+    // Sort the rows by column index.
+    //
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<std::pair<J, T>> row;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(int64_t r = 0; r < nrows; ++r)
+        {
+            const int64_t begin = offsets[r];
+            const int64_t end   = offsets[r + 1];
+            if(std::is_sorted(ind + begin, ind + end))
+            {
+                continue;
+            }
+
+            row.resize(end - begin);
+            for(int64_t k = begin; k < end; ++k)
+            {
+                row[k - begin] = std::make_pair(ind[k], val[k]);
+            }
+
+            std::stable_sort(
+                row.begin(), row.end(), [](const std::pair<J, T>& a, const std::pair<J, T>& b) {
+                    return a.first < b.first;
+                });
+
+            for(int64_t k = begin; k < end; ++k)
+            {
+                ind[k] = row[k - begin].first;
+                val[k] = row[k - begin].second;
+            }
+        }
+    }
+
+    for(int64_t r = 0; r <= nrows; ++r)
+    {
+        ptr[r] = static_cast<I>(offsets[r] + 1);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(rocsparse_direction* dir,
+                                                                      rocsparse_direction* dirb,
+                                                                      J*                   mb,
+                                                                      J*                   nb,
+                                                                      I*                   nnzb,
+                                                                      J* block_dim_row,
+                                                                      J* block_dim_column,
+                                                                      rocsparse_index_base* base)
+{
+    const int64_t row_block_dim = this->m_row_block_dim;
+    const int64_t col_block_dim = this->m_col_block_dim;
+    if(row_block_dim <= 0 || col_block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    rocsparse_status status
+        = this->index_rows(0, std::numeric_limits<int64_t>::max(), row_block_dim);
+    if(status != rocsparse_status_success)
+        return status;
+
+    //
+    // Second pass, the block columns of the entries are stored at the position
+    // of their block row, then sorted and made unique.
+    //
+    const int64_t  nrows   = this->m_row_end - this->m_row_begin;
+    const int64_t* offsets = this->m_ptr.data();
+
+    host_vector<int64_t> cols(offsets[nrows]);
+    host_vector<int64_t> next(offsets, offsets + nrows);
+    int                  overflow = 0;
+
+    status = this->for_each_entry([&](int64_t r, int64_t, int64_t j, const char*) {
+        int64_t k;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+        k = next[r]++;
+        if(k >= offsets[r + 1])
+        {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+            overflow = 1;
+            return;
+        }
+        cols[k] = j / col_block_dim;
+    });
+    if(status != rocsparse_status_success)
+        return status;
+
+    for(int64_t r = 0; r < nrows && !overflow; ++r)
+    {
+        overflow = (next[r] != offsets[r + 1]);
+    }
+
+    if(overflow)
+    {
+        std::cerr << "entries of file '" << this->m_filename << "' changed during the import"
+                  << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    host_vector<int64_t> bsr_ptr(nrows + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t r = 0; r < nrows; ++r)
+    {
+        std::sort(cols.begin() + offsets[r], cols.begin() + offsets[r + 1]);
+        bsr_ptr[r + 1] = std::unique(cols.begin() + offsets[r], cols.begin() + offsets[r + 1])
+                         - (cols.begin() + offsets[r]);
+    }
+
+    for(int64_t r = 0; r < nrows; ++r)
+    {
+        bsr_ptr[r + 1] += bsr_ptr[r];
+    }
+
+    this->m_ind.resize(bsr_ptr[nrows]);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t r = 0; r < nrows; ++r)
+    {
+        std::copy(cols.begin() + offsets[r],
+                  cols.begin() + offsets[r] + (bsr_ptr[r + 1] - bsr_ptr[r]),
+                  this->m_ind.begin() + bsr_ptr[r]);
+    }
+
+    this->m_ptr.swap(bsr_ptr);
+
+    status = rocsparse_type_conversion(nrows, mb[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion((this->m_n + col_block_dim - 1) / col_block_dim, nb[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_ptr[nrows], nnzb[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(row_block_dim, block_dim_row[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(col_block_dim, block_dim_column[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    dir[0]  = rocsparse_direction_row;
+    dirb[0] = this->m_dirb;
+    base[0] = rocsparse_index_base_one;
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(I* ptr, J* ind, T* val)
+{
+    const int64_t  row_block_dim = this->m_row_block_dim;
+    const int64_t  col_block_dim = this->m_col_block_dim;
+    const int64_t  block_size    = row_block_dim * col_block_dim;
+    const int64_t  nrows         = this->m_row_end - this->m_row_begin;
+    const int64_t  nnzb          = this->m_ptr[nrows];
+    const int64_t* bsr_ptr       = this->m_ptr.data();
+    const int64_t* bsr_ind       = this->m_ind.data();
+    const bool     row_major     = (this->m_dirb == rocsparse_direction_row);
+    const bool     pattern       = !strcmp(this->m_data, "pattern");
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t k = 0; k < nnzb; ++k)
+    {
+        ind[k] = static_cast<J>(bsr_ind[k] + 1);
+        for(int64_t l = 0; l < block_size; ++l)
+        {
+            val[k * block_size + l] = static_cast<T>(0);
+        }
+    }
+
+    for(int64_t r = 0; r <= nrows; ++r)
+    {
+        ptr[r] = static_cast<I>(bsr_ptr[r] + 1);
+    }
+
+    //
+    // Third pass, the values are stored in their block.
+    //
+    return this->for_each_entry([&](int64_t r, int64_t i, int64_t j, const char* value) {
+        const int64_t k
+            = std::lower_bound(bsr_ind + bsr_ptr[r], bsr_ind + bsr_ptr[r + 1], j / col_block_dim)
+              - bsr_ind;
+        const int64_t bi = i % row_block_dim;
+        const int64_t bj = j % col_block_dim;
+        T&            v  = val[k * block_size
+                     + (row_major ? bi * col_block_dim + bj : bj * row_block_dim + bi)];
+        if(pattern)
+        {
+            v = static_cast<T>(1);
+        }
+        else
+        {
+            parse_mtx_value(value, v);
+        }
+    });
+}
+
+template <typename I>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*                    m,
+                                                                    I*                    n,
+                                                                    int64_t*              nnz,
+                                                                    rocsparse_index_base* base)
+{
+    char line[1024];
+    f = fopen(this->m_filename.c_str(), "r");
+    if(!f)
+    {
+        std::cerr << "rocsparse_importer_matrixmarket::import_sparse_coo: cannot open file '"
+                  << this->m_filename << "' " << std::endl;
+        return rocsparse_status_internal_error;
+    }
+    // Check for banner
+    if(!fgets(line, 1024, f))
+    {
+        throw rocsparse_status_internal_error;
+    }
+
+    this->read_banner(line);
 
     // Skip comments
     while(fgets(line, 1024, f))
@@ -269,9 +953,9 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I* row_ind,
 {
     char           line[1024];
     const size_t   nnz = this->m_nnz;
-    std::vector<I> unsorted_row(nnz);
-    std::vector<I> unsorted_col(nnz);
-    std::vector<T> unsorted_val(nnz);
+    host_vector<I> unsorted_row(nnz);
+    host_vector<I> unsorted_col(nnz);
+    host_vector<T> unsorted_val(nnz);
 
     // Read entries
     I idx = 0;
@@ -319,7 +1003,7 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I* row_ind,
     fclose(f);
 
     // Sort by row and column index
-    std::vector<I> perm(nnz);
+    host_vector<I> perm(nnz);
     for(I i = 0; i < nnz; ++i)
     {
         perm[i] = i;
@@ -356,8 +1040,9 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I* row_ind,
     return rocsparse_status_success;
 }
 
-#define INSTANTIATE_TIJ(T, I, J)                                                              \
-    template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(I*, J*, T*); \
+#define INSTANTIATE_TIJ(T, I, J)                                                                   \
+    template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(I*, J*, T*);      \
+    template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx_rows(I*, J*, T*); \
     template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(I*, J*, T*)
 
 #define INSTANTIATE_TI(T, I)                                                      \
@@ -368,10 +1053,12 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I* row_ind,
     template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo( \
         I* m, I* n, int64_t* nnz, rocsparse_index_base* base)
 
-#define INSTANTIATE_IJ(I, J)                                                        \
-    template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(   \
-        rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                   \
-    template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx( \
+#define INSTANTIATE_IJ(I, J)                                                           \
+    template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(      \
+        rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                      \
+    template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx_rows( \
+        J, J, rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                \
+    template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(    \
         rocsparse_direction*, rocsparse_direction*, J*, J*, I*, J*, J*, rocsparse_index_base*)
 
 INSTANTIATE_I(int32_t);
@@ -33,7 +33,14 @@ protected:
     std::string m_filename;
 
 public:
-    rocsparse_importer_matrixmarket(const std::string& filename_);
+    //
+    // A gebsx import groups the entries of the file in blocks of the given
+    // dimensions and layout.
+    //
+    rocsparse_importer_matrixmarket(const std::string&  filename_,
+                                    rocsparse_direction dirb_          = rocsparse_direction_row,
+                                    int64_t             row_block_dim_ = 1,
+                                    int64_t             col_block_dim_ = 1);
 
 private:
     FILE*  f;
@@ -41,6 +48,38 @@ private:
     char   m_data[16];
     int    m_symm;
 
+    rocsparse_direction m_dirb{};
+    int64_t             m_row_block_dim{};
+    int64_t             m_col_block_dim{};
+
+    void read_banner(const char* line);
+
+private:
+    //
+    // Sampled newline index, m_offsets holds the boundaries of the blocks of
+    // entries. Once every block has been read, [m_row_lo[b], m_row_hi[b]]
+    // bounds the rows of the entries of block b, and the index is kept for the
+    // next imports of the importer. The compressed rows [m_row_begin,
+    // m_row_end), each of m_row_dim rows, are imported from the blocks
+    // m_blocks and m_ptr holds their offsets.
+    //
+    host_vector<int64_t> m_offsets{};
+    host_vector<int64_t> m_row_lo{};
+    host_vector<int64_t> m_row_hi{};
+    host_vector<int64_t> m_blocks{};
+    int64_t              m_m{};
+    int64_t              m_n{};
+    int64_t              m_row_dim{};
+    int64_t              m_row_begin{};
+    int64_t              m_row_end{};
+    host_vector<int64_t> m_ptr{};
+    host_vector<int64_t> m_ind{};
+
+    rocsparse_status index_rows(int64_t row_begin, int64_t row_end, int64_t row_dim);
+    rocsparse_status scan_blocks();
+    template <typename F>
+    rocsparse_status for_each_entry(F&& f);
+
 public:
     template <typename I = rocsparse_int, typename J = rocsparse_int>
     rocsparse_status
@@ -48,6 +87,17 @@ public:
     template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
     rocsparse_status import_sparse_csx(I* ptr, J* ind, T* val);
 
+    template <typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(J                     row_begin,
+                                            J                     row_end,
+                                            rocsparse_direction*  dir,
+                                            J*                    m,
+                                            J*                    n,
+                                            I*                    nnz,
+                                            rocsparse_index_base* base);
+    template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(I* ptr, J* ind, T* val);
+
     template <typename I = rocsparse_int, typename J = rocsparse_int>
     rocsparse_status import_sparse_gebsx(rocsparse_direction*  dir,
                                          rocsparse_direction*  dirb,
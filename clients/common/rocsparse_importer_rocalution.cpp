@@ -87,6 +87,26 @@ static inline void
     in.read((char*)csr_val, sizeof(rocsparse_double_complex) * nnz);
 }
 
+//
+// Size of a value in the file, real values are stored as double and complex values as double
+// complex.
+//
+template <typename T>
+static inline size_t rocalution_sizeof_value(const T*)
+{
+    return sizeof(double);
+}
+
+static inline size_t rocalution_sizeof_value(const rocsparse_float_complex*)
+{
+    return sizeof(rocsparse_double_complex);
+}
+
+static inline size_t rocalution_sizeof_value(const rocsparse_double_complex*)
+{
+    return sizeof(rocsparse_double_complex);
+}
+
 rocsparse_importer_rocalution::rocsparse_importer_rocalution(const std::string& filename_)
     : m_filename(filename_)
 {
@@ -280,8 +300,117 @@ rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(I* ptr, J* ind
     return rocsparse_status_success;
 }
 
-#define INSTANTIATE_TIJ(T, I, J)                                                            \
-    template rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(I*, J*, T*); \
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_rocalution::import_sparse_csx_rows(J row_begin,
+                                                                       J row_end,
+                                                                       rocsparse_direction* dir,
+                                                                       J*                   m,
+                                                                       J*                   n,
+                                                                       I*                   nnz,
+                                                                       rocsparse_index_base* base)
+{
+    if(row_begin < 0 || row_end < row_begin)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    I                global_nnz;
+    rocsparse_status status = this->import_sparse_csx(dir, m, n, &global_nnz, base);
+    if(status != rocsparse_status_success)
+        return status;
+
+    //
+    // The arrays follow the header, only the offsets bounding the slab are read here.
+    //
+    std::ifstream& in = this->m_info_csx.in[0];
+
+    this->m_info_csx.offset    = in.tellg();
+    this->m_info_csx.row_begin = std::min(static_cast<size_t>(row_begin), this->m_info_csx.m);
+    this->m_info_csx.row_end   = std::min(static_cast<size_t>(row_end), this->m_info_csx.m);
+
+    int bounds[2];
+    in.seekg(this->m_info_csx.offset + sizeof(int) * this->m_info_csx.row_begin);
+    in.read((char*)&bounds[0], sizeof(int));
+    in.seekg(this->m_info_csx.offset + sizeof(int) * this->m_info_csx.row_end);
+    in.read((char*)&bounds[1], sizeof(int));
+    if(!in || bounds[0] < 0 || bounds[1] < bounds[0]
+       || static_cast<size_t>(bounds[1]) > this->m_info_csx.nnz)
+    {
+        std::cerr << "invalid row pointer in file '" << this->m_filename << "'" << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    this->m_info_csx.nnz_begin = bounds[0];
+    this->m_info_csx.nnz_end   = bounds[1];
+
+    return rocsparse_type_conversion(static_cast<size_t>(bounds[1] - bounds[0]), nnz[0]);
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_rocalution::import_sparse_csx_rows(I* ptr, J* ind, T* val)
+{
+    const size_t         M         = this->m_info_csx.m;
+    const size_t         nnz       = this->m_info_csx.nnz;
+    const size_t         slab_m    = this->m_info_csx.row_end - this->m_info_csx.row_begin;
+    const size_t         slab_nnz  = this->m_info_csx.nnz_end - this->m_info_csx.nnz_begin;
+    const size_t         nnz_begin = this->m_info_csx.nnz_begin;
+    const std::streamoff offset    = this->m_info_csx.offset;
+    std::ifstream&       in        = this->m_info_csx.in[0];
+
+    //
+    // Seek to the slab in each array, the row offsets are shifted to start at zero.
+    //
+    host_dense_vector<int> tmp_ptr(slab_m + 1);
+    in.seekg(offset + sizeof(int) * this->m_info_csx.row_begin);
+    in.read((char*)tmp_ptr.data(), sizeof(int) * (slab_m + 1));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(size_t i = 0; i <= slab_m; ++i)
+    {
+        ptr[i] = static_cast<I>(tmp_ptr[i] - nnz_begin);
+    }
+
+    in.seekg(offset + sizeof(int) * (M + 1 + nnz_begin));
+    if(std::is_same<J, int>())
+    {
+        in.read((char*)ind, sizeof(int) * slab_nnz);
+    }
+    else
+    {
+        host_dense_vector<int> tmp_ind(slab_nnz);
+        in.read((char*)tmp_ind.data(), sizeof(int) * slab_nnz);
+        rocsparse_importer_copy_mixed_arrays(slab_nnz, ind, tmp_ind.data());
+    }
+
+    in.seekg(offset + sizeof(int) * (M + 1 + nnz) + rocalution_sizeof_value(val) * nnz_begin);
+    read_csr_values(in, (int64_t)slab_nnz, val);
+
+    const bool failed = !in;
+    in.close();
+    delete this->m_info_csx.in;
+    this->m_info_csx.in = nullptr;
+    if(failed)
+    {
+        std::cerr << "cannot read rows from file '" << this->m_filename << "'" << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    {
+        const char* env = getenv("GTEST_LISTENER");
+        if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+        {
+            std::cout << "Import done." << std::endl;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE_TIJ(T, I, J)                                                                 \
+    template rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(I*, J*, T*);      \
+    template rocsparse_status rocsparse_importer_rocalution::import_sparse_csx_rows(I*, J*, T*); \
     template rocsparse_status rocsparse_importer_rocalution::import_sparse_gebsx(I*, J*, T*)
 
 #define INSTANTIATE_TI(T, I)                                                    \
@@ -292,10 +421,12 @@ rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(I* ptr, J* ind
     template rocsparse_status rocsparse_importer_rocalution::import_sparse_coo( \
         I* m, I* n, int64_t* nnz, rocsparse_index_base* base)
 
-#define INSTANTIATE_IJ(I, J)                                                      \
-    template rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(   \
-        rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                 \
-    template rocsparse_status rocsparse_importer_rocalution::import_sparse_gebsx( \
+#define INSTANTIATE_IJ(I, J)                                                         \
+    template rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(      \
+        rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                    \
+    template rocsparse_status rocsparse_importer_rocalution::import_sparse_csx_rows( \
+        J, J, rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);              \
+    template rocsparse_status rocsparse_importer_rocalution::import_sparse_gebsx(    \
         rocsparse_direction*, rocsparse_direction*, J*, J*, I*, J*, J*, rocsparse_index_base*)
 
 INSTANTIATE_I(int32_t);
@@ -60,12 +60,33 @@ public:
     template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
     rocsparse_status import_sparse_csx(I* ptr, J* ind, T* val);
 
+    template <typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(J                     row_begin,
+                                            J                     row_end,
+                                            rocsparse_direction*  dir,
+                                            J*                    m,
+                                            J*                    n,
+                                            I*                    nnz,
+                                            rocsparse_index_base* base);
+
+    template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(I* ptr, J* ind, T* val);
+
 private:
     struct info_csx
     {
         size_t         m{};
         size_t         nnz{};
         std::ifstream* in{};
+
+        //
+        // Slab of a row range import, offset is the position of the arrays.
+        //
+        size_t         row_begin{};
+        size_t         row_end{};
+        size_t         nnz_begin{};
+        size_t         nnz_end{};
+        std::streamoff offset{};
     };
     info_csx m_info_csx{};
 
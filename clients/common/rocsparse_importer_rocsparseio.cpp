@@ -24,6 +24,8 @@
 
 #include "rocsparse_importer_rocsparseio.hpp"
 
+#include <fstream>
+
 #ifdef ROCSPARSEIO
 
 #define ROCSPARSE_CHECK_ROCSPARSEIO(iostatus_)  \
@@ -128,6 +130,71 @@ inline rocsparseio_type type_tconvert<rocsparse_double_complex>()
 {
     return rocsparseio_type_complex64;
 };
+
+//
+// Copy a slab of an array stored with the type of the file.
+//
+template <typename X>
+inline rocsparse_status
+    rocsparseio_copy_indices(rocsparseio_type type, size_t size, X* x, const char* y)
+{
+    switch(type)
+    {
+    case rocsparseio_type_int32:
+    {
+        rocsparse_importer_copy_mixed_arrays(size, x, (const int32_t*)y);
+        return rocsparse_status_success;
+    }
+    case rocsparseio_type_int64:
+    {
+        rocsparse_importer_copy_mixed_arrays(size, x, (const int64_t*)y);
+        return rocsparse_status_success;
+    }
+    case rocsparseio_type_float32:
+    case rocsparseio_type_float64:
+    case rocsparseio_type_complex32:
+    case rocsparseio_type_complex64:
+    {
+        break;
+    }
+    }
+    return rocsparse_status_invalid_value;
+}
+
+template <typename X>
+inline rocsparse_status
+    rocsparseio_copy_values(rocsparseio_type type, size_t size, X* x, const char* y)
+{
+    switch(type)
+    {
+    case rocsparseio_type_int32:
+    case rocsparseio_type_int64:
+    {
+        break;
+    }
+    case rocsparseio_type_float32:
+    {
+        rocsparse_importer_copy_mixed_arrays(size, x, (const float*)y);
+        return rocsparse_status_success;
+    }
+    case rocsparseio_type_float64:
+    {
+        rocsparse_importer_copy_mixed_arrays(size, x, (const double*)y);
+        return rocsparse_status_success;
+    }
+    case rocsparseio_type_complex32:
+    {
+        rocsparse_importer_copy_mixed_arrays(size, x, (const rocsparse_float_complex*)y);
+        return rocsparse_status_success;
+    }
+    case rocsparseio_type_complex64:
+    {
+        rocsparse_importer_copy_mixed_arrays(size, x, (const rocsparse_double_complex*)y);
+        return rocsparse_status_success;
+    }
+    }
+    return rocsparse_status_invalid_value;
+}
 #endif
 
 rocsparse_importer_rocsparseio::~rocsparse_importer_rocsparseio()
@@ -773,8 +840,180 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx(I* ptr, J* in
 #endif
 }
 
-#define INSTANTIATE_TIJ(T, I, J)                                                             \
-    template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx(I*, J*, T*); \
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx_rows(J row_begin,
+                                                                        J row_end,
+                                                                        rocsparse_direction* dir,
+                                                                        J*                   m,
+                                                                        J*                   n,
+                                                                        I*                   nnz,
+                                                                        rocsparse_index_base* base)
+{
+#ifdef ROCSPARSEIO
+    if(row_begin < 0 || row_end < row_begin)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    I                global_nnz;
+    rocsparse_status status = this->import_sparse_csx(dir, m, n, &global_nnz, base);
+    if(status != rocsparse_status_success)
+        return status;
+
+    rocsparseio_status istatus;
+    size_t             sizeof_ptr_type, sizeof_ind_type, sizeof_val_type;
+    istatus = rocsparseio_type_get_size(this->m_ptr_type, &sizeof_ptr_type);
+    ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
+    istatus = rocsparseio_type_get_size(this->m_ind_type, &sizeof_ind_type);
+    ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
+    istatus = rocsparseio_type_get_size(this->m_val_type, &sizeof_val_type);
+    ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
+
+    const size_t slab_begin = std::min(static_cast<size_t>(row_begin), this->m_m);
+    const size_t slab_end   = std::min(static_cast<size_t>(row_end), this->m_m);
+    const size_t ptr_bytes  = (this->m_m + 1) * sizeof_ptr_type;
+    const size_t ind_bytes  = this->m_nnz * sizeof_ind_type;
+    const size_t val_bytes  = this->m_nnz * sizeof_val_type;
+
+    //
+    // rocsparseio does not expose the position of the arrays. They are written last, one
+    // after the other, so they are located from the end of the file. The location is
+    // trusted if the first and last row offsets read there are the expected ones.
+    //
+    std::ifstream in(this->m_filename, std::ios::in | std::ios::binary);
+    in.seekg(0, std::ios::end);
+    const std::streamoff size = in.tellg();
+    const std::streamoff offset
+        = size - static_cast<std::streamoff>(ptr_bytes + ind_bytes + val_bytes);
+
+    auto read_ptr = [&](size_t i, int64_t& x) {
+        char bytes[sizeof(int64_t)];
+        in.seekg(offset + i * sizeof_ptr_type);
+        in.read(bytes, sizeof_ptr_type);
+        return in ? rocsparseio_copy_indices(this->m_ptr_type, 1, &x, bytes)
+                  : rocsparse_status_internal_error;
+    };
+
+    int64_t first, last, bounds[2];
+    if(offset >= 0 && read_ptr(0, first) == rocsparse_status_success
+       && read_ptr(this->m_m, last) == rocsparse_status_success
+       && first == static_cast<int64_t>(*base)
+       && last == static_cast<int64_t>(this->m_nnz) + static_cast<int64_t>(*base))
+    {
+        status = read_ptr(slab_begin, bounds[0]);
+        if(status != rocsparse_status_success)
+            return status;
+        status = read_ptr(slab_end, bounds[1]);
+        if(status != rocsparse_status_success)
+            return status;
+
+        bounds[0] -= static_cast<int64_t>(*base);
+        bounds[1] -= static_cast<int64_t>(*base);
+        if(bounds[0] < 0 || bounds[1] < bounds[0]
+           || static_cast<size_t>(bounds[1]) > this->m_nnz)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        this->m_slab_ptr.resize((slab_end - slab_begin + 1) * sizeof_ptr_type);
+        this->m_slab_ind.resize((bounds[1] - bounds[0]) * sizeof_ind_type);
+        this->m_slab_val.resize((bounds[1] - bounds[0]) * sizeof_val_type);
+
+        in.seekg(offset + slab_begin * sizeof_ptr_type);
+        in.read(this->m_slab_ptr.data(), this->m_slab_ptr.size());
+        in.seekg(offset + ptr_bytes + bounds[0] * sizeof_ind_type);
+        in.read(this->m_slab_ind.data(), this->m_slab_ind.size());
+        in.seekg(offset + ptr_bytes + ind_bytes + bounds[0] * sizeof_val_type);
+        in.read(this->m_slab_val.data(), this->m_slab_val.size());
+        if(!in)
+        {
+            std::cerr << "cannot read rows from file '" << this->m_filename << "'" << std::endl;
+            return rocsparse_status_internal_error;
+        }
+    }
+    else
+    {
+        //
+        // Otherwise the matrix is read at once and only the slab is kept.
+        //
+        std::vector<char> tmp_ptr(ptr_bytes);
+        std::vector<char> tmp_ind(ind_bytes);
+        std::vector<char> tmp_val(val_bytes);
+        istatus = rocsparseiox_read_sparse_csx(
+            this->m_handle, tmp_ptr.data(), tmp_ind.data(), tmp_val.data());
+        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
+
+        status = rocsparseio_copy_indices(
+            this->m_ptr_type, 1, &bounds[0], tmp_ptr.data() + slab_begin * sizeof_ptr_type);
+        if(status != rocsparse_status_success)
+            return status;
+        status = rocsparseio_copy_indices(
+            this->m_ptr_type, 1, &bounds[1], tmp_ptr.data() + slab_end * sizeof_ptr_type);
+        if(status != rocsparse_status_success)
+            return status;
+
+        bounds[0] -= static_cast<int64_t>(*base);
+        bounds[1] -= static_cast<int64_t>(*base);
+        if(bounds[0] < 0 || bounds[1] < bounds[0]
+           || static_cast<size_t>(bounds[1]) > this->m_nnz)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        this->m_slab_ptr.assign(tmp_ptr.data() + slab_begin * sizeof_ptr_type,
+                                tmp_ptr.data() + (slab_end + 1) * sizeof_ptr_type);
+        this->m_slab_ind.assign(tmp_ind.data() + bounds[0] * sizeof_ind_type,
+                                tmp_ind.data() + bounds[1] * sizeof_ind_type);
+        this->m_slab_val.assign(tmp_val.data() + bounds[0] * sizeof_val_type,
+                                tmp_val.data() + bounds[1] * sizeof_val_type);
+    }
+
+    this->m_nnz_begin = bounds[0];
+    this->m_slab_m    = slab_end - slab_begin;
+    this->m_slab_nnz  = bounds[1] - bounds[0];
+
+    return rocsparse_type_conversion(this->m_slab_nnz, nnz[0]);
+#else
+    return rocsparse_status_not_implemented;
+#endif
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx_rows(I* ptr, J* ind, T* val)
+{
+#ifdef ROCSPARSEIO
+    rocsparse_status status;
+    status = rocsparseio_copy_indices(
+        this->m_ptr_type, this->m_slab_m + 1, ptr, this->m_slab_ptr.data());
+    if(status != rocsparse_status_success)
+        return status;
+    status = rocsparseio_copy_indices(
+        this->m_ind_type, this->m_slab_nnz, ind, this->m_slab_ind.data());
+    if(status != rocsparse_status_success)
+        return status;
+    status = rocsparseio_copy_values(
+        this->m_val_type, this->m_slab_nnz, val, this->m_slab_val.data());
+    if(status != rocsparse_status_success)
+        return status;
+
+    const I shift = static_cast<I>(this->m_nnz_begin);
+    for(size_t i = 0; i <= this->m_slab_m; ++i)
+    {
+        ptr[i] -= shift;
+    }
+
+    this->m_slab_ptr.clear();
+    this->m_slab_ind.clear();
+    this->m_slab_val.clear();
+    return rocsparse_status_success;
+#else
+    return rocsparse_status_not_implemented;
+#endif
+}
+
+#define INSTANTIATE_TIJ(T, I, J)                                                                  \
+    template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx(I*, J*, T*);      \
+    template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx_rows(I*, J*, T*); \
     template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_gebsx(I*, J*, T*)
 
 #define INSTANTIATE_TI(T, I)                                                     \
@@ -785,10 +1024,12 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx(I* ptr, J* in
     template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_coo( \
         I* m, I* n, int64_t* nnz, rocsparse_index_base* base)
 
-#define INSTANTIATE_IJ(I, J)                                                       \
-    template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx(   \
-        rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                  \
-    template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_gebsx( \
+#define INSTANTIATE_IJ(I, J)                                                          \
+    template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx(      \
+        rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                     \
+    template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx_rows( \
+        J, J, rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);               \
+    template rocsparse_status rocsparse_importer_rocsparseio::import_sparse_gebsx(    \
         rocsparse_direction*, rocsparse_direction*, J*, J*, I*, J*, J*, rocsparse_index_base*)
 
 INSTANTIATE_I(int32_t);
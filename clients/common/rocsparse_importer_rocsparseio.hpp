@@ -97,6 +97,28 @@ public:
 
     template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
     rocsparse_status import_sparse_csx(I* ptr, J* ind, T* val);
+
+private:
+#ifdef ROCSPARSEIO
+    size_t            m_nnz_begin{};
+    size_t            m_slab_m{};
+    size_t            m_slab_nnz{};
+    std::vector<char> m_slab_ptr{};
+    std::vector<char> m_slab_ind{};
+    std::vector<char> m_slab_val{};
+#endif
+public:
+    template <typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(J                     row_begin,
+                                            J                     row_end,
+                                            rocsparse_direction*  dir,
+                                            J*                    m,
+                                            J*                    n,
+                                            I*                    nnz,
+                                            rocsparse_index_base* base);
+
+    template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(I* ptr, J* ind, T* val);
 };
 
 #endif // HEADER
@@ -28,7 +28,7 @@
 
 template <typename I, typename J>
 void host_coo_to_csr(
-    J M, I nnz, const J* coo_row_ind, std::vector<I>& csr_row_ptr, rocsparse_index_base base)
+    J M, I nnz, const J* coo_row_ind, host_vector<I>& csr_row_ptr, rocsparse_index_base base)
 {
     // Resize and initialize csr_row_ptr with zeros
     csr_row_ptr.resize(M + 1, 0);
@@ -47,8 +47,8 @@ void host_coo_to_csr(
 template <typename I, typename J>
 void host_csr_to_coo(J                     M,
                      I                     nnz,
-                     const std::vector<I>& csr_row_ptr,
-                     std::vector<J>&       coo_row_ind,
+                     const host_vector<I>& csr_row_ptr,
+                     host_vector<J>&       coo_row_ind,
                      rocsparse_index_base  base)
 {
     // Resize coo_row_ind
@@ -72,9 +72,9 @@ void host_csr_to_coo(J                     M,
 template <typename I, typename J>
 void host_csr_to_coo_aos(J                     M,
                          I                     nnz,
-                         const std::vector<I>& csr_row_ptr,
-                         const std::vector<J>& csr_col_ind,
-                         std::vector<I>&       coo_ind,
+                         const host_vector<I>& csr_row_ptr,
+                         const host_vector<J>& csr_col_ind,
+                         host_vector<I>&       coo_ind,
                          rocsparse_index_base  base)
 {
     // Resize coo_ind
@@ -98,11 +98,11 @@ void host_csr_to_coo_aos(J                     M,
 
 template <typename I, typename J, typename T>
 void host_csr_to_ell(J                     M,
-                     const std::vector<I>& csr_row_ptr,
-                     const std::vector<J>& csr_col_ind,
-                     const std::vector<T>& csr_val,
-                     std::vector<J>&       ell_col_ind,
-                     std::vector<T>&       ell_val,
+                     const host_vector<I>& csr_row_ptr,
+                     const host_vector<J>& csr_col_ind,
+                     const host_vector<T>& csr_val,
+                     host_vector<J>&       ell_col_ind,
+                     host_vector<T>&       ell_val,
                      J&                    ell_width,
                      rocsparse_index_base  csr_base,
                      rocsparse_index_base  ell_base)
@@ -210,7 +210,7 @@ void rocsparse_init(
 }
 
 template <typename T>
-void rocsparse_init_exact(std::vector<T>& A,
+void rocsparse_init_exact(host_vector<T>& A,
                           size_t          M,
                           size_t          N,
                           size_t          lda,
@@ -224,14 +224,14 @@ void rocsparse_init_exact(std::vector<T>& A,
 
 template <typename T>
 void rocsparse_init(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count, T a, T b)
+    host_vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count, T a, T b)
 {
     rocsparse_init(A.data(), M, N, lda, stride, batch_count, a, b);
 }
 
 // Initializes sparse index vector with nnz entries ranging from start to end
 template <typename I>
-void rocsparse_init_index(std::vector<I>& x, size_t nnz, size_t start, size_t end)
+void rocsparse_init_index(host_vector<I>& x, size_t nnz, size_t start, size_t end)
 {
     std::vector<bool> check(end - start, false);
 
@@ -259,7 +259,7 @@ void rocsparse_init_index(std::vector<I>& x, size_t nnz, size_t start, size_t en
 // mantissa 10 bits.
 template <typename T>
 void rocsparse_init_alternating_sign(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
+    host_vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
 {
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
         for(size_t i = 0; i < M; ++i)
@@ -282,7 +282,7 @@ void rocsparse_init_nan(T* A, size_t N)
 
 template <typename T>
 void rocsparse_init_nan(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
+    host_vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
 {
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
         for(size_t i = 0; i < M; ++i)
@@ -293,9 +293,9 @@ void rocsparse_init_nan(
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
-                               std::vector<I>&      col_ind,
-                               std::vector<T>&      val,
+void rocsparse_init_coo_matrix(host_vector<I>&      row_ind,
+                               host_vector<I>&      col_ind,
+                               host_vector<T>&      val,
                                I                    M,
                                I                    N,
                                int64_t              nnz,
@@ -337,8 +337,23 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
         val.resize(nnz);
     }
 
+    //
+    // The random numbers are drawn from a counter-based generator, addressed by row and by
+    // position, so that the loops over the rows and the non-zeros run in parallel and give the
+    // same matrix for any number of threads. Its seed is drawn from the generator of the clients.
+    //
+    const rocsparse_philox rng(rocsparse_rng_get()());
+    enum : uint32_t
+    {
+        draw_count,
+        draw_sprinkle,
+        draw_column,
+        draw_value,
+        draw_diagonal
+    };
+
     // Generate histogram of non-zero counts per row based on average non-zeros per row
-    std::vector<I> count(M, 0);
+    host_vector<I> count(M, 0);
     I              start = full_rank ? (I)std::min((int64_t)M, nnz) : 0;
     if(full_rank)
     {
@@ -351,10 +366,19 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
     int64_t remaining_nnz   = nnz - start;
     I       avg_nnz_per_row = remaining_nnz / M;
 
+    host_vector<I> nnz_in_rows(M);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I k = 0; k < M; k++)
+    {
+        nnz_in_rows[k]
+            = std::min(rng.uniform_int<I>(k, 0, 0, 2 * avg_nnz_per_row, draw_count), N);
+    }
+
     for(I k = 0; k < M; k++)
     {
-        I nnz_in_row = std::min(random_cached_generator_exact<I>(0, 2 * avg_nnz_per_row), N);
-        nnz_in_row   = (I)std::min(remaining_nnz, (int64_t)nnz_in_row);
+        I nnz_in_row = (I)std::min(remaining_nnz, (int64_t)nnz_in_rows[k]);
 
         count[k] += nnz_in_row;
 
@@ -364,11 +388,11 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
     // Sprinkle any remaining non-zeros amoung the rows
     for(int64_t k = 0; k < remaining_nnz; ++k)
     {
-        I   i       = random_generator_exact<I>(0, M - 1);
+        I   i       = rng.uniform_int<I>(k, 0, 0, M - 1, draw_sprinkle);
         int maxiter = 0;
         while(count[i] >= N && maxiter++ < 10)
         {
-            i = random_generator_exact<I>(0, M - 1);
+            i = rng.uniform_int<I>(k, maxiter, 0, M - 1, draw_sprinkle);
         }
         if(maxiter >= 10)
         {
@@ -388,78 +412,89 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
         count[i] += 1;
     }
 
-    // Compute row index array from non-zeros per row count histogram
-    int64_t offset          = 0;
-    I       max_nnz_per_row = count[0];
+    // Compute the offsets of the rows from non-zeros per row count histogram
+    host_vector<int64_t> offset(M + 1);
+    offset[0]         = 0;
+    I max_nnz_per_row = count[0];
     for(I k = 0; k < M; k++)
     {
-        I nnz_in_row = count[k];
-        if(max_nnz_per_row < nnz_in_row)
-            max_nnz_per_row = nnz_in_row;
-
-        for(I i = 0; i < nnz_in_row; i++)
-        {
-            row_ind[offset + i] = k;
-        }
-
-        offset += nnz_in_row;
+        max_nnz_per_row = std::max(max_nnz_per_row, count[k]);
+        offset[k + 1]   = offset[k] + count[k];
     }
 
-    // Generate column index array with values clustered around the diagonal
-    I              sec = std::min(2 * max_nnz_per_row, N);
-    std::vector<I> random(2 * sec + 1);
-    int64_t        at = 0;
-    for(I i = 0; i < M; ++i)
+    // Generate row and column index arrays with column values clustered around the diagonal
+    I sec = std::min(2 * max_nnz_per_row, N);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        int64_t begin      = at;
-        I       nnz_in_row = count[i];
-        I       bmax       = std::min(i + sec, N - 1);
-        I       bmin       = std::max(bmax - 2 * sec, ((I)0));
+        host_vector<I> random(2 * sec + 1);
 
-        // Initial permutation of column indices
-        for(I k = 0; k <= (bmax - bmin); ++k)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(I i = 0; i < M; ++i)
         {
-            random[k] = k;
-        }
+            int64_t begin      = offset[i];
+            int64_t at         = begin;
+            I       nnz_in_row = count[i];
+            I       bmax       = std::min(i + sec, N - 1);
+            I       bmin       = std::max(bmax - 2 * sec, ((I)0));
 
-        // shuffle permutation
-        for(I k = 0; k < nnz_in_row; ++k)
-        {
-            std::swap(random[k], random[random_generator_exact<I>(0, bmax - bmin)]);
-        }
+            for(I k = 0; k < nnz_in_row; ++k)
+            {
+                row_ind[begin + k] = i;
+            }
 
-        if(full_rank)
-        {
-            col_ind[at++] = i;
-            for(I k = 1; k < nnz_in_row; ++k)
+            // Initial permutation of column indices
+            for(I k = 0; k <= (bmax - bmin); ++k)
+            {
+                random[k] = k;
+            }
+
+            // shuffle permutation
+            for(I k = 0; k < nnz_in_row; ++k)
+            {
+                std::swap(random[k],
+                          random[rng.uniform_int<I>(i, k, 0, bmax - bmin, draw_column)]);
+            }
+
+            if(full_rank)
             {
-                if(bmin + random[k] == i)
+                col_ind[at++] = i;
+                for(I k = 1; k < nnz_in_row; ++k)
                 {
-                    col_ind[at++] = bmin + random[bmax - bmin];
+                    if(bmin + random[k] == i)
+                    {
+                        col_ind[at++] = bmin + random[bmax - bmin];
+                    }
+                    else
+                    {
+                        col_ind[at++] = bmin + random[k];
+                    }
                 }
-                else
+            }
+            else
+            {
+                for(I k = 0; k < nnz_in_row; ++k)
                 {
                     col_ind[at++] = bmin + random[k];
                 }
             }
-        }
-        else
-        {
-            for(I k = 0; k < nnz_in_row; ++k)
+
+            if(nnz_in_row > 0)
             {
-                col_ind[at++] = bmin + random[k];
+                std::sort(col_ind.data() + begin, col_ind.data() + begin + nnz_in_row);
             }
         }
-
-        if(nnz_in_row > 0)
-        {
-            std::sort(col_ind.data() + begin, col_ind.data() + begin + nnz_in_row);
-        }
     }
 
     // Correct index base accordingly
     if(base == rocsparse_index_base_one)
     {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int64_t i = 0; i < nnz; ++i)
         {
             ++row_ind[i];
@@ -467,40 +502,55 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
         }
     }
 
+    // Sample the values, addressed by their position
     if(to_int)
     {
-        // Sample random values
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int64_t i = 0; i < nnz; ++i)
         {
-            val[i] = random_cached_generator_exact<T>();
+            val[i] = random_philox_generator_exact<T>(rng, i, draw_value);
         }
     }
     else
     {
         if(full_rank)
         {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
             for(int64_t i = 0; i < nnz; ++i)
             {
                 if(row_ind[i] == col_ind[i])
                 {
                     // Sample diagonal values
-                    val[i] = random_cached_generator<T>(static_cast<T>(4.0), static_cast<T>(8.0));
+                    val[i] = random_philox_generator<T>(
+                        rng, i, draw_value, static_cast<T>(4.0), static_cast<T>(8.0));
                     val[i] += val[i]
-                              * random_cached_generator<T>(static_cast<T>(-1.0e-2),
+                              * random_philox_generator<T>(rng,
+                                                           i,
+                                                           draw_diagonal,
+                                                           static_cast<T>(-1.0e-2),
                                                            static_cast<T>(1.0e-2));
                 }
                 else
                 {
                     // Samples off-diagonal values
-                    val[i] = random_cached_generator<T>(static_cast<T>(-0.5), static_cast<T>(0.5));
+                    val[i] = random_philox_generator<T>(
+                        rng, i, draw_value, static_cast<T>(-0.5), static_cast<T>(0.5));
                 }
             }
         }
         else
         {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
             for(int64_t i = 0; i < nnz; ++i)
             {
-                val[i] = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
+                val[i] = random_philox_generator<T>(
+                    rng, i, draw_value, static_cast<T>(-1.0), static_cast<T>(1.0));
             }
         }
     }
@@ -509,9 +559,9 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate 2D 9pt laplacian on unit square in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_laplace2d(std::vector<I>&      row_ptr,
-                                  std::vector<J>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_csr_laplace2d(host_vector<I>&      row_ptr,
+                                  host_vector<J>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   J&                   M,
@@ -582,9 +632,9 @@ void rocsparse_init_csr_laplace2d(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate 2D 9pt laplacian on unit square in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_laplace2d(std::vector<I>&      row_ind,
-                                  std::vector<I>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_coo_laplace2d(host_vector<I>&      row_ind,
+                                  host_vector<I>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   I&                   M,
@@ -593,7 +643,7 @@ void rocsparse_init_coo_laplace2d(std::vector<I>&      row_ind,
                                   rocsparse_index_base base)
 {
     // Always load using int64 as we dont know ahead of time how many nnz exist in matrix
-    std::vector<int64_t> row_ptr;
+    host_vector<int64_t> row_ptr;
 
     // Sample CSR matrix
     rocsparse_init_csr_laplace2d(row_ptr, col_ind, val, dim_x, dim_y, M, N, nnz, base);
@@ -605,9 +655,9 @@ void rocsparse_init_coo_laplace2d(std::vector<I>&      row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate 2D 9pt laplacian on unit square in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_laplace2d(std::vector<I>&      row_ptr,
-                                    std::vector<J>&      col_ind,
-                                    std::vector<T>&      val,
+void rocsparse_init_gebsr_laplace2d(host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
                                     int32_t              dim_x,
                                     int32_t              dim_y,
                                     J&                   Mb,
@@ -630,8 +680,8 @@ void rocsparse_init_gebsr_laplace2d(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate 2D 9pt laplacian on unit square in ELL format */
 template <typename I, typename T>
-void rocsparse_init_ell_laplace2d(std::vector<I>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_ell_laplace2d(host_vector<I>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   I&                   M,
@@ -641,9 +691,9 @@ void rocsparse_init_ell_laplace2d(std::vector<I>&      col_ind,
 {
     I csr_nnz;
 
-    std::vector<I> csr_row_ptr;
-    std::vector<I> csr_col_ind;
-    std::vector<T> csr_val;
+    host_vector<I> csr_row_ptr;
+    host_vector<I> csr_col_ind;
+    host_vector<T> csr_val;
 
     // Sample CSR matrix
     rocsparse_init_csr_laplace2d(
@@ -656,9 +706,9 @@ void rocsparse_init_ell_laplace2d(std::vector<I>&      col_ind,
 /* ==================================================================================== */
 /*! \brief  Generate 3D 27pt laplacian on unit square in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_laplace3d(std::vector<I>&      row_ptr,
-                                  std::vector<J>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_csr_laplace3d(host_vector<I>&      row_ptr,
+                                  host_vector<J>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   int32_t              dim_z,
@@ -739,9 +789,9 @@ void rocsparse_init_csr_laplace3d(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate 3D 27pt laplacian on unit square in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_laplace3d(std::vector<I>&      row_ind,
-                                  std::vector<I>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_coo_laplace3d(host_vector<I>&      row_ind,
+                                  host_vector<I>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   int32_t              dim_z,
@@ -751,7 +801,7 @@ void rocsparse_init_coo_laplace3d(std::vector<I>&      row_ind,
                                   rocsparse_index_base base)
 {
     // Always load using int64 as we dont know ahead of time how many nnz exist in matrix
-    std::vector<int64_t> row_ptr;
+    host_vector<int64_t> row_ptr;
 
     // Sample CSR matrix
     rocsparse_init_csr_laplace3d(row_ptr, col_ind, val, dim_x, dim_y, dim_z, M, N, nnz, base);
@@ -763,9 +813,9 @@ void rocsparse_init_coo_laplace3d(std::vector<I>&      row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate 3D 27pt laplacian on unit square in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_laplace3d(std::vector<I>&      row_ptr,
-                                    std::vector<J>&      col_ind,
-                                    std::vector<T>&      val,
+void rocsparse_init_gebsr_laplace3d(host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
                                     int32_t              dim_x,
                                     int32_t              dim_y,
                                     int32_t              dim_z,
@@ -787,235 +837,721 @@ void rocsparse_init_gebsr_laplace3d(std::vector<I>&      row_ptr,
 }
 
 /* ==================================================================================== */
-/*! \brief  Read matrix from mtx file in CSR format */
-template <typename I, typename J, typename T>
-void rocsparse_init_csr_mtx(const char*          filename,
-                            std::vector<I>&      csr_row_ptr,
-                            std::vector<J>&      csr_col_ind,
-                            std::vector<T>&      csr_val,
-                            J&                   M,
-                            J&                   N,
-                            I&                   nnz,
-                            rocsparse_index_base base)
+/*! \brief  Random permutation of [0, n) and its inverse. Each image is evaluated
+ *  independently by a Feistel network of the counter-based generator, walking the cycle
+ *  until it falls into [0, n), so that the permutation is computed in parallel and does
+ *  not depend on the number of threads. */
+template <typename J>
+static void
+    rocsparse_init_random_permutation(int64_t n, host_vector<J>& perm, host_vector<J>& iperm)
 {
-    I       coo_M, coo_N;
-    int64_t coo_nnz;
-
-    std::vector<I> coo_row_ind;
-    std::vector<I> coo_col_ind;
-
-    // Read COO matrix
-    rocsparse_init_coo_mtx(
-        filename, coo_row_ind, coo_col_ind, csr_val, coo_M, coo_N, coo_nnz, base);
-
-    // Convert to CSR
-    M   = (J)coo_M;
-    N   = (J)coo_N;
-    nnz = (I)coo_nnz;
+    const rocsparse_philox rng(rocsparse_rng_get()());
 
-    csr_row_ptr.resize(M + 1);
-    csr_col_ind.resize(nnz);
+    int half = 1;
+    while((int64_t(1) << (2 * half)) < n)
+    {
+        ++half;
+    }
+    const uint64_t mask = (uint64_t(1) << half) - 1;
 
-    host_coo_to_csr(coo_M, nnz, coo_row_ind.data(), csr_row_ptr, base);
+    const auto feistel = [&](uint64_t x) {
+        uint64_t l = x >> half;
+        uint64_t r = x & mask;
+        for(uint32_t round = 0; round < 4; ++round)
+        {
+            uint32_t f[4];
+            rng.generate(r, round, 0, f);
+            const uint64_t t = l ^ (((uint64_t(f[0]) << 32) | f[1]) & mask);
+            l                = r;
+            r                = t;
+        }
+        return (l << half) | r;
+    };
 
-    for(I i = 0; i < nnz; ++i)
+    perm.resize(n);
+    iperm.resize(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t i = 0; i < n; ++i)
     {
-        csr_col_ind[i] = (J)coo_col_ind[i];
+        uint64_t y = feistel(i);
+        while(y >= uint64_t(n))
+        {
+            y = feistel(y);
+        }
+        perm[i] = static_cast<J>(y);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t i = 0; i < n; ++i)
+    {
+        iperm[perm[i]] = static_cast<J>(i);
     }
 }
 
-/* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
-template <typename I, typename T>
-void rocsparse_init_coo_mtx(const char*          filename,
-                            std::vector<I>&      coo_row_ind,
-                            std::vector<I>&      coo_col_ind,
-                            std::vector<T>&      coo_val,
-                            I&                   M,
-                            I&                   N,
-                            int64_t&             nnz,
-                            rocsparse_index_base base)
+/* ==================================================================================== */
+/*! \brief  Nodes of a 3D 7, 19 or 27 point stencil on a dim_x * dim_y * dim_z grid,
+ *  optionally renumbered by a random permutation. */
+template <typename J>
+struct rocsparse_stencil3d_nodes
 {
-    rocsparse_importer_matrixmarket importer(filename);
-    rocsparse_status                status
-        = rocsparse_import_sparse_coo(importer, coo_row_ind, coo_col_ind, coo_val, M, N, nnz, base);
-    CHECK_ROCSPARSE_THROW_ERROR(status);
-}
+    int64_t        dim_x;
+    int64_t        dim_y;
+    int64_t        dim_z;
+    int32_t        points;
+    host_vector<J> perm;
+    host_vector<J> iperm;
+
+    rocsparse_stencil3d_nodes(
+        int32_t dim_x_, int32_t dim_y_, int32_t dim_z_, int32_t points_, bool permute)
+        : dim_x(dim_x_)
+        , dim_y(dim_y_)
+        , dim_z(dim_z_)
+        , points(points_)
+    {
+        if(permute)
+        {
+            rocsparse_init_random_permutation(this->size(), this->perm, this->iperm);
+        }
+    }
 
-/* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in GEBSR format */
-template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_mtx(const char*          filename,
-                              std::vector<I>&      bsr_row_ptr,
-                              std::vector<J>&      bsr_col_ind,
-                              std::vector<T>&      bsr_val,
-                              J&                   Mb,
-                              J&                   Nb,
-                              I&                   nnzb,
-                              J                    row_block_dim,
-                              J                    col_block_dim,
-                              rocsparse_index_base base)
-{
-    //this->init_csr(bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
-    rocsparse_init_csr_mtx(filename, bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+    int64_t size() const
+    {
+        return dim_x * dim_y * dim_z;
+    }
 
-    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
-    bsr_val.resize(nvalues);
-    for(size_t i = 0; i < nvalues; ++i)
+    //
+    // Number of neighbours of the node numbered row.
+    //
+    int32_t count(int64_t row) const
     {
-        bsr_val[i] = random_cached_generator<T>();
+        const int64_t node = this->iperm.empty() ? row : int64_t(this->iperm[row]);
+        const int64_t ix   = node % dim_x;
+        const int64_t iy   = (node / dim_x) % dim_y;
+        const int64_t iz   = node / (dim_x * dim_y);
+
+        // Neighbours along each direction, the node included
+        const int32_t nx = 1 + (ix > 0) + (ix < dim_x - 1);
+        const int32_t ny = 1 + (iy > 0) + (iy < dim_y - 1);
+        const int32_t nz = 1 + (iz > 0) + (iz < dim_z - 1);
+
+        switch(points)
+        {
+        case 7:
+            return nx + ny + nz - 2;
+        case 19:
+            return nx * ny * nz - (nx - 1) * (ny - 1) * (nz - 1);
+        default:
+            return nx * ny * nz;
+        }
     }
-}
 
-template <typename I, typename J, typename T>
-void rocsparse_init_csr_rocalution(const char*          filename,
-                                   std::vector<I>&      row_ptr,
-                                   std::vector<J>&      col_ind,
-                                   std::vector<T>&      val,
-                                   J&                   M,
-                                   J&                   N,
-                                   I&                   nnz,
-                                   rocsparse_index_base base)
-{
-    rocsparse_importer_rocalution importer(filename);
-    rocsparse_status              status
-        = rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base);
-    CHECK_ROCSPARSE_THROW_ERROR(status);
-}
+    //
+    // Neighbours of the node numbered row, in increasing order of their numbers, with the
+    // weights of the stencil: points - 1 on the diagonal and -1 off the diagonal.
+    //
+    int32_t neighbours(int64_t row, int64_t* col, int32_t* weight) const
+    {
+        const int64_t node = this->iperm.empty() ? row : int64_t(this->iperm[row]);
+        const int64_t ix   = node % dim_x;
+        const int64_t iy   = (node / dim_x) % dim_y;
+        const int64_t iz   = node / (dim_x * dim_y);
 
-/* ==================================================================================== */
-/*! \brief  Read matrix from binary file in rocALUTION format */
-template <typename I, typename T>
-void rocsparse_init_coo_rocalution(const char*          filename,
-                                   std::vector<I>&      row_ind,
-                                   std::vector<I>&      col_ind,
-                                   std::vector<T>&      val,
-                                   I&                   M,
-                                   I&                   N,
-                                   int64_t&             nnz,
-                                   rocsparse_index_base base)
-{
-    I              csr_nnz = 0;
-    std::vector<I> row_ptr(M + 1);
+        int32_t count = 0;
+        for(int32_t sz = -1; sz <= 1; ++sz)
+        {
+            for(int32_t sy = -1; sy <= 1; ++sy)
+            {
+                for(int32_t sx = -1; sx <= 1; ++sx)
+                {
+                    const int32_t dist = std::abs(sx) + std::abs(sy) + std::abs(sz);
+                    if((points == 7 && dist > 1) || (points == 19 && dist > 2))
+                    {
+                        continue;
+                    }
 
-    // Sample CSR matrix
-    rocsparse_init_csr_rocalution(filename, row_ptr, col_ind, val, M, N, csr_nnz, base);
+                    if(ix + sx < 0 || ix + sx >= dim_x || iy + sy < 0 || iy + sy >= dim_y
+                       || iz + sz < 0 || iz + sz >= dim_z)
+                    {
+                        continue;
+                    }
 
-    host_csr_to_coo(M, csr_nnz, row_ptr, row_ind, base);
-    nnz = csr_nnz;
-}
+                    const int64_t nb = node + (sz * dim_y + sy) * dim_x + sx;
 
-/* ==================================================================================== */
-/*! \brief  Read matrix from binary file in rocALUTION format */
-template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_rocalution(const char*          filename,
-                                     std::vector<I>&      row_ptr,
-                                     std::vector<J>&      col_ind,
-                                     std::vector<T>&      val,
-                                     J&                   Mb,
-                                     J&                   Nb,
-                                     I&                   nnzb,
-                                     J                    row_block_dim,
-                                     J                    col_block_dim,
-                                     rocsparse_index_base base)
-{
-    // Temporarily the file contains a CSR matrix.
-    rocsparse_init_csr_rocalution(filename, row_ptr, col_ind, val, Mb, Nb, nnzb, base);
+                    col[count]    = this->perm.empty() ? nb : int64_t(this->perm[nb]);
+                    weight[count] = (dist == 0) ? points - 1 : -1;
+                    ++count;
+                }
+            }
+        }
 
-    // Then temporarily skip the values.
-    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
-    val.resize(nvalues);
-    for(size_t i = 0; i < nvalues; ++i)
-    {
-        val[i] = random_cached_generator<T>();
-    }
-}
+        // Sort the renumbered neighbours
+        for(int32_t k = 1; k < count; ++k)
+        {
+            for(int32_t p = k; p > 0 && col[p - 1] > col[p]; --p)
+            {
+                std::swap(col[p - 1], col[p]);
+                std::swap(weight[p - 1], weight[p]);
+            }
+        }
 
-/* ==================================================================================== */
-/*! \brief  Read matrix from binary file in rocSPARSEIO format */
-template <typename I, typename J, typename T>
-void rocsparse_init_csr_rocsparseio(const char*          filename,
-                                    std::vector<I>&      row_ptr,
-                                    std::vector<J>&      col_ind,
-                                    std::vector<T>&      val,
-                                    J&                   M,
-                                    J&                   N,
-                                    I&                   nnz,
-                                    rocsparse_index_base base)
-{
-    rocsparse_importer_rocsparseio importer(filename);
-    rocsparse_status               status
-        = rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base);
-    CHECK_ROCSPARSE_THROW_ERROR(status);
-}
+        return count;
+    }
+};
 
 /* ==================================================================================== */
-/*! \brief  Read matrix from binary file in rocSPARSEIO format */
-template <typename I, typename T>
-void rocsparse_init_coo_rocsparseio(const char*          filename,
-                                    std::vector<I>&      row_ind,
-                                    std::vector<I>&      col_ind,
-                                    std::vector<T>&      val,
-                                    I&                   M,
-                                    I&                   N,
-                                    int64_t&             nnz,
-                                    rocsparse_index_base base)
+/*! \brief  Value of the entry (a, b) of the block coupling two nodes, weight * B(a, b) with
+ *  B = I + ones, such that the matrix is the Kronecker product of two symmetric positive
+ *  definite matrices. */
+template <typename T>
+static inline T rocsparse_stencil3d_value(int32_t weight, int64_t a, int64_t b)
 {
-    rocsparse_importer_rocsparseio importer(filename);
-    rocsparse_status               status
-        = rocsparse_import_sparse_coo(importer, row_ind, col_ind, val, M, N, nnz, base);
-    CHECK_ROCSPARSE_THROW_ERROR(status);
+    return static_cast<T>(static_cast<double>(weight * (a == b ? 2 : 1)));
 }
 
-/* ==================================================================================== */
-/*! \brief  Read matrix from binary file in rocSPARSEIO format */
-template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_rocsparseio(const char*          filename,
-                                      std::vector<I>&      row_ptr,
-                                      std::vector<J>&      col_ind,
-                                      std::vector<T>&      val,
-                                      rocsparse_direction  dir,
-                                      J&                   Mb,
-                                      J&                   Nb,
-                                      I&                   nnzb,
-                                      J                    row_block_dim,
-                                      J                    col_block_dim,
-                                      rocsparse_index_base base)
+static bool rocsparse_stencil3d_check(int32_t points, int32_t dof)
 {
-    rocsparse_direction            import_dir = {};
-    rocsparse_importer_rocsparseio importer(filename);
-    rocsparse_status               status = rocsparse_import_sparse_gebsr(importer,
-                                                            row_ptr,
-                                                            col_ind,
-                                                            val,
-                                                            import_dir,
-                                                            Mb,
-                                                            Nb,
-                                                            nnzb,
-                                                            row_block_dim,
-                                                            col_block_dim,
-                                                            base);
-    CHECK_ROCSPARSE_THROW_ERROR(status);
+    if(points != 7 && points != 19 && points != 27)
+    {
+        std::cerr << "ERROR: stencil must have 7, 19 or 27 points" << std::endl;
+        return false;
+    }
 
-    if(import_dir != dir)
+    if(dof < 1)
     {
-        std::cerr << "TODO, reorder ?" << std::endl;
-        exit(1);
+        std::cerr << "ERROR: dof < 1" << std::endl;
+        return false;
     }
+
+    return true;
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate a random sparse matrix in CSR format */
+/*! \brief  Generate 3D 7, 19 or 27pt stencil with dof unknowns per node in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_random(std::vector<I>&            csr_row_ptr,
-                               std::vector<J>&            csr_col_ind,
-                               std::vector<T>&            csr_val,
-                               J                          M,
-                               J                          N,
-                               I&                         nnz,
-                               rocsparse_index_base       base,
-                               rocsparse_matrix_init_kind init_kind,
-                               bool                       full_rank,
+void rocsparse_init_csr_stencil3d(host_vector<I>&      row_ptr,
+                                  host_vector<J>&      col_ind,
+                                  host_vector<T>&      val,
+                                  int32_t              dim_x,
+                                  int32_t              dim_y,
+                                  int32_t              dim_z,
+                                  int32_t              points,
+                                  int32_t              dof,
+                                  bool                 permute,
+                                  J&                   M,
+                                  J&                   N,
+                                  I&                   nnz,
+                                  rocsparse_index_base base)
+{
+    // Do nothing
+    if(dim_x == 0 || dim_y == 0 || dim_z == 0 || !rocsparse_stencil3d_check(points, dof))
+    {
+        return;
+    }
+
+    const rocsparse_stencil3d_nodes<J> nodes(dim_x, dim_y, dim_z, points, permute);
+    const int64_t                      nnodes = nodes.size();
+
+    // Number of blocks per node row
+    host_vector<int64_t> node_ptr(nnodes + 1);
+    node_ptr[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t r = 0; r < nnodes; ++r)
+    {
+        node_ptr[r + 1] = nodes.count(r);
+    }
+    for(int64_t r = 0; r < nnodes; ++r)
+    {
+        node_ptr[r + 1] += node_ptr[r];
+    }
+
+    const int64_t total_nnz = node_ptr[nnodes] * dof * dof;
+    if(std::is_same<J, int32_t>() && nnodes * dof > std::numeric_limits<int32_t>::max())
+    {
+        std::cerr << "Error: Attempting to create CSR stencil matrix with more than "
+                  << std::numeric_limits<int32_t>::max()
+                  << " rows while using int32_t column indexing." << std::endl;
+        exit(1);
+    }
+
+    if(std::is_same<I, int32_t>() && total_nnz > std::numeric_limits<int32_t>::max())
+    {
+        std::cerr << "Error: Attempting to create CSR stencil matrix with more than "
+                  << std::numeric_limits<int32_t>::max()
+                  << " non-zeros while using int32_t row indexing." << std::endl;
+        exit(1);
+    }
+
+    M   = static_cast<J>(nnodes * dof);
+    N   = M;
+    nnz = static_cast<I>(total_nnz);
+
+    row_ptr.resize(M + 1);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+    row_ptr[M] = nnz + base;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t r = 0; r < nnodes; ++r)
+    {
+        int64_t       col[27];
+        int32_t       weight[27];
+        const int32_t count = nodes.neighbours(r, col, weight);
+
+        for(int64_t a = 0; a < dof; ++a)
+        {
+            const int64_t start = node_ptr[r] * dof * dof + a * count * dof;
+            row_ptr[r * dof + a] = static_cast<I>(start + base);
+
+            int64_t idx = start;
+            for(int32_t k = 0; k < count; ++k)
+            {
+                for(int64_t b = 0; b < dof; ++b)
+                {
+                    col_ind[idx] = static_cast<J>(col[k] * dof + b + base);
+                    val[idx]     = rocsparse_stencil3d_value<T>(weight[k], a, b);
+                    ++idx;
+                }
+            }
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate 3D 7, 19 or 27pt stencil with dof unknowns per node in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_stencil3d(host_vector<I>&      row_ind,
+                                  host_vector<I>&      col_ind,
+                                  host_vector<T>&      val,
+                                  int32_t              dim_x,
+                                  int32_t              dim_y,
+                                  int32_t              dim_z,
+                                  int32_t              points,
+                                  int32_t              dof,
+                                  bool                 permute,
+                                  I&                   M,
+                                  I&                   N,
+                                  int64_t&             nnz,
+                                  rocsparse_index_base base)
+{
+    host_vector<int64_t> row_ptr;
+
+    // Sample CSR matrix
+    rocsparse_init_csr_stencil3d(
+        row_ptr, col_ind, val, dim_x, dim_y, dim_z, points, dof, permute, M, N, nnz, base);
+
+    // Expand the row pointers
+    row_ind.resize(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        for(int64_t k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+        {
+            row_ind[k] = i + base;
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate 3D 7, 19 or 27pt stencil in GEBSR format, each node being a block.
+ *  With row_block_dim = col_block_dim = dof, this is the CSR matrix of
+ *  rocsparse_init_csr_stencil3d. */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_stencil3d(host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
+                                    rocsparse_direction  dir,
+                                    int32_t              dim_x,
+                                    int32_t              dim_y,
+                                    int32_t              dim_z,
+                                    int32_t              points,
+                                    bool                 permute,
+                                    J&                   Mb,
+                                    J&                   Nb,
+                                    I&                   nnzb,
+                                    J                    row_block_dim,
+                                    J                    col_block_dim,
+                                    rocsparse_index_base base)
+{
+    // Do nothing
+    if(dim_x == 0 || dim_y == 0 || dim_z == 0 || !rocsparse_stencil3d_check(points, 1))
+    {
+        return;
+    }
+
+    const rocsparse_stencil3d_nodes<J> nodes(dim_x, dim_y, dim_z, points, permute);
+
+    Mb = static_cast<J>(nodes.size());
+    Nb = Mb;
+
+    row_ptr.resize(Mb + 1);
+    row_ptr[0] = base;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J r = 0; r < Mb; ++r)
+    {
+        row_ptr[r + 1] = nodes.count(r);
+    }
+    for(J r = 0; r < Mb; ++r)
+    {
+        row_ptr[r + 1] += row_ptr[r];
+    }
+
+    nnzb = row_ptr[Mb] - base;
+
+    const int64_t block_size = int64_t(row_block_dim) * col_block_dim;
+    col_ind.resize(nnzb);
+    val.resize(nnzb * block_size);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J r = 0; r < Mb; ++r)
+    {
+        int64_t       col[27];
+        int32_t       weight[27];
+        const int32_t count = nodes.neighbours(r, col, weight);
+
+        for(int32_t k = 0; k < count; ++k)
+        {
+            const int64_t idx = row_ptr[r] - base + k;
+            col_ind[idx]      = static_cast<J>(col[k] + base);
+
+            T* block = val.data() + idx * block_size;
+            for(J a = 0; a < row_block_dim; ++a)
+            {
+                for(J b = 0; b < col_block_dim; ++b)
+                {
+                    block[dir == rocsparse_direction_row ? a * col_block_dim + b
+                                                         : b * row_block_dim + a]
+                        = rocsparse_stencil3d_value<T>(weight[k], a, b);
+                }
+            }
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from mtx file in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_mtx(const char*          filename,
+                            host_vector<I>&      csr_row_ptr,
+                            host_vector<J>&      csr_col_ind,
+                            host_vector<T>&      csr_val,
+                            J&                   M,
+                            J&                   N,
+                            I&                   nnz,
+                            rocsparse_index_base base)
+{
+    rocsparse_importer_matrixmarket importer(filename);
+    rocsparse_status                status
+        = rocsparse_import_sparse_csr(importer, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_mtx(const char*          filename,
+                            host_vector<I>&      coo_row_ind,
+                            host_vector<I>&      coo_col_ind,
+                            host_vector<T>&      coo_val,
+                            I&                   M,
+                            I&                   N,
+                            int64_t&             nnz,
+                            rocsparse_index_base base)
+{
+    rocsparse_importer_matrixmarket importer(filename);
+    rocsparse_status                status
+        = rocsparse_import_sparse_coo(importer, coo_row_ind, coo_col_ind, coo_val, M, N, nnz, base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_mtx(const char*          filename,
+                              host_vector<I>&      bsr_row_ptr,
+                              host_vector<J>&      bsr_col_ind,
+                              host_vector<T>&      bsr_val,
+                              J&                   Mb,
+                              J&                   Nb,
+                              I&                   nnzb,
+                              J                    row_block_dim,
+                              J                    col_block_dim,
+                              rocsparse_index_base base)
+{
+    // The pattern of the file is the block pattern, as in rocsparse_init_gebsr_rocalution.
+    rocsparse_init_csr_mtx(filename, bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+
+    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
+    bsr_val.resize(nvalues);
+    for(size_t i = 0; i < nvalues; ++i)
+    {
+        bsr_val[i] = random_cached_generator<T>();
+    }
+}
+
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rocalution(const char*          filename,
+                                   host_vector<I>&      row_ptr,
+                                   host_vector<J>&      col_ind,
+                                   host_vector<T>&      val,
+                                   J&                   M,
+                                   J&                   N,
+                                   I&                   nnz,
+                                   rocsparse_index_base base)
+{
+    rocsparse_importer_rocalution importer(filename);
+    rocsparse_status              status
+        = rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from binary file in rocALUTION format */
+template <typename I, typename T>
+void rocsparse_init_coo_rocalution(const char*          filename,
+                                   host_vector<I>&      row_ind,
+                                   host_vector<I>&      col_ind,
+                                   host_vector<T>&      val,
+                                   I&                   M,
+                                   I&                   N,
+                                   int64_t&             nnz,
+                                   rocsparse_index_base base)
+{
+    I              csr_nnz = 0;
+    host_vector<I> row_ptr(M + 1);
+
+    // Sample CSR matrix
+    rocsparse_init_csr_rocalution(filename, row_ptr, col_ind, val, M, N, csr_nnz, base);
+
+    host_csr_to_coo(M, csr_nnz, row_ptr, row_ind, base);
+    nnz = csr_nnz;
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from binary file in rocALUTION format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_rocalution(const char*          filename,
+                                     host_vector<I>&      row_ptr,
+                                     host_vector<J>&      col_ind,
+                                     host_vector<T>&      val,
+                                     J&                   Mb,
+                                     J&                   Nb,
+                                     I&                   nnzb,
+                                     J                    row_block_dim,
+                                     J                    col_block_dim,
+                                     rocsparse_index_base base)
+{
+    // Temporarily the file contains a CSR matrix.
+    rocsparse_init_csr_rocalution(filename, row_ptr, col_ind, val, Mb, Nb, nnzb, base);
+
+    // Then temporarily skip the values.
+    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
+    val.resize(nvalues);
+    for(size_t i = 0; i < nvalues; ++i)
+    {
+        val[i] = random_cached_generator<T>();
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from binary file in rocSPARSEIO format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rocsparseio(const char*          filename,
+                                    host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
+                                    J&                   M,
+                                    J&                   N,
+                                    I&                   nnz,
+                                    rocsparse_index_base base)
+{
+    rocsparse_importer_rocsparseio importer(filename);
+    rocsparse_status               status
+        = rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from binary file in rocSPARSEIO format */
+template <typename I, typename T>
+void rocsparse_init_coo_rocsparseio(const char*          filename,
+                                    host_vector<I>&      row_ind,
+                                    host_vector<I>&      col_ind,
+                                    host_vector<T>&      val,
+                                    I&                   M,
+                                    I&                   N,
+                                    int64_t&             nnz,
+                                    rocsparse_index_base base)
+{
+    rocsparse_importer_rocsparseio importer(filename);
+    rocsparse_status               status
+        = rocsparse_import_sparse_coo(importer, row_ind, col_ind, val, M, N, nnz, base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+}
+
+/* ==================================================================================== */
+/*! \brief  Switch the storage of the blocks of a GEBSR matrix from the direction dir to the
+ *  other one. */
+template <typename I, typename J, typename T>
+static void rocsparse_gebsr_reorder_blocks(
+    host_vector<T>& val, I nnzb, J row_block_dim, J col_block_dim, rocsparse_direction dir)
+{
+    // Dimensions of the blocks as they are stored.
+    const size_t outer = (dir == rocsparse_direction_row) ? row_block_dim : col_block_dim;
+    const size_t inner = (dir == rocsparse_direction_row) ? col_block_dim : row_block_dim;
+    const size_t size  = outer * inner;
+
+    host_vector<T> tmp(val.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I k = 0; k < nnzb; ++k)
+    {
+        const T* src = val.data() + size * k;
+        T*       dst = tmp.data() + size * k;
+        for(size_t i = 0; i < outer; ++i)
+        {
+            for(size_t j = 0; j < inner; ++j)
+            {
+                dst[j * outer + i] = src[i * inner + j];
+            }
+        }
+    }
+    val.swap(tmp);
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from binary file in rocSPARSEIO format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_rocsparseio(const char*          filename,
+                                      host_vector<I>&      row_ptr,
+                                      host_vector<J>&      col_ind,
+                                      host_vector<T>&      val,
+                                      rocsparse_direction  dir,
+                                      J&                   Mb,
+                                      J&                   Nb,
+                                      I&                   nnzb,
+                                      J                    row_block_dim,
+                                      J                    col_block_dim,
+                                      rocsparse_index_base base)
+{
+    rocsparse_direction            import_dir = {};
+    rocsparse_importer_rocsparseio importer(filename);
+    rocsparse_status               status = rocsparse_import_sparse_gebsr(importer,
+                                                            row_ptr,
+                                                            col_ind,
+                                                            val,
+                                                            import_dir,
+                                                            Mb,
+                                                            Nb,
+                                                            nnzb,
+                                                            row_block_dim,
+                                                            col_block_dim,
+                                                            base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+
+    if(import_dir != dir)
+    {
+        rocsparse_gebsr_reorder_blocks(val, nnzb, row_block_dim, col_block_dim, import_dir);
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from chunked binary file */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_chunked(const char*          filename,
+                                host_vector<I>&      row_ptr,
+                                host_vector<J>&      col_ind,
+                                host_vector<T>&      val,
+                                J&                   M,
+                                J&                   N,
+                                I&                   nnz,
+                                rocsparse_index_base base)
+{
+    rocsparse_importer_chunked importer(filename);
+    rocsparse_status           status
+        = rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from chunked binary file */
+template <typename I, typename T>
+void rocsparse_init_coo_chunked(const char*          filename,
+                                host_vector<I>&      row_ind,
+                                host_vector<I>&      col_ind,
+                                host_vector<T>&      val,
+                                I&                   M,
+                                I&                   N,
+                                int64_t&             nnz,
+                                rocsparse_index_base base)
+{
+    rocsparse_importer_chunked importer(filename);
+    rocsparse_status           status
+        = rocsparse_import_sparse_coo(importer, row_ind, col_ind, val, M, N, nnz, base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+}
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from chunked binary file */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_chunked(const char*          filename,
+                                  host_vector<I>&      row_ptr,
+                                  host_vector<J>&      col_ind,
+                                  host_vector<T>&      val,
+                                  rocsparse_direction  dir,
+                                  J&                   Mb,
+                                  J&                   Nb,
+                                  I&                   nnzb,
+                                  J                    row_block_dim,
+                                  J                    col_block_dim,
+                                  rocsparse_index_base base)
+{
+    rocsparse_direction        import_dir = {};
+    rocsparse_importer_chunked importer(filename);
+    rocsparse_status           status = rocsparse_import_sparse_gebsr(importer,
+                                                                      row_ptr,
+                                                                      col_ind,
+                                                                      val,
+                                                                      import_dir,
+                                                                      Mb,
+                                                                      Nb,
+                                                                      nnzb,
+                                                                      row_block_dim,
+                                                                      col_block_dim,
+                                                                      base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
+
+    if(import_dir != dir)
+    {
+        rocsparse_gebsr_reorder_blocks(val, nnzb, row_block_dim, col_block_dim, import_dir);
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a random sparse matrix in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_random(host_vector<I>&            csr_row_ptr,
+                               host_vector<J>&            csr_col_ind,
+                               host_vector<T>&            csr_val,
+                               J                          M,
+                               J                          N,
+                               I&                         nnz,
+                               rocsparse_index_base       base,
+                               rocsparse_matrix_init_kind init_kind,
+                               bool                       full_rank,
                                bool                       to_int)
 {
     switch(init_kind)
@@ -1048,7 +1584,7 @@ void rocsparse_init_csr_random(std::vector<I>&            csr_row_ptr,
         nnz = std::min(nnz, static_cast<I>(M) * static_cast<I>(N));
 
         // Sample random matrix
-        std::vector<J> row_ind(nnz);
+        host_vector<J> row_ind(nnz);
         // Sample COO matrix
         rocsparse_init_coo_matrix<J>(
             row_ind, csr_col_ind, csr_val, M, N, nnz, base, full_rank, to_int);
@@ -1077,7 +1613,7 @@ void rocsparse_init_csr_random(std::vector<I>&            csr_row_ptr,
         }
 
         // Sample random matrix
-        std::vector<J> row_ind(nnz);
+        host_vector<J> row_ind(nnz);
         // Sample COO matrix
         rocsparse_init_coo_matrix<J>(
             row_ind, csr_col_ind, csr_val, M, N, nnz, base, full_rank, to_int);
@@ -1092,9 +1628,9 @@ void rocsparse_init_csr_random(std::vector<I>&            csr_row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_random(std::vector<I>&            row_ind,
-                               std::vector<I>&            col_ind,
-                               std::vector<T>&            val,
+void rocsparse_init_coo_random(host_vector<I>&            row_ind,
+                               host_vector<I>&            col_ind,
+                               host_vector<T>&            val,
                                I                          M,
                                I                          N,
                                int64_t&                   nnz,
@@ -1159,9 +1695,9 @@ void rocsparse_init_coo_random(std::vector<I>&            row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_random(std::vector<I>&            row_ptr,
-                                 std::vector<J>&            col_ind,
-                                 std::vector<T>&            val,
+void rocsparse_init_gebsr_random(host_vector<I>&            row_ptr,
+                                 host_vector<J>&            col_ind,
+                                 host_vector<T>&            val,
                                  J                          Mb,
                                  J                          Nb,
                                  I&                         nnzb,
@@ -1175,20 +1711,28 @@ void rocsparse_init_gebsr_random(std::vector<I>&            row_ptr,
     rocsparse_init_csr_random(
         row_ptr, col_ind, val, Mb, Nb, nnzb, base, init_kind, full_rank, to_int);
 
-    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
+    // Sample the values of the blocks in parallel, see rocsparse_init_coo_matrix.
+    const rocsparse_philox rng(rocsparse_rng_get()());
+    const size_t           nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
     val.resize(nvalues);
     if(to_int)
     {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(size_t i = 0; i < nvalues; ++i)
         {
-            val[i] = random_cached_generator_exact<T>();
+            val[i] = random_philox_generator_exact<T>(rng, i, 0);
         }
     }
     else
     {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(size_t i = 0; i < nvalues; ++i)
         {
-            val[i] = random_cached_generator<T>();
+            val[i] = random_philox_generator<T>(rng, i, 0);
         }
     }
 }
@@ -1196,9 +1740,9 @@ void rocsparse_init_gebsr_random(std::vector<I>&            row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate a tridiagonal sparse matrix in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_tridiagonal(std::vector<I>&      row_ind,
-                                    std::vector<I>&      col_ind,
-                                    std::vector<T>&      val,
+void rocsparse_init_coo_tridiagonal(host_vector<I>&      row_ind,
+                                    host_vector<I>&      col_ind,
+                                    host_vector<T>&      val,
                                     I                    M,
                                     I                    N,
                                     int64_t&             nnz,
@@ -1262,176 +1806,609 @@ void rocsparse_init_coo_tridiagonal(std::vector<I>&      row_ind,
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate a tridiagonal sparse matrix in CSR format */
-template <typename I, typename J, typename T>
-void rocsparse_init_csr_tridiagonal(std::vector<I>&      row_ptr,
-                                    std::vector<J>&      col_ind,
-                                    std::vector<T>&      val,
-                                    J                    M,
-                                    J                    N,
-                                    I&                   nnz,
-                                    rocsparse_index_base base,
-                                    J                    l,
-                                    J                    u)
+/*! \brief  Generate a tridiagonal sparse matrix in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_tridiagonal(host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
+                                    J                    M,
+                                    J                    N,
+                                    I&                   nnz,
+                                    rocsparse_index_base base,
+                                    J                    l,
+                                    J                    u)
+{
+    int64_t        coo_nnz;
+    host_vector<J> row_ind;
+    // Sample COO matrix
+    rocsparse_init_coo_tridiagonal<J>(row_ind, col_ind, val, M, N, coo_nnz, base, l, u);
+
+    if(std::is_same<I, int32_t>() && coo_nnz > std::numeric_limits<int32_t>::max())
+    {
+        std::cerr << "Error: Attempting to create CSR tridiagonal matrix with more than "
+                  << std::numeric_limits<int32_t>::max()
+                  << " non-zeros while using int32_t row indexing." << std::endl;
+        exit(1);
+    }
+
+    nnz = (I)coo_nnz;
+
+    // Convert to CSR
+    host_coo_to_csr(M, nnz, row_ind.data(), row_ptr, base);
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a tridiagonal sparse matrix in GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_tridiagonal(host_vector<I>&      row_ptr,
+                                      host_vector<J>&      col_ind,
+                                      host_vector<T>&      val,
+                                      J                    Mb,
+                                      J                    Nb,
+                                      I&                   nnzb,
+                                      J                    row_block_dim,
+                                      J                    col_block_dim,
+                                      rocsparse_index_base base,
+                                      J                    l,
+                                      J                    u)
+{
+    rocsparse_init_csr_tridiagonal(row_ptr, col_ind, val, Mb, Nb, nnzb, base, l, u);
+
+    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
+    val.resize(nvalues);
+
+    for(size_t i = 0; i < nvalues; ++i)
+    {
+        val[i] = random_cached_generator<T>();
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a pentadiagonal sparse matrix in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_pentadiagonal(host_vector<I>&      row_ind,
+                                      host_vector<I>&      col_ind,
+                                      host_vector<T>&      val,
+                                      I                    M,
+                                      I                    N,
+                                      int64_t&             nnz,
+                                      rocsparse_index_base base,
+                                      I                    ll,
+                                      I                    l,
+                                      I                    u,
+                                      I                    uu)
+{
+    if(ll >= 0 || l >= 0 || ll >= l || -l >= M || -ll >= M)
+    {
+        std::cerr << "ERROR: ll >= 0 || l >= 0 || ll >= l || -l >= M || -ll >= M" << std::endl;
+        return;
+    }
+
+    if(u <= 0 || uu <= 0 || uu <= u || u >= N || uu >= N)
+    {
+        std::cerr << "ERROR: u <= 0 || uu <= 0 || uu <= u || u >= N || uu >= N" << std::endl;
+        return;
+    }
+
+    int64_t l_length  = std::min((M + l), N);
+    int64_t ll_length = std::min((M + ll), N);
+    int64_t d_length  = std::min(M, N);
+    int64_t u_length  = std::min((N - u), M);
+    int64_t uu_length = std::min((N - uu), M);
+
+    nnz = ll_length + l_length + d_length + u_length + uu_length;
+
+    row_ind.resize(nnz);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+    int64_t index = 0;
+    for(I i = 0; i < M; i++)
+    {
+        I ll_col = i + ll;
+        I l_col  = i + l;
+        I d_col  = i;
+        I u_col  = i + u;
+        I uu_col = i + uu;
+
+        if(ll_col >= 0 && ll_col < N)
+        {
+            row_ind[index] = i + base;
+            col_ind[index] = ll_col + base;
+            val[index]     = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
+            index++;
+        }
+
+        if(l_col >= 0 && l_col < N)
+        {
+            row_ind[index] = i + base;
+            col_ind[index] = l_col + base;
+            val[index]     = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
+            index++;
+        }
+
+        if(d_col >= 0 && d_col < N)
+        {
+            row_ind[index] = i + base;
+            col_ind[index] = d_col + base;
+            val[index]     = random_cached_generator<T>(static_cast<T>(4.0), static_cast<T>(6.0));
+            index++;
+        }
+
+        if(u_col >= 0 && u_col < N)
+        {
+            row_ind[index] = i + base;
+            col_ind[index] = u_col + base;
+            val[index]     = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
+            index++;
+        }
+
+        if(uu_col >= 0 && uu_col < N)
+        {
+            row_ind[index] = i + base;
+            col_ind[index] = uu_col + base;
+            val[index]     = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
+            index++;
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a pentadiagonal sparse matrix in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_pentadiagonal(host_vector<I>&      row_ptr,
+                                      host_vector<J>&      col_ind,
+                                      host_vector<T>&      val,
+                                      J                    M,
+                                      J                    N,
+                                      I&                   nnz,
+                                      rocsparse_index_base base,
+                                      J                    ll,
+                                      J                    l,
+                                      J                    u,
+                                      J                    uu)
+{
+    int64_t        coo_nnz;
+    host_vector<J> row_ind;
+    // Sample COO matrix
+    rocsparse_init_coo_pentadiagonal<J>(row_ind, col_ind, val, M, N, coo_nnz, base, ll, l, u, uu);
+
+    if(std::is_same<I, int32_t>() && coo_nnz > std::numeric_limits<int32_t>::max())
+    {
+        std::cerr << "Error: Attempting to create CSR pentadiagonal matrix with more than "
+                  << std::numeric_limits<int32_t>::max()
+                  << " non-zeros while using int32_t row indexing." << std::endl;
+        exit(1);
+    }
+
+    nnz = (I)coo_nnz;
+
+    // Convert to CSR
+    host_coo_to_csr(M, nnz, row_ind.data(), row_ptr, base);
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a pentadiagonal sparse matrix in GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_pentadiagonal(host_vector<I>&      row_ptr,
+                                        host_vector<J>&      col_ind,
+                                        host_vector<T>&      val,
+                                        J                    Mb,
+                                        J                    Nb,
+                                        I&                   nnzb,
+                                        J                    row_block_dim,
+                                        J                    col_block_dim,
+                                        rocsparse_index_base base,
+                                        J                    ll,
+                                        J                    l,
+                                        J                    u,
+                                        J                    uu)
+{
+    rocsparse_init_csr_pentadiagonal(row_ptr, col_ind, val, Mb, Nb, nnzb, base, ll, l, u, uu);
+    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
+    val.resize(nvalues);
+    for(size_t i = 0; i < nvalues; ++i)
+    {
+        val[i] = random_cached_generator<T>();
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Assemble the COO matrix of a graph from its list of sampled edges.
+ *  The diagonal is always part of the pattern. Duplicated edges are merged and, with
+ *  symmetrize, every edge is also added transposed. The values are addressed by position
+ *  in the counter-based generator, such that the matrix does not depend on the number
+ *  of threads and a symmetrized pattern carries symmetric values. */
+template <typename I, typename T>
+static void rocsparse_init_coo_graph(host_vector<I>&         row_ind,
+                                     host_vector<I>&         col_ind,
+                                     host_vector<T>&         val,
+                                     I                       M,
+                                     I                       N,
+                                     int64_t&                nnz,
+                                     rocsparse_index_base    base,
+                                     const host_vector<I>&   edge_row,
+                                     const host_vector<I>&   edge_col,
+                                     bool                    symmetrize,
+                                     bool                    to_int,
+                                     const rocsparse_philox& rng,
+                                     uint32_t                draw_value)
+{
+    const I       diag   = std::min(M, N);
+    const int64_t nedges = edge_row.size();
+
+    // Bucket the edges by row
+    host_vector<int64_t> offset(M + 1, 0);
+    for(I i = 0; i < diag; ++i)
+    {
+        ++offset[i + 1];
+    }
+    for(int64_t e = 0; e < nedges; ++e)
+    {
+        ++offset[edge_row[e] + 1];
+        if(symmetrize)
+        {
+            ++offset[edge_col[e] + 1];
+        }
+    }
+    for(I i = 0; i < M; ++i)
+    {
+        offset[i + 1] += offset[i];
+    }
+
+    host_vector<I>       bucket(offset[M]);
+    host_vector<int64_t> next(offset.begin(), offset.end() - 1);
+    for(I i = 0; i < diag; ++i)
+    {
+        bucket[next[i]++] = i;
+    }
+    for(int64_t e = 0; e < nedges; ++e)
+    {
+        bucket[next[edge_row[e]]++] = edge_col[e];
+        if(symmetrize)
+        {
+            bucket[next[edge_col[e]]++] = edge_row[e];
+        }
+    }
+
+    // Sort the rows and merge the duplicated entries
+    host_vector<int64_t> count(M + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        I* begin = bucket.data() + offset[i];
+        I* end   = bucket.data() + offset[i + 1];
+        std::sort(begin, end);
+        count[i + 1] = std::unique(begin, end) - begin;
+    }
+    for(I i = 0; i < M; ++i)
+    {
+        count[i + 1] += count[i];
+    }
+
+    nnz = count[M];
+    row_ind.resize(nnz);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        const int64_t row_nnz = count[i + 1] - count[i];
+        for(int64_t k = 0; k < row_nnz; ++k)
+        {
+            const int64_t idx = count[i] + k;
+            const I       j   = bucket[offset[i] + k];
+
+            row_ind[idx] = i + base;
+            col_ind[idx] = j + base;
+
+            // Diagonal entries dominate the row, unless integer values are requested
+            const uint64_t stream = uint64_t(symmetrize ? std::min(i, j) : i) * N
+                                    + (symmetrize ? std::max(i, j) : j);
+            if(to_int)
+            {
+                val[idx] = random_philox_generator_exact<T>(rng, stream, draw_value);
+            }
+            else if(i == j)
+            {
+                val[idx] = static_cast<T>(static_cast<double>(row_nnz));
+            }
+            else
+            {
+                val[idx] = random_philox_generator<T>(
+                    rng, stream, draw_value, static_cast<T>(-1.0), static_cast<T>(1.0));
+            }
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Sample the values of the blocks of a GEBSR graph matrix */
+template <typename I, typename J, typename T>
+static void rocsparse_init_gebsr_graph_values(
+    host_vector<T>& val, I nnzb, J row_block_dim, J col_block_dim, bool to_int)
+{
+    const rocsparse_philox rng(rocsparse_rng_get()());
+    const size_t           nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
+    val.resize(nvalues);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(size_t i = 0; i < nvalues; ++i)
+    {
+        val[i] = to_int ? random_philox_generator_exact<T>(rng, i, 0)
+                        : random_philox_generator<T>(rng, i, 0);
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of an R-MAT graph in COO format.
+ *  Each edge descends recursively into the quadrants of the matrix with probabilities
+ *  a, b, c, d, where b = c and d keep the Graph500 ratios (a = 0.57, b = c = 0.19,
+ *  d = 0.05). */
+template <typename I, typename T>
+void rocsparse_init_coo_rmat(host_vector<I>&      row_ind,
+                             host_vector<I>&      col_ind,
+                             host_vector<T>&      val,
+                             I                    M,
+                             I                    N,
+                             int64_t&             nnz,
+                             rocsparse_index_base base,
+                             double               a,
+                             I                    avg_degree,
+                             bool                 symmetrize,
+                             bool                 to_int)
 {
-    int64_t        coo_nnz;
-    std::vector<J> row_ind;
-    // Sample COO matrix
-    rocsparse_init_coo_tridiagonal<J>(row_ind, col_ind, val, M, N, coo_nnz, base, l, u);
+    nnz = 0;
+    if(a < 0.25 || a >= 1.0)
+    {
+        std::cerr << "ERROR: R-MAT probability a must be in [0.25, 1)" << std::endl;
+        return;
+    }
 
-    if(std::is_same<I, int32_t>() && coo_nnz > std::numeric_limits<int32_t>::max())
+    if(avg_degree < 0)
     {
-        std::cerr << "Error: Attempting to create CSR tridiagonal matrix with more than "
-                  << std::numeric_limits<int32_t>::max()
-                  << " non-zeros while using int32_t row indexing." << std::endl;
-        exit(1);
+        std::cerr << "ERROR: avg_degree < 0" << std::endl;
+        return;
     }
 
-    nnz = (I)coo_nnz;
+    if(symmetrize && M != N)
+    {
+        std::cerr << "ERROR: M != N, cannot symmetrize R-MAT matrix" << std::endl;
+        return;
+    }
 
-    // Convert to CSR
-    host_coo_to_csr(M, nnz, row_ind.data(), row_ptr, base);
-}
+    const double b = (1.0 - a) * 0.19 / 0.43;
+    const double c = b;
 
-/* ==================================================================================== */
-/*! \brief  Generate a tridiagonal sparse matrix in GEBSR format */
-template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_tridiagonal(std::vector<I>&      row_ptr,
-                                      std::vector<J>&      col_ind,
-                                      std::vector<T>&      val,
-                                      J                    Mb,
-                                      J                    Nb,
-                                      I&                   nnzb,
-                                      J                    row_block_dim,
-                                      J                    col_block_dim,
-                                      rocsparse_index_base base,
-                                      J                    l,
-                                      J                    u)
-{
-    rocsparse_init_csr_tridiagonal(row_ptr, col_ind, val, Mb, Nb, nnzb, base, l, u);
+    // Number of bits of the row and column indices
+    int row_bits = 0;
+    int col_bits = 0;
+    while((int64_t(1) << row_bits) < M)
+    {
+        ++row_bits;
+    }
+    while((int64_t(1) << col_bits) < N)
+    {
+        ++col_bits;
+    }
+    const int bits = std::max(row_bits, col_bits);
 
-    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
-    val.resize(nvalues);
+    const rocsparse_philox rng(rocsparse_rng_get()());
+    enum : uint32_t
+    {
+        draw_edge,
+        draw_value
+    };
 
-    for(size_t i = 0; i < nvalues; ++i)
+    // A symmetrized edge contributes to two rows
+    const int64_t nedges = (M > 0 && N > 0) ? int64_t(M) * avg_degree / (symmetrize ? 2 : 1) : 0;
+    host_vector<I> edge_row(nedges);
+    host_vector<I> edge_col(nedges);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int64_t e = 0; e < nedges; ++e)
     {
-        val[i] = random_cached_generator<T>();
+        // Reject the edges falling out of the matrix, their probability is at most 3/4
+        for(uint64_t attempt = 0;; ++attempt)
+        {
+            int64_t i = 0;
+            int64_t j = 0;
+            for(int l = 0; l < bits; ++l)
+            {
+                const double p       = rng.uniform01(e, attempt * bits + l, draw_edge);
+                const bool   has_row = (bits - l) <= row_bits;
+                const bool   has_col = (bits - l) <= col_bits;
+
+                // Below the smaller dimension, split along the remaining one only
+                const bool lower = p >= a + b;
+                const bool right = has_row ? (p >= a && p < a + b) || p >= a + b + c : p >= a + c;
+
+                i = has_row ? 2 * i + lower : i;
+                j = has_col ? 2 * j + right : j;
+            }
+
+            if(i < M && j < N)
+            {
+                edge_row[e] = static_cast<I>(i);
+                edge_col[e] = static_cast<I>(j);
+                break;
+            }
+        }
     }
+
+    rocsparse_init_coo_graph(row_ind,
+                             col_ind,
+                             val,
+                             M,
+                             N,
+                             nnz,
+                             base,
+                             edge_row,
+                             edge_col,
+                             symmetrize,
+                             to_int,
+                             rng,
+                             draw_value);
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate a pentadiagonal sparse matrix in COO format */
+/*! \brief  Generate a sparse matrix with the pattern of a power-law graph in COO format.
+ *  Rows and columns get the weights (i + 1)^(-1 / (gamma - 1)) and the entries of a row are
+ *  sampled proportionally to the column weights (Chung-Lu model), such that the degrees
+ *  follow a power law of exponent gamma. */
 template <typename I, typename T>
-void rocsparse_init_coo_pentadiagonal(std::vector<I>&      row_ind,
-                                      std::vector<I>&      col_ind,
-                                      std::vector<T>&      val,
-                                      I                    M,
-                                      I                    N,
-                                      int64_t&             nnz,
-                                      rocsparse_index_base base,
-                                      I                    ll,
-                                      I                    l,
-                                      I                    u,
-                                      I                    uu)
+void rocsparse_init_coo_powerlaw(host_vector<I>&      row_ind,
+                                 host_vector<I>&      col_ind,
+                                 host_vector<T>&      val,
+                                 I                    M,
+                                 I                    N,
+                                 int64_t&             nnz,
+                                 rocsparse_index_base base,
+                                 double               gamma,
+                                 I                    avg_degree,
+                                 bool                 symmetrize,
+                                 bool                 to_int)
 {
-    if(ll >= 0 || l >= 0 || ll >= l || -l >= M || -ll >= M)
+    nnz = 0;
+    if(gamma <= 1.0)
     {
-        std::cerr << "ERROR: ll >= 0 || l >= 0 || ll >= l || -l >= M || -ll >= M" << std::endl;
+        std::cerr << "ERROR: power-law exponent must be larger than 1" << std::endl;
         return;
     }
 
-    if(u <= 0 || uu <= 0 || uu <= u || u >= N || uu >= N)
+    if(avg_degree < 0)
     {
-        std::cerr << "ERROR: u <= 0 || uu <= 0 || uu <= u || u >= N || uu >= N" << std::endl;
+        std::cerr << "ERROR: avg_degree < 0" << std::endl;
         return;
     }
 
-    int64_t l_length  = std::min((M + l), N);
-    int64_t ll_length = std::min((M + ll), N);
-    int64_t d_length  = std::min(M, N);
-    int64_t u_length  = std::min((N - u), M);
-    int64_t uu_length = std::min((N - uu), M);
+    if(symmetrize && M != N)
+    {
+        std::cerr << "ERROR: M != N, cannot symmetrize power-law matrix" << std::endl;
+        return;
+    }
 
-    nnz = ll_length + l_length + d_length + u_length + uu_length;
+    const rocsparse_philox rng(rocsparse_rng_get()());
+    enum : uint32_t
+    {
+        draw_degree,
+        draw_column,
+        draw_value
+    };
 
-    row_ind.resize(nnz);
-    col_ind.resize(nnz);
-    val.resize(nnz);
+    const double exponent = -1.0 / (gamma - 1.0);
 
-    int64_t index = 0;
-    for(I i = 0; i < M; i++)
+    // Cumulative weights of the columns, summed sequentially to be reproducible
+    std::vector<double> col_cdf(N);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I j = 0; j < N; ++j)
     {
-        I ll_col = i + ll;
-        I l_col  = i + l;
-        I d_col  = i;
-        I u_col  = i + u;
-        I uu_col = i + uu;
+        col_cdf[j] = std::pow(static_cast<double>(j + 1), exponent);
+    }
+    for(I j = 1; j < N; ++j)
+    {
+        col_cdf[j] += col_cdf[j - 1];
+    }
 
-        if(ll_col >= 0 && ll_col < N)
-        {
-            row_ind[index] = i + base;
-            col_ind[index] = ll_col + base;
-            val[index]     = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
-            index++;
-        }
+    std::vector<double> row_weight(M);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        row_weight[i] = std::pow(static_cast<double>(i + 1), exponent);
+    }
+    double row_sum = 0.0;
+    for(I i = 0; i < M; ++i)
+    {
+        row_sum += row_weight[i];
+    }
 
-        if(l_col >= 0 && l_col < N)
-        {
-            row_ind[index] = i + base;
-            col_ind[index] = l_col + base;
-            val[index]     = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
-            index++;
-        }
+    // Expected degree of the rows, rounded stochastically
+    const double         nedges = (N > 0) ? double(M) * avg_degree / (symmetrize ? 2 : 1) : 0.0;
+    host_vector<int64_t> offset(M + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        const double  degree = std::min(nedges * row_weight[i] / row_sum, double(N));
+        const int64_t floor  = static_cast<int64_t>(degree);
+        offset[i + 1] = floor + (rng.uniform01(i, 0, draw_degree) < degree - floor ? 1 : 0);
+    }
+    for(I i = 0; i < M; ++i)
+    {
+        offset[i + 1] += offset[i];
+    }
 
-        if(d_col >= 0 && d_col < N)
-        {
-            row_ind[index] = i + base;
-            col_ind[index] = d_col + base;
-            val[index]     = random_cached_generator<T>(static_cast<T>(4.0), static_cast<T>(6.0));
-            index++;
-        }
+    host_vector<I> edge_row(offset[M]);
+    host_vector<I> edge_col(offset[M]);
 
-        if(u_col >= 0 && u_col < N)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < M; ++i)
+    {
+        for(int64_t e = offset[i]; e < offset[i + 1]; ++e)
         {
-            row_ind[index] = i + base;
-            col_ind[index] = u_col + base;
-            val[index]     = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
-            index++;
-        }
+            const double u = rng.uniform01(i, e - offset[i], draw_column) * col_cdf[N - 1];
+            const I      j = std::upper_bound(col_cdf.begin(), col_cdf.end(), u) - col_cdf.begin();
 
-        if(uu_col >= 0 && uu_col < N)
-        {
-            row_ind[index] = i + base;
-            col_ind[index] = uu_col + base;
-            val[index]     = random_cached_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
-            index++;
+            edge_row[e] = i;
+            edge_col[e] = std::min(j, N - 1);
         }
     }
+
+    rocsparse_init_coo_graph(row_ind,
+                             col_ind,
+                             val,
+                             M,
+                             N,
+                             nnz,
+                             base,
+                             edge_row,
+                             edge_col,
+                             symmetrize,
+                             to_int,
+                             rng,
+                             draw_value);
 }
 
+
 /* ==================================================================================== */
-/*! \brief  Generate a pentadiagonal sparse matrix in CSR format */
+/*! \brief  Generate a sparse matrix with the pattern of an R-MAT graph in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_pentadiagonal(std::vector<I>&      row_ptr,
-                                      std::vector<J>&      col_ind,
-                                      std::vector<T>&      val,
-                                      J                    M,
-                                      J                    N,
-                                      I&                   nnz,
-                                      rocsparse_index_base base,
-                                      J                    ll,
-                                      J                    l,
-                                      J                    u,
-                                      J                    uu)
+void rocsparse_init_csr_rmat(host_vector<I>&      row_ptr,
+                             host_vector<J>&      col_ind,
+                             host_vector<T>&      val,
+                             J                    M,
+                             J                    N,
+                             I&                   nnz,
+                             rocsparse_index_base base,
+                             double               a,
+                             J                    avg_degree,
+                             bool                 symmetrize,
+                             bool                 to_int)
 {
     int64_t        coo_nnz;
-    std::vector<J> row_ind;
+    host_vector<J> row_ind;
     // Sample COO matrix
-    rocsparse_init_coo_pentadiagonal<J>(row_ind, col_ind, val, M, N, coo_nnz, base, ll, l, u, uu);
+    rocsparse_init_coo_rmat<J>(
+        row_ind, col_ind, val, M, N, coo_nnz, base, a, avg_degree, symmetrize, to_int);
 
     if(std::is_same<I, int32_t>() && coo_nnz > std::numeric_limits<int32_t>::max())
     {
-        std::cerr << "Error: Attempting to create CSR pentadiagonal matrix with more than "
+        std::cerr << "Error: Attempting to create CSR R-MAT matrix with more than "
                   << std::numeric_limits<int32_t>::max()
                   << " non-zeros while using int32_t row indexing." << std::endl;
         exit(1);
@@ -1444,34 +2421,87 @@ void rocsparse_init_csr_pentadiagonal(std::vector<I>&      row_ptr,
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate a pentadiagonal sparse matrix in GEBSR format */
+/*! \brief  Generate a sparse matrix with the pattern of an R-MAT graph in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
-                                        std::vector<J>&      col_ind,
-                                        std::vector<T>&      val,
-                                        J                    Mb,
-                                        J                    Nb,
-                                        I&                   nnzb,
-                                        J                    row_block_dim,
-                                        J                    col_block_dim,
-                                        rocsparse_index_base base,
-                                        J                    ll,
-                                        J                    l,
-                                        J                    u,
-                                        J                    uu)
+void rocsparse_init_gebsr_rmat(host_vector<I>&      row_ptr,
+                               host_vector<J>&      col_ind,
+                               host_vector<T>&      val,
+                               J                    Mb,
+                               J                    Nb,
+                               I&                   nnzb,
+                               J                    row_block_dim,
+                               J                    col_block_dim,
+                               rocsparse_index_base base,
+                               double               a,
+                               J                    avg_degree,
+                               bool                 symmetrize,
+                               bool                 to_int)
 {
-    rocsparse_init_csr_pentadiagonal(row_ptr, col_ind, val, Mb, Nb, nnzb, base, ll, l, u, uu);
-    const size_t nvalues = size_t(nnzb) * row_block_dim * col_block_dim;
-    val.resize(nvalues);
-    for(size_t i = 0; i < nvalues; ++i)
+    rocsparse_init_csr_rmat(
+        row_ptr, col_ind, val, Mb, Nb, nnzb, base, a, avg_degree, symmetrize, to_int);
+    rocsparse_init_gebsr_graph_values(val, nnzb, row_block_dim, col_block_dim, to_int);
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of a power-law graph in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_powerlaw(host_vector<I>&      row_ptr,
+                                 host_vector<J>&      col_ind,
+                                 host_vector<T>&      val,
+                                 J                    M,
+                                 J                    N,
+                                 I&                   nnz,
+                                 rocsparse_index_base base,
+                                 double               gamma,
+                                 J                    avg_degree,
+                                 bool                 symmetrize,
+                                 bool                 to_int)
+{
+    int64_t        coo_nnz;
+    host_vector<J> row_ind;
+    // Sample COO matrix
+    rocsparse_init_coo_powerlaw<J>(
+        row_ind, col_ind, val, M, N, coo_nnz, base, gamma, avg_degree, symmetrize, to_int);
+
+    if(std::is_same<I, int32_t>() && coo_nnz > std::numeric_limits<int32_t>::max())
     {
-        val[i] = random_cached_generator<T>();
+        std::cerr << "Error: Attempting to create CSR power-law matrix with more than "
+                  << std::numeric_limits<int32_t>::max()
+                  << " non-zeros while using int32_t row indexing." << std::endl;
+        exit(1);
     }
+
+    nnz = (I)coo_nnz;
+
+    // Convert to CSR
+    host_coo_to_csr(M, nnz, row_ind.data(), row_ptr, base);
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of a power-law graph in GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_powerlaw(host_vector<I>&      row_ptr,
+                                   host_vector<J>&      col_ind,
+                                   host_vector<T>&      val,
+                                   J                    Mb,
+                                   J                    Nb,
+                                   I&                   nnzb,
+                                   J                    row_block_dim,
+                                   J                    col_block_dim,
+                                   rocsparse_index_base base,
+                                   double               gamma,
+                                   J                    avg_degree,
+                                   bool                 symmetrize,
+                                   bool                 to_int)
+{
+    rocsparse_init_csr_powerlaw(
+        row_ptr, col_ind, val, Mb, Nb, nnzb, base, gamma, avg_degree, symmetrize, to_int);
+    rocsparse_init_gebsr_graph_values(val, nnzb, row_block_dim, col_block_dim, to_int);
 }
 
 #define INSTANTIATEI(TYPE)                    \
     template void rocsparse_init_index<TYPE>( \
-        std::vector<TYPE> & x, size_t nnz, size_t start, size_t end);
+        host_vector<TYPE> & x, size_t nnz, size_t start, size_t end);
 
 #define INSTANTIATE(TYPE)                                                                          \
     template void rocsparse_init<TYPE>(TYPE * A,                                                   \
@@ -1490,7 +2520,7 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                              size_t batch_count,                                   \
                                              int    a = 1,                                         \
                                              int    b = 10);                                          \
-    template void rocsparse_init<TYPE>(std::vector<TYPE> & A,                                      \
+    template void rocsparse_init<TYPE>(host_vector<TYPE> & A,                                      \
                                        size_t M,                                                   \
                                        size_t N,                                                   \
                                        size_t lda,                                                 \
@@ -1498,7 +2528,7 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                        size_t batch_count = 1,                                     \
                                        TYPE   a           = static_cast<TYPE>(0),                  \
                                        TYPE   b           = static_cast<TYPE>(1));                             \
-    template void rocsparse_init_exact<TYPE>(std::vector<TYPE> & A,                                \
+    template void rocsparse_init_exact<TYPE>(host_vector<TYPE> & A,                                \
                                              size_t M,                                             \
                                              size_t N,                                             \
                                              size_t lda,                                           \
@@ -1507,9 +2537,9 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                              int    a = 1,                                         \
                                              int    b = 10);                                          \
     template void rocsparse_init_alternating_sign<TYPE>(                                           \
-        std::vector<TYPE> & A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count); \
+        host_vector<TYPE> & A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count); \
     template void rocsparse_init_nan<TYPE>(TYPE * A, size_t N);                                    \
-    template void rocsparse_init_nan<TYPE>(std::vector<TYPE> & A,                                  \
+    template void rocsparse_init_nan<TYPE>(host_vector<TYPE> & A,                                  \
                                            size_t M,                                               \
                                            size_t N,                                               \
                                            size_t lda,                                             \
@@ -1519,34 +2549,34 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
 #define INSTANTIATE1(ITYPE, JTYPE)                                                         \
     template void host_csr_to_coo<ITYPE, JTYPE>(JTYPE                     M,               \
                                                 ITYPE                     nnz,             \
-                                                const std::vector<ITYPE>& csr_row_ptr,     \
-                                                std::vector<JTYPE>&       coo_row_ind,     \
+                                                const host_vector<ITYPE>& csr_row_ptr,     \
+                                                host_vector<JTYPE>&       coo_row_ind,     \
                                                 rocsparse_index_base      base);                \
     template void host_coo_to_csr<ITYPE, JTYPE>(JTYPE                M,                    \
                                                 ITYPE                NNZ,                  \
                                                 const JTYPE*         coo_row_ind,          \
-                                                std::vector<ITYPE>&  csr_row_ptr,          \
+                                                host_vector<ITYPE>&  csr_row_ptr,          \
                                                 rocsparse_index_base base);                \
     template void host_csr_to_coo_aos<ITYPE, JTYPE>(JTYPE                     M,           \
                                                     ITYPE                     nnz,         \
-                                                    const std::vector<ITYPE>& csr_row_ptr, \
-                                                    const std::vector<JTYPE>& csr_col_ind, \
-                                                    std::vector<ITYPE>&       coo_ind,     \
+                                                    const host_vector<ITYPE>& csr_row_ptr, \
+                                                    const host_vector<JTYPE>& csr_col_ind, \
+                                                    host_vector<ITYPE>&       coo_ind,     \
                                                     rocsparse_index_base      base);
 
 #define INSTANTIATE2(ITYPE, TTYPE)                                                              \
-    template void rocsparse_init_coo_tridiagonal<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,    \
-                                                               std::vector<ITYPE> & col_ind,    \
-                                                               std::vector<TTYPE> & val,        \
+    template void rocsparse_init_coo_tridiagonal<ITYPE, TTYPE>(host_vector<ITYPE> & row_ind,    \
+                                                               host_vector<ITYPE> & col_ind,    \
+                                                               host_vector<TTYPE> & val,        \
                                                                ITYPE M,                         \
                                                                ITYPE N,                         \
                                                                int64_t & nnz,                   \
                                                                rocsparse_index_base base,       \
                                                                ITYPE                l,          \
                                                                ITYPE                u);                        \
-    template void rocsparse_init_coo_pentadiagonal<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,  \
-                                                                 std::vector<ITYPE> & col_ind,  \
-                                                                 std::vector<TTYPE> & val,      \
+    template void rocsparse_init_coo_pentadiagonal<ITYPE, TTYPE>(host_vector<ITYPE> & row_ind,  \
+                                                                 host_vector<ITYPE> & col_ind,  \
+                                                                 host_vector<TTYPE> & val,      \
                                                                  ITYPE M,                       \
                                                                  ITYPE N,                       \
                                                                  int64_t & nnz,                 \
@@ -1555,35 +2585,35 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                                                  ITYPE                l,        \
                                                                  ITYPE                u,        \
                                                                  ITYPE                uu);                     \
-    template void rocsparse_init_coo_laplace2d<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,      \
-                                                             std::vector<ITYPE> & col_ind,      \
-                                                             std::vector<TTYPE> & val,          \
+    template void rocsparse_init_coo_laplace2d<ITYPE, TTYPE>(host_vector<ITYPE> & row_ind,      \
+                                                             host_vector<ITYPE> & col_ind,      \
+                                                             host_vector<TTYPE> & val,          \
                                                              int32_t dim_x,                     \
                                                              int32_t dim_y,                     \
                                                              ITYPE & M,                         \
                                                              ITYPE & N,                         \
                                                              int64_t & nnz,                     \
                                                              rocsparse_index_base base);        \
-    template void rocsparse_init_ell_laplace2d<ITYPE, TTYPE>(std::vector<ITYPE> & col_ind,      \
-                                                             std::vector<TTYPE> & val,          \
+    template void rocsparse_init_ell_laplace2d<ITYPE, TTYPE>(host_vector<ITYPE> & col_ind,      \
+                                                             host_vector<TTYPE> & val,          \
                                                              int32_t dim_x,                     \
                                                              int32_t dim_y,                     \
                                                              ITYPE & M,                         \
                                                              ITYPE & N,                         \
                                                              ITYPE & width,                     \
                                                              rocsparse_index_base base);        \
-    template void rocsparse_init_coo_matrix<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,         \
-                                                          std::vector<ITYPE> & col_ind,         \
-                                                          std::vector<TTYPE> & val,             \
+    template void rocsparse_init_coo_matrix<ITYPE, TTYPE>(host_vector<ITYPE> & row_ind,         \
+                                                          host_vector<ITYPE> & col_ind,         \
+                                                          host_vector<TTYPE> & val,             \
                                                           ITYPE                M,               \
                                                           ITYPE                N,               \
                                                           int64_t              nnz,             \
                                                           rocsparse_index_base base,            \
                                                           bool                 full_rank,       \
                                                           bool                 to_int);                         \
-    template void rocsparse_init_coo_laplace3d<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,      \
-                                                             std::vector<ITYPE> & col_ind,      \
-                                                             std::vector<TTYPE> & val,          \
+    template void rocsparse_init_coo_laplace3d<ITYPE, TTYPE>(host_vector<ITYPE> & row_ind,      \
+                                                             host_vector<ITYPE> & col_ind,      \
+                                                             host_vector<TTYPE> & val,          \
                                                              int32_t dim_x,                     \
                                                              int32_t dim_y,                     \
                                                              int32_t dim_z,                     \
@@ -1591,46 +2621,92 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                                              ITYPE & N,                         \
                                                              int64_t & nnz,                     \
                                                              rocsparse_index_base base);        \
+    template void rocsparse_init_coo_stencil3d<ITYPE, TTYPE>(                                   \
+        host_vector<ITYPE> & row_ind,                                                           \
+        host_vector<ITYPE> & col_ind,                                                           \
+        host_vector<TTYPE> & val,                                                               \
+        int32_t dim_x,                                                                          \
+        int32_t dim_y,                                                                          \
+        int32_t dim_z,                                                                          \
+        int32_t points,                                                                         \
+        int32_t dof,                                                                            \
+        bool    permute,                                                                        \
+        ITYPE & M,                                                                              \
+        ITYPE & N,                                                                              \
+        int64_t & nnz,                                                                          \
+        rocsparse_index_base base);                                                             \
     template void rocsparse_init_coo_mtx<ITYPE, TTYPE>(const char*          filename,           \
-                                                       std::vector<ITYPE>&  coo_row_ind,        \
-                                                       std::vector<ITYPE>&  coo_col_ind,        \
-                                                       std::vector<TTYPE>&  coo_val,            \
+                                                       host_vector<ITYPE>&  coo_row_ind,        \
+                                                       host_vector<ITYPE>&  coo_col_ind,        \
+                                                       host_vector<TTYPE>&  coo_val,            \
                                                        ITYPE&               M,                  \
                                                        ITYPE&               N,                  \
                                                        int64_t&             nnz,                \
                                                        rocsparse_index_base base);              \
     template void rocsparse_init_coo_rocalution<ITYPE, TTYPE>(const char*          filename,    \
-                                                              std::vector<ITYPE>&  row_ind,     \
-                                                              std::vector<ITYPE>&  col_ind,     \
-                                                              std::vector<TTYPE>&  val,         \
+                                                              host_vector<ITYPE>&  row_ind,     \
+                                                              host_vector<ITYPE>&  col_ind,     \
+                                                              host_vector<TTYPE>&  val,         \
                                                               ITYPE&               M,           \
                                                               ITYPE&               N,           \
                                                               int64_t&             nnz,         \
                                                               rocsparse_index_base base);       \
     template void rocsparse_init_coo_rocsparseio<ITYPE, TTYPE>(const char*          filename,   \
-                                                               std::vector<ITYPE>&  row_ind,    \
-                                                               std::vector<ITYPE>&  col_ind,    \
-                                                               std::vector<TTYPE>&  val,        \
+                                                               host_vector<ITYPE>&  row_ind,    \
+                                                               host_vector<ITYPE>&  col_ind,    \
+                                                               host_vector<TTYPE>&  val,        \
                                                                ITYPE&               M,          \
                                                                ITYPE&               N,          \
                                                                int64_t&             nnz,        \
                                                                rocsparse_index_base base);      \
-    template void rocsparse_init_coo_random<ITYPE, TTYPE>(std::vector<ITYPE> & row_ind,         \
-                                                          std::vector<ITYPE> & col_ind,         \
-                                                          std::vector<TTYPE> & val,             \
+    template void rocsparse_init_coo_chunked<ITYPE, TTYPE>(const char*          filename,       \
+                                                           host_vector<ITYPE>&  row_ind,        \
+                                                           host_vector<ITYPE>&  col_ind,        \
+                                                           host_vector<TTYPE>&  val,            \
+                                                           ITYPE&               M,              \
+                                                           ITYPE&               N,              \
+                                                           int64_t&             nnz,            \
+                                                           rocsparse_index_base base);          \
+    template void rocsparse_init_coo_random<ITYPE, TTYPE>(host_vector<ITYPE> & row_ind,         \
+                                                          host_vector<ITYPE> & col_ind,         \
+                                                          host_vector<TTYPE> & val,             \
                                                           ITYPE M,                              \
                                                           ITYPE N,                              \
                                                           int64_t & nnz,                        \
                                                           rocsparse_index_base       base,      \
                                                           rocsparse_matrix_init_kind init_kind, \
                                                           bool                       full_rank, \
-                                                          bool                       to_int);
+                                                          bool                       to_int);   \
+    template void rocsparse_init_coo_rmat<ITYPE, TTYPE>(                                        \
+        host_vector<ITYPE> & row_ind,                                                           \
+        host_vector<ITYPE> & col_ind,                                                           \
+        host_vector<TTYPE> & val,                                                               \
+        ITYPE M,                                                                                \
+        ITYPE N,                                                                                \
+        int64_t & nnz,                                                                          \
+        rocsparse_index_base base,                                                              \
+        double               a,                                                                 \
+        ITYPE                avg_degree,                                                        \
+        bool                 symmetrize,                                                        \
+        bool                 to_int);                                                           \
+    template void rocsparse_init_coo_powerlaw<ITYPE, TTYPE>(                                    \
+        host_vector<ITYPE> & row_ind,                                                           \
+        host_vector<ITYPE> & col_ind,                                                           \
+        host_vector<TTYPE> & val,                                                               \
+        ITYPE M,                                                                                \
+        ITYPE N,                                                                                \
+        int64_t & nnz,                                                                          \
+        rocsparse_index_base base,                                                              \
+        double               gamma,                                                             \
+        ITYPE                avg_degree,                                                        \
+        bool                 symmetrize,                                                        \
+        bool                 to_int);
 
 #define INSTANTIATE3(ITYPE, JTYPE, TTYPE)                                                            \
     template void rocsparse_init_csr_tridiagonal<ITYPE, JTYPE, TTYPE>(                               \
-        std::vector<ITYPE> & row_ptr,                                                                \
-        std::vector<JTYPE> & col_ind,                                                                \
-        std::vector<TTYPE> & val,                                                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
         JTYPE M,                                                                                     \
         JTYPE N,                                                                                     \
         ITYPE & nnz,                                                                                 \
@@ -1638,9 +2714,9 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         JTYPE                l,                                                                      \
         JTYPE                u);                                                                                    \
     template void rocsparse_init_csr_pentadiagonal<ITYPE, JTYPE, TTYPE>(                             \
-        std::vector<ITYPE> & row_ptr,                                                                \
-        std::vector<JTYPE> & col_ind,                                                                \
-        std::vector<TTYPE> & val,                                                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
         JTYPE M,                                                                                     \
         JTYPE N,                                                                                     \
         ITYPE & nnz,                                                                                 \
@@ -1649,18 +2725,18 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         JTYPE                l,                                                                      \
         JTYPE                u,                                                                      \
         JTYPE                uu);                                                                                   \
-    template void rocsparse_init_csr_laplace2d<ITYPE, JTYPE, TTYPE>(std::vector<ITYPE> & row_ptr,    \
-                                                                    std::vector<JTYPE> & col_ind,    \
-                                                                    std::vector<TTYPE> & val,        \
+    template void rocsparse_init_csr_laplace2d<ITYPE, JTYPE, TTYPE>(host_vector<ITYPE> & row_ptr,    \
+                                                                    host_vector<JTYPE> & col_ind,    \
+                                                                    host_vector<TTYPE> & val,        \
                                                                     int32_t dim_x,                   \
                                                                     int32_t dim_y,                   \
                                                                     JTYPE & M,                       \
                                                                     JTYPE & N,                       \
                                                                     ITYPE & nnz,                     \
                                                                     rocsparse_index_base base);      \
-    template void rocsparse_init_csr_laplace3d<ITYPE, JTYPE, TTYPE>(std::vector<ITYPE> & row_ptr,    \
-                                                                    std::vector<JTYPE> & col_ind,    \
-                                                                    std::vector<TTYPE> & val,        \
+    template void rocsparse_init_csr_laplace3d<ITYPE, JTYPE, TTYPE>(host_vector<ITYPE> & row_ptr,    \
+                                                                    host_vector<JTYPE> & col_ind,    \
+                                                                    host_vector<TTYPE> & val,        \
                                                                     int32_t dim_x,                   \
                                                                     int32_t dim_y,                   \
                                                                     int32_t dim_z,                   \
@@ -1669,33 +2745,41 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                                                     ITYPE & nnz,                     \
                                                                     rocsparse_index_base base);      \
     template void rocsparse_init_csr_mtx<ITYPE, JTYPE, TTYPE>(const char*          filename,         \
-                                                              std::vector<ITYPE>&  csr_row_ptr,      \
-                                                              std::vector<JTYPE>&  csr_col_ind,      \
-                                                              std::vector<TTYPE>&  csr_val,          \
+                                                              host_vector<ITYPE>&  csr_row_ptr,      \
+                                                              host_vector<JTYPE>&  csr_col_ind,      \
+                                                              host_vector<TTYPE>&  csr_val,          \
                                                               JTYPE&               M,                \
                                                               JTYPE&               N,                \
                                                               ITYPE&               nnz,              \
                                                               rocsparse_index_base base);            \
     template void rocsparse_init_csr_rocalution<ITYPE, JTYPE, TTYPE>(const char*          filename,  \
-                                                                     std::vector<ITYPE>&  row_ptr,   \
-                                                                     std::vector<JTYPE>&  col_ind,   \
-                                                                     std::vector<TTYPE>&  val,       \
+                                                                     host_vector<ITYPE>&  row_ptr,   \
+                                                                     host_vector<JTYPE>&  col_ind,   \
+                                                                     host_vector<TTYPE>&  val,       \
                                                                      JTYPE&               M,         \
                                                                      JTYPE&               N,         \
                                                                      ITYPE&               nnz,       \
                                                                      rocsparse_index_base base);     \
     template void rocsparse_init_csr_rocsparseio<ITYPE, JTYPE, TTYPE>(const char*          filename, \
-                                                                      std::vector<ITYPE>&  row_ptr,  \
-                                                                      std::vector<JTYPE>&  col_ind,  \
-                                                                      std::vector<TTYPE>&  val,      \
+                                                                      host_vector<ITYPE>&  row_ptr,  \
+                                                                      host_vector<JTYPE>&  col_ind,  \
+                                                                      host_vector<TTYPE>&  val,      \
                                                                       JTYPE&               M,        \
                                                                       JTYPE&               N,        \
                                                                       ITYPE&               nnz,      \
                                                                       rocsparse_index_base base);    \
+    template void rocsparse_init_csr_chunked<ITYPE, JTYPE, TTYPE>(const char*          filename,     \
+                                                                  host_vector<ITYPE>&  row_ptr,      \
+                                                                  host_vector<JTYPE>&  col_ind,      \
+                                                                  host_vector<TTYPE>&  val,          \
+                                                                  JTYPE&               M,            \
+                                                                  JTYPE&               N,            \
+                                                                  ITYPE&               nnz,          \
+                                                                  rocsparse_index_base base);        \
     template void rocsparse_init_csr_random<ITYPE, JTYPE, TTYPE>(                                    \
-        std::vector<ITYPE> & row_ptr,                                                                \
-        std::vector<JTYPE> & col_ind,                                                                \
-        std::vector<TTYPE> & val,                                                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
         JTYPE M,                                                                                     \
         JTYPE N,                                                                                     \
         ITYPE & nnz,                                                                                 \
@@ -1704,9 +2788,9 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         bool                       full_rank,                                                        \
         bool                       to_int);                                                                                \
     template void rocsparse_init_gebsr_tridiagonal<ITYPE, JTYPE, TTYPE>(                             \
-        std::vector<ITYPE> & row_ptr,                                                                \
-        std::vector<JTYPE> & col_ind,                                                                \
-        std::vector<TTYPE> & val,                                                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
         JTYPE Mb,                                                                                    \
         JTYPE Nb,                                                                                    \
         ITYPE & nnzb,                                                                                \
@@ -1716,9 +2800,9 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         JTYPE                l,                                                                      \
         JTYPE                u);                                                                                    \
     template void rocsparse_init_gebsr_pentadiagonal<ITYPE, JTYPE, TTYPE>(                           \
-        std::vector<ITYPE> & row_ptr,                                                                \
-        std::vector<JTYPE> & col_ind,                                                                \
-        std::vector<TTYPE> & val,                                                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
         JTYPE Mb,                                                                                    \
         JTYPE Nb,                                                                                    \
         ITYPE & nnzb,                                                                                \
@@ -1730,9 +2814,9 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         JTYPE                u,                                                                      \
         JTYPE                uu);                                                                                   \
     template void rocsparse_init_gebsr_laplace2d<ITYPE, JTYPE, TTYPE>(                               \
-        std::vector<ITYPE> & row_ptr,                                                                \
-        std::vector<JTYPE> & col_ind,                                                                \
-        std::vector<TTYPE> & val,                                                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
         int32_t dim_x,                                                                               \
         int32_t dim_y,                                                                               \
         JTYPE & Mb,                                                                                  \
@@ -1742,12 +2826,42 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         JTYPE                col_block_dim,                                                          \
         rocsparse_index_base base);                                                                  \
     template void rocsparse_init_gebsr_laplace3d<ITYPE, JTYPE, TTYPE>(                               \
-        std::vector<ITYPE> & row_ptr,                                                                \
-        std::vector<JTYPE> & col_ind,                                                                \
-        std::vector<TTYPE> & val,                                                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
+        int32_t dim_x,                                                                               \
+        int32_t dim_y,                                                                               \
+        int32_t dim_z,                                                                               \
+        JTYPE & Mb,                                                                                  \
+        JTYPE & Nb,                                                                                  \
+        ITYPE & nnzb,                                                                                \
+        JTYPE                row_block_dim,                                                          \
+        JTYPE                col_block_dim,                                                          \
+        rocsparse_index_base base);                                                                  \
+    template void rocsparse_init_csr_stencil3d<ITYPE, JTYPE, TTYPE>(                                 \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
+        int32_t dim_x,                                                                               \
+        int32_t dim_y,                                                                               \
+        int32_t dim_z,                                                                               \
+        int32_t points,                                                                              \
+        int32_t dof,                                                                                 \
+        bool    permute,                                                                             \
+        JTYPE & M,                                                                                   \
+        JTYPE & N,                                                                                   \
+        ITYPE & nnz,                                                                                 \
+        rocsparse_index_base base);                                                                  \
+    template void rocsparse_init_gebsr_stencil3d<ITYPE, JTYPE, TTYPE>(                               \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
+        rocsparse_direction dir,                                                                     \
         int32_t dim_x,                                                                               \
         int32_t dim_y,                                                                               \
         int32_t dim_z,                                                                               \
+        int32_t points,                                                                              \
+        bool    permute,                                                                             \
         JTYPE & Mb,                                                                                  \
         JTYPE & Nb,                                                                                  \
         ITYPE & nnzb,                                                                                \
@@ -1755,9 +2869,9 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         JTYPE                col_block_dim,                                                          \
         rocsparse_index_base base);                                                                  \
     template void rocsparse_init_gebsr_mtx<ITYPE, JTYPE, TTYPE>(const char*          filename,       \
-                                                                std::vector<ITYPE>&  bsr_row_ptr,    \
-                                                                std::vector<JTYPE>&  bsr_col_ind,    \
-                                                                std::vector<TTYPE>&  bsr_val,        \
+                                                                host_vector<ITYPE>&  bsr_row_ptr,    \
+                                                                host_vector<JTYPE>&  bsr_col_ind,    \
+                                                                host_vector<TTYPE>&  bsr_val,        \
                                                                 JTYPE&               Mb,             \
                                                                 JTYPE&               Nb,             \
                                                                 ITYPE&               nnzb,           \
@@ -1766,9 +2880,9 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                                                 rocsparse_index_base base);          \
     template void rocsparse_init_gebsr_rocalution<ITYPE, JTYPE, TTYPE>(                              \
         const char*          filename,                                                               \
-        std::vector<ITYPE>&  row_ptr,                                                                \
-        std::vector<JTYPE>&  col_ind,                                                                \
-        std::vector<TTYPE>&  val,                                                                    \
+        host_vector<ITYPE>&  row_ptr,                                                                \
+        host_vector<JTYPE>&  col_ind,                                                                \
+        host_vector<TTYPE>&  val,                                                                    \
         JTYPE&               Mb,                                                                     \
         JTYPE&               Nb,                                                                     \
         ITYPE&               nnzb,                                                                   \
@@ -1777,9 +2891,21 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         rocsparse_index_base base);                                                                  \
     template void rocsparse_init_gebsr_rocsparseio<ITYPE, JTYPE, TTYPE>(                             \
         const char*          filename,                                                               \
-        std::vector<ITYPE>&  row_ptr,                                                                \
-        std::vector<JTYPE>&  col_ind,                                                                \
-        std::vector<TTYPE>&  val,                                                                    \
+        host_vector<ITYPE>&  row_ptr,                                                                \
+        host_vector<JTYPE>&  col_ind,                                                                \
+        host_vector<TTYPE>&  val,                                                                    \
+        rocsparse_direction  dir,                                                                    \
+        JTYPE&               Mb,                                                                     \
+        JTYPE&               Nb,                                                                     \
+        ITYPE&               nnzb,                                                                   \
+        JTYPE                row_block_dim,                                                          \
+        JTYPE                col_block_dim,                                                          \
+        rocsparse_index_base base);                                                                  \
+    template void rocsparse_init_gebsr_chunked<ITYPE, JTYPE, TTYPE>(                                 \
+        const char*          filename,                                                               \
+        host_vector<ITYPE>&  row_ptr,                                                                \
+        host_vector<JTYPE>&  col_ind,                                                                \
+        host_vector<TTYPE>&  val,                                                                    \
         rocsparse_direction  dir,                                                                    \
         JTYPE&               Mb,                                                                     \
         JTYPE&               Nb,                                                                     \
@@ -1788,9 +2914,9 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         JTYPE                col_block_dim,                                                          \
         rocsparse_index_base base);                                                                  \
     template void rocsparse_init_gebsr_random<ITYPE, JTYPE, TTYPE>(                                  \
-        std::vector<ITYPE> & row_ptr,                                                                \
-        std::vector<JTYPE> & col_ind,                                                                \
-        std::vector<TTYPE> & val,                                                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
         JTYPE Mb,                                                                                    \
         JTYPE Nb,                                                                                    \
         ITYPE & nnzb,                                                                                \
@@ -1800,12 +2926,64 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
         rocsparse_matrix_init_kind init_kind,                                                        \
         bool                       full_rank,                                                        \
         bool                       to_int);                                                                                \
+    template void rocsparse_init_csr_rmat<ITYPE, JTYPE, TTYPE>(                                      \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
+        JTYPE M,                                                                                     \
+        JTYPE N,                                                                                     \
+        ITYPE & nnz,                                                                                 \
+        rocsparse_index_base base,                                                                   \
+        double               a,                                                                      \
+        JTYPE                avg_degree,                                                             \
+        bool                 symmetrize,                                                             \
+        bool                 to_int);                                                                \
+    template void rocsparse_init_gebsr_rmat<ITYPE, JTYPE, TTYPE>(                                    \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
+        JTYPE Mb,                                                                                    \
+        JTYPE Nb,                                                                                    \
+        ITYPE & nnzb,                                                                                \
+        JTYPE                row_block_dim,                                                          \
+        JTYPE                col_block_dim,                                                          \
+        rocsparse_index_base base,                                                                   \
+        double               a,                                                                      \
+        JTYPE                avg_degree,                                                             \
+        bool                 symmetrize,                                                             \
+        bool                 to_int);                                                                \
+    template void rocsparse_init_csr_powerlaw<ITYPE, JTYPE, TTYPE>(                                  \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
+        JTYPE M,                                                                                     \
+        JTYPE N,                                                                                     \
+        ITYPE & nnz,                                                                                 \
+        rocsparse_index_base base,                                                                   \
+        double               gamma,                                                                  \
+        JTYPE                avg_degree,                                                             \
+        bool                 symmetrize,                                                             \
+        bool                 to_int);                                                                \
+    template void rocsparse_init_gebsr_powerlaw<ITYPE, JTYPE, TTYPE>(                                \
+        host_vector<ITYPE> & row_ptr,                                                                \
+        host_vector<JTYPE> & col_ind,                                                                \
+        host_vector<TTYPE> & val,                                                                    \
+        JTYPE Mb,                                                                                    \
+        JTYPE Nb,                                                                                    \
+        ITYPE & nnzb,                                                                                \
+        JTYPE                row_block_dim,                                                          \
+        JTYPE                col_block_dim,                                                          \
+        rocsparse_index_base base,                                                                   \
+        double               gamma,                                                                  \
+        JTYPE                avg_degree,                                                             \
+        bool                 symmetrize,                                                             \
+        bool                 to_int);                                                                \
     template void host_csr_to_ell<ITYPE, JTYPE, TTYPE>(JTYPE                     M,                  \
-                                                       const std::vector<ITYPE>& csr_row_ptr,        \
-                                                       const std::vector<JTYPE>& csr_col_ind,        \
-                                                       const std::vector<TTYPE>& csr_val,            \
-                                                       std::vector<JTYPE>&       ell_col_ind,        \
-                                                       std::vector<TTYPE>&       ell_val,            \
+                                                       const host_vector<ITYPE>& csr_row_ptr,        \
+                                                       const host_vector<JTYPE>& csr_col_ind,        \
+                                                       const host_vector<TTYPE>& csr_val,            \
+                                                       host_vector<JTYPE>&       ell_col_ind,        \
+                                                       host_vector<TTYPE>&       ell_val,            \
                                                        JTYPE&                    ell_width,          \
                                                        rocsparse_index_base      csr_base,           \
                                                        rocsparse_index_base      ell_base);
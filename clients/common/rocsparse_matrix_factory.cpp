@@ -26,6 +26,8 @@
 #include "rocsparse_clients_envariables.hpp"
 #include "rocsparse_init.hpp"
 
+#include <sstream>
+
 static void get_matrix_full_filename(std::string&       full_filename_,
                                      const std::string& filename_,
                                      const std::string& extension_,
@@ -77,11 +79,17 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
         rocsparse_seedrand();
     }
 
+    //
+    // Parameters of the factory, identifying its matrices in the cache.
+    //
+    std::ostringstream key;
+
     switch(matrix)
     {
     case rocsparse_matrix_random:
     {
         rocsparse_matrix_init_kind matrix_init_kind = arg.matrix_init_kind;
+        key << "random " << full_rank << " " << to_int << " " << matrix_init_kind;
         this->m_instance
             = new rocsparse_matrix_factory_random<T, I, J>(full_rank, to_int, matrix_init_kind);
         break;
@@ -90,6 +98,7 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
     case rocsparse_matrix_laplace_2d:
     {
         this->m_instance = new rocsparse_matrix_factory_laplace2d<T, I, J>(arg.dimx, arg.dimy);
+        key << "laplace2d " << arg.dimx << " " << arg.dimy;
         break;
     }
 
@@ -97,12 +106,23 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
     {
         this->m_instance
             = new rocsparse_matrix_factory_laplace3d<T, I, J>(arg.dimx, arg.dimy, arg.dimz);
+        key << "laplace3d " << arg.dimx << " " << arg.dimy << " " << arg.dimz;
+        break;
+    }
+
+    case rocsparse_matrix_stencil_3d:
+    {
+        this->m_instance = new rocsparse_matrix_factory_stencil3d<T, I, J>(
+            arg.dimx, arg.dimy, arg.dimz, arg.stencil, arg.dof, arg.permute != 0);
+        key << "stencil3d " << arg.dimx << " " << arg.dimy << " " << arg.dimz << " " << arg.stencil
+            << " " << arg.dof << " " << arg.permute;
         break;
     }
 
     case rocsparse_matrix_tridiagonal:
     {
         this->m_instance = new rocsparse_matrix_factory_tridiagonal<T, I, J>(arg.l, arg.u);
+        key << "tridiagonal " << arg.l << " " << arg.u;
         break;
     }
 
@@ -110,6 +130,25 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
     {
         this->m_instance
             = new rocsparse_matrix_factory_pentadiagonal<T, I, J>(arg.ll, arg.l, arg.u, arg.uu);
+        key << "pentadiagonal " << arg.ll << " " << arg.l << " " << arg.u << " " << arg.uu;
+        break;
+    }
+
+    case rocsparse_matrix_rmat:
+    {
+        this->m_instance = new rocsparse_matrix_factory_rmat<T, I, J>(
+            arg.skew, arg.avg_degree, arg.symmetrize != 0, to_int);
+        key << "rmat " << arg.skew << " " << arg.avg_degree << " " << arg.symmetrize << " "
+            << to_int;
+        break;
+    }
+
+    case rocsparse_matrix_powerlaw:
+    {
+        this->m_instance = new rocsparse_matrix_factory_powerlaw<T, I, J>(
+            arg.skew, arg.avg_degree, arg.symmetrize != 0, to_int);
+        key << "powerlaw " << arg.skew << " " << arg.avg_degree << " " << arg.symmetrize << " "
+            << to_int;
         break;
     }
 
@@ -120,6 +159,7 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
 
         this->m_instance
             = new rocsparse_matrix_factory_rocalution<T, I, J>(full_filename.c_str(), to_int);
+        key << "rocalution " << to_int << " " << full_filename;
         break;
     }
 
@@ -129,6 +169,17 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
         get_matrix_full_filename(full_filename, arg.filename, ".bin", arg.timing);
         this->m_instance
             = new rocsparse_matrix_factory_rocsparseio<T, I, J>(full_filename.c_str(), to_int);
+        key << "rocsparseio " << to_int << " " << full_filename;
+        break;
+    }
+
+    case rocsparse_matrix_file_chunked:
+    {
+        std::string full_filename;
+        get_matrix_full_filename(full_filename, arg.filename, ".cbin", arg.timing);
+        this->m_instance
+            = new rocsparse_matrix_factory_chunked<T, I, J>(full_filename.c_str(), to_int);
+        key << "chunked " << to_int << " " << full_filename;
         break;
     }
 
@@ -137,6 +188,7 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
         std::string full_filename;
         get_matrix_full_filename(full_filename, arg.filename, ".mtx", arg.timing);
         this->m_instance = new rocsparse_matrix_factory_mtx<T, I, J>(full_filename.c_str());
+        key << "mtx " << full_filename;
         break;
     }
 
@@ -153,6 +205,15 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments&
     }
     }
     assert(this->m_instance != nullptr);
+
+    //
+    // Keep the generated or imported matrices in the cache, the zero matrix is not worth it.
+    //
+    if(this->m_instance != nullptr && matrix != rocsparse_matrix_zero
+       && rocsparse_matrix_factory_cache<T, I, J>::is_enabled())
+    {
+        this->m_instance = new rocsparse_matrix_factory_cache<T, I, J>(this->m_instance, key.str());
+    }
 }
 
 //
@@ -171,9 +232,9 @@ rocsparse_matrix_factory<T, I, J>::rocsparse_matrix_factory(const Arguments& arg
 // COO
 //
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory<T, I, J>::init_coo(std::vector<I>&      coo_row_ind,
-                                                 std::vector<I>&      coo_col_ind,
-                                                 std::vector<T>&      coo_val,
+void rocsparse_matrix_factory<T, I, J>::init_coo(host_vector<I>&      coo_row_ind,
+                                                 host_vector<I>&      coo_col_ind,
+                                                 host_vector<T>&      coo_val,
                                                  I&                   M,
                                                  I&                   N,
                                                  int64_t&             nnz,
@@ -242,9 +303,9 @@ void rocsparse_matrix_factory<T, I, J>::init_coo(host_coo_matrix<T, I>& that, I&
 // CSR
 //
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory<T, I, J>::init_csr(std::vector<I>&      csr_row_ptr,
-                                                 std::vector<J>&      csr_col_ind,
-                                                 std::vector<T>&      csr_val,
+void rocsparse_matrix_factory<T, I, J>::init_csr(host_vector<I>&      csr_row_ptr,
+                                                 host_vector<J>&      csr_col_ind,
+                                                 host_vector<T>&      csr_val,
                                                  J&                   m,
                                                  J&                   n,
                                                  I&                   nnz,
@@ -313,9 +374,9 @@ void rocsparse_matrix_factory<T, I, J>::init_csr(host_csr_matrix<T, I, J>& that,
 // CSC
 //
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory<T, I, J>::init_csc(std::vector<I>&      csc_col_ptr,
-                                                 std::vector<J>&      csc_row_ind,
-                                                 std::vector<T>&      csc_val,
+void rocsparse_matrix_factory<T, I, J>::init_csc(host_vector<I>&      csc_col_ptr,
+                                                 host_vector<J>&      csc_row_ind,
+                                                 host_vector<T>&      csc_val,
                                                  J&                   M,
                                                  J&                   N,
                                                  I&                   nnz,
@@ -358,9 +419,9 @@ void rocsparse_matrix_factory<T, I, J>::init_csc(host_csc_matrix<T, I, J>& that,
 // GEBSR
 //
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory<T, I, J>::init_gebsr(std::vector<I>&      bsr_row_ptr,
-                                                   std::vector<J>&      bsr_col_ind,
-                                                   std::vector<T>&      bsr_val,
+void rocsparse_matrix_factory<T, I, J>::init_gebsr(host_vector<I>&      bsr_row_ptr,
+                                                   host_vector<J>&      bsr_col_ind,
+                                                   host_vector<T>&      bsr_val,
                                                    rocsparse_direction  dirb,
                                                    J&                   Mb,
                                                    J&                   Nb,
@@ -549,9 +610,9 @@ void rocsparse_matrix_factory<T, I, J>::init_gebsr_spezial(host_gebsr_matrix<T,
 }
 
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory<T, I, J>::init_gebsc(std::vector<I>&      bsc_col_ptr,
-                                                   std::vector<J>&      bsc_row_ind,
-                                                   std::vector<T>&      bsc_val,
+void rocsparse_matrix_factory<T, I, J>::init_gebsc(host_vector<I>&      bsc_col_ptr,
+                                                   host_vector<J>&      bsc_row_ind,
+                                                   host_vector<T>&      bsc_val,
                                                    rocsparse_direction  dirb,
                                                    J&                   Mb,
                                                    J&                   Nb,
@@ -580,9 +641,9 @@ void rocsparse_matrix_factory<T, I, J>::init_gebsc(std::vector<I>&      bsc_col_
 //
 
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory<T, I, J>::init_bsr(std::vector<I>&      bsr_row_ptr,
-                                                 std::vector<J>&      bsr_col_ind,
-                                                 std::vector<T>&      bsr_val,
+void rocsparse_matrix_factory<T, I, J>::init_bsr(host_vector<I>&      bsr_row_ptr,
+                                                 host_vector<J>&      bsr_col_ind,
+                                                 host_vector<T>&      bsr_val,
                                                  rocsparse_direction  dirb,
                                                  J&                   Mb,
                                                  J&                   Nb,
@@ -0,0 +1,401 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_matrix_factory_cache.hpp"
+#include "rocsparse_clients_envariables.hpp"
+#include "rocsparse_random.hpp"
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace
+{
+    struct entry_base_t
+    {
+        virtual ~entry_base_t() = default;
+        size_t bytes{};
+    };
+
+    //
+    // Matrix of the cache, A and B are the types of the index arrays.
+    //
+    template <typename T, typename A, typename B>
+    struct entry_t : public entry_base_t
+    {
+        rocsparse_rng_state before;
+        rocsparse_rng_state after;
+        host_vector<A>      a{};
+        host_vector<B>      b{};
+        host_vector<T>      val{};
+        int64_t             sizes[5]{};
+    };
+
+    //
+    // Least recently used cache of the process.
+    //
+    class matrix_cache_t
+    {
+    private:
+        using entry_ptr_t = std::shared_ptr<const entry_base_t>;
+        using lru_t       = std::list<std::string>;
+
+        std::mutex                                                          m_mutex{};
+        size_t                                                              m_capacity{};
+        size_t                                                              m_size{};
+        lru_t                                                               m_lru{};
+        std::unordered_map<std::string, std::pair<entry_ptr_t, lru_t::iterator>> m_entries{};
+        std::atomic<size_t>                                                 m_hits{};
+        std::atomic<size_t>                                                 m_misses{};
+
+        matrix_cache_t()
+        {
+            // Matrices are reused across the tests, but rarely within a benchmark run where
+            // copying them on each hit would only add memory traffic.
+#ifdef GOOGLE_TEST
+            size_t megabytes = 1024;
+#else
+            size_t megabytes = 0;
+#endif
+            if(rocsparse_clients_envariables::is_defined(
+                   rocsparse_clients_envariables::MATRIX_CACHE_SIZE))
+            {
+                megabytes = std::strtoull(
+                    rocsparse_clients_envariables::get(
+                        rocsparse_clients_envariables::MATRIX_CACHE_SIZE),
+                    nullptr,
+                    10);
+            }
+            this->m_capacity = megabytes * 1024 * 1024;
+        }
+
+    public:
+        static matrix_cache_t& instance()
+        {
+            static matrix_cache_t self;
+            return self;
+        }
+
+        size_t capacity() const
+        {
+            return this->m_capacity;
+        }
+
+        size_t hits() const
+        {
+            return this->m_hits;
+        }
+
+        size_t misses() const
+        {
+            return this->m_misses;
+        }
+
+        void count(bool hit)
+        {
+            ++(hit ? this->m_hits : this->m_misses);
+        }
+
+        entry_ptr_t find(const std::string& key)
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            auto                        it = this->m_entries.find(key);
+            if(it == this->m_entries.end())
+            {
+                return nullptr;
+            }
+            this->m_lru.splice(this->m_lru.begin(), this->m_lru, it->second.second);
+            return it->second.first;
+        }
+
+        void insert(const std::string& key, entry_ptr_t entry)
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            auto                        it = this->m_entries.find(key);
+            if(it != this->m_entries.end())
+            {
+                this->m_size -= it->second.first->bytes;
+                this->m_lru.erase(it->second.second);
+                this->m_entries.erase(it);
+            }
+
+            while(this->m_size + entry->bytes > this->m_capacity && !this->m_lru.empty())
+            {
+                auto last = this->m_entries.find(this->m_lru.back());
+                this->m_size -= last->second.first->bytes;
+                this->m_entries.erase(last);
+                this->m_lru.pop_back();
+            }
+
+            this->m_lru.push_front(key);
+            this->m_size += entry->bytes;
+            this->m_entries[key] = std::make_pair(entry, this->m_lru.begin());
+        }
+    };
+
+    template <typename T, typename I, typename J>
+    std::string type_key()
+    {
+        std::ostringstream key;
+        key << typeid(T).name() << " " << sizeof(I) << " " << sizeof(J) << " ";
+        return key.str();
+    }
+
+    //
+    // Matrix of the cache generated from the current state of the random number generators.
+    //
+    template <typename T, typename A, typename B>
+    std::shared_ptr<const entry_t<T, A, B>> cache_find(const std::string&         key,
+                                                       const rocsparse_rng_state& before)
+    {
+        // The key contains the types, the cast is safe.
+        auto       found = matrix_cache_t::instance().find(key);
+        auto       entry = std::static_pointer_cast<const entry_t<T, A, B>>(found);
+        const bool hit   = (entry != nullptr && entry->before == before);
+        matrix_cache_t::instance().count(hit);
+        return hit ? entry : nullptr;
+    }
+
+    template <typename T, typename A, typename B>
+    void cache_insert(const std::string&         key,
+                      const rocsparse_rng_state& before,
+                      const host_vector<A>&      a,
+                      const host_vector<B>&      b,
+                      const host_vector<T>&      val,
+                      int64_t                    s0,
+                      int64_t                    s1,
+                      int64_t                    s2,
+                      int64_t                    s3 = 0,
+                      int64_t                    s4 = 0)
+    {
+        const size_t bytes = sizeof(entry_t<T, A, B>) + sizeof(A) * a.size()
+                             + sizeof(B) * b.size() + sizeof(T) * val.size();
+        // Large matrices would evict most of the cache and are cheap to regenerate in
+        // comparison to the time spent using them.
+        if(bytes > matrix_cache_t::instance().capacity() / 8)
+        {
+            return;
+        }
+
+        auto entry      = std::make_shared<entry_t<T, A, B>>();
+        entry->bytes    = bytes;
+        entry->before   = before;
+        entry->after    = rocsparse_rng_state();
+        entry->a        = a;
+        entry->b        = b;
+        entry->val      = val;
+        entry->sizes[0] = s0;
+        entry->sizes[1] = s1;
+        entry->sizes[2] = s2;
+        entry->sizes[3] = s3;
+        entry->sizes[4] = s4;
+        matrix_cache_t::instance().insert(key, entry);
+    }
+}
+
+template <typename T, typename I, typename J>
+rocsparse_matrix_factory_cache<T, I, J>::rocsparse_matrix_factory_cache(
+    rocsparse_matrix_factory_base<T, I, J>* instance, const std::string& key)
+    : m_instance(instance)
+    , m_key(type_key<T, I, J>() + key)
+{
+}
+
+template <typename T, typename I, typename J>
+rocsparse_matrix_factory_cache<T, I, J>::~rocsparse_matrix_factory_cache()
+{
+    delete this->m_instance;
+}
+
+template <typename T, typename I, typename J>
+bool rocsparse_matrix_factory_cache<T, I, J>::is_enabled()
+{
+    return matrix_cache_t::instance().capacity() > 0;
+}
+
+template <typename T, typename I, typename J>
+size_t rocsparse_matrix_factory_cache<T, I, J>::hits()
+{
+    return matrix_cache_t::instance().hits();
+}
+
+template <typename T, typename I, typename J>
+size_t rocsparse_matrix_factory_cache<T, I, J>::misses()
+{
+    return matrix_cache_t::instance().misses();
+}
+
+template <typename T, typename I, typename J>
+void rocsparse_matrix_factory_cache<T, I, J>::init_csr(host_vector<I>&        csr_row_ptr,
+                                                       host_vector<J>&        csr_col_ind,
+                                                       host_vector<T>&        csr_val,
+                                                       J&                     M,
+                                                       J&                     N,
+                                                       I&                     nnz,
+                                                       rocsparse_index_base   base,
+                                                       rocsparse_matrix_type  matrix_type,
+                                                       rocsparse_fill_mode    uplo,
+                                                       rocsparse_storage_mode storage)
+{
+    std::ostringstream key;
+    key << this->m_key << " csr " << M << " " << N << " " << nnz << " " << base << " "
+        << matrix_type << " " << uplo << " " << storage;
+
+    const rocsparse_rng_state before;
+    auto                      entry = cache_find<T, I, J>(key.str(), before);
+    if(entry != nullptr)
+    {
+        csr_row_ptr = entry->a;
+        csr_col_ind = entry->b;
+        csr_val     = entry->val;
+        M           = static_cast<J>(entry->sizes[0]);
+        N           = static_cast<J>(entry->sizes[1]);
+        nnz         = static_cast<I>(entry->sizes[2]);
+        entry->after.restore();
+        return;
+    }
+
+    this->m_instance->init_csr(
+        csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base, matrix_type, uplo, storage);
+    cache_insert(key.str(), before, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz);
+}
+
+template <typename T, typename I, typename J>
+void rocsparse_matrix_factory_cache<T, I, J>::init_gebsr(host_vector<I>&        bsr_row_ptr,
+                                                         host_vector<J>&        bsr_col_ind,
+                                                         host_vector<T>&        bsr_val,
+                                                         rocsparse_direction    dirb,
+                                                         J&                     Mb,
+                                                         J&                     Nb,
+                                                         I&                     nnzb,
+                                                         J&                     row_block_dim,
+                                                         J&                     col_block_dim,
+                                                         rocsparse_index_base   base,
+                                                         rocsparse_matrix_type  matrix_type,
+                                                         rocsparse_fill_mode    uplo,
+                                                         rocsparse_storage_mode storage)
+{
+    std::ostringstream key;
+    key << this->m_key << " gebsr " << dirb << " " << Mb << " " << Nb << " " << nnzb << " "
+        << row_block_dim << " " << col_block_dim << " " << base << " " << matrix_type << " "
+        << uplo << " " << storage;
+
+    const rocsparse_rng_state before;
+    auto                      entry = cache_find<T, I, J>(key.str(), before);
+    if(entry != nullptr)
+    {
+        bsr_row_ptr   = entry->a;
+        bsr_col_ind   = entry->b;
+        bsr_val       = entry->val;
+        Mb            = static_cast<J>(entry->sizes[0]);
+        Nb            = static_cast<J>(entry->sizes[1]);
+        nnzb          = static_cast<I>(entry->sizes[2]);
+        row_block_dim = static_cast<J>(entry->sizes[3]);
+        col_block_dim = static_cast<J>(entry->sizes[4]);
+        entry->after.restore();
+        return;
+    }
+
+    this->m_instance->init_gebsr(bsr_row_ptr,
+                                 bsr_col_ind,
+                                 bsr_val,
+                                 dirb,
+                                 Mb,
+                                 Nb,
+                                 nnzb,
+                                 row_block_dim,
+                                 col_block_dim,
+                                 base,
+                                 matrix_type,
+                                 uplo,
+                                 storage);
+    cache_insert(key.str(),
+                 before,
+                 bsr_row_ptr,
+                 bsr_col_ind,
+                 bsr_val,
+                 Mb,
+                 Nb,
+                 nnzb,
+                 row_block_dim,
+                 col_block_dim);
+}
+
+template <typename T, typename I, typename J>
+void rocsparse_matrix_factory_cache<T, I, J>::init_coo(host_vector<I>&        coo_row_ind,
+                                                       host_vector<I>&        coo_col_ind,
+                                                       host_vector<T>&        coo_val,
+                                                       I&                     M,
+                                                       I&                     N,
+                                                       int64_t&               nnz,
+                                                       rocsparse_index_base   base,
+                                                       rocsparse_matrix_type  matrix_type,
+                                                       rocsparse_fill_mode    uplo,
+                                                       rocsparse_storage_mode storage)
+{
+    std::ostringstream key;
+    key << this->m_key << " coo " << M << " " << N << " " << nnz << " " << base << " "
+        << matrix_type << " " << uplo << " " << storage;
+
+    const rocsparse_rng_state before;
+    auto                      entry = cache_find<T, I, I>(key.str(), before);
+    if(entry != nullptr)
+    {
+        coo_row_ind = entry->a;
+        coo_col_ind = entry->b;
+        coo_val     = entry->val;
+        M           = static_cast<I>(entry->sizes[0]);
+        N           = static_cast<I>(entry->sizes[1]);
+        nnz         = entry->sizes[2];
+        entry->after.restore();
+        return;
+    }
+
+    this->m_instance->init_coo(
+        coo_row_ind, coo_col_ind, coo_val, M, N, nnz, base, matrix_type, uplo, storage);
+    cache_insert(key.str(), before, coo_row_ind, coo_col_ind, coo_val, M, N, nnz);
+}
+
+template struct rocsparse_matrix_factory_cache<int8_t, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<int8_t, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<int8_t, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory_cache<float, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<float, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<float, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory_cache<double, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<double, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<double, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory_cache<rocsparse_float_complex, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<rocsparse_float_complex, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<rocsparse_float_complex, int64_t, int64_t>;
+
+template struct rocsparse_matrix_factory_cache<rocsparse_double_complex, int32_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<rocsparse_double_complex, int64_t, int32_t>;
+template struct rocsparse_matrix_factory_cache<rocsparse_double_complex, int64_t, int64_t>;
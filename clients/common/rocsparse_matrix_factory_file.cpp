@@ -84,6 +84,12 @@ struct rocsparse_init_file_traits<rocsparse_matrix_file_rocsparseio>
     using importer_t = rocsparse_importer_rocsparseio;
 };
 
+template <>
+struct rocsparse_init_file_traits<rocsparse_matrix_file_chunked>
+{
+    using importer_t = rocsparse_importer_chunked;
+};
+
 template <rocsparse_matrix_init MATRIX_INIT>
 struct rocsparse_init_file
 {
@@ -123,9 +129,9 @@ struct spec
 {
     template <rocsparse_matrix_init MATRIX_INIT>
     static void init_gebsr_rocalution(rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>& factory,
-                                      std::vector<I>&        bsr_row_ptr,
-                                      std::vector<J>&        bsr_col_ind,
-                                      std::vector<T>&        bsr_val,
+                                      host_vector<I>&        bsr_row_ptr,
+                                      host_vector<J>&        bsr_col_ind,
+                                      host_vector<T>&        bsr_val,
                                       rocsparse_direction    dirb,
                                       J&                     Mb,
                                       J&                     Nb,
@@ -156,9 +162,9 @@ struct spec<T, rocsparse_int, rocsparse_int>
     template <rocsparse_matrix_init MATRIX_INIT>
     static void init_gebsr_rocalution(
         rocsparse_matrix_factory_file<MATRIX_INIT, T, rocsparse_int, rocsparse_int>& factory,
-        std::vector<rocsparse_int>&                                                  bsr_row_ptr,
-        std::vector<rocsparse_int>&                                                  bsr_col_ind,
-        std::vector<T>&                                                              bsr_val,
+        host_vector<rocsparse_int>&                                                  bsr_row_ptr,
+        host_vector<rocsparse_int>&                                                  bsr_col_ind,
+        host_vector<T>&                                                              bsr_val,
         rocsparse_direction                                                          dirb,
         rocsparse_int&                                                               Mb,
         rocsparse_int&                                                               Nb,
@@ -229,9 +235,9 @@ struct spec<T, rocsparse_int, rocsparse_int>
 
 template <rocsparse_matrix_init MATRIX_INIT, typename T, typename I, typename J>
 void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_gebsr(
-    std::vector<I>&        bsr_row_ptr,
-    std::vector<J>&        bsr_col_ind,
-    std::vector<T>&        bsr_val,
+    host_vector<I>&        bsr_row_ptr,
+    host_vector<J>&        bsr_col_ind,
+    host_vector<T>&        bsr_val,
     rocsparse_direction    dirb,
     J&                     Mb,
     J&                     Nb,
@@ -292,6 +298,21 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_gebsr(
                                          base);
         break;
     }
+    case rocsparse_matrix_file_chunked:
+    {
+        rocsparse_init_gebsr_chunked(this->m_filename.c_str(),
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     bsr_val,
+                                     dirb,
+                                     Mb,
+                                     Nb,
+                                     nnzb,
+                                     row_block_dim,
+                                     col_block_dim,
+                                     base);
+        break;
+    }
     }
 
     switch(storage)
@@ -316,9 +337,9 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_gebsr(
 
 template <rocsparse_matrix_init MATRIX_INIT, typename T, typename I, typename J>
 void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_csr(
-    std::vector<I>&        csr_row_ptr,
-    std::vector<J>&        csr_col_ind,
-    std::vector<T>&        csr_val,
+    host_vector<I>&        csr_row_ptr,
+    host_vector<J>&        csr_col_ind,
+    host_vector<T>&        csr_val,
     J&                     M,
     J&                     N,
     I&                     nnz,
@@ -327,9 +348,9 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_csr(
     rocsparse_fill_mode    uplo,
     rocsparse_storage_mode storage)
 {
-    std::vector<I> row_ptr;
-    std::vector<J> col_ind;
-    std::vector<T> val;
+    host_vector<I> row_ptr;
+    host_vector<J> col_ind;
+    host_vector<T> val;
 
     switch(MATRIX_INIT)
     {
@@ -346,6 +367,13 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_csr(
             this->m_filename.c_str(), row_ptr, col_ind, val, M, N, nnz, base);
         break;
     }
+
+    case rocsparse_matrix_file_chunked:
+    {
+        rocsparse_init_csr_chunked(
+            this->m_filename.c_str(), row_ptr, col_ind, val, M, N, nnz, base);
+        break;
+    }
     case rocsparse_matrix_file_mtx:
     {
         rocsparse_init_csr_mtx(this->m_filename.c_str(), row_ptr, col_ind, val, M, N, nnz, base);
@@ -406,9 +434,9 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_csr(
 
 template <rocsparse_matrix_init MATRIX_INIT, typename T, typename I, typename J>
 void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_coo(
-    std::vector<I>&        coo_row_ind,
-    std::vector<I>&        coo_col_ind,
-    std::vector<T>&        coo_val,
+    host_vector<I>&        coo_row_ind,
+    host_vector<I>&        coo_col_ind,
+    host_vector<T>&        coo_val,
     I&                     M,
     I&                     N,
     int64_t&               nnz,
@@ -417,9 +445,9 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_coo(
     rocsparse_fill_mode    uplo,
     rocsparse_storage_mode storage)
 {
-    std::vector<I> row_ind;
-    std::vector<I> col_ind;
-    std::vector<T> val;
+    host_vector<I> row_ind;
+    host_vector<I> col_ind;
+    host_vector<T> val;
 
     switch(MATRIX_INIT)
     {
@@ -444,6 +472,13 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_coo(
             this->m_filename.c_str(), row_ind, col_ind, val, M, N, nnz, base);
         break;
     }
+
+    case rocsparse_matrix_file_chunked:
+    {
+        rocsparse_init_coo_chunked(
+            this->m_filename.c_str(), row_ind, col_ind, val, M, N, nnz, base);
+        break;
+    }
     }
 
     switch(matrix_type)
@@ -661,3 +696,68 @@ template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio,
                                               rocsparse_double_complex,
                                               int64_t,
                                               int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              int8_t,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              int8_t,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              int8_t,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              float,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              float,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              float,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              double,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              double,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              double,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              rocsparse_float_complex,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              rocsparse_float_complex,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              rocsparse_float_complex,
+                                              int64_t,
+                                              int64_t>;
+
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              rocsparse_double_complex,
+                                              int32_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              rocsparse_double_complex,
+                                              int64_t,
+                                              int32_t>;
+template struct rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked,
+                                              rocsparse_double_complex,
+                                              int64_t,
+                                              int64_t>;
@@ -36,9 +36,9 @@ rocsparse_matrix_factory_laplace3d<T, I, J>::rocsparse_matrix_factory_laplace3d(
     , m_dimz(dimz){};
 
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory_laplace3d<T, I, J>::init_csr(std::vector<I>&        csr_row_ptr,
-                                                           std::vector<J>&        csr_col_ind,
-                                                           std::vector<T>&        csr_val,
+void rocsparse_matrix_factory_laplace3d<T, I, J>::init_csr(host_vector<I>&        csr_row_ptr,
+                                                           host_vector<J>&        csr_col_ind,
+                                                           host_vector<T>&        csr_val,
                                                            J&                     M,
                                                            J&                     N,
                                                            I&                     nnz,
@@ -53,9 +53,9 @@ void rocsparse_matrix_factory_laplace3d<T, I, J>::init_csr(std::vector<I>&
     case rocsparse_matrix_type_hermitian:
     case rocsparse_matrix_type_triangular:
     {
-        std::vector<I> ptr;
-        std::vector<J> ind;
-        std::vector<T> val;
+        host_vector<I> ptr;
+        host_vector<J> ind;
+        host_vector<T> val;
 
         rocsparse_init_csr_laplace3d(
             ptr, ind, val, this->m_dimx, this->m_dimy, this->m_dimz, M, N, nnz, base);
@@ -105,9 +105,9 @@ void rocsparse_matrix_factory_laplace3d<T, I, J>::init_csr(std::vector<I>&
 }
 
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory_laplace3d<T, I, J>::init_coo(std::vector<I>&        coo_row_ind,
-                                                           std::vector<I>&        coo_col_ind,
-                                                           std::vector<T>&        coo_val,
+void rocsparse_matrix_factory_laplace3d<T, I, J>::init_coo(host_vector<I>&        coo_row_ind,
+                                                           host_vector<I>&        coo_col_ind,
+                                                           host_vector<T>&        coo_val,
                                                            I&                     M,
                                                            I&                     N,
                                                            int64_t&               nnz,
@@ -122,9 +122,9 @@ void rocsparse_matrix_factory_laplace3d<T, I, J>::init_coo(std::vector<I>&
     case rocsparse_matrix_type_hermitian:
     case rocsparse_matrix_type_triangular:
     {
-        std::vector<I> row_ind;
-        std::vector<I> col_ind;
-        std::vector<T> val;
+        host_vector<I> row_ind;
+        host_vector<I> col_ind;
+        host_vector<T> val;
 
         rocsparse_init_coo_laplace3d(
             row_ind, col_ind, val, this->m_dimx, this->m_dimy, this->m_dimz, M, N, nnz, base);
@@ -174,9 +174,9 @@ void rocsparse_matrix_factory_laplace3d<T, I, J>::init_coo(std::vector<I>&
 }
 
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory_laplace3d<T, I, J>::init_gebsr(std::vector<I>&        bsr_row_ptr,
-                                                             std::vector<J>&        bsr_col_ind,
-                                                             std::vector<T>&        bsr_val,
+void rocsparse_matrix_factory_laplace3d<T, I, J>::init_gebsr(host_vector<I>&        bsr_row_ptr,
+                                                             host_vector<J>&        bsr_col_ind,
+                                                             host_vector<T>&        bsr_val,
                                                              rocsparse_direction    dirb,
                                                              J&                     Mb,
                                                              J&                     Nb,
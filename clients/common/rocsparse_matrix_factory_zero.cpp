@@ -29,9 +29,9 @@ template <typename T, typename I, typename J>
 rocsparse_matrix_factory_zero<T, I, J>::rocsparse_matrix_factory_zero(){};
 
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory_zero<T, I, J>::init_csr(std::vector<I>&        csr_row_ptr,
-                                                      std::vector<J>&        csr_col_ind,
-                                                      std::vector<T>&        csr_val,
+void rocsparse_matrix_factory_zero<T, I, J>::init_csr(host_vector<I>&        csr_row_ptr,
+                                                      host_vector<J>&        csr_col_ind,
+                                                      host_vector<T>&        csr_val,
                                                       J&                     M,
                                                       J&                     N,
                                                       I&                     nnz,
@@ -48,9 +48,9 @@ void rocsparse_matrix_factory_zero<T, I, J>::init_csr(std::vector<I>&        csr
 }
 
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory_zero<T, I, J>::init_gebsr(std::vector<I>&        bsr_row_ptr,
-                                                        std::vector<J>&        bsr_col_ind,
-                                                        std::vector<T>&        bsr_val,
+void rocsparse_matrix_factory_zero<T, I, J>::init_gebsr(host_vector<I>&        bsr_row_ptr,
+                                                        host_vector<J>&        bsr_col_ind,
+                                                        host_vector<T>&        bsr_val,
                                                         rocsparse_direction    dirb,
                                                         J&                     Mb,
                                                         J&                     Nb,
@@ -70,9 +70,9 @@ void rocsparse_matrix_factory_zero<T, I, J>::init_gebsr(std::vector<I>&        b
 }
 
 template <typename T, typename I, typename J>
-void rocsparse_matrix_factory_zero<T, I, J>::init_coo(std::vector<I>&        coo_row_ind,
-                                                      std::vector<I>&        coo_col_ind,
-                                                      std::vector<T>&        coo_val,
+void rocsparse_matrix_factory_zero<T, I, J>::init_coo(host_vector<I>&        coo_row_ind,
+                                                      host_vector<I>&        coo_col_ind,
+                                                      host_vector<T>&        coo_val,
                                                       I&                     M,
                                                       I&                     N,
                                                       int64_t&               nnz,
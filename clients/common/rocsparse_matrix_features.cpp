@@ -0,0 +1,359 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_matrix_features.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+constexpr int rocsparse_matrix_features::s_block_dims[];
+
+//
+// Visit the scalar features, in the order of the CSV columns.
+//
+template <typename F>
+static void visit_scalar_features(const rocsparse_matrix_features& f, F&& visit)
+{
+    visit("m", f.m);
+    visit("n", f.n);
+    visit("nnz", f.nnz);
+    visit("row_nnz_min", f.row_nnz_min);
+    visit("row_nnz_max", f.row_nnz_max);
+    visit("row_nnz_mean", f.row_nnz_mean);
+    visit("row_nnz_stddev", f.row_nnz_stddev);
+    visit("row_nnz_p50", f.row_nnz_p50);
+    visit("row_nnz_p90", f.row_nnz_p90);
+    visit("row_nnz_p99", f.row_nnz_p99);
+    visit("empty_rows", f.empty_rows);
+    visit("lower_bandwidth", f.lower_bandwidth);
+    visit("upper_bandwidth", f.upper_bandwidth);
+    visit("profile", f.profile);
+    visit("missing_diagonal", f.missing_diagonal);
+    visit("diagonal_dominance", f.diagonal_dominance);
+    visit("diagonal_dominance_min", f.diagonal_dominance_min);
+    for(int k = 0; k < rocsparse_matrix_features::s_nblock_dims; ++k)
+    {
+        const std::string dim = std::to_string(rocsparse_matrix_features::s_block_dims[k]);
+        visit(("bsr_nnzb_" + dim).c_str(), f.bsr_nnzb[k]);
+        visit(("bsr_fill_" + dim).c_str(), f.bsr_fill[k]);
+    }
+    visit("ell_padding", f.ell_padding);
+    visit("hyb_ell_width", f.hyb_ell_width);
+    visit("hyb_ell_padding", f.hyb_ell_padding);
+    visit("hyb_coo_fraction", f.hyb_coo_fraction);
+    visit("lower_dag_depth", f.lower_dag_depth);
+    visit("lower_dag_width", f.lower_dag_width);
+    visit("upper_dag_depth", f.upper_dag_depth);
+    visit("upper_dag_width", f.upper_dag_width);
+}
+
+//
+// Level-set analysis of a triangular part, rows are visited in dependency order.
+//
+template <typename I, typename J>
+static void dag_levels(J        m,
+                       const I* csr_row_ptr,
+                       const J* csr_col_ind,
+                       I        base,
+                       bool     lower,
+                       int64_t& depth,
+                       int64_t& width)
+{
+    std::vector<int64_t> level(m, 0);
+    std::vector<int64_t> count;
+
+    for(J r = 0; r < m; ++r)
+    {
+        const J i   = lower ? r : m - 1 - r;
+        int64_t lev = 0;
+        for(I k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            const J j = static_cast<J>(csr_col_ind[k] - base);
+            if((lower && j < i) || (!lower && j > i && j < m))
+            {
+                lev = std::max(lev, level[j]);
+            }
+        }
+
+        level[i] = lev + 1;
+        if(static_cast<size_t>(lev) >= count.size())
+        {
+            count.resize(lev + 1, 0);
+        }
+        ++count[lev];
+    }
+
+    depth = count.size();
+    width = count.empty() ? 0 : *std::max_element(count.begin(), count.end());
+}
+
+template <typename T, typename I, typename J>
+void rocsparse_matrix_features::compute(J                    m,
+                                        J                    n,
+                                        I                    nnz,
+                                        const I*             csr_row_ptr,
+                                        const J*             csr_col_ind,
+                                        const T*             csr_val,
+                                        rocsparse_index_base base)
+{
+    const I b = static_cast<I>(base);
+    const J k = std::min(m, n);
+
+    this->m   = m;
+    this->n   = n;
+    this->nnz = nnz;
+
+    //
+    // Row lengths, bandwidth, profile and diagonal.
+    //
+    std::vector<int64_t> row_nnz(m);
+
+    int64_t row_min  = (m > 0) ? std::numeric_limits<int64_t>::max() : 0;
+    int64_t row_max  = 0;
+    int64_t empty    = 0;
+    double  sum2     = 0.0;
+    int64_t lbw      = 0;
+    int64_t ubw      = 0;
+    int64_t profile  = 0;
+    int64_t missing  = 0;
+    int64_t dominant = 0;
+    double  dom_min  = std::numeric_limits<double>::max();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(min : row_min, dom_min) \
+    reduction(max : row_max, lbw, ubw) reduction(+ : empty, sum2, profile, missing, dominant)
+#endif
+    for(J i = 0; i < m; ++i)
+    {
+        const I start = csr_row_ptr[i] - b;
+        const I end   = csr_row_ptr[i + 1] - b;
+        const I len   = end - start;
+
+        row_nnz[i] = len;
+        row_min    = std::min(row_min, static_cast<int64_t>(len));
+        row_max    = std::max(row_max, static_cast<int64_t>(len));
+        empty += (len == 0);
+        sum2 += static_cast<double>(len) * len;
+
+        J      first    = i;
+        bool   has_diag = false;
+        double diag     = 0.0;
+        double off      = 0.0;
+        for(I p = start; p < end; ++p)
+        {
+            const J      j = static_cast<J>(csr_col_ind[p] - b);
+            const double v = std::abs(csr_val[p]);
+            if(j < i)
+            {
+                lbw   = std::max(lbw, static_cast<int64_t>(i - j));
+                first = std::min(first, j);
+                off += v;
+            }
+            else if(j > i)
+            {
+                ubw = std::max(ubw, static_cast<int64_t>(j - i));
+                off += v;
+            }
+            else
+            {
+                has_diag = true;
+                diag += v;
+            }
+        }
+
+        profile += i - first;
+
+        if(i < k)
+        {
+            missing += !has_diag;
+            dominant += (has_diag && diag >= off);
+            if(off > 0.0)
+            {
+                dom_min = std::min(dom_min, diag / off);
+            }
+        }
+    }
+
+    const double mean = (m > 0) ? static_cast<double>(nnz) / m : 0.0;
+
+    this->row_nnz_min            = row_min;
+    this->row_nnz_max            = row_max;
+    this->row_nnz_mean           = mean;
+    this->row_nnz_stddev         = (m > 0) ? std::sqrt(std::max(sum2 / m - mean * mean, 0.0)) : 0.0;
+    this->empty_rows             = empty;
+    this->lower_bandwidth        = lbw;
+    this->upper_bandwidth        = ubw;
+    this->profile                = profile;
+    this->missing_diagonal       = missing;
+    this->diagonal_dominance     = (k > 0) ? static_cast<double>(dominant) / k : 0.0;
+    this->diagonal_dominance_min = (dom_min == std::numeric_limits<double>::max()) ? 0.0 : dom_min;
+
+    //
+    // Histogram and percentiles.
+    //
+    this->row_nnz_histogram.assign(s_nbuckets, 0);
+    for(J i = 0; i < m; ++i)
+    {
+        int bucket = 0;
+        for(int64_t len = row_nnz[i]; len > 0 && bucket < s_nbuckets - 1; len >>= 1)
+        {
+            ++bucket;
+        }
+        ++this->row_nnz_histogram[bucket];
+    }
+
+    if(m > 0)
+    {
+        auto percentile = [&](double q) {
+            auto it = row_nnz.begin() + std::min(static_cast<int64_t>(q * m), int64_t(m) - 1);
+            std::nth_element(row_nnz.begin(), it, row_nnz.end());
+            return *it;
+        };
+        this->row_nnz_p50 = percentile(0.50);
+        this->row_nnz_p90 = percentile(0.90);
+        this->row_nnz_p99 = percentile(0.99);
+    }
+
+    //
+    // ELL and HYB padding, the HYB automatic partition uses the average row length as ELL width.
+    //
+    this->ell_padding   = (nnz > 0) ? static_cast<double>(int64_t(m) * row_max - nnz) / nnz : 0.0;
+    this->hyb_ell_width = (m > 0 && nnz > 0) ? (nnz - 1) / m + 1 : 0;
+
+    int64_t hyb_ell_nnz = 0;
+    {
+        const int64_t width = this->hyb_ell_width;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(+ : hyb_ell_nnz)
+#endif
+        for(J i = 0; i < m; ++i)
+        {
+            const int64_t len = csr_row_ptr[i + 1] - csr_row_ptr[i];
+            hyb_ell_nnz += std::min(len, width);
+        }
+    }
+
+    this->hyb_ell_padding
+        = (nnz > 0) ? static_cast<double>(int64_t(m) * this->hyb_ell_width - hyb_ell_nnz) / nnz
+                    : 0.0;
+    this->hyb_coo_fraction = (nnz > 0) ? static_cast<double>(nnz - hyb_ell_nnz) / nnz : 0.0;
+
+    //
+    // BSR fill ratio, the distinct block columns of each block row are counted.
+    //
+    for(int d = 0; d < s_nblock_dims; ++d)
+    {
+        const J dim  = s_block_dims[d];
+        const J mb   = (m + dim - 1) / dim;
+        int64_t nnzb = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<J> cols;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024) reduction(+ : nnzb)
+#endif
+            for(J ib = 0; ib < mb; ++ib)
+            {
+                cols.clear();
+                for(J i = ib * dim; i < std::min(m, (ib + 1) * dim); ++i)
+                {
+                    for(I p = csr_row_ptr[i] - b; p < csr_row_ptr[i + 1] - b; ++p)
+                    {
+                        cols.push_back(static_cast<J>(csr_col_ind[p] - b) / dim);
+                    }
+                }
+
+                std::sort(cols.begin(), cols.end());
+                nnzb += std::unique(cols.begin(), cols.end()) - cols.begin();
+            }
+        }
+
+        this->bsr_nnzb[d] = nnzb;
+        this->bsr_fill[d] = (nnzb > 0) ? static_cast<double>(nnz) / (nnzb * dim * dim) : 0.0;
+    }
+
+    //
+    // Triangular solve dependency graphs.
+    //
+    dag_levels(
+        m, csr_row_ptr, csr_col_ind, b, true, this->lower_dag_depth, this->lower_dag_width);
+    dag_levels(
+        m, csr_row_ptr, csr_col_ind, b, false, this->upper_dag_depth, this->upper_dag_width);
+}
+
+void rocsparse_matrix_features::write_csv_header(std::ostream& out)
+{
+    rocsparse_matrix_features f;
+    out << "name";
+    visit_scalar_features(f, [&out](const char* key, auto) { out << "," << key; });
+    out << std::endl;
+}
+
+void rocsparse_matrix_features::write_csv(std::ostream& out) const
+{
+    out << this->name;
+    visit_scalar_features(*this, [&out](const char*, auto value) { out << "," << value; });
+    out << std::endl;
+}
+
+void rocsparse_matrix_features::write_json(std::ostream& out) const
+{
+    out << "{" << std::endl << "  \"name\": \"" << this->name << "\"";
+    visit_scalar_features(*this, [&out](const char* key, auto value) {
+        out << "," << std::endl << "  \"" << key << "\": " << value;
+    });
+
+    out << "," << std::endl << "  \"row_nnz_histogram\": [";
+    for(size_t i = 0; i < this->row_nnz_histogram.size(); ++i)
+    {
+        out << ((i > 0) ? ", " : "") << this->row_nnz_histogram[i];
+    }
+    out << "]" << std::endl << "}" << std::endl;
+}
+
+#define INSTANTIATE(TTYPE, ITYPE, JTYPE)                                        \
+    template void rocsparse_matrix_features::compute(JTYPE                m,    \
+                                                     JTYPE                n,    \
+                                                     ITYPE                nnz,  \
+                                                     const ITYPE*         ptr,  \
+                                                     const JTYPE*         ind,  \
+                                                     const TTYPE*         val,  \
+                                                     rocsparse_index_base base)
+
+INSTANTIATE(float, int32_t, int32_t);
+INSTANTIATE(float, int64_t, int32_t);
+INSTANTIATE(float, int64_t, int64_t);
+INSTANTIATE(double, int32_t, int32_t);
+INSTANTIATE(double, int64_t, int32_t);
+INSTANTIATE(double, int64_t, int64_t);
+INSTANTIATE(rocsparse_float_complex, int32_t, int32_t);
+INSTANTIATE(rocsparse_float_complex, int64_t, int32_t);
+INSTANTIATE(rocsparse_float_complex, int64_t, int64_t);
+INSTANTIATE(rocsparse_double_complex, int32_t, int32_t);
+INSTANTIATE(rocsparse_double_complex, int64_t, int32_t);
+INSTANTIATE(rocsparse_double_complex, int64_t, int64_t);
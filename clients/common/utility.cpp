@@ -28,6 +28,7 @@
 #include "utility.hpp"
 
 #include <chrono>
+#include <cstdio>
 #include <cstdlib>
 
 #ifdef WIN32
@@ -43,6 +44,7 @@ namespace fs = std::experimental::filesystem;
 
 #else
 #include <fcntl.h>
+#include <unistd.h>
 #endif
 
 /* ============================================================================================ */
@@ -88,6 +90,25 @@ std::string rocsparse_exepath()
 #endif
 }
 
+/* ============================================================================================ */
+// Return the name of a new temporary file
+std::string rocsparse_temp_filename()
+{
+#ifdef WIN32
+    char path[L_tmpnam_s];
+    tmpnam_s(path, L_tmpnam_s);
+    return path;
+#else
+    char path[] = "/tmp/rocsparse-XXXXXX";
+    int  fd     = mkstemp(path);
+    if(fd != -1)
+    {
+        close(fd);
+    }
+    return path;
+#endif
+}
+
 /* ============================================================================================ */
 /*  timing:*/
 
@@ -33,6 +33,8 @@
 
 #include <rocsparse.h>
 
+#include "profile_models.h"
+
 /*
  * ===========================================================================
  *    level 1 SPARSE
@@ -46,18 +48,18 @@ constexpr double axpyi_gflop_count(rocsparse_int nnz)
 template <typename I>
 constexpr double axpby_gflop_count(I nnz)
 {
-    return (3.0 * nnz) / 1e9;
+    return rocsparse_axpby_flops(nnz) / 1e9;
 }
 
 constexpr double doti_gflop_count(rocsparse_int nnz)
 {
-    return (2.0 * nnz) / 1e9;
+    return rocsparse_spvv_flops(nnz) / 1e9;
 }
 
 template <typename I>
 constexpr double roti_gflop_count(I nnz)
 {
-    return (6.0 * nnz) / 1e9;
+    return rocsparse_rot_flops(nnz) / 1e9;
 }
 
 /*
@@ -68,13 +70,13 @@ constexpr double roti_gflop_count(I nnz)
 template <typename I, typename J>
 constexpr double spmv_gflop_count(J M, I nnz, bool beta = false)
 {
-    return (2.0 * nnz + (beta ? M : 0)) / 1e9;
+    return rocsparse_spmv_flops(M, nnz, beta) / 1e9;
 }
 
 template <typename I, typename J>
 constexpr double csrsv_gflop_count(J M, I nnz, rocsparse_diag_type diag)
 {
-    return (2.0 * nnz + M + (diag == rocsparse_diag_type_non_unit ? M : 0)) / 1e9;
+    return rocsparse_spsv_flops(M, nnz, diag == rocsparse_diag_type_non_unit) / 1e9;
 }
 
 template <typename I, typename J>
@@ -95,30 +97,29 @@ constexpr double gemvi_gflop_count(I M, I nnz)
  * ===========================================================================
  */
 constexpr double bsrmm_gflop_count(rocsparse_int N,
-                                   rocsparse_int nnzb,
-                                   rocsparse_int block_dim,
-                                   rocsparse_int nnz_C,
-                                   bool          beta = false)
+                                rocsparse_int nnzb,
+                                rocsparse_int block_dim,
+                                rocsparse_int nnz_C,
+                                bool          beta = false)
 {
-    return (2.0 * nnzb * block_dim * block_dim * N + (beta ? nnz_C : 0)) / 1e9;
+    return rocsparse_spmm_flops(N, double(nnzb) * block_dim * block_dim, nnz_C, beta) / 1e9;
 }
 
 constexpr double gebsrmm_gflop_count(rocsparse_int N,
-                                     rocsparse_int nnzb,
-                                     rocsparse_int row_block_dim,
-                                     rocsparse_int col_block_dim,
-                                     rocsparse_int nnz_C,
-                                     bool          beta = false)
+                                  rocsparse_int nnzb,
+                                  rocsparse_int row_block_dim,
+                                  rocsparse_int col_block_dim,
+                                  rocsparse_int nnz_C,
+                                  bool          beta = false)
 {
-    return (2.0 * nnzb * row_block_dim * col_block_dim * N + (beta ? nnz_C : 0)) / 1e9;
+    return rocsparse_spmm_flops(N, double(nnzb) * row_block_dim * col_block_dim, nnz_C, beta)
+           / 1e9;
 }
 
 template <typename I, typename J>
 constexpr double csrmm_gflop_count(J N, I nnz_A, I nnz_C, bool beta = false)
 {
-    // Multiplication by 2 comes from 1 addition and 1 multiplication in product. Multiplication
-    // by alpha and beta not counted.
-    return (2.0 * nnz_A * N + (beta ? nnz_C : 0)) / 1e9;
+    return rocsparse_spmm_flops(N, nnz_A, nnz_C, beta) / 1e9;
 }
 
 template <typename I, typename J>
@@ -140,8 +141,7 @@ struct rocsparse_gflop_count<rocsparse_format_coo>
     template <typename I, typename J>
     static constexpr double sddmm(J M, J N, I nnz, J K, bool beta = false)
     {
-        size_t innz = (size_t)nnz;
-        return (innz * ((size_t(K) + (size_t(K) - 1)) + 1 + ((beta) ? 2 : 0))) / 1e9;
+        return rocsparse_sddmm_flops(nnz, K, beta) / 1e9;
     }
 };
 
@@ -33,6 +33,8 @@
 
 #include <rocsparse.h>
 
+#include "profile_models.h"
+
 /*
  * ===========================================================================
  *    level 1 SPARSE
@@ -41,19 +43,19 @@
 template <typename T, typename I>
 constexpr double axpby_gbyte_count(I nnz)
 {
-    return (nnz * sizeof(I) + (3.0 * nnz) * sizeof(T)) / 1e9;
+    return rocsparse_axpby_bytes(nnz, sizeof(I), sizeof(T), sizeof(T)) / 1e9;
 }
 
 template <typename X, typename Y, typename I>
 constexpr double doti_gbyte_count(I nnz)
 {
-    return (nnz * sizeof(I) + nnz * (sizeof(X) + sizeof(Y))) / 1e9;
+    return rocsparse_spvv_bytes(nnz, sizeof(I), sizeof(X), sizeof(Y)) / 1e9;
 }
 
 template <typename T, typename I>
 constexpr double gthr_gbyte_count(I nnz)
 {
-    return (nnz * sizeof(I) + (2.0 * nnz) * sizeof(T)) / 1e9;
+    return rocsparse_gather_bytes(nnz, sizeof(I), sizeof(T), sizeof(T)) / 1e9;
 }
 
 template <typename T>
@@ -65,13 +67,13 @@ constexpr double gthrz_gbyte_count(rocsparse_int nnz)
 template <typename T, typename I>
 constexpr double roti_gbyte_count(I nnz)
 {
-    return (nnz * sizeof(I) + (3.0 * nnz) * sizeof(T)) / 1e9;
+    return rocsparse_rot_bytes(nnz, sizeof(I), sizeof(T), sizeof(T)) / 1e9;
 }
 
 template <typename T, typename I>
 constexpr double sctr_gbyte_count(I nnz)
 {
-    return (nnz * sizeof(I) + (2.0 * nnz) * sizeof(T)) / 1e9;
+    return rocsparse_scatter_bytes(nnz, sizeof(I), sizeof(T), sizeof(T)) / 1e9;
 }
 
 /*
@@ -82,9 +84,11 @@ constexpr double sctr_gbyte_count(I nnz)
 template <typename A, typename X, typename Y, typename I, typename J>
 constexpr double bsrmv_gbyte_count(J mb, J nb, I nnzb, J block_dim, bool beta = false)
 {
-    return (sizeof(I) * (mb + 1) + sizeof(J) * nnzb + sizeof(A) * nnzb * block_dim * block_dim
-            + sizeof(Y) * (mb * block_dim + (beta ? mb * block_dim : 0))
-            + sizeof(X) * (nb * block_dim))
+    return rocsparse_spmv_bytes(sizeof(I) * (mb + 1.0) + sizeof(J) * double(nnzb),
+                                sizeof(A) * double(nnzb) * block_dim * block_dim,
+                                sizeof(X) * double(nb) * block_dim,
+                                sizeof(Y) * double(mb) * block_dim,
+                                beta)
            / 1e9;
 }
 
@@ -97,8 +101,11 @@ constexpr double bsrmv_gbyte_count(J mb, J nb, I nnzb, J block_dim, bool beta =
 template <typename A, typename X, typename Y, typename I>
 constexpr double coomv_gbyte_count(I M, I N, int64_t nnz, bool beta = false)
 {
-    return (sizeof(I) * 2.0 * nnz + sizeof(A) * nnz + sizeof(Y) * (M + (beta ? M : 0))
-            + sizeof(X) * N)
+    return rocsparse_spmv_bytes(sizeof(I) * 2.0 * nnz,
+                                sizeof(A) * double(nnz),
+                                sizeof(X) * double(N),
+                                sizeof(Y) * double(M),
+                                beta)
            / 1e9;
 }
 
@@ -111,8 +118,11 @@ constexpr double coomv_gbyte_count(I M, I N, int64_t nnz, bool beta = false)
 template <typename A, typename X, typename Y, typename I, typename J>
 constexpr double csrmv_gbyte_count(J M, J N, I nnz, bool beta = false)
 {
-    return (sizeof(I) * (M + 1) + sizeof(J) * nnz + sizeof(A) * nnz
-            + sizeof(Y) * (M + (beta ? M : 0)) + sizeof(X) * N)
+    return rocsparse_spmv_bytes(sizeof(I) * (M + 1.0) + sizeof(J) * double(nnz),
+                                sizeof(A) * double(nnz),
+                                sizeof(X) * double(N),
+                                sizeof(Y) * double(M),
+                                beta)
            / 1e9;
 }
 
@@ -125,8 +135,11 @@ constexpr double csrmv_gbyte_count(J M, J N, I nnz, bool beta = false)
 template <typename A, typename X, typename Y, typename I, typename J>
 constexpr double cscmv_gbyte_count(J M, J N, I nnz, bool beta = false)
 {
-    return (sizeof(I) * (N + 1) + sizeof(J) * nnz + sizeof(A) * nnz
-            + sizeof(Y) * (M + (beta ? M : 0)) + sizeof(X) * N)
+    return rocsparse_spmv_bytes(sizeof(I) * (N + 1.0) + sizeof(J) * double(nnz),
+                                sizeof(A) * double(nnz),
+                                sizeof(X) * double(N),
+                                sizeof(Y) * double(M),
+                                beta)
            / 1e9;
 }
 
@@ -139,7 +152,11 @@ constexpr double cscmv_gbyte_count(J M, J N, I nnz, bool beta = false)
 template <typename A, typename X, typename Y, typename I>
 constexpr double ellmv_gbyte_count(I M, I N, int64_t nnz, bool beta = false)
 {
-    return (sizeof(I) * nnz + sizeof(A) * nnz + sizeof(Y) * (M + (beta ? M : 0)) + sizeof(X) * N)
+    return rocsparse_spmv_bytes(sizeof(I) * double(nnz),
+                                sizeof(A) * double(nnz),
+                                sizeof(X) * double(N),
+                                sizeof(Y) * double(M),
+                                beta)
            / 1e9;
 }
 
@@ -150,13 +167,14 @@ constexpr double ellmv_gbyte_count(I M, I N, int64_t nnz, bool beta = false)
 }
 
 template <typename A, typename X, typename Y, typename I, typename J>
-constexpr double
+inline double
     gebsrmv_gbyte_count(J mb, J nb, I nnzb, J row_block_dim, J col_block_dim, bool beta = false)
 {
-    return (sizeof(I) * (mb + 1) + sizeof(J) * nnzb
-            + sizeof(A) * nnzb * row_block_dim * col_block_dim
-            + sizeof(Y) * (mb * row_block_dim + (beta ? mb * row_block_dim : 0))
-            + sizeof(X) * (nb * col_block_dim))
+    return rocsparse_spmv_bytes(sizeof(I) * (mb + 1.0) + sizeof(J) * double(nnzb),
+                                sizeof(A) * double(nnzb) * row_block_dim * col_block_dim,
+                                sizeof(X) * double(nb) * col_block_dim,
+                                sizeof(Y) * double(mb) * row_block_dim,
+                                beta)
            / 1e9;
 }
 
@@ -178,13 +196,21 @@ constexpr double bsrsv_gbyte_count(rocsparse_int mb, rocsparse_int nnzb, rocspar
 template <typename T, typename I, typename J>
 constexpr double csrsv_gbyte_count(J M, I nnz)
 {
-    return ((M + 1) * sizeof(I) + nnz * sizeof(J) + (M + M + nnz) * sizeof(T)) / 1e9;
+    return rocsparse_spsv_bytes((M + 1.0) * sizeof(I) + double(nnz) * sizeof(J),
+                                double(nnz) * sizeof(T),
+                                double(M) * sizeof(T),
+                                double(M) * sizeof(T))
+           / 1e9;
 }
 
 template <typename T, typename I>
 constexpr double coosv_gbyte_count(I M, int64_t nnz)
 {
-    return (2 * nnz * sizeof(I) + (M + M + nnz) * sizeof(T)) / 1e9;
+    return rocsparse_spsv_bytes(2.0 * nnz * sizeof(I),
+                                double(nnz) * sizeof(T),
+                                double(M) * sizeof(T),
+                                double(M) * sizeof(T))
+           / 1e9;
 }
 
 template <typename T, typename I>
@@ -200,73 +226,59 @@ constexpr double gemvi_gbyte_count(I m, I nnz, bool beta = false)
  */
 template <typename T>
 constexpr double bsrmm_gbyte_count(rocsparse_int Mb,
-                                   rocsparse_int nnzb,
-                                   rocsparse_int block_dim,
-                                   rocsparse_int nnz_B,
-                                   rocsparse_int nnz_C,
-                                   bool          beta = false)
-{
-    //reads
-    size_t reads = (Mb + 1 + nnzb) * sizeof(rocsparse_int)
-                   + (block_dim * block_dim * nnzb + nnz_B + (beta ? nnz_C : 0)) * sizeof(T);
-
-    //writes
-    size_t writes = nnz_C * sizeof(T);
-
-    return (reads + writes) / 1e9;
+                                rocsparse_int nnzb,
+                                rocsparse_int block_dim,
+                                rocsparse_int nnz_B,
+                                rocsparse_int nnz_C,
+                                bool          beta = false)
+{
+    return rocsparse_spmm_bytes((Mb + 1.0 + nnzb) * sizeof(rocsparse_int),
+                                double(nnzb) * block_dim * block_dim * sizeof(T),
+                                double(nnz_B) * sizeof(T),
+                                double(nnz_C) * sizeof(T),
+                                beta)
+           / 1e9;
 }
 
 template <typename T>
 constexpr double gebsrmm_gbyte_count(rocsparse_int Mb,
-                                     rocsparse_int nnzb,
-                                     rocsparse_int row_block_dim,
-                                     rocsparse_int col_block_dim,
-                                     rocsparse_int nnz_B,
-                                     rocsparse_int nnz_C,
-                                     bool          beta = false)
-{
-    //reads
-    size_t reads
-        = (Mb + 1 + nnzb) * sizeof(rocsparse_int)
-          + (row_block_dim * col_block_dim * nnzb + nnz_B + (beta ? nnz_C : 0)) * sizeof(T);
-
-    //writes
-    size_t writes = nnz_C * sizeof(T);
-
-    return (reads + writes) / 1e9;
+                                  rocsparse_int nnzb,
+                                  rocsparse_int row_block_dim,
+                                  rocsparse_int col_block_dim,
+                                  rocsparse_int nnz_B,
+                                  rocsparse_int nnz_C,
+                                  bool          beta = false)
+{
+    return rocsparse_spmm_bytes((Mb + 1.0 + nnzb) * sizeof(rocsparse_int),
+                                double(nnzb) * row_block_dim * col_block_dim * sizeof(T),
+                                double(nnz_B) * sizeof(T),
+                                double(nnz_C) * sizeof(T),
+                                beta)
+           / 1e9;
 }
 
 template <typename T, typename I, typename J>
-constexpr double csrmm_gbyte_count(J M, I nnz_A, I nnz_B, I nnz_C, bool beta = false)
-{
-    return ((M + 1) * sizeof(I) + nnz_A * sizeof(J)
-            + (nnz_A + nnz_B + nnz_C + (beta ? nnz_C : 0)) * sizeof(T))
+constexpr double csrmm_batched_gbyte_count(J    M,
+                                        I    nnz_A,
+                                        I    nnz_B,
+                                        I    nnz_C,
+                                        J    batch_count_A,
+                                        J    batch_count_B,
+                                        J    batch_count_C,
+                                        bool beta = false)
+{
+    return rocsparse_spmm_bytes(double(batch_count_A) * ((M + 1.0) * sizeof(I) + nnz_A * sizeof(J)),
+                                double(batch_count_A) * nnz_A * sizeof(T),
+                                double(batch_count_B) * nnz_B * sizeof(T),
+                                double(batch_count_C) * nnz_C * sizeof(T),
+                                beta)
            / 1e9;
 }
 
 template <typename T, typename I, typename J>
-constexpr double csrmm_batched_gbyte_count(J    M,
-                                           I    nnz_A,
-                                           I    nnz_B,
-                                           I    nnz_C,
-                                           J    batch_count_A,
-                                           J    batch_count_B,
-                                           J    batch_count_C,
-                                           bool beta = false)
+constexpr double csrmm_gbyte_count(J M, I nnz_A, I nnz_B, I nnz_C, bool beta = false)
 {
-    // read A matrix
-    size_t readA = batch_count_A * ((M + 1) * sizeof(I) + nnz_A * sizeof(J) + nnz_A * sizeof(T));
-
-    // read B matrix
-    size_t readB = batch_count_B * nnz_B * sizeof(T);
-
-    // read C matrix
-    size_t readC = batch_count_C * (beta ? nnz_C : 0) * sizeof(T);
-
-    // write C matrix
-    size_t writeC = batch_count_C * nnz_C * sizeof(T);
-
-    return (readA + readB + readC + writeC) / 1e9;
+    return csrmm_batched_gbyte_count<T, I, J>(M, nnz_A, nnz_B, nnz_C, 1, 1, 1, beta);
 }
 
 template <typename T, typename I, typename J>
@@ -277,59 +289,40 @@ constexpr double cscmm_gbyte_count(J N, I nnz_A, I nnz_B, I nnz_C, bool beta = f
 
 template <typename T, typename I, typename J>
 constexpr double cscmm_batched_gbyte_count(J    N,
-                                           I    nnz_A,
-                                           I    nnz_B,
-                                           I    nnz_C,
-                                           J    batch_count_A,
-                                           J    batch_count_B,
-                                           J    batch_count_C,
-                                           bool beta = false)
+                                        I    nnz_A,
+                                        I    nnz_B,
+                                        I    nnz_C,
+                                        J    batch_count_A,
+                                        J    batch_count_B,
+                                        J    batch_count_C,
+                                        bool beta = false)
 {
-    // read A matrix
-    size_t readA = batch_count_A * ((N + 1) * sizeof(I) + nnz_A * sizeof(J) + nnz_A * sizeof(T));
-
-    // read B matrix
-    size_t readB = batch_count_B * nnz_B * sizeof(T);
-
-    // read C matrix
-    size_t readC = batch_count_C * (beta ? nnz_C : 0) * sizeof(T);
-
-    // write C matrix
-    size_t writeC = batch_count_C * nnz_C * sizeof(T);
-
-    return (readA + readB + readC + writeC) / 1e9;
+    return csrmm_batched_gbyte_count<T, I, J>(
+        N, nnz_A, nnz_B, nnz_C, batch_count_A, batch_count_B, batch_count_C, beta);
 }
 
 template <typename T, typename I>
-constexpr double coomm_gbyte_count(int64_t nnz_A, int64_t nnz_B, int64_t nnz_C, bool beta = false)
-{
-    return (2.0 * nnz_A * sizeof(I) + (nnz_A + nnz_B + nnz_C + (beta ? nnz_C : 0)) * sizeof(T))
+constexpr double coomm_batched_gbyte_count(I       M,
+                                        int64_t nnz_A,
+                                        int64_t nnz_B,
+                                        int64_t nnz_C,
+                                        I       batch_count_A,
+                                        I       batch_count_B,
+                                        I       batch_count_C,
+                                        bool    beta = false)
+{
+    return rocsparse_spmm_bytes(double(batch_count_A) * 2.0 * nnz_A * sizeof(I),
+                                double(batch_count_A) * nnz_A * sizeof(T),
+                                double(batch_count_B) * nnz_B * sizeof(T),
+                                double(batch_count_C) * nnz_C * sizeof(T),
+                                beta)
            / 1e9;
 }
 
 template <typename T, typename I>
-constexpr double coomm_batched_gbyte_count(I       M,
-                                           int64_t nnz_A,
-                                           int64_t nnz_B,
-                                           int64_t nnz_C,
-                                           I       batch_count_A,
-                                           I       batch_count_B,
-                                           I       batch_count_C,
-                                           bool    beta = false)
+constexpr double coomm_gbyte_count(int64_t nnz_A, int64_t nnz_B, int64_t nnz_C, bool beta = false)
 {
-    // read A matrix
-    size_t readA = batch_count_A * (nnz_A * sizeof(I) + nnz_A * sizeof(I) + nnz_A * sizeof(T));
-
-    // read B matrix
-    size_t readB = batch_count_B * nnz_B * sizeof(T);
-
-    // read C matrix
-    size_t readC = batch_count_C * (beta ? nnz_C : 0) * sizeof(T);
-
-    // write C matrix
-    size_t writeC = batch_count_C * nnz_C * sizeof(T);
-
-    return (readA + readB + readC + writeC) / 1e9;
+    return coomm_batched_gbyte_count<T, I>(0, nnz_A, nnz_B, nnz_C, 1, 1, 1, beta);
 }
 
 template <rocsparse_format FORMAT>
@@ -345,9 +338,8 @@ struct rocsparse_gbyte_count<rocsparse_format_csr>
     template <typename T, typename I, typename J>
     static constexpr double sddmm(J M, J N, I nnz, J K, bool beta = false)
     {
-        size_t l = ((size_t)nnz);
-        return ((size_t(M) + 1) * sizeof(I) + l * sizeof(J)
-                + (l * (K * 2 + ((beta) ? 1 : 0)) * sizeof(T)))
+        return rocsparse_sddmm_bytes(
+                   (M + 1.0) * sizeof(I) + double(nnz) * sizeof(J), nnz, K, sizeof(T), beta)
                / 1e9;
     }
 };
@@ -358,9 +350,8 @@ struct rocsparse_gbyte_count<rocsparse_format_csc>
     template <typename T, typename I, typename J>
     static constexpr double sddmm(J M, J N, I nnz, J K, bool beta = false)
     {
-        size_t l = ((size_t)nnz);
-        return ((size_t(N) + 1) * sizeof(I) + l * sizeof(J)
-                + (l * (K * 2 + ((beta) ? 1 : 0)) * sizeof(T)))
+        return rocsparse_sddmm_bytes(
+                   (N + 1.0) * sizeof(I) + double(nnz) * sizeof(J), nnz, K, sizeof(T), beta)
                / 1e9;
     }
 };
@@ -371,8 +362,7 @@ struct rocsparse_gbyte_count<rocsparse_format_coo>
     template <typename T, typename I, typename J>
     static constexpr double sddmm(J M, J N, I nnz, J K, bool beta = false)
     {
-        size_t l = ((size_t)nnz);
-        return (l * 2 * sizeof(I) + l * (K * 2 + ((beta) ? 1 : 0)) * sizeof(T)) / 1e9;
+        return rocsparse_sddmm_bytes(2.0 * nnz * sizeof(I), nnz, K, sizeof(T), beta) / 1e9;
     }
 };
 
@@ -382,8 +372,7 @@ struct rocsparse_gbyte_count<rocsparse_format_coo_aos>
     template <typename T, typename I, typename J>
     static constexpr double sddmm(J M, J N, I nnz, J K, bool beta = false)
     {
-        size_t l = ((size_t)nnz);
-        return (l * 2 * sizeof(I) + (l * (K * 2 + ((beta) ? 1 : 0)) * sizeof(T))) / 1e9;
+        return rocsparse_gbyte_count<rocsparse_format_coo>::sddmm<T>(M, N, nnz, K, beta);
     }
 };
 
@@ -393,9 +382,7 @@ struct rocsparse_gbyte_count<rocsparse_format_ell>
     template <typename T, typename I, typename J>
     static constexpr double sddmm(J M, J N, I nnz, J K, bool beta = false)
     {
-        size_t l = ((size_t)nnz);
-        return (l * sizeof(J) + (l * (K * 2 + ((beta) ? 1 : 0)) * sizeof(T)))
-               / static_cast<size_t>(1e9);
+        return rocsparse_sddmm_bytes(double(nnz) * sizeof(J), nnz, K, sizeof(T), beta) / 1e9;
     }
 };
 
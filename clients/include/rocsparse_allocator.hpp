@@ -26,6 +26,7 @@
 #ifndef ROCSPARSE_ALLOCATOR_HPP
 #define ROCSPARSE_ALLOCATOR_HPP
 
+#include "rocsparse_host_memory.hpp"
 #include "rocsparse_random.hpp"
 #include <hip/hip_runtime_api.h>
 #ifdef GOOGLE_TEST
@@ -278,6 +279,15 @@ public:
         {
         case memory_mode::host:
         {
+            //
+            // Huge pages or file-backed memory, see ROCSPARSE_CLIENTS_HOST_MEMORY.
+            //
+            d = static_cast<T*>(rocsparse_host_memory_allocate(nbytes));
+            if(d != nullptr)
+            {
+                break;
+            }
+
             if(rocsparse_hipHostMalloc(&d, nbytes) != hipSuccess)
             {
                 fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", nbytes, nbytes >> 30);
@@ -366,6 +376,11 @@ public:
             {
             case memory_mode::host:
             {
+                if(rocsparse_host_memory_free(d))
+                {
+                    break;
+                }
+
                 auto status = rocsparse_hipHostFree(d);
                 if(status != hipSuccess)
                 {
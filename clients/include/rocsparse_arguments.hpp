@@ -55,11 +55,19 @@ struct Arguments
     rocsparse_int dimy;
     rocsparse_int dimz;
 
+    rocsparse_int stencil;
+    rocsparse_int dof;
+    rocsparse_int permute;
+
     rocsparse_int ll;
     rocsparse_int l;
     rocsparse_int u;
     rocsparse_int uu;
 
+    double        skew;
+    rocsparse_int avg_degree;
+    rocsparse_int symmetrize;
+
     rocsparse_indextype index_type_I;
     rocsparse_indextype index_type_J;
 
@@ -187,10 +195,16 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(dimx);
         ROCSPARSE_FORMAT_CHECK(dimy);
         ROCSPARSE_FORMAT_CHECK(dimz);
+        ROCSPARSE_FORMAT_CHECK(stencil);
+        ROCSPARSE_FORMAT_CHECK(dof);
+        ROCSPARSE_FORMAT_CHECK(permute);
         ROCSPARSE_FORMAT_CHECK(ll);
         ROCSPARSE_FORMAT_CHECK(l);
         ROCSPARSE_FORMAT_CHECK(u);
         ROCSPARSE_FORMAT_CHECK(uu);
+        ROCSPARSE_FORMAT_CHECK(skew);
+        ROCSPARSE_FORMAT_CHECK(avg_degree);
+        ROCSPARSE_FORMAT_CHECK(symmetrize);
         ROCSPARSE_FORMAT_CHECK(index_type_I);
         ROCSPARSE_FORMAT_CHECK(index_type_J);
         ROCSPARSE_FORMAT_CHECK(a_type);
@@ -407,10 +421,16 @@ private:
         print("dim_x", arg.dimx);
         print("dim_y", arg.dimy);
         print("dim_z", arg.dimz);
+        print("stencil", arg.stencil);
+        print("dof", arg.dof);
+        print("permute", arg.permute);
         print("ll", arg.ll);
         print("l", arg.l);
         print("u", arg.u);
         print("uu", arg.uu);
+        print("skew", arg.skew);
+        print("avg_degree", arg.avg_degree);
+        print("symmetrize", arg.symmetrize);
         print("alpha", arg.alpha);
         print("alphai", arg.alphai);
         print("beta", arg.beta);
@@ -479,7 +499,8 @@ inline bool rocsparse_arguments_has_datafile(const Arguments& arg)
 {
     return (arg.matrix == rocsparse_matrix_file_rocalution)
            || (arg.matrix == rocsparse_matrix_file_mtx)
-           || (arg.matrix == rocsparse_matrix_file_rocsparseio);
+           || (arg.matrix == rocsparse_matrix_file_rocsparseio)
+           || (arg.matrix == rocsparse_matrix_file_chunked);
 }
 
 #endif // ROCSPARSE_ARGUMENTS_HPP
@@ -0,0 +1,376 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCSPARSE_CAPTURE_READER_HPP
+#define ROCSPARSE_CAPTURE_READER_HPP
+
+#include <rocsparse.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef ROCSPARSEIO
+#include <rocsparseio.h>
+#endif
+
+//
+// Reader of the directories written with ROCSPARSE_LAYER including
+// rocsparse_layer_mode_capture, the format is the one of
+// library/src/include/capture.h.
+//
+struct rocsparse_capture_reader
+{
+    struct operand_t
+    {
+        std::string                        kind;
+        std::string                        id;
+        std::map<std::string, std::string> keys;
+
+        // Value of an integer key, 0 if it is missing
+        int64_t get(const char* key) const
+        {
+            auto it = this->keys.find(key);
+            return (it != this->keys.end()) ? std::strtoll(it->second.c_str(), nullptr, 10) : 0;
+        }
+
+        // Whether the values of the operand are written
+        bool data() const
+        {
+            return this->get("data") != 0;
+        }
+    };
+
+    struct call_t
+    {
+        std::string              routine;
+        std::vector<std::string> args;
+    };
+
+    std::string                      path;
+    std::map<std::string, operand_t> operands;
+    std::vector<call_t>              calls;
+
+    static size_t sizeof_datatype(rocsparse_datatype type)
+    {
+        switch(type)
+        {
+        case rocsparse_datatype_i8_r:
+        case rocsparse_datatype_u8_r:
+            return 1;
+        case rocsparse_datatype_f32_r:
+        case rocsparse_datatype_i32_r:
+        case rocsparse_datatype_u32_r:
+            return 4;
+        case rocsparse_datatype_f64_r:
+        case rocsparse_datatype_f32_c:
+            return 8;
+        case rocsparse_datatype_f64_c:
+            return 16;
+        }
+        return 0;
+    }
+
+    static size_t sizeof_indextype(rocsparse_indextype type)
+    {
+        switch(type)
+        {
+        case rocsparse_indextype_u16:
+            return 2;
+        case rocsparse_indextype_i32:
+            return 4;
+        case rocsparse_indextype_i64:
+            return 8;
+        }
+        return 0;
+    }
+
+    //
+    // Read the operand definitions and the calls of a capture directory.
+    //
+    bool read(const std::string& directory)
+    {
+        const std::string filename = directory + "/calls.txt";
+        std::ifstream     in(filename);
+        if(!in.is_open())
+        {
+            std::cerr << "cannot open '" << filename << "'" << std::endl;
+            return false;
+        }
+
+        this->path = directory;
+
+        std::string line;
+        while(std::getline(in, line))
+        {
+            std::istringstream tokens(line);
+            std::string        kind;
+            std::string        token;
+            if(!(tokens >> kind))
+            {
+                continue;
+            }
+
+            if(kind == "call")
+            {
+                call_t call;
+                tokens >> call.routine;
+                while(tokens >> token)
+                {
+                    call.args.push_back(token);
+                }
+                this->calls.push_back(call);
+                continue;
+            }
+
+            operand_t operand;
+            operand.kind = kind;
+            tokens >> operand.id;
+            while(tokens >> token)
+            {
+                const size_t eq = token.find('=');
+                if(eq != std::string::npos)
+                {
+                    operand.keys[token.substr(0, eq)] = token.substr(eq + 1);
+                }
+            }
+            this->operands[kind + ":" + operand.id] = operand;
+        }
+
+        return true;
+    }
+
+    //
+    // Operand an argument refers to, nullptr if the argument is not an
+    // operand.
+    //
+    const operand_t* operand(const std::string& arg) const
+    {
+        auto it = this->operands.find(arg);
+        return (it != this->operands.end()) ? &it->second : nullptr;
+    }
+
+    //
+    // Bytes of a scalar argument, false if the value of the scalar is not
+    // known.
+    //
+    static bool scalar(const std::string& arg, unsigned char bytes[16])
+    {
+        std::memset(bytes, 0, 16);
+
+        const std::string prefix = "scalar:";
+        if(arg.compare(0, prefix.size(), prefix) != 0 || arg == "scalar:unknown")
+        {
+            return false;
+        }
+
+        const std::string hex = arg.substr(prefix.size());
+        for(size_t i = 0; i + 1 < hex.size() && i / 2 < 16; i += 2)
+        {
+            bytes[i / 2]
+                = static_cast<unsigned char>(std::strtoul(hex.substr(i, 2).c_str(), nullptr, 16));
+        }
+        return true;
+    }
+
+    std::string filename(const operand_t& operand, int64_t batch) const
+    {
+        return this->path + "/" + operand.id + "_" + std::to_string(batch) + ".bin";
+    }
+
+#ifdef ROCSPARSEIO
+    //
+    // Read the values of the batch of an operand, as written with rocsparseio:
+    // - CSR and CSC matrices: the offsets, the indices and the values.
+    // - BSR matrices: the block offsets, the block indices and the values.
+    // - COO, COO AoS and ELL matrices: the rows, the columns and the values of
+    //   the COO matrix they are written as.
+    // - sparse vectors: the indices and the values.
+    // - dense vectors and matrices: the values, with the leading dimension of
+    //   the operand.
+    //
+    bool read_values(const operand_t&                operand,
+                     int64_t                         batch,
+                     std::vector<std::vector<char>>& arrays) const
+    {
+        arrays.clear();
+        if(!operand.data())
+        {
+            return false;
+        }
+
+        const std::string  filename = this->filename(operand, batch);
+        rocsparseio_handle handle;
+        if(rocsparseio_open(&handle, rocsparseio_rwmode_read, filename.c_str())
+           != rocsparseio_status_success)
+        {
+            std::cerr << "cannot open '" << filename << "'" << std::endl;
+            return false;
+        }
+
+        const rocsparseio_status status = read_values(handle, operand, arrays);
+        rocsparseio_close(handle);
+
+        if(status != rocsparseio_status_success)
+        {
+            std::cerr << "cannot read '" << filename << "'" << std::endl;
+            arrays.clear();
+            return false;
+        }
+        return true;
+    }
+
+private:
+    static size_t sizeof_type(rocsparseio_type type)
+    {
+        size_t size = 0;
+        return (rocsparseio_type_get_size(type, &size) == rocsparseio_status_success) ? size : 0;
+    }
+
+    static rocsparseio_status read_values(rocsparseio_handle              handle,
+                                          const operand_t&                operand,
+                                          std::vector<std::vector<char>>& arrays)
+    {
+        rocsparseio_direction  dir;
+        rocsparseio_direction  block_dir;
+        rocsparseio_index_base base;
+        rocsparseio_type       ptr_type;
+        rocsparseio_type       ind_type;
+        rocsparseio_type       val_type;
+        rocsparseio_order      order;
+        size_t                 m;
+        size_t                 n;
+        size_t                 nnz;
+        size_t                 row_block_dim;
+        size_t                 col_block_dim;
+        rocsparseio_status     status;
+
+        const rocsparse_format format = rocsparse_format(operand.get("format"));
+        if(operand.kind == "spmat"
+           && (format == rocsparse_format_csr || format == rocsparse_format_csc))
+        {
+            status = rocsparseiox_read_metadata_sparse_csx(
+                handle, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &val_type, &base);
+            if(status != rocsparseio_status_success)
+            {
+                return status;
+            }
+
+            const size_t nptr = ((dir == rocsparseio_direction_row) ? m : n) + 1;
+            arrays.emplace_back(nptr * sizeof_type(ptr_type));
+            arrays.emplace_back(nnz * sizeof_type(ind_type));
+            arrays.emplace_back(nnz * sizeof_type(val_type));
+            return rocsparseiox_read_sparse_csx(
+                handle, arrays[0].data(), arrays[1].data(), arrays[2].data());
+        }
+        else if(operand.kind == "spmat" && format == rocsparse_format_bsr)
+        {
+            status = rocsparseiox_read_metadata_sparse_gebsx(handle,
+                                                             &dir,
+                                                             &block_dir,
+                                                             &m,
+                                                             &n,
+                                                             &nnz,
+                                                             &row_block_dim,
+                                                             &col_block_dim,
+                                                             &ptr_type,
+                                                             &ind_type,
+                                                             &val_type,
+                                                             &base);
+            if(status != rocsparseio_status_success)
+            {
+                return status;
+            }
+
+            const size_t block_size = row_block_dim * col_block_dim;
+            const size_t nptr       = ((dir == rocsparseio_direction_row) ? m : n) + 1;
+            arrays.emplace_back(nptr * sizeof_type(ptr_type));
+            arrays.emplace_back(nnz * sizeof_type(ind_type));
+            arrays.emplace_back(nnz * block_size * sizeof_type(val_type));
+            return rocsparseiox_read_sparse_gebsx(
+                handle, arrays[0].data(), arrays[1].data(), arrays[2].data());
+        }
+        else if(operand.kind == "spmat" || operand.kind == "spvec")
+        {
+            status = rocsparseiox_read_metadata_sparse_coo(
+                handle, &m, &n, &nnz, &ptr_type, &ind_type, &val_type, &base);
+            if(status != rocsparseio_status_success)
+            {
+                return status;
+            }
+
+            arrays.emplace_back(nnz * sizeof_type(ptr_type));
+            arrays.emplace_back(nnz * sizeof_type(ind_type));
+            arrays.emplace_back(nnz * sizeof_type(val_type));
+            status = rocsparseiox_read_sparse_coo(
+                handle, arrays[0].data(), arrays[1].data(), arrays[2].data());
+
+            // A sparse vector is written as a matrix of one row
+            if(operand.kind == "spvec")
+            {
+                arrays.erase(arrays.begin());
+            }
+            return status;
+        }
+        else if(operand.kind == "dnvec")
+        {
+            status = rocsparseiox_read_metadata_dense_vector(handle, &val_type, &m);
+            if(status != rocsparseio_status_success)
+            {
+                return status;
+            }
+
+            arrays.emplace_back(m * sizeof_type(val_type));
+            return rocsparseiox_read_dense_vector(handle, arrays[0].data(), 1);
+        }
+        else if(operand.kind == "dnmat")
+        {
+            status = rocsparseiox_read_metadata_dense_matrix(handle, &order, &m, &n, &val_type);
+            if(status != rocsparseio_status_success)
+            {
+                return status;
+            }
+
+            // Entries up to the last one of the last column, or row
+            const bool   column = (order == rocsparseio_order_column);
+            const size_t ld     = operand.get("ld");
+            const size_t inner  = column ? m : n;
+            const size_t outer  = column ? n : m;
+            const size_t count  = (inner > 0 && outer > 0) ? ld * (outer - 1) + inner : 0;
+
+            arrays.emplace_back(count * sizeof_type(val_type));
+            return rocsparseiox_read_dense_matrix(handle, arrays[0].data(), ld);
+        }
+
+        return rocsparseio_status_invalid_value;
+    }
+#endif
+};
+
+#endif // ROCSPARSE_CAPTURE_READER_HPP
@@ -72,10 +72,15 @@ struct rocsparse_clients_envariables
     ///
     typedef enum var_string_ : int32_t
     {
-        MATRICES_DIR
+        MATRICES_DIR,
+        ROOFLINE_CACHE,
+        MATRIX_CACHE_SIZE,
+        CHUNKED_CODEC,
+        HOST_MEMORY
     } var_string;
 
-    static constexpr var_string s_var_string_all[] = {MATRICES_DIR};
+    static constexpr var_string s_var_string_all[]
+        = {MATRICES_DIR, ROOFLINE_CACHE, MATRIX_CACHE_SIZE, CHUNKED_CODEC, HOST_MEMORY};
 
     ///
     /// @brief Return value of a string variable.
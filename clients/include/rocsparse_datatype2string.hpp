@@ -59,7 +59,11 @@ typedef enum rocsparse_matrix_init_
     rocsparse_matrix_zero             = 5, /**< Generates zero matrix */
     rocsparse_matrix_file_rocsparseio = 6, /**< Read from .bin (rocSPARSEIO) file */
     rocsparse_matrix_tridiagonal      = 7, /**< Initialize tridiagonal matrix */
-    rocsparse_matrix_pentadiagonal    = 8 /**< Initialize pentadiagonal matrix */
+    rocsparse_matrix_pentadiagonal    = 8, /**< Initialize pentadiagonal matrix */
+    rocsparse_matrix_rmat             = 9, /**< Initialize R-MAT graph matrix */
+    rocsparse_matrix_powerlaw         = 10, /**< Initialize power-law graph matrix */
+    rocsparse_matrix_stencil_3d       = 11, /**< Initialize 3D stencil matrix with dof per node */
+    rocsparse_matrix_file_chunked     = 12 /**< Read from .cbin (chunked) file */
 } rocsparse_matrix_init;
 
 constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
@@ -84,6 +88,14 @@ constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
         return "tri";
     case rocsparse_matrix_pentadiagonal:
         return "penta";
+    case rocsparse_matrix_rmat:
+        return "rmat";
+    case rocsparse_matrix_powerlaw:
+        return "plaw";
+    case rocsparse_matrix_stencil_3d:
+        return "S3D";
+    case rocsparse_matrix_file_chunked:
+        return "cbin";
     }
     return "invalid";
 }
@@ -33,7 +33,8 @@ struct rocsparse_exporter_format_t
     FORMAT(matrixmarket)      \
     FORMAT(rocalution)        \
     FORMAT(ascii)             \
-    FORMAT(rocsparseio)
+    FORMAT(rocsparseio)       \
+    FORMAT(chunked)
 
     typedef enum _
     {
@@ -63,6 +64,8 @@ public:
             return ".bin";
         case ascii:
             return ".txt";
+        case chunked:
+            return ".cbin";
         case unknown:
             return "";
         }
@@ -73,19 +76,36 @@ public:
     {
         this->value = unknown;
 
-        const char* ext = nullptr;
+        const char* ext  = nullptr;
+        const char* prev = nullptr;
         for(const char* p = filename; *p != '\0'; ++p)
         {
             if(*p == '.')
-                ext = p;
+            {
+                prev = ext;
+                ext  = p;
+            }
+        }
+
+        //
+        // Text formats can be compressed, e.g. '.mtx.gz' or '.txt.zst'.
+        //
+        size_t len = (ext != nullptr) ? strlen(ext) : 0;
+        if(prev != nullptr && (!strcmp(ext, ".gz") || !strcmp(ext, ".zst")))
+        {
+            len = ext - prev;
+            ext = prev;
         }
+
         if(ext)
         {
             for(auto format : all_formats)
             {
-                if(!strcmp(ext, extension(format)))
+                if(len == strlen(extension(format)) && !strncmp(ext, extension(format), len))
                 {
-                    this->value = format;
+                    this->value = (format == matrixmarket || format == ascii || ext[len] == '\0')
+                                      ? format
+                                      : unknown;
                     break;
                 }
             }
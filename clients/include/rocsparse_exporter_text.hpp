@@ -0,0 +1,256 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_EXPORTER_TEXT_HPP
+#define ROCSPARSE_EXPORTER_TEXT_HPP
+
+#include "rocsparse.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+// Shared machinery of the text exporters (ascii and matrix market).
+// Entries are formatted in parallel into per-chunk buffers, the buffers
+// are then written in order with large writes.
+//
+
+//
+// Number of entries formatted by a single chunk.
+//
+static constexpr int64_t rocsparse_exporter_text_chunk_size = 1 << 15;
+
+//
+// Output file, a filename ending with '.gz' or '.zst' is streamed through
+// gzip or zstd.
+//
+class rocsparse_exporter_text_stream
+{
+protected:
+    FILE*             m_file{};
+    bool              m_pipe{};
+    std::vector<char> m_buffer{};
+
+public:
+    ~rocsparse_exporter_text_stream()
+    {
+        this->close();
+    }
+
+    static const char* compressor(const std::string& filename)
+    {
+        auto ends_with = [&filename](const char* suffix) {
+            const size_t n = strlen(suffix);
+            return filename.size() > n && !filename.compare(filename.size() - n, n, suffix);
+        };
+        if(ends_with(".gz"))
+        {
+            return "gzip -c";
+        }
+        if(ends_with(".zst"))
+        {
+            return "zstd -q -c";
+        }
+        return nullptr;
+    }
+
+    rocsparse_status open(const std::string& filename)
+    {
+        const char* cmd = compressor(filename);
+        if(cmd != nullptr)
+        {
+            if(filename.find('\'') != std::string::npos)
+            {
+                std::cerr << "rocsparse_exporter_text_stream: invalid filename '" << filename
+                          << "'" << std::endl;
+                return rocsparse_status_invalid_value;
+            }
+            const std::string command = std::string(cmd) + " > '" + filename + "'";
+            this->m_file              = popen(command.c_str(), "w");
+            this->m_pipe              = true;
+        }
+        else
+        {
+            this->m_file = fopen(filename.c_str(), "w");
+            this->m_pipe = false;
+        }
+
+        if(this->m_file == nullptr)
+        {
+            std::cerr << "rocsparse_exporter_text_stream: cannot open file '" << filename << "'"
+                      << std::endl;
+            return rocsparse_status_internal_error;
+        }
+
+        this->m_buffer.resize(1 << 22);
+        setvbuf(this->m_file, this->m_buffer.data(), _IOFBF, this->m_buffer.size());
+        return rocsparse_status_success;
+    }
+
+    rocsparse_status write(const char* data, size_t size)
+    {
+        if(size > 0 && fwrite(data, 1, size, this->m_file) != size)
+        {
+            std::cerr << "rocsparse_exporter_text_stream: write failed" << std::endl;
+            return rocsparse_status_internal_error;
+        }
+        return rocsparse_status_success;
+    }
+
+    rocsparse_status write(const std::string& s)
+    {
+        return this->write(s.data(), s.size());
+    }
+
+    rocsparse_status close()
+    {
+        if(this->m_file == nullptr)
+        {
+            return rocsparse_status_success;
+        }
+        const int err = this->m_pipe ? pclose(this->m_file) : fclose(this->m_file);
+        this->m_file  = nullptr;
+        if(err != 0)
+        {
+            std::cerr << "rocsparse_exporter_text_stream: close failed" << std::endl;
+            return rocsparse_status_internal_error;
+        }
+        return rocsparse_status_success;
+    }
+};
+
+//
+// Append the decimal representation of an integer.
+//
+template <typename I>
+inline void rocsparse_exporter_text_append_integer(std::string& s, I x)
+{
+    char     tmp[24];
+    char*    p = tmp + sizeof(tmp);
+    uint64_t u = (x < 0) ? (~static_cast<uint64_t>(x) + 1) : static_cast<uint64_t>(x);
+    do
+    {
+        *--p = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while(u != 0);
+    if(x < 0)
+    {
+        *--p = '-';
+    }
+    s.append(p, tmp + sizeof(tmp) - p);
+}
+
+//
+// Write the shortest representation of a floating point number that reads
+// back to the same value, returns the number of characters written (at most
+// 32, no terminating null character).
+//
+int rocsparse_exporter_text_format_real(char* buffer, float x);
+int rocsparse_exporter_text_format_real(char* buffer, double x);
+
+template <typename T>
+inline void rocsparse_exporter_text_append_real(std::string& s, T x)
+{
+    char tmp[32];
+    s.append(tmp, rocsparse_exporter_text_format_real(tmp, x));
+}
+
+//
+// Append a scalar, complex numbers are written as a pair of real numbers.
+//
+inline void rocsparse_exporter_text_append_scalar(std::string& s, float x)
+{
+    rocsparse_exporter_text_append_real(s, x);
+}
+
+inline void rocsparse_exporter_text_append_scalar(std::string& s, double x)
+{
+    rocsparse_exporter_text_append_real(s, x);
+}
+
+inline void rocsparse_exporter_text_append_scalar(std::string& s, const rocsparse_float_complex& x)
+{
+    rocsparse_exporter_text_append_real(s, std::real(x));
+    s.push_back(' ');
+    rocsparse_exporter_text_append_real(s, std::imag(x));
+}
+
+inline void rocsparse_exporter_text_append_scalar(std::string& s, const rocsparse_double_complex& x)
+{
+    rocsparse_exporter_text_append_real(s, std::real(x));
+    s.push_back(' ');
+    rocsparse_exporter_text_append_real(s, std::imag(x));
+}
+
+//
+// Format n chunks in parallel with format(chunk, buffer) and write them
+// in order. Chunks are processed in batches to bound the memory footprint.
+//
+template <typename F>
+inline rocsparse_status
+    rocsparse_exporter_text_write_chunks(rocsparse_exporter_text_stream& out, int64_t n, F format)
+{
+    int64_t nthreads = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+    const int64_t            batch = std::min(n, 4 * nthreads);
+    std::vector<std::string> buffers(batch);
+    for(int64_t first = 0; first < n; first += batch)
+    {
+        const int64_t last = std::min(first + batch, n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t c = first; c < last; ++c)
+        {
+            std::string& buffer = buffers[c - first];
+            buffer.clear();
+            format(c, buffer);
+        }
+
+        for(int64_t c = first; c < last; ++c)
+        {
+            const rocsparse_status status = out.write(buffers[c - first]);
+            if(status != rocsparse_status_success)
+            {
+                return status;
+            }
+        }
+    }
+    return rocsparse_status_success;
+}
+
+#endif // HEADER
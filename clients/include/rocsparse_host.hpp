@@ -35,6 +35,9 @@
 #include <omp.h>
 #endif
 
+template <typename T>
+struct host_vector;
+
 template <typename T, typename I, typename J>
 struct rocsparse_host
 {
@@ -308,22 +311,62 @@ void host_csrsv(rocsparse_operation  trans,
                 J*                   struct_pivot,
                 J*                   numeric_pivot);
 
+template <typename I, typename J, typename T>
+void host_csrsv_batched(rocsparse_operation  trans,
+                        J                    M,
+                        I                    nnz,
+                        J                    batch_count,
+                        T                    alpha,
+                        const I*             csr_row_ptr,
+                        const J*             csr_col_ind,
+                        const T*             csr_val,
+                        int64_t              val_batch_stride,
+                        const T*             x,
+                        int64_t              x_batch_stride,
+                        T*                   y,
+                        int64_t              y_batch_stride,
+                        rocsparse_diag_type  diag_type,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_index_base base,
+                        J*                   struct_pivot,
+                        J*                   numeric_pivot);
+
 template <typename I, typename T>
 void host_coosv(rocsparse_operation   trans,
                 I                     M,
                 int64_t               nnz,
                 T                     alpha,
-                const std::vector<I>& coo_row_ind,
-                const std::vector<I>& coo_col_ind,
-                const std::vector<T>& coo_val,
-                const std::vector<T>& x,
-                std::vector<T>&       y,
+                const host_vector<I>& coo_row_ind,
+                const host_vector<I>& coo_col_ind,
+                const host_vector<T>& coo_val,
+                const host_vector<T>& x,
+                host_vector<T>&       y,
                 rocsparse_diag_type   diag_type,
                 rocsparse_fill_mode   fill_mode,
                 rocsparse_index_base  base,
                 I*                    struct_pivot,
                 I*                    numeric_pivot);
 
+template <typename I, typename T>
+void host_coosv_batched(rocsparse_operation  trans,
+                        I                    M,
+                        int64_t              nnz,
+                        I                    batch_count,
+                        T                    alpha,
+                        const I*             coo_row_ind,
+                        const I*             coo_col_ind,
+                        const T*             coo_val,
+                        int64_t              val_batch_stride,
+                        const T*             x,
+                        int64_t              x_batch_stride,
+                        T*                   y,
+                        int64_t              y_batch_stride,
+                        rocsparse_diag_type  diag_type,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_index_base base,
+                        I*                   struct_pivot,
+                        I*                   numeric_pivot);
+
 template <typename T, typename I, typename A, typename X, typename Y>
 void host_ellmv(rocsparse_operation  trans,
                 I                    M,
@@ -337,6 +380,79 @@ void host_ellmv(rocsparse_operation  trans,
                 Y*                   y,
                 rocsparse_index_base base);
 
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+void host_csrmv_strided_batched(rocsparse_operation  trans,
+                                J                    M,
+                                J                    N,
+                                I                    nnz,
+                                J                    batch_count,
+                                T                    alpha,
+                                const I*             csr_row_ptr,
+                                const J*             csr_col_ind,
+                                const A*             csr_val,
+                                int64_t              val_batch_stride,
+                                const X*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                Y*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base);
+
+template <typename T, typename I, typename A, typename X, typename Y>
+void host_coomv_strided_batched(rocsparse_operation  trans,
+                                I                    M,
+                                I                    N,
+                                int64_t              nnz,
+                                I                    batch_count,
+                                T                    alpha,
+                                const I*             coo_row_ind,
+                                const I*             coo_col_ind,
+                                const A*             coo_val,
+                                int64_t              val_batch_stride,
+                                const X*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                Y*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base);
+
+template <typename T, typename I, typename A, typename X, typename Y>
+void host_ellmv_strided_batched(rocsparse_operation  trans,
+                                I                    M,
+                                I                    N,
+                                I                    batch_count,
+                                T                    alpha,
+                                const I*             ell_col_ind,
+                                const A*             ell_val,
+                                int64_t              val_batch_stride,
+                                I                    ell_width,
+                                const X*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                Y*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base);
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+void host_bsrmv_strided_batched(rocsparse_direction  dir,
+                                rocsparse_operation  trans,
+                                J                    mb,
+                                J                    nb,
+                                I                    nnzb,
+                                J                    batch_count,
+                                T                    alpha,
+                                const I*             bsr_row_ptr,
+                                const J*             bsr_col_ind,
+                                const A*             bsr_val,
+                                int64_t              val_batch_stride,
+                                J                    bsr_dim,
+                                const X*             x,
+                                int64_t              x_batch_stride,
+                                T                    beta,
+                                Y*                   y,
+                                int64_t              y_batch_stride,
+                                rocsparse_index_base base);
+
 template <typename T>
 void host_hybmv(rocsparse_operation  trans,
                 rocsparse_int        M,
@@ -600,6 +716,48 @@ void host_coosm(I                    M,
                 I*                   struct_pivot,
                 I*                   numeric_pivot);
 
+template <typename I, typename J, typename T>
+void host_csrsm_batched(J                    M,
+                        J                    nrhs,
+                        I                    nnz,
+                        J                    batch_count,
+                        rocsparse_operation  transA,
+                        rocsparse_operation  transB,
+                        T                    alpha,
+                        const I*             csr_row_ptr,
+                        const J*             csr_col_ind,
+                        const T*             csr_val,
+                        int64_t              val_batch_stride,
+                        T*                   B,
+                        J                    ldb,
+                        int64_t              B_batch_stride,
+                        rocsparse_diag_type  diag_type,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_index_base base,
+                        J*                   struct_pivot,
+                        J*                   numeric_pivot);
+
+template <typename I, typename T>
+void host_coosm_batched(I                    M,
+                        I                    nrhs,
+                        int64_t              nnz,
+                        I                    batch_count,
+                        rocsparse_operation  transA,
+                        rocsparse_operation  transB,
+                        T                    alpha,
+                        const I*             coo_row_ind,
+                        const I*             coo_col_ind,
+                        const T*             coo_val,
+                        int64_t              val_batch_stride,
+                        T*                   B,
+                        I                    ldb,
+                        int64_t              B_batch_stride,
+                        rocsparse_diag_type  diag_type,
+                        rocsparse_fill_mode  fill_mode,
+                        rocsparse_index_base base,
+                        I*                   struct_pivot,
+                        I*                   numeric_pivot);
+
 template <typename T>
 void host_bsrsm(rocsparse_int       mb,
                 rocsparse_int       nrhs,
@@ -809,9 +967,9 @@ template <typename T>
 void host_bsric0(rocsparse_direction               direction,
                  rocsparse_int                     Mb,
                  rocsparse_int                     block_dim,
-                 const std::vector<rocsparse_int>& bsr_row_ptr,
-                 const std::vector<rocsparse_int>& bsr_col_ind,
-                 std::vector<T>&                   bsr_val,
+                 const host_vector<rocsparse_int>& bsr_row_ptr,
+                 const host_vector<rocsparse_int>& bsr_col_ind,
+                 host_vector<T>&                   bsr_val,
                  rocsparse_index_base              base,
                  rocsparse_int*                    struct_pivot,
                  rocsparse_int*                    numeric_pivot);
@@ -819,9 +977,9 @@ void host_bsric0(rocsparse_direction               direction,
 template <typename T, typename U>
 void host_bsrilu0(rocsparse_direction               dir,
                   rocsparse_int                     mb,
-                  const std::vector<rocsparse_int>& bsr_row_ptr,
-                  const std::vector<rocsparse_int>& bsr_col_ind,
-                  std::vector<T>&                   bsr_val,
+                  const host_vector<rocsparse_int>& bsr_row_ptr,
+                  const host_vector<rocsparse_int>& bsr_col_ind,
+                  host_vector<T>&                   bsr_val,
                   rocsparse_int                     bsr_dim,
                   rocsparse_index_base              base,
                   rocsparse_int*                    struct_pivot,
@@ -832,18 +990,18 @@ void host_bsrilu0(rocsparse_direction               dir,
 
 template <typename T>
 void host_csric0(rocsparse_int                     M,
-                 const std::vector<rocsparse_int>& csr_row_ptr,
-                 const std::vector<rocsparse_int>& csr_col_ind,
-                 std::vector<T>&                   csr_val,
+                 const host_vector<rocsparse_int>& csr_row_ptr,
+                 const host_vector<rocsparse_int>& csr_col_ind,
+                 host_vector<T>&                   csr_val,
                  rocsparse_index_base              base,
                  rocsparse_int*                    struct_pivot,
                  rocsparse_int*                    numeric_pivot);
 
 template <typename T, typename U>
 void host_csrilu0(rocsparse_int                     M,
-                  const std::vector<rocsparse_int>& csr_row_ptr,
-                  const std::vector<rocsparse_int>& csr_col_ind,
-                  std::vector<T>&                   csr_val,
+                  const host_vector<rocsparse_int>& csr_row_ptr,
+                  const host_vector<rocsparse_int>& csr_col_ind,
+                  host_vector<T>&                   csr_val,
                   rocsparse_index_base              base,
                   rocsparse_int*                    struct_pivot,
                   rocsparse_int*                    numeric_pivot,
@@ -854,18 +1012,18 @@ void host_csrilu0(rocsparse_int                     M,
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
                         rocsparse_int         n,
-                        const std::vector<T>& dl,
-                        const std::vector<T>& d,
-                        const std::vector<T>& du,
-                        std::vector<T>&       B,
+                        const host_vector<T>& dl,
+                        const host_vector<T>& d,
+                        const host_vector<T>& du,
+                        host_vector<T>&       B,
                         rocsparse_int         ldb);
 
 template <typename T>
 void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
-                                      const std::vector<T>& dl,
-                                      const std::vector<T>& d,
-                                      const std::vector<T>& du,
-                                      std::vector<T>&       x,
+                                      const host_vector<T>& dl,
+                                      const host_vector<T>& d,
+                                      const host_vector<T>& du,
+                                      host_vector<T>&       x,
                                       rocsparse_int         batch_count,
                                       rocsparse_int         batch_stride);
 
@@ -908,26 +1066,26 @@ rocsparse_status host_nnz(rocsparse_direction dirA,
 template <typename T>
 void host_prune_dense2csr(rocsparse_int               m,
                           rocsparse_int               n,
-                          const std::vector<T>&       A,
+                          const host_vector<T>&       A,
                           rocsparse_int               lda,
                           rocsparse_index_base        base,
                           T                           threshold,
                           rocsparse_int&              nnz,
-                          std::vector<T>&             csr_val,
-                          std::vector<rocsparse_int>& csr_row_ptr,
-                          std::vector<rocsparse_int>& csr_col_ind);
+                          host_vector<T>&             csr_val,
+                          host_vector<rocsparse_int>& csr_row_ptr,
+                          host_vector<rocsparse_int>& csr_col_ind);
 
 template <typename T>
 void host_prune_dense2csr_by_percentage(rocsparse_int               m,
                                         rocsparse_int               n,
-                                        const std::vector<T>&       A,
+                                        const host_vector<T>&       A,
                                         rocsparse_int               lda,
                                         rocsparse_index_base        base,
                                         T                           percentage,
                                         rocsparse_int&              nnz,
-                                        std::vector<T>&             csr_val,
-                                        std::vector<rocsparse_int>& csr_row_ptr,
-                                        std::vector<rocsparse_int>& csr_col_ind);
+                                        host_vector<T>&             csr_val,
+                                        host_vector<rocsparse_int>& csr_row_ptr,
+                                        host_vector<rocsparse_int>& csr_col_ind);
 
 template <rocsparse_direction DIRA, typename T, typename I, typename J>
 void host_dense2csx(J                    m,
@@ -956,39 +1114,39 @@ template <typename I, typename T>
 void host_dense_to_coo(I                     m,
                        I                     n,
                        rocsparse_index_base  base,
-                       const std::vector<T>& A,
+                       const host_vector<T>& A,
                        I                     ld,
                        rocsparse_order       order,
-                       const std::vector<I>& nnz_per_row,
-                       std::vector<T>&       coo_val,
-                       std::vector<I>&       coo_row_ind,
-                       std::vector<I>&       coo_col_ind);
+                       const host_vector<I>& nnz_per_row,
+                       host_vector<T>&       coo_val,
+                       host_vector<I>&       coo_row_ind,
+                       host_vector<I>&       coo_col_ind);
 
 template <typename I, typename T>
 void host_coo_to_dense(I                     m,
                        I                     n,
                        I                     nnz,
                        rocsparse_index_base  base,
-                       const std::vector<T>& coo_val,
-                       const std::vector<I>& coo_row_ind,
-                       const std::vector<I>& coo_col_ind,
-                       std::vector<T>&       A,
+                       const host_vector<T>& coo_val,
+                       const host_vector<I>& coo_row_ind,
+                       const host_vector<I>& coo_col_ind,
+                       host_vector<T>&       A,
                        I                     ld,
                        rocsparse_order       order);
 
 template <typename I, typename J>
 void host_csr_to_coo(J                     M,
                      I                     nnz,
-                     const std::vector<I>& csr_row_ptr,
-                     std::vector<J>&       coo_row_ind,
+                     const host_vector<I>& csr_row_ptr,
+                     host_vector<J>&       coo_row_ind,
                      rocsparse_index_base  base);
 
 template <typename I, typename J>
 void host_csr_to_coo_aos(J                     M,
                          I                     nnz,
-                         const std::vector<I>& csr_row_ptr,
-                         const std::vector<J>& csr_col_ind,
-                         std::vector<I>&       coo_ind,
+                         const host_vector<I>& csr_row_ptr,
+                         const host_vector<J>& csr_col_ind,
+                         host_vector<I>&       coo_ind,
                          rocsparse_index_base  base);
 
 template <typename I, typename J, typename T>
@@ -998,9 +1156,9 @@ void host_csr_to_csc(J                    M,
                      const I*             csr_row_ptr,
                      const J*             csr_col_ind,
                      const T*             csr_val,
-                     std::vector<J>&      csc_row_ind,
-                     std::vector<I>&      csc_col_ptr,
-                     std::vector<T>&      csc_val,
+                     host_vector<J>&      csc_row_ind,
+                     host_vector<I>&      csc_col_ptr,
+                     host_vector<T>&      csc_val,
                      rocsparse_action     action,
                      rocsparse_index_base base);
 
@@ -1009,14 +1167,14 @@ void host_bsr_to_csr(rocsparse_direction               direction,
                      rocsparse_int                     mb,
                      rocsparse_int                     nb,
                      rocsparse_int                     nnzb,
-                     const std::vector<T>&             bsr_val,
-                     const std::vector<rocsparse_int>& bsr_row_ptr,
-                     const std::vector<rocsparse_int>& bsr_col_ind,
+                     const host_vector<T>&             bsr_val,
+                     const host_vector<rocsparse_int>& bsr_row_ptr,
+                     const host_vector<rocsparse_int>& bsr_col_ind,
                      rocsparse_int                     block_dim,
                      rocsparse_index_base              bsr_base,
-                     std::vector<T>&                   csr_val,
-                     std::vector<rocsparse_int>&       csr_row_ptr,
-                     std::vector<rocsparse_int>&       csr_col_ind,
+                     host_vector<T>&                   csr_val,
+                     host_vector<rocsparse_int>&       csr_row_ptr,
+                     host_vector<rocsparse_int>&       csr_col_ind,
                      rocsparse_index_base              csr_base);
 
 template <typename T>
@@ -1024,28 +1182,28 @@ void host_csr_to_bsr(rocsparse_direction               direction,
                      rocsparse_int                     m,
                      rocsparse_int                     n,
                      rocsparse_int                     nnz,
-                     const std::vector<T>&             csr_val,
-                     const std::vector<rocsparse_int>& csr_row_ptr,
-                     const std::vector<rocsparse_int>& csr_col_ind,
+                     const host_vector<T>&             csr_val,
+                     const host_vector<rocsparse_int>& csr_row_ptr,
+                     const host_vector<rocsparse_int>& csr_col_ind,
                      rocsparse_int                     block_dim,
                      rocsparse_index_base              csr_base,
-                     std::vector<T>&                   bsr_val,
-                     std::vector<rocsparse_int>&       bsr_row_ptr,
-                     std::vector<rocsparse_int>&       bsr_col_ind,
+                     host_vector<T>&                   bsr_val,
+                     host_vector<rocsparse_int>&       bsr_row_ptr,
+                     host_vector<rocsparse_int>&       bsr_col_ind,
                      rocsparse_index_base              bsr_base);
 
 template <typename T>
 void host_gebsr_to_gebsc(rocsparse_int                     Mb,
                          rocsparse_int                     Nb,
                          rocsparse_int                     nnzb,
-                         const std::vector<rocsparse_int>& bsr_row_ptr,
-                         const std::vector<rocsparse_int>& bsr_col_ind,
-                         const std::vector<T>&             bsr_val,
+                         const host_vector<rocsparse_int>& bsr_row_ptr,
+                         const host_vector<rocsparse_int>& bsr_col_ind,
+                         const host_vector<T>&             bsr_val,
                          rocsparse_int                     row_block_dim,
                          rocsparse_int                     col_block_dim,
-                         std::vector<rocsparse_int>&       bsc_row_ind,
-                         std::vector<rocsparse_int>&       bsc_col_ptr,
-                         std::vector<T>&                   bsc_val,
+                         host_vector<rocsparse_int>&       bsc_row_ind,
+                         host_vector<rocsparse_int>&       bsc_col_ptr,
+                         host_vector<T>&                   bsc_val,
                          rocsparse_action                  action,
                          rocsparse_index_base              base);
 
@@ -1054,15 +1212,15 @@ void host_gebsr_to_csr(rocsparse_direction               direction,
                        rocsparse_int                     mb,
                        rocsparse_int                     nb,
                        rocsparse_int                     nnzb,
-                       const std::vector<T>&             bsr_val,
-                       const std::vector<rocsparse_int>& bsr_row_ptr,
-                       const std::vector<rocsparse_int>& bsr_col_ind,
+                       const host_vector<T>&             bsr_val,
+                       const host_vector<rocsparse_int>& bsr_row_ptr,
+                       const host_vector<rocsparse_int>& bsr_col_ind,
                        rocsparse_int                     row_block_dim,
                        rocsparse_int                     col_block_dim,
                        rocsparse_index_base              bsr_base,
-                       std::vector<T>&                   csr_val,
-                       std::vector<rocsparse_int>&       csr_row_ptr,
-                       std::vector<rocsparse_int>&       csr_col_ind,
+                       host_vector<T>&                   csr_val,
+                       host_vector<rocsparse_int>&       csr_row_ptr,
+                       host_vector<rocsparse_int>&       csr_col_ind,
                        rocsparse_index_base              csr_base);
 
 template <typename T>
@@ -1070,15 +1228,15 @@ void host_csr_to_gebsr(rocsparse_direction               direction,
                        rocsparse_int                     m,
                        rocsparse_int                     n,
                        rocsparse_int                     nnz,
-                       const std::vector<T>&             csr_val,
-                       const std::vector<rocsparse_int>& csr_row_ptr,
-                       const std::vector<rocsparse_int>& csr_col_ind,
+                       const host_vector<T>&             csr_val,
+                       const host_vector<rocsparse_int>& csr_row_ptr,
+                       const host_vector<rocsparse_int>& csr_col_ind,
                        rocsparse_int                     row_block_dim,
                        rocsparse_int                     col_block_dim,
                        rocsparse_index_base              csr_base,
-                       std::vector<T>&                   bsr_val,
-                       std::vector<rocsparse_int>&       bsr_row_ptr,
-                       std::vector<rocsparse_int>&       bsr_col_ind,
+                       host_vector<T>&                   bsr_val,
+                       host_vector<rocsparse_int>&       bsr_row_ptr,
+                       host_vector<rocsparse_int>&       bsr_col_ind,
                        rocsparse_index_base              bsr_base);
 
 template <typename T>
@@ -1097,15 +1255,15 @@ void host_gebsr_to_gebsr(rocsparse_direction               direction,
                          rocsparse_int                     mb,
                          rocsparse_int                     nb,
                          rocsparse_int                     nnzb,
-                         const std::vector<T>&             bsr_val_A,
-                         const std::vector<rocsparse_int>& bsr_row_ptr_A,
-                         const std::vector<rocsparse_int>& bsr_col_ind_A,
+                         const host_vector<T>&             bsr_val_A,
+                         const host_vector<rocsparse_int>& bsr_row_ptr_A,
+                         const host_vector<rocsparse_int>& bsr_col_ind_A,
                          rocsparse_int                     row_block_dim_A,
                          rocsparse_int                     col_block_dim_A,
                          rocsparse_index_base              base_A,
-                         std::vector<T>&                   bsr_val_C,
-                         std::vector<rocsparse_int>&       bsr_row_ptr_C,
-                         std::vector<rocsparse_int>&       bsr_col_ind_C,
+                         host_vector<T>&                   bsr_val_C,
+                         host_vector<rocsparse_int>&       bsr_row_ptr_C,
+                         host_vector<rocsparse_int>&       bsr_col_ind_C,
                          rocsparse_int                     row_block_dim_C,
                          rocsparse_int                     col_block_dim_C,
                          rocsparse_index_base              base_C);
@@ -1118,19 +1276,19 @@ void host_bsr_to_bsc(rocsparse_int               mb,
                      const rocsparse_int*        bsr_row_ptr,
                      const rocsparse_int*        bsr_col_ind,
                      const T*                    bsr_val,
-                     std::vector<rocsparse_int>& bsc_row_ind,
-                     std::vector<rocsparse_int>& bsc_col_ptr,
-                     std::vector<T>&             bsc_val,
+                     host_vector<rocsparse_int>& bsc_row_ind,
+                     host_vector<rocsparse_int>& bsc_col_ptr,
+                     host_vector<T>&             bsc_val,
                      rocsparse_index_base        bsr_base,
                      rocsparse_index_base        bsc_base);
 
 template <typename I, typename J, typename T>
 void host_csr_to_ell(J                     M,
-                     const std::vector<I>& csr_row_ptr,
-                     const std::vector<J>& csr_col_ind,
-                     const std::vector<T>& csr_val,
-                     std::vector<J>&       ell_col_ind,
-                     std::vector<T>&       ell_val,
+                     const host_vector<I>& csr_row_ptr,
+                     const host_vector<J>& csr_col_ind,
+                     const host_vector<T>& csr_val,
+                     host_vector<J>&       ell_col_ind,
+                     host_vector<T>&       ell_val,
                      J&                    ell_width,
                      rocsparse_index_base  csr_base,
                      rocsparse_index_base  ell_base);
@@ -1138,16 +1296,16 @@ void host_csr_to_ell(J                     M,
 template <typename T>
 void host_csr_to_hyb(rocsparse_int                     M,
                      rocsparse_int                     nnz,
-                     const std::vector<rocsparse_int>& csr_row_ptr,
-                     const std::vector<rocsparse_int>& csr_col_ind,
-                     const std::vector<T>&             csr_val,
-                     std::vector<rocsparse_int>&       ell_col_ind,
-                     std::vector<T>&                   ell_val,
+                     const host_vector<rocsparse_int>& csr_row_ptr,
+                     const host_vector<rocsparse_int>& csr_col_ind,
+                     const host_vector<T>&             csr_val,
+                     host_vector<rocsparse_int>&       ell_col_ind,
+                     host_vector<T>&                   ell_val,
                      rocsparse_int&                    ell_width,
                      rocsparse_int&                    ell_nnz,
-                     std::vector<rocsparse_int>&       coo_row_ind,
-                     std::vector<rocsparse_int>&       coo_col_ind,
-                     std::vector<T>&                   coo_val,
+                     host_vector<rocsparse_int>&       coo_row_ind,
+                     host_vector<rocsparse_int>&       coo_col_ind,
+                     host_vector<T>&                   coo_val,
                      rocsparse_int&                    coo_nnz,
                      rocsparse_hyb_partition           part,
                      rocsparse_index_base              base);
@@ -1156,25 +1314,25 @@ template <typename T>
 void host_csr_to_csr_compress(rocsparse_int                     M,
                               rocsparse_int                     N,
                               rocsparse_int                     nnz,
-                              const std::vector<rocsparse_int>& csr_row_ptr_A,
-                              const std::vector<rocsparse_int>& csr_col_ind_A,
-                              const std::vector<T>&             csr_val_A,
-                              std::vector<rocsparse_int>&       csr_row_ptr_C,
-                              std::vector<rocsparse_int>&       csr_col_ind_C,
-                              std::vector<T>&                   csr_val_C,
+                              const host_vector<rocsparse_int>& csr_row_ptr_A,
+                              const host_vector<rocsparse_int>& csr_col_ind_A,
+                              const host_vector<T>&             csr_val_A,
+                              host_vector<rocsparse_int>&       csr_row_ptr_C,
+                              host_vector<rocsparse_int>&       csr_col_ind_C,
+                              host_vector<T>&                   csr_val_C,
                               rocsparse_index_base              base,
                               T                                 tol);
 template <typename T>
 void host_prune_csr_to_csr(rocsparse_int                     M,
                            rocsparse_int                     N,
                            rocsparse_int                     nnz_A,
-                           const std::vector<rocsparse_int>& csr_row_ptr_A,
-                           const std::vector<rocsparse_int>& csr_col_ind_A,
-                           const std::vector<T>&             csr_val_A,
+                           const host_vector<rocsparse_int>& csr_row_ptr_A,
+                           const host_vector<rocsparse_int>& csr_col_ind_A,
+                           const host_vector<T>&             csr_val_A,
                            rocsparse_int&                    nnz_C,
-                           std::vector<rocsparse_int>&       csr_row_ptr_C,
-                           std::vector<rocsparse_int>&       csr_col_ind_C,
-                           std::vector<T>&                   csr_val_C,
+                           host_vector<rocsparse_int>&       csr_row_ptr_C,
+                           host_vector<rocsparse_int>&       csr_col_ind_C,
+                           host_vector<T>&                   csr_val_C,
                            rocsparse_index_base              csr_base_A,
                            rocsparse_index_base              csr_base_C,
                            T                                 threshold);
@@ -1183,30 +1341,30 @@ template <typename T>
 void host_prune_csr_to_csr_by_percentage(rocsparse_int                     M,
                                          rocsparse_int                     N,
                                          rocsparse_int                     nnz_A,
-                                         const std::vector<rocsparse_int>& csr_row_ptr_A,
-                                         const std::vector<rocsparse_int>& csr_col_ind_A,
-                                         const std::vector<T>&             csr_val_A,
+                                         const host_vector<rocsparse_int>& csr_row_ptr_A,
+                                         const host_vector<rocsparse_int>& csr_col_ind_A,
+                                         const host_vector<T>&             csr_val_A,
                                          rocsparse_int&                    nnz_C,
-                                         std::vector<rocsparse_int>&       csr_row_ptr_C,
-                                         std::vector<rocsparse_int>&       csr_col_ind_C,
-                                         std::vector<T>&                   csr_val_C,
+                                         host_vector<rocsparse_int>&       csr_row_ptr_C,
+                                         host_vector<rocsparse_int>&       csr_col_ind_C,
+                                         host_vector<T>&                   csr_val_C,
                                          rocsparse_index_base              csr_base_A,
                                          rocsparse_index_base              csr_base_C,
                                          T                                 percentage);
 
 template <typename I, typename J>
 void host_coo_to_csr(
-    J M, I nnz, const J* coo_row_ind, std::vector<I>& csr_row_ptr, rocsparse_index_base base);
+    J M, I nnz, const J* coo_row_ind, host_vector<I>& csr_row_ptr, rocsparse_index_base base);
 
 template <typename T>
 void host_ell_to_csr(rocsparse_int                     M,
                      rocsparse_int                     N,
-                     const std::vector<rocsparse_int>& ell_col_ind,
-                     const std::vector<T>&             ell_val,
+                     const host_vector<rocsparse_int>& ell_col_ind,
+                     const host_vector<T>&             ell_val,
                      rocsparse_int                     ell_width,
-                     std::vector<rocsparse_int>&       csr_row_ptr,
-                     std::vector<rocsparse_int>&       csr_col_ind,
-                     std::vector<T>&                   csr_val,
+                     host_vector<rocsparse_int>&       csr_row_ptr,
+                     host_vector<rocsparse_int>&       csr_col_ind,
+                     host_vector<T>&                   csr_val,
                      rocsparse_int&                    csr_nnz,
                      rocsparse_index_base              ell_base,
                      rocsparse_index_base              csr_base);
@@ -1214,8 +1372,8 @@ void host_ell_to_csr(rocsparse_int                     M,
 template <typename T>
 void host_coosort_by_column(rocsparse_int               M,
                             rocsparse_int               nnz,
-                            std::vector<rocsparse_int>& coo_row_ind,
-                            std::vector<rocsparse_int>& coo_col_ind,
-                            std::vector<T>&             coo_val);
+                            host_vector<rocsparse_int>& coo_row_ind,
+                            host_vector<rocsparse_int>& coo_col_ind,
+                            host_vector<T>&             coo_val);
 
 #endif // ROCSPARSE_HOST_HPP
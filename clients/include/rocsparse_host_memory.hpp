@@ -0,0 +1,177 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_HOST_MEMORY_HPP
+#define ROCSPARSE_HOST_MEMORY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//
+// Storage of large host arrays of the clients, from ROCSPARSE_CLIENTS_HOST_MEMORY:
+// - default: host_dense_vector and host_dense_matrix are pinned with hipHostMalloc,
+//   host_vector uses the standard allocator,
+// - hugepages[:transparent]: anonymous mappings backed by reserved huge pages,
+//   or by transparent huge pages when none are reserved or with :transparent,
+// - mmap[:directory]: shared mappings of unlinked files created in directory
+//   (default = $TMPDIR or /tmp), paged by the kernel, so that reference data
+//   can exceed the physical memory.
+// Memory of the dense containers is left uninitialized, host_vector default
+// initializes its elements so that its arrays of arithmetic types are too.
+// Large arrays are faulted in by a parallel first touch whatever the policy.
+//
+typedef enum rocsparse_host_memory_policy_
+{
+    rocsparse_host_memory_policy_default,
+    rocsparse_host_memory_policy_hugepages,
+    rocsparse_host_memory_policy_mmap
+} rocsparse_host_memory_policy;
+
+//
+// What backs memory obtained from rocsparse_host_memory_allocate.
+//
+typedef enum rocsparse_host_memory_backing_
+{
+    rocsparse_host_memory_backing_none,
+    rocsparse_host_memory_backing_hugetlb,
+    rocsparse_host_memory_backing_transparent,
+    rocsparse_host_memory_backing_file
+} rocsparse_host_memory_backing;
+
+//
+// Arrays smaller than one huge page are always allocated the default way.
+//
+static constexpr size_t rocsparse_host_memory_threshold = size_t(1) << 21;
+
+rocsparse_host_memory_policy rocsparse_host_memory_get_policy();
+
+//
+// Replace the policy as if ROCSPARSE_CLIENTS_HOST_MEMORY was value, value = nullptr
+// restores the policy of the environment. Memory already allocated stays valid.
+// This is not thread safe, it is meant for tests.
+//
+void rocsparse_host_memory_set_policy(const char* value);
+
+//
+// Allocate nbytes of uninitialized memory with the current policy, its pages
+// are faulted in by rocsparse_host_memory_first_touch.
+// Return nullptr with the default policy, below the threshold or on failure,
+// in which case the caller falls back to its own allocation.
+//
+void* rocsparse_host_memory_allocate(size_t nbytes);
+
+//
+// Release memory obtained from rocsparse_host_memory_allocate.
+// Return false if p has not been obtained from it.
+//
+bool rocsparse_host_memory_free(void* p);
+
+//
+// Backing of the memory at address p, rocsparse_host_memory_backing_none if p
+// does not lie in memory obtained from rocsparse_host_memory_allocate.
+//
+rocsparse_host_memory_backing rocsparse_host_memory_get_backing(const void* p);
+
+//
+// Fault in the pages of [p, p + nbytes) with a static OpenMP schedule, so that
+// each page lands on the NUMA node of the thread that touches it, and
+// loops with the same schedule find their data locally. The pages are
+// advised as huge pages with the hugepages policy. A zero byte is written
+// into each page, the range must not hold data yet.
+//
+void rocsparse_host_memory_first_touch(void* p, size_t nbytes);
+
+//
+// Allocator of host_vector over rocsparse_host_memory_allocate, falling back to
+// std::allocator with a first touch of large arrays. Elements constructed
+// without arguments are default initialized, so that resize leaves arrays of
+// arithmetic types uninitialized.
+//
+template <typename T>
+struct rocsparse_host_memory_allocator
+{
+    using value_type = T;
+
+    rocsparse_host_memory_allocator() = default;
+    template <typename U>
+    rocsparse_host_memory_allocator(const rocsparse_host_memory_allocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        const size_t nbytes = n * sizeof(T);
+        void*        p      = rocsparse_host_memory_allocate(nbytes);
+        if(p == nullptr)
+        {
+            p = std::allocator<T>().allocate(n);
+            if(nbytes >= rocsparse_host_memory_threshold)
+            {
+                rocsparse_host_memory_first_touch(p, nbytes);
+            }
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n)
+    {
+        if(!rocsparse_host_memory_free(p))
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    template <typename U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new(static_cast<void*>(p)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const rocsparse_host_memory_allocator<T>&,
+                const rocsparse_host_memory_allocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const rocsparse_host_memory_allocator<T>&,
+                const rocsparse_host_memory_allocator<U>&)
+{
+    return false;
+}
+
+#endif // ROCSPARSE_HOST_MEMORY_HPP
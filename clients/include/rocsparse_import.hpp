@@ -143,6 +143,72 @@ rocsparse_status rocsparse_import_sparse_csr(rocsparse_importer<IMPORTER>& impor
     return rocsparse_status_success;
 }
 
+//
+// Import the rows [row_begin, row_end) of a csr matrix, M and N are the global
+// dimensions and row_ptr holds the offsets of the slab.
+//
+template <typename I,
+          typename J,
+          typename T,
+          typename IMPORTER,
+          template <typename...>
+          class VECTOR1,
+          template <typename...>
+          class VECTOR2,
+          template <typename...>
+          class VECTOR3>
+rocsparse_status rocsparse_import_sparse_csr_rows(rocsparse_importer<IMPORTER>& importer,
+                                                  J                             row_begin,
+                                                  J                             row_end,
+                                                  VECTOR1<I>&                   row_ptr,
+                                                  VECTOR2<J>&                   col_ind,
+                                                  VECTOR3<T>&                   val,
+                                                  J&                            M,
+                                                  J&                            N,
+                                                  I&                            nnz,
+                                                  rocsparse_index_base          base)
+{
+    rocsparse_direction  dir;
+    rocsparse_index_base import_base;
+    rocsparse_status     status
+        = importer.import_sparse_csx_rows(row_begin, row_end, &dir, &M, &N, &nnz, &import_base);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+    if(dir != rocsparse_direction_row)
+    {
+        std::cerr << "expected csr matrix " << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    const J slab_m = std::min(row_end, M) - std::min(row_begin, M);
+
+    row_ptr.resize(slab_m + 1);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+    status = importer.import_sparse_csx_rows(row_ptr.data(), col_ind.data(), val.data());
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    status = rocsparse_importer_switch_base(slab_m + 1, row_ptr, import_base, base);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    status = rocsparse_importer_switch_base(nnz, col_ind, import_base, base);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    return rocsparse_status_success;
+}
+
 template <typename I,
           typename T,
           typename IMPORTER,
@@ -171,6 +171,33 @@ public:
         return static_cast<IMPL&>(*this).import_sparse_csx(ptr, ind, val);
     }
 
+    //
+    // Import the slab [row_begin, row_end) of the compressed dimension only.
+    // The range is 0-based and clamped to the matrix, m and n are the global
+    // dimensions and nnz is the number of entries of the slab.
+    //
+    template <typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(J                     row_begin,
+                                            J                     row_end,
+                                            rocsparse_direction*  dir,
+                                            J*                    m,
+                                            J*                    n,
+                                            I*                    nnz,
+                                            rocsparse_index_base* base)
+    {
+        return static_cast<IMPL&>(*this).import_sparse_csx_rows(
+            row_begin, row_end, dir, m, n, nnz, base);
+    }
+
+    //
+    // The slab pointer array starts at the index base, the indices are global.
+    //
+    template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+    rocsparse_status import_sparse_csx_rows(I* ptr, J* ind, T* val)
+    {
+        return static_cast<IMPL&>(*this).import_sparse_csx_rows(ptr, ind, val);
+    }
+
     template <typename I = rocsparse_int, typename J = rocsparse_int>
     rocsparse_status import_sparse_gebsx(rocsparse_direction*  dir,
                                          rocsparse_direction*  dirb,
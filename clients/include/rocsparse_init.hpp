@@ -59,7 +59,7 @@ void rocsparse_init_exact(T*     A,
                           int    b           = 10);
 
 template <typename T>
-void rocsparse_init(std::vector<T>& A,
+void rocsparse_init(host_vector<T>& A,
                     size_t          M,
                     size_t          N,
                     size_t          lda,
@@ -70,7 +70,7 @@ void rocsparse_init(std::vector<T>& A,
 
 // Initialize vector with random integer values
 template <typename T>
-void rocsparse_init_exact(std::vector<T>& A,
+void rocsparse_init_exact(host_vector<T>& A,
                           size_t          M,
                           size_t          N,
                           size_t          lda,
@@ -81,7 +81,7 @@ void rocsparse_init_exact(std::vector<T>& A,
 
 // Initializes sparse index vector with nnz entries ranging from start to end
 template <typename I>
-void rocsparse_init_index(std::vector<I>& x, size_t nnz, size_t start, size_t end);
+void rocsparse_init_index(host_vector<I>& x, size_t nnz, size_t start, size_t end);
 
 // Initialize matrix so adjacent entries have alternating sign.
 // In gemm if either A or B are initialized with alernating
@@ -92,7 +92,7 @@ void rocsparse_init_index(std::vector<I>& x, size_t nnz, size_t start, size_t en
 // mantissa 10 bits.
 template <typename T>
 void rocsparse_init_alternating_sign(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1);
+    host_vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1);
 
 /* ==================================================================================== */
 /*! \brief  Initialize an array with random data, with NaN where appropriate */
@@ -102,14 +102,14 @@ void rocsparse_init_nan(T* A, size_t N);
 
 template <typename T>
 void rocsparse_init_nan(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1);
+    host_vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1);
 
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
-                               std::vector<I>&      col_ind,
-                               std::vector<T>&      val,
+void rocsparse_init_coo_matrix(host_vector<I>&      row_ind,
+                               host_vector<I>&      col_ind,
+                               host_vector<T>&      val,
                                I                    M,
                                I                    N,
                                int64_t              nnz,
@@ -120,9 +120,9 @@ void rocsparse_init_coo_matrix(std::vector<I>&      row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate 2D 9pt laplacian on unit square in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_laplace2d(std::vector<I>&      row_ptr,
-                                  std::vector<J>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_csr_laplace2d(host_vector<I>&      row_ptr,
+                                  host_vector<J>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   J&                   M,
@@ -133,9 +133,9 @@ void rocsparse_init_csr_laplace2d(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate 2D 9pt laplacian on unit square in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_laplace2d(std::vector<I>&      row_ind,
-                                  std::vector<I>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_coo_laplace2d(host_vector<I>&      row_ind,
+                                  host_vector<I>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   I&                   M,
@@ -146,9 +146,9 @@ void rocsparse_init_coo_laplace2d(std::vector<I>&      row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate 2D 9pt laplacian on unit square in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_laplace2d(std::vector<I>&      row_ptr,
-                                    std::vector<J>&      col_ind,
-                                    std::vector<T>&      val,
+void rocsparse_init_gebsr_laplace2d(host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
                                     int32_t              dim_x,
                                     int32_t              dim_y,
                                     J&                   Mb,
@@ -161,8 +161,8 @@ void rocsparse_init_gebsr_laplace2d(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate 2D 9pt laplacian on unit square in ELL format */
 template <typename I, typename T>
-void rocsparse_init_ell_laplace2d(std::vector<I>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_ell_laplace2d(host_vector<I>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   I&                   M,
@@ -173,9 +173,9 @@ void rocsparse_init_ell_laplace2d(std::vector<I>&      col_ind,
 /* ==================================================================================== */
 /*! \brief  Generate 3D 27pt laplacian on unit square in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_laplace3d(std::vector<I>&      row_ptr,
-                                  std::vector<J>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_csr_laplace3d(host_vector<I>&      row_ptr,
+                                  host_vector<J>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   int32_t              dim_z,
@@ -187,9 +187,9 @@ void rocsparse_init_csr_laplace3d(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate 3D 27pt laplacian on unit square in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_laplace3d(std::vector<I>&      row_ind,
-                                  std::vector<I>&      col_ind,
-                                  std::vector<T>&      val,
+void rocsparse_init_coo_laplace3d(host_vector<I>&      row_ind,
+                                  host_vector<I>&      col_ind,
+                                  host_vector<T>&      val,
                                   int32_t              dim_x,
                                   int32_t              dim_y,
                                   int32_t              dim_z,
@@ -201,9 +201,9 @@ void rocsparse_init_coo_laplace3d(std::vector<I>&      row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate 3D 27pt laplacian on unit square in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_laplace3d(std::vector<I>&      row_ptr,
-                                    std::vector<J>&      col_ind,
-                                    std::vector<T>&      val,
+void rocsparse_init_gebsr_laplace3d(host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
                                     int32_t              dim_x,
                                     int32_t              dim_y,
                                     int32_t              dim_z,
@@ -214,13 +214,66 @@ void rocsparse_init_gebsr_laplace3d(std::vector<I>&      row_ptr,
                                     J                    col_block_dim,
                                     rocsparse_index_base base);
 
+/* ============================================================================================ */
+/*! \brief  Generate 3D 7, 19 or 27pt stencil with dof unknowns per node in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_stencil3d(host_vector<I>&      row_ptr,
+                                  host_vector<J>&      col_ind,
+                                  host_vector<T>&      val,
+                                  int32_t              dim_x,
+                                  int32_t              dim_y,
+                                  int32_t              dim_z,
+                                  int32_t              points,
+                                  int32_t              dof,
+                                  bool                 permute,
+                                  J&                   M,
+                                  J&                   N,
+                                  I&                   nnz,
+                                  rocsparse_index_base base);
+
+/* ============================================================================================ */
+/*! \brief  Generate 3D 7, 19 or 27pt stencil with dof unknowns per node in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_stencil3d(host_vector<I>&      row_ind,
+                                  host_vector<I>&      col_ind,
+                                  host_vector<T>&      val,
+                                  int32_t              dim_x,
+                                  int32_t              dim_y,
+                                  int32_t              dim_z,
+                                  int32_t              points,
+                                  int32_t              dof,
+                                  bool                 permute,
+                                  I&                   M,
+                                  I&                   N,
+                                  int64_t&             nnz,
+                                  rocsparse_index_base base);
+
+/* ============================================================================================ */
+/*! \brief  Generate 3D 7, 19 or 27pt stencil in GEBSR format, each node being a block */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_stencil3d(host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
+                                    rocsparse_direction  dir,
+                                    int32_t              dim_x,
+                                    int32_t              dim_y,
+                                    int32_t              dim_z,
+                                    int32_t              points,
+                                    bool                 permute,
+                                    J&                   Mb,
+                                    J&                   Nb,
+                                    I&                   nnzb,
+                                    J                    row_block_dim,
+                                    J                    col_block_dim,
+                                    rocsparse_index_base base);
+
 /* ============================================================================================ */
 /*! \brief  Read matrix from mtx file in CSR format */
 template <typename I, typename J, typename T>
 void rocsparse_init_csr_mtx(const char*          filename,
-                            std::vector<I>&      csr_row_ptr,
-                            std::vector<J>&      csr_col_ind,
-                            std::vector<T>&      csr_val,
+                            host_vector<I>&      csr_row_ptr,
+                            host_vector<J>&      csr_col_ind,
+                            host_vector<T>&      csr_val,
                             J&                   M,
                             J&                   N,
                             I&                   nnz,
@@ -230,9 +283,9 @@ void rocsparse_init_csr_mtx(const char*          filename,
 /*! \brief  Read matrix from mtx file in COO format */
 template <typename I, typename T>
 void rocsparse_init_coo_mtx(const char*          filename,
-                            std::vector<I>&      coo_row_ind,
-                            std::vector<I>&      coo_col_ind,
-                            std::vector<T>&      coo_val,
+                            host_vector<I>&      coo_row_ind,
+                            host_vector<I>&      coo_col_ind,
+                            host_vector<T>&      coo_val,
                             I&                   M,
                             I&                   N,
                             int64_t&             nnz,
@@ -242,9 +295,9 @@ void rocsparse_init_coo_mtx(const char*          filename,
 /*! \brief  Read matrix from mtx file in GEBSR format */
 template <typename I, typename J, typename T>
 void rocsparse_init_gebsr_mtx(const char*          filename,
-                              std::vector<I>&      bsr_row_ptr,
-                              std::vector<J>&      bsr_col_ind,
-                              std::vector<T>&      bsr_val,
+                              host_vector<I>&      bsr_row_ptr,
+                              host_vector<J>&      bsr_col_ind,
+                              host_vector<T>&      bsr_val,
                               J&                   Mb,
                               J&                   Nb,
                               I&                   nnzb,
@@ -256,9 +309,9 @@ void rocsparse_init_gebsr_mtx(const char*          filename,
 /*! \brief  Read matrix from binary file in rocALUTION format */
 template <typename I, typename J, typename T>
 void rocsparse_init_csr_rocalution(const char*          filename,
-                                   std::vector<I>&      row_ptr,
-                                   std::vector<J>&      col_ind,
-                                   std::vector<T>&      val,
+                                   host_vector<I>&      row_ptr,
+                                   host_vector<J>&      col_ind,
+                                   host_vector<T>&      val,
                                    J&                   M,
                                    J&                   N,
                                    I&                   nnz,
@@ -268,9 +321,9 @@ void rocsparse_init_csr_rocalution(const char*          filename,
 /*! \brief  Read matrix from binary file in rocALUTION format */
 template <typename I, typename T>
 void rocsparse_init_coo_rocalution(const char*          filename,
-                                   std::vector<I>&      row_ind,
-                                   std::vector<I>&      col_ind,
-                                   std::vector<T>&      val,
+                                   host_vector<I>&      row_ind,
+                                   host_vector<I>&      col_ind,
+                                   host_vector<T>&      val,
                                    I&                   M,
                                    I&                   N,
                                    int64_t&             nnz,
@@ -280,9 +333,9 @@ void rocsparse_init_coo_rocalution(const char*          filename,
 /*! \brief  Read matrix from binary file in rocALUTION format */
 template <typename I, typename J, typename T>
 void rocsparse_init_gebsr_rocalution(const char*          filename,
-                                     std::vector<I>&      row_ptr,
-                                     std::vector<J>&      col_ind,
-                                     std::vector<T>&      val,
+                                     host_vector<I>&      row_ptr,
+                                     host_vector<J>&      col_ind,
+                                     host_vector<T>&      val,
                                      J&                   Mb,
                                      J&                   Nb,
                                      I&                   nnzb,
@@ -294,9 +347,9 @@ void rocsparse_init_gebsr_rocalution(const char*          filename,
 /*! \brief  Read matrix from binary file in rocSPARSEIO format */
 template <typename I, typename J, typename T>
 void rocsparse_init_csr_rocsparseio(const char*          filename,
-                                    std::vector<I>&      row_ptr,
-                                    std::vector<J>&      col_ind,
-                                    std::vector<T>&      val,
+                                    host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
                                     J&                   M,
                                     J&                   N,
                                     I&                   nnz,
@@ -306,9 +359,9 @@ void rocsparse_init_csr_rocsparseio(const char*          filename,
 /*! \brief  Read matrix from binary file in rocSPARSEIO format */
 template <typename I, typename T>
 void rocsparse_init_coo_rocsparseio(const char*          filename,
-                                    std::vector<I>&      row_ind,
-                                    std::vector<I>&      col_ind,
-                                    std::vector<T>&      val,
+                                    host_vector<I>&      row_ind,
+                                    host_vector<I>&      col_ind,
+                                    host_vector<T>&      val,
                                     I&                   M,
                                     I&                   N,
                                     int64_t&             nnz,
@@ -318,9 +371,9 @@ void rocsparse_init_coo_rocsparseio(const char*          filename,
 /*! \brief  Read matrix from binary file in rocSPARSEIO format */
 template <typename I, typename J, typename T>
 void rocsparse_init_gebsr_rocsparseio(const char*          filename,
-                                      std::vector<I>&      row_ptr,
-                                      std::vector<J>&      col_ind,
-                                      std::vector<T>&      val,
+                                      host_vector<I>&      row_ptr,
+                                      host_vector<J>&      col_ind,
+                                      host_vector<T>&      val,
                                       rocsparse_direction  dir,
                                       J&                   Mb,
                                       J&                   Nb,
@@ -329,12 +382,51 @@ void rocsparse_init_gebsr_rocsparseio(const char*          filename,
                                       J                    col_block_dim,
                                       rocsparse_index_base base);
 
+/* ==================================================================================== */
+/*! \brief  Read matrix from chunked binary file */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_chunked(const char*          filename,
+                                host_vector<I>&      row_ptr,
+                                host_vector<J>&      col_ind,
+                                host_vector<T>&      val,
+                                J&                   M,
+                                J&                   N,
+                                I&                   nnz,
+                                rocsparse_index_base base);
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from chunked binary file */
+template <typename I, typename T>
+void rocsparse_init_coo_chunked(const char*          filename,
+                                host_vector<I>&      row_ind,
+                                host_vector<I>&      col_ind,
+                                host_vector<T>&      val,
+                                I&                   M,
+                                I&                   N,
+                                int64_t&             nnz,
+                                rocsparse_index_base base);
+
+/* ==================================================================================== */
+/*! \brief  Read matrix from chunked binary file */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_chunked(const char*          filename,
+                                  host_vector<I>&      row_ptr,
+                                  host_vector<J>&      col_ind,
+                                  host_vector<T>&      val,
+                                  rocsparse_direction  dir,
+                                  J&                   Mb,
+                                  J&                   Nb,
+                                  I&                   nnzb,
+                                  J                    row_block_dim,
+                                  J                    col_block_dim,
+                                  rocsparse_index_base base);
+
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_random(std::vector<I>&            row_ptr,
-                               std::vector<J>&            col_ind,
-                               std::vector<T>&            val,
+void rocsparse_init_csr_random(host_vector<I>&            row_ptr,
+                               host_vector<J>&            col_ind,
+                               host_vector<T>&            val,
                                J                          M,
                                J                          N,
                                I&                         nnz,
@@ -346,9 +438,9 @@ void rocsparse_init_csr_random(std::vector<I>&            row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_random(std::vector<I>&            row_ind,
-                               std::vector<I>&            col_ind,
-                               std::vector<T>&            val,
+void rocsparse_init_coo_random(host_vector<I>&            row_ind,
+                               host_vector<I>&            col_ind,
+                               host_vector<T>&            val,
                                I                          M,
                                I                          N,
                                int64_t&                   nnz,
@@ -360,9 +452,9 @@ void rocsparse_init_coo_random(std::vector<I>&            row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_random(std::vector<I>&            row_ptr,
-                                 std::vector<J>&            col_ind,
-                                 std::vector<T>&            val,
+void rocsparse_init_gebsr_random(host_vector<I>&            row_ptr,
+                                 host_vector<J>&            col_ind,
+                                 host_vector<T>&            val,
                                  J                          Mb,
                                  J                          Nb,
                                  I&                         nnzb,
@@ -376,9 +468,9 @@ void rocsparse_init_gebsr_random(std::vector<I>&            row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate a tridiagonal sparse matrix in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_tridiagonal(std::vector<I>&      row_ind,
-                                    std::vector<I>&      col_ind,
-                                    std::vector<T>&      val,
+void rocsparse_init_coo_tridiagonal(host_vector<I>&      row_ind,
+                                    host_vector<I>&      col_ind,
+                                    host_vector<T>&      val,
                                     I                    M,
                                     I                    N,
                                     int64_t&             nnz,
@@ -389,9 +481,9 @@ void rocsparse_init_coo_tridiagonal(std::vector<I>&      row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate a tridiagonal sparse matrix in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_tridiagonal(std::vector<I>&      row_ptr,
-                                    std::vector<J>&      col_ind,
-                                    std::vector<T>&      val,
+void rocsparse_init_csr_tridiagonal(host_vector<I>&      row_ptr,
+                                    host_vector<J>&      col_ind,
+                                    host_vector<T>&      val,
                                     J                    M,
                                     J                    N,
                                     I&                   nnz,
@@ -402,9 +494,9 @@ void rocsparse_init_csr_tridiagonal(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate a tridiagonal sparse matrix in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_tridiagonal(std::vector<I>&      row_ptr,
-                                      std::vector<J>&      col_ind,
-                                      std::vector<T>&      val,
+void rocsparse_init_gebsr_tridiagonal(host_vector<I>&      row_ptr,
+                                      host_vector<J>&      col_ind,
+                                      host_vector<T>&      val,
                                       J                    Mb,
                                       J                    Nb,
                                       I&                   nnzb,
@@ -417,9 +509,9 @@ void rocsparse_init_gebsr_tridiagonal(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate a penta diagonal sparse matrix in COO format */
 template <typename I, typename T>
-void rocsparse_init_coo_pentadiagonal(std::vector<I>&      row_ind,
-                                      std::vector<I>&      col_ind,
-                                      std::vector<T>&      val,
+void rocsparse_init_coo_pentadiagonal(host_vector<I>&      row_ind,
+                                      host_vector<I>&      col_ind,
+                                      host_vector<T>&      val,
                                       I                    M,
                                       I                    N,
                                       int64_t&             nnz,
@@ -432,9 +524,9 @@ void rocsparse_init_coo_pentadiagonal(std::vector<I>&      row_ind,
 /* ==================================================================================== */
 /*! \brief  Generate a penta diagonal sparse matrix in CSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_csr_pentadiagonal(std::vector<I>&      row_ptr,
-                                      std::vector<J>&      col_ind,
-                                      std::vector<T>&      val,
+void rocsparse_init_csr_pentadiagonal(host_vector<I>&      row_ptr,
+                                      host_vector<J>&      col_ind,
+                                      host_vector<T>&      val,
                                       J                    M,
                                       J                    N,
                                       I&                   nnz,
@@ -447,9 +539,9 @@ void rocsparse_init_csr_pentadiagonal(std::vector<I>&      row_ptr,
 /* ==================================================================================== */
 /*! \brief  Generate a penta diagonal sparse matrix in GEBSR format */
 template <typename I, typename J, typename T>
-void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
-                                        std::vector<J>&      col_ind,
-                                        std::vector<T>&      val,
+void rocsparse_init_gebsr_pentadiagonal(host_vector<I>&      row_ptr,
+                                        host_vector<J>&      col_ind,
+                                        host_vector<T>&      val,
                                         J                    Mb,
                                         J                    Nb,
                                         I&                   nnzb,
@@ -461,4 +553,98 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                         J                    u,
                                         J                    uu);
 
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of an R-MAT graph in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_rmat(host_vector<I>&      row_ind,
+                             host_vector<I>&      col_ind,
+                             host_vector<T>&      val,
+                             I                    M,
+                             I                    N,
+                             int64_t&             nnz,
+                             rocsparse_index_base base,
+                             double               a,
+                             I                    avg_degree,
+                             bool                 symmetrize,
+                             bool                 to_int);
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of an R-MAT graph in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rmat(host_vector<I>&      row_ptr,
+                             host_vector<J>&      col_ind,
+                             host_vector<T>&      val,
+                             J                    M,
+                             J                    N,
+                             I&                   nnz,
+                             rocsparse_index_base base,
+                             double               a,
+                             J                    avg_degree,
+                             bool                 symmetrize,
+                             bool                 to_int);
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of an R-MAT graph in GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_rmat(host_vector<I>&      row_ptr,
+                               host_vector<J>&      col_ind,
+                               host_vector<T>&      val,
+                               J                    Mb,
+                               J                    Nb,
+                               I&                   nnzb,
+                               J                    row_block_dim,
+                               J                    col_block_dim,
+                               rocsparse_index_base base,
+                               double               a,
+                               J                    avg_degree,
+                               bool                 symmetrize,
+                               bool                 to_int);
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of a power-law graph in COO format */
+template <typename I, typename T>
+void rocsparse_init_coo_powerlaw(host_vector<I>&      row_ind,
+                                 host_vector<I>&      col_ind,
+                                 host_vector<T>&      val,
+                                 I                    M,
+                                 I                    N,
+                                 int64_t&             nnz,
+                                 rocsparse_index_base base,
+                                 double               gamma,
+                                 I                    avg_degree,
+                                 bool                 symmetrize,
+                                 bool                 to_int);
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of a power-law graph in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_powerlaw(host_vector<I>&      row_ptr,
+                                 host_vector<J>&      col_ind,
+                                 host_vector<T>&      val,
+                                 J                    M,
+                                 J                    N,
+                                 I&                   nnz,
+                                 rocsparse_index_base base,
+                                 double               gamma,
+                                 J                    avg_degree,
+                                 bool                 symmetrize,
+                                 bool                 to_int);
+
+/* ==================================================================================== */
+/*! \brief  Generate a sparse matrix with the pattern of a power-law graph in GEBSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_gebsr_powerlaw(host_vector<I>&      row_ptr,
+                                   host_vector<J>&      col_ind,
+                                   host_vector<T>&      val,
+                                   J                    Mb,
+                                   J                    Nb,
+                                   I&                   nnzb,
+                                   J                    row_block_dim,
+                                   J                    col_block_dim,
+                                   rocsparse_index_base base,
+                                   double               gamma,
+                                   J                    avg_degree,
+                                   bool                 symmetrize,
+                                   bool                 to_int);
+
 #endif // ROCSPARSE_INIT_HPP
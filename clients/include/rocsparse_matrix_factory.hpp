@@ -31,11 +31,15 @@
 
 std::string rocsparse_exepath();
 
+#include "rocsparse_matrix_factory_cache.hpp"
 #include "rocsparse_matrix_factory_file.hpp"
 #include "rocsparse_matrix_factory_laplace2d.hpp"
 #include "rocsparse_matrix_factory_laplace3d.hpp"
 #include "rocsparse_matrix_factory_pentadiagonal.hpp"
+#include "rocsparse_matrix_factory_powerlaw.hpp"
 #include "rocsparse_matrix_factory_random.hpp"
+#include "rocsparse_matrix_factory_rmat.hpp"
+#include "rocsparse_matrix_factory_stencil3d.hpp"
 #include "rocsparse_matrix_factory_tridiagonal.hpp"
 #include "rocsparse_matrix_factory_zero.hpp"
 
@@ -63,9 +67,9 @@ public:
                                       bool             full_rank = false,
                                       bool             noseed    = false);
 
-    virtual void init_csr(std::vector<I>&        csr_row_ptr,
-                          std::vector<J>&        csr_col_ind,
-                          std::vector<T>&        csr_val,
+    virtual void init_csr(host_vector<I>&        csr_row_ptr,
+                          host_vector<J>&        csr_col_ind,
+                          host_vector<T>&        csr_val,
                           J&                     m,
                           J&                     n,
                           I&                     nnz,
@@ -78,9 +82,9 @@ public:
             csr_row_ptr, csr_col_ind, csr_val, m, n, nnz, base, matrix_type, uplo, storage);
     }
 
-    virtual void init_gebsr(std::vector<I>&        bsr_row_ptr,
-                            std::vector<J>&        bsr_col_ind,
-                            std::vector<T>&        bsr_val,
+    virtual void init_gebsr(host_vector<I>&        bsr_row_ptr,
+                            host_vector<J>&        bsr_col_ind,
+                            host_vector<T>&        bsr_val,
                             rocsparse_direction    dirb,
                             J&                     mb,
                             J&                     nb,
@@ -107,9 +111,9 @@ public:
                                             storage);
     }
 
-    virtual void init_coo(std::vector<I>&        coo_row_ind,
-                          std::vector<I>&        coo_col_ind,
-                          std::vector<T>&        coo_val,
+    virtual void init_coo(host_vector<I>&        coo_row_ind,
+                          host_vector<I>&        coo_col_ind,
+                          host_vector<T>&        coo_val,
                           I&                     m,
                           I&                     n,
                           int64_t&               nnz,
@@ -125,9 +129,9 @@ public:
     //
     // COO
     //
-    void init_coo(std::vector<I>&      coo_row_ind,
-                  std::vector<I>&      coo_col_ind,
-                  std::vector<T>&      coo_val,
+    void init_coo(host_vector<I>&      coo_row_ind,
+                  host_vector<I>&      coo_col_ind,
+                  host_vector<T>&      coo_val,
                   I&                   m,
                   I&                   n,
                   int64_t&             nnz,
@@ -140,9 +144,9 @@ public:
     //
     // CSR
     //
-    void init_csr(std::vector<I>&      csr_row_ptr,
-                  std::vector<J>&      csr_col_ind,
-                  std::vector<T>&      csr_val,
+    void init_csr(host_vector<I>&      csr_row_ptr,
+                  host_vector<J>&      csr_col_ind,
+                  host_vector<T>&      csr_val,
                   J&                   m,
                   J&                   n,
                   I&                   nnz,
@@ -155,9 +159,9 @@ public:
     //
     // CSC
     //
-    void init_csc(std::vector<I>&      csc_col_ptr,
-                  std::vector<J>&      csc_row_ind,
-                  std::vector<T>&      csc_val,
+    void init_csc(host_vector<I>&      csc_col_ptr,
+                  host_vector<J>&      csc_row_ind,
+                  host_vector<T>&      csc_val,
                   J&                   m,
                   J&                   n,
                   I&                   nnz,
@@ -168,9 +172,9 @@ public:
     //
     // GEBSR
     //
-    void init_gebsr(std::vector<I>&      bsr_row_ptr,
-                    std::vector<J>&      bsr_col_ind,
-                    std::vector<T>&      bsr_val,
+    void init_gebsr(host_vector<I>&      bsr_row_ptr,
+                    host_vector<J>&      bsr_col_ind,
+                    host_vector<T>&      bsr_val,
                     rocsparse_direction  dirb,
                     J&                   mb,
                     J&                   nb,
@@ -199,9 +203,9 @@ public:
 
     void init_gebsr_spezial(host_gebsr_matrix<T, I, J>& that, J& mb, J& nb);
 
-    void init_gebsc(std::vector<I>&      bsc_col_ptr,
-                    std::vector<J>&      bsc_row_ind,
-                    std::vector<T>&      bsc_val,
+    void init_gebsc(host_vector<I>&      bsc_col_ptr,
+                    host_vector<J>&      bsc_row_ind,
+                    host_vector<T>&      bsc_val,
                     rocsparse_direction  dirb,
                     J&                   Mb,
                     J&                   Nb,
@@ -213,9 +217,9 @@ public:
     //
     // BSR
     //
-    void init_bsr(std::vector<I>&      bsr_row_ptr,
-                  std::vector<J>&      bsr_col_ind,
-                  std::vector<T>&      bsr_val,
+    void init_bsr(host_vector<I>&      bsr_row_ptr,
+                  host_vector<J>&      bsr_col_ind,
+                  host_vector<T>&      bsr_val,
                   rocsparse_direction  dirb,
                   J&                   mb,
                   J&                   nb,
@@ -250,9 +254,9 @@ public:
 
 template <typename T>
 inline void rocsparse_init_gebsr_matrix_from_csr(rocsparse_matrix_factory<T>& matrix_factory,
-                                                 std::vector<rocsparse_int>&  bsr_row_ptr,
-                                                 std::vector<rocsparse_int>&  bsr_col_ind,
-                                                 std::vector<T>&              bsr_val,
+                                                 host_vector<rocsparse_int>&  bsr_row_ptr,
+                                                 host_vector<rocsparse_int>&  bsr_col_ind,
+                                                 host_vector<T>&              bsr_val,
                                                  rocsparse_direction          direction,
                                                  rocsparse_int&               mb,
                                                  rocsparse_int&               nb,
@@ -262,7 +266,7 @@ inline void rocsparse_init_gebsr_matrix_from_csr(rocsparse_matrix_factory<T>& ma
                                                  rocsparse_index_base         bsr_base)
 {
     // Uncompressed CSR matrix on host
-    std::vector<T> hcsr_val_A;
+    host_vector<T> hcsr_val_A;
 
     // Generate uncompressed CSR matrix on host (or read from file)
     matrix_factory.init_csr(bsr_row_ptr, bsr_col_ind, hcsr_val_A, mb, nb, nnzb, bsr_base);
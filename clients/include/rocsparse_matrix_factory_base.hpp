@@ -27,7 +27,8 @@
 #define ROCSPARSE_MATRIX_FACTORY_BASE_HPP
 
 #include "rocsparse.hpp"
-#include <vector>
+#include "rocsparse_check.hpp"
+#include "rocsparse_vector.hpp"
 template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
 struct rocsparse_matrix_factory_base
 {
@@ -47,9 +48,9 @@ public:
     // @param[in] base base of indices.
     // @param[in] matrix_type what type of matrix to generate.
     // @param[in] uplo fill mode of matrix.
-    virtual void init_csr(std::vector<I>&        csr_row_ptr,
-                          std::vector<J>&        csr_col_ind,
-                          std::vector<T>&        csr_val,
+    virtual void init_csr(host_vector<I>&        csr_row_ptr,
+                          host_vector<J>&        csr_col_ind,
+                          host_vector<T>&        csr_val,
                           J&                     M,
                           J&                     N,
                           I&                     nnz,
@@ -70,9 +71,9 @@ public:
     // @param[inout] row_block_dim row dimension of the blocks.
     // @param[inout] col_block_dim column dimension of the blocks.
     // @param[in] base base of indices.
-    virtual void init_gebsr(std::vector<I>&        bsr_row_ptr,
-                            std::vector<J>&        bsr_col_ind,
-                            std::vector<T>&        bsr_val,
+    virtual void init_gebsr(host_vector<I>&        bsr_row_ptr,
+                            host_vector<J>&        bsr_col_ind,
+                            host_vector<T>&        bsr_val,
                             rocsparse_direction    dirb,
                             J&                     Mb,
                             J&                     Nb,
@@ -93,9 +94,9 @@ public:
     // @param[inout] N number of columns.
     // @param[inout] nnz number of non-zeros.
     // @param[in] base base of indices.
-    virtual void init_coo(std::vector<I>&        coo_row_ind,
-                          std::vector<I>&        coo_col_ind,
-                          std::vector<T>&        coo_val,
+    virtual void init_coo(host_vector<I>&        coo_row_ind,
+                          host_vector<I>&        coo_col_ind,
+                          host_vector<T>&        coo_val,
                           I&                     M,
                           I&                     N,
                           int64_t&               nnz,
@@ -0,0 +1,118 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef ROCSPARSE_MATRIX_FACTORY_CACHE_HPP
+#define ROCSPARSE_MATRIX_FACTORY_CACHE_HPP
+
+#include "rocsparse_matrix_factory_base.hpp"
+#include <string>
+
+//
+// @brief Factory caching the host matrices of another factory.
+// @details
+//
+// Matrices are kept in a cache shared by all the factories of the process, keyed by the
+// parameters of the factory and of the init call. Since random matrices depend on the state of
+// the random number generators, the states before and after the generation are stored with
+// the matrix: a matrix is only reused from the same state, which is then advanced as if the
+// matrix had been generated again.
+//
+// The capacity of the cache is given in megabytes by the environment variable
+// ROCSPARSE_CLIENTS_MATRIX_CACHE_SIZE, 0 disables the cache. It defaults to 1024 for
+// rocsparse-test and to 0 for the other clients. Matrices larger than an eighth of the
+// capacity are not cached, the least recently used matrices are evicted first.
+//
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+struct rocsparse_matrix_factory_cache : public rocsparse_matrix_factory_base<T, I, J>
+{
+private:
+    rocsparse_matrix_factory_base<T, I, J>* m_instance;
+    std::string                             m_key;
+
+public:
+    //
+    // @brief The cache takes the ownership of the instance.
+    // @param[in] instance factory generating the matrices.
+    // @param[in] key parameters identifying the matrices of the instance.
+    //
+    rocsparse_matrix_factory_cache(rocsparse_matrix_factory_base<T, I, J>* instance,
+                                   const std::string&                      key);
+    virtual ~rocsparse_matrix_factory_cache();
+
+    rocsparse_matrix_factory_cache(const rocsparse_matrix_factory_cache& that) = delete;
+    rocsparse_matrix_factory_cache& operator=(const rocsparse_matrix_factory_cache& that) = delete;
+
+    //
+    // @brief Is the cache enabled?
+    //
+    static bool is_enabled();
+
+    //
+    // @brief Number of init calls given a matrix of the cache, counted for the whole process.
+    //
+    static size_t hits();
+
+    //
+    // @brief Number of init calls generating the matrix, counted for the whole process.
+    //
+    static size_t misses();
+
+    virtual void init_csr(host_vector<I>&        csr_row_ptr,
+                          host_vector<J>&        csr_col_ind,
+                          host_vector<T>&        csr_val,
+                          J&                     M,
+                          J&                     N,
+                          I&                     nnz,
+                          rocsparse_index_base   base,
+                          rocsparse_matrix_type  matrix_type,
+                          rocsparse_fill_mode    uplo,
+                          rocsparse_storage_mode storage) override;
+
+    virtual void init_gebsr(host_vector<I>&        bsr_row_ptr,
+                            host_vector<J>&        bsr_col_ind,
+                            host_vector<T>&        bsr_val,
+                            rocsparse_direction    dirb,
+                            J&                     Mb,
+                            J&                     Nb,
+                            I&                     nnzb,
+                            J&                     row_block_dim,
+                            J&                     col_block_dim,
+                            rocsparse_index_base   base,
+                            rocsparse_matrix_type  matrix_type,
+                            rocsparse_fill_mode    uplo,
+                            rocsparse_storage_mode storage) override;
+
+    virtual void init_coo(host_vector<I>&        coo_row_ind,
+                          host_vector<I>&        coo_col_ind,
+                          host_vector<T>&        coo_val,
+                          I&                     M,
+                          I&                     N,
+                          int64_t&               nnz,
+                          rocsparse_index_base   base,
+                          rocsparse_matrix_type  matrix_type,
+                          rocsparse_fill_mode    uplo,
+                          rocsparse_storage_mode storage) override;
+};
+
+#endif // ROCSPARSE_MATRIX_FACTORY_CACHE_HPP
@@ -42,9 +42,9 @@ private:
 public:
     explicit rocsparse_matrix_factory_file(const char* filename, bool toint = false);
 
-    virtual void init_gebsr(std::vector<I>&        bsr_row_ptr,
-                            std::vector<J>&        bsr_col_ind,
-                            std::vector<T>&        bsr_val,
+    virtual void init_gebsr(host_vector<I>&        bsr_row_ptr,
+                            host_vector<J>&        bsr_col_ind,
+                            host_vector<T>&        bsr_val,
                             rocsparse_direction    dirb,
                             J&                     Mb,
                             J&                     Nb,
@@ -56,9 +56,9 @@ public:
                             rocsparse_fill_mode    uplo,
                             rocsparse_storage_mode storage) override;
 
-    virtual void init_csr(std::vector<I>&        csr_row_ptr,
-                          std::vector<J>&        csr_col_ind,
-                          std::vector<T>&        csr_val,
+    virtual void init_csr(host_vector<I>&        csr_row_ptr,
+                          host_vector<J>&        csr_col_ind,
+                          host_vector<T>&        csr_val,
                           J&                     M,
                           J&                     N,
                           I&                     nnz,
@@ -67,9 +67,9 @@ public:
                           rocsparse_fill_mode    uplo,
                           rocsparse_storage_mode storage) override;
 
-    virtual void init_coo(std::vector<I>&        coo_row_ind,
-                          std::vector<I>&        coo_col_ind,
-                          std::vector<T>&        coo_val,
+    virtual void init_coo(host_vector<I>&        coo_row_ind,
+                          host_vector<I>&        coo_col_ind,
+                          host_vector<T>&        coo_val,
                           I&                     M,
                           I&                     N,
                           int64_t&               nnz,
@@ -91,4 +91,8 @@ template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
 using rocsparse_matrix_factory_rocsparseio
     = rocsparse_matrix_factory_file<rocsparse_matrix_file_rocsparseio, T, I, J>;
 
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+using rocsparse_matrix_factory_chunked
+    = rocsparse_matrix_factory_file<rocsparse_matrix_file_chunked, T, I, J>;
+
 #endif // ROCSPARSE_MATRIX_FACTORY_FILE_HPP
@@ -37,9 +37,9 @@ private:
 public:
     rocsparse_matrix_factory_laplace2d(J dimx, J dimy);
 
-    virtual void init_csr(std::vector<I>&        csr_row_ptr,
-                          std::vector<J>&        csr_col_ind,
-                          std::vector<T>&        csr_val,
+    virtual void init_csr(host_vector<I>&        csr_row_ptr,
+                          host_vector<J>&        csr_col_ind,
+                          host_vector<T>&        csr_val,
                           J&                     M,
                           J&                     N,
                           I&                     nnz,
@@ -48,9 +48,9 @@ public:
                           rocsparse_fill_mode    uplo,
                           rocsparse_storage_mode storage) override;
 
-    virtual void init_coo(std::vector<I>&        coo_row_ind,
-                          std::vector<I>&        coo_col_ind,
-                          std::vector<T>&        coo_val,
+    virtual void init_coo(host_vector<I>&        coo_row_ind,
+                          host_vector<I>&        coo_col_ind,
+                          host_vector<T>&        coo_val,
                           I&                     M,
                           I&                     N,
                           int64_t&               nnz,
@@ -59,9 +59,9 @@ public:
                           rocsparse_fill_mode    uplo,
                           rocsparse_storage_mode storage) override;
 
-    virtual void init_gebsr(std::vector<I>&        bsr_row_ptr,
-                            std::vector<J>&        bsr_col_ind,
-                            std::vector<T>&        bsr_val,
+    virtual void init_gebsr(host_vector<I>&        bsr_row_ptr,
+                            host_vector<J>&        bsr_col_ind,
+                            host_vector<T>&        bsr_val,
                             rocsparse_direction    dirb,
                             J&                     Mb,
                             J&                     Nb,
@@ -0,0 +1,143 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_MATRIX_FEATURES_HPP
+#define ROCSPARSE_MATRIX_FEATURES_HPP
+
+#include <rocsparse.h>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+//
+// @brief Sparsity features of a CSR matrix, used to model the performance of the kernels.
+// @details
+// The features are computed on the host, loops over rows are distributed with OpenMP when
+// available, and no device is required. Only the level-set analysis of the triangular parts
+// is sequential, since each row depends on the levels of the previous ones.
+//
+struct rocsparse_matrix_features
+{
+    //
+    // Square block dimensions whose BSR fill ratio is computed.
+    //
+    static constexpr int s_nblock_dims               = 4;
+    static constexpr int s_block_dims[s_nblock_dims] = {2, 4, 8, 16};
+
+    //
+    // Number of power of two buckets of the row length histogram.
+    //
+    static constexpr int s_nbuckets = 32;
+
+    std::string name{};
+
+    int64_t m{};
+    int64_t n{};
+    int64_t nnz{};
+
+    //
+    // Row length distribution, the histogram bucket 0 counts the empty rows and the bucket k
+    // counts the rows of length in [2^(k-1), 2^k).
+    //
+    int64_t              row_nnz_min{};
+    int64_t              row_nnz_max{};
+    double               row_nnz_mean{};
+    double               row_nnz_stddev{};
+    int64_t              row_nnz_p50{};
+    int64_t              row_nnz_p90{};
+    int64_t              row_nnz_p99{};
+    int64_t              empty_rows{};
+    std::vector<int64_t> row_nnz_histogram{};
+
+    //
+    // Bandwidth, the largest distance of an entry to the diagonal below and above, and profile,
+    // the number of entries in the lower envelope of the matrix.
+    //
+    int64_t lower_bandwidth{};
+    int64_t upper_bandwidth{};
+    int64_t profile{};
+
+    //
+    // Diagonal, the fraction of the rows such that |a_ii| >= sum_{j != i} |a_ij|, and the
+    // smallest ratio |a_ii| / sum_{j != i} |a_ij| over the rows with off-diagonal entries.
+    //
+    int64_t missing_diagonal{};
+    double  diagonal_dominance{};
+    double  diagonal_dominance_min{};
+
+    //
+    // Number of non-zero blocks and fill ratio nnz / (nnzb * dim * dim) of the BSR format.
+    //
+    int64_t bsr_nnzb[s_nblock_dims]{};
+    double  bsr_fill[s_nblock_dims]{};
+
+    //
+    // Padding overhead (stored - nnz) / nnz of the ELL format, and of the ELL part of the HYB
+    // format with the automatic partition, together with the fraction of entries in its COO part.
+    //
+    double  ell_padding{};
+    int64_t hyb_ell_width{};
+    double  hyb_ell_padding{};
+    double  hyb_coo_fraction{};
+
+    //
+    // Depth (number of levels) and width (largest level) of the dependency graph of the
+    // triangular solves with the lower and upper parts.
+    //
+    int64_t lower_dag_depth{};
+    int64_t lower_dag_width{};
+    int64_t upper_dag_depth{};
+    int64_t upper_dag_width{};
+
+    //
+    // @brief Compute the features of a CSR matrix.
+    //
+    template <typename T, typename I, typename J>
+    void compute(J                    m,
+                 J                    n,
+                 I                    nnz,
+                 const I*             csr_row_ptr,
+                 const J*             csr_col_ind,
+                 const T*             csr_val,
+                 rocsparse_index_base base);
+
+    //
+    // @brief Write the CSV header, one column per scalar feature.
+    //
+    static void write_csv_header(std::ostream& out);
+
+    //
+    // @brief Write the scalar features as a CSV line.
+    //
+    void write_csv(std::ostream& out) const;
+
+    //
+    // @brief Write all features as a JSON object.
+    //
+    void write_json(std::ostream& out) const;
+};
+
+#endif // ROCSPARSE_MATRIX_FEATURES_HPP
@@ -28,6 +28,8 @@
 
 #include "rocsparse_math.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <random>
 #include <type_traits>
 
@@ -65,6 +67,42 @@ inline void rocsparse_seedrand()
     rocsparse_rand_normal_double_idx  = 0;
 }
 
+// State of the random number generators, captured at construction.
+struct rocsparse_rng_state
+{
+    rocsparse_rng_t rng;
+    rocsparse_rng_t rng_nan;
+    int             uniform_float_idx;
+    int             uniform_double_idx;
+    int             normal_double_idx;
+
+    rocsparse_rng_state()
+        : rng(rocsparse_rng_get())
+        , rng_nan(rocsparse_rng_nan_get())
+        , uniform_float_idx(rocsparse_rand_uniform_float_idx)
+        , uniform_double_idx(rocsparse_rand_uniform_double_idx)
+        , normal_double_idx(rocsparse_rand_normal_double_idx)
+    {
+    }
+
+    void restore() const
+    {
+        rocsparse_rng_set(this->rng);
+        rocsparse_rng_nan_set(this->rng_nan);
+        rocsparse_rand_uniform_float_idx  = this->uniform_float_idx;
+        rocsparse_rand_uniform_double_idx = this->uniform_double_idx;
+        rocsparse_rand_normal_double_idx  = this->normal_double_idx;
+    }
+
+    bool operator==(const rocsparse_rng_state& that) const
+    {
+        return this->uniform_float_idx == that.uniform_float_idx
+               && this->uniform_double_idx == that.uniform_double_idx
+               && this->normal_double_idx == that.normal_double_idx && this->rng == that.rng
+               && this->rng_nan == that.rng_nan;
+    }
+};
+
 int    rocsparse_uniform_int(int a, int b);
 float  rocsparse_uniform_float(float a, float b);
 double rocsparse_uniform_double(double a, double b);
@@ -271,4 +309,151 @@ inline T random_cached_generator_normal()
     return static_cast<T>(rocsparse_normal_double());
 }
 
+/* ==================================================================================== */
+/*! \brief  Counter-based random number generator.
+ *  \details
+ *  Philox4x32-10, the random numbers only depend on the seed and on their address (stream, k),
+ *  so they can be drawn in any order and by any number of threads. Independent sequences of the
+ *  same addresses are selected with the argument draw.
+ */
+class rocsparse_philox
+{
+    uint64_t m_seed;
+
+    static inline void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo)
+    {
+        const uint64_t p = static_cast<uint64_t>(a) * b;
+        hi               = static_cast<uint32_t>(p >> 32);
+        lo               = static_cast<uint32_t>(p);
+    }
+
+public:
+    explicit rocsparse_philox(uint64_t seed)
+        : m_seed(seed)
+    {
+    }
+
+    /*! \brief  Philox4x32-10 block of the counter ctr with the key key. */
+    static inline void block(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+    {
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+        uint32_t c0 = ctr[0];
+        uint32_t c1 = ctr[1];
+        uint32_t c2 = ctr[2];
+        uint32_t c3 = ctr[3];
+        for(int round = 0; round < 10; ++round)
+        {
+            uint32_t hi0, lo0, hi1, lo1;
+            mulhilo(0xD2511F53U, c0, hi0, lo0);
+            mulhilo(0xCD9E8D57U, c2, hi1, lo1);
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+            k0 += 0x9E3779B9U;
+            k1 += 0xBB67AE85U;
+        }
+        out[0] = c0;
+        out[1] = c1;
+        out[2] = c2;
+        out[3] = c3;
+    }
+
+    /*! \brief  128 random bits of the address (stream, k). */
+    inline void generate(uint64_t stream, uint64_t k, uint32_t draw, uint32_t out[4]) const
+    {
+        const uint64_t key     = this->m_seed + 0x9E3779B97F4A7C15ULL * (uint64_t(draw) + 1);
+        const uint32_t ckey[2] = {static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)};
+        const uint32_t ctr[4]  = {static_cast<uint32_t>(k),
+                                 static_cast<uint32_t>(k >> 32),
+                                 static_cast<uint32_t>(stream),
+                                 static_cast<uint32_t>(stream >> 32)};
+        block(ctr, ckey, out);
+    }
+
+    /*! \brief  Uniform double in [0, 1). */
+    inline double uniform01(uint64_t stream, uint64_t k, uint32_t draw = 0) const
+    {
+        uint32_t r[4];
+        this->generate(stream, k, draw, r);
+        const uint64_t bits = ((static_cast<uint64_t>(r[0]) << 32) | r[1]) >> 11;
+        return static_cast<double>(bits) * (1.0 / 9007199254740992.0);
+    }
+
+    /*! \brief  Uniform integer in [a, b]. */
+    template <typename I>
+    inline I uniform_int(uint64_t stream, uint64_t k, I a, I b, uint32_t draw = 0) const
+    {
+        const double range = static_cast<double>(b) - static_cast<double>(a) + 1.0;
+        const I      i     = a + static_cast<I>(this->uniform01(stream, k, draw) * range);
+        return std::min(i, b);
+    }
+};
+
+/*! \brief  generate the random number of the stream in range [a,b] using integer numbers*/
+template <typename T>
+inline T random_philox_generator_exact(
+    const rocsparse_philox& rng, uint64_t stream, uint32_t draw, int a = 1, int b = 10)
+{
+    return static_cast<T>(rng.uniform_int<int>(stream, 0, a, b, draw));
+}
+
+template <>
+inline rocsparse_float_complex random_philox_generator_exact<rocsparse_float_complex>(
+    const rocsparse_philox& rng, uint64_t stream, uint32_t draw, int a, int b)
+{
+    return rocsparse_float_complex(static_cast<float>(rng.uniform_int<int>(stream, 0, a, b, draw)),
+                                   static_cast<float>(rng.uniform_int<int>(stream, 1, a, b, draw)));
+}
+
+template <>
+inline rocsparse_double_complex random_philox_generator_exact<rocsparse_double_complex>(
+    const rocsparse_philox& rng, uint64_t stream, uint32_t draw, int a, int b)
+{
+    return rocsparse_double_complex(
+        static_cast<double>(rng.uniform_int<int>(stream, 0, a, b, draw)),
+        static_cast<double>(rng.uniform_int<int>(stream, 1, a, b, draw)));
+}
+
+/*! \brief  generate the random number of the stream in range [a,b]*/
+template <typename T>
+inline T random_philox_generator(const rocsparse_philox& rng,
+                                 uint64_t                stream,
+                                 uint32_t                draw,
+                                 T                       a = static_cast<T>(0),
+                                 T                       b = static_cast<T>(1))
+{
+    return static_cast<T>(a + rng.uniform01(stream, 0, draw) * (b - a));
+}
+
+template <>
+inline rocsparse_float_complex
+    random_philox_generator<rocsparse_float_complex>(const rocsparse_philox& rng,
+                                                     uint64_t                stream,
+                                                     uint32_t                draw,
+                                                     rocsparse_float_complex a,
+                                                     rocsparse_float_complex b)
+{
+    float theta = static_cast<float>(rng.uniform01(stream, 0, draw) * 2.0 * acos(-1.0));
+    float r     = std::abs(a)
+              + static_cast<float>(rng.uniform01(stream, 1, draw)) * (std::abs(b) - std::abs(a));
+
+    return rocsparse_float_complex(r * cos(theta), r * sin(theta));
+}
+
+template <>
+inline rocsparse_double_complex
+    random_philox_generator<rocsparse_double_complex>(const rocsparse_philox&  rng,
+                                                      uint64_t                 stream,
+                                                      uint32_t                 draw,
+                                                      rocsparse_double_complex a,
+                                                      rocsparse_double_complex b)
+{
+    double theta = rng.uniform01(stream, 0, draw) * 2.0 * acos(-1.0);
+    double r     = std::abs(a) + rng.uniform01(stream, 1, draw) * (std::abs(b) - std::abs(a));
+
+    return rocsparse_double_complex(r * cos(theta), r * sin(theta));
+}
+
 #endif // ROCSPARSE_RANDOM_HPP
@@ -158,7 +158,7 @@ public:
         CHECK_HIP_THROW_ERROR(err);
     }
 
-    void transfer_to(std::vector<T>& that) const;
+    void transfer_to(host_vector<T>& that) const;
     void transfer_from(const host_vector<T>& that);
     void unit_check(const host_vector<T>& that_) const;
     void near_check(const host_vector<T>& that_,
@@ -166,10 +166,10 @@ public:
 };
 
 template <typename T>
-struct host_vector : std::vector<T>
+struct host_vector : std::vector<T, rocsparse_host_memory_allocator<T>>
 {
     // Inherit constructors
-    using std::vector<T>::vector;
+    using std::vector<T, rocsparse_host_memory_allocator<T>>::vector;
 
     // Decay into pointer wherever pointer is expected
     operator T*()
@@ -442,7 +442,7 @@ void dense_vector_t<MODE, T>::transfer_from(const host_vector<T>& that)
 }
 
 template <memory_mode::value_t MODE, typename T>
-void dense_vector_t<MODE, T>::transfer_to(std::vector<T>& that) const
+void dense_vector_t<MODE, T>::transfer_to(host_vector<T>& that) const
 {
     that.resize(this->m_size);
     CHECK_HIP_THROW_ERROR(hipMemcpy(that.data(),
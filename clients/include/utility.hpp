@@ -726,4 +726,8 @@ double get_time_us_sync(hipStream_t stream);
 // Return path of this executable
 std::string rocsparse_exepath();
 
+/* ==================================================================================== */
+// Return the name of a new temporary file
+std::string rocsparse_temp_filename();
+
 #endif // UTILITY_HPP
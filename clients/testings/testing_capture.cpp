@@ -0,0 +1,330 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_capture_reader.hpp"
+#include "testing.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Value of a configuration entry, empty if it cannot be read
+static std::string get_config(const char* name)
+{
+    size_t value_size = 0;
+    if(rocsparse_get_config(name, &value_size, nullptr) != rocsparse_status_success
+       || value_size == 0)
+    {
+        return std::string();
+    }
+
+    std::string value(value_size, '\0');
+    if(rocsparse_get_config(name, &value_size, &value[0]) != rocsparse_status_success)
+    {
+        return std::string();
+    }
+    value.resize(value_size - 1);
+
+    return value;
+}
+
+// Handle created with capture enabled, the configuration is restored afterwards
+static void create_capture_handle(rocsparse_handle* handle)
+{
+    const std::string layer = get_config("LAYER");
+    const int         mode  = std::atoi(layer.c_str());
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_config(
+        "LAYER", std::to_string(mode | rocsparse_layer_mode_capture).c_str()));
+    CHECK_ROCSPARSE_ERROR(rocsparse_create_handle(handle));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_config("LAYER", layer.c_str()));
+}
+
+template <typename T>
+void testing_capture_bad_arg(const Arguments& arg)
+{
+    rocsparse_handle handle;
+    create_capture_handle(&handle);
+
+    T      alpha = static_cast<T>(1);
+    T      beta  = static_cast<T>(0);
+    size_t buffer_size;
+
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    rocsparse_local_spmat A(100,
+                            100,
+                            100,
+                            (void*)0x4,
+                            (void*)0x4,
+                            (void*)0x4,
+                            rocsparse_indextype_i32,
+                            rocsparse_indextype_i32,
+                            rocsparse_index_base_zero,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_dnvec x(100, (void*)0x4, ttype);
+    rocsparse_local_dnvec y(100, (void*)0x4, ttype);
+
+    // Capturing does not change the outcome of invalid calls
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(handle,
+                                           rocsparse_operation_none,
+                                           nullptr,
+                                           A,
+                                           x,
+                                           &beta,
+                                           y,
+                                           ttype,
+                                           rocsparse_spmv_alg_default,
+                                           rocsparse_spmv_stage_compute,
+                                           &buffer_size,
+                                           (void*)0x4),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(handle,
+                                           rocsparse_operation_none,
+                                           &alpha,
+                                           A,
+                                           nullptr,
+                                           &beta,
+                                           y,
+                                           ttype,
+                                           rocsparse_spmv_alg_default,
+                                           rocsparse_spmv_stage_compute,
+                                           &buffer_size,
+                                           (void*)0x4),
+                            rocsparse_status_invalid_pointer);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(handle));
+}
+
+template <typename T>
+void testing_capture(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        N    = arg.N;
+    rocsparse_index_base base = rocsparse_index_base_zero;
+
+    T halpha = static_cast<T>(2);
+    T hbeta  = static_cast<T>(1);
+
+    rocsparse_indextype itype = get_indextype<rocsparse_int>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    rocsparse_handle handle;
+    create_capture_handle(&handle);
+
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    host_vector<T> hx(N);
+    host_vector<T> hy(M);
+    rocsparse_init<T>(hx, 1, N, 1);
+    rocsparse_init<T>(hy, 1, M, 1);
+
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<T>             dx(N);
+    device_vector<T>             dy(M);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * M, hipMemcpyHostToDevice));
+
+    rocsparse_local_spmat A(M,
+                            N,
+                            nnz,
+                            dcsr_row_ptr,
+                            dcsr_col_ind,
+                            dcsr_val,
+                            itype,
+                            itype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_dnvec x(N, dx, ttype);
+    rocsparse_local_dnvec y(M, dy, ttype);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         rocsparse_operation_none,
+                                         &halpha,
+                                         A,
+                                         x,
+                                         &hbeta,
+                                         y,
+                                         ttype,
+                                         rocsparse_spmv_alg_default,
+                                         rocsparse_spmv_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         rocsparse_operation_none,
+                                         &halpha,
+                                         A,
+                                         x,
+                                         &hbeta,
+                                         y,
+                                         ttype,
+                                         rocsparse_spmv_alg_default,
+                                         rocsparse_spmv_stage_preprocess,
+                                         &buffer_size,
+                                         dbuffer));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         rocsparse_operation_none,
+                                         &halpha,
+                                         A,
+                                         x,
+                                         &hbeta,
+                                         y,
+                                         ttype,
+                                         rocsparse_spmv_alg_default,
+                                         rocsparse_spmv_stage_compute,
+                                         &buffer_size,
+                                         dbuffer));
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(handle));
+
+    // The directory is shared by all the captures of the process, our calls
+    // are the last calls of rocsparse_spmv
+    rocsparse_capture_reader reader;
+    ASSERT_EQ(reader.read(get_config("CAPTURE_PATH")), true);
+
+    size_t last = reader.calls.size();
+    while(last > 0 && reader.calls[last - 1].routine != "rocsparse_spmv")
+    {
+        --last;
+    }
+    ASSERT_GE(last, size_t(3));
+
+    const rocsparse_capture_reader::call_t& call = reader.calls[last - 1];
+    ASSERT_EQ(call.args.size(), size_t(11));
+    ASSERT_EQ(call.args[8], std::to_string(rocsparse_spmv_stage_compute));
+
+    // The scalars are recorded with their values
+    unsigned char bytes[16];
+    ASSERT_EQ(rocsparse_capture_reader::scalar(call.args[1], bytes), true);
+    ASSERT_EQ(std::memcmp(bytes, &halpha, sizeof(T)), 0);
+    ASSERT_EQ(rocsparse_capture_reader::scalar(call.args[4], bytes), true);
+    ASSERT_EQ(std::memcmp(bytes, &hbeta, sizeof(T)), 0);
+
+    // The other stages refer to the same operands if they are deduplicated
+    const rocsparse_spmv_stage stages[]    = {rocsparse_spmv_stage_buffer_size,
+                                              rocsparse_spmv_stage_preprocess};
+    const bool                 deduplicate = (get_config("CAPTURE_DEDUPLICATE") == "1");
+    for(size_t i = 0; i < 2; ++i)
+    {
+        const rocsparse_capture_reader::call_t& stage = reader.calls[last - 3 + i];
+        ASSERT_EQ(stage.routine, "rocsparse_spmv");
+        ASSERT_EQ(stage.args.size(), size_t(11));
+        ASSERT_EQ(stage.args[8], std::to_string(stages[i]));
+        if(deduplicate)
+        {
+            ASSERT_EQ(stage.args[2], call.args[2]);
+            ASSERT_EQ(stage.args[3], call.args[3]);
+            ASSERT_EQ(stage.args[5], call.args[5]);
+        }
+    }
+
+    // The calls of the other routines are recorded too
+    bool pointer_mode = false;
+    for(size_t i = 0; i < last; ++i)
+    {
+        pointer_mode |= (reader.calls[i].routine == "rocsparse_set_pointer_mode");
+    }
+    ASSERT_EQ(pointer_mode, true);
+
+    // The operands are defined with their descriptors
+    const rocsparse_capture_reader::operand_t* hA = reader.operand(call.args[2]);
+    const rocsparse_capture_reader::operand_t* hX = reader.operand(call.args[3]);
+    const rocsparse_capture_reader::operand_t* hY = reader.operand(call.args[5]);
+    ASSERT_NE(hA, nullptr);
+    ASSERT_NE(hX, nullptr);
+    ASSERT_NE(hY, nullptr);
+
+    ASSERT_EQ(hA->kind, "spmat");
+    ASSERT_EQ(hA->get("format"), rocsparse_format_csr);
+    ASSERT_EQ(hA->get("rows"), M);
+    ASSERT_EQ(hA->get("cols"), N);
+    ASSERT_EQ(hA->get("nnz"), nnz);
+    ASSERT_EQ(hA->get("data_type"), ttype);
+    ASSERT_EQ(hX->kind, "dnvec");
+    ASSERT_EQ(hX->get("size"), N);
+    ASSERT_EQ(hY->kind, "dnvec");
+    ASSERT_EQ(hY->get("size"), M);
+
+#ifdef ROCSPARSEIO
+    // The matrix is captured with its arrays
+    std::vector<std::vector<char>> values;
+    ASSERT_EQ(reader.read_values(*hA, 0, values), true);
+    ASSERT_EQ(values.size(), size_t(3));
+    ASSERT_EQ(values[0].size(), sizeof(rocsparse_int) * (M + 1));
+    ASSERT_EQ(values[1].size(), sizeof(rocsparse_int) * nnz);
+    ASSERT_EQ(values[2].size(), sizeof(T) * nnz);
+
+    unit_check_segments<rocsparse_int>(
+        M + 1, hcsr_row_ptr.data(), reinterpret_cast<const rocsparse_int*>(values[0].data()));
+    unit_check_segments<rocsparse_int>(
+        nnz, hcsr_col_ind.data(), reinterpret_cast<const rocsparse_int*>(values[1].data()));
+    unit_check_segments<T>(nnz, hcsr_val.data(), reinterpret_cast<const T*>(values[2].data()));
+
+    // The dense operands are captured with their values before the computation
+    if(get_config("CAPTURE_DENSE") == "1")
+    {
+        ASSERT_EQ(reader.read_values(*hX, 0, values), true);
+        ASSERT_EQ(values[0].size(), sizeof(T) * N);
+        unit_check_segments<T>(N, hx.data(), reinterpret_cast<const T*>(values[0].data()));
+
+        ASSERT_EQ(reader.read_values(*hY, 0, values), true);
+        ASSERT_EQ(values[0].size(), sizeof(T) * M);
+        unit_check_segments<T>(M, hy.data(), reinterpret_cast<const T*>(values[0].data()));
+    }
+#endif
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_capture_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_capture<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_capture_extra(const Arguments& arg) {}
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include <gtest/gtest-spi.h>
+
+//
+// Entry of real part re and imaginary part im, im is dropped for real types.
+//
+template <typename T>
+static T testing_check_arrays_entry(double re, double im);
+
+template <>
+float testing_check_arrays_entry(double re, double)
+{
+    return static_cast<float>(re);
+}
+
+template <>
+double testing_check_arrays_entry(double re, double)
+{
+    return re;
+}
+
+template <>
+rocsparse_float_complex testing_check_arrays_entry(double re, double im)
+{
+    return rocsparse_float_complex(static_cast<float>(re), static_cast<float>(im));
+}
+
+template <>
+rocsparse_double_complex testing_check_arrays_entry(double re, double im)
+{
+    return rocsparse_double_complex(re, im);
+}
+
+//
+// Whether unit_check, or near_check if near is set, fails on arrays of n
+// entries equal to a, except their entry i equal to ai and bi.
+//
+template <typename T>
+static bool testing_check_arrays_fails(bool near, int64_t n, int64_t i, T a, T ai, T bi)
+{
+    host_vector<T> A(n, a);
+    host_vector<T> B(n, a);
+    A[i] = ai;
+    B[i] = bi;
+
+    ::testing::TestPartResultArray failures;
+    {
+        ::testing::ScopedFakeTestPartResultReporter reporter(
+            ::testing::ScopedFakeTestPartResultReporter::INTERCEPT_ONLY_CURRENT_THREAD,
+            &failures);
+        if(near)
+        {
+            near_check_segments<T>(n, A.data(), B.data());
+        }
+        else
+        {
+            unit_check_segments<T>(n, A.data(), B.data());
+        }
+    }
+    return failures.size() > 0;
+}
+
+template <typename T>
+void testing_check_arrays_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_check_arrays(const Arguments& arg)
+{
+    using R = floating_data_t<T>;
+
+    const int64_t n       = arg.M;
+    const int64_t i       = n / 2;
+    const double  inf     = std::numeric_limits<double>::infinity();
+    const double  nan     = std::numeric_limits<double>::quiet_NaN();
+    const double  tol     = default_tolerance<T>::value;
+    const bool    complex = std::is_same<T, rocsparse_float_complex>()
+                         || std::is_same<T, rocsparse_double_complex>();
+
+    const T a = testing_check_arrays_entry<T>(1.5, -2.5);
+
+    const auto entry = [](double re, double im) { return testing_check_arrays_entry<T>(re, im); };
+    const auto scaled
+        = [&](double s) { return testing_check_arrays_entry<T>(1.5 * (1 + s), -2.5 * (1 + s)); };
+
+    for(int near = 0; near < 2; ++near)
+    {
+        // Equal arrays, equal NaN and infinite entries.
+        EXPECT_FALSE(testing_check_arrays_fails(near, n, i, a, a, a));
+        EXPECT_FALSE(testing_check_arrays_fails(near, n, i, a, entry(nan, 1), entry(nan, 1)));
+        EXPECT_FALSE(testing_check_arrays_fails(near, n, i, a, entry(inf, 1), entry(inf, 1)));
+
+        // A NaN entry only on one side.
+        EXPECT_TRUE(testing_check_arrays_fails(near, n, i, a, entry(nan, 1), a));
+        EXPECT_TRUE(testing_check_arrays_fails(near, n, i, a, a, entry(nan, 1)));
+
+        // An infinite entry only on one side.
+        EXPECT_TRUE(testing_check_arrays_fails(near, n, i, a, entry(inf, 1), a));
+        EXPECT_TRUE(testing_check_arrays_fails(near, n, i, a, a, entry(inf, 1)));
+    }
+
+    // unit_check allows a few units in the last place.
+    const R re    = std::real(a);
+    const R re3   = std::nextafter(std::nextafter(std::nextafter(re, R(2)), R(2)), R(2));
+    const R re100 = re + 100 * std::numeric_limits<R>::epsilon();
+    EXPECT_FALSE(testing_check_arrays_fails(false, n, i, a, a, entry(re3, -2.5)));
+    EXPECT_TRUE(testing_check_arrays_fails(false, n, i, a, a, entry(re100, -2.5)));
+
+    // near_check allows the tolerance, relaxed up to four times.
+    EXPECT_FALSE(testing_check_arrays_fails(true, n, i, a, a, scaled(0.5 * tol)));
+    EXPECT_FALSE(testing_check_arrays_fails(true, n, i, a, a, scaled(3 * tol)));
+    EXPECT_TRUE(testing_check_arrays_fails(true, n, i, a, a, scaled(8 * tol)));
+    EXPECT_TRUE(testing_check_arrays_fails(true, n, i, a, a, scaled(-8 * tol)));
+
+    if(complex)
+    {
+        //
+        // A complex entry with a NaN component is a NaN entry and its other
+        // component is not compared, the same holds for infinite entries in
+        // near_check.
+        //
+        for(int near = 0; near < 2; ++near)
+        {
+            EXPECT_FALSE(testing_check_arrays_fails(near, n, i, a, entry(0, nan), entry(1, nan)));
+            EXPECT_FALSE(testing_check_arrays_fails(near, n, i, a, entry(0, nan), entry(nan, 3)));
+            EXPECT_TRUE(testing_check_arrays_fails(near, n, i, a, entry(1, nan), entry(1, 2)));
+        }
+
+        EXPECT_FALSE(testing_check_arrays_fails(true, n, i, a, entry(0, inf), entry(1, inf)));
+        EXPECT_FALSE(testing_check_arrays_fails(true, n, i, a, entry(0, inf), entry(-inf, 1)));
+        EXPECT_TRUE(testing_check_arrays_fails(true, n, i, a, entry(0, inf), entry(0, 1)));
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                   \
+    template void testing_check_arrays_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_check_arrays<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_check_arrays_extra(const Arguments& arg) {}
@@ -0,0 +1,444 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <typename T>
+void testing_config_bad_arg(const Arguments& arg)
+{
+    size_t value_size = 0;
+    char   value[1];
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_config(nullptr, "0"), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_config("LAYER", nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_config(nullptr, &value_size, nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_config("LAYER", nullptr, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Unknown entry
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_config("NOT_AN_ENTRY", "0"),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_config("NOT_AN_ENTRY", &value_size, nullptr),
+                            rocsparse_status_invalid_value);
+
+    // Invalid values
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_config("LAYER", "one"), rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_config("POINTER_MODE", "managed"),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_config("HANDLE_BUFFER_SIZE", "-1"),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_config("HANDLE_BUFFER_SIZE", "1T"),
+                            rocsparse_status_invalid_value);
+
+    // The value does not fit into a single character
+    value_size = 1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_config("POINTER_MODE", &value_size, value),
+                            rocsparse_status_invalid_size);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_load_config(nullptr), rocsparse_status_invalid_pointer);
+}
+
+// Value of a configuration entry, empty if it cannot be read
+static std::string get_config(const char* name)
+{
+    size_t value_size = 0;
+    if(rocsparse_get_config(name, &value_size, nullptr) != rocsparse_status_success
+       || value_size == 0)
+    {
+        return std::string();
+    }
+
+    std::string value(value_size, '\0');
+    if(rocsparse_get_config(name, &value_size, &value[0]) != rocsparse_status_success)
+    {
+        return std::string();
+    }
+    value.resize(value_size - 1);
+
+    return value;
+}
+
+//
+// Restore configuration entries when leaving the scope, such that a failed
+// assertion does not leak its settings into the other tests.
+//
+class config_guard
+{
+public:
+    config_guard(std::initializer_list<const char*> names)
+    {
+        for(auto name : names)
+        {
+            this->m_entries.emplace_back(name, get_config(name));
+        }
+    }
+
+    ~config_guard()
+    {
+        for(const auto& entry : this->m_entries)
+        {
+            rocsparse_set_config(entry.first.c_str(), entry.second.c_str());
+        }
+    }
+
+private:
+    std::vector<std::pair<std::string, std::string>> m_entries;
+};
+
+template <typename T>
+void testing_config(const Arguments& arg)
+{
+    const std::string pointer_mode = get_config("POINTER_MODE");
+    const std::string threshold    = get_config("WORKSPACE_POOL_RELEASE_THRESHOLD");
+
+    config_guard guard({"POINTER_MODE", "WORKSPACE_POOL_RELEASE_THRESHOLD"});
+
+    // The memory statistics switches are registered, they are read when the
+    // library is loaded
+    ASSERT_EQ(get_config("MEMSTAT"), get_config("ROCSPARSE_MEMSTAT"));
+
+    // The prefix is optional
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_config("ROCSPARSE_POINTER_MODE", "device"));
+    ASSERT_EQ(get_config("POINTER_MODE"), "device");
+
+    // Values are read from a file
+    const std::string filename = rocsparse_temp_filename();
+    {
+        std::ofstream out(filename);
+        out << "# rocsparse configuration" << std::endl;
+        out << "ROCSPARSE_WORKSPACE_POOL_RELEASE_THRESHOLD = 2M # two megabytes" << std::endl;
+    }
+    const rocsparse_status status = rocsparse_load_config(filename.c_str());
+    std::remove(filename.c_str());
+    CHECK_ROCSPARSE_ERROR(status);
+
+    // Handles take a snapshot of the configuration when they are created
+    {
+        rocsparse_local_handle handle;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_config("POINTER_MODE", pointer_mode.c_str()));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_config("WORKSPACE_POOL_RELEASE_THRESHOLD",
+                                                   threshold.c_str()));
+
+        rocsparse_pointer_mode mode;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_pointer_mode(handle, &mode));
+        ASSERT_EQ(mode, rocsparse_pointer_mode_device);
+
+        size_t nbytes = 0;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_workspace_pool_release_threshold(handle, &nbytes));
+        unit_check_scalar<size_t>(size_t(2) << 20, nbytes);
+    }
+
+    ASSERT_EQ(get_config("POINTER_MODE"), pointer_mode);
+    ASSERT_EQ(get_config("WORKSPACE_POOL_RELEASE_THRESHOLD"), threshold);
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_config_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_config<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+
+//
+// Fill a CSR matrix whose row i holds length(i) entries, spread evenly over
+// the columns and with small integer values, such that products are exact.
+//
+template <typename T, typename F>
+static void config_init_csr(host_csr_matrix<T>& A, rocsparse_int m, F length)
+{
+    rocsparse_int nnz = 0;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        nnz += length(i);
+    }
+
+    A.define(m, m, nnz, rocsparse_index_base_zero);
+
+    A.ptr[0] = 0;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        const rocsparse_int row_nnz = length(i);
+        const rocsparse_int stride  = m / row_nnz;
+
+        A.ptr[i + 1] = A.ptr[i] + row_nnz;
+        for(rocsparse_int j = 0; j < row_nnz; ++j)
+        {
+            A.ind[A.ptr[i] + j] = (i + j * stride) % m;
+            A.val[A.ptr[i] + j] = static_cast<T>(1 + (i + j) % 3);
+        }
+
+        std::sort(&A.ind[A.ptr[i]], &A.ind[A.ptr[i + 1]]);
+    }
+}
+
+//
+// Each kernel variant selected by the configuration computes the same result.
+//
+void testing_config_extra(const Arguments& arg)
+{
+    typedef double T;
+
+    config_guard guard(
+        {"CSRMV_ADAPTIVE_BLOCK_SIZE", "CSRMV_ADAPTIVE_ROWS_FOR_VECTOR", "CSRGEMM_HASH_SCALE"});
+
+    static constexpr rocsparse_int m     = 4096;
+    const T                        alpha = static_cast<T>(2);
+    const T                        beta  = static_cast<T>(1);
+
+    // Short rows of varying length, medium rows and a row processed by
+    // several workgroups
+    host_csr_matrix<T> hA;
+    config_init_csr(hA, m, [](rocsparse_int i) {
+        return (i == 100) ? 3500 : (i % 11 == 0) ? 1 + (i * 97) % 700 : 1 + i % 9;
+    });
+    device_csr_matrix<T> dA(hA);
+
+    host_dense_matrix<T> hx(m, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+
+    host_dense_matrix<T> hy_init(m, 1);
+    rocsparse_matrix_utils::init_exact(hy_init);
+
+    host_dense_matrix<T> hy(hy_init);
+    host_csrmv<T, rocsparse_int, rocsparse_int, T, T, T>(rocsparse_operation_none,
+                                                         m,
+                                                         m,
+                                                         hA.nnz,
+                                                         alpha,
+                                                         hA.ptr,
+                                                         hA.ind,
+                                                         hA.val,
+                                                         hx,
+                                                         beta,
+                                                         hy,
+                                                         hA.base,
+                                                         rocsparse_matrix_type_general,
+                                                         rocsparse_spmv_alg_csr_adaptive,
+                                                         false);
+
+    for(const char* block_size : {"512", "1024", "2048"})
+    {
+        for(const char* rows_for_vector : {"1", "2"})
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_config("CSRMV_ADAPTIVE_BLOCK_SIZE", block_size));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_config("CSRMV_ADAPTIVE_ROWS_FOR_VECTOR", rows_for_vector));
+
+            // The handle takes the variant from the configuration
+            rocsparse_local_handle    handle;
+            rocsparse_local_mat_descr descr;
+            rocsparse_local_mat_info  info;
+
+            device_dense_matrix<T> dy(hy_init);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                              rocsparse_operation_none,
+                                                              dA.m,
+                                                              dA.n,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.val,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              info));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                                     rocsparse_operation_none,
+                                                     dA.m,
+                                                     dA.n,
+                                                     dA.nnz,
+                                                     &alpha,
+                                                     descr,
+                                                     dA.val,
+                                                     dA.ptr,
+                                                     dA.ind,
+                                                     info,
+                                                     dx,
+                                                     &beta,
+                                                     dy));
+
+            hy.near_check(dy);
+        }
+    }
+
+    // Rows of C = B * B with up to 36 products fall into the groups that
+    // process a row per wavefront
+    host_csr_matrix<T> hB;
+    config_init_csr(hB, m, [](rocsparse_int i) { return 1 + i % 6; });
+    device_csr_matrix<T> dB(hB);
+
+    host_csr_matrix<T> hC;
+    hC.define(m, m, 0, rocsparse_index_base_zero);
+
+    rocsparse_int nnz_C;
+    host_csrgemm_nnz<T, rocsparse_int, rocsparse_int>(m,
+                                                      m,
+                                                      m,
+                                                      &alpha,
+                                                      hB.ptr,
+                                                      hB.ind,
+                                                      hB.ptr,
+                                                      hB.ind,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      hC.ptr,
+                                                      &nnz_C,
+                                                      hB.base,
+                                                      hB.base,
+                                                      hC.base,
+                                                      hB.base);
+    hC.define(m, m, nnz_C, hC.base);
+    host_csrgemm<T, rocsparse_int, rocsparse_int>(m,
+                                                  m,
+                                                  m,
+                                                  &alpha,
+                                                  hB.ptr,
+                                                  hB.ind,
+                                                  hB.val,
+                                                  hB.ptr,
+                                                  hB.ind,
+                                                  hB.val,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  hC.ptr,
+                                                  hC.ind,
+                                                  hC.val,
+                                                  hB.base,
+                                                  hB.base,
+                                                  hC.base,
+                                                  hB.base);
+
+    for(const char* hash_scale : {"1", "2"})
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_config("CSRGEMM_HASH_SCALE", hash_scale));
+
+        rocsparse_local_handle    handle;
+        rocsparse_local_mat_descr descr;
+        rocsparse_local_mat_info  info;
+
+        device_csr_matrix<T> dC;
+        dC.define(m, m, 0, rocsparse_index_base_zero);
+
+        size_t buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               rocsparse_operation_none,
+                                                               m,
+                                                               m,
+                                                               m,
+                                                               &alpha,
+                                                               descr,
+                                                               dB.nnz,
+                                                               dB.ptr,
+                                                               dB.ind,
+                                                               descr,
+                                                               dB.nnz,
+                                                               dB.ptr,
+                                                               dB.ind,
+                                                               nullptr,
+                                                               descr,
+                                                               0,
+                                                               nullptr,
+                                                               nullptr,
+                                                               info,
+                                                               &buffer_size));
+
+        void* buffer;
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&buffer, buffer_size));
+
+        rocsparse_int nnz;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz(handle,
+                                                    rocsparse_operation_none,
+                                                    rocsparse_operation_none,
+                                                    m,
+                                                    m,
+                                                    m,
+                                                    descr,
+                                                    dB.nnz,
+                                                    dB.ptr,
+                                                    dB.ind,
+                                                    descr,
+                                                    dB.nnz,
+                                                    dB.ptr,
+                                                    dB.ind,
+                                                    descr,
+                                                    0,
+                                                    nullptr,
+                                                    nullptr,
+                                                    descr,
+                                                    dC.ptr,
+                                                    &nnz,
+                                                    info,
+                                                    buffer));
+        dC.define(m, m, nnz, rocsparse_index_base_zero);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm<T>(handle,
+                                                   rocsparse_operation_none,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   m,
+                                                   m,
+                                                   &alpha,
+                                                   descr,
+                                                   dB.nnz,
+                                                   dB.val,
+                                                   dB.ptr,
+                                                   dB.ind,
+                                                   descr,
+                                                   dB.nnz,
+                                                   dB.val,
+                                                   dB.ptr,
+                                                   dB.ind,
+                                                   nullptr,
+                                                   descr,
+                                                   0,
+                                                   nullptr,
+                                                   nullptr,
+                                                   nullptr,
+                                                   descr,
+                                                   dC.val,
+                                                   dC.ptr,
+                                                   dC.ind,
+                                                   info,
+                                                   buffer));
+        CHECK_HIP_ERROR(rocsparse_hipFree(buffer));
+
+        hC.unit_check(dC);
+    }
+}
@@ -160,17 +160,17 @@ void testing_csrmv_managed(const Arguments& arg)
     rocsparse_matrix_factory<T> matrix_factory(arg, arg.unit_check ? to_int : false, full_rank);
 
     // Generate matrix
-    std::vector<rocsparse_int> trow_ptr;
-    std::vector<rocsparse_int> tcol_ind;
-    std::vector<T>             tval;
+    host_vector<rocsparse_int> trow_ptr;
+    host_vector<rocsparse_int> tcol_ind;
+    host_vector<T>             tval;
 
     // Sample matrix
     rocsparse_int nnz;
     matrix_factory.init_csr(trow_ptr, tcol_ind, tval, M, N, nnz, base);
 
     // Allocate host memory for vectors
-    std::vector<T> tx(N);
-    std::vector<T> ty(M);
+    host_vector<T> tx(N);
+    host_vector<T> ty(M);
 
     // Initialize data on CPU
     rocsparse_init<T>(tx, 1, N, 1);
@@ -278,7 +278,7 @@ void testing_csrmv_managed(const Arguments& arg)
         CHECK_HIP_ERROR(hipDeviceSynchronize());
 
         // CPU y
-        std::vector<T> y_gold(M);
+        host_vector<T> y_gold(M);
         for(rocsparse_int i = 0; i < M; i++)
         {
             y_gold[i] = ty[i];
@@ -0,0 +1,199 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_exporter_chunked.hpp"
+
+#include <cstdio>
+
+template <typename T>
+void testing_export_import_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_export_import(const Arguments& arg)
+{
+    const rocsparse_index_base base     = arg.baseA;
+    const std::string          filename = rocsparse_temp_filename();
+
+    //
+    // CSR.
+    //
+    {
+        host_vector<rocsparse_int> row_ptr;
+        host_vector<rocsparse_int> col_ind;
+        host_vector<T>             val;
+        rocsparse_int              nnz;
+        rocsparse_init_csr_random(row_ptr,
+                                  col_ind,
+                                  val,
+                                  arg.M,
+                                  arg.N,
+                                  nnz,
+                                  base,
+                                  rocsparse_matrix_init_kind_default);
+
+        {
+            rocsparse_exporter_chunked exporter(filename);
+            CHECK_ROCSPARSE_ERROR(exporter.write_sparse_csx(rocsparse_direction_row,
+                                                            arg.M,
+                                                            arg.N,
+                                                            nnz,
+                                                            row_ptr.data(),
+                                                            col_ind.data(),
+                                                            val.data(),
+                                                            base));
+        }
+
+        host_vector<rocsparse_int> import_row_ptr;
+        host_vector<rocsparse_int> import_col_ind;
+        host_vector<T>             import_val;
+        rocsparse_int              M;
+        rocsparse_int              N;
+        rocsparse_int              import_nnz;
+        rocsparse_init_csr_chunked(filename.c_str(),
+                                   import_row_ptr,
+                                   import_col_ind,
+                                   import_val,
+                                   M,
+                                   N,
+                                   import_nnz,
+                                   base);
+
+        ASSERT_EQ(M, arg.M);
+        ASSERT_EQ(N, arg.N);
+        ASSERT_EQ(import_nnz, nnz);
+        unit_check_segments<rocsparse_int>(M + 1, row_ptr.data(), import_row_ptr.data());
+        unit_check_segments<rocsparse_int>(nnz, col_ind.data(), import_col_ind.data());
+        unit_check_segments<T>(nnz, val.data(), import_val.data());
+    }
+
+    //
+    // GEBSR, imported in the direction of the export and in the other one.
+    //
+    {
+        const rocsparse_int row_block_dim = arg.row_block_dimA;
+        const rocsparse_int col_block_dim = arg.col_block_dimA;
+        const rocsparse_int block_size    = row_block_dim * col_block_dim;
+
+        host_vector<rocsparse_int> row_ptr;
+        host_vector<rocsparse_int> col_ind;
+        host_vector<T>             val;
+        rocsparse_int              nnzb;
+        rocsparse_init_gebsr_random(row_ptr,
+                                    col_ind,
+                                    val,
+                                    arg.M,
+                                    arg.N,
+                                    nnzb,
+                                    row_block_dim,
+                                    col_block_dim,
+                                    base,
+                                    rocsparse_matrix_init_kind_default);
+
+        {
+            rocsparse_exporter_chunked exporter(filename);
+            CHECK_ROCSPARSE_ERROR(exporter.write_sparse_gebsx(rocsparse_direction_row,
+                                                              arg.direction,
+                                                              arg.M,
+                                                              arg.N,
+                                                              nnzb,
+                                                              row_block_dim,
+                                                              col_block_dim,
+                                                              row_ptr.data(),
+                                                              col_ind.data(),
+                                                              val.data(),
+                                                              base));
+        }
+
+        // Blocks stored in the other direction.
+        host_vector<T> other_val(val.size());
+        for(rocsparse_int k = 0; k < nnzb; ++k)
+        {
+            for(rocsparse_int i = 0; i < row_block_dim; ++i)
+            {
+                for(rocsparse_int j = 0; j < col_block_dim; ++j)
+                {
+                    const size_t row_major = size_t(block_size) * k + i * col_block_dim + j;
+                    const size_t col_major = size_t(block_size) * k + j * row_block_dim + i;
+                    if(arg.direction == rocsparse_direction_row)
+                    {
+                        other_val[col_major] = val[row_major];
+                    }
+                    else
+                    {
+                        other_val[row_major] = val[col_major];
+                    }
+                }
+            }
+        }
+
+        const rocsparse_direction dirs[2] = {arg.direction,
+                                             (arg.direction == rocsparse_direction_row)
+                                                 ? rocsparse_direction_column
+                                                 : rocsparse_direction_row};
+        const host_vector<T>*     vals[2] = {&val, &other_val};
+
+        for(int d = 0; d < 2; ++d)
+        {
+            host_vector<rocsparse_int> import_row_ptr;
+            host_vector<rocsparse_int> import_col_ind;
+            host_vector<T>             import_val;
+            rocsparse_int              Mb;
+            rocsparse_int              Nb;
+            rocsparse_int              import_nnzb;
+            rocsparse_init_gebsr_chunked(filename.c_str(),
+                                         import_row_ptr,
+                                         import_col_ind,
+                                         import_val,
+                                         dirs[d],
+                                         Mb,
+                                         Nb,
+                                         import_nnzb,
+                                         row_block_dim,
+                                         col_block_dim,
+                                         base);
+
+            ASSERT_EQ(Mb, arg.M);
+            ASSERT_EQ(Nb, arg.N);
+            ASSERT_EQ(import_nnzb, nnzb);
+            unit_check_segments<rocsparse_int>(Mb + 1, row_ptr.data(), import_row_ptr.data());
+            unit_check_segments<rocsparse_int>(nnzb, col_ind.data(), import_col_ind.data());
+            unit_check_segments<T>(
+                size_t(nnzb) * block_size, vals[d]->data(), import_val.data());
+        }
+    }
+
+    std::remove(filename.c_str());
+}
+
+#define INSTANTIATE(TYPE)                                                    \
+    template void testing_export_import_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_export_import<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_export_import_extra(const Arguments& arg) {}
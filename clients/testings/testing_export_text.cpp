@@ -0,0 +1,431 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_exporter_ascii.hpp"
+#include "rocsparse_exporter_matrixmarket.hpp"
+#include "rocsparse_importer_matrixmarket.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+//
+// Tokens of an ascii export following its header lines, the separators of the
+// entries and of the complex numbers are removed.
+//
+static std::vector<std::string> testing_export_text_ascii_tokens(const std::string& filename,
+                                                                 int                header_lines)
+{
+    std::ifstream in(filename);
+    std::string   line;
+    for(int i = 0; i < header_lines; ++i)
+    {
+        std::getline(in, line);
+    }
+
+    std::vector<std::string> tokens;
+    while(std::getline(in, line))
+    {
+        std::replace_if(
+            line.begin(),
+            line.end(),
+            [](char c) { return c == '(' || c == ')' || c == ',' || c == '='; },
+            ' ');
+        std::istringstream ss(line);
+        std::string        token;
+        while(ss >> token)
+        {
+            tokens.push_back(token);
+        }
+    }
+    return tokens;
+}
+
+static void testing_export_text_ascii_read(const std::vector<std::string>& t, size_t& p, float& x)
+{
+    x = std::strtof(t.at(p++).c_str(), nullptr);
+}
+
+static void testing_export_text_ascii_read(const std::vector<std::string>& t, size_t& p, double& x)
+{
+    x = std::strtod(t.at(p++).c_str(), nullptr);
+}
+
+static void testing_export_text_ascii_read(const std::vector<std::string>& t,
+                                           size_t&                         p,
+                                           rocsparse_float_complex&        x)
+{
+    float re, im;
+    testing_export_text_ascii_read(t, p, re);
+    testing_export_text_ascii_read(t, p, im);
+    x = rocsparse_float_complex(re, im);
+}
+
+static void testing_export_text_ascii_read(const std::vector<std::string>& t,
+                                           size_t&                         p,
+                                           rocsparse_double_complex&       x)
+{
+    double re, im;
+    testing_export_text_ascii_read(t, p, re);
+    testing_export_text_ascii_read(t, p, im);
+    x = rocsparse_double_complex(re, im);
+}
+
+static void testing_export_text_ascii_read(const std::vector<std::string>& t,
+                                           size_t&                         p,
+                                           rocsparse_int&                  x)
+{
+    x = std::atoi(t.at(p++).c_str());
+}
+
+static void testing_export_text_ascii_expect(const std::vector<std::string>& t,
+                                             size_t&                         p,
+                                             const char*                     keyword)
+{
+    ASSERT_EQ(t.at(p++), keyword);
+}
+
+//
+// Export a CSR matrix and read it back from both formats, the ascii export in the direction
+// of each storage.
+//
+template <typename T>
+static void testing_export_text_csx(const Arguments& arg, const std::string& filename)
+{
+    const rocsparse_index_base base = arg.baseA;
+
+    host_vector<rocsparse_int> row_ptr;
+    host_vector<rocsparse_int> col_ind;
+    host_vector<T>             val;
+    rocsparse_int              nnz;
+    rocsparse_init_csr_random(
+        row_ptr, col_ind, val, arg.M, arg.N, nnz, base, rocsparse_matrix_init_kind_default);
+
+    {
+        rocsparse_exporter_matrixmarket exporter(filename);
+        CHECK_ROCSPARSE_ERROR(exporter.write_sparse_csx(rocsparse_direction_row,
+                                                        arg.M,
+                                                        arg.N,
+                                                        nnz,
+                                                        row_ptr.data(),
+                                                        col_ind.data(),
+                                                        val.data(),
+                                                        base));
+    }
+
+    {
+        host_vector<rocsparse_int> import_row_ptr;
+        host_vector<rocsparse_int> import_col_ind;
+        host_vector<T>             import_val;
+        rocsparse_int              M;
+        rocsparse_int              N;
+        rocsparse_int              import_nnz;
+
+        rocsparse_importer_matrixmarket importer(filename);
+        CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_csr(
+            importer, import_row_ptr, import_col_ind, import_val, M, N, import_nnz, base));
+
+        ASSERT_EQ(M, arg.M);
+        ASSERT_EQ(N, arg.N);
+        ASSERT_EQ(import_nnz, nnz);
+        unit_check_segments<rocsparse_int>(M + 1, row_ptr.data(), import_row_ptr.data());
+        unit_check_segments<rocsparse_int>(nnz, col_ind.data(), import_col_ind.data());
+        unit_check_segments<T>(nnz, val.data(), import_val.data());
+    }
+
+    // The arrays of the CSR matrix are the arrays of the CSC storage of its transpose.
+    const rocsparse_direction dirs[2] = {rocsparse_direction_row, rocsparse_direction_column};
+    for(rocsparse_direction dir : dirs)
+    {
+        const rocsparse_int m = (dir == rocsparse_direction_row) ? arg.M : arg.N;
+        const rocsparse_int n = (dir == rocsparse_direction_row) ? arg.N : arg.M;
+        {
+            rocsparse_exporter_ascii exporter(filename);
+            CHECK_ROCSPARSE_ERROR(exporter.write_sparse_csx(
+                dir, m, n, nnz, row_ptr.data(), col_ind.data(), val.data(), base));
+        }
+
+        const char* outer = (dir == rocsparse_direction_row) ? "row:" : "col:";
+        const char* inner = (dir == rocsparse_direction_row) ? "col" : "row";
+        const auto  t     = testing_export_text_ascii_tokens(filename, 6);
+        size_t      p     = 0;
+        for(rocsparse_int i = 0; i < arg.M; ++i)
+        {
+            rocsparse_int import_i;
+            testing_export_text_ascii_expect(t, p, outer);
+            testing_export_text_ascii_read(t, p, import_i);
+            ASSERT_EQ(import_i, i);
+            for(rocsparse_int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                rocsparse_int import_j;
+                T             import_v;
+                testing_export_text_ascii_expect(t, p, inner);
+                testing_export_text_ascii_read(t, p, import_j);
+                testing_export_text_ascii_expect(t, p, "val");
+                testing_export_text_ascii_read(t, p, import_v);
+                ASSERT_EQ(import_j, col_ind[k] - base);
+                unit_check_segments<T>(1, &val[k], &import_v);
+            }
+        }
+        ASSERT_EQ(p, t.size());
+    }
+}
+
+//
+// Export a GEBSR matrix to Matrix Market and read it back as the CSR matrix of its entries.
+//
+template <typename T>
+static void testing_export_text_gebsx(const Arguments& arg, const std::string& filename)
+{
+    const rocsparse_index_base base          = arg.baseA;
+    const rocsparse_direction  dirb          = arg.direction;
+    const rocsparse_int        row_block_dim = arg.row_block_dimA;
+    const rocsparse_int        col_block_dim = arg.col_block_dimA;
+
+    host_vector<rocsparse_int> row_ptr;
+    host_vector<rocsparse_int> col_ind;
+    host_vector<T>             val;
+    rocsparse_int              nnzb;
+    rocsparse_init_gebsr_random(row_ptr,
+                                col_ind,
+                                val,
+                                arg.M,
+                                arg.N,
+                                nnzb,
+                                row_block_dim,
+                                col_block_dim,
+                                base,
+                                rocsparse_matrix_init_kind_default);
+
+    {
+        rocsparse_exporter_matrixmarket exporter(filename);
+        CHECK_ROCSPARSE_ERROR(exporter.write_sparse_gebsx(rocsparse_direction_row,
+                                                          dirb,
+                                                          arg.M,
+                                                          arg.N,
+                                                          nnzb,
+                                                          row_block_dim,
+                                                          col_block_dim,
+                                                          row_ptr.data(),
+                                                          col_ind.data(),
+                                                          val.data(),
+                                                          base));
+    }
+
+    // Entries of the blocks, row by row.
+    const rocsparse_int        M = arg.M * row_block_dim;
+    const rocsparse_int        N = arg.N * col_block_dim;
+    host_vector<rocsparse_int> csr_row_ptr(M + 1);
+    host_vector<rocsparse_int> csr_col_ind;
+    host_vector<T>             csr_val;
+    csr_row_ptr[0] = base;
+    for(rocsparse_int b = 0; b < arg.M; ++b)
+    {
+        for(rocsparse_int k = 0; k < row_block_dim; ++k)
+        {
+            for(rocsparse_int at = row_ptr[b] - base; at < row_ptr[b + 1] - base; ++at)
+            {
+                for(rocsparse_int l = 0; l < col_block_dim; ++l)
+                {
+                    const size_t offset = (dirb == rocsparse_direction_row)
+                                              ? (col_block_dim * k + l)
+                                              : (row_block_dim * l + k);
+                    csr_col_ind.push_back((col_ind[at] - base) * col_block_dim + l + base);
+                    csr_val.push_back(val[size_t(row_block_dim) * col_block_dim * at + offset]);
+                }
+            }
+            csr_row_ptr[b * row_block_dim + k + 1] = csr_col_ind.size() + base;
+        }
+    }
+    const rocsparse_int nnz = csr_col_ind.size();
+
+    host_vector<rocsparse_int> import_row_ptr;
+    host_vector<rocsparse_int> import_col_ind;
+    host_vector<T>             import_val;
+    rocsparse_int              import_M;
+    rocsparse_int              import_N;
+    rocsparse_int              import_nnz;
+
+    rocsparse_importer_matrixmarket importer(filename);
+    CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_csr(importer,
+                                                      import_row_ptr,
+                                                      import_col_ind,
+                                                      import_val,
+                                                      import_M,
+                                                      import_N,
+                                                      import_nnz,
+                                                      base));
+
+    ASSERT_EQ(import_M, M);
+    ASSERT_EQ(import_N, N);
+    ASSERT_EQ(import_nnz, nnz);
+    unit_check_segments<rocsparse_int>(M + 1, csr_row_ptr.data(), import_row_ptr.data());
+    unit_check_segments<rocsparse_int>(nnz, csr_col_ind.data(), import_col_ind.data());
+    unit_check_segments<T>(nnz, csr_val.data(), import_val.data());
+}
+
+//
+// Export a COO matrix and read it back from both formats.
+//
+template <typename T>
+static void testing_export_text_coo(const Arguments& arg, const std::string& filename)
+{
+    const rocsparse_index_base base = arg.baseA;
+
+    host_vector<rocsparse_int> row_ptr;
+    host_vector<rocsparse_int> col_ind;
+    host_vector<T>             val;
+    rocsparse_int              nnz;
+    rocsparse_init_csr_random(
+        row_ptr, col_ind, val, arg.M, arg.N, nnz, base, rocsparse_matrix_init_kind_default);
+
+    host_vector<rocsparse_int> row_ind(nnz);
+    for(rocsparse_int i = 0; i < arg.M; ++i)
+    {
+        for(rocsparse_int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+        {
+            row_ind[k] = i + base;
+        }
+    }
+
+    {
+        rocsparse_exporter_matrixmarket exporter(filename);
+        CHECK_ROCSPARSE_ERROR(exporter.write_sparse_coo(
+            arg.M, arg.N, nnz, row_ind.data(), col_ind.data(), val.data(), base));
+    }
+
+    {
+        host_vector<rocsparse_int> import_row_ind;
+        host_vector<rocsparse_int> import_col_ind;
+        host_vector<T>             import_val;
+        rocsparse_int              M;
+        rocsparse_int              N;
+        int64_t                    import_nnz;
+
+        rocsparse_importer_matrixmarket importer(filename);
+        CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_coo(
+            importer, import_row_ind, import_col_ind, import_val, M, N, import_nnz, base));
+
+        ASSERT_EQ(M, arg.M);
+        ASSERT_EQ(N, arg.N);
+        ASSERT_EQ(import_nnz, nnz);
+        unit_check_segments<rocsparse_int>(nnz, row_ind.data(), import_row_ind.data());
+        unit_check_segments<rocsparse_int>(nnz, col_ind.data(), import_col_ind.data());
+        unit_check_segments<T>(nnz, val.data(), import_val.data());
+    }
+
+    {
+        rocsparse_exporter_ascii exporter(filename);
+        CHECK_ROCSPARSE_ERROR(exporter.write_sparse_coo(
+            arg.M, arg.N, nnz, row_ind.data(), col_ind.data(), val.data(), base));
+    }
+
+    const auto t = testing_export_text_ascii_tokens(filename, 5);
+    size_t     p = 0;
+    for(rocsparse_int k = 0; k < nnz; ++k)
+    {
+        rocsparse_int import_i;
+        rocsparse_int import_j;
+        T             import_v;
+        testing_export_text_ascii_expect(t, p, "row");
+        testing_export_text_ascii_read(t, p, import_i);
+        testing_export_text_ascii_expect(t, p, "col");
+        testing_export_text_ascii_read(t, p, import_j);
+        testing_export_text_ascii_expect(t, p, "val");
+        testing_export_text_ascii_read(t, p, import_v);
+        ASSERT_EQ(import_i, row_ind[k] - base);
+        ASSERT_EQ(import_j, col_ind[k] - base);
+        unit_check_segments<T>(1, &val[k], &import_v);
+    }
+    ASSERT_EQ(p, t.size());
+}
+
+//
+// Export a dense matrix of each order to ascii, the entries are read back row by row.
+//
+template <typename T>
+static void testing_export_text_dense(const Arguments& arg, const std::string& filename)
+{
+    const rocsparse_order orders[2] = {rocsparse_order_row, rocsparse_order_column};
+    for(rocsparse_order order : orders)
+    {
+        // The leading dimension is padded to check it is used.
+        const rocsparse_int ld = ((order == rocsparse_order_row) ? arg.N : arg.M) + 1;
+        const rocsparse_int nl = (order == rocsparse_order_row) ? arg.M : arg.N;
+
+        host_vector<T> A(size_t(ld) * nl);
+        for(size_t k = 0; k < A.size(); ++k)
+        {
+            A[k] = random_generator<T>();
+        }
+
+        {
+            rocsparse_exporter_ascii exporter(filename);
+            CHECK_ROCSPARSE_ERROR(exporter.write_dense_matrix(order, arg.M, arg.N, A.data(), ld));
+        }
+
+        const auto t = testing_export_text_ascii_tokens(filename, 5);
+        size_t     p = 0;
+        for(rocsparse_int i = 0; i < arg.M; ++i)
+        {
+            for(rocsparse_int j = 0; j < arg.N; ++j)
+            {
+                const size_t k = (order == rocsparse_order_row) ? (size_t(ld) * i + j)
+                                                                : (size_t(ld) * j + i);
+                T            import_v;
+                testing_export_text_ascii_read(t, p, import_v);
+                unit_check_segments<T>(1, &A[k], &import_v);
+            }
+        }
+        ASSERT_EQ(p, t.size());
+    }
+}
+
+template <typename T>
+void testing_export_text_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_export_text(const Arguments& arg)
+{
+    const std::string filename = rocsparse_temp_filename();
+
+    testing_export_text_csx<T>(arg, filename);
+    testing_export_text_gebsx<T>(arg, filename);
+    testing_export_text_coo<T>(arg, filename);
+    testing_export_text_dense<T>(arg, filename);
+
+    std::remove(filename.c_str());
+}
+
+#define INSTANTIATE(TYPE)                                                  \
+    template void testing_export_text_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_export_text<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_export_text_extra(const Arguments& arg) {}
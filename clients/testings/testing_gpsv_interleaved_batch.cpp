@@ -174,7 +174,7 @@ void testing_gpsv_interleaved_batch(const Arguments& arg)
         hx.transfer_from(dx);
 
         // Check
-        std::vector<T> hresult(m * batch_count);
+        host_vector<T> hresult(m * batch_count);
 
         for(rocsparse_int b = 0; b < batch_count; b++)
         {
@@ -148,7 +148,7 @@ void testing_gtsv(const Arguments& arg)
         hB.transfer_from(dB);
 
         // Check
-        std::vector<T> hresult(ldb * n, static_cast<T>(7));
+        host_vector<T> hresult(ldb * n, static_cast<T>(7));
         for(rocsparse_int j = 0; j < n; j++)
         {
             hresult[ldb * j] = hd[0] * hB[ldb * j] + hdu[0] * hB[ldb * j + 1];
@@ -167,7 +167,7 @@ void testing_gtsv_no_pivot_strided_batch(const Arguments& arg)
         hx.transfer_from(dx);
 
         // Check
-        std::vector<T> hresult(batch_stride * batch_count, static_cast<T>(7));
+        host_vector<T> hresult(batch_stride * batch_count, static_cast<T>(7));
 
         for(rocsparse_int j = 0; j < batch_count; j++)
         {
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_handle_pool_bad_arg(const Arguments& arg)
+{
+    rocsparse_handle_pool pool;
+    rocsparse_handle      handle;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_create_handle_pool(nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_handle_pool(nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_create_handle_pool(&pool));
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_handle_pool_acquire(nullptr, &handle),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_handle_pool_acquire(pool, nullptr),
+                            rocsparse_status_invalid_handle);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_handle_pool_acquire(pool, &handle));
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_handle_pool_release(nullptr, handle),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_handle_pool_release(pool, nullptr),
+                            rocsparse_status_invalid_handle);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_handle_pool_release(pool, handle));
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle_pool(pool));
+}
+
+template <typename T>
+void testing_handle_pool(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+
+    rocsparse_handle_pool pool;
+    CHECK_ROCSPARSE_ERROR(rocsparse_create_handle_pool(&pool));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    std::vector<rocsparse_handle> handles(M);
+    for(int iter = 0; iter < 2; ++iter)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_handle_pool_acquire(pool, &handles[i]));
+
+            // Recycled handles are in their default state
+            hipStream_t            handle_stream;
+            rocsparse_pointer_mode pointer_mode;
+            CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(handles[i], &handle_stream));
+            CHECK_ROCSPARSE_ERROR(rocsparse_get_pointer_mode(handles[i], &pointer_mode));
+            ASSERT_EQ(handle_stream, (hipStream_t)0);
+            ASSERT_EQ(pointer_mode, rocsparse_pointer_mode_host);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handles[i], stream));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handles[i], rocsparse_pointer_mode_device));
+        }
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_handle_pool_release(pool, handles[i]));
+        }
+    }
+
+    // Handles are reused
+    rocsparse_handle handle;
+    CHECK_ROCSPARSE_ERROR(rocsparse_handle_pool_acquire(pool, &handle));
+    ASSERT_EQ(handle, handles[M - 1]);
+    CHECK_ROCSPARSE_ERROR(rocsparse_handle_pool_release(pool, handle));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle_pool(pool));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+#define INSTANTIATE(TYPE)                                                  \
+    template void testing_handle_pool_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_handle_pool<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_handle_pool_extra(const Arguments& arg) {}
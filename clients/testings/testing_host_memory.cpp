@@ -0,0 +1,287 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_host_memory.hpp"
+
+#include <fstream>
+
+#ifndef WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+//
+// Policy of the host memory in the scope of the object, the policy of the
+// environment is restored on exit.
+//
+struct testing_host_memory_policy
+{
+    explicit testing_host_memory_policy(const char* value)
+    {
+        rocsparse_host_memory_set_policy(value);
+    }
+
+    ~testing_host_memory_policy()
+    {
+        rocsparse_host_memory_set_policy(nullptr);
+    }
+};
+
+//
+// Whether MAP_HUGETLB can be satisfied, i.e. huge pages are reserved and free
+// or can be overcommitted.
+//
+static bool testing_host_memory_hugetlb_available()
+{
+    int64_t       overcommit = 0;
+    std::ifstream nr("/proc/sys/vm/nr_overcommit_hugepages");
+    if(nr >> overcommit && overcommit > 0)
+    {
+        return true;
+    }
+
+    std::ifstream meminfo("/proc/meminfo");
+    std::string   key;
+    int64_t       value;
+    while(meminfo >> key >> value)
+    {
+        if(key == "HugePages_Free:")
+        {
+            return value > 0;
+        }
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return false;
+}
+
+//
+// Check the backing of an array of nbytes bytes, large arrays of the policy
+// are backed by large.
+//
+static void testing_host_memory_check_backing(const void*                   p,
+                                              size_t                        nbytes,
+                                              rocsparse_host_memory_backing large)
+{
+    EXPECT_EQ(rocsparse_host_memory_get_backing(p),
+              (nbytes >= rocsparse_host_memory_threshold) ? large
+                                                          : rocsparse_host_memory_backing_none);
+}
+
+//
+// Check that the pages of an array of nbytes bytes, left uninitialized, have
+// been faulted in by the first touch of large arrays.
+//
+static void testing_host_memory_check_resident(const void* p, size_t nbytes)
+{
+#ifndef WIN32
+    if(nbytes < rocsparse_host_memory_threshold)
+    {
+        return;
+    }
+
+    const uintptr_t            page  = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t            begin = reinterpret_cast<uintptr_t>(p) / page * page;
+    const uintptr_t            end   = reinterpret_cast<uintptr_t>(p) + nbytes;
+    std::vector<unsigned char> resident((end - begin + page - 1) / page);
+    ASSERT_EQ(mincore(reinterpret_cast<void*>(begin), end - begin, resident.data()), 0);
+    for(size_t i = 0; i < resident.size(); ++i)
+    {
+        ASSERT_NE(resident[i] & 1, 0);
+    }
+#endif
+}
+
+//
+// Allocate, fill, grow and transfer host_vector, host_csr_matrix and
+// host_dense_vector of n entries under the current policy.
+//
+template <typename T>
+static void testing_host_memory_check(int64_t n, rocsparse_host_memory_backing large)
+{
+    //
+    // Small arrays are never mapped.
+    //
+    {
+        host_vector<T> small(1);
+        EXPECT_EQ(rocsparse_host_memory_get_backing(small.data()),
+                  rocsparse_host_memory_backing_none);
+    }
+
+    //
+    // host_vector, default initialized by resize, filled on request and
+    // preserved by its reallocations.
+    //
+    {
+        host_vector<T> v(n);
+        testing_host_memory_check_backing(v.data(), sizeof(T) * n, large);
+        testing_host_memory_check_resident(v.data(), sizeof(T) * n);
+        for(int64_t i = 0; i < n; ++i)
+        {
+            v[i] = static_cast<T>(i % 7 + 1);
+        }
+
+        v.resize(2 * n);
+        testing_host_memory_check_backing(v.data(), sizeof(T) * 2 * n, large);
+        testing_host_memory_check_resident(v.data(), sizeof(T) * 2 * n);
+        for(int64_t i = 0; i < n; ++i)
+        {
+            ASSERT_EQ(v[i], static_cast<T>(i % 7 + 1));
+        }
+
+        v.resize(n);
+        v.resize(2 * n, static_cast<T>(0));
+        for(int64_t i = 0; i < 2 * n; ++i)
+        {
+            ASSERT_EQ(v[i], (i < n) ? static_cast<T>(i % 7 + 1) : static_cast<T>(0));
+        }
+
+        host_vector<T> w(v);
+        testing_host_memory_check_backing(w.data(), sizeof(T) * 2 * n, large);
+        w.unit_check(v);
+
+        v.clear();
+        v.shrink_to_fit();
+        EXPECT_EQ(rocsparse_host_memory_get_backing(v.data()), rocsparse_host_memory_backing_none);
+    }
+
+    //
+    // host_csr_matrix, a diagonal matrix copied to the device and back.
+    //
+    {
+        const rocsparse_index_base base = rocsparse_index_base_one;
+
+        host_csr_matrix<T, rocsparse_int, rocsparse_int> A(n, n, n, base);
+        testing_host_memory_check_backing(A.ptr.data(), sizeof(rocsparse_int) * (n + 1), large);
+        testing_host_memory_check_backing(A.ind.data(), sizeof(rocsparse_int) * n, large);
+        testing_host_memory_check_backing(A.val.data(), sizeof(T) * n, large);
+        for(int64_t i = 0; i < n; ++i)
+        {
+            A.ptr[i] = static_cast<rocsparse_int>(i + base);
+            A.ind[i] = static_cast<rocsparse_int>(i + base);
+            A.val[i] = static_cast<T>(i % 7 + 1);
+        }
+        A.ptr[n] = static_cast<rocsparse_int>(n + base);
+
+        device_csr_matrix<T, rocsparse_int, rocsparse_int> dA(A);
+        host_csr_matrix<T, rocsparse_int, rocsparse_int>   B(dA);
+        testing_host_memory_check_backing(B.val.data(), sizeof(T) * n, large);
+        B.unit_check(A);
+    }
+
+    //
+    // host_dense_vector, left uninitialized by the policies.
+    //
+    {
+        host_dense_vector<T> x(n);
+        testing_host_memory_check_backing(x.data(), sizeof(T) * n, large);
+        if(large != rocsparse_host_memory_backing_none)
+        {
+            testing_host_memory_check_resident(x.data(), sizeof(T) * n);
+        }
+        for(int64_t i = 0; i < n; ++i)
+        {
+            x[i] = static_cast<T>(i % 7 + 1);
+        }
+
+        device_dense_vector<T> dx(x);
+        host_dense_vector<T>   y(dx);
+        y.unit_check(x);
+    }
+}
+
+template <typename T>
+void testing_host_memory_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_host_memory(const Arguments& arg)
+{
+    const int64_t n = arg.M;
+
+    {
+        testing_host_memory_policy policy("default");
+        testing_host_memory_check<T>(n, rocsparse_host_memory_backing_none);
+    }
+
+    //
+    // Reserved huge pages, or transparent huge pages when none is available.
+    //
+    {
+        testing_host_memory_policy policy("hugepages");
+
+        void* p = rocsparse_host_memory_allocate(rocsparse_host_memory_threshold);
+        ASSERT_NE(p, nullptr);
+        const rocsparse_host_memory_backing backing = rocsparse_host_memory_get_backing(p);
+        EXPECT_TRUE(rocsparse_host_memory_free(p));
+
+        if(testing_host_memory_hugetlb_available())
+        {
+            EXPECT_TRUE(backing == rocsparse_host_memory_backing_hugetlb
+                        || backing == rocsparse_host_memory_backing_transparent);
+        }
+        else
+        {
+            EXPECT_EQ(backing, rocsparse_host_memory_backing_transparent);
+        }
+
+        testing_host_memory_check<T>(n, backing);
+    }
+
+    //
+    // Transparent huge pages only, as without reserved huge pages.
+    //
+    {
+        testing_host_memory_policy policy("hugepages:transparent");
+        testing_host_memory_check<T>(n, rocsparse_host_memory_backing_transparent);
+    }
+
+    {
+        testing_host_memory_policy policy("mmap");
+        testing_host_memory_check<T>(n, rocsparse_host_memory_backing_file);
+    }
+
+    //
+    // Files cannot be created below a regular file, the standard allocations are used.
+    //
+    {
+        const std::string filename = rocsparse_temp_filename();
+        {
+            const std::string          value = "mmap:" + filename;
+            testing_host_memory_policy policy(value.c_str());
+            testing_host_memory_check<T>(n, rocsparse_host_memory_backing_none);
+        }
+        std::remove(filename.c_str());
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                  \
+    template void testing_host_memory_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_host_memory<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_host_memory_extra(const Arguments& arg) {}
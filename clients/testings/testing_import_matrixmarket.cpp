@@ -0,0 +1,313 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_exporter_text.hpp"
+#include "rocsparse_importer_matrixmarket.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+//
+// Write the entries perm[0], perm[1], ... of a COO matrix to a Matrix Market
+// file of the given field ("real", "complex" or "pattern") and symmetry.
+//
+template <typename T>
+static void testing_import_matrixmarket_write(const std::string&                filename,
+                                              const char*                       field,
+                                              const char*                       symmetry,
+                                              rocsparse_int                     M,
+                                              rocsparse_int                     N,
+                                              const host_vector<rocsparse_int>& row_ind,
+                                              const host_vector<rocsparse_int>& col_ind,
+                                              const host_vector<T>&             val,
+                                              const host_vector<rocsparse_int>& perm)
+{
+    std::string text = std::string("%%MatrixMarket matrix coordinate ") + field + " " + symmetry
+                       + "\n% comment\n";
+    rocsparse_exporter_text_append_integer(text, M);
+    text.push_back(' ');
+    rocsparse_exporter_text_append_integer(text, N);
+    text.push_back(' ');
+    rocsparse_exporter_text_append_integer(text, perm.size());
+    text.push_back('\n');
+
+    for(rocsparse_int k : perm)
+    {
+        rocsparse_exporter_text_append_integer(text, row_ind[k] + 1);
+        text.push_back(' ');
+        rocsparse_exporter_text_append_integer(text, col_ind[k] + 1);
+        if(strcmp(field, "pattern"))
+        {
+            text.push_back(' ');
+            rocsparse_exporter_text_append_scalar(text, val[k]);
+        }
+        text.push_back('\n');
+    }
+
+    std::ofstream out(filename, std::ios::out | std::ios::binary);
+    out << text;
+}
+
+//
+// Import a Matrix Market file as CSR and as GEBSR and compare with the
+// expected CSR matrix and its conversion to GEBSR.
+//
+template <typename T>
+static void testing_import_matrixmarket_check(const std::string&                filename,
+                                              const Arguments&                  arg,
+                                              rocsparse_int                     M,
+                                              rocsparse_int                     N,
+                                              const host_vector<rocsparse_int>& row_ptr,
+                                              const host_vector<rocsparse_int>& col_ind,
+                                              const host_vector<T>&             val)
+{
+    const rocsparse_index_base base = arg.baseA;
+    const rocsparse_int        nnz  = row_ptr[M] - base;
+
+    {
+        host_vector<rocsparse_int> import_row_ptr;
+        host_vector<rocsparse_int> import_col_ind;
+        host_vector<T>             import_val;
+        rocsparse_int              import_M;
+        rocsparse_int              import_N;
+        rocsparse_int              import_nnz;
+
+        rocsparse_importer_matrixmarket importer(filename);
+        CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_csr(importer,
+                                                          import_row_ptr,
+                                                          import_col_ind,
+                                                          import_val,
+                                                          import_M,
+                                                          import_N,
+                                                          import_nnz,
+                                                          base));
+
+        ASSERT_EQ(import_M, M);
+        ASSERT_EQ(import_N, N);
+        ASSERT_EQ(import_nnz, nnz);
+        unit_check_segments<rocsparse_int>(M + 1, row_ptr.data(), import_row_ptr.data());
+        unit_check_segments<rocsparse_int>(nnz, col_ind.data(), import_col_ind.data());
+        unit_check_segments<T>(nnz, val.data(), import_val.data());
+    }
+
+    {
+        const rocsparse_direction dir           = arg.direction;
+        const rocsparse_int       row_block_dim = arg.row_block_dimA;
+        const rocsparse_int       col_block_dim = arg.col_block_dimA;
+
+        host_vector<rocsparse_int> bsr_row_ptr;
+        host_vector<rocsparse_int> bsr_col_ind;
+        host_vector<T>             bsr_val;
+        host_csr_to_gebsr(dir,
+                          M,
+                          N,
+                          nnz,
+                          val,
+                          row_ptr,
+                          col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          base,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          base);
+
+        const rocsparse_int Mb   = (M + row_block_dim - 1) / row_block_dim;
+        const rocsparse_int Nb   = (N + col_block_dim - 1) / col_block_dim;
+        const rocsparse_int nnzb = bsr_row_ptr[Mb] - base;
+
+        host_vector<rocsparse_int> import_row_ptr;
+        host_vector<rocsparse_int> import_col_ind;
+        host_vector<T>             import_val;
+        rocsparse_direction        import_dir;
+        rocsparse_int              import_Mb;
+        rocsparse_int              import_Nb;
+        rocsparse_int              import_nnzb;
+        rocsparse_int              import_row_block_dim;
+        rocsparse_int              import_col_block_dim;
+
+        rocsparse_importer_matrixmarket importer(filename, dir, row_block_dim, col_block_dim);
+        CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_gebsr(importer,
+                                                            import_row_ptr,
+                                                            import_col_ind,
+                                                            import_val,
+                                                            import_dir,
+                                                            import_Mb,
+                                                            import_Nb,
+                                                            import_nnzb,
+                                                            import_row_block_dim,
+                                                            import_col_block_dim,
+                                                            base));
+
+        ASSERT_EQ(import_dir, dir);
+        ASSERT_EQ(import_Mb, Mb);
+        ASSERT_EQ(import_Nb, Nb);
+        ASSERT_EQ(import_nnzb, nnzb);
+        ASSERT_EQ(import_row_block_dim, row_block_dim);
+        ASSERT_EQ(import_col_block_dim, col_block_dim);
+        unit_check_segments<rocsparse_int>(Mb + 1, bsr_row_ptr.data(), import_row_ptr.data());
+        unit_check_segments<rocsparse_int>(nnzb, bsr_col_ind.data(), import_col_ind.data());
+        unit_check_segments<T>(
+            size_t(nnzb) * row_block_dim * col_block_dim, bsr_val.data(), import_val.data());
+    }
+}
+
+template <typename T>
+void testing_import_matrixmarket_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_import_matrixmarket(const Arguments& arg)
+{
+    const rocsparse_index_base base     = arg.baseA;
+    const rocsparse_int        M        = arg.M;
+    const rocsparse_int        N        = arg.N;
+    const std::string          filename = rocsparse_temp_filename();
+
+    const char* field = (std::is_same<T, rocsparse_float_complex>()
+                         || std::is_same<T, rocsparse_double_complex>())
+                            ? "complex"
+                            : "real";
+
+    host_vector<rocsparse_int> row_ptr;
+    host_vector<rocsparse_int> col_ind;
+    host_vector<T>             val;
+    rocsparse_int              nnz;
+    rocsparse_init_csr_random(
+        row_ptr, col_ind, val, M, N, nnz, base, rocsparse_matrix_init_kind_default);
+
+    // Zero based entries, sorted by rows and by columns.
+    host_vector<rocsparse_int> coo_row_ind(nnz);
+    host_vector<rocsparse_int> coo_col_ind(nnz);
+    host_vector<rocsparse_int> perm(nnz);
+    host_vector<rocsparse_int> perm_col(nnz);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+        {
+            coo_row_ind[k] = i;
+            coo_col_ind[k] = col_ind[k] - base;
+            perm[k]        = k;
+        }
+    }
+
+    perm_col = perm;
+    std::stable_sort(perm_col.begin(), perm_col.end(), [&](rocsparse_int a, rocsparse_int b) {
+        return coo_col_ind[a] < coo_col_ind[b];
+    });
+
+    //
+    // General, sorted by rows and by columns.
+    //
+    testing_import_matrixmarket_write(
+        filename, field, "general", M, N, coo_row_ind, coo_col_ind, val, perm);
+    testing_import_matrixmarket_check(filename, arg, M, N, row_ptr, col_ind, val);
+
+    testing_import_matrixmarket_write(
+        filename, field, "general", M, N, coo_row_ind, coo_col_ind, val, perm_col);
+    testing_import_matrixmarket_check(filename, arg, M, N, row_ptr, col_ind, val);
+
+    //
+    // Pattern, the values are ones.
+    //
+    const host_vector<T> ones(nnz, static_cast<T>(1));
+    testing_import_matrixmarket_write(
+        filename, "pattern", "general", M, N, coo_row_ind, coo_col_ind, val, perm_col);
+    testing_import_matrixmarket_check(filename, arg, M, N, row_ptr, col_ind, ones);
+
+    //
+    // Symmetric, the lower triangle of the leading square block is written
+    // in column order and the expected matrix gets its transpose.
+    //
+    const rocsparse_int        S = std::min(M, N);
+    host_vector<rocsparse_int> lower;
+    for(rocsparse_int k : perm_col)
+    {
+        if(coo_row_ind[k] < S && coo_col_ind[k] <= coo_row_ind[k])
+        {
+            lower.push_back(k);
+        }
+    }
+
+    host_vector<rocsparse_int> symm_row_ind;
+    host_vector<rocsparse_int> symm_col_ind;
+    host_vector<T>             symm_val;
+    for(rocsparse_int k : lower)
+    {
+        symm_row_ind.push_back(coo_row_ind[k]);
+        symm_col_ind.push_back(coo_col_ind[k]);
+        symm_val.push_back(val[k]);
+        if(coo_row_ind[k] != coo_col_ind[k])
+        {
+            symm_row_ind.push_back(coo_col_ind[k]);
+            symm_col_ind.push_back(coo_row_ind[k]);
+            symm_val.push_back(val[k]);
+        }
+    }
+
+    const rocsparse_int        symm_nnz = symm_row_ind.size();
+    host_vector<rocsparse_int> symm_perm(symm_nnz);
+    for(rocsparse_int k = 0; k < symm_nnz; ++k)
+    {
+        symm_perm[k] = k;
+    }
+    std::sort(symm_perm.begin(), symm_perm.end(), [&](rocsparse_int a, rocsparse_int b) {
+        return symm_row_ind[a] < symm_row_ind[b]
+               || (symm_row_ind[a] == symm_row_ind[b] && symm_col_ind[a] < symm_col_ind[b]);
+    });
+
+    host_vector<rocsparse_int> symm_row_ptr(S + 1, 0);
+    host_vector<rocsparse_int> symm_csr_col_ind(symm_nnz);
+    host_vector<T>             symm_csr_val(symm_nnz);
+    for(rocsparse_int k = 0; k < symm_nnz; ++k)
+    {
+        ++symm_row_ptr[symm_row_ind[symm_perm[k]] + 1];
+        symm_csr_col_ind[k] = symm_col_ind[symm_perm[k]] + base;
+        symm_csr_val[k]     = symm_val[symm_perm[k]];
+    }
+    symm_row_ptr[0] = base;
+    for(rocsparse_int i = 0; i < S; ++i)
+    {
+        symm_row_ptr[i + 1] += symm_row_ptr[i];
+    }
+
+    testing_import_matrixmarket_write(
+        filename, field, "symmetric", S, S, coo_row_ind, coo_col_ind, val, lower);
+    testing_import_matrixmarket_check(
+        filename, arg, S, S, symm_row_ptr, symm_csr_col_ind, symm_csr_val);
+
+    std::remove(filename.c_str());
+}
+
+#define INSTANTIATE(TYPE)                                                          \
+    template void testing_import_matrixmarket_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_import_matrixmarket<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_import_matrixmarket_extra(const Arguments& arg) {}
@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_exporter_text.hpp"
+#include "rocsparse_importer_matrixmarket.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+//
+// Write the entries perm[0], perm[1], ... of a CSR matrix in the coordinate
+// Matrix Market format, a symmetric file only gets the lower triangle.
+//
+template <typename T>
+static void testing_import_rows_write(const std::string&                filename,
+                                      bool                              symmetric,
+                                      rocsparse_int                     M,
+                                      rocsparse_int                     N,
+                                      const host_vector<rocsparse_int>& row_ind,
+                                      const host_vector<rocsparse_int>& col_ind,
+                                      const host_vector<T>&             val,
+                                      const host_vector<rocsparse_int>& perm,
+                                      rocsparse_index_base              base)
+{
+    std::string entries;
+    int64_t     nnz = 0;
+    for(rocsparse_int k : perm)
+    {
+        if(symmetric && col_ind[k] > row_ind[k])
+        {
+            continue;
+        }
+
+        rocsparse_exporter_text_append_integer(entries, row_ind[k] - base + 1);
+        entries.push_back(' ');
+        rocsparse_exporter_text_append_integer(entries, col_ind[k] - base + 1);
+        entries.push_back(' ');
+        rocsparse_exporter_text_append_scalar(entries, val[k]);
+        entries.push_back('\n');
+        ++nnz;
+    }
+
+    std::string header = "%%MatrixMarket matrix coordinate ";
+    header += (std::is_same<T, rocsparse_float_complex>()
+               || std::is_same<T, rocsparse_double_complex>())
+                  ? "complex"
+                  : "real";
+    header += symmetric ? " symmetric\n" : " general\n";
+    rocsparse_exporter_text_append_integer(header, M);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, N);
+    header.push_back(' ');
+    rocsparse_exporter_text_append_integer(header, nnz);
+    header.push_back('\n');
+
+    std::ofstream out(filename, std::ios::out | std::ios::binary);
+    out << header << entries;
+}
+
+//
+// Import ranges of rows of a Matrix Market file and compare them with the
+// rows of the whole matrix.
+//
+template <typename T>
+static void testing_import_rows_check(const std::string& filename, rocsparse_index_base base)
+{
+    host_vector<rocsparse_int> row_ptr;
+    host_vector<rocsparse_int> col_ind;
+    host_vector<T>             val;
+    rocsparse_int              M;
+    rocsparse_int              N;
+    rocsparse_int              nnz;
+    {
+        rocsparse_importer_matrixmarket importer(filename);
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_import_sparse_csr(importer, row_ptr, col_ind, val, M, N, nnz, base));
+    }
+
+    const rocsparse_int ranges[][2] = {{0, 0},
+                                       {0, M},
+                                       {0, 1},
+                                       {1, 2},
+                                       {M / 3, (2 * M) / 3},
+                                       {M / 2, M / 2},
+                                       {M - 1, M},
+                                       {M, M + 10}};
+
+    //
+    // Each range is imported by a fresh importer and by an importer shared
+    // across the ranges, which reuses the row index of its first import.
+    //
+    rocsparse_importer_matrixmarket shared(filename);
+    for(int reuse = 0; reuse < 2; ++reuse)
+    {
+        for(const auto& range : ranges)
+        {
+            const rocsparse_int row_begin = range[0];
+            const rocsparse_int row_end   = range[1];
+            if(row_begin < 0)
+            {
+                continue;
+            }
+
+            host_vector<rocsparse_int> slab_row_ptr;
+            host_vector<rocsparse_int> slab_col_ind;
+            host_vector<T>             slab_val;
+            rocsparse_int              slab_M;
+            rocsparse_int              slab_N;
+            rocsparse_int              slab_nnz;
+            {
+                rocsparse_importer_matrixmarket  fresh(filename);
+                rocsparse_importer_matrixmarket& importer = (reuse != 0) ? shared : fresh;
+                CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_csr_rows(importer,
+                                                                       row_begin,
+                                                                       row_end,
+                                                                       slab_row_ptr,
+                                                                       slab_col_ind,
+                                                                       slab_val,
+                                                                       slab_M,
+                                                                       slab_N,
+                                                                       slab_nnz,
+                                                                       base));
+            }
+
+            const rocsparse_int begin = std::min(row_begin, M);
+            const rocsparse_int end   = std::min(row_end, M);
+            const rocsparse_int shift = row_ptr[begin] - base;
+
+            ASSERT_EQ(slab_M, M);
+            ASSERT_EQ(slab_N, N);
+            ASSERT_EQ(slab_nnz, row_ptr[end] - row_ptr[begin]);
+            ASSERT_EQ(slab_row_ptr.size(), size_t(end - begin + 1));
+            for(rocsparse_int i = begin; i <= end; ++i)
+            {
+                ASSERT_EQ(slab_row_ptr[i - begin] + shift, row_ptr[i]);
+            }
+            unit_check_segments<rocsparse_int>(
+                slab_nnz, col_ind.data() + shift, slab_col_ind.data());
+            unit_check_segments<T>(slab_nnz, val.data() + shift, slab_val.data());
+        }
+    }
+}
+
+template <typename T>
+void testing_import_rows_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_import_rows(const Arguments& arg)
+{
+    const rocsparse_index_base base     = arg.baseA;
+    const std::string          filename = rocsparse_temp_filename();
+
+    //
+    // Entries out of row order within a single block.
+    //
+    {
+        const host_vector<rocsparse_int> row_ind = {2, 0, 1};
+        const host_vector<rocsparse_int> col_ind = {0, 0, 1};
+        const host_vector<T>             val
+            = {static_cast<T>(1), static_cast<T>(2), static_cast<T>(3)};
+        testing_import_rows_write(filename,
+                                  false,
+                                  3,
+                                  3,
+                                  row_ind,
+                                  col_ind,
+                                  val,
+                                  {0, 1, 2},
+                                  rocsparse_index_base_zero);
+        testing_import_rows_check<T>(filename, base);
+    }
+
+    host_vector<rocsparse_int> row_ptr;
+    host_vector<rocsparse_int> col_ind;
+    host_vector<T>             val;
+    rocsparse_int              nnz;
+    rocsparse_init_csr_random(row_ptr,
+                              col_ind,
+                              val,
+                              arg.M,
+                              arg.M,
+                              nnz,
+                              base,
+                              rocsparse_matrix_init_kind_default);
+
+    host_vector<rocsparse_int> row_ind(nnz);
+    for(rocsparse_int i = 0; i < arg.M; ++i)
+    {
+        for(rocsparse_int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+        {
+            row_ind[k] = i + base;
+        }
+    }
+
+    //
+    // Entries sorted by rows, then sorted by columns.
+    //
+    host_vector<rocsparse_int> perm(nnz);
+    for(rocsparse_int k = 0; k < nnz; ++k)
+    {
+        perm[k] = k;
+    }
+
+    testing_import_rows_write(filename, false, arg.M, arg.M, row_ind, col_ind, val, perm, base);
+    testing_import_rows_check<T>(filename, base);
+
+    host_vector<rocsparse_int> perm_col(perm);
+    std::stable_sort(perm_col.begin(), perm_col.end(), [&](rocsparse_int a, rocsparse_int b) {
+        return col_ind[a] < col_ind[b];
+    });
+
+    testing_import_rows_write(filename, false, arg.M, arg.M, row_ind, col_ind, val, perm_col, base);
+    testing_import_rows_check<T>(filename, base);
+
+    //
+    // Lower triangle of a symmetric matrix, sorted by rows and by columns.
+    //
+    testing_import_rows_write(filename, true, arg.M, arg.M, row_ind, col_ind, val, perm, base);
+    testing_import_rows_check<T>(filename, base);
+
+    testing_import_rows_write(filename, true, arg.M, arg.M, row_ind, col_ind, val, perm_col, base);
+    testing_import_rows_check<T>(filename, base);
+
+    std::remove(filename.c_str());
+}
+
+#define INSTANTIATE(TYPE)                                                  \
+    template void testing_import_rows_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_import_rows<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_import_rows_extra(const Arguments& arg) {}
@@ -0,0 +1,161 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+namespace
+{
+    template <typename T>
+    struct csr_matrix
+    {
+        host_vector<rocsparse_int> row_ptr;
+        host_vector<rocsparse_int> col_ind;
+        host_vector<T>             val;
+        rocsparse_int              M;
+        rocsparse_int              N;
+        rocsparse_int              nnz;
+
+        csr_matrix(rocsparse_int m, rocsparse_int n)
+            : M(m)
+            , N(n)
+            , nnz(0)
+        {
+        }
+
+        void init(rocsparse_matrix_factory_base<T>& factory)
+        {
+            factory.init_csr(this->row_ptr,
+                             this->col_ind,
+                             this->val,
+                             this->M,
+                             this->N,
+                             this->nnz,
+                             rocsparse_index_base_zero,
+                             rocsparse_matrix_type_general,
+                             rocsparse_fill_mode_lower,
+                             rocsparse_storage_mode_sorted);
+        }
+
+        void unit_check(const csr_matrix& that) const
+        {
+            ASSERT_EQ(this->M, that.M);
+            ASSERT_EQ(this->N, that.N);
+            ASSERT_EQ(this->nnz, that.nnz);
+            unit_check_segments<rocsparse_int>(
+                this->M + 1, this->row_ptr.data(), that.row_ptr.data());
+            unit_check_segments<rocsparse_int>(
+                this->nnz, this->col_ind.data(), that.col_ind.data());
+            unit_check_segments<T>(this->nnz, this->val.data(), that.val.data());
+        }
+    };
+}
+
+template <typename T>
+void testing_matrix_factory_cache_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_matrix_factory_cache(const Arguments& arg)
+{
+    using cache_t = rocsparse_matrix_factory_cache<T>;
+
+    // The key is unique to the call so that the first generation is not a hit from a previous
+    // test.
+    static int        calls = 0;
+    const std::string key   = "testing_matrix_factory_cache " + std::to_string(calls++);
+
+    rocsparse_matrix_factory_random<T> fresh(false);
+    cache_t                            cached(new rocsparse_matrix_factory_random<T>(false), key);
+
+    // Hits and misses since the beginning of the test, only counted if the cache is enabled.
+    const size_t hits           = cache_t::hits();
+    const size_t misses         = cache_t::misses();
+    auto         check_counters = [&](size_t expected_hits, size_t expected_misses) {
+        if(cache_t::is_enabled())
+        {
+            ASSERT_EQ(cache_t::hits() - hits, expected_hits);
+            ASSERT_EQ(cache_t::misses() - misses, expected_misses);
+        }
+    };
+
+    // Fresh generation from the seed.
+    rocsparse_seedrand();
+    const rocsparse_rng_state seed;
+    csr_matrix<T>             A(arg.M, arg.N);
+    A.init(fresh);
+    const rocsparse_rng_state after;
+
+    // The first generation through the cache is a miss, the second one a hit, both give the
+    // matrix and the state of a fresh generation.
+    for(int i = 0; i < 2; ++i)
+    {
+        seed.restore();
+        csr_matrix<T> B(arg.M, arg.N);
+        B.init(cached);
+        ASSERT_EQ(rocsparse_rng_state() == after, true);
+        A.unit_check(B);
+        check_counters(i, 1);
+    }
+
+    // A matrix from another state is not reused, the matrix of a fresh generation is given.
+    csr_matrix<T> C(arg.M, arg.N);
+    C.init(cached);
+    const rocsparse_rng_state after_C;
+    check_counters(1, 2);
+
+    after.restore();
+    csr_matrix<T> D(arg.M, arg.N);
+    D.init(fresh);
+    ASSERT_EQ(rocsparse_rng_state() == after_C, true);
+    D.unit_check(C);
+
+    // Another seed is a miss.
+    const rocsparse_rng_t seed_rng    = rocsparse_seed_get();
+    rocsparse_rng_t       another_rng = seed_rng;
+    another_rng.discard(1);
+    rocsparse_seed_set(another_rng);
+    rocsparse_seedrand();
+    csr_matrix<T> E(arg.M, arg.N);
+    E.init(cached);
+    rocsparse_seed_set(seed_rng);
+    check_counters(1, 3);
+
+    // Another size is a miss, then a hit.
+    for(int i = 0; i < 2; ++i)
+    {
+        seed.restore();
+        csr_matrix<T> F(arg.M + 1, arg.N);
+        F.init(cached);
+        check_counters(1 + i, 4);
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                           \
+    template void testing_matrix_factory_cache_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_matrix_factory_cache<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_matrix_factory_cache_extra(const Arguments& arg) {}
@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_matrix_features.hpp"
+#include "testing.hpp"
+
+#include <vector>
+
+//
+// Build a CSR matrix from the column indices of each row, with unit values.
+//
+template <typename T>
+static void features_init_csr(host_csr_matrix<T>&                           A,
+                              const std::vector<std::vector<rocsparse_int>>& rows,
+                              rocsparse_int                                  n,
+                              rocsparse_index_base                           base)
+{
+    const rocsparse_int m = static_cast<rocsparse_int>(rows.size());
+
+    rocsparse_int nnz = 0;
+    for(const auto& row : rows)
+    {
+        nnz += static_cast<rocsparse_int>(row.size());
+    }
+
+    A.define(m, n, nnz, base);
+
+    A.ptr[0] = base;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        A.ptr[i + 1] = A.ptr[i] + static_cast<rocsparse_int>(rows[i].size());
+        for(size_t k = 0; k < rows[i].size(); ++k)
+        {
+            A.ind[A.ptr[i] - base + k] = rows[i][k] + base;
+            A.val[A.ptr[i] - base + k] = static_cast<T>(1);
+        }
+    }
+}
+
+template <typename T>
+static rocsparse_matrix_features features_compute(const host_csr_matrix<T>& A)
+{
+    rocsparse_matrix_features features;
+    features.compute(A.m, A.n, A.nnz, A.ptr.data(), A.ind.data(), A.val.data(), A.base);
+    return features;
+}
+
+template <typename T>
+void testing_matrix_features_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_matrix_features(const Arguments& arg)
+{
+    const rocsparse_int        m    = arg.M;
+    const rocsparse_index_base base = arg.baseA;
+
+    // The block matrix below is made of 2 x 2 blocks
+    ASSERT_EQ(m % 2, 0);
+    ASSERT_GE(m, 4);
+
+    //
+    // Tridiagonal matrix, each row depends on the previous one in both
+    // triangular solves.
+    //
+    {
+        std::vector<std::vector<rocsparse_int>> rows(m);
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            for(rocsparse_int j = std::max(i - 1, 0); j <= std::min(i + 1, m - 1); ++j)
+            {
+                rows[i].push_back(j);
+            }
+        }
+
+        host_csr_matrix<T> A;
+        features_init_csr(A, rows, m, base);
+
+        const rocsparse_matrix_features features = features_compute(A);
+
+        ASSERT_EQ(features.nnz, 3 * m - 2);
+        ASSERT_EQ(features.row_nnz_min, 2);
+        ASSERT_EQ(features.row_nnz_max, 3);
+        ASSERT_EQ(features.empty_rows, 0);
+        ASSERT_EQ(features.lower_bandwidth, 1);
+        ASSERT_EQ(features.upper_bandwidth, 1);
+        ASSERT_EQ(features.profile, m - 1);
+        ASSERT_EQ(features.missing_diagonal, 0);
+
+        ASSERT_EQ(features.lower_dag_depth, m);
+        ASSERT_EQ(features.lower_dag_width, 1);
+        ASSERT_EQ(features.upper_dag_depth, m);
+        ASSERT_EQ(features.upper_dag_width, 1);
+
+        // Two rows are one entry short of the longest row
+        ASSERT_DOUBLE_EQ(features.ell_padding, 2.0 / (3 * m - 2));
+        ASSERT_EQ(features.hyb_ell_width, 3);
+        ASSERT_DOUBLE_EQ(features.hyb_coo_fraction, 0.0);
+
+        // Block tridiagonal with 2 x 2 blocks, the first and last block rows
+        // hold two blocks
+        ASSERT_EQ(features.bsr_nnzb[0], 3 * (m / 2) - 2);
+    }
+
+    //
+    // Diagonal matrix, all rows are independent.
+    //
+    {
+        std::vector<std::vector<rocsparse_int>> rows(m);
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            rows[i].push_back(i);
+        }
+
+        host_csr_matrix<T> A;
+        features_init_csr(A, rows, m, base);
+
+        const rocsparse_matrix_features features = features_compute(A);
+
+        ASSERT_EQ(features.lower_bandwidth, 0);
+        ASSERT_EQ(features.upper_bandwidth, 0);
+        ASSERT_EQ(features.profile, 0);
+        ASSERT_DOUBLE_EQ(features.diagonal_dominance, 1.0);
+
+        ASSERT_EQ(features.lower_dag_depth, 1);
+        ASSERT_EQ(features.lower_dag_width, m);
+        ASSERT_EQ(features.upper_dag_depth, 1);
+        ASSERT_EQ(features.upper_dag_width, m);
+
+        ASSERT_DOUBLE_EQ(features.ell_padding, 0.0);
+        ASSERT_EQ(features.bsr_nnzb[0], m / 2);
+        ASSERT_DOUBLE_EQ(features.bsr_fill[0], 0.5);
+    }
+
+    //
+    // Dense 2 x 2 blocks on the diagonal, and a dense first row of length m.
+    //
+    {
+        std::vector<std::vector<rocsparse_int>> rows(m);
+        for(rocsparse_int j = 0; j < m; ++j)
+        {
+            rows[0].push_back(j);
+        }
+
+        for(rocsparse_int i = 1; i < m; ++i)
+        {
+            rows[i] = {i - i % 2, i - i % 2 + 1};
+        }
+
+        host_csr_matrix<T> A;
+        features_init_csr(A, rows, m, base);
+
+        const rocsparse_matrix_features features = features_compute(A);
+
+        const int64_t nnz = 3 * m - 2;
+        ASSERT_EQ(features.nnz, nnz);
+        ASSERT_EQ(features.row_nnz_max, m);
+
+        // The first block row holds all m / 2 block columns, the other block
+        // rows their diagonal block
+        ASSERT_EQ(features.bsr_nnzb[0], m - 1);
+        ASSERT_DOUBLE_EQ(features.bsr_fill[0], static_cast<double>(nnz) / (4 * (m - 1)));
+
+        // ELL pads every row to the first one
+        ASSERT_DOUBLE_EQ(features.ell_padding, static_cast<double>(int64_t(m) * m - nnz) / nnz);
+
+        // The HYB width is the average row length 3, the first row keeps 3
+        // entries in ELL and moves m - 3 to COO, the other rows are padded by 1
+        ASSERT_EQ(features.hyb_ell_width, 3);
+        ASSERT_DOUBLE_EQ(features.hyb_ell_padding, static_cast<double>(m - 1) / nnz);
+        ASSERT_DOUBLE_EQ(features.hyb_coo_fraction, static_cast<double>(m - 3) / nnz);
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                      \
+    template void testing_matrix_features_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_matrix_features<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_matrix_features_extra(const Arguments& arg) {}
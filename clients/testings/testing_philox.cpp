@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+template <typename T>
+void testing_philox_bad_arg(const Arguments& arg)
+{
+}
+
+template <typename T>
+void testing_philox(const Arguments& arg)
+{
+    //
+    // Known-answer vectors of Philox4x32-10 from Random123.
+    //
+    static const uint32_t kat[3][10] = {
+        {0x00000000,
+         0x00000000,
+         0x00000000,
+         0x00000000,
+         0x00000000,
+         0x00000000,
+         0x6627e8d5,
+         0xe169c58d,
+         0xbc57ac4c,
+         0x9b00dbd8},
+        {0xffffffff,
+         0xffffffff,
+         0xffffffff,
+         0xffffffff,
+         0xffffffff,
+         0xffffffff,
+         0x408f276d,
+         0x41c83b0e,
+         0xa20bc7c6,
+         0x6d5451fd},
+        {0x243f6a88,
+         0x85a308d3,
+         0x13198a2e,
+         0x03707344,
+         0xa4093822,
+         0x299f31d0,
+         0xd16cfe09,
+         0x94fdcceb,
+         0x5001e420,
+         0x24126ea1}};
+
+    for(int i = 0; i < 3; ++i)
+    {
+        uint32_t out[4];
+        rocsparse_philox::block(kat[i], kat[i] + 4, out);
+        for(int j = 0; j < 4; ++j)
+        {
+            ASSERT_EQ(out[j], kat[i][6 + j]);
+        }
+    }
+
+    //
+    // Random matrices are identical for any number of threads.
+    //
+    int nthreads = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+
+    const int                  counts[2] = {1, std::max(nthreads, 4)};
+    host_vector<rocsparse_int> csr_row_ptr[2];
+    host_vector<rocsparse_int> csr_col_ind[2];
+    host_vector<T>             csr_val[2];
+    host_vector<rocsparse_int> bsr_row_ptr[2];
+    host_vector<rocsparse_int> bsr_col_ind[2];
+    host_vector<T>             bsr_val[2];
+    rocsparse_int              nnz[2];
+    rocsparse_int              nnzb[2];
+
+    for(int i = 0; i < 2; ++i)
+    {
+#ifdef _OPENMP
+        omp_set_num_threads(counts[i]);
+#endif
+        rocsparse_seedrand();
+        rocsparse_init_csr_random(csr_row_ptr[i],
+                                  csr_col_ind[i],
+                                  csr_val[i],
+                                  arg.M,
+                                  arg.N,
+                                  nnz[i],
+                                  rocsparse_index_base_zero,
+                                  rocsparse_matrix_init_kind_default);
+        rocsparse_init_gebsr_random(bsr_row_ptr[i],
+                                    bsr_col_ind[i],
+                                    bsr_val[i],
+                                    arg.M,
+                                    arg.N,
+                                    nnzb[i],
+                                    arg.row_block_dimA,
+                                    arg.col_block_dimA,
+                                    rocsparse_index_base_zero,
+                                    rocsparse_matrix_init_kind_default);
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(nthreads);
+#endif
+
+    ASSERT_EQ(nnz[0], nnz[1]);
+    unit_check_segments<rocsparse_int>(arg.M + 1, csr_row_ptr[0].data(), csr_row_ptr[1].data());
+    unit_check_segments<rocsparse_int>(nnz[0], csr_col_ind[0].data(), csr_col_ind[1].data());
+    unit_check_segments<T>(nnz[0], csr_val[0].data(), csr_val[1].data());
+
+    ASSERT_EQ(nnzb[0], nnzb[1]);
+    unit_check_segments<rocsparse_int>(arg.M + 1, bsr_row_ptr[0].data(), bsr_row_ptr[1].data());
+    unit_check_segments<rocsparse_int>(nnzb[0], bsr_col_ind[0].data(), bsr_col_ind[1].data());
+    unit_check_segments<T>(nnzb[0] * arg.row_block_dimA * arg.col_block_dimA,
+                           bsr_val[0].data(),
+                           bsr_val[1].data());
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_philox_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_philox<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_philox_extra(const Arguments& arg) {}
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include <cstdlib>
+#include <string>
+
+template <typename T>
+void testing_profile_report_bad_arg(const Arguments& arg)
+{
+    rocsparse_local_handle local_handle;
+    rocsparse_handle       handle = local_handle;
+
+    size_t report_size = 0;
+    char   report[1];
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_profile_report(nullptr, &report_size, nullptr),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_profile_report(handle, nullptr, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // The report does not fit into a single character
+    report_size = 1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_profile_report(handle, &report_size, report),
+                            rocsparse_status_invalid_size);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_reset_profile(nullptr), rocsparse_status_invalid_handle);
+}
+
+// Profile report of a handle, empty if it cannot be retrieved
+static std::string profile_report(rocsparse_handle handle)
+{
+    size_t report_size = 0;
+    if(rocsparse_get_profile_report(handle, &report_size, nullptr) != rocsparse_status_success
+       || report_size == 0)
+    {
+        return std::string();
+    }
+
+    std::string report(report_size, '\0');
+    if(rocsparse_get_profile_report(handle, &report_size, &report[0]) != rocsparse_status_success)
+    {
+        return std::string();
+    }
+    report.resize(report_size - 1);
+
+    return report;
+}
+
+template <typename T>
+void testing_profile_report(const Arguments& arg)
+{
+    rocsparse_int size  = arg.M;
+    rocsparse_int nnz   = arg.M;
+    rocsparse_int ncall = 3;
+
+    T h_alpha = static_cast<T>(2);
+    T h_beta  = static_cast<T>(1);
+
+    rocsparse_index_base base  = rocsparse_index_base_zero;
+    rocsparse_indextype  itype = get_indextype<rocsparse_int>();
+    rocsparse_datatype   ttype = get_datatype<T>();
+
+    // Profiling is enabled by the layer mode when the handle is created
+    size_t layer_size = 0;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_config("LAYER", &layer_size, nullptr));
+
+    std::string layer(layer_size, '\0');
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_config("LAYER", &layer_size, &layer[0]));
+    layer.resize(layer_size - 1);
+
+    const int mode = std::atoi(layer.c_str());
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_config(
+        "LAYER", std::to_string(mode | rocsparse_layer_mode_profile).c_str()));
+    rocsparse_local_handle handle;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_config("LAYER", layer.c_str()));
+
+    host_vector<rocsparse_int> hx_ind(nnz);
+    host_vector<T>             hx_val(nnz);
+    host_vector<T>             hy(size);
+
+    rocsparse_seedrand();
+    rocsparse_init_index(hx_ind, nnz, base, size + base);
+    rocsparse_init<T>(hx_val, 1, nnz, 1);
+    rocsparse_init<T>(hy, 1, size, 1);
+
+    device_vector<rocsparse_int> dx_ind(nnz);
+    device_vector<T>             dx_val(nnz);
+    device_vector<T>             dy(size);
+
+    if(!dx_ind || !dx_val || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_ind, hx_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size, hipMemcpyHostToDevice));
+
+    rocsparse_local_spvec x(size, nnz, dx_ind, dx_val, itype, base, ttype);
+    rocsparse_local_dnvec y(size, dy, ttype);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    for(rocsparse_int i = 0; i < ncall; ++i)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_axpby(handle, &h_alpha, x, &h_beta, y));
+    }
+
+    // Every call of axpby is accounted for
+    std::string report = profile_report(handle);
+
+    size_t entry = report.find("\"name\": \"rocsparse_axpby\"");
+    ASSERT_NE(entry, std::string::npos);
+    ASSERT_EQ(report.find("\"calls\": " + std::to_string(ncall), entry),
+              report.find("\"calls\": ", entry));
+    ASSERT_EQ(report.find("\"device_calls\": " + std::to_string(ncall), entry),
+              report.find("\"device_calls\": ", entry));
+
+    // Nothing is left after a reset
+    CHECK_ROCSPARSE_ERROR(rocsparse_reset_profile(handle));
+
+    report = profile_report(handle);
+    ASSERT_EQ(report.find("rocsparse_axpby"), std::string::npos);
+}
+
+#define INSTANTIATE(TYPE)                                                     \
+    template void testing_profile_report_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_profile_report<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_profile_report_extra(const Arguments& arg) {}
@@ -0,0 +1,473 @@
+/* ************************************************************************
+* Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmv_batched_csr_bad_arg(const Arguments& arg)
+{
+    J m     = 100;
+    J n     = 100;
+    I nnz   = 100;
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_operation  trans = rocsparse_operation_none;
+    rocsparse_index_base base  = rocsparse_index_base_zero;
+    rocsparse_spmv_alg   alg   = rocsparse_spmv_alg_default;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // SpMV structures
+    rocsparse_local_spmat local_A(m,
+                                  n,
+                                  nnz,
+                                  (void*)0x4,
+                                  (void*)0x4,
+                                  (void*)0x4,
+                                  itype,
+                                  jtype,
+                                  base,
+                                  ttype,
+                                  rocsparse_format_csr);
+    rocsparse_local_dnvec local_x(n, (void*)0x4, ttype);
+    rocsparse_local_dnvec local_y(m, (void*)0x4, ttype);
+
+    rocsparse_handle      handle = local_handle;
+    rocsparse_spmat_descr A      = local_A;
+    rocsparse_dnvec_descr x      = local_x;
+    rocsparse_dnvec_descr y      = local_y;
+
+    size_t buffer_size;
+    void*  temp_buffer = (void*)0x4;
+
+    // Batch count of A has to be either 1 or the batch count of y
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 3, 0, nnz),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(y, 5, m), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(handle,
+                                           trans,
+                                           &alpha,
+                                           A,
+                                           x,
+                                           &beta,
+                                           y,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spmv_stage_compute,
+                                           &buffer_size,
+                                           temp_buffer),
+                            rocsparse_status_invalid_size);
+
+    // Batch count of x has to be either 1 or the batch count of y
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 1, 0, 0), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 3, n), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(handle,
+                                           trans,
+                                           &alpha,
+                                           A,
+                                           x,
+                                           &beta,
+                                           y,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spmv_stage_compute,
+                                           &buffer_size,
+                                           temp_buffer),
+                            rocsparse_status_invalid_size);
+
+    // Batched matrices have to share the sparsity pattern
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 1, 0), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 5, m + 1, nnz),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(handle,
+                                           trans,
+                                           &alpha,
+                                           A,
+                                           x,
+                                           &beta,
+                                           y,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spmv_stage_compute,
+                                           &buffer_size,
+                                           temp_buffer),
+                            rocsparse_status_not_implemented);
+
+    // Batches of the matrix values must not overlap
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 5, 0, nnz - 1),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(handle,
+                                           trans,
+                                           &alpha,
+                                           A,
+                                           x,
+                                           &beta,
+                                           y,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spmv_stage_compute,
+                                           &buffer_size,
+                                           temp_buffer),
+                            rocsparse_status_invalid_size);
+
+    // Batches of y must not overlap
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 1, 0, 0), rocsparse_status_success);
+    rocsparse_local_dnvec local_y_short(m - 1, (void*)0x4, ttype);
+    rocsparse_dnvec_descr y_short = local_y_short;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(y_short, 5, m - 1),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(handle,
+                                           trans,
+                                           &alpha,
+                                           A,
+                                           x,
+                                           &beta,
+                                           y_short,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spmv_stage_compute,
+                                           &buffer_size,
+                                           temp_buffer),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_batched_csr(const Arguments& arg)
+{
+    J                    M             = arg.M;
+    J                    N             = arg.N;
+    J                    batch_count_A = arg.batch_count_A;
+    J                    batch_count_x = arg.batch_count_B;
+    J                    batch_count_y = arg.batch_count_C;
+    rocsparse_operation  trans         = arg.transA;
+    rocsparse_index_base base          = arg.baseA;
+    rocsparse_spmv_alg   alg           = arg.spmv_alg;
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || batch_count_y <= 0)
+    {
+        return;
+    }
+
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    // Allocate host memory for matrix
+    host_vector<I> hcsr_row_ptr;
+    host_vector<J> hcsr_col_ind;
+    host_vector<T> hcsr_val_single;
+
+    // Sample matrix
+    I nnz_A;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val_single, M, N, nnz_A, base);
+
+    // All batches share the sparsity pattern, values are strided
+    int64_t val_batch_stride = (batch_count_A > 1) ? nnz_A : 0;
+    int64_t x_batch_stride   = (batch_count_x > 1) ? N : 0;
+    int64_t y_batch_stride   = M;
+
+    host_vector<T> hcsr_val(nnz_A * batch_count_A);
+    for(J b = 0; b < batch_count_A; ++b)
+    {
+        for(I i = 0; i < nnz_A; ++i)
+        {
+            // Scale each batch differently to obtain distinct matrices
+            hcsr_val[b * nnz_A + i] = hcsr_val_single[i] * static_cast<T>(b + 1);
+        }
+    }
+
+    // Allocate host memory for vectors
+    host_vector<T> hx(N * batch_count_x);
+    host_vector<T> hy_1(M * batch_count_y);
+    host_vector<T> hy_2(M * batch_count_y);
+    host_vector<T> hy_gold(M * batch_count_y);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hx, N * batch_count_x, 1, 1);
+    rocsparse_init<T>(hy_1, M * batch_count_y, 1, 1);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // Allocate device memory
+    device_vector<I> dcsr_row_ptr(M + 1);
+    device_vector<J> dcsr_col_ind(nnz_A);
+    device_vector<T> dcsr_val(nnz_A * batch_count_A);
+    device_vector<T> dx(N * batch_count_x);
+    device_vector<T> dy_1(M * batch_count_y);
+    device_vector<T> dy_2(M * batch_count_y);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy_1 || !dy_2 || !dalpha || !dbeta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(I) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_val, hcsr_val.data(), sizeof(T) * nnz_A * batch_count_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N * batch_count_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * M * batch_count_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * M * batch_count_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create descriptors
+    rocsparse_local_spmat A(M,
+                            N,
+                            nnz_A,
+                            dcsr_row_ptr,
+                            dcsr_col_ind,
+                            dcsr_val,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_dnvec x(N, dx, ttype);
+    rocsparse_local_dnvec y1(M, dy_1, ttype);
+    rocsparse_local_dnvec y2(M, dy_2, ttype);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(A, batch_count_A, 0, val_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(x, batch_count_x, x_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y1, batch_count_y, y_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y2, batch_count_y, y_batch_stride));
+
+    // Query SpMV buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         trans,
+                                         &halpha,
+                                         A,
+                                         x,
+                                         &hbeta,
+                                         y1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmv_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, std::max(buffer_size, sizeof(int))));
+
+    // Preprocess
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         trans,
+                                         &halpha,
+                                         A,
+                                         x,
+                                         &hbeta,
+                                         y1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmv_stage_preprocess,
+                                         &buffer_size,
+                                         dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(handle,
+                                                      trans,
+                                                      &halpha,
+                                                      A,
+                                                      x,
+                                                      &hbeta,
+                                                      y1,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmv_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(handle,
+                                                      trans,
+                                                      dalpha,
+                                                      A,
+                                                      x,
+                                                      dbeta,
+                                                      y2,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmv_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_1, dy_1, sizeof(T) * M * batch_count_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_2, dy_2, sizeof(T) * M * batch_count_y, hipMemcpyDeviceToHost));
+
+        // CPU csrmv
+        host_csrmv_strided_batched<T, I, J, T, T, T>(trans,
+                                                     M,
+                                                     N,
+                                                     nnz_A,
+                                                     batch_count_y,
+                                                     halpha,
+                                                     hcsr_row_ptr,
+                                                     hcsr_col_ind,
+                                                     hcsr_val,
+                                                     val_batch_stride,
+                                                     hx,
+                                                     x_batch_stride,
+                                                     hbeta,
+                                                     hy_gold,
+                                                     y_batch_stride,
+                                                     base);
+
+        hy_gold.near_check(hy_1);
+        hy_gold.near_check(hy_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                 trans,
+                                                 &halpha,
+                                                 A,
+                                                 x,
+                                                 &hbeta,
+                                                 y1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmv_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                 trans,
+                                                 &halpha,
+                                                 A,
+                                                 x,
+                                                 &hbeta,
+                                                 y1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmv_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = batch_count_y * spmv_gflop_count(M, nnz_A, hbeta != static_cast<T>(0));
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count
+            = batch_count_y * csrmv_gbyte_count<T>(M, N, nnz_A, hbeta != static_cast<T>(0));
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz_A",
+                            nnz_A,
+                            "batch_count_A",
+                            batch_count_A,
+                            "batch_count_x",
+                            batch_count_x,
+                            "batch_count_y",
+                            batch_count_y,
+                            "alpha",
+                            halpha,
+                            "beta",
+                            hbeta,
+                            "Algorithm",
+                            rocsparse_spmvalg2string(alg),
+                            s_timing_info_perf,
+                            gpu_gflops,
+                            s_timing_info_bandwidth,
+                            gpu_gbyte,
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                       \
+    template void testing_spmv_batched_csr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_batched_csr<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+void testing_spmv_batched_csr_extra(const Arguments& arg) {}
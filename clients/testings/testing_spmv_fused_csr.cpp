@@ -0,0 +1,622 @@
+/* ************************************************************************
+* Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmv_fused_csr_bad_arg(const Arguments& arg)
+{
+    J m     = 100;
+    J n     = 100;
+    I nnz   = 100;
+    T alpha = 0.6;
+    T beta  = 0.1;
+    T gamma = 1.0;
+    T delta = 0.5;
+    T dot;
+
+    rocsparse_index_base base = rocsparse_index_base_zero;
+    rocsparse_spmv_alg   alg  = rocsparse_spmv_alg_default;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // SpMV structures
+    rocsparse_local_spmat local_A(m,
+                                  n,
+                                  nnz,
+                                  (void*)0x4,
+                                  (void*)0x4,
+                                  (void*)0x4,
+                                  itype,
+                                  jtype,
+                                  base,
+                                  ttype,
+                                  rocsparse_format_csr);
+    rocsparse_local_dnvec local_x(n, (void*)0x4, ttype);
+    rocsparse_local_dnvec local_y(m, (void*)0x4, ttype);
+    rocsparse_local_dnvec local_z(m + 1, (void*)0x4, ttype);
+    rocsparse_local_dnvec local_w(m, (void*)0x4, ttype);
+
+    rocsparse_handle      handle = local_handle;
+    rocsparse_spmat_descr A      = local_A;
+    rocsparse_dnvec_descr x      = local_x;
+    rocsparse_dnvec_descr y      = local_y;
+    rocsparse_dnvec_descr z      = local_z;
+    rocsparse_dnvec_descr w      = local_w;
+
+    size_t buffer_size;
+    void*  temp_buffer = (void*)0x4;
+
+#define PARAMS(A_, x_, y_, z_, dot_, gamma_, delta_, w_)                         \
+    handle, &alpha, A_, x_, &beta, y_, z_, dot_, gamma_, delta_, w_, ttype, alg, \
+        rocsparse_spmv_stage_compute, &buffer_size, temp_buffer
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmv_fused(nullptr, &alpha, A, x, &beta, y, nullptr, &dot, &gamma, &delta, w,
+                             ttype, alg, rocsparse_spmv_stage_compute, &buffer_size, temp_buffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmv_fused(PARAMS(nullptr, x, y, nullptr, &dot, &gamma, &delta, w)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmv_fused(PARAMS(A, nullptr, y, nullptr, &dot, &gamma, &delta, w)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmv_fused(PARAMS(A, x, nullptr, nullptr, &dot, &gamma, &delta, w)),
+        rocsparse_status_invalid_pointer);
+
+    // gamma and delta are required if w is updated
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmv_fused(PARAMS(A, x, y, nullptr, &dot, nullptr, &delta, w)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmv_fused(PARAMS(A, x, y, nullptr, &dot, &gamma, nullptr, w)),
+        rocsparse_status_invalid_pointer);
+
+    // z has to match the size of y
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_fused(PARAMS(A, x, y, z, &dot, &gamma, &delta, w)),
+                            rocsparse_status_invalid_size);
+
+    // Batched descriptors are not supported
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(y, 2, m), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spmv_fused(PARAMS(A, x, y, nullptr, &dot, &gamma, &delta, w)),
+        rocsparse_status_not_implemented);
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_fused_csr(const Arguments& arg)
+{
+    J                    M     = arg.M;
+    J                    N     = arg.N;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_spmv_alg   alg   = arg.spmv_alg;
+    rocsparse_operation  trans = rocsparse_operation_none;
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    // Scalars of the vector update w := gamma * y + delta * w
+    T hgamma = static_cast<T>(-1.5);
+    T hdelta = static_cast<T>(1);
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        return;
+    }
+
+    // Dot product with x requires a square matrix, otherwise z is used
+    bool use_z = (M != N);
+
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    // Allocate host memory for matrix
+    host_vector<I> hcsr_row_ptr;
+    host_vector<J> hcsr_col_ind;
+    host_vector<T> hcsr_val;
+
+    // Sample matrix
+    I nnz_A;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz_A, base);
+
+    // Allocate host memory for vectors
+    host_vector<T> hx(N);
+    host_vector<T> hz(M);
+    host_vector<T> hy_1(M);
+    host_vector<T> hy_2(M);
+    host_vector<T> hy_gold(M);
+    host_vector<T> hw_1(M);
+    host_vector<T> hw_2(M);
+    host_vector<T> hw_gold(M);
+    host_vector<T> hdot_1(1);
+    host_vector<T> hdot_2(1);
+    host_vector<T> hdot_gold(1);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hx, 1, N, 1);
+    rocsparse_init<T>(hz, 1, M, 1);
+    rocsparse_init<T>(hy_1, 1, M, 1);
+    rocsparse_init<T>(hw_1, 1, M, 1);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+    hw_2    = hw_1;
+    hw_gold = hw_1;
+
+    // Allocate device memory
+    device_vector<I> dcsr_row_ptr(M + 1);
+    device_vector<J> dcsr_col_ind(nnz_A);
+    device_vector<T> dcsr_val(nnz_A);
+    device_vector<T> dx(N);
+    device_vector<T> dz(M);
+    device_vector<T> dy_1(M);
+    device_vector<T> dy_2(M);
+    device_vector<T> dw_1(M);
+    device_vector<T> dw_2(M);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+    device_vector<T> dgamma(1);
+    device_vector<T> ddelta(1);
+    device_vector<T> ddot_2(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dz || !dy_1 || !dy_2 || !dw_1
+       || !dw_2 || !dalpha || !dbeta || !dgamma || !ddelta || !ddot_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(I) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dz, hz, sizeof(T) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dw_1, hw_1, sizeof(T) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dw_2, hw_2, sizeof(T) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dgamma, &hgamma, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ddelta, &hdelta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create descriptors
+    rocsparse_local_spmat A(M,
+                            N,
+                            nnz_A,
+                            dcsr_row_ptr,
+                            dcsr_col_ind,
+                            dcsr_val,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_dnvec x(N, dx, ttype);
+    rocsparse_local_dnvec z(M, dz, ttype);
+    rocsparse_local_dnvec y1(M, dy_1, ttype);
+    rocsparse_local_dnvec y2(M, dy_2, ttype);
+    rocsparse_local_dnvec w1(M, dw_1, ttype);
+    rocsparse_local_dnvec w2(M, dw_2, ttype);
+
+    rocsparse_dnvec_descr zdescr = use_z ? (rocsparse_dnvec_descr)z : nullptr;
+
+    // Query buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv_fused(handle,
+                                               &halpha,
+                                               A,
+                                               x,
+                                               &hbeta,
+                                               y1,
+                                               zdescr,
+                                               &hdot_1[0],
+                                               &hgamma,
+                                               &hdelta,
+                                               w1,
+                                               ttype,
+                                               alg,
+                                               rocsparse_spmv_stage_buffer_size,
+                                               &buffer_size,
+                                               nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    // Preprocess
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv_fused(handle,
+                                               &halpha,
+                                               A,
+                                               x,
+                                               &hbeta,
+                                               y1,
+                                               zdescr,
+                                               &hdot_1[0],
+                                               &hgamma,
+                                               &hdelta,
+                                               w1,
+                                               ttype,
+                                               alg,
+                                               rocsparse_spmv_stage_preprocess,
+                                               &buffer_size,
+                                               dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv_fused(handle,
+                                                   &halpha,
+                                                   A,
+                                                   x,
+                                                   &hbeta,
+                                                   y1,
+                                                   zdescr,
+                                                   &hdot_1[0],
+                                                   &hgamma,
+                                                   &hdelta,
+                                                   w1,
+                                                   ttype,
+                                                   alg,
+                                                   rocsparse_spmv_stage_compute,
+                                                   &buffer_size,
+                                                   dbuffer));
+        CHECK_HIP_ERROR(hipStreamSynchronize(handle.get_stream()));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv_fused(handle,
+                                                   dalpha,
+                                                   A,
+                                                   x,
+                                                   dbeta,
+                                                   y2,
+                                                   zdescr,
+                                                   ddot_2,
+                                                   dgamma,
+                                                   ddelta,
+                                                   w2,
+                                                   ttype,
+                                                   alg,
+                                                   rocsparse_spmv_stage_compute,
+                                                   &buffer_size,
+                                                   dbuffer));
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hw_1, dw_1, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hw_2, dw_2, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hdot_2, ddot_2, sizeof(T), hipMemcpyDeviceToHost));
+
+        // CPU csrmv
+        host_csrmv<T, I, J, T, T, T>(trans,
+                                     M,
+                                     N,
+                                     nnz_A,
+                                     halpha,
+                                     hcsr_row_ptr,
+                                     hcsr_col_ind,
+                                     hcsr_val,
+                                     hx,
+                                     hbeta,
+                                     hy_gold,
+                                     base,
+                                     rocsparse_matrix_type_general,
+                                     alg,
+                                     false);
+
+        // CPU vector updates
+        hdot_gold[0] = static_cast<T>(0);
+        for(J i = 0; i < M; ++i)
+        {
+            hw_gold[i] = hgamma * hy_gold[i] + hdelta * hw_gold[i];
+            hdot_gold[0] += hy_gold[i] * (use_z ? hz[i] : hx[i]);
+        }
+
+        hy_gold.near_check(hy_1);
+        hy_gold.near_check(hy_2);
+        hw_gold.near_check(hw_1);
+        hw_gold.near_check(hw_2);
+        hdot_gold.near_check(hdot_1);
+        hdot_gold.near_check(hdot_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_fused(handle,
+                                                       dalpha,
+                                                       A,
+                                                       x,
+                                                       dbeta,
+                                                       y1,
+                                                       zdescr,
+                                                       ddot_2,
+                                                       dgamma,
+                                                       ddelta,
+                                                       w1,
+                                                       ttype,
+                                                       alg,
+                                                       rocsparse_spmv_stage_compute,
+                                                       &buffer_size,
+                                                       dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_fused(handle,
+                                                       dalpha,
+                                                       A,
+                                                       x,
+                                                       dbeta,
+                                                       y1,
+                                                       zdescr,
+                                                       ddot_2,
+                                                       dgamma,
+                                                       ddelta,
+                                                       w1,
+                                                       ttype,
+                                                       alg,
+                                                       rocsparse_spmv_stage_compute,
+                                                       &buffer_size,
+                                                       dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // SpMV plus dot product (2 * M) and axpby (3 * M)
+        double gflop_count
+            = spmv_gflop_count(M, nnz_A, hbeta != static_cast<T>(0)) + 5.0 * M / 1e9;
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        // SpMV plus reading z and reading / writing w
+        double gbyte_count = csrmv_gbyte_count<T>(M, N, nnz_A, hbeta != static_cast<T>(0))
+                             + 3.0 * M * sizeof(T) / 1e9;
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz_A",
+                            nnz_A,
+                            "alpha",
+                            halpha,
+                            "beta",
+                            hbeta,
+                            "Algorithm",
+                            rocsparse_spmvalg2string(alg),
+                            s_timing_info_perf,
+                            gpu_gflops,
+                            s_timing_info_bandwidth,
+                            gpu_gbyte,
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                     \
+    template void testing_spmv_fused_csr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_fused_csr<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+// z refers to y, such that the dot product is computed from the updated y
+static void testing_spmv_fused_csr_extra_alias(const Arguments& arg, rocsparse_spmv_alg alg)
+{
+    rocsparse_int        M     = 317;
+    rocsparse_int        N     = 317;
+    rocsparse_int        nnz   = 3 * M - 2;
+    rocsparse_index_base base  = rocsparse_index_base_zero;
+    rocsparse_operation  trans = rocsparse_operation_none;
+    rocsparse_datatype   ttype = rocsparse_datatype_f64_r;
+
+    double halpha = 2.0;
+    double hbeta  = 0.5;
+    double hgamma = -1.5;
+    double hdelta = 1.0;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Tridiagonal matrix
+    host_vector<rocsparse_int> hcsr_row_ptr(M + 1);
+    host_vector<rocsparse_int> hcsr_col_ind(nnz);
+    host_vector<double>        hcsr_val(nnz);
+
+    hcsr_row_ptr[0] = 0;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int idx = hcsr_row_ptr[i];
+        for(rocsparse_int j = std::max(i - 1, 0); j <= std::min(i + 1, N - 1); ++j)
+        {
+            hcsr_col_ind[idx] = j;
+            hcsr_val[idx]     = (i == j) ? 4.0 : -1.0;
+            ++idx;
+        }
+        hcsr_row_ptr[i + 1] = idx;
+    }
+
+    host_vector<double> hx(N);
+    host_vector<double> hy(M);
+    host_vector<double> hw(M);
+    host_vector<double> hdot(1);
+
+    rocsparse_init<double>(hx, 1, N, 1);
+    rocsparse_init<double>(hy, 1, M, 1);
+    rocsparse_init<double>(hw, 1, M, 1);
+
+    host_vector<double> hy_gold = hy;
+    host_vector<double> hw_gold = hw;
+    host_vector<double> hdot_gold(1);
+
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<double>        dcsr_val(nnz);
+    device_vector<double>        dx(N);
+    device_vector<double>        dy(M);
+    device_vector<double>        dw(M);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy || !dw)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(double) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(double) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(double) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dw, hw, sizeof(double) * M, hipMemcpyHostToDevice));
+
+    rocsparse_local_spmat A(M,
+                            N,
+                            nnz,
+                            dcsr_row_ptr,
+                            dcsr_col_ind,
+                            dcsr_val,
+                            rocsparse_indextype_i32,
+                            rocsparse_indextype_i32,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_dnvec x(N, dx, ttype);
+    rocsparse_local_dnvec y(M, dy, ttype);
+    rocsparse_local_dnvec w(M, dw, ttype);
+
+#define PARAMS(stage_, buffer_size_, buffer_)                                               \
+    handle, &halpha, A, x, &hbeta, y, y, &hdot[0], &hgamma, &hdelta, w, ttype, alg, stage_, \
+        buffer_size_, buffer_
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmv_fused(PARAMS(rocsparse_spmv_stage_buffer_size, &buffer_size, nullptr)));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmv_fused(PARAMS(rocsparse_spmv_stage_preprocess, &buffer_size, dbuffer)));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmv_fused(PARAMS(rocsparse_spmv_stage_compute, &buffer_size, dbuffer)));
+    CHECK_HIP_ERROR(hipStreamSynchronize(handle.get_stream()));
+
+#undef PARAMS
+
+    CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(double) * M, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hw, dw, sizeof(double) * M, hipMemcpyDeviceToHost));
+
+    // CPU csrmv
+    host_csrmv<double, rocsparse_int, rocsparse_int, double, double, double>(
+        trans,
+        M,
+        N,
+        nnz,
+        halpha,
+        hcsr_row_ptr,
+        hcsr_col_ind,
+        hcsr_val,
+        hx,
+        hbeta,
+        hy_gold,
+        base,
+        rocsparse_matrix_type_general,
+        alg,
+        false);
+
+    // CPU vector updates, using the updated y for z
+    hdot_gold[0] = 0.0;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        hw_gold[i] = hgamma * hy_gold[i] + hdelta * hw_gold[i];
+        hdot_gold[0] += hy_gold[i] * hy_gold[i];
+    }
+
+    hy_gold.near_check(hy);
+    hw_gold.near_check(hw);
+    hdot_gold.near_check(hdot);
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+void testing_spmv_fused_csr_extra(const Arguments& arg)
+{
+    testing_spmv_fused_csr_extra_alias(arg, rocsparse_spmv_alg_default);
+    testing_spmv_fused_csr_extra_alias(arg, rocsparse_spmv_alg_csr_stream);
+    testing_spmv_fused_csr_extra_alias(arg, rocsparse_spmv_alg_csr_adaptive);
+}
@@ -0,0 +1,479 @@
+/* ************************************************************************
+* Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spsm_batched_csr_bad_arg(const Arguments& arg)
+{
+    J m     = 100;
+    J n     = 100;
+    J k     = 16;
+    I nnz   = 100;
+    T alpha = 0.6;
+
+    rocsparse_operation  trans_A = rocsparse_operation_none;
+    rocsparse_operation  trans_B = rocsparse_operation_none;
+    rocsparse_index_base base    = rocsparse_index_base_zero;
+    rocsparse_spsm_alg   alg     = rocsparse_spsm_alg_default;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // SpSM structures
+    rocsparse_local_spmat local_A(m,
+                                  n,
+                                  nnz,
+                                  (void*)0x4,
+                                  (void*)0x4,
+                                  (void*)0x4,
+                                  itype,
+                                  jtype,
+                                  base,
+                                  ttype,
+                                  rocsparse_format_csr);
+    rocsparse_local_dnmat local_B(m, k, m, (void*)0x4, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat local_C(m, k, m, (void*)0x4, ttype, rocsparse_order_column);
+
+    rocsparse_handle      handle = local_handle;
+    rocsparse_spmat_descr A      = local_A;
+    rocsparse_dnmat_descr B      = local_B;
+    rocsparse_dnmat_descr C      = local_C;
+
+    size_t buffer_size;
+    void*  temp_buffer = (void*)0x4;
+
+    // Batch count of A has to be either 1 or the batch count of C
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 3, 0, nnz),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(B, 1, 0), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(C, 5, m * k),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spsm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           A,
+                                           B,
+                                           C,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spsm_stage_buffer_size,
+                                           &buffer_size,
+                                           temp_buffer),
+                            rocsparse_status_invalid_size);
+
+    // Batch count of B has to be either 1 or the batch count of C
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 1, 0, 0), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(B, 3, m * k),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spsm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           A,
+                                           B,
+                                           C,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spsm_stage_buffer_size,
+                                           &buffer_size,
+                                           temp_buffer),
+                            rocsparse_status_invalid_size);
+
+    // All matrices of the batch have to share the sparsity pattern
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(A, 5, m + 1, nnz),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnmat_set_strided_batch(B, 1, 0), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spsm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           &alpha,
+                                           A,
+                                           B,
+                                           C,
+                                           ttype,
+                                           alg,
+                                           rocsparse_spsm_stage_buffer_size,
+                                           &buffer_size,
+                                           temp_buffer),
+                            rocsparse_status_not_implemented);
+}
+
+template <typename I, typename J, typename T>
+void testing_spsm_batched_csr(const Arguments& arg)
+{
+    J                    M             = arg.M;
+    J                    N             = arg.N;
+    J                    K             = arg.K;
+    J                    batch_count_A = arg.batch_count_A;
+    J                    batch_count_B = arg.batch_count_B;
+    J                    batch_count_C = arg.batch_count_C;
+    rocsparse_operation  trans_A       = arg.transA;
+    rocsparse_operation  trans_B       = arg.transB;
+    rocsparse_index_base base          = arg.baseA;
+    rocsparse_spsm_alg   alg           = arg.spsm_alg;
+    rocsparse_diag_type  diag          = arg.diag;
+    rocsparse_fill_mode  uplo          = arg.uplo;
+
+    T halpha = arg.get_alpha<T>();
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || K <= 0 || batch_count_C <= 0)
+    {
+        return;
+    }
+
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    // Allocate host memory for matrix
+    host_vector<I> hcsr_row_ptr;
+    host_vector<J> hcsr_col_ind;
+    host_vector<T> hcsr_val_single;
+
+    // Sample matrix
+    I nnz_A;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val_single, M, N, nnz_A, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    J B_m = (trans_B == rocsparse_operation_none) ? M : K;
+    J B_n = (trans_B == rocsparse_operation_none) ? K : M;
+
+    J C_m = (trans_B == rocsparse_operation_none) ? M : K;
+    J C_n = (trans_B == rocsparse_operation_none) ? K : M;
+
+    J ldb = (trans_B == rocsparse_operation_none) ? M : K;
+    J ldc = (trans_B == rocsparse_operation_none) ? M : K;
+
+    // All batches share the sparsity pattern, values and dense matrices are strided
+    int64_t nnz_B            = int64_t(ldb) * B_n;
+    int64_t nnz_C            = int64_t(ldc) * C_n;
+    int64_t val_batch_stride = (batch_count_A > 1) ? nnz_A : 0;
+    int64_t B_batch_stride   = (batch_count_B > 1) ? nnz_B : 0;
+    int64_t C_batch_stride   = nnz_C;
+
+    host_vector<T> hcsr_val(nnz_A * batch_count_A);
+    for(J b = 0; b < batch_count_A; ++b)
+    {
+        for(I i = 0; i < nnz_A; ++i)
+        {
+            // Scale each batch differently to obtain distinct systems
+            hcsr_val[b * nnz_A + i] = hcsr_val_single[i] * static_cast<T>(b + 1);
+        }
+    }
+
+    // Allocate host memory for dense matrices
+    host_vector<T> hB(nnz_B * batch_count_B);
+    host_vector<T> hC_1(nnz_C * batch_count_C);
+    host_vector<T> hC_2(nnz_C * batch_count_C);
+    host_vector<T> hC_gold(nnz_C * batch_count_C);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hB, nnz_B * batch_count_B, 1, 1);
+    rocsparse_init<T>(hC_1, nnz_C * batch_count_C, 1, 1);
+
+    hC_2 = hC_1;
+
+    // The solve is done in place, each batch of C starts from its batch of B
+    for(J b = 0; b < batch_count_C; ++b)
+    {
+        std::copy(hB.begin() + B_batch_stride * b,
+                  hB.begin() + B_batch_stride * b + nnz_B,
+                  hC_gold.begin() + C_batch_stride * b);
+    }
+
+    // Allocate device memory
+    device_vector<I> dcsr_row_ptr(M + 1);
+    device_vector<J> dcsr_col_ind(nnz_A);
+    device_vector<T> dcsr_val(nnz_A * batch_count_A);
+    device_vector<T> dB(nnz_B * batch_count_B);
+    device_vector<T> dC_1(nnz_C * batch_count_C);
+    device_vector<T> dC_2(nnz_C * batch_count_C);
+    device_vector<T> dalpha(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dB || !dC_1 || !dC_2 || !dalpha)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(I) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_val, hcsr_val.data(), sizeof(T) * nnz_A * batch_count_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B * batch_count_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C * batch_count_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C * batch_count_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create descriptors
+    rocsparse_local_spmat A(M,
+                            N,
+                            nnz_A,
+                            dcsr_row_ptr,
+                            dcsr_col_ind,
+                            dcsr_val,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_dnmat B(B_m, B_n, ldb, dB, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat C1(C_m, C_n, ldc, dC_1, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat C2(C_m, C_n, ldc, dC_2, ttype, rocsparse_order_column);
+
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csr_set_strided_batch(A, batch_count_A, 0, val_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(B, batch_count_B, B_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C1, batch_count_C, C_batch_stride));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C2, batch_count_C, C_batch_stride));
+
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmat_set_attribute(A, rocsparse_spmat_fill_mode, &uplo, sizeof(uplo)));
+
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmat_set_attribute(A, rocsparse_spmat_diag_type, &diag, sizeof(diag)));
+
+    // Query SpSM buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spsm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         &halpha,
+                                         A,
+                                         B,
+                                         C1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spsm_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    // Perform analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spsm(handle,
+                                         trans_A,
+                                         trans_B,
+                                         &halpha,
+                                         A,
+                                         B,
+                                         C1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spsm_stage_preprocess,
+                                         nullptr,
+                                         dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Solve on host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spsm(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      &halpha,
+                                                      A,
+                                                      B,
+                                                      C1,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spsm_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Solve on device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spsm(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      dalpha,
+                                                      A,
+                                                      B,
+                                                      C2,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spsm_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C * batch_count_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C * batch_count_C, hipMemcpyDeviceToHost));
+
+        // CPU csrsm
+        J analysis_pivot = -1;
+        J solve_pivot    = -1;
+        host_csrsm_batched<I, J, T>(M,
+                                    K,
+                                    nnz_A,
+                                    batch_count_C,
+                                    trans_A,
+                                    trans_B,
+                                    halpha,
+                                    hcsr_row_ptr,
+                                    hcsr_col_ind,
+                                    hcsr_val,
+                                    val_batch_stride,
+                                    hC_gold,
+                                    ldc,
+                                    C_batch_stride,
+                                    diag,
+                                    uplo,
+                                    base,
+                                    &analysis_pivot,
+                                    &solve_pivot);
+
+        if(analysis_pivot == -1 && solve_pivot == -1)
+        {
+            hC_gold.near_check(hC_1);
+            hC_gold.near_check(hC_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spsm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spsm_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spsm(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 &halpha,
+                                                 A,
+                                                 B,
+                                                 C1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spsm_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = batch_count_C * spsv_gflop_count(M, nnz_A, diag) * K;
+        double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = batch_count_C * csrsv_gbyte_count<T>(M, nnz_A) * K;
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "nnz_A",
+                            nnz_A,
+                            "nrhs",
+                            K,
+                            "batch_count_A",
+                            batch_count_A,
+                            "batch_count_B",
+                            batch_count_B,
+                            "batch_count_C",
+                            batch_count_C,
+                            "alpha",
+                            halpha,
+                            "Algorithm",
+                            rocsparse_spsmalg2string(alg),
+                            s_timing_info_perf,
+                            gpu_gflops,
+                            s_timing_info_bandwidth,
+                            gpu_gbyte,
+                            s_timing_info_time,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                       \
+    template void testing_spsm_batched_csr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spsm_batched_csr<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+void testing_spsm_batched_csr_extra(const Arguments& arg) {}
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_workspace_pool_bad_arg(const Arguments& arg)
+{
+    rocsparse_local_handle local_handle;
+    rocsparse_handle       handle = local_handle;
+
+    size_t nbytes            = 0;
+    size_t nbytes_cached     = 0;
+    size_t nbytes_high_water = 0;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_workspace_pool_release_threshold(nullptr, nbytes),
+                            rocsparse_status_invalid_handle);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_workspace_pool_release_threshold(nullptr, &nbytes),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_workspace_pool_release_threshold(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_workspace_pool_trim(nullptr),
+                            rocsparse_status_invalid_handle);
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_get_workspace_pool_usage(nullptr, &nbytes_cached, &nbytes_high_water),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_workspace_pool_usage(handle, nullptr, &nbytes_high_water),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_workspace_pool_usage(handle, &nbytes_cached, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    size_t nrequests = 0;
+    size_t nhits     = 0;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_workspace_pool_counters(nullptr, &nrequests, &nhits),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_workspace_pool_counters(handle, nullptr, &nhits),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_workspace_pool_counters(handle, &nrequests, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_workspace_pool(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    rocsparse_local_handle    handle;
+    rocsparse_local_mat_descr descr;
+
+    // Default release threshold
+    size_t threshold = 0;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_workspace_pool_release_threshold(handle, &threshold));
+    unit_check_scalar<size_t>(size_t(64) << 20, threshold);
+
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    host_csr_matrix<T> hA;
+    matrix_factory.init_csr(hA, M, N);
+    device_csr_matrix<T> dA(hA);
+
+    // Conversions to HYB request temporary device memory from the workspace pool, the
+    // HYB storage is released through rocsparse_hipFree
+    auto csr2hyb = [&]() {
+        rocsparse_hyb_mat hyb;
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_hyb_mat(&hyb));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb<T>(handle,
+                                                   dA.m,
+                                                   dA.n,
+                                                   descr,
+                                                   dA.val,
+                                                   dA.ptr,
+                                                   dA.ind,
+                                                   hyb,
+                                                   0,
+                                                   rocsparse_hyb_partition_auto));
+        CHECK_ROCSPARSE_ERROR(rocsparse_destroy_hyb_mat(hyb));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+    };
+
+    // Release everything, cache a single block, cache everything
+    static constexpr size_t thresholds[] = {0, size_t(1) << 20, size_t(64) << 20};
+    for(size_t t : thresholds)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_workspace_pool_release_threshold(handle, t));
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_workspace_pool_release_threshold(handle, &threshold));
+        unit_check_scalar<size_t>(t, threshold);
+
+        // Warm up the pool
+        csr2hyb();
+
+        for(int i = 0; i < 4; ++i)
+        {
+            size_t nrequests_0         = 0;
+            size_t nhits_0             = 0;
+            size_t nbytes_cached_0     = 0;
+            size_t nbytes_high_water_0 = 0;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_get_workspace_pool_counters(handle, &nrequests_0, &nhits_0));
+            CHECK_ROCSPARSE_ERROR(rocsparse_get_workspace_pool_usage(
+                handle, &nbytes_cached_0, &nbytes_high_water_0));
+
+            csr2hyb();
+
+            size_t nrequests         = 0;
+            size_t nhits             = 0;
+            size_t nbytes_cached     = 0;
+            size_t nbytes_high_water = 0;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_get_workspace_pool_counters(handle, &nrequests, &nhits));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_get_workspace_pool_usage(handle, &nbytes_cached, &nbytes_high_water));
+
+            // The pool never keeps more than the release threshold
+            ASSERT_LE(nbytes_cached, threshold);
+            ASSERT_LE(nbytes_cached, nbytes_high_water);
+
+            ASSERT_GT(nrequests, nrequests_0);
+            ASSERT_LE(nhits - nhits_0, nrequests - nrequests_0);
+
+            if(t == 0)
+            {
+                // Nothing is cached, such that no request is served by the pool
+                unit_check_scalar<size_t>(0, nbytes_cached);
+                unit_check_scalar<size_t>(nhits_0, nhits);
+            }
+            else if(nbytes_high_water_0 <= t)
+            {
+                // Each freed block is handed back to the next request of its size, such
+                // that the repeated conversion is served by the pool without new memory
+                unit_check_scalar<size_t>(nrequests - nrequests_0, nhits - nhits_0);
+                unit_check_scalar<size_t>(nbytes_cached_0, nbytes_cached);
+                unit_check_scalar<size_t>(nbytes_high_water_0, nbytes_high_water);
+            }
+        }
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_workspace_pool_trim(handle));
+
+    size_t nbytes_cached     = 0;
+    size_t nbytes_high_water = 0;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_get_workspace_pool_usage(handle, &nbytes_cached, &nbytes_high_water));
+    unit_check_scalar<size_t>(0, nbytes_cached);
+}
+
+#define INSTANTIATE(TYPE)                                                     \
+    template void testing_workspace_pool_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_workspace_pool<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_workspace_pool_extra(const Arguments& arg) {}
@@ -44,6 +44,8 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrsm)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrsv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrxmv)					\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(capture)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(check_arrays)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_coo)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_csc)	    \
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_csr)	    \
@@ -52,6 +54,7 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_gebsr)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_hyb)	    \
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_spmat)	        \
+  TRANSFORM_ROCSPARSE_TEST_ENUM(config)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_dnmat_descr)      \
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_dnvec_descr)      \
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_spmat_descr)      \
@@ -100,6 +103,8 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(doti)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(ell2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(ellmv)					\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(export_import)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(export_text)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(gather)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(gebsr2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(gebsr2gebsc)			\
@@ -115,11 +120,19 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_no_pivot)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_no_pivot_strided_batch) \
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_interleaved_batch)	\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(handle_pool)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(host_memory)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(hyb2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(hybmv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(identity)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(import_matrixmarket)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(import_rows)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(inverse_permutation)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(matrix_factory_cache)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(matrix_features)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(nnz)					\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(philox)					\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(profile_report)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr_by_percentage)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_dense2csr_by_percentage)		\
@@ -144,18 +157,28 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_batched_csc)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_batched_csr)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_bsr)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_batched_bsr)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_coo_aos)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_coo)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_batched_coo)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_csr)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_batched_csr)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_fused_csr)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_csc)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_ell)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_batched_ell)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_coo)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_batched_coo)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_csr)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_batched_csr)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsv_coo)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsv_csr)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spsv_batched_csr)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spsv_batched_coo)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spitsv_csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spvec_descr)				\
-  TRANSFORM_ROCSPARSE_TEST_ENUM(spvv)
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spvv)					\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(workspace_pool)
 // clang-format on
 
 struct rocsparse_test_enum
@@ -91,11 +91,38 @@ get_filename_component(CMAKE_MATRICES_DIR "${CMAKE_MATRICES_DIR}"
 
 file(MAKE_DIRECTORY ${PROJECT_BINARY_DIR})
 
+# The converter is multithreaded with OpenMP, and compresses .cbin files with
+# zstd and writes .bin files with rocsparseio when they are available
+set(CONVERT_FLAGS -O3)
 if(BUILD_ADDRESS_SANITIZER)
-  execute_process(COMMAND ${CMAKE_CXX_COMPILER} ${CONVERT_SOURCE} -O3 -fsanitize=address -shared-libasan -o ${PROJECT_BINARY_DIR}/mtx2csr.exe
-    RESULT_VARIABLE STATUS)
-else()
-  execute_process(COMMAND ${CMAKE_CXX_COMPILER} ${CONVERT_SOURCE} -O3 -o ${PROJECT_BINARY_DIR}/mtx2csr.exe
+  list(APPEND CONVERT_FLAGS -fsanitize=address -shared-libasan)
+endif()
+
+set(CONVERT_OPTIONAL_FLAGS)
+if(OPENMP_FOUND)
+  separate_arguments(CONVERT_OPENMP_FLAGS UNIX_COMMAND "${OpenMP_CXX_FLAGS}")
+  list(APPEND CONVERT_OPTIONAL_FLAGS ${CONVERT_OPENMP_FLAGS})
+endif()
+if(ZSTD_FOUND)
+  list(APPEND CONVERT_OPTIONAL_FLAGS -DROCSPARSE_WITH_ZSTD -I${ZSTD_INCLUDE_DIR} ${ZSTD_LIBRARY})
+endif()
+if(rocsparseio_FOUND AND TARGET roc::rocsparseio)
+  get_target_property(ROCSPARSEIO_INCLUDE_DIRS roc::rocsparseio INTERFACE_INCLUDE_DIRECTORIES)
+  get_target_property(ROCSPARSEIO_LIBRARY roc::rocsparseio LOCATION)
+  if(ROCSPARSEIO_INCLUDE_DIRS AND ROCSPARSEIO_LIBRARY)
+    foreach(dir ${ROCSPARSEIO_INCLUDE_DIRS})
+      list(APPEND CONVERT_OPTIONAL_FLAGS -I${dir})
+    endforeach()
+    list(APPEND CONVERT_OPTIONAL_FLAGS -DROCSPARSEIO ${ROCSPARSEIO_LIBRARY})
+  endif()
+endif()
+
+execute_process(COMMAND ${CMAKE_CXX_COMPILER} ${CONVERT_SOURCE} ${CONVERT_FLAGS} ${CONVERT_OPTIONAL_FLAGS} -o ${PROJECT_BINARY_DIR}/mtx2csr.exe
+  RESULT_VARIABLE STATUS)
+
+# Fall back to a serial converter if the optional dependencies cannot be used
+if(STATUS AND NOT STATUS EQUAL 0 AND CONVERT_OPTIONAL_FLAGS)
+  execute_process(COMMAND ${CMAKE_CXX_COMPILER} ${CONVERT_SOURCE} ${CONVERT_FLAGS} -o ${PROJECT_BINARY_DIR}/mtx2csr.exe
     RESULT_VARIABLE STATUS)
 endif()
 
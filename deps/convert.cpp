@@ -22,15 +22,39 @@
  * ************************************************************************ */
 
 #include <algorithm>
+#include <cinttypes>
 #include <cmath>
 #include <complex>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef ROCSPARSE_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef ROCSPARSEIO
+#include <rocsparseio.h>
+#endif
+
+//
+// Size of the blocks of entries parsed concurrently.
+//
+static constexpr int64_t mtx_block_size = 1 << 22;
+
 struct mtx_header
 {
     char banner[16];
@@ -39,21 +63,36 @@ struct mtx_header
     char data[16];
     char type[16];
     int  symmetric;
+
+    //
+    // Dimensions and number of entries, and the range of the entries in the file.
+    //
+    int64_t nrow;
+    int64_t ncol;
+    int64_t nnz;
+    int64_t data_begin;
+    int64_t data_end;
 };
 
-bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header)
+bool read_mtx_header(const char* filename, mtx_header& header)
 {
-    char line[1024];
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    if(!in.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
 
     // Check for banner
-    if(!fgets(line, 1024, f))
+    if(!std::getline(in, line))
     {
         return false;
     }
 
     // Extract banner
-    if(sscanf(line,
-              "%s %s %s %s %s",
+    if(sscanf(line.c_str(),
+              "%15s %15s %15s %15s %15s",
               header.banner,
               header.array,
               header.coord,
@@ -75,7 +114,7 @@ bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header
         ;
 
     // Check banner
-    if(strncmp(line, "%%MatrixMarket", 14))
+    if(strncmp(line.c_str(), "%%MatrixMarket", 14))
     {
         return false;
     }
@@ -110,7 +149,7 @@ bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header
     header.symmetric = !strcmp(header.type, "symmetric") || !strcmp(header.type, "hermitian");
 
     // Skip comments
-    while(fgets(line, 1024, f))
+    while(std::getline(in, line))
     {
         if(line[0] != '%')
         {
@@ -119,12 +158,32 @@ bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header
     }
 
     // Read dimensions
-    sscanf(line, "%d %d %d", &nrow, &ncol, &nnz);
+    if(sscanf(line.c_str(),
+              "%" SCNd64 " %" SCNd64 " %" SCNd64,
+              &header.nrow,
+              &header.ncol,
+              &header.nnz)
+       != 3)
+    {
+        return false;
+    }
+
+    if(header.nrow < 0 || header.ncol < 0 || header.nnz < 0)
+    {
+        return false;
+    }
+
+    // Range of the entries
+    const int64_t position = in.eof() ? -1 : static_cast<int64_t>(in.tellg());
+    in.clear();
+    in.seekg(0, std::ios::end);
+    header.data_end   = in.tellg();
+    header.data_begin = (position < 0) ? header.data_end : position;
 
     return true;
 }
 
-void set_value(double& dst, double rsrc, double isrc)
+void set_value(double& dst, double rsrc, double)
 {
     dst = rsrc;
 }
@@ -134,122 +193,357 @@ void set_value(std::complex<double>& dst, double rsrc, double isrc)
     dst = std::complex<double>(rsrc, isrc);
 }
 
-template <typename T>
-bool read_mtx_matrix(FILE*             f,
-                     const mtx_header& header,
-                     int               nrow,
-                     int               ncol,
-                     int&              nnz,
-                     std::vector<int>& row_ind,
-                     std::vector<int>& col_ind,
-                     std::vector<T>&   val)
+double conjugate(double x)
 {
-    // Cache for line
-    char line[1024];
+    return x;
+}
 
-    // Read unsorted data
-    std::vector<int> unsorted_row(header.symmetric ? 2 * nnz : nnz);
-    std::vector<int> unsorted_col(header.symmetric ? 2 * nnz : nnz);
-    std::vector<T>   unsorted_val(header.symmetric ? 2 * nnz : nnz);
+std::complex<double> conjugate(const std::complex<double>& x)
+{
+    return std::conj(x);
+}
 
-    // Read entries
-    int idx = 0;
-    while(fgets(line, 1024, f))
+//
+// Split the entries of the file into blocks of about mtx_block_size bytes,
+// each block starts at the beginning of a line.
+//
+bool split_mtx_blocks(const char* filename, const mtx_header& header, std::vector<int64_t>& offsets)
+{
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    if(!in.is_open())
     {
-        if(idx >= (header.symmetric ? 2 * nnz : nnz))
+        return false;
+    }
+
+    offsets.assign(1, header.data_begin);
+    for(int64_t pos = header.data_begin + mtx_block_size; pos < header.data_end;)
+    {
+        // Find the first newline from pos - 1
+        char window[4096];
+        in.clear();
+        in.seekg(pos - 1);
+        in.read(window, sizeof(window));
+        const int64_t count = in.gcount();
+        const char*   eol   = (const char*)memchr(window, '\n', count);
+        if(eol == nullptr)
         {
-            return false;
+            if(count < static_cast<int64_t>(sizeof(window)))
+            {
+                break;
+            }
+            pos += count;
+            continue;
+        }
+
+        const int64_t offset = pos + (eol - window);
+        if(offset >= header.data_end)
+        {
+            break;
         }
+        offsets.push_back(offset);
+        pos = offset + mtx_block_size;
+    }
+    offsets.push_back(header.data_end);
 
-        int    irow;
-        int    icol;
-        double rval;
-        double ival;
+    return true;
+}
 
-        if(!strcmp(header.data, "pattern"))
+//
+// Parse the entries of a block, f(row, col, rval, ival) is called with
+// 0-based indices for each entry.
+//
+template <typename F>
+bool parse_mtx_block(std::ifstream&     in,
+                     const mtx_header&  header,
+                     int64_t            begin,
+                     int64_t            end,
+                     std::vector<char>& buffer,
+                     F&&                f)
+{
+    const int64_t size = end - begin;
+    buffer.resize(size + 1);
+    in.clear();
+    in.seekg(begin);
+    in.read(buffer.data(), size);
+    if(!in)
+    {
+        return false;
+    }
+    buffer[size] = '\0';
+
+    const bool pattern = !strcmp(header.data, "pattern");
+    const bool complex = !strcmp(header.data, "complex");
+
+    char*       p    = buffer.data();
+    const char* last = p + size;
+    while(p < last)
+    {
+        char* eol = (char*)memchr(p, '\n', last - p);
+        if(eol != nullptr)
         {
-            sscanf(line, "%d %d", &irow, &icol);
-            rval = 1.0;
+            *eol = '\0';
         }
-        else
+
+        char* q = p + strspn(p, " \t\r");
+        if(*q != '\0' && *q != '%')
         {
-            if(!strcmp(header.data, "complex"))
+            char*         r;
+            char*         s;
+            const int64_t irow = strtoll(q, &r, 10);
+            const int64_t icol = strtoll(r, &s, 10);
+            if(r == q || s == r || irow < 1 || irow > header.nrow || icol < 1
+               || icol > header.ncol)
             {
-                sscanf(line, "%d %d %lg %lg", &irow, &icol, &rval, &ival);
+                return false;
             }
-            else
+
+            double rval = 1.0;
+            double ival = 0.0;
+            if(!pattern)
             {
-                sscanf(line, "%d %d %lg", &irow, &icol, &rval);
+                rval = strtod(s, &r);
+                if(complex)
+                {
+                    ival = strtod(r, nullptr);
+                }
             }
+
+            f(irow - 1, icol - 1, rval, ival);
         }
 
-        --irow;
-        --icol;
+        p = (eol != nullptr) ? eol + 1 : buffer.data() + size;
+    }
+
+    return true;
+}
 
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        set_value(unsorted_val[idx], rval, ival);
+//
+// Call f(row, col, rval, ival) concurrently for all entries of the file,
+// symmetric entries are expanded.
+//
+template <typename F>
+bool for_each_mtx_entry(const char*                 filename,
+                        const mtx_header&           header,
+                        const std::vector<int64_t>& offsets,
+                        F&&                         f)
+{
+    const int64_t nblocks = offsets.size() - 1;
+    std::vector<char> statuses(nblocks, 1);
 
-        ++idx;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::ifstream     in(filename, std::ios::in | std::ios::binary);
+        std::vector<char> buffer;
 
-        if(header.symmetric && irow != icol)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int64_t b = 0; b < nblocks; ++b)
         {
-            if(idx >= (header.symmetric ? 2 * nnz : nnz))
+            if(!in.is_open())
             {
-                return false;
+                statuses[b] = 0;
+                continue;
             }
 
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            set_value(unsorted_val[idx], rval, ival);
-            ++idx;
+            statuses[b] = parse_mtx_block(
+                in,
+                header,
+                offsets[b],
+                offsets[b + 1],
+                buffer,
+                [&](int64_t irow, int64_t icol, double rval, double ival) {
+                    f(irow, icol, rval, ival, false);
+                    if(header.symmetric && irow != icol)
+                    {
+                        f(icol, irow, rval, ival, true);
+                    }
+                });
         }
     }
 
-    // Store "real" number of non-zero entries
-    nnz = idx;
+    return std::all_of(statuses.begin(), statuses.end(), [](char s) { return s != 0; });
+}
 
-    // Sort by row and column index
-    std::vector<int> perm(nnz);
-    for(int i = 0; i < nnz; ++i)
+//
+// Read the matrix in CSR format with 0-based indices. The entries of each row
+// are counted in a first pass over the file, and stored at their position in
+// a second pass, rows are then sorted by column index.
+//
+template <typename T>
+bool read_mtx_matrix(const char*           filename,
+                     const mtx_header&     header,
+                     int64_t&              nnz,
+                     std::vector<int64_t>& row_ptr,
+                     std::vector<int64_t>& col_ind,
+                     std::vector<T>&       val)
+{
+    const int64_t nrow = header.nrow;
+
+    std::vector<int64_t> offsets;
+    if(!split_mtx_blocks(filename, header, offsets))
     {
-        perm[i] = i;
+        return false;
     }
 
-    std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
+    // Count the entries of each row
+    row_ptr.assign(nrow + 1, 0);
+    int64_t* count = row_ptr.data() + 1;
+    if(!for_each_mtx_entry(
+           filename, header, offsets, [&](int64_t irow, int64_t, double, double, bool) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+               ++count[irow];
+           }))
+    {
+        return false;
+    }
+
+    for(int64_t i = 0; i < nrow; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    // Store "real" number of non-zero entries
+    nnz = row_ptr[nrow];
+    if(nnz > (header.symmetric ? 2 * header.nnz : header.nnz))
+    {
+        return false;
+    }
 
-    // Resize arrays
-    row_ind.resize(nnz);
+    // Store the entries at the position of their row
     col_ind.resize(nnz);
     val.resize(nnz);
 
-    for(int i = 0; i < nnz; ++i)
+    std::vector<int64_t> next(row_ptr.begin(), row_ptr.end() - 1);
+    int                  overflow = 0;
+    if(!for_each_mtx_entry(
+           filename,
+           header,
+           offsets,
+           [&](int64_t irow, int64_t icol, double rval, double ival, bool transposed) {
+               int64_t k;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+               k = next[irow]++;
+               if(k >= row_ptr[irow + 1])
+               {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                   overflow = 1;
+                   return;
+               }
+
+               col_ind[k] = icol;
+               set_value(val[k], rval, ival);
+
+               // The transposed entries of a hermitian matrix are conjugated
+               if(transposed && !strcmp(header.type, "hermitian"))
+               {
+                   val[k] = conjugate(val[k]);
+               }
+           }))
+    {
+        return false;
+    }
+
+    for(int64_t i = 0; i < nrow && !overflow; ++i)
     {
-        row_ind[i] = unsorted_row[perm[i]];
-        col_ind[i] = unsorted_col[perm[i]];
-        val[i]     = unsorted_val[perm[i]];
+        overflow = (next[i] != row_ptr[i + 1]);
+    }
+
+    if(overflow)
+    {
+        return false;
+    }
+
+    // Sort by column index
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<std::pair<int64_t, T>> row;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(int64_t i = 0; i < nrow; ++i)
+        {
+            const int64_t begin = row_ptr[i];
+            const int64_t end   = row_ptr[i + 1];
+            if(std::is_sorted(col_ind.begin() + begin, col_ind.begin() + end))
+            {
+                continue;
+            }
+
+            row.resize(end - begin);
+            for(int64_t k = begin; k < end; ++k)
+            {
+                row[k - begin] = std::make_pair(col_ind[k], val[k]);
+            }
+
+            std::stable_sort(row.begin(),
+                             row.end(),
+                             [](const std::pair<int64_t, T>& a, const std::pair<int64_t, T>& b) {
+                                 return a.first < b.first;
+                             });
+
+            for(int64_t k = begin; k < end; ++k)
+            {
+                col_ind[k] = row[k - begin].first;
+                val[k]     = row[k - begin].second;
+            }
+        }
     }
 
     return true;
 }
 
+//
+// Write an array converted to type U by pieces.
+//
+template <typename U, typename V>
+bool write_converted(std::ofstream& out, int64_t size, const V* x)
+{
+    static constexpr int64_t piece = 1 << 20;
+    std::vector<U>           tmp(std::min(size, piece));
+    for(int64_t begin = 0; begin < size; begin += piece)
+    {
+        const int64_t end = std::min(begin + piece, size);
+        for(int64_t i = begin; i < end; ++i)
+        {
+            tmp[i - begin] = static_cast<U>(x[i]);
+        }
+        out.write((char*)tmp.data(), (end - begin) * sizeof(U));
+    }
+    return static_cast<bool>(out);
+}
+
+//
+// rocALUTION binary csr file, with 32 bit indices.
+//
 template <typename T>
-bool write_bin_matrix(
-    const char* filename, int m, int n, int nnz, const int* ptr, const int* col, const T* val)
+bool write_bin_matrix(const char*    filename,
+                      int64_t        m,
+                      int64_t        n,
+                      int64_t        nnz,
+                      const int64_t* ptr,
+                      const int64_t* col,
+                      const T*       val)
 {
+    static constexpr int64_t max_int = std::numeric_limits<int>::max();
+    if(m > max_int || n > max_int || nnz > max_int)
+    {
+        std::cerr << "Matrix exceeds the 32 bit indices of the rocALUTION format, use .cbin"
+                  << std::endl;
+        return false;
+    }
+
     std::ofstream out(filename, std::ios::out | std::ios::binary);
 
     if(!out.is_open())
@@ -265,112 +559,427 @@ bool write_bin_matrix(
     out.write((char*)&version, sizeof(int));
 
     // Data
-    out.write((char*)&m, sizeof(int));
-    out.write((char*)&n, sizeof(int));
-    out.write((char*)&nnz, sizeof(int));
-    out.write((char*)ptr, (m + 1) * sizeof(int));
-    out.write((char*)col, nnz * sizeof(int));
+    const int im   = static_cast<int>(m);
+    const int in   = static_cast<int>(n);
+    const int innz = static_cast<int>(nnz);
+    out.write((char*)&im, sizeof(int));
+    out.write((char*)&in, sizeof(int));
+    out.write((char*)&innz, sizeof(int));
+    write_converted<int>(out, m + 1, ptr);
+    write_converted<int>(out, nnz, col);
     out.write((char*)val, nnz * sizeof(T));
 
     out.close();
 
-    return true;
+    return static_cast<bool>(out);
 }
 
-bool coo_to_csr(int m, int nnz, const int* src_row, std::vector<int>& dst_ptr)
+//
+// Chunked container, see clients/common/rocsparse_chunked.hpp. The layout is
+// replicated here since the converter is built without the library headers.
+//
+static constexpr int64_t chunked_chunk_size = 1 << 18;
+
+struct chunked_header
 {
-    dst_ptr.resize(m + 1, 0);
+    char     magic[8]{'R', 'O', 'C', 'S', 'P', 'C', 'H', 'K'};
+    uint32_t version{1};
+    uint32_t format{};
+    uint32_t dir{};
+    uint32_t dirb{};
+    uint32_t base{};
+    uint32_t ptr_type{};
+    uint32_t ind_type{};
+    uint32_t val_type{};
+    uint64_t m{};
+    uint64_t n{};
+    uint64_t nnz{};
+    uint64_t row_block_dim{1};
+    uint64_t col_block_dim{1};
+};
 
-    // Compute nnz entries per row
-    for(int i = 0; i < nnz; ++i)
+struct chunked_entry
+{
+    uint64_t row_begin{};
+    uint64_t row_end{};
+    uint64_t nnz_begin{};
+    uint64_t nnz_end{};
+    uint64_t offset{};
+    uint64_t size{};
+    uint64_t raw_size{};
+    uint32_t codec{};
+    uint32_t reserved{};
+};
+
+struct chunked_footer
+{
+    uint64_t index_offset{};
+    uint64_t nchunks{};
+    char     magic[8]{'R', 'O', 'C', 'S', 'P', 'I', 'D', 'X'};
+};
+
+// rocsparse_indextype and rocsparse_datatype
+static constexpr uint32_t chunked_indextype_i32 = 2;
+static constexpr uint32_t chunked_indextype_i64 = 3;
+
+inline uint32_t chunked_datatype(double)
+{
+    return 152;
+}
+
+inline uint32_t chunked_datatype(std::complex<double>)
+{
+    return 155;
+}
+
+void chunked_put_varint(std::vector<char>& out, uint64_t x)
+{
+    while(x >= 0x80)
+    {
+        out.push_back(static_cast<char>((x & 0x7F) | 0x80));
+        x >>= 7;
+    }
+    out.push_back(static_cast<char>(x));
+}
+
+uint64_t chunked_zigzag(int64_t x)
+{
+    return (static_cast<uint64_t>(x) << 1) ^ static_cast<uint64_t>(x >> 63);
+}
+
+//
+// Codec from ROCSPARSE_CLIENTS_CHUNKED_CODEC, none or zstd[:level].
+//
+bool chunked_get_codec(int& level)
+{
+#ifdef ROCSPARSE_WITH_ZSTD
+    level = 3;
+#else
+    level = 0;
+#endif
+
+    const char* env = getenv("ROCSPARSE_CLIENTS_CHUNKED_CODEC");
+    if(env == nullptr)
     {
-        ++dst_ptr[src_row[i] + 1];
+        return true;
     }
 
-    // Exclusive scan
-    for(int i = 0; i < m; ++i)
+    if(!strcmp(env, "none"))
     {
-        dst_ptr[i + 1] += dst_ptr[i];
+        level = 0;
+        return true;
     }
 
-    return true;
+    if(!strncmp(env, "zstd", 4) && (env[4] == '\0' || env[4] == ':'))
+    {
+#ifdef ROCSPARSE_WITH_ZSTD
+        level = (env[4] == ':') ? std::max(atoi(env + 5), 1) : 3;
+        return true;
+#else
+        std::cerr << "zstd is not available" << std::endl;
+        return false;
+#endif
+    }
+
+    std::cerr << "Invalid codec '" << env << "'" << std::endl;
+    return false;
 }
 
-int main(int argc, char* argv[])
+//
+// Compress a chunk if level is positive, the chunk is kept raw if it does not
+// shrink.
+//
+#ifdef ROCSPARSE_WITH_ZSTD
+bool chunked_compress(int                      level,
+                      const std::vector<char>& raw,
+                      std::vector<char>&       out,
+                      uint32_t&                codec)
 {
-    if(argc < 3)
+    codec = 0;
+    if(level > 0)
     {
-        std::cerr << argv[0] << " <matrix.mtx> <matrix.csr>" << std::endl;
-        return -1;
+        out.resize(ZSTD_compressBound(raw.size()));
+        const size_t size = ZSTD_compress(out.data(), out.size(), raw.data(), raw.size(), level);
+        if(ZSTD_isError(size))
+        {
+            return false;
+        }
+
+        if(size < raw.size())
+        {
+            out.resize(size);
+            codec = 1;
+        }
     }
+    return true;
+}
+#else
+bool chunked_compress(int, const std::vector<char>&, std::vector<char>&, uint32_t& codec)
+{
+    codec = 0;
+    return true;
+}
+#endif
 
-    // Matrix dimensions
-    int m;
-    int n;
-    int nnz;
+template <typename T>
+bool write_chunked_matrix(const char*    filename,
+                          int64_t        m,
+                          int64_t        n,
+                          int64_t        nnz,
+                          const int64_t* ptr,
+                          const int64_t* col,
+                          const T*       val)
+{
+    static constexpr int64_t max_int = std::numeric_limits<int32_t>::max();
 
-    // Matrix mtx header
-    mtx_header header;
+    int level;
+    if(!chunked_get_codec(level))
+    {
+        return false;
+    }
 
-    // Open file for reading
-    FILE* f = fopen(argv[1], "r");
-    if(!f)
+    chunked_header header;
+    header.ptr_type = (nnz > max_int) ? chunked_indextype_i64 : chunked_indextype_i32;
+    header.ind_type = (m > max_int || n > max_int) ? chunked_indextype_i64 : chunked_indextype_i32;
+    header.val_type = chunked_datatype(T());
+    header.m        = m;
+    header.n        = n;
+    header.nnz      = nnz;
+
+    // Group consecutive rows into chunks of about chunked_chunk_size entries
+    std::vector<chunked_entry> index;
+    for(int64_t row = 0; row < m;)
     {
-        std::cerr << "Cannot open [read] .mtx file " << argv[1] << std::endl;
-        return -1;
+        const int64_t last = std::min(m, row + chunked_chunk_size);
+        int64_t       end
+            = std::upper_bound(ptr + row + 1, ptr + last + 1, ptr[row] + chunked_chunk_size) - ptr
+              - 1;
+        end = std::max(end, row + 1);
+
+        chunked_entry entry;
+        entry.row_begin = row;
+        entry.row_end   = end;
+        entry.nnz_begin = ptr[row];
+        entry.nnz_end   = ptr[end];
+        index.push_back(entry);
+        row = end;
     }
 
-    if(!read_mtx_header(f, m, n, nnz, header))
+    FILE* file = fopen(filename, "wb");
+    if(!file)
     {
-        std::cerr << "Cannot read .mtx header from " << argv[1] << std::endl;
-        return -1;
+        return false;
     }
 
-    std::vector<int>                  row_ptr;
-    std::vector<int>                  row_ind;
-    std::vector<int>                  col_ind;
-    std::vector<double>               rval;
-    std::vector<std::complex<double>> cval;
+    bool status = (1 == fwrite(&header, sizeof(header), 1, file));
 
-    bool status;
-    if(!strcmp(header.data, "complex"))
+    int nthreads = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+
+    // Encode batches of chunks in parallel and write them in order
+    const int64_t                  nchunks    = index.size();
+    const int64_t                  batch_size = 2 * static_cast<int64_t>(nthreads);
+    std::vector<std::vector<char>> raw(batch_size);
+    std::vector<std::vector<char>> compressed(batch_size);
+    std::vector<char>              statuses(batch_size);
+
+    uint64_t offset = sizeof(chunked_header);
+    for(int64_t batch_begin = 0; status && batch_begin < nchunks; batch_begin += batch_size)
     {
-        status = read_mtx_matrix(f, header, m, n, nnz, row_ind, col_ind, cval);
+        const int64_t batch_end = std::min(batch_begin + batch_size, nchunks);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t chunk = batch_begin; chunk < batch_end; ++chunk)
+        {
+            const int64_t        i     = chunk - batch_begin;
+            const chunked_entry& entry = index[chunk];
+            const size_t         bytes = (entry.nnz_end - entry.nnz_begin) * sizeof(T);
+
+            // Values, lengths of the rows and delta encoded column indices
+            raw[i].clear();
+            raw[i].resize(bytes);
+            if(bytes > 0)
+            {
+                memcpy(raw[i].data(), val + entry.nnz_begin, bytes);
+            }
+
+            for(uint64_t row = entry.row_begin; row < entry.row_end; ++row)
+            {
+                chunked_put_varint(raw[i], ptr[row + 1] - ptr[row]);
+            }
+
+            for(uint64_t row = entry.row_begin; row < entry.row_end; ++row)
+            {
+                int64_t prev = 0;
+                for(int64_t k = ptr[row]; k < ptr[row + 1]; ++k)
+                {
+                    chunked_put_varint(raw[i], chunked_zigzag(col[k] - prev));
+                    prev = col[k];
+                }
+            }
+
+            statuses[i] = chunked_compress(level, raw[i], compressed[i], index[chunk].codec);
+            index[chunk].raw_size = raw[i].size();
+        }
+
+        for(int64_t chunk = batch_begin; status && chunk < batch_end; ++chunk)
+        {
+            const int64_t            i    = chunk - batch_begin;
+            const std::vector<char>& data = (index[chunk].codec == 0) ? raw[i] : compressed[i];
+
+            index[chunk].offset = offset;
+            index[chunk].size   = data.size();
+            status = statuses[i] && (data.size() == fwrite(data.data(), 1, data.size(), file));
+            offset += data.size();
+        }
     }
-    else
+
+    // Index and footer
+    chunked_footer footer;
+    footer.index_offset = offset;
+    footer.nchunks      = index.size();
+
+    status = status
+             && (index.size() == fwrite(index.data(), sizeof(chunked_entry), index.size(), file));
+    status = status && (1 == fwrite(&footer, sizeof(footer), 1, file));
+    status = (fclose(file) == 0) && status;
+
+    return status;
+}
+
+//
+// rocsparseio binary file.
+//
+#ifdef ROCSPARSEIO
+template <typename T>
+bool write_rocsparseio_matrix(const char*    filename,
+                              int64_t        m,
+                              int64_t        n,
+                              int64_t        nnz,
+                              const int64_t* ptr,
+                              const int64_t* col,
+                              const T*       val)
+{
+    rocsparseio_handle handle;
+    if(rocsparseio_open(&handle, rocsparseio_rwmode_write, filename) != rocsparseio_status_success)
     {
-        status = read_mtx_matrix(f, header, m, n, nnz, row_ind, col_ind, rval);
+        return false;
     }
 
-    if(!status)
+    const rocsparseio_status status
+        = rocsparseio_write_sparse_csx(handle,
+                                       rocsparseio_direction_row,
+                                       m,
+                                       n,
+                                       nnz,
+                                       rocsparseio_type_int64,
+                                       ptr,
+                                       rocsparseio_type_int64,
+                                       col,
+                                       std::is_same<T, double>{} ? rocsparseio_type_float64
+                                                                 : rocsparseio_type_complex64,
+                                       val,
+                                       rocsparseio_index_base_zero);
+
+    return (rocsparseio_close(handle) == rocsparseio_status_success)
+           && (status == rocsparseio_status_success);
+}
+#else
+template <typename T>
+bool write_rocsparseio_matrix(
+    const char* filename, int64_t, int64_t, int64_t, const int64_t*, const int64_t*, const T*)
+{
+    std::cerr << "rocsparseio is not available, cannot write " << filename << std::endl;
+    return false;
+}
+#endif
+
+bool has_suffix(const std::string& s, const std::string& suffix)
+{
+    return s.size() >= suffix.size() && !s.compare(s.size() - suffix.size(), suffix.size(), suffix);
+}
+
+//
+// Write the matrix in the format given by the suffix of the filename, .cbin
+// for chunked files, .bin for rocsparseio files and rocALUTION otherwise.
+//
+template <typename T>
+bool write_matrix(const char*                 filename,
+                  int64_t                     m,
+                  int64_t                     n,
+                  int64_t                     nnz,
+                  const std::vector<int64_t>& ptr,
+                  const std::vector<int64_t>& col,
+                  const std::vector<T>&       val)
+{
+    if(has_suffix(filename, ".cbin"))
     {
-        std::cerr << "Cannot read .mtx data from " << argv[1] << std::endl;
-        return -1;
+        return write_chunked_matrix(filename, m, n, nnz, ptr.data(), col.data(), val.data());
+    }
+    else if(has_suffix(filename, ".bin"))
+    {
+        return write_rocsparseio_matrix(filename, m, n, nnz, ptr.data(), col.data(), val.data());
     }
+    else
+    {
+        return write_bin_matrix(filename, m, n, nnz, ptr.data(), col.data(), val.data());
+    }
+}
 
-    // Close file
-    fclose(f);
+template <typename T>
+int convert(const char* filename, const mtx_header& header, int noutputs, char** outputs)
+{
+    int64_t              nnz;
+    std::vector<int64_t> row_ptr;
+    std::vector<int64_t> col_ind;
+    std::vector<T>       val;
 
-    if(!coo_to_csr(m, nnz, row_ind.data(), row_ptr))
+    if(!read_mtx_matrix(filename, header, nnz, row_ptr, col_ind, val))
     {
-        std::cerr << "Cannot convert " << argv[1] << " from COO to CSR." << std::endl;
+        std::cerr << "Cannot read .mtx data from " << filename << std::endl;
         return -1;
     }
 
-    if(!strcmp(header.data, "complex"))
+    for(int i = 0; i < noutputs; ++i)
     {
-        status = write_bin_matrix(argv[2], m, n, nnz, row_ptr.data(), col_ind.data(), cval.data());
+        if(!write_matrix(outputs[i], header.nrow, header.ncol, nnz, row_ptr, col_ind, val))
+        {
+            std::cerr << "Cannot write " << outputs[i] << std::endl;
+            return -1;
+        }
     }
-    else
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
     {
-        status = write_bin_matrix(argv[2], m, n, nnz, row_ptr.data(), col_ind.data(), rval.data());
+        std::cerr << argv[0] << " <matrix.mtx> <matrix.csr|matrix.bin|matrix.cbin> ..."
+                  << std::endl;
+        return -1;
     }
 
-    if(!status)
+    // Matrix mtx header
+    mtx_header header;
+
+    if(!read_mtx_header(argv[1], header))
     {
-        std::cerr << "Cannot open [write] " << argv[2] << std::endl;
+        std::cerr << "Cannot read .mtx header from " << argv[1] << std::endl;
         return -1;
     }
 
-    return 0;
+    if(!strcmp(header.data, "complex"))
+    {
+        return convert<std::complex<double>>(argv[1], header, argc - 2, argv + 2);
+    }
+    else
+    {
+        return convert<double>(argv[1], header, argc - 2, argv + 2);
+    }
 }
@@ -71,6 +71,91 @@ rocsparse_status rocsparse_create_handle(rocsparse_handle* handle);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_handle(rocsparse_handle handle);
 
+/*! \ingroup aux_module
+ *  \brief Create a rocsparse handle pool
+ *
+ *  \details
+ *  \p rocsparse_create_handle_pool creates a pool of rocSPARSE library contexts.
+ *  Handles released to the pool are kept fully initialized, such that subsequent
+ *  calls to rocsparse_handle_pool_acquire() do not need to create a new context. The
+ *  pool should be destroyed at the end using rocsparse_destroy_handle_pool().
+ *
+ *  \note
+ *  The handle pool is thread-safe.
+ *
+ *  @param[out]
+ *  pool    the pointer to the handle pool.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p pool pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_handle_pool(rocsparse_handle_pool* pool);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a rocsparse handle pool
+ *
+ *  \details
+ *  \p rocsparse_destroy_handle_pool destroys all handles that are currently kept in
+ *  the pool, and the pool itself. Handles that are acquired and not released yet
+ *  remain valid and must be destroyed using rocsparse_destroy_handle().
+ *
+ *  @param[in]
+ *  pool    the handle pool.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p pool pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_handle_pool(rocsparse_handle_pool pool);
+
+/*! \ingroup aux_module
+ *  \brief Acquire a rocsparse handle from a handle pool
+ *
+ *  \details
+ *  \p rocsparse_handle_pool_acquire returns a handle of the pool that has been created
+ *  on the active device. If no such handle is available, a new handle is created. The
+ *  handle uses the default stream and \ref rocsparse_pointer_mode_host, and should be
+ *  given back to the pool using rocsparse_handle_pool_release().
+ *
+ *  @param[in]
+ *  pool    the handle pool.
+ *  @param[out]
+ *  handle  the pointer to the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p pool pointer is invalid.
+ *  \retval rocsparse_status_invalid_handle \p handle pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_handle_pool_acquire(rocsparse_handle_pool pool,
+                                               rocsparse_handle*     handle);
+
+/*! \ingroup aux_module
+ *  \brief Release a rocsparse handle to a handle pool
+ *
+ *  \details
+ *  \p rocsparse_handle_pool_release gives a handle back to the pool. The stream of the
+ *  handle is reset to the default stream and its pointer mode to
+ *  \ref rocsparse_pointer_mode_host. The handle must not be used after it has been
+ *  released. Any handle can be released to the pool, including handles created by
+ *  rocsparse_create_handle().
+ *
+ *  @param[in]
+ *  pool    the handle pool.
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p pool pointer is invalid.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_handle_pool_release(rocsparse_handle_pool pool,
+                                               rocsparse_handle      handle);
+
 /*! \ingroup aux_module
  *  \brief Specify user defined HIP stream
  *
@@ -170,6 +255,264 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle        handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify the release threshold of the workspace pool
+ *
+ *  \details
+ *  \p rocsparse_set_workspace_pool_release_threshold specifies the amount of device
+ *  memory released by rocSPARSE that the workspace pool of the rocSPARSE library context
+ *  keeps cached for subsequent allocations. A cached block is reused once the work
+ *  queued on the stream it has been released on is done, without synchronizing the
+ *  device. Whenever more memory is cached, the largest cached blocks are released to
+ *  the device. By default, the threshold is 64 MB.
+ *
+ *  \note
+ *  All rocSPARSE library contexts that use the same stream on the same device share
+ *  one workspace pool, the release threshold applies to the pool of the stream that is
+ *  currently set for \p handle.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  nbytes          the release threshold in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_workspace_pool_release_threshold(rocsparse_handle handle,
+                                                                size_t           nbytes);
+
+/*! \ingroup aux_module
+ *  \brief Get the release threshold of the workspace pool
+ *
+ *  \details
+ *  \p rocsparse_get_workspace_pool_release_threshold gets the release threshold of the
+ *  workspace pool of the rocSPARSE library context.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  nbytes          the release threshold in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p nbytes pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_workspace_pool_release_threshold(rocsparse_handle handle,
+                                                                size_t*          nbytes);
+
+/*! \ingroup aux_module
+ *  \brief Release the cached memory of the workspace pool
+ *
+ *  \details
+ *  \p rocsparse_workspace_pool_trim releases all device memory that is cached by the
+ *  workspace pool of the rocSPARSE library context. Memory in use by pending function
+ *  calls is not affected.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_workspace_pool_trim(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Get the memory usage of the workspace pool
+ *
+ *  \details
+ *  \p rocsparse_get_workspace_pool_usage gets the amount of device memory that is
+ *  cached by the workspace pool of the rocSPARSE library context and the high-water
+ *  mark of the device memory that has been held by the pool.
+ *
+ *  @param[in]
+ *  handle              the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  nbytes_cached       the cached device memory in bytes.
+ *  @param[out]
+ *  nbytes_high_water   the high-water mark of the held device memory in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p nbytes_cached or \p nbytes_high_water
+ *           pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_workspace_pool_usage(rocsparse_handle handle,
+                                                    size_t*          nbytes_cached,
+                                                    size_t*          nbytes_high_water);
+
+/*! \ingroup aux_module
+ *  \brief Get the counters of the workspace pool
+ *
+ *  \details
+ *  \p rocsparse_get_workspace_pool_counters gets the number of device memory requests
+ *  that have been served by the workspace pool of the rocSPARSE library context, and
+ *  the number of requests that have been served by a cached block.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  nrequests       the number of requests.
+ *  @param[out]
+ *  nhits           the number of requests served by a cached block.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p nrequests or \p nhits pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_workspace_pool_counters(rocsparse_handle handle,
+                                                       size_t*          nrequests,
+                                                       size_t*          nhits);
+
+/*! \ingroup aux_module
+ *  \brief Get the profile report
+ *
+ *  \details
+ *  \p rocsparse_get_profile_report writes the statistics that have been collected by
+ *  the rocSPARSE library context into a null-terminated JSON string. For each profiled
+ *  routine and stage, the report holds the number of calls, the host time spent in the
+ *  calls, the device execution time measured with events on the stream of the context,
+ *  as well as the modelled number of floating point operations and bytes moved.
+ *  Statistics are collected only if the environment variable \p ROCSPARSE_LAYER
+ *  enables \ref rocsparse_layer_mode_profile when the context is created, otherwise
+ *  the list of routines in the report is empty.
+ *
+ *  If \p report is a null pointer, the size of the report including the terminating
+ *  null character is returned in \p report_size. Generating the report waits for the
+ *  completion of all profiled calls.
+ *
+ *  \note
+ *  Profiling is available for the generic sparse routines, e.g. \ref rocsparse_spmv.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[inout]
+ *  report_size     the size of the array \p report in characters.
+ *  @param[out]
+ *  report          array of \p report_size characters, can be a null pointer.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p report_size pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p report_size is too small to hold the
+ *           report.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_get_profile_report(rocsparse_handle handle, size_t* report_size, char* report);
+
+/*! \ingroup aux_module
+ *  \brief Reset the profile
+ *
+ *  \details
+ *  \p rocsparse_reset_profile discards the statistics that have been collected by the
+ *  rocSPARSE library context.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_reset_profile(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Set a runtime configuration entry
+ *
+ *  \details
+ *  \p rocsparse_set_config sets the value of a process-wide runtime configuration
+ *  entry. Entries are initialized from their default value, from the configuration
+ *  file named by the environment variable \p ROCSPARSE_CONFIG_FILE and from the
+ *  environment variables prefixed with \p ROCSPARSE_, in increasing order of priority.
+ *  A rocSPARSE library context takes a snapshot of the configuration when it is
+ *  created, later changes only apply to contexts that are created afterwards.
+ *
+ *  The following entries are available
+ *  - \p LAYER, int, default 0, the \ref rocsparse_layer_mode of the context.
+ *  - \p LOG_TRACE_PATH, \p LOG_BENCH_PATH, \p LOG_DEBUG_PATH, string, default empty,
+ *    the log files, logs are written to stderr if empty.
+ *  - \p LOG_TRACE_BINARY_PATH, string, default rocsparse_trace.bin, the binary trace
+ *    file.
+ *  - \p CAPTURE_PATH, string, default rocsparse_capture, the capture directory.
+ *  - \p CAPTURE_DEDUPLICATE, bool, default 1, whether captured operands are written
+ *    once.
+ *  - \p CAPTURE_DENSE, bool, default 1, whether the values of captured dense operands
+ *    are written.
+ *  - \p POINTER_MODE, enum host or device, default host, the initial
+ *    \ref rocsparse_pointer_mode of the context.
+ *  - \p HANDLE_BUFFER_SIZE, size, default 1M, the minimum size of the device buffer
+ *    of the context.
+ *  - \p WORKSPACE_POOL_RELEASE_THRESHOLD, size, default 64M, the initial release
+ *    threshold of the workspace pool of the context.
+ *
+ *  Sizes accept the suffixes \p K, \p M and \p G.
+ *
+ *  @param[in]
+ *  name            the name of the entry, with or without the \p ROCSPARSE_ prefix.
+ *  @param[in]
+ *  value           the value of the entry.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p name or \p value pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p name is not a configuration entry or
+ *           \p value is not a valid value of the entry.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_config(const char* name, const char* value);
+
+/*! \ingroup aux_module
+ *  \brief Get a runtime configuration entry
+ *
+ *  \details
+ *  \p rocsparse_get_config gets the value of a process-wide runtime configuration
+ *  entry as a null-terminated string. If \p value is a null pointer, the size of
+ *  the value including the terminating null character is returned in \p value_size.
+ *
+ *  @param[in]
+ *  name            the name of the entry, with or without the \p ROCSPARSE_ prefix.
+ *  @param[inout]
+ *  value_size      the size of the array \p value in characters.
+ *  @param[out]
+ *  value           array of \p value_size characters, can be a null pointer.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p name or \p value_size pointer is
+ *           invalid.
+ *  \retval rocsparse_status_invalid_value \p name is not a configuration entry.
+ *  \retval rocsparse_status_invalid_size \p value_size is too small to hold the
+ *           value.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_config(const char* name, size_t* value_size, char* value);
+
+/*! \ingroup aux_module
+ *  \brief Load a runtime configuration file
+ *
+ *  \details
+ *  \p rocsparse_load_config sets the runtime configuration entries that are listed
+ *  in a file. Each line of the file holds a \p name \p = \p value pair, the
+ *  characters following \p # are ignored. Valid entries are set even if the file
+ *  contains invalid ones.
+ *
+ *  @param[in]
+ *  filename        the name of the configuration file.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p filename pointer is invalid.
+ *  \retval rocsparse_status_internal_error the file cannot be opened.
+ *  \retval rocsparse_status_invalid_value the file contains invalid entries.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_load_config(const char* filename);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
@@ -1715,6 +2058,47 @@ rocsparse_status rocsparse_csc_set_strided_batch(rocsparse_spmat_descr descr,
                                                  int64_t               offsets_batch_stride,
                                                  int64_t               rows_values_batch_stride);
 
+/*! \ingroup aux_module
+ *  \brief Set the batch count and batch stride in the sparse ELL matrix descriptor
+ *
+ *  @param[inout]
+ *  descr        the pointer to the sparse ELL matrix descriptor.
+ *  @param[in]
+ *  batch_count  batch_count of the sparse ELL matrix.
+ *  @param[in]
+ *  batch_stride batch stride of the sparse ELL matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
+ *  \retval rocsparse_status_invalid_size if \p batch_count or \p batch_stride is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ell_set_strided_batch(rocsparse_spmat_descr descr,
+                                                 int                   batch_count,
+                                                 int64_t               batch_stride);
+
+/*! \ingroup aux_module
+ *  \brief Set the batch count, block row offset batch stride and the block column indices batch stride in the sparse BSR matrix descriptor
+ *
+ *  @param[inout]
+ *  descr                       the pointer to the sparse BSR matrix descriptor.
+ *  @param[in]
+ *  batch_count                 batch_count of the sparse BSR matrix.
+ *  @param[in]
+ *  offsets_batch_stride        block row offset batch stride of the sparse BSR matrix.
+ *  @param[in]
+ *  columns_values_batch_stride block column indices batch stride of the sparse BSR matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
+ *  \retval rocsparse_status_invalid_size if \p batch_count or \p offsets_batch_stride or \p columns_values_batch_stride is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsr_set_strided_batch(rocsparse_spmat_descr descr,
+                                                 int                   batch_count,
+                                                 int64_t               offsets_batch_stride,
+                                                 int64_t               columns_values_batch_stride);
+
 /*! \ingroup aux_module
  *  \brief Get the requested attribute data from the sparse matrix descriptor
  *
@@ -1876,6 +2260,52 @@ rocsparse_status rocsparse_const_dnvec_get_values(rocsparse_const_dnvec_descr de
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_dnvec_set_values(rocsparse_dnvec_descr descr, void* values);
 
+/*! \ingroup aux_module
+ *  \brief Get the batch count and batch stride from the dense vector descriptor
+ *
+ *  @param[in]
+ *  descr        the pointer to the dense vector descriptor.
+ *  @param[out]
+ *  batch_count  the batch count in the dense vector.
+ *  @param[out]
+ *  batch_stride the batch stride in the dense vector.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr, \p batch_count or \p batch_stride
+ *          is invalid.
+ *  \retval rocsparse_status_not_initialized if \p descr has not been initialized.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnvec_get_strided_batch(rocsparse_const_dnvec_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride);
+
+/*! \ingroup aux_module
+ *  \brief Set the batch count and batch stride in the dense vector descriptor
+ *
+ *  \details
+ *  A strided batch of dense vectors consists of \p batch_count vectors of
+ *  length \p size, where vector \p i starts at \p values + \p i * \p batch_stride.
+ *
+ *  @param[inout]
+ *  descr        the pointer to the dense vector descriptor.
+ *  @param[in]
+ *  batch_count  the batch count in the dense vector.
+ *  @param[in]
+ *  batch_stride the batch stride in the dense vector (must be at least \p size if
+ *               \p batch_count is greater than one).
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
+ *  \retval rocsparse_status_not_initialized if \p descr has not been initialized.
+ *  \retval rocsparse_status_invalid_value if \p batch_count is not positive, \p batch_stride
+ *          is negative or, for more than one batch, \p batch_stride is smaller than \p size.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnvec_set_strided_batch(rocsparse_dnvec_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride);
+
 /*! \ingroup aux_module
  *  \brief Create a dense matrix descriptor
  *  \details
@@ -2026,8 +2456,9 @@ rocsparse_status rocsparse_dnmat_set_values(rocsparse_dnmat_descr descr, void* v
  *  batch_stride the batch stride in the dense matrix.
  *
  *  \retval rocsparse_status_success the operation completed successfully.
- *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
- *  \retval rocsparse_status_invalid_size if \p batch_count or \p batch_stride is invalid.
+ *  \retval rocsparse_status_invalid_pointer if \p descr, \p batch_count or \p batch_stride
+ *          is invalid.
+ *  \retval rocsparse_status_not_initialized if \p descr has not been initialized.
  */
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_dnmat_get_strided_batch(rocsparse_const_dnmat_descr descr,
@@ -2042,11 +2473,16 @@ rocsparse_status rocsparse_dnmat_get_strided_batch(rocsparse_const_dnmat_descr d
  *  @param[in]
  *  batch_count  the batch count in the dense matrix.
  *  @param[in]
- *  batch_stride the batch stride in the dense matrix.
+ *  batch_stride the batch stride in the dense matrix (must be at least \p ld * \p cols
+ *               for column order or \p ld * \p rows for row order if \p batch_count
+ *               is greater than one).
  *
  *  \retval rocsparse_status_success the operation completed successfully.
  *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
- *  \retval rocsparse_status_invalid_size if \p batch_count or \p batch_stride is invalid.
+ *  \retval rocsparse_status_not_initialized if \p descr has not been initialized.
+ *  \retval rocsparse_status_invalid_value if \p batch_count is not positive, \p batch_stride
+ *          is negative or, for more than one batch, \p batch_stride is smaller than the size of a
+ *          single matrix.
  */
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_dnmat_set_strided_batch(rocsparse_dnmat_descr descr,
@@ -21338,6 +21338,15 @@ rocsparse_status rocsparse_spvv(rocsparse_handle            handle,
 *  The sparse matrix formats currently supported are: rocsparse_format_bsr, rocsparse_format_coo,
 *  rocsparse_format_coo_aos, rocsparse_format_csr, rocsparse_format_csc and rocsparse_format_ell.
 *
+*  \note
+*  If the batch count of \p y (see rocsparse_dnvec_set_strided_batch()) is larger than one,
+*  a strided batched SpMV \f$y_i := \alpha \cdot op(A_i) \cdot x_i + \beta \cdot y_i\f$ is
+*  performed. The batch count of \p mat and \p x has to be either one or equal to the batch
+*  count of \p y. All matrices \f$A_i\f$ share the sparsity pattern of the first batch, i.e. the
+*  offsets batch stride has to be zero and only the values are strided. Strided batched SpMV is
+*  currently only supported for non-transposed general matrices in rocsparse_format_bsr,
+*  rocsparse_format_coo, rocsparse_format_csr and rocsparse_format_ell.
+*
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
@@ -21693,6 +21702,119 @@ __attribute__((deprecated("This function is deprecated and will be removed in a
                       size_t*                     buffer_size,
                       void*                       temp_buffer);
 
+/*! \ingroup generic_module
+*  \brief Sparse matrix vector multiplication with fused vector updates
+*
+*  \details
+*  \ref rocsparse_spmv_fused multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+*  matrix and the dense vector \f$x\f$ and adds the result to the dense vector \f$y\f$
+*  that is multiplied by the scalar \f$\beta\f$, such that
+*  \f[
+*    y := \alpha \cdot A \cdot x + \beta \cdot y.
+*  \f]
+*  Optionally, the updated vector \f$y\f$ is used for the dot product
+*  \f[
+*    dot := y^T \cdot z,
+*  \f]
+*  where \f$z\f$ defaults to \f$x\f$ if \p z is nullptr, and for the vector update
+*  \f[
+*    w := \gamma \cdot y + \delta \cdot w.
+*  \f]
+*  The dot product is skipped if \p dot is nullptr and the vector update is skipped if
+*  \p w is nullptr. Computing these together with the SpMV avoids reading \f$y\f$ again
+*  from memory, which is the common pattern in Krylov subspace methods such as CG or
+*  BiCGStab.
+*
+*  \note
+*  This function writes the required allocation size (in bytes) to \p buffer_size and
+*  returns without performing the operation, when a nullptr is passed for
+*  \p temp_buffer.
+*
+*  \note
+*  Only the rocsparse_format_csr format with general matrix type and uniform precisions
+*  is currently supported. The dot product is computed without conjugation.
+*
+*  \note
+*  With \ref rocsparse_spmv_alg_csr_stream, all updates are applied within a single
+*  kernel. With \ref rocsparse_spmv_alg_csr_adaptive, the dot product and the vector update
+*  are computed in a single additional pass over \f$y\f$ after the SpMV.
+*  \ref rocsparse_spmv_alg_default selects the single kernel path whenever \p dot or \p w
+*  is given, and adaptive SpMV otherwise.
+*
+*  \note
+*  \p z may refer to the same vector as \p y, in which case \f$dot := y^T \cdot y\f$ is
+*  computed from the updated \f$y\f$. \p w must not alias \p x, \p y or \p z.
+*
+*  \note
+*  The stages follow \ref rocsparse_spmv. As for \ref rocsparse_spvv, hipStreamSynchronize
+*  has to be called before the dot product is read, when using host pointer mode.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  mat          matrix descriptor.
+*  @param[in]
+*  x            vector descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[inout]
+*  y            vector descriptor.
+*  @param[in]
+*  z            vector descriptor for the dot product, can be nullptr.
+*  @param[out]
+*  dot          result of the dot product, can be nullptr.
+*  @param[in]
+*  gamma        scalar \f$\gamma\f$, can be nullptr if \p w is nullptr.
+*  @param[in]
+*  delta        scalar \f$\delta\f$, can be nullptr if \p w is nullptr.
+*  @param[inout]
+*  w            vector descriptor for the vector update, can be nullptr.
+*  @param[in]
+*  compute_type floating point precision for the computation.
+*  @param[in]
+*  alg          SpMV algorithm for the computation.
+*  @param[in]
+*  stage        SpMV stage for the computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p temp_buffer is nullptr.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
+*               the required allocation size (in bytes) is written to \p buffer_size and
+*               function returns without performing the operation.
+*
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context \p handle was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat, \p x, \p beta, \p y or
+*               \p buffer_size pointer is invalid, or \p w is given without \p gamma and
+*               \p delta.
+*  \retval      rocsparse_status_invalid_size the sizes of the vectors do not match the
+*               matrix.
+*  \retval      rocsparse_status_invalid_value the value of \p compute_type, \p alg or \p stage
+*               is incorrect.
+*  \retval      rocsparse_status_not_implemented the matrix format, matrix type,
+*               \p compute_type or batched descriptors are currently not supported.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmv_fused(rocsparse_handle            handle,
+                                      const void*                 alpha,
+                                      rocsparse_const_spmat_descr mat,
+                                      rocsparse_const_dnvec_descr x,
+                                      const void*                 beta,
+                                      const rocsparse_dnvec_descr y,
+                                      rocsparse_const_dnvec_descr z,
+                                      void*                       dot,
+                                      const void*                 gamma,
+                                      const void*                 delta,
+                                      rocsparse_dnvec_descr       w,
+                                      rocsparse_datatype          compute_type,
+                                      rocsparse_spmv_alg          alg,
+                                      rocsparse_spmv_stage        stage,
+                                      size_t*                     buffer_size,
+                                      void*                       temp_buffer);
+
 /*! \ingroup generic_module
 *  \brief Sparse triangular solve
 *
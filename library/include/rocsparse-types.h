@@ -66,6 +66,16 @@ typedef struct ihipStream_t* hipStream_t;
  */
 typedef struct _rocsparse_handle* rocsparse_handle;
 
+/*! \ingroup types_module
+ *  \brief Pool of rocSPARSE library contexts.
+ *
+ *  \details
+ *  The rocSPARSE handle pool keeps initialized rocSPARSE handles for reuse. It must be
+ *  initialized using rocsparse_create_handle_pool() and should be destroyed at the end
+ *  using rocsparse_destroy_handle_pool().
+ */
+typedef struct _rocsparse_handle_pool* rocsparse_handle_pool;
+
 /*! \ingroup types_module
  *  \brief Descriptor of the matrix.
  *
@@ -393,10 +403,13 @@ typedef enum rocsparse_pointer_mode_
  */
 typedef enum rocsparse_layer_mode
 {
-    rocsparse_layer_mode_none      = 0x0, /**< layer is not active. */
-    rocsparse_layer_mode_log_trace = 0x1, /**< layer is in logging mode. */
-    rocsparse_layer_mode_log_bench = 0x2, /**< layer is in benchmarking mode. */
-    rocsparse_layer_mode_log_debug = 0x4 /**< layer is in debug mode. */
+    rocsparse_layer_mode_none             = 0x0,  /**< layer is not active. */
+    rocsparse_layer_mode_log_trace        = 0x1,  /**< layer is in logging mode. */
+    rocsparse_layer_mode_log_bench        = 0x2,  /**< layer is in benchmarking mode. */
+    rocsparse_layer_mode_log_debug        = 0x4,  /**< layer is in debug mode. */
+    rocsparse_layer_mode_log_trace_binary = 0x8,  /**< layer is in binary logging mode. */
+    rocsparse_layer_mode_profile          = 0x10, /**< layer is in profiling mode. */
+    rocsparse_layer_mode_capture          = 0x20  /**< layer is in capture mode. */
 } rocsparse_layer_mode;
 
 /*! \ingroup types_module
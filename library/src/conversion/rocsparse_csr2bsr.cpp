@@ -351,7 +351,7 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
-            temp_storage_ptr = handle->buffer;
+            temp_storage_ptr = handle->get_buffer();
             temp_alloc       = false;
         }
         else
@@ -659,7 +659,7 @@ try
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
-            temp_storage_ptr = handle->buffer;
+            temp_storage_ptr = handle->get_buffer();
             temp_alloc       = false;
         }
         else
@@ -705,7 +705,7 @@ try
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
+        temp_storage_ptr = handle->get_buffer();
         temp_alloc       = false;
     }
     else
@@ -247,7 +247,7 @@ try
     rocsparse_int nblocks = CSR2ELL_DIM;
 
     // Get workspace from handle device buffer
-    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(handle->buffer);
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(handle->get_buffer());
 
     dim3 csr2ell_blocks(nblocks);
     dim3 csr2ell_threads(CSR2ELL_DIM);
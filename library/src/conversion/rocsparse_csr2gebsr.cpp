@@ -716,7 +716,7 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
-            temp_storage_ptr = handle->buffer;
+            temp_storage_ptr = handle->get_buffer();
             temp_alloc       = false;
         }
         else
@@ -981,7 +981,7 @@ try
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= temp_storage_size_bytes)
         {
-            temp_storage_ptr = handle->buffer;
+            temp_storage_ptr = handle->get_buffer();
             temp_alloc       = false;
         }
         else
@@ -1140,7 +1140,7 @@ try
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
-            temp_storage_ptr = handle->buffer;
+            temp_storage_ptr = handle->get_buffer();
             temp_alloc       = false;
         }
         else
@@ -1187,7 +1187,7 @@ try
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
+        temp_storage_ptr = handle->get_buffer();
         temp_alloc       = false;
     }
     else
@@ -167,7 +167,7 @@ rocsparse_status rocsparse_dense2csx_impl(rocsparse_handle          handle,
         // Device buffer should be sufficient for rocprim in most cases
         if(handle->buffer_size >= temp_storage_bytes)
         {
-            d_temp_storage = handle->buffer;
+            d_temp_storage = handle->get_buffer();
             d_temp_alloc   = false;
         }
         else
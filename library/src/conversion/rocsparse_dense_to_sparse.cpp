@@ -223,8 +223,8 @@ try
     // Logging
     log_trace(handle,
               "rocsparse_dense_sparse",
-              (const void*&)mat_A,
-              (const void*&)mat_B,
+              mat_A,
+              mat_B,
               alg,
               (const void*&)buffer_size,
               (const void*&)temp_buffer);
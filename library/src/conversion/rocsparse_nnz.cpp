@@ -262,7 +262,7 @@ rocsparse_status rocsparse_nnz_impl(rocsparse_handle          handle,
         I* d_nnz;
         if(handle->buffer_size >= temp_storage_size_bytes)
         {
-            d_nnz            = (I*)handle->buffer;
+            d_nnz            = (I*)handle->get_buffer();
             temp_storage_ptr = d_nnz + 1;
             temp_alloc       = false;
         }
@@ -374,7 +374,7 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
+        temp_storage_ptr = handle->get_buffer();
         temp_alloc       = false;
     }
     else
@@ -284,7 +284,7 @@ rocsparse_status rocsparse_prune_dense2csr_nnz_template(rocsparse_handle
     // Device buffer should be sufficient for rocprim in most cases
     if(handle->buffer_size >= temp_storage_bytes)
     {
-        d_temp_storage = handle->buffer;
+        d_temp_storage = handle->get_buffer();
         d_temp_alloc   = false;
     }
     else
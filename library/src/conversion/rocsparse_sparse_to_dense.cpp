@@ -166,8 +166,8 @@ try
     // Logging
     log_trace(handle,
               "rocsparse_sparse_dense",
-              (const void*&)mat_A,
-              (const void*&)mat_B,
+              mat_A,
+              mat_B,
               alg,
               (const void*&)buffer_size,
               (const void*&)temp_buffer);
@@ -523,7 +523,7 @@ try
 
     if(handle->buffer_size >= rocprim_size)
     {
-        rocprim_buffer = handle->buffer;
+        rocprim_buffer = handle->get_buffer();
         rocprim_alloc  = false;
     }
     else
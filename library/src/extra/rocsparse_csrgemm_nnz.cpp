@@ -706,6 +706,29 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle
     return rocsparse_status_success;
 }
 
+#define LAUNCH_CSRGEMM_NNZ_WF_PER_ROW(GROUP, HASHSIZE)                                  \
+    hipLaunchKernelGGL(                                                                 \
+        (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, HASHSIZE, CSRGEMM_NNZ_HASH>), \
+        dim3((h_group_size[GROUP] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),              \
+        dim3(CSRGEMM_DIM),                                                              \
+        0,                                                                              \
+        stream,                                                                         \
+        h_group_size[GROUP],                                                            \
+        &d_group_offset[GROUP],                                                         \
+        d_perm,                                                                         \
+        csr_row_ptr_A,                                                                  \
+        csr_col_ind_A,                                                                  \
+        csr_row_ptr_B,                                                                  \
+        csr_col_ind_B,                                                                  \
+        csr_row_ptr_D,                                                                  \
+        csr_col_ind_D,                                                                  \
+        csr_row_ptr_C,                                                                  \
+        base_A,                                                                         \
+        base_B,                                                                         \
+        base_D,                                                                         \
+        mul,                                                                            \
+        add)
+
 template <typename I, typename J>
 static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          handle,
                                                           rocsparse_operation       trans_A,
@@ -911,27 +934,14 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 4
 #define CSRGEMM_HASHSIZE 32
-        hipLaunchKernelGGL(
-            (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            h_group_size[0],
-            &d_group_offset[0],
-            d_perm,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_row_ptr_C,
-            base_A,
-            base_B,
-            base_D,
-            mul,
-            add);
+        if(handle->csrgemm_hash_scale == 2)
+        {
+            LAUNCH_CSRGEMM_NNZ_WF_PER_ROW(0, 2 * CSRGEMM_HASHSIZE);
+        }
+        else
+        {
+            LAUNCH_CSRGEMM_NNZ_WF_PER_ROW(0, CSRGEMM_HASHSIZE);
+        }
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -943,27 +953,14 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 64
-        hipLaunchKernelGGL(
-            (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            h_group_size[1],
-            &d_group_offset[1],
-            d_perm,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_row_ptr_C,
-            base_A,
-            base_B,
-            base_D,
-            mul,
-            add);
+        if(handle->csrgemm_hash_scale == 2)
+        {
+            LAUNCH_CSRGEMM_NNZ_WF_PER_ROW(1, 2 * CSRGEMM_HASHSIZE);
+        }
+        else
+        {
+            LAUNCH_CSRGEMM_NNZ_WF_PER_ROW(1, CSRGEMM_HASHSIZE);
+        }
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1131,6 +1131,41 @@ static inline rocsparse_status csrgemm_numeric_launcher(rocsparse_handle     han
     ROCSPARSE_RETURN_STATUS(success);
 }
 
+#define LAUNCH_CSRGEMM_NUMERIC_FILL_WF_PER_ROW(GROUP, HASHSIZE)            \
+    hipLaunchKernelGGL(                                                    \
+        (csrgemm_numeric_fill_wf_per_row_kernel<CSRGEMM_DIM,               \
+                                                CSRGEMM_SUB,               \
+                                                HASHSIZE,                  \
+                                                CSRGEMM_FLL_HASH>),        \
+        dim3((h_group_size[GROUP] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1), \
+        dim3(CSRGEMM_DIM),                                                 \
+        0,                                                                 \
+        stream,                                                            \
+        h_group_size[GROUP],                                               \
+        std::max(k, n),                                                    \
+        &d_group_offset[GROUP],                                            \
+        d_perm,                                                            \
+        alpha_device_host,                                                 \
+        csr_row_ptr_A,                                                     \
+        csr_col_ind_A,                                                     \
+        csr_val_A,                                                         \
+        csr_row_ptr_B,                                                     \
+        csr_col_ind_B,                                                     \
+        csr_val_B,                                                         \
+        beta_device_host,                                                  \
+        csr_row_ptr_D,                                                     \
+        csr_col_ind_D,                                                     \
+        csr_val_D,                                                         \
+        csr_row_ptr_C,                                                     \
+        csr_col_ind_C,                                                     \
+        csr_val_C,                                                         \
+        base_A,                                                            \
+        base_B,                                                            \
+        descr_C->base,                                                     \
+        base_D,                                                            \
+        info_C->csrgemm_info->mul,                                         \
+        info_C->csrgemm_info->add)
+
 template <typename I, typename J, typename T, typename U>
 static inline rocsparse_status
     rocsparse_csrgemm_numeric_calc_template(rocsparse_handle          handle,
@@ -1220,38 +1255,14 @@ static inline rocsparse_status
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 16
-        hipLaunchKernelGGL((csrgemm_numeric_fill_wf_per_row_kernel<CSRGEMM_DIM,
-                                                                   CSRGEMM_SUB,
-                                                                   CSRGEMM_HASHSIZE,
-                                                                   CSRGEMM_FLL_HASH>),
-                           dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-                           dim3(CSRGEMM_DIM),
-                           0,
-                           stream,
-                           h_group_size[0],
-                           std::max(k, n),
-                           &d_group_offset[0],
-                           d_perm,
-                           alpha_device_host,
-                           csr_row_ptr_A,
-                           csr_col_ind_A,
-                           csr_val_A,
-                           csr_row_ptr_B,
-                           csr_col_ind_B,
-                           csr_val_B,
-                           beta_device_host,
-                           csr_row_ptr_D,
-                           csr_col_ind_D,
-                           csr_val_D,
-                           csr_row_ptr_C,
-                           csr_col_ind_C,
-                           csr_val_C,
-                           base_A,
-                           base_B,
-                           descr_C->base,
-                           base_D,
-                           info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+        if(handle->csrgemm_hash_scale == 2)
+        {
+            LAUNCH_CSRGEMM_NUMERIC_FILL_WF_PER_ROW(0, 2 * CSRGEMM_HASHSIZE);
+        }
+        else
+        {
+            LAUNCH_CSRGEMM_NUMERIC_FILL_WF_PER_ROW(0, CSRGEMM_HASHSIZE);
+        }
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1263,38 +1274,14 @@ static inline rocsparse_status
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
 #define CSRGEMM_HASHSIZE 32
-        hipLaunchKernelGGL((csrgemm_numeric_fill_wf_per_row_kernel<CSRGEMM_DIM,
-                                                                   CSRGEMM_SUB,
-                                                                   CSRGEMM_HASHSIZE,
-                                                                   CSRGEMM_FLL_HASH>),
-                           dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-                           dim3(CSRGEMM_DIM),
-                           0,
-                           stream,
-                           h_group_size[1],
-                           std::max(k, n),
-                           &d_group_offset[1],
-                           d_perm,
-                           alpha_device_host,
-                           csr_row_ptr_A,
-                           csr_col_ind_A,
-                           csr_val_A,
-                           csr_row_ptr_B,
-                           csr_col_ind_B,
-                           csr_val_B,
-                           beta_device_host,
-                           csr_row_ptr_D,
-                           csr_col_ind_D,
-                           csr_val_D,
-                           csr_row_ptr_C,
-                           csr_col_ind_C,
-                           csr_val_C,
-                           base_A,
-                           base_B,
-                           descr_C->base,
-                           base_D,
-                           info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+        if(handle->csrgemm_hash_scale == 2)
+        {
+            LAUNCH_CSRGEMM_NUMERIC_FILL_WF_PER_ROW(1, 2 * CSRGEMM_HASHSIZE);
+        }
+        else
+        {
+            LAUNCH_CSRGEMM_NUMERIC_FILL_WF_PER_ROW(1, CSRGEMM_HASHSIZE);
+        }
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
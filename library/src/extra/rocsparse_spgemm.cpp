@@ -619,12 +619,12 @@ try
               "rocsparse_spgemm",
               trans_A,
               trans_B,
-              (const void*&)alpha,
-              (const void*&)A,
-              (const void*&)B,
-              (const void*&)beta,
-              (const void*&)D,
-              (const void*&)C,
+              rocsparse_scalar_arg{alpha, compute_type},
+              A,
+              B,
+              rocsparse_scalar_arg{beta, compute_type},
+              D,
+              C,
               compute_type,
               alg,
               stage,
@@ -700,6 +700,10 @@ try
         return rocsparse_status_type_mismatch;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_spgemm", rocsparse_profile_models::spgemm(A, B, D, C, stage));
+
     return rocsparse_spgemm_template_dispatch(A->row_type,
                                               A->col_type,
                                               compute_type,
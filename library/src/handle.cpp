@@ -22,14 +22,89 @@
  * ************************************************************************ */
 
 #include "handle.h"
+#include "capture.h"
+#include "config.h"
 #include "definitions.h"
 #include "logging.h"
+#include "trace.h"
 #include "utility.h"
 
+#include <algorithm>
 #include <hip/hip_runtime.h>
+#include <map>
+#include <memory>
+#include <mutex>
 
 ROCSPARSE_KERNEL(1) void init_kernel(){};
 
+/*******************************************************************************
+ * Process-wide cache of the device properties and device constants, shared by
+ * all handles created on the same device. Entries are created with the first
+ * handle on a device and live until the process exits.
+ ******************************************************************************/
+namespace
+{
+    struct rocsparse_device_cache
+    {
+        hipDeviceProp_t properties;
+
+        float*                    sone;
+        double*                   done;
+        rocsparse_float_complex*  cone;
+        rocsparse_double_complex* zone;
+    };
+
+    const rocsparse_device_cache& get_device_cache(int device)
+    {
+        static std::mutex                                                   mutex;
+        static std::map<int, std::unique_ptr<const rocsparse_device_cache>> caches;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto& entry = caches[device];
+        if(entry == nullptr)
+        {
+            auto cache = std::make_unique<rocsparse_device_cache>();
+
+            THROW_IF_HIP_ERROR(hipGetDeviceProperties(&cache->properties, device));
+
+            // Execute empty kernel for initialization
+            hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, 0);
+
+            // All constants in one allocation, 16 bytes apart. The constants are
+            // never released, hence they bypass the memory statistics.
+            static constexpr size_t stride = sizeof(rocsparse_double_complex);
+
+            char* constants;
+            THROW_IF_HIP_ERROR(hipMalloc((void**)&constants, 4 * stride));
+
+            cache->sone = reinterpret_cast<float*>(constants);
+            cache->done = reinterpret_cast<double*>(constants + stride);
+            cache->cone = reinterpret_cast<rocsparse_float_complex*>(constants + 2 * stride);
+            cache->zone = reinterpret_cast<rocsparse_double_complex*>(constants + 3 * stride);
+
+            float  hsone = 1.0f;
+            double hdone = 1.0;
+
+            rocsparse_float_complex  hcone = rocsparse_float_complex(1.0f, 0.0f);
+            rocsparse_double_complex hzone = rocsparse_double_complex(1.0, 0.0);
+
+            THROW_IF_HIP_ERROR(
+                hipMemcpy(cache->sone, &hsone, sizeof(float), hipMemcpyHostToDevice));
+            THROW_IF_HIP_ERROR(
+                hipMemcpy(cache->done, &hdone, sizeof(double), hipMemcpyHostToDevice));
+            THROW_IF_HIP_ERROR(hipMemcpy(
+                cache->cone, &hcone, sizeof(rocsparse_float_complex), hipMemcpyHostToDevice));
+            THROW_IF_HIP_ERROR(hipMemcpy(
+                cache->zone, &hzone, sizeof(rocsparse_double_complex), hipMemcpyHostToDevice));
+
+            entry = std::move(cache);
+        }
+
+        return *entry;
+    }
+}
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
@@ -37,7 +112,10 @@ _rocsparse_handle::_rocsparse_handle()
 {
     // Default device is active device
     THROW_IF_HIP_ERROR(hipGetDevice(&device));
-    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&properties, device));
+
+    const rocsparse_device_cache& cache = get_device_cache(device);
+
+    properties = cache.properties;
 
     // Device wavefront size
     wavefront_size = properties.warpSize;
@@ -49,16 +127,18 @@ _rocsparse_handle::_rocsparse_handle()
     asic_rev = 0;
 #endif
 
+    // Snapshot of the runtime configuration
+    const rocsparse_config& config = ROCSPARSE_CONFIG;
+
     // Layer mode
-    char* str_layer_mode;
-    if((str_layer_mode = getenv("ROCSPARSE_LAYER")) == NULL)
-    {
-        layer_mode = rocsparse_layer_mode_none;
-    }
-    else
-    {
-        layer_mode = (rocsparse_layer_mode)(atoi(str_layer_mode));
-    }
+    layer_mode = (rocsparse_layer_mode)(config.get_int(rocsparse_config::LAYER));
+
+    // Pointer mode
+    pointer_mode = (rocsparse_pointer_mode)(config.get_enum(rocsparse_config::POINTER_MODE));
+
+    // Workspace pool
+    workspace_pool = rocsparse_workspace_pool::acquire(
+        device, stream, config.get_size(rocsparse_config::WORKSPACE_POOL_RELEASE_THRESHOLD));
 
     // Obtain size for coomv device buffer
     rocsparse_int nthreads = properties.maxThreadsPerBlock;
@@ -67,57 +147,62 @@ _rocsparse_handle::_rocsparse_handle()
 
     size_t coomv_size = (((sizeof(rocsparse_int) + 16) * nblocks - 1) / 256 + 1) * 256;
 
-    // Allocate device buffer
-    buffer_size = (coomv_size > 1024 * 1024) ? coomv_size : 1024 * 1024;
-    THROW_IF_HIP_ERROR(rocsparse_hipMalloc(&buffer, buffer_size));
-
-    // Device one
-    THROW_IF_HIP_ERROR(rocsparse_hipMalloc(&sone, sizeof(float)));
-    THROW_IF_HIP_ERROR(rocsparse_hipMalloc(&done, sizeof(double)));
-    THROW_IF_HIP_ERROR(rocsparse_hipMalloc(&cone, sizeof(rocsparse_float_complex)));
-    THROW_IF_HIP_ERROR(rocsparse_hipMalloc(&zone, sizeof(rocsparse_double_complex)));
-
-    // Execute empty kernel for initialization
-    hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, stream);
+    // Device buffer is allocated on first use
+    buffer_size = std::max(coomv_size, config.get_size(rocsparse_config::HANDLE_BUFFER_SIZE));
 
-    // Execute memset for initialization
-    THROW_IF_HIP_ERROR(hipMemsetAsync(sone, 0, sizeof(float), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(done, 0, sizeof(double), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(cone, 0, sizeof(rocsparse_float_complex), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(zone, 0, sizeof(rocsparse_double_complex), stream));
+    // Kernel variants
+    csrmv_adaptive_block_size
+        = std::stoi(config.get_string(rocsparse_config::CSRMV_ADAPTIVE_BLOCK_SIZE));
+    csrmv_adaptive_rows_for_vector
+        = std::stoi(config.get_string(rocsparse_config::CSRMV_ADAPTIVE_ROWS_FOR_VECTOR));
+    csrgemm_hash_scale = std::stoi(config.get_string(rocsparse_config::CSRGEMM_HASH_SCALE));
 
-    float  hsone = 1.0f;
-    double hdone = 1.0;
+    // Device one
+    sone = cache.sone;
+    done = cache.done;
+    cone = cache.cone;
+    zone = cache.zone;
 
-    rocsparse_float_complex  hcone = rocsparse_float_complex(1.0f, 0.0f);
-    rocsparse_double_complex hzone = rocsparse_double_complex(1.0, 0.0);
+    // Open log file
+    if(layer_mode & rocsparse_layer_mode_log_trace)
+    {
+        open_log_stream(
+            &log_trace_os, &log_trace_ofs, config.get_string(rocsparse_config::LOG_TRACE_PATH));
+    }
 
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(sone, &hsone, sizeof(float), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(done, &hdone, sizeof(double), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(
-        cone, &hcone, sizeof(rocsparse_float_complex), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(
-        zone, &hzone, sizeof(rocsparse_double_complex), hipMemcpyHostToDevice, stream));
+    // Start binary trace
+    if(layer_mode & rocsparse_layer_mode_log_trace_binary)
+    {
+        rocsparse_trace::instance().start(
+            config.get_string(rocsparse_config::LOG_TRACE_BINARY_PATH));
+    }
 
-    // Wait for device transfer to finish
-    THROW_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Start capture
+    if(layer_mode & rocsparse_layer_mode_capture)
+    {
+        rocsparse_capture::instance().start(config.get_string(rocsparse_config::CAPTURE_PATH),
+                                            config.get_bool(rocsparse_config::CAPTURE_DEDUPLICATE),
+                                            config.get_bool(rocsparse_config::CAPTURE_DENSE));
+    }
 
-    // Open log file
-    if(layer_mode & rocsparse_layer_mode_log_trace)
+    // Enable profiling
+    if(layer_mode & rocsparse_layer_mode_profile)
     {
-        open_log_stream(&log_trace_os, &log_trace_ofs, "ROCSPARSE_LOG_TRACE_PATH");
+        profile = new rocsparse_profile;
     }
 
     // Open log_bench file
     if(layer_mode & rocsparse_layer_mode_log_bench)
     {
-        open_log_stream(&log_bench_os, &log_bench_ofs, "ROCSPARSE_LOG_BENCH_PATH");
+        open_log_stream(
+            &log_bench_os, &log_bench_ofs, config.get_string(rocsparse_config::LOG_BENCH_PATH));
     }
 
     // Open log_debug file
     if(layer_mode & rocsparse_layer_mode_log_debug)
     {
-        open_log_stream(&log_debug_os, &log_debug_ofs, "ROCSPARSE_LOG_DEBUG_PATH");
+        open_log_stream(
+            &log_debug_os, &log_debug_ofs, config.get_string(rocsparse_config::LOG_DEBUG_PATH));
     }
 }
 
@@ -126,11 +211,12 @@ _rocsparse_handle::_rocsparse_handle()
  ******************************************************************************/
 _rocsparse_handle::~_rocsparse_handle()
 {
-    PRINT_IF_HIP_ERROR(rocsparse_hipFree(buffer));
-    PRINT_IF_HIP_ERROR(rocsparse_hipFree(sone));
-    PRINT_IF_HIP_ERROR(rocsparse_hipFree(done));
-    PRINT_IF_HIP_ERROR(rocsparse_hipFree(cone));
-    PRINT_IF_HIP_ERROR(rocsparse_hipFree(zone));
+    if(buffer != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(rocsparse_hipFree(buffer));
+    }
+
+    delete profile;
 
     // Close log files
     if(log_trace_ofs.is_open())
@@ -147,6 +233,18 @@ _rocsparse_handle::~_rocsparse_handle()
     }
 }
 
+/*******************************************************************************
+ * get device buffer, allocated on first use
+ ******************************************************************************/
+void* _rocsparse_handle::get_buffer()
+{
+    if(buffer == nullptr)
+    {
+        THROW_IF_HIP_ERROR(rocsparse_hipMalloc(&buffer, buffer_size));
+    }
+    return buffer;
+}
+
 /*******************************************************************************
  * Exactly like cuSPARSE, rocSPARSE only uses one stream for one API routine
  ******************************************************************************/
@@ -160,6 +258,9 @@ rocsparse_status _rocsparse_handle::set_stream(hipStream_t user_stream)
 {
     // TODO check if stream is valid
     stream = user_stream;
+    // A new pool for the stream inherits the release threshold of the current one
+    workspace_pool = rocsparse_workspace_pool::acquire(
+        device, user_stream, workspace_pool->get_release_threshold());
     return rocsparse_status_success;
 }
 
@@ -172,6 +273,46 @@ rocsparse_status _rocsparse_handle::get_stream(hipStream_t* user_stream) const
     return rocsparse_status_success;
 }
 
+/*******************************************************************************
+ * handle pool
+ ******************************************************************************/
+_rocsparse_handle_pool::~_rocsparse_handle_pool()
+{
+    for(rocsparse_handle handle : handles)
+    {
+        delete handle;
+    }
+}
+
+rocsparse_handle _rocsparse_handle_pool::acquire(int device)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Most recently released first
+    for(auto it = handles.rbegin(); it != handles.rend(); ++it)
+    {
+        if((*it)->device == device)
+        {
+            rocsparse_handle handle = *it;
+            handles.erase(std::next(it).base());
+            return handle;
+        }
+    }
+
+    return nullptr;
+}
+
+void _rocsparse_handle_pool::release(rocsparse_handle handle)
+{
+    // Restore the default state
+    handle->set_stream(0);
+    handle->pointer_mode
+        = (rocsparse_pointer_mode)(ROCSPARSE_CONFIG.get_enum(rocsparse_config::POINTER_MODE));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    handles.push_back(handle);
+}
+
 /********************************************************************************
  * \brief rocsparse_csrmv_info is a structure holding the rocsparse csrmv info
  * data gathered during csrmv_analysis. It must be initialized using the
@@ -321,14 +462,16 @@ rocsparse_status rocsparse_copy_csrmv_info(rocsparse_csrmv_info       dest,
             hipMemcpy(dest->wg_ids, src->wg_ids, J_size * src->size, hipMemcpyDeviceToDevice));
     }
 
-    dest->size         = src->size;
-    dest->trans        = src->trans;
-    dest->m            = src->m;
-    dest->n            = src->n;
-    dest->nnz          = src->nnz;
-    dest->max_rows     = src->max_rows;
-    dest->index_type_I = src->index_type_I;
-    dest->index_type_J = src->index_type_J;
+    dest->size            = src->size;
+    dest->trans           = src->trans;
+    dest->m               = src->m;
+    dest->n               = src->n;
+    dest->nnz             = src->nnz;
+    dest->max_rows        = src->max_rows;
+    dest->block_size      = src->block_size;
+    dest->rows_for_vector = src->rows_for_vector;
+    dest->index_type_I    = src->index_type_I;
+    dest->index_type_J    = src->index_type_J;
 
     // Not owned by the info struct. Just pointers to externally allocated memory
     dest->descr       = src->descr;
@@ -0,0 +1,221 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+#include "logging.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//
+// Capture directory written in rocsparse_layer_mode_capture and read by the
+// rocsparse-replay client, see clients/include/rocsparse_capture_reader.hpp.
+//
+// The directory holds the file calls.txt, made of lines of space separated
+// tokens:
+// - call <routine> <arg>...: a call with its arguments in the order of the
+//   trace log. Sparse and dense descriptors are written spmat:<id>,
+//   spvec:<id>, dnvec:<id> and dnmat:<id>, scalars of generic routines
+//   scalar:<hexadecimal bytes>, complex numbers <real>,<imag>, and other
+//   arguments the way the trace log prints them.
+// - <kind> <id> <key>=<value>...: the definition of an operand, written
+//   before the first call that refers to it. The key data is 1 if its values
+//   are written.
+//
+// The values of the batch b of an operand are written with rocsparseio into
+// <id>_<b>.bin, in the format of the operand, except for COO AoS and ELL
+// matrices, written as COO matrices, and for sparse vectors, written as COO
+// matrices of one row.
+//
+class rocsparse_capture
+{
+public:
+    static rocsparse_capture& instance();
+
+    //
+    // Create the directory, once per process.
+    //
+    void start(const std::string& path, bool deduplicate, bool dense);
+
+    //
+    // Capture the call if the layer mode of the handle asks for it and the
+    // stream is not captured into a graph.
+    //
+    bool enabled(rocsparse_handle handle) const;
+
+    //
+    // Operand of a call, with its values copied to the host.
+    //
+    struct operand_t
+    {
+        std::string                    kind;
+        std::string                    definition;
+        std::vector<std::vector<char>> arrays;
+        int64_t                        batch_count{1};
+        bool                           data{};
+
+        _rocsparse_spmat_descr spmat{};
+        _rocsparse_spvec_descr spvec{};
+        _rocsparse_dnvec_descr dnvec{};
+        _rocsparse_dnmat_descr dnmat{};
+    };
+
+    bool dense() const
+    {
+        return this->m_dense;
+    }
+
+    //
+    // Write the operand once and return its id.
+    //
+    std::string write(const operand_t& operand);
+
+    //
+    // Append a line to calls.txt.
+    //
+    void call(const std::string& line);
+
+    rocsparse_capture(const rocsparse_capture&) = delete;
+    rocsparse_capture& operator=(const rocsparse_capture&) = delete;
+
+private:
+    rocsparse_capture() = default;
+    ~rocsparse_capture();
+
+    bool write_values(const std::string& id, const operand_t& operand);
+
+    std::mutex                                           m_mutex;
+    FILE*                                                m_calls{};
+    std::string                                          m_path;
+    bool                                                 m_deduplicate{};
+    bool                                                 m_dense{};
+    uint64_t                                             m_noperands{};
+    std::map<std::array<unsigned char, 32>, std::string> m_operands;
+};
+
+//
+// Arguments of a call, the operands are copied to the host asynchronously and
+// written once the stream of the handle is synchronized. Errors are reported
+// to std::cerr, such that capturing never changes the outcome of the call.
+//
+class rocsparse_capture_call
+{
+public:
+    rocsparse_capture_call(rocsparse_handle handle, const std::string& name);
+
+    void operator()(rocsparse_const_spmat_descr x);
+    void operator()(rocsparse_const_spvec_descr x);
+    void operator()(rocsparse_const_dnvec_descr x);
+    void operator()(rocsparse_const_dnmat_descr x);
+    void operator()(const rocsparse_scalar_arg& x);
+    void operator()(float x);
+    void operator()(double x);
+    void operator()(const rocsparse_float_complex& x);
+    void operator()(const rocsparse_double_complex& x);
+
+    void operator()(rocsparse_spmat_descr x)
+    {
+        (*this)(static_cast<rocsparse_const_spmat_descr>(x));
+    }
+
+    void operator()(rocsparse_spvec_descr x)
+    {
+        (*this)(static_cast<rocsparse_const_spvec_descr>(x));
+    }
+
+    void operator()(rocsparse_dnvec_descr x)
+    {
+        (*this)(static_cast<rocsparse_const_dnvec_descr>(x));
+    }
+
+    void operator()(rocsparse_dnmat_descr x)
+    {
+        (*this)(static_cast<rocsparse_const_dnmat_descr>(x));
+    }
+
+    //
+    // Anything else is recorded the way it is printed.
+    //
+    template <typename T>
+    void operator()(const T& x)
+    {
+        std::ostringstream os;
+        os << x;
+        this->m_args.push_back(os.str());
+    }
+
+    //
+    // Synchronize the stream, write the operands and the call.
+    //
+    void finish();
+
+private:
+    struct scalar_t
+    {
+        size_t        arg;
+        size_t        size;
+        unsigned char bytes[16];
+    };
+
+    rocsparse_status copy(const void* data, size_t size, rocsparse_capture::operand_t& operand);
+    void             operand(rocsparse_capture::operand_t& operand);
+
+    rocsparse_handle                          m_handle;
+    std::string                               m_name;
+    std::vector<std::string>                  m_args;
+    std::vector<std::pair<size_t, size_t>>    m_refs; // argument, operand
+    std::vector<rocsparse_capture::operand_t> m_operands;
+    std::deque<scalar_t>                      m_scalars;
+    bool                                      m_copied{};
+    bool                                      m_failed{};
+};
+
+//
+// Record a routine call into the capture directory.
+//
+template <typename H, typename... Ts>
+void log_capture(rocsparse_handle handle, const H& head, Ts&&... xs)
+{
+    if(!rocsparse_capture::instance().enabled(handle))
+    {
+        return;
+    }
+
+    std::ostringstream name;
+    name << head;
+
+    rocsparse_capture_call call(handle, name.str());
+    (void)std::initializer_list<int>{((void)call(xs), 0)...};
+    call.finish();
+}
@@ -805,8 +805,8 @@ __device__ void dense_transpose_device(
 
 // Perform dense matrix back transposition
 template <unsigned int DIMX, unsigned int DIMY, typename I, typename T>
-ROCSPARSE_KERNEL(DIMX* DIMY)
-void dense_transpose_back(I m, I n, const T* __restrict__ A, I lda, T* __restrict__ B, I ldb)
+__device__ void dense_transpose_back_device(
+    I m, I n, const T* __restrict__ A, I lda, T* __restrict__ B, I ldb)
 {
     int lid = hipThreadIdx_x & (DIMX - 1);
     int wid = hipThreadIdx_x / DIMX;
@@ -844,6 +844,13 @@ void dense_transpose_back(I m, I n, const T* __restrict__ A, I lda, T* __restric
     }
 }
 
+template <unsigned int DIMX, unsigned int DIMY, typename I, typename T>
+ROCSPARSE_KERNEL(DIMX* DIMY)
+void dense_transpose_back(I m, I n, const T* __restrict__ A, I lda, T* __restrict__ B, I ldb)
+{
+    dense_transpose_back_device<DIMX, DIMY>(m, n, A, lda, B, ldb);
+}
+
 // BSR gather functionality to permute the BSR values array
 template <unsigned int WFSIZE, unsigned int DIMY, unsigned int BSRDIM, typename I, typename T>
 ROCSPARSE_KERNEL(WFSIZE* DIMY)
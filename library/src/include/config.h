@@ -0,0 +1,158 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse-types.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+//
+// Typed runtime configuration registry of the rocsparse library.
+//
+// Each entry NAME is resolved, in increasing order of priority, from its
+// default value, from the configuration file named by the environment
+// variable ROCSPARSE_CONFIG_FILE, from the environment variable
+// ROCSPARSE_NAME and from rocsparse_set_config(). Handles take a snapshot
+// of the entries they depend on when they are created.
+//
+// The configuration file holds one 'NAME = value' pair per line, the
+// ROCSPARSE_ prefix of the name is optional and '#' starts a comment.
+//
+// Values of size entries accept the suffixes K, M and G, enum entries
+// accept one of their '|' separated choices.
+//
+// The memory statistics entries MEMSTAT, MEMSTAT_FORCE_MANAGED and
+// MEMSTAT_GUARDS are read once when the library is loaded, and VERBOSE
+// prints the resolved entries at that time.
+//
+// CSRMV_ADAPTIVE_BLOCK_SIZE and CSRMV_ADAPTIVE_ROWS_FOR_VECTOR select the
+// instantiated csrmv adaptive kernel used for general and triangular
+// matrices, CSRGEMM_HASH_SCALE the hash table size of the csrgemm groups
+// that process a row per wavefront.
+//
+#define ROCSPARSE_FOREACH_CONFIG                                          \
+    CONFIG(VERBOSE, bool, "0", nullptr)                                   \
+    CONFIG(MEMSTAT, bool, "0", nullptr)                                   \
+    CONFIG(MEMSTAT_FORCE_MANAGED, bool, "0", nullptr)                     \
+    CONFIG(MEMSTAT_GUARDS, bool, "0", nullptr)                            \
+    CONFIG(LAYER, int, "0", nullptr)                                      \
+    CONFIG(LOG_TRACE_PATH, string, "", nullptr)                           \
+    CONFIG(LOG_BENCH_PATH, string, "", nullptr)                           \
+    CONFIG(LOG_DEBUG_PATH, string, "", nullptr)                           \
+    CONFIG(LOG_TRACE_BINARY_PATH, string, "rocsparse_trace.bin", nullptr) \
+    CONFIG(CAPTURE_PATH, string, "rocsparse_capture", nullptr)            \
+    CONFIG(CAPTURE_DEDUPLICATE, bool, "1", nullptr)                       \
+    CONFIG(CAPTURE_DENSE, bool, "1", nullptr)                             \
+    CONFIG(POINTER_MODE, enum, "host", "host|device")                     \
+    CONFIG(HANDLE_BUFFER_SIZE, size, "1M", nullptr)                       \
+    CONFIG(WORKSPACE_POOL_RELEASE_THRESHOLD, size, "64M", nullptr)        \
+    CONFIG(CSRMV_ADAPTIVE_BLOCK_SIZE, enum, "1024", "512|1024|2048")      \
+    CONFIG(CSRMV_ADAPTIVE_ROWS_FOR_VECTOR, enum, "1", "1|2")              \
+    CONFIG(CSRGEMM_HASH_SCALE, enum, "1", "1|2")
+
+class rocsparse_config
+{
+public:
+    typedef enum type_
+    {
+        type_bool,
+        type_int,
+        type_size,
+        type_enum,
+        type_string
+    } type_t;
+
+#define CONFIG(name_, kind_, default_, choices_) name_,
+    typedef enum key_ : int32_t
+    {
+        ROCSPARSE_FOREACH_CONFIG
+    } key_t;
+#undef CONFIG
+
+    static constexpr key_t all[] = {
+#define CONFIG(name_, kind_, default_, choices_) name_,
+        ROCSPARSE_FOREACH_CONFIG
+#undef CONFIG
+    };
+
+    static constexpr size_t size = sizeof(all) / sizeof(all[0]);
+
+    //
+    // Return the unique instance.
+    //
+    static rocsparse_config& instance();
+
+    //
+    // Typed access, enum entries return the index of their choice.
+    //
+    bool        get_bool(key_t key) const;
+    int64_t     get_int(key_t key) const;
+    size_t      get_size(key_t key) const;
+    int64_t     get_enum(key_t key) const;
+    std::string get_string(key_t key) const;
+
+    //
+    // Access by name, with or without the ROCSPARSE_ prefix.
+    //
+    rocsparse_status set(const char* name, const char* value);
+    rocsparse_status get(const char* name, std::string& value) const;
+
+    //
+    // Read 'NAME = value' pairs from a file.
+    //
+    rocsparse_status load(const char* filename);
+
+private:
+    struct entry_t
+    {
+        const char* name;
+        type_t      type;
+        const char* default_value;
+        const char* choices;
+    };
+
+    struct value_t
+    {
+        int64_t     number{};
+        std::string text{};
+    };
+
+    static const entry_t s_entries[size];
+
+    rocsparse_config();
+    ~rocsparse_config()                       = default;
+    rocsparse_config(const rocsparse_config&) = delete;
+    rocsparse_config& operator=(const rocsparse_config&) = delete;
+
+    static bool             find(const char* name, key_t& key);
+    static rocsparse_status parse(key_t key, const std::string& text, value_t& value);
+
+    mutable std::mutex m_mutex;
+    value_t            m_values[size];
+};
+
+#define ROCSPARSE_CONFIG rocsparse_config::instance()
@@ -24,11 +24,15 @@
 
 #pragma once
 
+#include "profile.h"
 #include "rocsparse.h"
+#include "workspace_pool.h"
 
 #include <fstream>
 #include <hip/hip_runtime_api.h>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 /*! \brief typedefs to opaque info structs */
@@ -55,6 +59,8 @@ struct _rocsparse_handle
     rocsparse_status set_stream(hipStream_t user_stream);
     // get stream
     rocsparse_status get_stream(hipStream_t* user_stream) const;
+    // get device buffer, allocated on first use
+    void* get_buffer();
 
     // device id
     int device;
@@ -66,14 +72,23 @@ struct _rocsparse_handle
     int asic_rev;
     // stream ; default stream is system stream NULL
     hipStream_t stream = 0;
+    // workspace pool of the stream, shared with the handles using the same stream
+    std::shared_ptr<rocsparse_workspace_pool> workspace_pool;
     // pointer mode ; default mode is host
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
     // logging mode
     rocsparse_layer_mode layer_mode;
-    // device buffer
+    // profile, if rocsparse_layer_mode_profile is set
+    rocsparse_profile* profile{};
+    // device buffer, use get_buffer()
     size_t buffer_size;
-    void*  buffer;
-    // device one
+    void*  buffer{};
+    // csrmv adaptive row block size and maximum number of rows of a CSR-Vector row block
+    int csrmv_adaptive_block_size;
+    int csrmv_adaptive_rows_for_vector;
+    // hash table scale of the csrgemm wavefront per row groups
+    int csrgemm_hash_scale;
+    // device one, shared by all handles on the device
     float*  sone;
     double* done;
     // device complex one
@@ -89,6 +104,28 @@ struct _rocsparse_handle
     std::ostream* log_debug_os{};
 };
 
+/********************************************************************************
+ * \brief rocsparse_handle_pool is a structure holding initialized rocsparse
+ * handles for reuse. It must be initialized using rocsparse_create_handle_pool()
+ * and should be destroyed at the end using rocsparse_destroy_handle_pool().
+ *******************************************************************************/
+struct _rocsparse_handle_pool
+{
+    // constructor
+    _rocsparse_handle_pool() = default;
+    // destructor
+    ~_rocsparse_handle_pool();
+
+    // take a handle created on the device, nullptr if none is available
+    rocsparse_handle acquire(int device);
+    // give a handle back to the pool
+    void release(rocsparse_handle handle);
+
+private:
+    std::mutex                    mutex;
+    std::vector<rocsparse_handle> handles;
+};
+
 /********************************************************************************
  * \brief rocsparse_mat_descr is a structure holding the rocsparse matrix
  * descriptor. It must be initialized using rocsparse_create_mat_descr()
@@ -221,6 +258,8 @@ struct _rocsparse_csrmv_info
     int64_t                     n{};
     int64_t                     nnz{};
     int64_t                     max_rows{};
+    int64_t                     block_size{};
+    int64_t                     rows_for_vector{};
     const _rocsparse_mat_descr* descr{};
     const void*                 csr_row_ptr{};
     const void*                 csr_col_ind{};
@@ -439,6 +478,9 @@ struct _rocsparse_dnvec_descr
     void*              values{};
     const void*        const_values{};
     rocsparse_datatype data_type{};
+
+    int64_t batch_count{};
+    int64_t batch_stride{};
 };
 
 struct _rocsparse_dnmat_descr
@@ -24,7 +24,10 @@
 
 #pragma once
 
+#include "rocsparse.h"
+
 #include <fstream>
+#include <ostream>
 #include <string>
 
 /**
@@ -32,22 +35,20 @@
  *
  *  @details
  *  open_log_stream Open stream log_os for logging.
- *                  If the environment variable with name environment_variable_name
- *                  is not set, then stream log_os to std::cerr.
- *                  Else open a file at the full logfile path contained in
- *                  the environment variable.
+ *                  If logfile_pathname is empty, then stream log_os to std::cerr.
+ *                  Else open a file at logfile_pathname.
  *                  If opening the file suceeds, stream to the file
  *                  else stream to std::cerr.
  *
  *  @param[in]
- *  environment_variable_name   std::string
- *                              Name of environment variable that contains
- *                              the full logfile path.
+ *  logfile_pathname    std::string
+ *                      Full logfile path, usually taken from the
+ *                      rocsparse_config registry.
  *
  *  @parm[out]
  *  log_os      std::ostream**
- *              Output stream. Stream to std:err if environment_variable_name
- *              is not set, else set to stream to log_ofs
+ *              Output stream. Stream to std:err if logfile_pathname
+ *              is empty, else set to stream to log_ofs
  *
  *  @parm[out]
  *  log_ofs     std::ofstream*
@@ -55,19 +56,14 @@
  *              will stream to log_ofs. Else it will stream to std::cerr.
  */
 
-inline void open_log_stream(std::ostream** log_os,
-                            std::ofstream* log_ofs,
-                            std::string    environment_variable_name)
+inline void open_log_stream(std::ostream**     log_os,
+                            std::ofstream*     log_ofs,
+                            const std::string& logfile_pathname)
 {
     *log_os = &std::cerr;
 
-    char const* environment_variable_value = getenv(environment_variable_name.c_str());
-
-    if(environment_variable_value != NULL)
+    if(!logfile_pathname.empty())
     {
-        // if environment variable is set, open file at logfile_pathname contained in the
-        // environment variable
-        std::string logfile_pathname = (std::string)environment_variable_value;
         log_ofs->open(logfile_pathname);
 
         // if log_ofs is open, then stream to log_ofs, else log_os is already
@@ -111,6 +107,25 @@ void each_args(F)
 {
 }
 
+/**
+ * @brief Scalar argument whose type is given by another argument
+ *
+ * @details
+ * Generic routines take their scalars as void pointers, with their type in the
+ * compute type. The scalar is logged as its pointer, and captured with its
+ * value in rocsparse_layer_mode_capture.
+ */
+struct rocsparse_scalar_arg
+{
+    const void*        value;
+    rocsparse_datatype type;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const rocsparse_scalar_arg& x)
+{
+    return os << x.value;
+}
+
 /**
  * @brief Functor for logging arguments
  *
@@ -32,17 +32,19 @@
 //
 #ifndef ROCSPARSE_WITH_MEMSTAT
 
-#define rocsparse_hipMalloc(p_, nbytes_) hipMalloc(p_, nbytes_)
-#define rocsparse_hipFree(p_) hipFree(p_)
+#include "workspace_pool.h"
 
-// if hip version is atleast 5.3.0 hipMallocAsync and hipFreeAsync are defined
-#if HIP_VERSION >= 50300000
-#define rocsparse_hipMallocAsync(p_, nbytes_, stream_) hipMallocAsync(p_, nbytes_, stream_)
-#define rocsparse_hipFreeAsync(p_, stream_) hipFreeAsync(p_, stream_)
-#else
-#define rocsparse_hipMallocAsync(p_, nbytes_, stream_) hipMalloc(p_, nbytes_)
-#define rocsparse_hipFreeAsync(p_, stream_) hipFree(p_)
-#endif
+//
+// Device memory is served by the workspace pools of the handles, see workspace_pool.h.
+//
+#define rocsparse_hipMalloc(p_, nbytes_) \
+    rocsparse_workspace_pool::malloc((void**)(p_), (nbytes_))
+#define rocsparse_hipFree(p_) rocsparse_workspace_pool::free((void*)(p_))
+
+#define rocsparse_hipMallocAsync(p_, nbytes_, stream_) \
+    rocsparse_workspace_pool::malloc_async((void**)(p_), (nbytes_), stream_)
+#define rocsparse_hipFreeAsync(p_, stream_) \
+    rocsparse_workspace_pool::free_async((void*)(p_), stream_)
 
 #define rocsparse_hipHostMalloc(p_, nbytes_) hipHostMalloc(p_, nbytes_)
 #define rocsparse_hipHostFree(p_) hipHostFree(p_)
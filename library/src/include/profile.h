@@ -0,0 +1,211 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse.h"
+
+#include <chrono>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+//
+// Modelled cost of a routine call. The stage is nullptr for routines
+// that are called once per operation.
+//
+struct rocsparse_profile_model
+{
+    const char* stage{};
+    double      flops{};
+    double      bytes{};
+};
+
+//
+// Per handle profile, enabled with rocsparse_layer_mode_profile.
+//
+// Every instrumented call records its host time, i.e. the launch overhead
+// of the asynchronous routine, and a pair of events on the handle stream.
+// The events are resolved lazily, on later calls once completed or when
+// the report is generated, such that profiling does not synchronize the
+// stream.
+//
+class rocsparse_profile
+{
+public:
+    //
+    // Aggregated statistics of a routine stage, times in microseconds.
+    //
+    struct stats_t
+    {
+        int64_t ncalls{};
+        double  host_time_total{};
+        double  host_time_min{};
+        double  host_time_max{};
+        int64_t ndevice_calls{};
+        double  device_time_total{};
+        double  device_time_min{};
+        double  device_time_max{};
+        double  flops{};
+        double  bytes{};
+    };
+
+    rocsparse_profile() = default;
+    ~rocsparse_profile();
+
+    //
+    // Events to time the next call, nullptr if they cannot be created.
+    //
+    rocsparse_status acquire_events(hipEvent_t* start, hipEvent_t* stop);
+    void             release_events(hipEvent_t start, hipEvent_t stop);
+
+    //
+    // Record a call, the profile takes ownership of the events.
+    //
+    void record(const char*                    name,
+                const rocsparse_profile_model& model,
+                double                         host_time,
+                hipEvent_t                     start,
+                hipEvent_t                     stop);
+
+    //
+    // Aggregated statistics as JSON, waits for pending events.
+    //
+    std::string report(int device);
+
+    void reset();
+
+    rocsparse_profile(const rocsparse_profile&) = delete;
+    rocsparse_profile& operator=(const rocsparse_profile&) = delete;
+
+private:
+    struct pending_t
+    {
+        stats_t*   stats;
+        hipEvent_t start;
+        hipEvent_t stop;
+    };
+
+    //
+    // Resolve completed events in call order, with wait all pending events
+    // are resolved.
+    //
+    void resolve(bool wait);
+
+    std::mutex                                             m_mutex;
+    std::map<std::pair<std::string, std::string>, stats_t> m_stats;
+    std::vector<pending_t>                                 m_pending;
+    std::vector<hipEvent_t>                                m_events;
+};
+
+//
+// Profiles the enclosing scope of a routine, if profiling is enabled
+// on the handle.
+//
+class rocsparse_profile_scope
+{
+public:
+    rocsparse_profile_scope(rocsparse_handle               handle,
+                            const char*                    name,
+                            const rocsparse_profile_model& model);
+    ~rocsparse_profile_scope();
+
+    rocsparse_profile_scope(const rocsparse_profile_scope&) = delete;
+    rocsparse_profile_scope& operator=(const rocsparse_profile_scope&) = delete;
+
+private:
+    rocsparse_profile*                             m_profile{};
+    const char*                                    m_name{};
+    rocsparse_profile_model                        m_model{};
+    hipStream_t                                    m_stream{};
+    hipEvent_t                                     m_start{};
+    hipEvent_t                                     m_stop{};
+    std::chrono::high_resolution_clock::time_point m_begin{};
+};
+
+//
+// Modelled flops and bytes of the compute stages of the generic routines. Formats and precisions
+// are taken from the descriptors, the formulas follow the ones of the
+// clients performance measurements.
+//
+namespace rocsparse_profile_models
+{
+    rocsparse_profile_model spmv(rocsparse_const_spmat_descr mat,
+                                 rocsparse_const_dnvec_descr x,
+                                 rocsparse_const_dnvec_descr y,
+                                 rocsparse_spmv_stage        stage,
+                                 const void*                 temp_buffer);
+
+    rocsparse_profile_model spmv_fused(rocsparse_const_spmat_descr mat,
+                                       rocsparse_const_dnvec_descr x,
+                                       rocsparse_const_dnvec_descr y,
+                                       rocsparse_const_dnvec_descr z,
+                                       rocsparse_const_dnvec_descr w,
+                                       rocsparse_spmv_stage        stage,
+                                       const void*                 temp_buffer);
+
+    rocsparse_profile_model spsv(rocsparse_const_spmat_descr mat,
+                                 rocsparse_const_dnvec_descr x,
+                                 rocsparse_const_dnvec_descr y,
+                                 rocsparse_spsv_stage        stage,
+                                 const void*                 temp_buffer);
+
+    rocsparse_profile_model spmm(rocsparse_const_spmat_descr mat_A,
+                                 rocsparse_const_dnmat_descr mat_B,
+                                 rocsparse_const_dnmat_descr mat_C,
+                                 rocsparse_spmm_stage        stage,
+                                 const void*                 temp_buffer);
+
+    rocsparse_profile_model spsm(rocsparse_const_spmat_descr matA,
+                                 rocsparse_const_dnmat_descr matB,
+                                 rocsparse_const_dnmat_descr matC,
+                                 rocsparse_spsm_stage        stage,
+                                 const void*                 temp_buffer);
+
+    rocsparse_profile_model sddmm(rocsparse_operation         opA,
+                                  rocsparse_const_dnmat_descr A,
+                                  rocsparse_const_dnmat_descr B,
+                                  rocsparse_const_spmat_descr C);
+
+    rocsparse_profile_model spgemm(rocsparse_const_spmat_descr A,
+                                   rocsparse_const_spmat_descr B,
+                                   rocsparse_const_spmat_descr D,
+                                   rocsparse_const_spmat_descr C,
+                                   rocsparse_spgemm_stage      stage);
+
+    rocsparse_profile_model spvv(rocsparse_const_spvec_descr x,
+                                 rocsparse_const_dnvec_descr y,
+                                 const void*                 temp_buffer);
+
+    rocsparse_profile_model axpby(rocsparse_const_spvec_descr x, rocsparse_const_dnvec_descr y);
+
+    rocsparse_profile_model gather(rocsparse_const_dnvec_descr y, rocsparse_const_spvec_descr x);
+
+    rocsparse_profile_model scatter(rocsparse_const_spvec_descr x, rocsparse_const_dnvec_descr y);
+
+    rocsparse_profile_model rot(rocsparse_const_spvec_descr x, rocsparse_const_dnvec_descr y);
+}
@@ -0,0 +1,308 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "logging.h"
+#include "rocsparse.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+//
+// Fixed-size record of the binary trace. The layout is shared with the
+// decoder scripts/rocsparse-trace-decode.py.
+//
+struct rocsparse_trace_record
+{
+    static constexpr uint32_t max_args = 40;
+
+    typedef enum kind_ : uint16_t
+    {
+        kind_call    = 0, // routine call, id is the routine name
+        kind_string  = 1, // string definition, id is the string id
+        kind_dropped = 2 // args[0] records were dropped by the thread
+    } kind_t;
+
+    typedef enum type_ : uint8_t
+    {
+        type_int     = 0,
+        type_uint    = 1,
+        type_float   = 2,
+        type_pointer = 3,
+        type_string  = 4,
+        type_char    = 5
+    } type_t;
+
+    static constexpr uint32_t flag_truncated = 0x1;
+
+    uint64_t timestamp; // nanoseconds since the trace started
+    uint64_t handle;
+    uint32_t thread;
+    uint32_t id;
+    uint16_t kind;
+    uint16_t nargs; // number of arguments, or length of a string
+    uint32_t flags;
+    uint8_t  types[max_args];
+    uint64_t args[max_args];
+};
+
+//
+// Process-wide binary trace. Every thread writes records into its own
+// lock-free single producer ring, a background thread drains the rings
+// into the trace file.
+//
+class rocsparse_trace
+{
+public:
+    static rocsparse_trace& instance();
+
+    //
+    // Open the trace file, rocsparse_trace.bin if filename is empty, and start
+    // the flusher, once per process.
+    //
+    void start(const std::string& filename);
+    bool started() const
+    {
+        return this->m_started.load(std::memory_order_acquire);
+    }
+
+    uint64_t timestamp() const;
+
+    //
+    // Id of a string, the definition is written to the trace once.
+    //
+    uint32_t intern(const char* str, size_t len);
+
+    //
+    // Next free record of the calling thread, nullptr if its ring is full.
+    // The record is published by commit().
+    //
+    rocsparse_trace_record* acquire();
+    void                    commit();
+
+    rocsparse_trace(const rocsparse_trace&) = delete;
+    rocsparse_trace& operator=(const rocsparse_trace&) = delete;
+
+private:
+    rocsparse_trace();
+    ~rocsparse_trace();
+
+    struct impl;
+    impl*             m_impl;
+    std::atomic<bool> m_started{};
+};
+
+//
+// Encode arguments into the payload of a record, in the order and with the
+// formatting the text trace uses.
+//
+template <typename T>
+struct rocsparse_trace_is_char
+    : std::integral_constant<bool,
+                             std::is_same<T, char>::value || std::is_same<T, signed char>::value
+                                 || std::is_same<T, unsigned char>::value>
+{
+};
+
+template <typename T>
+struct rocsparse_trace_is_class
+    : std::integral_constant<bool,
+                             std::is_class<T>::value && !std::is_same<T, std::string>::value
+                                 && !std::is_same<T, rocsparse_float_complex>::value
+                                 && !std::is_same<T, rocsparse_double_complex>::value>
+{
+};
+
+struct rocsparse_trace_encoder
+{
+    rocsparse_trace_record& record;
+
+    void put(uint8_t type, uint64_t bits) const
+    {
+        if(record.nargs < rocsparse_trace_record::max_args)
+        {
+            record.types[record.nargs] = type;
+            record.args[record.nargs]  = bits;
+            ++record.nargs;
+        }
+        else
+        {
+            record.flags |= rocsparse_trace_record::flag_truncated;
+        }
+    }
+
+    void put_float(double x) const
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        this->put(rocsparse_trace_record::type_float, bits);
+    }
+
+    void put_string(const char* str, size_t len) const
+    {
+        this->put(rocsparse_trace_record::type_string,
+                  rocsparse_trace::instance().intern(str, len));
+    }
+
+    void operator()(bool x) const
+    {
+        this->put(rocsparse_trace_record::type_uint, x ? 1 : 0);
+    }
+
+    template <typename T, std::enable_if_t<rocsparse_trace_is_char<T>::value, int> = 0>
+    void operator()(T x) const
+    {
+        this->put(rocsparse_trace_record::type_char, static_cast<unsigned char>(x));
+    }
+
+    template <typename T,
+              std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value
+                                   && !rocsparse_trace_is_char<T>::value,
+                               int>
+              = 0>
+    void operator()(T x) const
+    {
+        this->put(rocsparse_trace_record::type_int, static_cast<uint64_t>(int64_t(x)));
+    }
+
+    template <typename T,
+              std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value
+                                   && !rocsparse_trace_is_char<T>::value
+                                   && !std::is_same<T, bool>::value,
+                               int>
+              = 0>
+    void operator()(T x) const
+    {
+        this->put(rocsparse_trace_record::type_uint, static_cast<uint64_t>(x));
+    }
+
+    template <typename T, std::enable_if_t<std::is_enum<T>::value, int> = 0>
+    void operator()(T x) const
+    {
+        this->put(rocsparse_trace_record::type_int, static_cast<uint64_t>(int64_t(x)));
+    }
+
+    template <typename T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+    void operator()(T x) const
+    {
+        this->put_float(x);
+    }
+
+    template <typename T,
+              std::enable_if_t<!rocsparse_trace_is_char<std::remove_cv_t<T>>::value, int> = 0>
+    void operator()(T* x) const
+    {
+        this->put(rocsparse_trace_record::type_pointer, reinterpret_cast<uintptr_t>(x));
+    }
+
+    template <typename T,
+              std::enable_if_t<rocsparse_trace_is_char<std::remove_cv_t<T>>::value, int> = 0>
+    void operator()(T* x) const
+    {
+        const char* str = reinterpret_cast<const char*>(x);
+        this->put_string(str, (str != nullptr) ? std::strlen(str) : 0);
+    }
+
+    void operator()(const std::string& x) const
+    {
+        this->put_string(x.c_str(), x.size());
+    }
+
+    void operator()(const rocsparse_scalar_arg& x) const
+    {
+        this->put(rocsparse_trace_record::type_pointer, reinterpret_cast<uintptr_t>(x.value));
+    }
+
+    void operator()(const rocsparse_float_complex& x) const
+    {
+        this->put_float(std::real(x));
+        this->put_float(std::imag(x));
+    }
+
+    void operator()(const rocsparse_double_complex& x) const
+    {
+        this->put_float(std::real(x));
+        this->put_float(std::imag(x));
+    }
+
+    //
+    // Anything else is recorded the way it is printed.
+    //
+    template <typename T, std::enable_if_t<rocsparse_trace_is_class<T>::value, int> = 0>
+    void operator()(const T& x) const
+    {
+        std::ostringstream os;
+        os << x;
+        const std::string str = os.str();
+        this->put_string(str.c_str(), str.size());
+    }
+};
+
+inline uint32_t rocsparse_trace_intern(const char* str)
+{
+    return rocsparse_trace::instance().intern(str, std::strlen(str));
+}
+
+inline uint32_t rocsparse_trace_intern(const std::string& str)
+{
+    return rocsparse_trace::instance().intern(str.c_str(), str.size());
+}
+
+//
+// Record a routine call into the binary trace.
+//
+template <typename H, typename... Ts>
+void log_trace_binary(rocsparse_handle handle, const H& head, Ts&&... xs)
+{
+    rocsparse_trace& trace = rocsparse_trace::instance();
+    if(!trace.started())
+    {
+        return;
+    }
+
+    rocsparse_trace_record* record = trace.acquire();
+    if(record == nullptr)
+    {
+        return;
+    }
+
+    record->timestamp = trace.timestamp();
+    record->handle    = reinterpret_cast<uintptr_t>(handle);
+    record->kind      = rocsparse_trace_record::kind_call;
+    record->nargs     = 0;
+    record->flags     = 0;
+    record->id        = rocsparse_trace_intern(head);
+
+    const rocsparse_trace_encoder encoder{*record};
+    (void)encoder;
+    (void)std::initializer_list<int>{((void)encoder(xs), 0)...};
+
+    trace.commit();
+}
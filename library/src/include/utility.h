@@ -24,9 +24,11 @@
 
 #pragma once
 
+#include "capture.h"
 #include "definitions.h"
 #include "handle.h"
 #include "logging.h"
+#include "trace.h"
 #include <algorithm>
 #include <exception>
 
@@ -97,11 +99,30 @@ static inline hipError_t rocsparse_assign_async(T* dest, T value, hipStream_t st
 // then
 // log_function will call log_arguments to log function
 // arguments with a comma separator
+// if binary trace logging is turned on with
+// (handle->layer_mode & rocsparse_layer_mode_log_trace_binary) == true
+// then
+// log_function will record the function arguments into the binary trace
+// if capture is turned on with
+// (handle->layer_mode & rocsparse_layer_mode_capture) == true
+// then
+// log_function will record the function arguments and the values of the
+// operands they describe into the capture directory
 template <typename H, typename... Ts>
 void log_trace(rocsparse_handle handle, H head, Ts&&... xs)
 {
     if(nullptr != handle)
     {
+        if(handle->layer_mode & rocsparse_layer_mode_log_trace_binary)
+        {
+            log_trace_binary(handle, head, xs...);
+        }
+
+        if(handle->layer_mode & rocsparse_layer_mode_capture)
+        {
+            log_capture(handle, head, xs...);
+        }
+
         if(handle->layer_mode & rocsparse_layer_mode_log_trace)
         {
             std::string comma_separator = ",";
@@ -161,7 +182,9 @@ T log_trace_scalar_value(const T* value)
 template <typename T>
 T log_trace_scalar_value(rocsparse_handle handle, const T* value)
 {
-    if(handle->layer_mode & rocsparse_layer_mode_log_trace)
+    if(handle->layer_mode
+       & (rocsparse_layer_mode_log_trace | rocsparse_layer_mode_log_trace_binary
+          | rocsparse_layer_mode_capture))
     {
         T host;
         if(value && handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -824,5 +847,4 @@ struct floating_traits<rocsparse_double_complex>
 template <typename T>
 using floating_data_t = typename floating_traits<T>::data_t;
 
-#include "envariables.h"
 #include "memstat.h"
@@ -0,0 +1,147 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+//
+// Stream-ordered caching sub-allocator of a stream.
+//
+// There is one pool per device and stream, shared by all rocsparse handles that use
+// the stream on the device. Device memory requested through rocsparse_hipMallocAsync
+// is served from blocks cached by the pool of the current device and the stream of the
+// request, rocsparse_hipMalloc is served by the pool of the null stream or, if there is
+// none, by any pool of the current device. Requests are rounded up to a size class.
+//
+// A released block is cached together with an event recorded on the stream it is
+// released on, rocsparse_hipFree releases it on the stream that owns the block. The
+// block is handed out again to a request of the same size class, a request on another
+// stream waits for the event on the device, a synchronous request on the host.
+// Whenever the cached memory exceeds the release threshold, the largest cached blocks
+// are returned to the device.
+//
+class rocsparse_workspace_pool
+{
+public:
+    //
+    // Pool counters.
+    //
+    struct stats_t
+    {
+        size_t nrequests{};
+        size_t nhits{};
+        size_t nreleases{};
+        size_t nbytes_in_use{};
+        size_t nbytes_cached{};
+        size_t nbytes_high_water{};
+    };
+
+    //
+    // Default release threshold, 64 MB.
+    //
+    static constexpr size_t default_release_threshold = size_t(64) << 20;
+
+    rocsparse_workspace_pool(int device, hipStream_t stream, size_t release_threshold);
+    ~rocsparse_workspace_pool();
+
+    rocsparse_workspace_pool(const rocsparse_workspace_pool&) = delete;
+    rocsparse_workspace_pool& operator=(const rocsparse_workspace_pool&) = delete;
+
+    //
+    // Get the pool of the stream on the device, the pool is created with the given
+    // release threshold if the stream has no pool yet. The pool lives as long as a
+    // handle holds it.
+    //
+    static std::shared_ptr<rocsparse_workspace_pool>
+        acquire(int device, hipStream_t stream, size_t release_threshold);
+
+    void   set_release_threshold(size_t nbytes);
+    size_t get_release_threshold() const;
+
+    //
+    // Release cached blocks until at most nbytes are cached.
+    //
+    hipError_t trim(size_t nbytes);
+
+    stats_t get_stats() const;
+
+    //
+    // Round up to the size class of a request.
+    //
+    static size_t size_class(size_t nbytes);
+
+    //
+    // Entry points of the rocsparse_hipMalloc, rocsparse_hipFree, rocsparse_hipMallocAsync
+    // and rocsparse_hipFreeAsync macros. Memory is taken from a pool of the current
+    // device, if any, and from the device otherwise.
+    //
+    static hipError_t malloc(void** mem, size_t nbytes);
+    static hipError_t free(void* mem);
+    static hipError_t malloc_async(void** mem, size_t nbytes, hipStream_t stream);
+    static hipError_t free_async(void* mem, hipStream_t stream);
+
+private:
+    struct block_t
+    {
+        void*       ptr;
+        size_t      nbytes;
+        bool        stream_ordered;
+        hipStream_t stream;
+        hipEvent_t  event;
+    };
+
+    //
+    // Synchronous requests are owned by the null stream.
+    //
+    hipError_t allocate(void** mem, size_t nbytes, bool stream_ordered, hipStream_t stream);
+
+    //
+    // The block is idle once the work queued on the stream so far is done, a null
+    // stream pointer refers to the stream owning the block.
+    //
+    hipError_t deallocate(void* mem, const hipStream_t* stream);
+
+    hipError_t release(size_t nbytes);
+    hipError_t release_block(const block_t& b, hipStream_t stream);
+
+    mutable std::mutex                 m_mutex;
+    const int                          m_device;
+    const hipStream_t                  m_stream;
+    size_t                             m_release_threshold;
+    std::multimap<size_t, block_t>     m_cached;
+    std::unordered_map<void*, block_t> m_in_use;
+    stats_t                            m_stats;
+};
+
+#ifdef ROCSPARSE_WITH_MEMSTAT
+//
+// Record the counters of a pool in the memory report.
+//
+void rocsparse_memstat_workspace_pool(const rocsparse_workspace_pool::stats_t& stats);
+#endif
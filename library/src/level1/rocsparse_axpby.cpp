@@ -119,9 +119,9 @@ try
     log_trace(handle,
               "rocsparse_axpby",
               (const void*&)alpha,
-              (const void*&)x,
+              x,
               (const void*&)beta,
-              (const void*&)y);
+              y);
 
     // Check for invalid descriptors
     RETURN_IF_NULLPTR(x);
@@ -141,6 +141,10 @@ try
         return rocsparse_status_not_implemented;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_axpby", rocsparse_profile_models::axpby(x, y));
+
     // single real ; i32
     if(x->idx_type == rocsparse_indextype_i32 && x->data_type == rocsparse_datatype_f32_r)
     {
@@ -83,7 +83,7 @@ rocsparse_status rocsparse_dotci_template(rocsparse_handle     handle,
 
 #define DOTCI_DIM 256
     // Get workspace from handle device buffer
-    T* workspace = reinterpret_cast<T*>(handle->buffer);
+    T* workspace = reinterpret_cast<T*>(handle->get_buffer());
 
     hipLaunchKernelGGL((dotci_kernel_part1<DOTCI_DIM>),
                        dim3(DOTCI_DIM),
@@ -94,7 +94,7 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
 
 #define DOTI_DIM 256
     // Get workspace from handle device buffer
-    T* workspace = reinterpret_cast<T*>(handle->buffer);
+    T* workspace = reinterpret_cast<T*>(handle->get_buffer());
 
     hipLaunchKernelGGL((doti_kernel_part1<DOTI_DIM, 2>),
                        dim3(DOTI_DIM),
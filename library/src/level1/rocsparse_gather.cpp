@@ -56,7 +56,7 @@ try
     RETURN_IF_INVALID_HANDLE(handle);
 
     // Logging
-    log_trace(handle, "rocsparse_gather", (const void*&)y, (const void*&)x);
+    log_trace(handle, "rocsparse_gather", y, x);
 
     // Check for invalid descriptors
     RETURN_IF_NULLPTR(x);
@@ -74,6 +74,10 @@ try
         return rocsparse_status_not_implemented;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_gather", rocsparse_profile_models::gather(y, x));
+
     if(x->idx_type == rocsparse_indextype_i32 && x->data_type == rocsparse_datatype_i8_r)
     {
         return rocsparse_gather_template<int32_t, int8_t>(handle, y, x);
@@ -62,8 +62,8 @@ try
               "rocsparse_rot",
               (const void*&)c,
               (const void*&)s,
-              (const void*&)x,
-              (const void*&)y);
+              x,
+              y);
 
     // Check for invalid descriptors
     RETURN_IF_NULLPTR(c);
@@ -83,6 +83,9 @@ try
         return rocsparse_status_not_implemented;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(handle, "rocsparse_rot", rocsparse_profile_models::rot(x, y));
+
     // single real ; i32
     if(x->idx_type == rocsparse_indextype_i32 && x->data_type == rocsparse_datatype_f32_r)
     {
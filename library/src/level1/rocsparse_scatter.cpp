@@ -56,7 +56,7 @@ try
     RETURN_IF_INVALID_HANDLE(handle);
 
     // Logging
-    log_trace(handle, "rocsparse_scatter", (const void*&)x, (const void*&)y);
+    log_trace(handle, "rocsparse_scatter", x, y);
 
     // Check for invalid descriptors
     RETURN_IF_NULLPTR(x);
@@ -74,6 +74,10 @@ try
         return rocsparse_status_not_implemented;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_scatter", rocsparse_profile_models::scatter(x, y));
+
     // int8 ; i32
     if(x->idx_type == rocsparse_indextype_i32 && x->data_type == rocsparse_datatype_i8_r)
     {
@@ -189,8 +189,8 @@ try
     log_trace(handle,
               "rocsparse_spvv",
               trans,
-              (const void*&)x,
-              (const void*&)y,
+              x,
+              y,
               (const void*&)result,
               compute_type,
               (const void*&)buffer_size,
@@ -227,6 +227,10 @@ try
         return rocsparse_status_not_initialized;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_spvv", rocsparse_profile_models::spvv(x, y, temp_buffer));
+
     RETURN_SPVV(x->idx_type,
                 x->data_type,
                 y->data_type,
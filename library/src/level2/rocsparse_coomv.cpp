@@ -482,7 +482,7 @@ rocsparse_status rocsparse_coomv_segmented_dispatch(rocsparse_handle          ha
         I nloops    = (nnz - 1) / (COOMVN_DIM * nblocks) + 1;
 
         // Buffer
-        char* ptr = reinterpret_cast<char*>(handle->buffer);
+        char* ptr = reinterpret_cast<char*>(handle->get_buffer());
         ptr += 256;
 
         // row block reduction buffer
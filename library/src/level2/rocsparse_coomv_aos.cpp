@@ -288,7 +288,7 @@ rocsparse_status rocsparse_coomv_aos_segmented_dispatch(rocsparse_handle
         I nloops    = (nnz - 1) / (COOMVN_DIM * nblocks) + 1;
 
         // Buffer
-        char* ptr = reinterpret_cast<char*>(handle->buffer);
+        char* ptr = reinterpret_cast<char*>(handle->get_buffer());
         ptr += 256;
 
         // row block reduction buffer
@@ -534,3 +534,197 @@ INSTANTIATE(int64_t, double);
 INSTANTIATE(int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, rocsparse_double_complex);
 #undef INSTANTIATE
+
+template <typename I, typename T>
+rocsparse_status rocsparse_coosv_solve_strided_batched_buffer_size_template(
+    rocsparse_operation trans,
+    I                   m,
+    int64_t             nnz,
+    I                   batch_count,
+    int64_t             val_batch_stride,
+    size_t*             buffer_size)
+{
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || batch_count == 0)
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    // The CSR row pointer array computed during analysis is placed first,
+    // followed by the batched CSR solve workspace.
+    if(std::is_same<I, int32_t>() && nnz < std::numeric_limits<int32_t>::max())
+    {
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsv_solve_strided_batched_buffer_size_template<int32_t,
+                                                                                              I,
+                                                                                              T>(
+            trans, m, (int32_t)nnz, batch_count, val_batch_stride, buffer_size)));
+
+        *buffer_size += sizeof(int32_t) * (m / 256 + 1) * 256;
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsv_solve_strided_batched_buffer_size_template<int64_t,
+                                                                                              I,
+                                                                                              T>(
+            trans, m, nnz, batch_count, val_batch_stride, buffer_size)));
+
+        *buffer_size += sizeof(int64_t) * (m / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename T>
+rocsparse_status
+    rocsparse_coosv_solve_strided_batched_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   I                         m,
+                                                   int64_t                   nnz,
+                                                   const T*                  alpha_device_host,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  coo_val,
+                                                   int64_t                   val_batch_stride,
+                                                   const I*                  coo_row_ind,
+                                                   const I*                  coo_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   const T*                  x,
+                                                   int64_t                   x_batch_stride,
+                                                   T*                        y,
+                                                   int64_t                   y_batch_stride,
+                                                   I                         batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // All must be null (zero matrix) or none null
+    if(!(coo_val == nullptr && coo_row_ind == nullptr && coo_col_ind == nullptr)
+       && !(coo_val != nullptr && coo_row_ind != nullptr && coo_col_ind != nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    if(std::is_same<I, int32_t>() && nnz < std::numeric_limits<int32_t>::max())
+    {
+        int32_t* csr_row_ptr = reinterpret_cast<int32_t*>(ptr);
+        ptr += sizeof(int32_t) * (m / 256 + 1) * 256;
+
+        return rocsparse_csrsv_solve_strided_batched_template(handle,
+                                                              trans,
+                                                              m,
+                                                              (int32_t)nnz,
+                                                              alpha_device_host,
+                                                              descr,
+                                                              coo_val,
+                                                              val_batch_stride,
+                                                              (const int32_t*)csr_row_ptr,
+                                                              coo_col_ind,
+                                                              info,
+                                                              x,
+                                                              x_batch_stride,
+                                                              y,
+                                                              y_batch_stride,
+                                                              batch_count,
+                                                              policy,
+                                                              ptr);
+    }
+    else
+    {
+        int64_t* csr_row_ptr = reinterpret_cast<int64_t*>(ptr);
+        ptr += sizeof(int64_t) * (m / 256 + 1) * 256;
+
+        return rocsparse_csrsv_solve_strided_batched_template(handle,
+                                                              trans,
+                                                              m,
+                                                              nnz,
+                                                              alpha_device_host,
+                                                              descr,
+                                                              coo_val,
+                                                              val_batch_stride,
+                                                              (const int64_t*)csr_row_ptr,
+                                                              coo_col_ind,
+                                                              info,
+                                                              x,
+                                                              x_batch_stride,
+                                                              y,
+                                                              y_batch_stride,
+                                                              batch_count,
+                                                              policy,
+                                                              ptr);
+    }
+}
+
+#define INSTANTIATE(ITYPE, TTYPE)                                                               \
+    template rocsparse_status rocsparse_coosv_solve_strided_batched_buffer_size_template<ITYPE, \
+                                                                                         TTYPE>( \
+        rocsparse_operation trans,                                                              \
+        ITYPE               m,                                                                  \
+        int64_t             nnz,                                                                \
+        ITYPE               batch_count,                                                        \
+        int64_t             val_batch_stride,                                                   \
+        size_t*             buffer_size);                                                       \
+    template rocsparse_status rocsparse_coosv_solve_strided_batched_template<ITYPE, TTYPE>(     \
+        rocsparse_handle          handle,                                                       \
+        rocsparse_operation       trans,                                                        \
+        ITYPE                     m,                                                            \
+        int64_t                   nnz,                                                          \
+        const TTYPE*              alpha_device_host,                                            \
+        const rocsparse_mat_descr descr,                                                        \
+        const TTYPE*              coo_val,                                                      \
+        int64_t                   val_batch_stride,                                             \
+        const ITYPE*              coo_row_ind,                                                  \
+        const ITYPE*              coo_col_ind,                                                  \
+        rocsparse_mat_info        info,                                                         \
+        const TTYPE*              x,                                                            \
+        int64_t                   x_batch_stride,                                               \
+        TTYPE*                    y,                                                            \
+        int64_t                   y_batch_stride,                                               \
+        ITYPE                     batch_count,                                                  \
+        rocsparse_solve_policy    policy,                                                       \
+        void*                     temp_buffer);
+
+INSTANTIATE(int32_t, float);
+INSTANTIATE(int32_t, double);
+INSTANTIATE(int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, float);
+INSTANTIATE(int64_t, double);
+INSTANTIATE(int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, rocsparse_double_complex);
+#undef INSTANTIATE
@@ -67,3 +67,33 @@ rocsparse_status rocsparse_coosv_solve_template(rocsparse_handle          handle
                                                 T*                        y,
                                                 rocsparse_solve_policy    policy,
                                                 void*                     temp_buffer);
+
+template <typename I, typename T>
+rocsparse_status rocsparse_coosv_solve_strided_batched_buffer_size_template(
+    rocsparse_operation trans,
+    I                   m,
+    int64_t             nnz,
+    I                   batch_count,
+    int64_t             val_batch_stride,
+    size_t*             buffer_size);
+
+template <typename I, typename T>
+rocsparse_status
+    rocsparse_coosv_solve_strided_batched_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   I                         m,
+                                                   int64_t                   nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  coo_val,
+                                                   int64_t                   val_batch_stride,
+                                                   const I*                  coo_row_ind,
+                                                   const I*                  coo_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   const T*                  x,
+                                                   int64_t                   x_batch_stride,
+                                                   T*                        y,
+                                                   int64_t                   y_batch_stride,
+                                                   I                         batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer);
@@ -30,6 +30,9 @@
 #include "csrmv_device.h"
 #include "csrmv_symm_device.h"
 
+// Default row block size and number of rows processed by CSR-Vector, the
+// general adaptive kernel is also instantiated for the values selected by
+// CSRMV_ADAPTIVE_BLOCK_SIZE and CSRMV_ADAPTIVE_ROWS_FOR_VECTOR
 #define BLOCK_SIZE 1024
 #define BLOCK_MULTIPLIER 3
 #define ROWS_FOR_VECTOR 1
@@ -89,6 +92,22 @@
                                                        y,                 \
                                                        descr->base)
 
+#define LAUNCH_CSRMVN_ADAPTIVE(blocksize, rowsforvector)                                  \
+    csrmvn_adaptive_kernel<blocksize, rowsforvector>                                      \
+        <<<csrmvn_blocks, csrmvn_threads, 0, stream>>>(conj,                              \
+                                                       nnz,                               \
+                                                       static_cast<I*>(info->row_blocks), \
+                                                       info->wg_flags,                    \
+                                                       static_cast<J*>(info->wg_ids),     \
+                                                       alpha_device_host,                 \
+                                                       csr_row_ptr,                       \
+                                                       csr_col_ind,                       \
+                                                       csr_val,                           \
+                                                       x,                                 \
+                                                       beta_device_host,                  \
+                                                       y,                                 \
+                                                       descr->base)
+
 __attribute__((unused)) static unsigned int flp2(unsigned int x)
 {
     x |= (x >> 1);
@@ -148,6 +167,8 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
                                     size_t&  rowBlockSize,
                                     const I* rowDelimiters,
                                     I        nRows,
+                                    I        blockSize,
+                                    I        rowsForVector,
                                     bool     allocate_row_blocks = true)
 {
     I* rowBlocksBase;
@@ -211,7 +232,7 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
                     // If this row fits into CSR-Stream, calculate how many rows
                     // can be used to do a parallel reduction.
                     // Fill in the low-order bits with the numThreadsForRed
-                    if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                    if(((i - 1) - last_i) > rowsForVector)
                     {
                         *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
                     }
@@ -232,7 +253,7 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
             if(allocate_row_blocks)
             {
                 *rowBlocks = i - 1;
-                if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                if(((i - 1) - last_i) > rowsForVector)
                 {
                     *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
                 }
@@ -251,10 +272,10 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
 
         // exactly one row results in non-zero elements to be greater than blockSize
         // This is csr-vector case;
-        if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
+        if((i - last_i == 1) && sum > blockSize)
         {
             I numWGReq = static_cast<I>(
-                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * blockSize)));
 
             // Check to ensure #workgroups can fit in 32 bits, if not
             // then the last workgroup will do all the remaining work
@@ -285,7 +306,7 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
         }
         // more than one row results in non-zero elements to be greater than blockSize
         // This is csr-stream case; wgIds holds number of parallel reduction threads
-        else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
+        else if((i - last_i > 1) && sum > blockSize)
         {
             // This row won't fit, so back off one.
             --i;
@@ -293,7 +314,7 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
             if(allocate_row_blocks)
             {
                 *rowBlocks = i;
-                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                if((i - last_i) > rowsForVector)
                 {
                     *(wgIds - 1) |= numThreadsForReduction(i - last_i);
                 }
@@ -308,12 +329,12 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
             consecutive_long_rows = 0;
         }
         // This is csr-stream case; wgIds holds number of parallel reduction threads
-        else if(sum == static_cast<I>(BLOCK_SIZE))
+        else if(sum == blockSize)
         {
             if(allocate_row_blocks)
             {
                 *rowBlocks = i;
-                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+                if((i - last_i) > rowsForVector)
                 {
                     *(wgIds - 1) |= numThreadsForReduction(i - last_i);
                 }
@@ -333,7 +354,7 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
     if(allocate_row_blocks && *(rowBlocks - 1) != nRows)
     {
         *rowBlocks = nRows;
-        if((nRows - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
+        if((nRows - last_i) > rowsForVector)
         {
             *(wgIds - 1) |= numThreadsForReduction(i - last_i);
         }
@@ -475,16 +496,39 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     // Wait for host transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
+    // The symmetric kernel is only instantiated for the default row block size
+    I block_size      = BLOCK_SIZE;
+    I rows_for_vector = ROWS_FOR_VECTOR;
+
+    if(descr->type != rocsparse_matrix_type_symmetric)
+    {
+        block_size      = handle->csrmv_adaptive_block_size;
+        rows_for_vector = handle->csrmv_adaptive_rows_for_vector;
+    }
+
     // Determine row blocks array size
-    ComputeRowBlocks<I, J>((I*)NULL, (J*)NULL, info->csrmv_info->size, hptr.data(), m, false);
+    ComputeRowBlocks<I, J>((I*)NULL,
+                           (J*)NULL,
+                           info->csrmv_info->size,
+                           hptr.data(),
+                           m,
+                           block_size,
+                           rows_for_vector,
+                           false);
 
     // Create row blocks, workgroup flag, and workgroup data structures
     std::vector<I>            row_blocks(info->csrmv_info->size, 0);
     std::vector<unsigned int> wg_flags(info->csrmv_info->size, 0);
     std::vector<J>            wg_ids(info->csrmv_info->size, 0);
 
-    ComputeRowBlocks<I, J>(
-        row_blocks.data(), wg_ids.data(), info->csrmv_info->size, hptr.data(), m, true);
+    ComputeRowBlocks<I, J>(row_blocks.data(),
+                           wg_ids.data(),
+                           info->csrmv_info->size,
+                           hptr.data(),
+                           m,
+                           block_size,
+                           rows_for_vector,
+                           true);
 
     if(descr->type == rocsparse_matrix_type_symmetric)
     {
@@ -530,6 +574,11 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     info->csrmv_info->n           = n;
     info->csrmv_info->nnz         = nnz;
     info->csrmv_info->descr       = descr;
+
+    // Row block layout the compute kernel has to match
+    info->csrmv_info->block_size      = block_size;
+    info->csrmv_info->rows_for_vector = rows_for_vector;
+
     info->csrmv_info->csr_row_ptr = csr_row_ptr;
     info->csrmv_info->csr_col_ind = csr_col_ind;
 
@@ -705,7 +754,14 @@ void csrmvt_symm_general_kernel(bool     conj,
     }
 }
 
-template <typename I, typename J, typename A, typename X, typename Y, typename U>
+template <unsigned int BLOCKSIZE,
+          unsigned int ROWSFORVECTOR,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
 ROCSPARSE_KERNEL(WG_SIZE)
 void csrmvn_adaptive_kernel(bool conj,
                             I    nnz,
@@ -725,19 +781,19 @@ void csrmvn_adaptive_kernel(bool conj,
     auto beta  = load_scalar_device_host(beta_device_host);
     if(alpha != 0 || beta != 1)
     {
-        csrmvn_adaptive_device<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(conj,
-                                                                                       nnz,
-                                                                                       row_blocks,
-                                                                                       wg_flags,
-                                                                                       wg_ids,
-                                                                                       alpha,
-                                                                                       csr_row_ptr,
-                                                                                       csr_col_ind,
-                                                                                       csr_val,
-                                                                                       x,
-                                                                                       beta,
-                                                                                       y,
-                                                                                       idx_base);
+        csrmvn_adaptive_device<BLOCKSIZE, BLOCK_MULTIPLIER, ROWSFORVECTOR, WG_SIZE>(conj,
+                                                                                    nnz,
+                                                                                    row_blocks,
+                                                                                    wg_flags,
+                                                                                    wg_ids,
+                                                                                    alpha,
+                                                                                    csr_row_ptr,
+                                                                                    csr_col_ind,
+                                                                                    csr_val,
+                                                                                    x,
+                                                                                    beta,
+                                                                                    y,
+                                                                                    idx_base);
     }
 }
 
@@ -1000,24 +1056,41 @@ rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle
         // Run different csrmv kernels
         dim3 csrmvn_blocks((info->size) - 1);
         dim3 csrmvn_threads(WG_SIZE);
-        hipLaunchKernelGGL((csrmvn_adaptive_kernel),
-                           csrmvn_blocks,
-                           csrmvn_threads,
-                           0,
-                           stream,
-                           conj,
-                           nnz,
-                           static_cast<I*>(info->row_blocks),
-                           info->wg_flags,
-                           static_cast<J*>(info->wg_ids),
-                           alpha_device_host,
-                           csr_row_ptr,
-                           csr_col_ind,
-                           csr_val,
-                           x,
-                           beta_device_host,
-                           y,
-                           descr->base);
+
+        // Select the kernel instance matching the row blocks of the analysis
+        if(info->block_size == 512)
+        {
+            if(info->rows_for_vector == 2)
+            {
+                LAUNCH_CSRMVN_ADAPTIVE(512, 2);
+            }
+            else
+            {
+                LAUNCH_CSRMVN_ADAPTIVE(512, 1);
+            }
+        }
+        else if(info->block_size == 2048)
+        {
+            if(info->rows_for_vector == 2)
+            {
+                LAUNCH_CSRMVN_ADAPTIVE(2048, 2);
+            }
+            else
+            {
+                LAUNCH_CSRMVN_ADAPTIVE(2048, 1);
+            }
+        }
+        else
+        {
+            if(info->rows_for_vector == 2)
+            {
+                LAUNCH_CSRMVN_ADAPTIVE(1024, 2);
+            }
+            else
+            {
+                LAUNCH_CSRMVN_ADAPTIVE(1024, 1);
+            }
+        }
     }
     else if(descr->type == rocsparse_matrix_type_symmetric)
     {
@@ -80,3 +80,28 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                                 T*                        y,
                                                 rocsparse_solve_policy    policy,
                                                 void*                     temp_buffer);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrsv_solve_strided_batched_buffer_size_template(
+    rocsparse_operation trans, J m, I nnz, J batch_count, int64_t val_batch_stride, size_t* buffer_size);
+
+template <typename I, typename J, typename T>
+rocsparse_status
+    rocsparse_csrsv_solve_strided_batched_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   J                         m,
+                                                   I                         nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   int64_t                   val_batch_stride,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   const T*                  x,
+                                                   int64_t                   x_batch_stride,
+                                                   T*                        y,
+                                                   int64_t                   y_batch_stride,
+                                                   J                         batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer);
@@ -24,7 +24,6 @@
 
 #include "definitions.h"
 
-#include "../level1/rocsparse_gthr.hpp"
 #include "csrsv_device.h"
 
 #include "rocsparse_csrsv.hpp"
@@ -43,8 +42,11 @@ void csrsv_kernel(J m,
                   const I* __restrict__ csr_row_ptr,
                   const J* __restrict__ csr_col_ind,
                   const T* __restrict__ csr_val,
+                  int64_t val_batch_stride,
                   const T* __restrict__ x,
+                  int64_t x_batch_stride,
                   T* __restrict__ y,
+                  int64_t y_batch_stride,
                   int* __restrict__ done_array,
                   J* __restrict__ map,
                   int offset,
@@ -53,15 +55,19 @@ void csrsv_kernel(J m,
                   rocsparse_fill_mode  fill_mode,
                   rocsparse_diag_type  diag_type)
 {
+    // Each batch is solved by its own row of blocks, all batches share the
+    // row map and the sparsity pattern of the matrix
+    int64_t batch = hipBlockIdx_y;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     csrsv_device<BLOCKSIZE, WF_SIZE, SLEEP>(m,
                                             alpha,
                                             csr_row_ptr,
                                             csr_col_ind,
-                                            csr_val,
-                                            x,
-                                            y,
-                                            done_array,
+                                            csr_val + val_batch_stride * batch,
+                                            x + x_batch_stride * batch,
+                                            y + y_batch_stride * batch,
+                                            done_array + m * batch,
                                             map,
                                             offset,
                                             zero_pivot,
@@ -70,6 +76,28 @@ void csrsv_kernel(J m,
                                             diag_type);
 }
 
+template <unsigned int BLOCKSIZE, typename I, typename T>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrsv_transpose_values_kernel(I nnz,
+                                   const T* __restrict__ csr_val,
+                                   int64_t val_batch_stride,
+                                   const I* __restrict__ perm,
+                                   T* __restrict__ csrt_val,
+                                   bool conj)
+{
+    I       idx   = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    int64_t batch = hipBlockIdx_y;
+
+    if(idx >= nnz)
+    {
+        return;
+    }
+
+    T val = csr_val[val_batch_stride * batch + perm[idx]];
+
+    csrt_val[nnz * batch + idx] = conj ? rocsparse_conj(val) : val;
+}
+
 template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle,
                                                 rocsparse_operation       trans,
@@ -78,11 +106,15 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                                                 U                         alpha_device_host,
                                                 const rocsparse_mat_descr descr,
                                                 const T*                  csr_val,
+                                                int64_t                   val_batch_stride,
                                                 const I*                  csr_row_ptr,
                                                 const J*                  csr_col_ind,
                                                 rocsparse_mat_info        info,
                                                 const T*                  x,
+                                                int64_t                   x_batch_stride,
                                                 T*                        y,
+                                                int64_t                   y_batch_stride,
+                                                J                         batch_count,
                                                 rocsparse_solve_policy    policy,
                                                 void*                     temp_buffer)
 {
@@ -94,12 +126,12 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
 
     ptr += 256;
 
-    // done array
+    // done array, one per batch
     int* done_array = reinterpret_cast<int*>(ptr);
-    ptr += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+    ptr += ((sizeof(int) * m * batch_count - 1) / 256 + 1) * 256;
 
     // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m * batch_count, stream));
 
     rocsparse_trm_info csrsv
         = (descr->fill_mode == rocsparse_fill_mode_upper)
@@ -128,31 +160,33 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
     rocsparse_fill_mode fill_mode = descr->fill_mode;
 
     // When computing transposed triangular solve, we first need to update the
-    // transposed matrix values
+    // transposed matrix values of each batch
     if(trans == rocsparse_operation_transpose || trans == rocsparse_operation_conjugate_transpose)
     {
         T* csrt_val = reinterpret_cast<T*>(ptr);
 
-        // Gather values
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
-            handle, nnz, csr_val, csrt_val, (const I*)csrsv->trmt_perm, rocsparse_index_base_zero));
+        // Matrix values are either shared by all batches or strided
+        J val_batch_count = (val_batch_stride == 0) ? 1 : batch_count;
 
-        if(trans == rocsparse_operation_conjugate_transpose)
-        {
-            // conjugate csrt_val
-            hipLaunchKernelGGL((conjugate<256, I, T>),
-                               dim3((nnz - 1) / 256 + 1),
-                               dim3(256),
-                               0,
-                               stream,
-                               nnz,
-                               csrt_val);
-        }
+        // Gather (and conjugate) values
+        hipLaunchKernelGGL((csrsv_transpose_values_kernel<256, I, T>),
+                           dim3((nnz - 1) / 256 + 1, val_batch_count),
+                           dim3(256),
+                           0,
+                           stream,
+                           nnz,
+                           csr_val,
+                           val_batch_stride,
+                           (const I*)csrsv->trmt_perm,
+                           csrt_val,
+                           trans == rocsparse_operation_conjugate_transpose);
 
         local_csr_row_ptr = (const I*)csrsv->trmt_row_ptr;
         local_csr_col_ind = (const J*)csrsv->trmt_col_ind;
         local_csr_val     = (const T*)csrt_val;
 
+        val_batch_stride = (val_batch_stride == 0) ? 0 : nnz;
+
         fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
                                                              : rocsparse_fill_mode_lower;
     }
@@ -162,7 +196,7 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
     int asicRev = handle->asic_rev;
 
 #define CSRSV_DIM 1024
-    dim3 csrsv_blocks(((int64_t)handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_blocks(((int64_t)handle->wavefront_size * m - 1) / CSRSV_DIM + 1, batch_count);
     dim3 csrsv_threads(CSRSV_DIM);
 
     // gfx908
@@ -179,8 +213,11 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                            local_csr_row_ptr,
                            local_csr_col_ind,
                            local_csr_val,
+                           val_batch_stride,
                            x,
+                           x_batch_stride,
                            y,
+                           y_batch_stride,
                            done_array,
                            (J*)csrsv->row_map,
                            0,
@@ -206,8 +243,11 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                                local_csr_row_ptr,
                                local_csr_col_ind,
                                local_csr_val,
+                               val_batch_stride,
                                x,
+                               x_batch_stride,
                                y,
+                               y_batch_stride,
                                done_array,
                                (J*)csrsv->row_map,
                                0,
@@ -230,8 +270,11 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                                local_csr_row_ptr,
                                local_csr_col_ind,
                                local_csr_val,
+                               val_batch_stride,
                                x,
+                               x_batch_stride,
                                y,
+                               y_batch_stride,
                                done_array,
                                (J*)csrsv->row_map,
                                0,
@@ -362,11 +405,197 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                               alpha_device_host,
                                               descr,
                                               csr_val,
+                                              (int64_t)0,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              x,
+                                              (int64_t)0,
+                                              y,
+                                              (int64_t)0,
+                                              (J)1,
+                                              policy,
+                                              temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csrsv_solve_dispatch(handle,
+                                              trans,
+                                              m,
+                                              nnz,
+                                              *alpha_device_host,
+                                              descr,
+                                              csr_val,
+                                              (int64_t)0,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              x,
+                                              (int64_t)0,
+                                              y,
+                                              (int64_t)0,
+                                              (J)1,
+                                              policy,
+                                              temp_buffer);
+    }
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrsv_solve_strided_batched_buffer_size_template(
+    rocsparse_operation trans, J m, I nnz, J batch_count, int64_t val_batch_stride, size_t* buffer_size)
+{
+    // Check sizes
+    if(m < 0 || nnz < 0 || batch_count < 0 || val_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || batch_count == 0)
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    *buffer_size = 256;
+
+    // int done_array[m * batch_count]
+    *buffer_size += ((sizeof(int) * m * batch_count - 1) / 256 + 1) * 256;
+
+    // Transposed values of each batch
+    if(trans == rocsparse_operation_transpose || trans == rocsparse_operation_conjugate_transpose)
+    {
+        J val_batch_count = (val_batch_stride == 0) ? 1 : batch_count;
+
+        *buffer_size += ((sizeof(T) * nnz * val_batch_count - 1) / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status
+    rocsparse_csrsv_solve_strided_batched_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   J                         m,
+                                                   I                         nnz,
+                                                   const T*                  alpha_device_host,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   int64_t                   val_batch_stride,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   const T*                  x,
+                                                   int64_t                   x_batch_stride,
+                                                   T*                        y,
+                                                   int64_t                   y_batch_stride,
+                                                   J                         batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(policy))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check batch strides, batches must not overlap
+    if(val_batch_stride < 0 || x_batch_stride < 0 || y_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(batch_count > 1 && (y_batch_stride < m || (val_batch_stride != 0 && val_batch_stride < nnz)))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || alpha_device_host == nullptr || x == nullptr || y == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_col_ind == nullptr && csr_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrsv_solve_dispatch(handle,
+                                              trans,
+                                              m,
+                                              nnz,
+                                              alpha_device_host,
+                                              descr,
+                                              csr_val,
+                                              val_batch_stride,
                                               csr_row_ptr,
                                               csr_col_ind,
                                               info,
                                               x,
+                                              x_batch_stride,
                                               y,
+                                              y_batch_stride,
+                                              batch_count,
                                               policy,
                                               temp_buffer);
     }
@@ -379,11 +608,15 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                               *alpha_device_host,
                                               descr,
                                               csr_val,
+                                              val_batch_stride,
                                               csr_row_ptr,
                                               csr_col_ind,
                                               info,
                                               x,
+                                              x_batch_stride,
                                               y,
+                                              y_batch_stride,
+                                              batch_count,
                                               policy,
                                               temp_buffer);
     }
@@ -404,7 +637,35 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         const TTYPE*              x,                                               \
         TTYPE*                    y,                                               \
         rocsparse_solve_policy    policy,                                          \
-        void*                     temp_buffer);
+        void*                     temp_buffer);                                    \
+    template rocsparse_status                                                      \
+        rocsparse_csrsv_solve_strided_batched_buffer_size_template<ITYPE, JTYPE, TTYPE>( \
+            rocsparse_operation trans,                                             \
+            JTYPE               m,                                                 \
+            ITYPE               nnz,                                               \
+            JTYPE               batch_count,                                       \
+            int64_t             val_batch_stride,                                  \
+            size_t*             buffer_size);                                      \
+    template rocsparse_status                                                      \
+        rocsparse_csrsv_solve_strided_batched_template<ITYPE, JTYPE, TTYPE>(      \
+            rocsparse_handle          handle,                                      \
+            rocsparse_operation       trans,                                       \
+            JTYPE                     m,                                           \
+            ITYPE                     nnz,                                         \
+            const TTYPE*              alpha_device_host,                           \
+            const rocsparse_mat_descr descr,                                       \
+            const TTYPE*              csr_val,                                     \
+            int64_t                   val_batch_stride,                            \
+            const ITYPE*              csr_row_ptr,                                 \
+            const JTYPE*              csr_col_ind,                                 \
+            rocsparse_mat_info        info,                                        \
+            const TTYPE*              x,                                           \
+            int64_t                   x_batch_stride,                              \
+            TTYPE*                    y,                                           \
+            int64_t                   y_batch_stride,                              \
+            JTYPE                     batch_count,                                 \
+            rocsparse_solve_policy    policy,                                      \
+            void*                     temp_buffer);
 
 INSTANTIATE(int32_t, int32_t, float);
 INSTANTIATE(int32_t, int32_t, double);
@@ -287,10 +287,10 @@ try
               (const void*&)host_tol,
               (const void*&)host_history,
               trans,
-              (const void*&)alpha,
-              (const void*&)mat,
-              (const void*&)x,
-              (const void*&)y,
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat,
+              x,
+              y,
               compute_type,
               alg,
               stage,
@@ -32,6 +32,7 @@
 #include "rocsparse_cscmv.hpp"
 #include "rocsparse_csrmv.hpp"
 #include "rocsparse_ellmv.hpp"
+#include "rocsparse_spmv_strided_batched.hpp"
 
 static rocsparse_status rocsparse_check_spmv_alg(rocsparse_format format, rocsparse_spmv_alg alg)
 {
@@ -353,6 +354,16 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
 {
     RETURN_IF_ROCSPARSE_ERROR((rocsparse_check_spmv_alg(mat->format, alg)));
 
+    // Strided batched SpMV, all batches share the sparsity pattern of the matrix
+    const int64_t batch_count    = y->batch_count;
+    const int64_t x_batch_stride = (x->batch_count > 1) ? x->batch_stride : 0;
+    const int64_t val_batch_stride
+        = (mat->batch_count > 1) ? ((mat->format == rocsparse_format_coo
+                                     || mat->format == rocsparse_format_ell)
+                                        ? mat->batch_stride
+                                        : mat->columns_values_batch_stride)
+                                 : 0;
+
     switch(mat->format)
     {
     case rocsparse_format_coo:
@@ -389,6 +400,27 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
         }
         case rocsparse_spmv_stage_compute:
         {
+            if(batch_count > 1)
+            {
+                return rocsparse_coomv_strided_batched_template(handle,
+                                                                trans,
+                                                                (I)mat->rows,
+                                                                (I)mat->cols,
+                                                                mat->nnz,
+                                                                (const T*)alpha,
+                                                                mat->descr,
+                                                                (const A*)mat->const_val_data,
+                                                                val_batch_stride,
+                                                                (const I*)mat->const_row_data,
+                                                                (const I*)mat->const_col_data,
+                                                                (const X*)x->const_values,
+                                                                x_batch_stride,
+                                                                (const T*)beta,
+                                                                (Y*)y->values,
+                                                                y->batch_stride,
+                                                                (I)batch_count);
+            }
+
             return rocsparse_coomv_template(handle,
                                             trans,
                                             coomv_alg,
@@ -497,6 +529,29 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
 
         case rocsparse_spmv_stage_compute:
         {
+            if(batch_count > 1)
+            {
+                return rocsparse_bsrmv_strided_batched_template(handle,
+                                                                mat->block_dir,
+                                                                trans,
+                                                                (J)mat->rows,
+                                                                (J)mat->cols,
+                                                                (I)mat->nnz,
+                                                                (const T*)alpha,
+                                                                mat->descr,
+                                                                (const A*)mat->const_val_data,
+                                                                val_batch_stride,
+                                                                (const I*)mat->const_row_data,
+                                                                (const J*)mat->const_col_data,
+                                                                (J)mat->block_dim,
+                                                                (const X*)x->const_values,
+                                                                x_batch_stride,
+                                                                (const T*)beta,
+                                                                (Y*)y->values,
+                                                                y->batch_stride,
+                                                                (J)batch_count);
+            }
+
             return rocsparse_bsrmv_template(handle,
                                             mat->block_dir,
                                             trans,
@@ -565,6 +620,27 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
 
         case rocsparse_spmv_stage_compute:
         {
+            if(batch_count > 1)
+            {
+                return rocsparse_csrmv_strided_batched_template(handle,
+                                                                trans,
+                                                                (J)mat->rows,
+                                                                (J)mat->cols,
+                                                                (I)mat->nnz,
+                                                                (const T*)alpha,
+                                                                mat->descr,
+                                                                (const A*)mat->const_val_data,
+                                                                val_batch_stride,
+                                                                (const I*)mat->const_row_data,
+                                                                (const J*)mat->const_col_data,
+                                                                (const X*)x->const_values,
+                                                                x_batch_stride,
+                                                                (const T*)beta,
+                                                                (Y*)y->values,
+                                                                y->batch_stride,
+                                                                (J)batch_count);
+            }
+
             return rocsparse_csrmv_template(handle,
                                             trans,
                                             (J)mat->rows,
@@ -676,6 +752,26 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
 
         case rocsparse_spmv_stage_compute:
         {
+            if(batch_count > 1)
+            {
+                return rocsparse_ellmv_strided_batched_template(handle,
+                                                                trans,
+                                                                (I)mat->rows,
+                                                                (I)mat->cols,
+                                                                (const T*)alpha,
+                                                                mat->descr,
+                                                                (const A*)mat->const_val_data,
+                                                                val_batch_stride,
+                                                                (const I*)mat->const_col_data,
+                                                                (I)mat->ell_width,
+                                                                (const X*)x->const_values,
+                                                                x_batch_stride,
+                                                                (const T*)beta,
+                                                                (Y*)y->values,
+                                                                y->batch_stride,
+                                                                (I)batch_count);
+            }
+
             return rocsparse_ellmv_template(handle,
                                             trans,
                                             (I)mat->rows,
@@ -921,11 +1017,11 @@ try
     log_trace(handle,
               "rocsparse_spmv",
               trans,
-              (const void*&)alpha,
-              (const void*&)mat,
-              (const void*&)x,
-              (const void*&)beta,
-              (const void*&)y,
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat,
+              x,
+              rocsparse_scalar_arg{beta, compute_type},
+              y,
               compute_type,
               alg,
               stage,
@@ -976,6 +1072,34 @@ try
     }
     // LCOV_EXCL_STOP
 
+    // Check batch counts, the matrix and x can either be shared by all batches
+    // or have the same batch count as y
+    if((mat->batch_count != 1 && mat->batch_count != y->batch_count)
+       || (x->batch_count != 1 && x->batch_count != y->batch_count))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Batched SpMV is available for CSR, COO, ELL and BSR formats, where all
+    // matrices share the sparsity pattern
+    if(y->batch_count > 1)
+    {
+        if(mat->format != rocsparse_format_csr && mat->format != rocsparse_format_coo
+           && mat->format != rocsparse_format_ell && mat->format != rocsparse_format_bsr)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        if(mat->offsets_batch_stride != 0)
+        {
+            return rocsparse_status_not_implemented;
+        }
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_spmv", rocsparse_profile_models::spmv(mat, x, y, stage, temp_buffer));
+
     return rocsparse_spmv_dynamic_dispatch(determine_I_index_type(mat),
                                            determine_J_index_type(mat),
                                            mat->data_type,
@@ -47,11 +47,11 @@ try
     log_trace(handle,
               "rocsparse_spmv_ex",
               trans,
-              (const void*&)alpha,
-              (const void*&)mat,
-              (const void*&)x,
-              (const void*&)beta,
-              (const void*&)y,
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat,
+              x,
+              rocsparse_scalar_arg{beta, compute_type},
+              y,
               compute_type,
               alg,
               (const void*&)buffer_size,
@@ -0,0 +1,731 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include "rocsparse_csrmv.hpp"
+#include "spmv_fused_device.h"
+
+#define SPMV_FUSED_DIM 512
+#define SPMV_FUSED_MAX_BLOCKS 1024
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_fused_kernel(J        m,
+                         U        alpha_device_host,
+                         const I* csr_row_ptr,
+                         const J* __restrict__ csr_col_ind,
+                         const T* __restrict__ csr_val,
+                         const T* __restrict__ x,
+                         U        beta_device_host,
+                         T*       y,
+                         const T* z,
+                         T* __restrict__ workspace,
+                         U                    gamma_device_host,
+                         U                    delta_device_host,
+                         T*                   w,
+                         rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+
+    // gamma and delta are only accessed if w is updated
+    auto gamma = (w != nullptr) ? load_scalar_device_host(gamma_device_host) : static_cast<T>(0);
+    auto delta = (w != nullptr) ? load_scalar_device_host(delta_device_host) : static_cast<T>(0);
+
+    csrmvn_fused_device<BLOCKSIZE, WF_SIZE>(m,
+                                            alpha,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            x,
+                                            beta,
+                                            y,
+                                            z,
+                                            workspace,
+                                            gamma,
+                                            delta,
+                                            w,
+                                            idx_base);
+}
+
+template <unsigned int BLOCKSIZE, typename J, typename T, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void spmv_fused_update_kernel(J        m,
+                              const T* y,
+                              const T* z,
+                              T* __restrict__ workspace,
+                              U  gamma_device_host,
+                              U  delta_device_host,
+                              T* w)
+{
+    auto gamma = (w != nullptr) ? load_scalar_device_host(gamma_device_host) : static_cast<T>(0);
+    auto delta = (w != nullptr) ? load_scalar_device_host(delta_device_host) : static_cast<T>(0);
+
+    spmv_fused_update_device<BLOCKSIZE>(m, y, z, workspace, gamma, delta, w);
+}
+
+template <unsigned int BLOCKSIZE, typename T>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void spmv_fused_dot_reduce_kernel(rocsparse_int nblocks, const T* workspace, T* result)
+{
+    spmv_fused_dot_reduce_device<BLOCKSIZE>(nblocks, workspace, result);
+}
+
+#define LAUNCH_CSRMVN_FUSED(wfsize)                                   \
+    hipLaunchKernelGGL((csrmvn_fused_kernel<SPMV_FUSED_DIM, wfsize>), \
+                       dim3(nblocks),                                 \
+                       dim3(SPMV_FUSED_DIM),                          \
+                       0,                                             \
+                       handle->stream,                                \
+                       m,                                             \
+                       alpha_device_host,                             \
+                       csr_row_ptr,                                   \
+                       csr_col_ind,                                   \
+                       csr_val,                                       \
+                       x,                                             \
+                       beta_device_host,                              \
+                       y,                                             \
+                       z,                                             \
+                       workspace,                                     \
+                       gamma_device_host,                             \
+                       delta_device_host,                             \
+                       w,                                             \
+                       idx_base)
+
+template <typename J>
+static rocsparse_int rocsparse_spmv_fused_block_count(J m)
+{
+    return std::min(static_cast<rocsparse_int>((m - 1) / SPMV_FUSED_DIM + 1),
+                    static_cast<rocsparse_int>(SPMV_FUSED_MAX_BLOCKS));
+}
+
+template <typename T, typename I, typename J, typename U>
+static rocsparse_status rocsparse_csrmvn_fused_dispatch(rocsparse_handle     handle,
+                                                        J                    m,
+                                                        I                    nnz,
+                                                        U                    alpha_device_host,
+                                                        const I*             csr_row_ptr,
+                                                        const J*             csr_col_ind,
+                                                        const T*             csr_val,
+                                                        const T*             x,
+                                                        U                    beta_device_host,
+                                                        T*                   y,
+                                                        const T*             z,
+                                                        T*                   workspace,
+                                                        U                    gamma_device_host,
+                                                        U                    delta_device_host,
+                                                        T*                   w,
+                                                        rocsparse_index_base idx_base)
+{
+    rocsparse_int nblocks = rocsparse_spmv_fused_block_count(m);
+
+    // Average nnz per row
+    J nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMVN_FUSED(2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMVN_FUSED(4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMVN_FUSED(8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSRMVN_FUSED(16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVN_FUSED(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_FUSED(64);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_spmv_fused_template(rocsparse_handle            handle,
+                                               const void*                 alpha,
+                                               rocsparse_const_spmat_descr mat,
+                                               rocsparse_const_dnvec_descr x,
+                                               const void*                 beta,
+                                               const rocsparse_dnvec_descr y,
+                                               rocsparse_const_dnvec_descr z,
+                                               void*                       dot,
+                                               const void*                 gamma,
+                                               const void*                 delta,
+                                               rocsparse_dnvec_descr       w,
+                                               rocsparse_spmv_alg          alg,
+                                               rocsparse_spmv_stage        stage,
+                                               size_t*                     buffer_size,
+                                               void*                       temp_buffer)
+{
+    J m   = (J)mat->rows;
+    J n   = (J)mat->cols;
+    I nnz = (I)mat->nnz;
+
+    // The default algorithm only uses adaptive SpMV if no vector update is fused, since
+    // adaptive SpMV requires a second pass over y to apply the updates
+    bool fused_update = (dot != nullptr || w != nullptr);
+    bool adaptive     = (alg == rocsparse_spmv_alg_csr_adaptive)
+                    || (alg == rocsparse_spmv_alg_default && fused_update == false);
+
+    switch(stage)
+    {
+    case rocsparse_spmv_stage_buffer_size:
+    {
+        // Partial dot products of each block, plus the final result
+        *buffer_size = sizeof(T) * (rocsparse_spmv_fused_block_count(m) + 1);
+        return rocsparse_status_success;
+    }
+
+    case rocsparse_spmv_stage_preprocess:
+    {
+        // Analysis is only required for the adaptive algorithm
+        if(adaptive && mat->analysed == false)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_csrmv_analysis_template(handle,
+                                                  rocsparse_operation_none,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  mat->descr,
+                                                  (const T*)mat->const_val_data,
+                                                  (const I*)mat->const_row_data,
+                                                  (const J*)mat->const_col_data,
+                                                  mat->info));
+
+            mat->analysed = true;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    case rocsparse_spmv_stage_compute:
+    {
+        // Workspace is required for the dot product
+        if(dot != nullptr && temp_buffer == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        // Quick return
+        if(m == 0)
+        {
+            if(dot != nullptr)
+            {
+                if(handle->pointer_mode == rocsparse_pointer_mode_device)
+                {
+                    RETURN_IF_HIP_ERROR(hipMemsetAsync(dot, 0, sizeof(T), handle->stream));
+                }
+                else
+                {
+                    *(T*)dot = static_cast<T>(0);
+                }
+            }
+
+            return rocsparse_status_success;
+        }
+
+        const I* csr_row_ptr = (const I*)mat->const_row_data;
+        const J* csr_col_ind = (const J*)mat->const_col_data;
+        const T* csr_val     = (const T*)mat->const_val_data;
+
+        // Dot product partner defaults to x
+        const T* zval      = (const T*)((z != nullptr) ? z->const_values : x->const_values);
+        T*       wval      = (w != nullptr) ? (T*)w->values : nullptr;
+        T*       workspace = (dot != nullptr) ? (T*)temp_buffer : nullptr;
+
+        rocsparse_int nblocks = rocsparse_spmv_fused_block_count(m);
+
+        if(adaptive == false || mat->info == nullptr || mat->info->csrmv_info == nullptr)
+        {
+            // Single pass over y, vector updates are applied as soon as a row is complete
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    rocsparse_csrmvn_fused_dispatch(handle,
+                                                    m,
+                                                    nnz,
+                                                    (const T*)alpha,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    csr_val,
+                                                    (const T*)x->const_values,
+                                                    (const T*)beta,
+                                                    (T*)y->values,
+                                                    zval,
+                                                    workspace,
+                                                    (const T*)gamma,
+                                                    (const T*)delta,
+                                                    wval,
+                                                    mat->idx_base));
+            }
+            else
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmvn_fused_dispatch(
+                    handle,
+                    m,
+                    nnz,
+                    *(const T*)alpha,
+                    csr_row_ptr,
+                    csr_col_ind,
+                    csr_val,
+                    (const T*)x->const_values,
+                    *(const T*)beta,
+                    (T*)y->values,
+                    zval,
+                    workspace,
+                    (gamma != nullptr) ? *(const T*)gamma : static_cast<T>(0),
+                    (delta != nullptr) ? *(const T*)delta : static_cast<T>(0),
+                    wval,
+                    mat->idx_base));
+            }
+        }
+        else
+        {
+            // Adaptive SpMV completes long rows across several blocks, thus the
+            // vector updates are applied in a second pass over y
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template(handle,
+                                                               rocsparse_operation_none,
+                                                               m,
+                                                               n,
+                                                               nnz,
+                                                               (const T*)alpha,
+                                                               mat->descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_row_ptr + 1,
+                                                               csr_col_ind,
+                                                               mat->info,
+                                                               (const T*)x->const_values,
+                                                               (const T*)beta,
+                                                               (T*)y->values,
+                                                               false));
+
+            if(dot != nullptr || w != nullptr)
+            {
+                if(handle->pointer_mode == rocsparse_pointer_mode_device)
+                {
+                    hipLaunchKernelGGL((spmv_fused_update_kernel<SPMV_FUSED_DIM>),
+                                       dim3(nblocks),
+                                       dim3(SPMV_FUSED_DIM),
+                                       0,
+                                       handle->stream,
+                                       m,
+                                       (const T*)y->values,
+                                       zval,
+                                       workspace,
+                                       (const T*)gamma,
+                                       (const T*)delta,
+                                       wval);
+                }
+                else
+                {
+                    hipLaunchKernelGGL((spmv_fused_update_kernel<SPMV_FUSED_DIM>),
+                                       dim3(nblocks),
+                                       dim3(SPMV_FUSED_DIM),
+                                       0,
+                                       handle->stream,
+                                       m,
+                                       (const T*)y->values,
+                                       zval,
+                                       workspace,
+                                       (gamma != nullptr) ? *(const T*)gamma : static_cast<T>(0),
+                                       (delta != nullptr) ? *(const T*)delta : static_cast<T>(0),
+                                       wval);
+                }
+            }
+        }
+
+        // Reduce the partial dot products
+        if(dot != nullptr)
+        {
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                hipLaunchKernelGGL((spmv_fused_dot_reduce_kernel<SPMV_FUSED_DIM>),
+                                   dim3(1),
+                                   dim3(SPMV_FUSED_DIM),
+                                   0,
+                                   handle->stream,
+                                   nblocks,
+                                   workspace,
+                                   (T*)dot);
+            }
+            else
+            {
+                hipLaunchKernelGGL((spmv_fused_dot_reduce_kernel<SPMV_FUSED_DIM>),
+                                   dim3(1),
+                                   dim3(SPMV_FUSED_DIM),
+                                   0,
+                                   handle->stream,
+                                   nblocks,
+                                   workspace,
+                                   workspace + nblocks);
+
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                    dot, workspace + nblocks, sizeof(T), hipMemcpyDeviceToHost, handle->stream));
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    case rocsparse_spmv_stage_auto:
+    {
+        if(temp_buffer == nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_spmv_fused_template<T, I, J>(
+                handle,
+                alpha,
+                mat,
+                x,
+                beta,
+                y,
+                z,
+                dot,
+                gamma,
+                delta,
+                w,
+                alg,
+                rocsparse_spmv_stage_buffer_size,
+                buffer_size,
+                temp_buffer)));
+
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_spmv_fused_template<T, I, J>(
+            handle,
+            alpha,
+            mat,
+            x,
+            beta,
+            y,
+            z,
+            dot,
+            gamma,
+            delta,
+            w,
+            alg,
+            rocsparse_spmv_stage_preprocess,
+            buffer_size,
+            temp_buffer)));
+
+        return rocsparse_spmv_fused_template<T, I, J>(handle,
+                                                      alpha,
+                                                      mat,
+                                                      x,
+                                                      beta,
+                                                      y,
+                                                      z,
+                                                      dot,
+                                                      gamma,
+                                                      delta,
+                                                      w,
+                                                      alg,
+                                                      rocsparse_spmv_stage_compute,
+                                                      buffer_size,
+                                                      temp_buffer);
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+#define DISPATCH_SPMV_FUSED_INDEX(TTYPE, itype, jtype, ...)                             \
+    {                                                                                   \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32)        \
+            return rocsparse_spmv_fused_template<TTYPE, int32_t, int32_t>(__VA_ARGS__); \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32)        \
+            return rocsparse_spmv_fused_template<TTYPE, int64_t, int32_t>(__VA_ARGS__); \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64)        \
+            return rocsparse_spmv_fused_template<TTYPE, int64_t, int64_t>(__VA_ARGS__); \
+        return rocsparse_status_not_implemented;                                        \
+    }
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_spmv_fused(rocsparse_handle            handle,
+                                                 const void*                 alpha,
+                                                 rocsparse_const_spmat_descr mat,
+                                                 rocsparse_const_dnvec_descr x,
+                                                 const void*                 beta,
+                                                 const rocsparse_dnvec_descr y,
+                                                 rocsparse_const_dnvec_descr z,
+                                                 void*                       dot,
+                                                 const void*                 gamma,
+                                                 const void*                 delta,
+                                                 rocsparse_dnvec_descr       w,
+                                                 rocsparse_datatype          compute_type,
+                                                 rocsparse_spmv_alg          alg,
+                                                 rocsparse_spmv_stage        stage,
+                                                 size_t*                     buffer_size,
+                                                 void*                       temp_buffer)
+try
+{
+    // Check for invalid handle
+    RETURN_IF_INVALID_HANDLE(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spmv_fused",
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat,
+              x,
+              rocsparse_scalar_arg{beta, compute_type},
+              y,
+              z,
+              (const void*&)dot,
+              rocsparse_scalar_arg{gamma, compute_type},
+              rocsparse_scalar_arg{delta, compute_type},
+              w,
+              compute_type,
+              alg,
+              stage,
+              (const void*&)buffer_size,
+              (const void*&)temp_buffer);
+
+    // Check for invalid descriptors
+    RETURN_IF_NULLPTR(mat);
+    RETURN_IF_NULLPTR(x);
+    RETURN_IF_NULLPTR(y);
+
+    // Check for valid pointers
+    RETURN_IF_NULLPTR(alpha);
+    RETURN_IF_NULLPTR(beta);
+
+    // Scalars of the axpby update are required if w is updated
+    if(w != nullptr)
+    {
+        RETURN_IF_NULLPTR(gamma);
+        RETURN_IF_NULLPTR(delta);
+    }
+
+    if(rocsparse_enum_utils::is_invalid(compute_type))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(alg))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(stage))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check for valid buffer_size pointer only if temp_buffer is nullptr
+    if(temp_buffer == nullptr)
+    {
+        RETURN_IF_NULLPTR(buffer_size);
+    }
+
+    // Check if descriptors are initialized
+    if(mat->init == false || x->init == false || y->init == false
+       || (z != nullptr && z->init == false) || (w != nullptr && w->init == false))
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Fused SpMV is built on top of the CSR stream and adaptive algorithms
+    if(mat->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(alg != rocsparse_spmv_alg_default && alg != rocsparse_spmv_alg_csr_stream
+       && alg != rocsparse_spmv_alg_csr_adaptive)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(mat->descr->type != rocsparse_matrix_type_general
+       || mat->descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Batched fused SpMV is not supported
+    if(mat->batch_count > 1 || x->batch_count > 1 || y->batch_count > 1
+       || (z != nullptr && z->batch_count > 1) || (w != nullptr && w->batch_count > 1))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(x->size != mat->cols || y->size != mat->rows)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if((z != nullptr && z->size != y->size) || (w != nullptr && w->size != y->size))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Without z, the dot product is computed with x, requiring a square matrix
+    if(dot != nullptr && z == nullptr && x->size != y->size)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Only uniform precisions are supported
+    if(mat->data_type != compute_type || x->data_type != compute_type
+       || y->data_type != compute_type || (z != nullptr && z->data_type != compute_type)
+       || (w != nullptr && w->data_type != compute_type))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle,
+        "rocsparse_spmv_fused",
+        rocsparse_profile_models::spmv_fused(mat, x, y, z, w, stage, temp_buffer));
+
+    switch(compute_type)
+    {
+    case rocsparse_datatype_f32_r:
+    {
+        DISPATCH_SPMV_FUSED_INDEX(float,
+                                  mat->row_type,
+                                  mat->col_type,
+                                  handle,
+                                  alpha,
+                                  mat,
+                                  x,
+                                  beta,
+                                  y,
+                                  z,
+                                  dot,
+                                  gamma,
+                                  delta,
+                                  w,
+                                  alg,
+                                  stage,
+                                  buffer_size,
+                                  temp_buffer);
+    }
+    case rocsparse_datatype_f64_r:
+    {
+        DISPATCH_SPMV_FUSED_INDEX(double,
+                                  mat->row_type,
+                                  mat->col_type,
+                                  handle,
+                                  alpha,
+                                  mat,
+                                  x,
+                                  beta,
+                                  y,
+                                  z,
+                                  dot,
+                                  gamma,
+                                  delta,
+                                  w,
+                                  alg,
+                                  stage,
+                                  buffer_size,
+                                  temp_buffer);
+    }
+    case rocsparse_datatype_f32_c:
+    {
+        DISPATCH_SPMV_FUSED_INDEX(rocsparse_float_complex,
+                                  mat->row_type,
+                                  mat->col_type,
+                                  handle,
+                                  alpha,
+                                  mat,
+                                  x,
+                                  beta,
+                                  y,
+                                  z,
+                                  dot,
+                                  gamma,
+                                  delta,
+                                  w,
+                                  alg,
+                                  stage,
+                                  buffer_size,
+                                  temp_buffer);
+    }
+    case rocsparse_datatype_f64_c:
+    {
+        DISPATCH_SPMV_FUSED_INDEX(rocsparse_double_complex,
+                                  mat->row_type,
+                                  mat->col_type,
+                                  handle,
+                                  alpha,
+                                  mat,
+                                  x,
+                                  beta,
+                                  y,
+                                  z,
+                                  dot,
+                                  gamma,
+                                  delta,
+                                  w,
+                                  alg,
+                                  stage,
+                                  buffer_size,
+                                  temp_buffer);
+    }
+    case rocsparse_datatype_i8_r:
+    case rocsparse_datatype_u8_r:
+    case rocsparse_datatype_i32_r:
+    case rocsparse_datatype_u32_r:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    }
+
+    return rocsparse_status_not_implemented;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
@@ -0,0 +1,1049 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_spmv_strided_batched.hpp"
+
+#include "definitions.h"
+#include "spmv_strided_batched_device.h"
+#include "utility.h"
+
+// Number of batches processed by a single block
+#define SPMV_BATCH_TILE 4
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrmvn_strided_batched_kernel(J m,
+                                   J batch_count,
+                                   U alpha_device_host,
+                                   const I* __restrict__ csr_row_ptr,
+                                   const J* __restrict__ csr_col_ind,
+                                   const A* __restrict__ csr_val,
+                                   int64_t val_batch_stride,
+                                   const X* __restrict__ x,
+                                   int64_t x_batch_stride,
+                                   U       beta_device_host,
+                                   Y* __restrict__ y,
+                                   int64_t              y_batch_stride,
+                                   rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != 0 || beta != 1)
+    {
+        csrmvn_strided_batched_device<BLOCKSIZE, WF_SIZE, SPMV_BATCH_TILE>(m,
+                                                                           batch_count,
+                                                                           alpha,
+                                                                           csr_row_ptr,
+                                                                           csr_col_ind,
+                                                                           csr_val,
+                                                                           val_batch_stride,
+                                                                           x,
+                                                                           x_batch_stride,
+                                                                           beta,
+                                                                           y,
+                                                                           y_batch_stride,
+                                                                           idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename A, typename X, typename Y, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void ellmvn_strided_batched_kernel(I m,
+                                   I n,
+                                   I ell_width,
+                                   I batch_count,
+                                   U alpha_device_host,
+                                   const I* __restrict__ ell_col_ind,
+                                   const A* __restrict__ ell_val,
+                                   int64_t val_batch_stride,
+                                   const X* __restrict__ x,
+                                   int64_t x_batch_stride,
+                                   U       beta_device_host,
+                                   Y* __restrict__ y,
+                                   int64_t              y_batch_stride,
+                                   rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != 0 || beta != 1)
+    {
+        ellmvn_strided_batched_device<BLOCKSIZE, SPMV_BATCH_TILE>(m,
+                                                                  n,
+                                                                  ell_width,
+                                                                  batch_count,
+                                                                  alpha,
+                                                                  ell_col_ind,
+                                                                  ell_val,
+                                                                  val_batch_stride,
+                                                                  x,
+                                                                  x_batch_stride,
+                                                                  beta,
+                                                                  y,
+                                                                  y_batch_stride,
+                                                                  idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void bsrmvn_strided_batched_kernel(rocsparse_direction dir,
+                                   J                   mb,
+                                   J                   block_dim,
+                                   J                   batch_count,
+                                   U                   alpha_device_host,
+                                   const I* __restrict__ bsr_row_ptr,
+                                   const J* __restrict__ bsr_col_ind,
+                                   const A* __restrict__ bsr_val,
+                                   int64_t val_batch_stride,
+                                   const X* __restrict__ x,
+                                   int64_t x_batch_stride,
+                                   U       beta_device_host,
+                                   Y* __restrict__ y,
+                                   int64_t              y_batch_stride,
+                                   rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != 0 || beta != 1)
+    {
+        bsrmvn_strided_batched_device<BLOCKSIZE, SPMV_BATCH_TILE>(dir,
+                                                                  mb,
+                                                                  block_dim,
+                                                                  batch_count,
+                                                                  alpha,
+                                                                  bsr_row_ptr,
+                                                                  bsr_col_ind,
+                                                                  bsr_val,
+                                                                  val_batch_stride,
+                                                                  x,
+                                                                  x_batch_stride,
+                                                                  beta,
+                                                                  y,
+                                                                  y_batch_stride,
+                                                                  idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename Y, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void spmv_strided_batched_scale_kernel(I size,
+                                       U scalar_device_host,
+                                       Y* __restrict__ data,
+                                       int64_t batch_stride)
+{
+    auto scalar = load_scalar_device_host(scalar_device_host);
+    if(scalar != 1)
+    {
+        spmv_strided_batched_scale_device<BLOCKSIZE>(size, scalar, data, batch_stride);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename A, typename X, typename Y, typename U>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void coomvn_strided_batched_kernel(int64_t nnz,
+                                   I       batch_count,
+                                   U       alpha_device_host,
+                                   const I* __restrict__ coo_row_ind,
+                                   const I* __restrict__ coo_col_ind,
+                                   const A* __restrict__ coo_val,
+                                   int64_t val_batch_stride,
+                                   const X* __restrict__ x,
+                                   int64_t x_batch_stride,
+                                   Y* __restrict__ y,
+                                   int64_t              y_batch_stride,
+                                   rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != 0)
+    {
+        coomvn_strided_batched_device<BLOCKSIZE, SPMV_BATCH_TILE>(nnz,
+                                                                  batch_count,
+                                                                  alpha,
+                                                                  coo_row_ind,
+                                                                  coo_col_ind,
+                                                                  coo_val,
+                                                                  val_batch_stride,
+                                                                  x,
+                                                                  x_batch_stride,
+                                                                  y,
+                                                                  y_batch_stride,
+                                                                  idx_base);
+    }
+}
+
+// Argument checks shared by all formats
+template <typename T>
+static rocsparse_status rocsparse_spmv_strided_batched_check(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             const rocsparse_mat_descr descr,
+                                                             const T*                  alpha,
+                                                             const T*                  beta,
+                                                             int64_t val_batch_stride,
+                                                             int64_t x_batch_stride,
+                                                             int64_t y_batch_stride,
+                                                             int64_t batch_count)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Only non-transposed general matrices are supported
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check batch count and strides
+    if(batch_count < 0 || val_batch_stride < 0 || x_batch_stride < 0 || y_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr || beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_status_success;
+}
+
+// Batches of y and of the matrix values must not overlap, a value batch
+// stride of zero shares the matrix values between all batches
+static rocsparse_status rocsparse_spmv_strided_batched_check_overlap(int64_t y_size,
+                                                                     int64_t val_size,
+                                                                     int64_t val_batch_stride,
+                                                                     int64_t y_batch_stride,
+                                                                     int64_t batch_count)
+{
+    if(batch_count > 1
+       && (y_batch_stride < y_size || (val_batch_stride != 0 && val_batch_stride < val_size)))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    CSR
+ * ===========================================================================
+ */
+#define LAUNCH_CSRMVN_STRIDED_BATCHED(WF_SIZE)                                           \
+    hipLaunchKernelGGL((csrmvn_strided_batched_kernel<CSRMVN_DIM, WF_SIZE>),             \
+                       dim3((int64_t(m) * WF_SIZE - 1) / CSRMVN_DIM + 1,                 \
+                            (batch_count - 1) / SPMV_BATCH_TILE + 1),                    \
+                       dim3(CSRMVN_DIM),                                                 \
+                       0,                                                                \
+                       handle->stream,                                                   \
+                       m,                                                                \
+                       batch_count,                                                      \
+                       alpha_device_host,                                                \
+                       csr_row_ptr,                                                      \
+                       csr_col_ind,                                                      \
+                       csr_val,                                                          \
+                       val_batch_stride,                                                 \
+                       x,                                                                \
+                       x_batch_stride,                                                   \
+                       beta_device_host,                                                 \
+                       y,                                                                \
+                       y_batch_stride,                                                   \
+                       descr->base)
+
+template <typename I, typename J, typename A, typename X, typename Y, typename U>
+static rocsparse_status rocsparse_csrmv_strided_batched_dispatch(rocsparse_handle handle,
+                                                                 J                m,
+                                                                 I                nnz,
+                                                                 U alpha_device_host,
+                                                                 const rocsparse_mat_descr descr,
+                                                                 const A* csr_val,
+                                                                 int64_t  val_batch_stride,
+                                                                 const I* csr_row_ptr,
+                                                                 const J* csr_col_ind,
+                                                                 const X* x,
+                                                                 int64_t  x_batch_stride,
+                                                                 U        beta_device_host,
+                                                                 Y*       y,
+                                                                 int64_t  y_batch_stride,
+                                                                 J        batch_count)
+{
+    // Average nnz per row
+    J nnz_per_row = nnz / m;
+
+#define CSRMVN_DIM 256
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED(2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED(4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED(8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED(16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_STRIDED_BATCHED(64);
+    }
+#undef CSRMVN_DIM
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_CSRMVN_STRIDED_BATCHED
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_csrmv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          J                         m,
+                                                          J                         n,
+                                                          I                         nnz,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const A*                  csr_val,
+                                                          int64_t val_batch_stride,
+                                                          const I* csr_row_ptr,
+                                                          const J* csr_col_ind,
+                                                          const X* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          Y*       y,
+                                                          int64_t  y_batch_stride,
+                                                          J        batch_count)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_strided_batched_check(handle,
+                                                                   trans,
+                                                                   descr,
+                                                                   alpha,
+                                                                   beta,
+                                                                   val_batch_stride,
+                                                                   x_batch_stride,
+                                                                   y_batch_stride,
+                                                                   batch_count));
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_strided_batched_check_overlap(
+        m, nnz, val_batch_stride, y_batch_stride, batch_count));
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(csr_row_ptr == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_strided_batched_dispatch(handle,
+                                                        m,
+                                                        nnz,
+                                                        alpha,
+                                                        descr,
+                                                        csr_val,
+                                                        val_batch_stride,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        x,
+                                                        x_batch_stride,
+                                                        beta,
+                                                        y,
+                                                        y_batch_stride,
+                                                        batch_count);
+    }
+    else
+    {
+        return rocsparse_csrmv_strided_batched_dispatch(handle,
+                                                        m,
+                                                        nnz,
+                                                        *alpha,
+                                                        descr,
+                                                        csr_val,
+                                                        val_batch_stride,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        x,
+                                                        x_batch_stride,
+                                                        *beta,
+                                                        y,
+                                                        y_batch_stride,
+                                                        batch_count);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    COO
+ * ===========================================================================
+ */
+template <typename I, typename A, typename X, typename Y, typename U>
+static rocsparse_status rocsparse_coomv_strided_batched_dispatch(rocsparse_handle handle,
+                                                                 I                m,
+                                                                 int64_t          nnz,
+                                                                 U alpha_device_host,
+                                                                 const rocsparse_mat_descr descr,
+                                                                 const A* coo_val,
+                                                                 int64_t  val_batch_stride,
+                                                                 const I* coo_row_ind,
+                                                                 const I* coo_col_ind,
+                                                                 const X* x,
+                                                                 int64_t  x_batch_stride,
+                                                                 U        beta_device_host,
+                                                                 Y*       y,
+                                                                 int64_t  y_batch_stride,
+                                                                 I        batch_count)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define COOMVN_DIM 256
+    // Scale all batches of y with beta
+    hipLaunchKernelGGL((spmv_strided_batched_scale_kernel<COOMVN_DIM>),
+                       dim3((m - 1) / COOMVN_DIM + 1, batch_count),
+                       dim3(COOMVN_DIM),
+                       0,
+                       stream,
+                       m,
+                       beta_device_host,
+                       y,
+                       y_batch_stride);
+
+    if(nnz > 0)
+    {
+        hipLaunchKernelGGL((coomvn_strided_batched_kernel<COOMVN_DIM>),
+                           dim3((nnz - 1) / COOMVN_DIM + 1,
+                                (batch_count - 1) / SPMV_BATCH_TILE + 1),
+                           dim3(COOMVN_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           batch_count,
+                           alpha_device_host,
+                           coo_row_ind,
+                           coo_col_ind,
+                           coo_val,
+                           val_batch_stride,
+                           x,
+                           x_batch_stride,
+                           y,
+                           y_batch_stride,
+                           descr->base);
+    }
+#undef COOMVN_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename A, typename X, typename Y>
+rocsparse_status rocsparse_coomv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          I                         m,
+                                                          I                         n,
+                                                          int64_t                   nnz,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const A*                  coo_val,
+                                                          int64_t val_batch_stride,
+                                                          const I* coo_row_ind,
+                                                          const I* coo_col_ind,
+                                                          const X* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          Y*       y,
+                                                          int64_t  y_batch_stride,
+                                                          I        batch_count)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_strided_batched_check(handle,
+                                                                   trans,
+                                                                   descr,
+                                                                   alpha,
+                                                                   beta,
+                                                                   val_batch_stride,
+                                                                   x_batch_stride,
+                                                                   y_batch_stride,
+                                                                   batch_count));
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_strided_batched_check_overlap(
+        m, nnz, val_batch_stride, y_batch_stride, batch_count));
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (coo_val == nullptr || coo_row_ind == nullptr || coo_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_coomv_strided_batched_dispatch(handle,
+                                                        m,
+                                                        nnz,
+                                                        alpha,
+                                                        descr,
+                                                        coo_val,
+                                                        val_batch_stride,
+                                                        coo_row_ind,
+                                                        coo_col_ind,
+                                                        x,
+                                                        x_batch_stride,
+                                                        beta,
+                                                        y,
+                                                        y_batch_stride,
+                                                        batch_count);
+    }
+    else
+    {
+        return rocsparse_coomv_strided_batched_dispatch(handle,
+                                                        m,
+                                                        nnz,
+                                                        *alpha,
+                                                        descr,
+                                                        coo_val,
+                                                        val_batch_stride,
+                                                        coo_row_ind,
+                                                        coo_col_ind,
+                                                        x,
+                                                        x_batch_stride,
+                                                        *beta,
+                                                        y,
+                                                        y_batch_stride,
+                                                        batch_count);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    ELL
+ * ===========================================================================
+ */
+template <typename I, typename A, typename X, typename Y, typename U>
+static rocsparse_status rocsparse_ellmv_strided_batched_dispatch(rocsparse_handle handle,
+                                                                 I                m,
+                                                                 I                n,
+                                                                 U alpha_device_host,
+                                                                 const rocsparse_mat_descr descr,
+                                                                 const A* ell_val,
+                                                                 int64_t  val_batch_stride,
+                                                                 const I* ell_col_ind,
+                                                                 I        ell_width,
+                                                                 const X* x,
+                                                                 int64_t  x_batch_stride,
+                                                                 U        beta_device_host,
+                                                                 Y*       y,
+                                                                 int64_t  y_batch_stride,
+                                                                 I        batch_count)
+{
+#define ELLMVN_DIM 512
+    hipLaunchKernelGGL((ellmvn_strided_batched_kernel<ELLMVN_DIM>),
+                       dim3((m - 1) / ELLMVN_DIM + 1, (batch_count - 1) / SPMV_BATCH_TILE + 1),
+                       dim3(ELLMVN_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       n,
+                       ell_width,
+                       batch_count,
+                       alpha_device_host,
+                       ell_col_ind,
+                       ell_val,
+                       val_batch_stride,
+                       x,
+                       x_batch_stride,
+                       beta_device_host,
+                       y,
+                       y_batch_stride,
+                       descr->base);
+#undef ELLMVN_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename A, typename X, typename Y>
+rocsparse_status rocsparse_ellmv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          I                         m,
+                                                          I                         n,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const A*                  ell_val,
+                                                          int64_t val_batch_stride,
+                                                          const I* ell_col_ind,
+                                                          I        ell_width,
+                                                          const X* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          Y*       y,
+                                                          int64_t  y_batch_stride,
+                                                          I        batch_count)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_strided_batched_check(handle,
+                                                                   trans,
+                                                                   descr,
+                                                                   alpha,
+                                                                   beta,
+                                                                   val_batch_stride,
+                                                                   x_batch_stride,
+                                                                   y_batch_stride,
+                                                                   batch_count));
+
+    // Check sizes
+    if(m < 0 || n < 0 || ell_width < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_strided_batched_check_overlap(
+        m, int64_t(m) * ell_width, val_batch_stride, y_batch_stride, batch_count));
+
+    // Sanity check
+    if((m == 0 || n == 0) && ell_width != 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(ell_width != 0 && (ell_val == nullptr || ell_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_ellmv_strided_batched_dispatch(handle,
+                                                        m,
+                                                        n,
+                                                        alpha,
+                                                        descr,
+                                                        ell_val,
+                                                        val_batch_stride,
+                                                        ell_col_ind,
+                                                        ell_width,
+                                                        x,
+                                                        x_batch_stride,
+                                                        beta,
+                                                        y,
+                                                        y_batch_stride,
+                                                        batch_count);
+    }
+    else
+    {
+        return rocsparse_ellmv_strided_batched_dispatch(handle,
+                                                        m,
+                                                        n,
+                                                        *alpha,
+                                                        descr,
+                                                        ell_val,
+                                                        val_batch_stride,
+                                                        ell_col_ind,
+                                                        ell_width,
+                                                        x,
+                                                        x_batch_stride,
+                                                        *beta,
+                                                        y,
+                                                        y_batch_stride,
+                                                        batch_count);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    BSR
+ * ===========================================================================
+ */
+template <typename I, typename J, typename A, typename X, typename Y, typename U>
+static rocsparse_status rocsparse_bsrmv_strided_batched_dispatch(rocsparse_handle    handle,
+                                                                 rocsparse_direction dir,
+                                                                 J                   mb,
+                                                                 U alpha_device_host,
+                                                                 const rocsparse_mat_descr descr,
+                                                                 const A* bsr_val,
+                                                                 int64_t  val_batch_stride,
+                                                                 const I* bsr_row_ptr,
+                                                                 const J* bsr_col_ind,
+                                                                 J        block_dim,
+                                                                 const X* x,
+                                                                 int64_t  x_batch_stride,
+                                                                 U        beta_device_host,
+                                                                 Y*       y,
+                                                                 int64_t  y_batch_stride,
+                                                                 J        batch_count)
+{
+#define BSRMVN_DIM 256
+    hipLaunchKernelGGL((bsrmvn_strided_batched_kernel<BSRMVN_DIM>),
+                       dim3((int64_t(mb) * block_dim - 1) / BSRMVN_DIM + 1,
+                            (batch_count - 1) / SPMV_BATCH_TILE + 1),
+                       dim3(BSRMVN_DIM),
+                       0,
+                       handle->stream,
+                       dir,
+                       mb,
+                       block_dim,
+                       batch_count,
+                       alpha_device_host,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       val_batch_stride,
+                       x,
+                       x_batch_stride,
+                       beta_device_host,
+                       y,
+                       y_batch_stride,
+                       descr->base);
+#undef BSRMVN_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_bsrmv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_direction       dir,
+                                                          rocsparse_operation       trans,
+                                                          J                         mb,
+                                                          J                         nb,
+                                                          I                         nnzb,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const A*                  bsr_val,
+                                                          int64_t val_batch_stride,
+                                                          const I* bsr_row_ptr,
+                                                          const J* bsr_col_ind,
+                                                          J        block_dim,
+                                                          const X* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          Y*       y,
+                                                          int64_t  y_batch_stride,
+                                                          J        batch_count)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_strided_batched_check(handle,
+                                                                   trans,
+                                                                   descr,
+                                                                   alpha,
+                                                                   beta,
+                                                                   val_batch_stride,
+                                                                   x_batch_stride,
+                                                                   y_batch_stride,
+                                                                   batch_count));
+
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0 || nb < 0 || nnzb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmv_strided_batched_check_overlap(int64_t(mb) * block_dim,
+                                                     int64_t(nnzb) * block_dim * block_dim,
+                                                     val_batch_stride,
+                                                     y_batch_stride,
+                                                     batch_count));
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(bsr_row_ptr == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnzb != 0 && (bsr_val == nullptr || bsr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_bsrmv_strided_batched_dispatch(handle,
+                                                        dir,
+                                                        mb,
+                                                        alpha,
+                                                        descr,
+                                                        bsr_val,
+                                                        val_batch_stride,
+                                                        bsr_row_ptr,
+                                                        bsr_col_ind,
+                                                        block_dim,
+                                                        x,
+                                                        x_batch_stride,
+                                                        beta,
+                                                        y,
+                                                        y_batch_stride,
+                                                        batch_count);
+    }
+    else
+    {
+        return rocsparse_bsrmv_strided_batched_dispatch(handle,
+                                                        dir,
+                                                        mb,
+                                                        *alpha,
+                                                        descr,
+                                                        bsr_val,
+                                                        val_batch_stride,
+                                                        bsr_row_ptr,
+                                                        bsr_col_ind,
+                                                        block_dim,
+                                                        x,
+                                                        x_batch_stride,
+                                                        *beta,
+                                                        y,
+                                                        y_batch_stride,
+                                                        batch_count);
+    }
+}
+
+#define INSTANTIATE_IJ(TTYPE, ITYPE, JTYPE, ATYPE, XTYPE, YTYPE)                         \
+    template rocsparse_status rocsparse_csrmv_strided_batched_template(                 \
+        rocsparse_handle          handle,                                               \
+        rocsparse_operation       trans,                                                \
+        JTYPE                     m,                                                    \
+        JTYPE                     n,                                                    \
+        ITYPE                     nnz,                                                  \
+        const TTYPE*              alpha,                                                \
+        const rocsparse_mat_descr descr,                                                \
+        const ATYPE*              csr_val,                                              \
+        int64_t                   val_batch_stride,                                     \
+        const ITYPE*              csr_row_ptr,                                          \
+        const JTYPE*              csr_col_ind,                                          \
+        const XTYPE*              x,                                                    \
+        int64_t                   x_batch_stride,                                       \
+        const TTYPE*              beta,                                                 \
+        YTYPE*                    y,                                                    \
+        int64_t                   y_batch_stride,                                       \
+        JTYPE                     batch_count);                                         \
+    template rocsparse_status rocsparse_bsrmv_strided_batched_template(                 \
+        rocsparse_handle          handle,                                               \
+        rocsparse_direction       dir,                                                  \
+        rocsparse_operation       trans,                                                \
+        JTYPE                     mb,                                                   \
+        JTYPE                     nb,                                                   \
+        ITYPE                     nnzb,                                                 \
+        const TTYPE*              alpha,                                                \
+        const rocsparse_mat_descr descr,                                                \
+        const ATYPE*              bsr_val,                                              \
+        int64_t                   val_batch_stride,                                     \
+        const ITYPE*              bsr_row_ptr,                                          \
+        const JTYPE*              bsr_col_ind,                                          \
+        JTYPE                     block_dim,                                            \
+        const XTYPE*              x,                                                    \
+        int64_t                   x_batch_stride,                                       \
+        const TTYPE*              beta,                                                 \
+        YTYPE*                    y,                                                    \
+        int64_t                   y_batch_stride,                                       \
+        JTYPE                     batch_count)
+
+#define INSTANTIATE_I(TTYPE, ITYPE, ATYPE, XTYPE, YTYPE)                                 \
+    template rocsparse_status rocsparse_coomv_strided_batched_template(                 \
+        rocsparse_handle          handle,                                               \
+        rocsparse_operation       trans,                                                \
+        ITYPE                     m,                                                    \
+        ITYPE                     n,                                                    \
+        int64_t                   nnz,                                                  \
+        const TTYPE*              alpha,                                                \
+        const rocsparse_mat_descr descr,                                                \
+        const ATYPE*              coo_val,                                              \
+        int64_t                   val_batch_stride,                                     \
+        const ITYPE*              coo_row_ind,                                          \
+        const ITYPE*              coo_col_ind,                                          \
+        const XTYPE*              x,                                                    \
+        int64_t                   x_batch_stride,                                       \
+        const TTYPE*              beta,                                                 \
+        YTYPE*                    y,                                                    \
+        int64_t                   y_batch_stride,                                       \
+        ITYPE                     batch_count);                                         \
+    template rocsparse_status rocsparse_ellmv_strided_batched_template(                 \
+        rocsparse_handle          handle,                                               \
+        rocsparse_operation       trans,                                                \
+        ITYPE                     m,                                                    \
+        ITYPE                     n,                                                    \
+        const TTYPE*              alpha,                                                \
+        const rocsparse_mat_descr descr,                                                \
+        const ATYPE*              ell_val,                                              \
+        int64_t                   val_batch_stride,                                     \
+        const ITYPE*              ell_col_ind,                                          \
+        ITYPE                     ell_width,                                            \
+        const XTYPE*              x,                                                    \
+        int64_t                   x_batch_stride,                                       \
+        const TTYPE*              beta,                                                 \
+        YTYPE*                    y,                                                    \
+        int64_t                   y_batch_stride,                                       \
+        ITYPE                     batch_count)
+
+#define INSTANTIATE(TTYPE, ATYPE, XTYPE, YTYPE)                 \
+    INSTANTIATE_IJ(TTYPE, int32_t, int32_t, ATYPE, XTYPE, YTYPE); \
+    INSTANTIATE_IJ(TTYPE, int64_t, int32_t, ATYPE, XTYPE, YTYPE); \
+    INSTANTIATE_IJ(TTYPE, int64_t, int64_t, ATYPE, XTYPE, YTYPE); \
+    INSTANTIATE_I(TTYPE, int32_t, ATYPE, XTYPE, YTYPE);           \
+    INSTANTIATE_I(TTYPE, int64_t, ATYPE, XTYPE, YTYPE)
+
+INSTANTIATE(float, float, float, float);
+INSTANTIATE(double, double, double, double);
+INSTANTIATE(rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int8_t, int8_t, int32_t);
+INSTANTIATE(float, int8_t, int8_t, float);
+INSTANTIATE(double, float, double, double);
+INSTANTIATE(rocsparse_float_complex, float, rocsparse_float_complex, rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex, double, rocsparse_double_complex, rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+#undef INSTANTIATE
+#undef INSTANTIATE_I
+#undef INSTANTIATE_IJ
@@ -0,0 +1,113 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+
+// Strided batched sparse matrix vector multiplication
+//
+//   y_b = alpha * op(A_b) * x_b + beta * y_b,  b = 0, ..., batch_count - 1
+//
+// All matrices A_b share the sparsity pattern of A_0, i.e. the row offsets and
+// column (row) indices are read from the first batch, while the values of A_b
+// start at val + b * val_batch_stride. A batch stride of zero for the values or
+// for x shares the corresponding data between all batches.
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_csrmv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          J                         m,
+                                                          J                         n,
+                                                          I                         nnz,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const A*                  csr_val,
+                                                          int64_t val_batch_stride,
+                                                          const I* csr_row_ptr,
+                                                          const J* csr_col_ind,
+                                                          const X* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          Y*       y,
+                                                          int64_t  y_batch_stride,
+                                                          J        batch_count);
+
+template <typename T, typename I, typename A, typename X, typename Y>
+rocsparse_status rocsparse_coomv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          I                         m,
+                                                          I                         n,
+                                                          int64_t                   nnz,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const A*                  coo_val,
+                                                          int64_t val_batch_stride,
+                                                          const I* coo_row_ind,
+                                                          const I* coo_col_ind,
+                                                          const X* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          Y*       y,
+                                                          int64_t  y_batch_stride,
+                                                          I        batch_count);
+
+template <typename T, typename I, typename A, typename X, typename Y>
+rocsparse_status rocsparse_ellmv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          I                         m,
+                                                          I                         n,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const A*                  ell_val,
+                                                          int64_t val_batch_stride,
+                                                          const I* ell_col_ind,
+                                                          I        ell_width,
+                                                          const X* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          Y*       y,
+                                                          int64_t  y_batch_stride,
+                                                          I        batch_count);
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse_bsrmv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_direction       dir,
+                                                          rocsparse_operation       trans,
+                                                          J                         mb,
+                                                          J                         nb,
+                                                          I                         nnzb,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const A*                  bsr_val,
+                                                          int64_t val_batch_stride,
+                                                          const I* bsr_row_ptr,
+                                                          const J* bsr_col_ind,
+                                                          J        block_dim,
+                                                          const X* x,
+                                                          int64_t  x_batch_stride,
+                                                          const T* beta,
+                                                          Y*       y,
+                                                          int64_t  y_batch_stride,
+                                                          J        batch_count);
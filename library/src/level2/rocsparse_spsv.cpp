@@ -41,6 +41,17 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
                                          size_t*                     buffer_size,
                                          void*                       temp_buffer)
 {
+    // Number of right-hand sides to solve for. All batches share the sparsity
+    // pattern (and thus the analysis data) of the matrix, while the matrix
+    // values can either be shared or strided.
+    const int64_t batch_count = y->batch_count;
+    const int64_t val_batch_stride
+        = (mat->batch_count > 1) ? ((mat->format == rocsparse_format_coo)
+                                        ? mat->batch_stride
+                                        : mat->columns_values_batch_stride)
+                                 : 0;
+    const int64_t x_batch_stride = (x->batch_count > 1) ? x->batch_stride : 0;
+
     // STAGE 1 - compute required buffer size of temp_buffer
     if(stage == rocsparse_spsv_stage_buffer_size
        || (stage == rocsparse_spsv_stage_auto && temp_buffer == nullptr))
@@ -59,6 +70,22 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
                                                      mat->info,
                                                      buffer_size));
 
+            // Batched solve requires one done array (and transposed values) per batch
+            if(batch_count > 1)
+            {
+                size_t batched_size;
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_csrsv_solve_strided_batched_buffer_size_template<I, J, T>(
+                        trans,
+                        (J)mat->rows,
+                        (I)mat->nnz,
+                        (J)batch_count,
+                        val_batch_stride,
+                        &batched_size)));
+
+                *buffer_size = std::max(*buffer_size, batched_size);
+            }
+
             *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
             return rocsparse_status_success;
         }
@@ -76,6 +103,22 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
                                                      mat->info,
                                                      buffer_size));
 
+            // Batched solve requires one done array (and transposed values) per batch
+            if(batch_count > 1)
+            {
+                size_t batched_size;
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_coosv_solve_strided_batched_buffer_size_template<I, T>(
+                        trans,
+                        (I)mat->rows,
+                        mat->nnz,
+                        (I)batch_count,
+                        val_batch_stride,
+                        &batched_size)));
+
+                *buffer_size = std::max(*buffer_size, batched_size);
+            }
+
             *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
             return rocsparse_status_success;
         }
@@ -137,6 +180,58 @@ rocsparse_status rocsparse_spsv_template(rocsparse_handle            handle,
     // STAGE 3 - perform SpSV computation
     if(stage == rocsparse_spsv_stage_compute || stage == rocsparse_spsv_stage_auto)
     {
+        if(batch_count > 1)
+        {
+            if(mat->format == rocsparse_format_csr)
+            {
+                return rocsparse_csrsv_solve_strided_batched_template(
+                    handle,
+                    trans,
+                    (J)mat->rows,
+                    (I)mat->nnz,
+                    (const T*)alpha,
+                    mat->descr,
+                    (const T*)mat->const_val_data,
+                    val_batch_stride,
+                    (const I*)mat->const_row_data,
+                    (const J*)mat->const_col_data,
+                    mat->info,
+                    (const T*)x->const_values,
+                    x_batch_stride,
+                    (T*)y->values,
+                    y->batch_stride,
+                    (J)batch_count,
+                    rocsparse_solve_policy_auto,
+                    temp_buffer);
+            }
+            else if(mat->format == rocsparse_format_coo)
+            {
+                return rocsparse_coosv_solve_strided_batched_template(
+                    handle,
+                    trans,
+                    (I)mat->rows,
+                    mat->nnz,
+                    (const T*)alpha,
+                    mat->descr,
+                    (const T*)mat->const_val_data,
+                    val_batch_stride,
+                    (const I*)mat->const_row_data,
+                    (const I*)mat->const_col_data,
+                    mat->info,
+                    (const T*)x->const_values,
+                    x_batch_stride,
+                    (T*)y->values,
+                    y->batch_stride,
+                    (I)batch_count,
+                    rocsparse_solve_policy_auto,
+                    temp_buffer);
+            }
+            else
+            {
+                return rocsparse_status_not_implemented;
+            }
+        }
+
         if(mat->format == rocsparse_format_csr)
         {
             return rocsparse_csrsv_solve_template(handle,
@@ -284,10 +379,10 @@ try
     log_trace(handle,
               "rocsparse_spsv",
               trans,
-              (const void*&)alpha,
-              (const void*&)mat,
-              (const void*&)x,
-              (const void*&)y,
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat,
+              x,
+              y,
               compute_type,
               alg,
               stage,
@@ -344,6 +439,27 @@ try
         return rocsparse_status_not_implemented;
     }
 
+    // Check batch counts, the matrix and the right-hand side can either be
+    // shared by all batches or have the same batch count as the solution
+    if((mat->batch_count != 1 && mat->batch_count != y->batch_count)
+       || (x->batch_count != 1 && x->batch_count != y->batch_count))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Batched SpSV requires all matrices to share the sparsity pattern
+    if(y->batch_count > 1)
+    {
+        if(mat->offsets_batch_stride != 0)
+        {
+            return rocsparse_status_not_implemented;
+        }
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_spsv", rocsparse_profile_models::spsv(mat, x, y, stage, temp_buffer));
+
     return rocsparse_spsv_dynamic_dispatch(mat->row_type,
                                            mat->col_type,
                                            compute_type,
@@ -0,0 +1,180 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "../level3/rocsparse_reduce.hpp"
+#include "common.h"
+
+// Fused SpMV kernels for Krylov type iterations. Next to y := alpha * A * x + beta * y,
+// the kernels optionally compute w := gamma * y + delta * w and the partial sums of the
+// dot product y^T * z, while the freshly computed entries of y are still held in
+// registers. The partial sums of each block are written to the workspace and reduced
+// by spmv_fused_dot_reduce_device. z may alias y, while w must not alias x, y or z.
+
+// CSR SpMV (stream) for general, non-transposed matrices with fused vector updates
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void csrmvn_fused_device(J                    m,
+                                              T                    alpha,
+                                              const I*             csr_row_ptr,
+                                              const J*             csr_col_ind,
+                                              const A*             csr_val,
+                                              const X*             x,
+                                              T                    beta,
+                                              Y*                   y,
+                                              const Y*             z,
+                                              T*                   workspace,
+                                              T                    gamma,
+                                              T                    delta,
+                                              Y*                   w,
+                                              rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * (BLOCKSIZE / WF_SIZE);
+
+    T dot = static_cast<T>(0);
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        I row_start = csr_row_ptr[row] - idx_base;
+        I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma<T>(
+                alpha * csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last thread of each wavefront writes y and applies the vector updates
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta != static_cast<T>(0))
+            {
+                sum = rocsparse_fma<T>(beta, y[row], sum);
+            }
+
+            y[row] = sum;
+
+            if(w != nullptr)
+            {
+                w[row] = (delta == static_cast<T>(0))
+                             ? gamma * sum
+                             : rocsparse_fma<T>(delta, w[row], gamma * sum);
+            }
+
+            // z is read after y has been written, such that z may alias y
+            if(workspace != nullptr)
+            {
+                dot = rocsparse_fma<T>(sum, z[row], dot);
+            }
+        }
+    }
+
+    if(workspace != nullptr)
+    {
+        // Sum up the partial dot products of the block
+        dot = rocsparse_reduce_block<BLOCKSIZE>(dot);
+
+        if(hipThreadIdx_x == 0)
+        {
+            workspace[hipBlockIdx_x] = dot;
+        }
+    }
+}
+
+// Vector updates of an already computed y, used after SpMV algorithms that do not
+// complete the rows of y within a single wavefront
+template <unsigned int BLOCKSIZE, typename J, typename Y, typename T>
+ROCSPARSE_DEVICE_ILF void spmv_fused_update_device(
+    J m, const Y* y, const Y* z, T* workspace, T gamma, T delta, Y* w)
+{
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J inc = hipGridDim_x * BLOCKSIZE;
+
+    T dot = static_cast<T>(0);
+
+    for(J i = gid; i < m; i += inc)
+    {
+        T yi = y[i];
+
+        if(w != nullptr)
+        {
+            w[i] = (delta == static_cast<T>(0)) ? gamma * yi
+                                                : rocsparse_fma<T>(delta, w[i], gamma * yi);
+        }
+
+        if(workspace != nullptr)
+        {
+            dot = rocsparse_fma<T>(yi, z[i], dot);
+        }
+    }
+
+    if(workspace != nullptr)
+    {
+        dot = rocsparse_reduce_block<BLOCKSIZE>(dot);
+
+        if(hipThreadIdx_x == 0)
+        {
+            workspace[hipBlockIdx_x] = dot;
+        }
+    }
+}
+
+// Reduce the partial dot products of nblocks blocks, using a single block
+template <unsigned int BLOCKSIZE, typename T>
+ROCSPARSE_DEVICE_ILF void
+    spmv_fused_dot_reduce_device(rocsparse_int nblocks, const T* workspace, T* result)
+{
+    T dot = static_cast<T>(0);
+
+    for(rocsparse_int i = hipThreadIdx_x; i < nblocks; i += BLOCKSIZE)
+    {
+        dot += workspace[i];
+    }
+
+    dot = rocsparse_reduce_block<BLOCKSIZE>(dot);
+
+    if(hipThreadIdx_x == 0)
+    {
+        *result = dot;
+    }
+}
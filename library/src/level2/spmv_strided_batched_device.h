@@ -0,0 +1,385 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+// Strided batched SpMV kernels for matrices that share one sparsity pattern.
+// Each block processes BATCH_TILE consecutive batches (hipBlockIdx_y), such that
+// the row offsets and column indices are loaded once per tile, while the values
+// and the dense vectors are streamed for each batch of the tile.
+
+// CSR SpMV for general, non-transposed matrices
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          unsigned int BATCH_TILE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void csrmvn_strided_batched_device(J        m,
+                                                        J        batch_count,
+                                                        T        alpha,
+                                                        const I* csr_row_ptr,
+                                                        const J* csr_col_ind,
+                                                        const A* csr_val,
+                                                        int64_t  val_batch_stride,
+                                                        const X* x,
+                                                        int64_t  x_batch_stride,
+                                                        T        beta,
+                                                        Y*       y,
+                                                        int64_t  y_batch_stride,
+                                                        rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    J batch_begin = hipBlockIdx_y * BATCH_TILE;
+
+    // Each wavefront processes one row for all batches of the tile
+    I row_start = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    T sum[BATCH_TILE];
+
+#pragma unroll
+    for(unsigned int b = 0; b < BATCH_TILE; ++b)
+    {
+        sum[b] = static_cast<T>(0);
+    }
+
+    // Loop over non-zero elements
+    for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+    {
+        J col = csr_col_ind[j] - idx_base;
+
+#pragma unroll
+        for(unsigned int b = 0; b < BATCH_TILE; ++b)
+        {
+            int64_t batch = batch_begin + b;
+
+            if(batch < batch_count)
+            {
+                sum[b] = rocsparse_fma<T>(
+                    rocsparse_nontemporal_load(csr_val + j + val_batch_stride * batch),
+                    rocsparse_ldg(x + col + x_batch_stride * batch),
+                    sum[b]);
+            }
+        }
+    }
+
+#pragma unroll
+    for(unsigned int b = 0; b < BATCH_TILE; ++b)
+    {
+        int64_t batch = batch_begin + b;
+
+        // Obtain row sum using parallel reduction
+        T val = rocsparse_wfreduce_sum<WF_SIZE>(sum[b]);
+
+        // Last thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1 && batch < batch_count)
+        {
+            Y* yb = y + y_batch_stride * batch;
+
+            if(beta == static_cast<T>(0))
+            {
+                yb[row] = alpha * val;
+            }
+            else
+            {
+                yb[row] = rocsparse_fma<T>(beta, yb[row], alpha * val);
+            }
+        }
+    }
+}
+
+// ELL SpMV for general, non-transposed matrices
+template <unsigned int BLOCKSIZE,
+          unsigned int BATCH_TILE,
+          typename I,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void ellmvn_strided_batched_device(I        m,
+                                                        I        n,
+                                                        I        ell_width,
+                                                        I        batch_count,
+                                                        T        alpha,
+                                                        const I* ell_col_ind,
+                                                        const A* ell_val,
+                                                        int64_t  val_batch_stride,
+                                                        const X* x,
+                                                        int64_t  x_batch_stride,
+                                                        T        beta,
+                                                        Y*       y,
+                                                        int64_t  y_batch_stride,
+                                                        rocsparse_index_base idx_base)
+{
+    I ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    I batch_begin = hipBlockIdx_y * BATCH_TILE;
+
+    T sum[BATCH_TILE];
+
+#pragma unroll
+    for(unsigned int b = 0; b < BATCH_TILE; ++b)
+    {
+        sum[b] = static_cast<T>(0);
+    }
+
+    for(I p = 0; p < ell_width; ++p)
+    {
+        int64_t idx = ELL_IND(ai, (int64_t)p, m, ell_width);
+        I       col = rocsparse_nontemporal_load(ell_col_ind + idx) - idx_base;
+
+        if(col >= 0 && col < n)
+        {
+#pragma unroll
+            for(unsigned int b = 0; b < BATCH_TILE; ++b)
+            {
+                int64_t batch = batch_begin + b;
+
+                if(batch < batch_count)
+                {
+                    sum[b] = rocsparse_fma<T>(
+                        rocsparse_nontemporal_load(ell_val + idx + val_batch_stride * batch),
+                        rocsparse_ldg(x + col + x_batch_stride * batch),
+                        sum[b]);
+                }
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+#pragma unroll
+    for(unsigned int b = 0; b < BATCH_TILE; ++b)
+    {
+        int64_t batch = batch_begin + b;
+
+        if(batch < batch_count)
+        {
+            Y* yb = y + y_batch_stride * batch;
+
+            if(beta != static_cast<T>(0))
+            {
+                Y yv = rocsparse_nontemporal_load(yb + ai);
+                rocsparse_nontemporal_store(rocsparse_fma<T>(beta, yv, alpha * sum[b]), yb + ai);
+            }
+            else
+            {
+                rocsparse_nontemporal_store(alpha * sum[b], yb + ai);
+            }
+        }
+    }
+}
+
+// BSR SpMV for general, non-transposed matrices. Each thread processes a single
+// row of a block row.
+template <unsigned int BLOCKSIZE,
+          unsigned int BATCH_TILE,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void bsrmvn_strided_batched_device(rocsparse_direction dir,
+                                                        J                   mb,
+                                                        J                   block_dim,
+                                                        J                   batch_count,
+                                                        T                   alpha,
+                                                        const I*            bsr_row_ptr,
+                                                        const J*            bsr_col_ind,
+                                                        const A*            bsr_val,
+                                                        int64_t             val_batch_stride,
+                                                        const X*            x,
+                                                        int64_t             x_batch_stride,
+                                                        T                   beta,
+                                                        Y*                  y,
+                                                        int64_t             y_batch_stride,
+                                                        rocsparse_index_base idx_base)
+{
+    int64_t gid = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(gid >= (int64_t)mb * block_dim)
+    {
+        return;
+    }
+
+    J row = gid / block_dim;
+    J bi  = gid % block_dim;
+
+    J batch_begin = hipBlockIdx_y * BATCH_TILE;
+
+    I row_start = bsr_row_ptr[row] - idx_base;
+    I row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    T sum[BATCH_TILE];
+
+#pragma unroll
+    for(unsigned int b = 0; b < BATCH_TILE; ++b)
+    {
+        sum[b] = static_cast<T>(0);
+    }
+
+    // Loop over the blocks of the block row
+    for(I j = row_start; j < row_end; ++j)
+    {
+        J col = bsr_col_ind[j] - idx_base;
+
+        for(J bj = 0; bj < block_dim; ++bj)
+        {
+            int64_t idx = BSR_IND(j, bi, bj, dir);
+
+#pragma unroll
+            for(unsigned int b = 0; b < BATCH_TILE; ++b)
+            {
+                int64_t batch = batch_begin + b;
+
+                if(batch < batch_count)
+                {
+                    sum[b] = rocsparse_fma<T>(
+                        bsr_val[idx + val_batch_stride * batch],
+                        rocsparse_ldg(x + (int64_t)col * block_dim + bj + x_batch_stride * batch),
+                        sum[b]);
+                }
+            }
+        }
+    }
+
+#pragma unroll
+    for(unsigned int b = 0; b < BATCH_TILE; ++b)
+    {
+        int64_t batch = batch_begin + b;
+
+        if(batch < batch_count)
+        {
+            Y* yb = y + y_batch_stride * batch;
+
+            if(beta == static_cast<T>(0))
+            {
+                yb[gid] = alpha * sum[b];
+            }
+            else
+            {
+                yb[gid] = rocsparse_fma<T>(beta, yb[gid], alpha * sum[b]);
+            }
+        }
+    }
+}
+
+// Scale all batches of y with beta
+template <unsigned int BLOCKSIZE, typename I, typename Y, typename T>
+ROCSPARSE_DEVICE_ILF void spmv_strided_batched_scale_device(I       size,
+                                                            T       scalar,
+                                                            Y*      data,
+                                                            int64_t batch_stride)
+{
+    I idx = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(idx >= size)
+    {
+        return;
+    }
+
+    Y* datab = data + batch_stride * hipBlockIdx_y;
+
+    if(scalar == static_cast<T>(0))
+    {
+        datab[idx] = static_cast<Y>(0);
+    }
+    else
+    {
+        datab[idx] *= scalar;
+    }
+}
+
+// COO SpMV for general, non-transposed matrices. Each thread processes a single
+// non-zero entry and accumulates its contribution atomically.
+template <unsigned int BLOCKSIZE,
+          unsigned int BATCH_TILE,
+          typename I,
+          typename A,
+          typename X,
+          typename Y,
+          typename T>
+ROCSPARSE_DEVICE_ILF void coomvn_strided_batched_device(int64_t  nnz,
+                                                        I        batch_count,
+                                                        T        alpha,
+                                                        const I* coo_row_ind,
+                                                        const I* coo_col_ind,
+                                                        const A* coo_val,
+                                                        int64_t  val_batch_stride,
+                                                        const X* x,
+                                                        int64_t  x_batch_stride,
+                                                        Y*       y,
+                                                        int64_t  y_batch_stride,
+                                                        rocsparse_index_base idx_base)
+{
+    int64_t gid = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    I batch_begin = hipBlockIdx_y * BATCH_TILE;
+
+    I row = rocsparse_nontemporal_load(coo_row_ind + gid) - idx_base;
+    I col = rocsparse_nontemporal_load(coo_col_ind + gid) - idx_base;
+
+#pragma unroll
+    for(unsigned int b = 0; b < BATCH_TILE; ++b)
+    {
+        int64_t batch = batch_begin + b;
+
+        if(batch < batch_count)
+        {
+            T val = alpha
+                    * static_cast<T>(
+                        rocsparse_nontemporal_load(coo_val + gid + val_batch_stride * batch))
+                    * static_cast<T>(rocsparse_ldg(x + col + x_batch_stride * batch));
+
+            atomicAdd(&y[row + y_batch_stride * batch], val);
+        }
+    }
+}
@@ -80,3 +80,39 @@ rocsparse_status rocsparse_coosm_solve_template(rocsparse_handle          handle
                                                 rocsparse_mat_info        info,
                                                 rocsparse_solve_policy    policy,
                                                 void*                     temp_buffer);
+
+template <typename I, typename T>
+rocsparse_status rocsparse_coosm_solve_strided_batched_buffer_size_template(
+    rocsparse_operation trans_A,
+    rocsparse_operation trans_B,
+    I                   m,
+    I                   nrhs,
+    int64_t             nnz,
+    I                   batch_count,
+    int64_t             val_batch_stride,
+    size_t*             buffer_size);
+
+template <typename I, typename T>
+rocsparse_status
+    rocsparse_coosm_solve_strided_batched_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   I                         m,
+                                                   I                         nrhs,
+                                                   int64_t                   nnz,
+                                                   const T*                  alpha_device_host,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  coo_val,
+                                                   int64_t                   val_batch_stride,
+                                                   const I*                  coo_row_ind,
+                                                   const I*                  coo_col_ind,
+                                                   const T*                  B,
+                                                   I                         ldb,
+                                                   int64_t                   B_batch_stride,
+                                                   T*                        C,
+                                                   I                         ldc,
+                                                   int64_t                   C_batch_stride,
+                                                   I                         batch_count,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer);
@@ -27,7 +27,6 @@
 #include "definitions.h"
 #include "utility.h"
 
-#include "../level1/rocsparse_gthr.hpp"
 #include "../level2/rocsparse_csrsv.hpp"
 #include "csrsm_device.h"
 #include <rocprim/rocprim.hpp>
@@ -558,8 +557,10 @@ void csrsm(rocsparse_operation transB,
            const I* __restrict__ csr_row_ptr,
            const J* __restrict__ csr_col_ind,
            const T* __restrict__ csr_val,
+           int64_t val_batch_stride,
            T* __restrict__ B,
-           J ldb,
+           J       ldb,
+           int64_t B_batch_stride,
            int* __restrict__ done_array,
            J* __restrict__ map,
            J* __restrict__ zero_pivot,
@@ -567,6 +568,10 @@ void csrsm(rocsparse_operation transB,
            rocsparse_fill_mode  fill_mode,
            rocsparse_diag_type  diag_type)
 {
+    // Each batch is solved by its own slice of blocks, all batches share the
+    // row map and the sparsity pattern of the matrix
+    int64_t batch = hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     csrsm_device<BLOCKSIZE, WFSIZE, SLEEP>(transB,
                                            m,
@@ -574,10 +579,10 @@ void csrsm(rocsparse_operation transB,
                                            alpha,
                                            csr_row_ptr,
                                            csr_col_ind,
-                                           csr_val,
-                                           B,
+                                           csr_val + val_batch_stride * batch,
+                                           B + B_batch_stride * batch,
                                            ldb,
-                                           done_array,
+                                           done_array + int64_t(hipGridDim_x) * batch,
                                            map,
                                            zero_pivot,
                                            idx_base,
@@ -587,11 +592,110 @@ void csrsm(rocsparse_operation transB,
 
 template <unsigned int DIM_X, unsigned int DIM_Y, typename I, typename T>
 ROCSPARSE_KERNEL(DIM_X* DIM_Y)
-void csrsm_transpose(I m, I n, const T* __restrict__ A, I lda, T* __restrict__ B, I ldb)
+void csrsm_transpose(I m,
+                     I n,
+                     const T* __restrict__ A,
+                     I       lda,
+                     int64_t A_batch_stride,
+                     T* __restrict__ B,
+                     I       ldb,
+                     int64_t B_batch_stride)
+{
+    int64_t batch = hipBlockIdx_z;
+
+    dense_transpose_device<DIM_X, DIM_Y>(
+        m, n, (T)1, A + A_batch_stride * batch, lda, B + B_batch_stride * batch, ldb);
+}
+
+template <unsigned int DIM_X, unsigned int DIM_Y, typename I, typename T>
+ROCSPARSE_KERNEL(DIM_X* DIM_Y)
+void csrsm_transpose_back(I m,
+                          I n,
+                          const T* __restrict__ A,
+                          I       lda,
+                          int64_t A_batch_stride,
+                          T* __restrict__ B,
+                          I       ldb,
+                          int64_t B_batch_stride)
 {
-    dense_transpose_device<DIM_X, DIM_Y>(m, n, (T)1, A, lda, B, ldb);
+    int64_t batch = hipBlockIdx_z;
+
+    dense_transpose_back_device<DIM_X, DIM_Y>(
+        m, n, A + A_batch_stride * batch, lda, B + B_batch_stride * batch, ldb);
 }
 
+template <unsigned int BLOCKSIZE, typename I, typename T>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrsm_copy(I m,
+                I n,
+                const T* __restrict__ A,
+                I       lda,
+                int64_t A_batch_stride,
+                T* __restrict__ B,
+                I       ldb,
+                int64_t B_batch_stride)
+{
+    int64_t idx   = int64_t(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+    int64_t batch = hipBlockIdx_z;
+
+    if(idx >= int64_t(m) * n)
+    {
+        return;
+    }
+
+    I row = idx / n;
+    I col = idx % n;
+
+    B[B_batch_stride * batch + int64_t(ldb) * row + col]
+        = A[A_batch_stride * batch + int64_t(lda) * row + col];
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename T>
+ROCSPARSE_KERNEL(BLOCKSIZE)
+void csrsm_transpose_values(I nnz,
+                            const T* __restrict__ csr_val,
+                            int64_t val_batch_stride,
+                            const I* __restrict__ perm,
+                            T* __restrict__ csrt_val,
+                            bool conj)
+{
+    I       idx   = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    int64_t batch = hipBlockIdx_z;
+
+    if(idx >= nnz)
+    {
+        return;
+    }
+
+    T val = csr_val[val_batch_stride * batch + perm[idx]];
+
+    csrt_val[nnz * batch + idx] = conj ? rocsparse_conj(val) : val;
+}
+
+#define LAUNCH_CSRSM_KERNEL(CSRSM_DIM, SLEEP)         \
+    hipLaunchKernelGGL((csrsm<CSRSM_DIM, 64, SLEEP>), \
+                       csrsm_blocks,                  \
+                       csrsm_threads,                 \
+                       0,                             \
+                       stream,                        \
+                       trans_B,                       \
+                       m,                             \
+                       nrhs,                          \
+                       alpha_device_host,             \
+                       local_csr_row_ptr,             \
+                       local_csr_col_ind,             \
+                       local_csr_val,                 \
+                       val_batch_stride,              \
+                       Bt,                            \
+                       ldimB,                         \
+                       Bt_batch_stride,               \
+                       done_array,                    \
+                       (J*)csrsm_info->row_map,       \
+                       (J*)info->zero_pivot,          \
+                       descr->base,                   \
+                       fill_mode,                     \
+                       descr->diag_type)
+
 template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle,
                                                 rocsparse_operation       trans_A,
@@ -602,10 +706,16 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
                                                 U                         alpha_device_host,
                                                 const rocsparse_mat_descr descr,
                                                 const T*                  csr_val,
+                                                int64_t                   val_batch_stride,
                                                 const I*                  csr_row_ptr,
                                                 const J*                  csr_col_ind,
-                                                T*                        B,
+                                                const T*                  B,
                                                 J                         ldb,
+                                                int64_t                   B_batch_stride,
+                                                T*                        C,
+                                                J                         ldc,
+                                                int64_t                   C_batch_stride,
+                                                J                         batch_count,
                                                 rocsparse_mat_info        info,
                                                 rocsparse_solve_policy    policy,
                                                 void*                     temp_buffer)
@@ -633,16 +743,18 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
 
     int narrays = (nrhs - 1) / blockdim + 1;
 
-    // done array
+    // done array, one per batch
     int* done_array = reinterpret_cast<int*>(ptr);
-    ptr += ((sizeof(int) * m * narrays - 1) / 256 + 1) * 256;
+    ptr += ((sizeof(int) * m * narrays * batch_count - 1) / 256 + 1) * 256;
 
-    // Temporary array to store transpose of B
-    T* Bt = B;
+    // Temporary array to store transpose of B of each batch
+    T*      Bt              = C;
+    int64_t Bt_batch_stride = C_batch_stride;
     if(trans_B == rocsparse_operation_none)
     {
-        Bt = reinterpret_cast<T*>(ptr);
-        ptr += ((sizeof(T) * m * nrhs - 1) / 256 + 1) * 256;
+        Bt              = reinterpret_cast<T*>(ptr);
+        Bt_batch_stride = int64_t(m) * nrhs;
+        ptr += ((sizeof(T) * m * nrhs * batch_count - 1) / 256 + 1) * 256;
     }
 
     // Temporary array to store transpose of A
@@ -654,7 +766,8 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
     }
 
     // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m * narrays, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(done_array, 0, sizeof(int) * m * narrays * batch_count, stream));
 
     rocsparse_trm_info csrsm_info
         = (descr->fill_mode == rocsparse_fill_mode_upper)
@@ -671,7 +784,7 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
     }
 
     // Leading dimension
-    J ldimB = ldb;
+    J ldimB = ldc;
 
     // Transpose B if B is not transposed yet to improve performance
     if(trans_B == rocsparse_operation_none)
@@ -681,7 +794,7 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
 
 #define CSRSM_DIM_X 32
 #define CSRSM_DIM_Y 8
-        dim3 csrsm_blocks((m - 1) / CSRSM_DIM_X + 1);
+        dim3 csrsm_blocks((m - 1) / CSRSM_DIM_X + 1, 1, batch_count);
         dim3 csrsm_threads(CSRSM_DIM_X * CSRSM_DIM_Y);
 
         hipLaunchKernelGGL((csrsm_transpose<CSRSM_DIM_X, CSRSM_DIM_Y>),
@@ -693,11 +806,33 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
                            nrhs,
                            B,
                            ldb,
+                           B_batch_stride,
                            Bt,
-                           ldimB);
+                           ldimB,
+                           Bt_batch_stride);
 #undef CSRSM_DIM_X
 #undef CSRSM_DIM_Y
     }
+    else if(B != C || ldb != ldc || B_batch_stride != C_batch_stride)
+    {
+        // B is already transposed, the solve runs in-place on C
+        dim3 csrsm_blocks((int64_t(m) * nrhs - 1) / 256 + 1, 1, batch_count);
+        dim3 csrsm_threads(256);
+
+        hipLaunchKernelGGL((csrsm_copy<256>),
+                           csrsm_blocks,
+                           csrsm_threads,
+                           0,
+                           stream,
+                           m,
+                           nrhs,
+                           B,
+                           ldb,
+                           B_batch_stride,
+                           C,
+                           ldc,
+                           C_batch_stride);
+    }
 
     // Pointers to differentiate between transpose mode
     const I* local_csr_row_ptr = csr_row_ptr;
@@ -707,41 +842,39 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
     rocsparse_fill_mode fill_mode = descr->fill_mode;
 
     // When computing transposed triangular solve, we first need to update the
-    // transposed matrix values
+    // transposed matrix values of each batch
     if(trans_A == rocsparse_operation_transpose
        || trans_A == rocsparse_operation_conjugate_transpose)
     {
         T* csrt_val = At;
 
-        // Gather values
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(handle,
-                                                          nnz,
-                                                          csr_val,
-                                                          csrt_val,
-                                                          (const I*)csrsm_info->trmt_perm,
-                                                          rocsparse_index_base_zero));
+        // Matrix values are either shared by all batches or strided
+        J val_batch_count = (val_batch_stride == 0) ? 1 : batch_count;
 
-        if(trans_A == rocsparse_operation_conjugate_transpose)
-        {
-            // conjugate csrt_val
-            hipLaunchKernelGGL((conjugate<256, I, T>),
-                               dim3((nnz - 1) / 256 + 1),
-                               dim3(256),
-                               0,
-                               stream,
-                               nnz,
-                               csrt_val);
-        }
+        // Gather (and conjugate) values
+        hipLaunchKernelGGL((csrsm_transpose_values<256, I, T>),
+                           dim3((nnz - 1) / 256 + 1, 1, val_batch_count),
+                           dim3(256),
+                           0,
+                           stream,
+                           nnz,
+                           csr_val,
+                           val_batch_stride,
+                           (const I*)csrsm_info->trmt_perm,
+                           csrt_val,
+                           trans_A == rocsparse_operation_conjugate_transpose);
 
         local_csr_row_ptr = (const I*)csrsm_info->trmt_row_ptr;
         local_csr_col_ind = (const J*)csrsm_info->trmt_col_ind;
         local_csr_val     = (const T*)csrt_val;
 
+        val_batch_stride = (val_batch_stride == 0) ? 0 : nnz;
+
         fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
                                                              : rocsparse_fill_mode_lower;
     }
     {
-        dim3 csrsm_blocks(((nrhs - 1) / blockdim + 1) * m);
+        dim3 csrsm_blocks(((nrhs - 1) / blockdim + 1) * m, 1, batch_count);
         dim3 csrsm_threads(blockdim);
 
         // Determine gcnArch and ASIC revision
@@ -754,245 +887,55 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm<64, 64, true>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(64, true);
             }
             else
             {
-                hipLaunchKernelGGL((csrsm<64, 64, false>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(64, false);
             }
         }
         else if(blockdim == 128)
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm<128, 64, true>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(128, true);
             }
             else
             {
-                hipLaunchKernelGGL((csrsm<128, 64, false>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(128, false);
             }
         }
         else if(blockdim == 256)
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm<256, 64, true>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(256, true);
             }
             else
             {
-                hipLaunchKernelGGL((csrsm<256, 64, false>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(256, false);
             }
         }
         else if(blockdim == 512)
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm<512, 64, true>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(512, true);
             }
             else
             {
-                hipLaunchKernelGGL((csrsm<512, 64, false>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(512, false);
             }
         }
         else if(blockdim == 1024)
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm<1024, 64, true>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(1024, true);
             }
             else
             {
-                hipLaunchKernelGGL((csrsm<1024, 64, false>),
-                                   csrsm_blocks,
-                                   csrsm_threads,
-                                   0,
-                                   stream,
-                                   trans_B,
-                                   m,
-                                   nrhs,
-                                   alpha_device_host,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   Bt,
-                                   ldimB,
-                                   done_array,
-                                   (J*)csrsm_info->row_map,
-                                   (J*)info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
+                LAUNCH_CSRSM_KERNEL(1024, false);
             }
         }
         else
@@ -1005,10 +948,10 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
     {
 #define CSRSM_DIM_X 32
 #define CSRSM_DIM_Y 8
-        dim3 csrsm_blocks((m - 1) / CSRSM_DIM_X + 1);
+        dim3 csrsm_blocks((m - 1) / CSRSM_DIM_X + 1, 1, batch_count);
         dim3 csrsm_threads(CSRSM_DIM_X * CSRSM_DIM_Y);
 
-        hipLaunchKernelGGL((dense_transpose_back<CSRSM_DIM_X, CSRSM_DIM_Y>),
+        hipLaunchKernelGGL((csrsm_transpose_back<CSRSM_DIM_X, CSRSM_DIM_Y>),
                            csrsm_blocks,
                            csrsm_threads,
                            0,
@@ -1017,8 +960,10 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
                            nrhs,
                            Bt,
                            ldimB,
-                           B,
-                           ldb);
+                           Bt_batch_stride,
+                           C,
+                           ldc,
+                           C_batch_stride);
 #undef CSRSM_DIM_X
 #undef CSRSM_DIM_Y
     }
@@ -1026,6 +971,8 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
     return rocsparse_status_success;
 }
 
+#undef LAUNCH_CSRSM_KERNEL
+
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle,
                                                 rocsparse_operation       trans_A,
@@ -1162,10 +1109,16 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
                                               alpha_device_host,
                                               descr,
                                               csr_val,
+                                              0,
                                               csr_row_ptr,
                                               csr_col_ind,
                                               B,
                                               ldb,
+                                              0,
+                                              B,
+                                              ldb,
+                                              0,
+                                              static_cast<J>(1),
                                               info,
                                               policy,
                                               temp_buffer);
@@ -1181,16 +1134,304 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
                                               *alpha_device_host,
                                               descr,
                                               csr_val,
+                                              0,
                                               csr_row_ptr,
                                               csr_col_ind,
                                               B,
                                               ldb,
+                                              0,
+                                              B,
+                                              ldb,
+                                              0,
+                                              static_cast<J>(1),
                                               info,
                                               policy,
                                               temp_buffer);
     }
 }
 
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrsm_solve_strided_batched_buffer_size_template(
+    rocsparse_operation trans_A,
+    rocsparse_operation trans_B,
+    J                   m,
+    J                   nrhs,
+    I                   nnz,
+    J                   batch_count,
+    int64_t             val_batch_stride,
+    size_t*             buffer_size)
+{
+    // Check sizes
+    if(m < 0 || nrhs < 0 || nnz < 0 || batch_count < 0 || val_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    *buffer_size = 256;
+
+    // Same number of done arrays per batch as the non-batched solve
+    int blockdim = 512;
+    while(nrhs <= blockdim && blockdim > 32)
+    {
+        blockdim >>= 1;
+    }
+
+    blockdim <<= 1;
+    int narrays = (nrhs - 1) / blockdim + 1;
+
+    // int done_array[m * narrays * batch_count]
+    *buffer_size += ((sizeof(int) * m * narrays * batch_count - 1) / 256 + 1) * 256;
+
+    // Transpose of B of each batch
+    if(trans_B == rocsparse_operation_none)
+    {
+        *buffer_size += ((sizeof(T) * m * nrhs * batch_count - 1) / 256 + 1) * 256;
+    }
+
+    // Transposed values of each batch
+    if(trans_A == rocsparse_operation_transpose
+       || trans_A == rocsparse_operation_conjugate_transpose)
+    {
+        J val_batch_count = (val_batch_stride == 0) ? 1 : batch_count;
+
+        *buffer_size += ((sizeof(T) * nnz * val_batch_count - 1) / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status
+    rocsparse_csrsm_solve_strided_batched_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   J                         m,
+                                                   J                         nrhs,
+                                                   I                         nnz,
+                                                   const T*                  alpha_device_host,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   int64_t                   val_batch_stride,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   const T*                  B,
+                                                   J                         ldb,
+                                                   int64_t                   B_batch_stride,
+                                                   T*                        C,
+                                                   J                         ldc,
+                                                   int64_t                   C_batch_stride,
+                                                   J                         batch_count,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr || info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check operation type
+    if(rocsparse_enum_utils::is_invalid(trans_A))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix sorting mode
+    if(descr->storage_mode != rocsparse_storage_mode_sorted)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(rocsparse_enum_utils::is_invalid(policy))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || nrhs < 0 || nnz < 0 || batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // B and C share the layout selected by trans_B
+    J ld_min = (trans_B == rocsparse_operation_none) ? m : nrhs;
+    J ld_num = (trans_B == rocsparse_operation_none) ? nrhs : m;
+
+    if(ldb < ld_min || ldc < ld_min)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check batch strides, batches of C and of A must not overlap
+    if(val_batch_stride < 0 || B_batch_stride < 0 || C_batch_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(batch_count > 1
+       && (C_batch_stride < int64_t(ldc) * ld_num
+           || (val_batch_stride != 0 && val_batch_stride < nnz)))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nrhs == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || alpha_device_host == nullptr || B == nullptr || C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_col_ind == nullptr && csr_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrsm_solve_dispatch(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              nrhs,
+                                              nnz,
+                                              alpha_device_host,
+                                              descr,
+                                              csr_val,
+                                              val_batch_stride,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              B,
+                                              ldb,
+                                              B_batch_stride,
+                                              C,
+                                              ldc,
+                                              C_batch_stride,
+                                              batch_count,
+                                              info,
+                                              policy,
+                                              temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csrsm_solve_dispatch(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              nrhs,
+                                              nnz,
+                                              *alpha_device_host,
+                                              descr,
+                                              csr_val,
+                                              val_batch_stride,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              B,
+                                              ldb,
+                                              B_batch_stride,
+                                              C,
+                                              ldc,
+                                              C_batch_stride,
+                                              batch_count,
+                                              info,
+                                              policy,
+                                              temp_buffer);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                 \
+    template rocsparse_status                                                            \
+        rocsparse_csrsm_solve_strided_batched_buffer_size_template<ITYPE, JTYPE, TTYPE>( \
+            rocsparse_operation trans_A,                                                 \
+            rocsparse_operation trans_B,                                                 \
+            JTYPE               m,                                                       \
+            JTYPE               nrhs,                                                    \
+            ITYPE               nnz,                                                     \
+            JTYPE               batch_count,                                             \
+            int64_t             val_batch_stride,                                        \
+            size_t*             buffer_size);                                            \
+    template rocsparse_status                                                            \
+        rocsparse_csrsm_solve_strided_batched_template<ITYPE, JTYPE, TTYPE>(             \
+            rocsparse_handle          handle,                                            \
+            rocsparse_operation       trans_A,                                           \
+            rocsparse_operation       trans_B,                                           \
+            JTYPE                     m,                                                 \
+            JTYPE                     nrhs,                                              \
+            ITYPE                     nnz,                                               \
+            const TTYPE*              alpha_device_host,                                 \
+            const rocsparse_mat_descr descr,                                             \
+            const TTYPE*              csr_val,                                           \
+            int64_t                   val_batch_stride,                                  \
+            const ITYPE*              csr_row_ptr,                                       \
+            const JTYPE*              csr_col_ind,                                       \
+            const TTYPE*              B,                                                 \
+            JTYPE                     ldb,                                               \
+            int64_t                   B_batch_stride,                                    \
+            TTYPE*                    C,                                                 \
+            JTYPE                     ldc,                                               \
+            int64_t                   C_batch_stride,                                    \
+            JTYPE                     batch_count,                                       \
+            rocsparse_mat_info        info,                                              \
+            rocsparse_solve_policy    policy,                                            \
+            void*                     temp_buffer);
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
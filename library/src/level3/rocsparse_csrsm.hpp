@@ -80,3 +80,39 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
                                                 rocsparse_mat_info        info,
                                                 rocsparse_solve_policy    policy,
                                                 void*                     temp_buffer);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrsm_solve_strided_batched_buffer_size_template(
+    rocsparse_operation trans_A,
+    rocsparse_operation trans_B,
+    J                   m,
+    J                   nrhs,
+    I                   nnz,
+    J                   batch_count,
+    int64_t             val_batch_stride,
+    size_t*             buffer_size);
+
+template <typename I, typename J, typename T>
+rocsparse_status
+    rocsparse_csrsm_solve_strided_batched_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   J                         m,
+                                                   J                         nrhs,
+                                                   I                         nnz,
+                                                   const T*                  alpha_device_host,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   int64_t                   val_batch_stride,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
+                                                   const T*                  B,
+                                                   J                         ldb,
+                                                   int64_t                   B_batch_stride,
+                                                   T*                        C,
+                                                   J                         ldc,
+                                                   int64_t                   C_batch_stride,
+                                                   J                         batch_count,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer);
@@ -191,11 +191,11 @@ try
               "rocsparse_sddmm_buffer_size",
               trans_A,
               trans_B,
-              (const void*&)alpha,
-              (const void*&)mat_A,
-              (const void*&)mat_B,
-              (const void*&)beta,
-              (const void*&)mat_C,
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat_A,
+              mat_B,
+              rocsparse_scalar_arg{beta, compute_type},
+              mat_C,
               compute_type,
               alg,
               (const void*&)buffer_size);
@@ -240,6 +240,10 @@ try
     {
         return rocsparse_status_not_implemented;
     }
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_sddmm_buffer_size", rocsparse_profile_model());
+
     return rocsparse_sddmm_buffer_size_dispatch(
         mat_C->format,
         (mat_C->format == rocsparse_format_csc) ? mat_C->col_type : mat_C->row_type,
@@ -426,11 +430,11 @@ try
               "rocsparse_sddmm_preprocess",
               trans_A,
               trans_B,
-              (const void*&)alpha,
-              (const void*&)mat_A,
-              (const void*&)mat_B,
-              (const void*&)beta,
-              (const void*&)mat_C,
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat_A,
+              mat_B,
+              rocsparse_scalar_arg{beta, compute_type},
+              mat_C,
               compute_type,
               alg,
               (const void*&)temp_buffer);
@@ -479,6 +483,10 @@ try
         return rocsparse_status_success;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_sddmm_preprocess", rocsparse_profile_model());
+
     return rocsparse_sddmm_preprocess_dispatch(
         mat_C->format,
         (mat_C->format == rocsparse_format_csc) ? mat_C->col_type : mat_C->row_type,
@@ -663,11 +671,11 @@ try
               "rocsparse_sddmm",
               trans_A,
               trans_B,
-              (const void*&)alpha,
-              (const void*&)mat_A,
-              (const void*&)mat_B,
-              (const void*&)beta,
-              (const void*&)mat_C,
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat_A,
+              mat_B,
+              rocsparse_scalar_arg{beta, compute_type},
+              mat_C,
               compute_type,
               alg,
               (const void*&)temp_buffer);
@@ -715,6 +723,10 @@ try
         return rocsparse_status_success;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle, "rocsparse_sddmm", rocsparse_profile_models::sddmm(trans_A, mat_A, mat_B, mat_C));
+
     return rocsparse_sddmm_dispatch(
         mat_C->format,
         (mat_C->format == rocsparse_format_csc) ? mat_C->col_type : mat_C->row_type,
@@ -941,11 +941,11 @@ try
               "rocsparse_spmm",
               trans_A,
               trans_B,
-              (const void*&)alpha,
-              (const void*&)mat_A,
-              (const void*&)mat_B,
-              (const void*&)beta,
-              (const void*&)mat_C,
+              rocsparse_scalar_arg{alpha, compute_type},
+              mat_A,
+              mat_B,
+              rocsparse_scalar_arg{beta, compute_type},
+              mat_C,
               compute_type,
               alg,
               stage,
@@ -999,6 +999,12 @@ try
         return rocsparse_status_not_implemented;
     }
 
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle,
+        "rocsparse_spmm",
+        rocsparse_profile_models::spmm(mat_A, mat_B, mat_C, stage, temp_buffer));
+
     return rocsparse_spmm_dynamic_dispatch(determine_I_index_type(mat_A),
                                            determine_J_index_type(mat_A),
                                            mat_A->data_type,
@@ -42,6 +42,17 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
                                          size_t*                     buffer_size,
                                          void*                       temp_buffer)
 {
+    // All batches share the sparsity pattern and the analysis data of A,
+    // while the values of A and the right-hand side B can either be shared
+    // or strided.
+    const int64_t batch_count = matC->batch_count;
+    const int64_t val_batch_stride
+        = (matA->batch_count > 1) ? ((matA->format == rocsparse_format_coo)
+                                         ? matA->batch_stride
+                                         : matA->columns_values_batch_stride)
+                                  : 0;
+    const int64_t B_batch_stride = (matB->batch_count > 1) ? matB->batch_stride : 0;
+
     // STAGE 1 - compute required buffer size of temp_buffer
     if(stage == rocsparse_spsm_stage_buffer_size
        || (stage == rocsparse_spsm_stage_auto && temp_buffer == nullptr))
@@ -66,6 +77,24 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
                 rocsparse_solve_policy_auto,
                 buffer_size));
 
+            // Batched solve requires one done array (and transposed operands) per batch
+            if(batch_count > 1)
+            {
+                size_t batched_size;
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_csrsm_solve_strided_batched_buffer_size_template<I, J, T>(
+                        trans_A,
+                        trans_B,
+                        (J)matA->rows,
+                        (trans_B == rocsparse_operation_none ? (J)matB->cols : (J)matB->rows),
+                        (I)matA->nnz,
+                        (J)batch_count,
+                        val_batch_stride,
+                        &batched_size)));
+
+                *buffer_size = std::max(*buffer_size, batched_size);
+            }
+
             *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
             return rocsparse_status_success;
         }
@@ -89,6 +118,24 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
                 rocsparse_solve_policy_auto,
                 buffer_size));
 
+            // Batched solve requires one done array (and transposed operands) per batch
+            if(batch_count > 1)
+            {
+                size_t batched_size;
+                RETURN_IF_ROCSPARSE_ERROR(
+                    (rocsparse_coosm_solve_strided_batched_buffer_size_template<I, T>(
+                        trans_A,
+                        trans_B,
+                        (I)matA->rows,
+                        (trans_B == rocsparse_operation_none ? (I)matB->cols : (I)matB->rows),
+                        matA->nnz,
+                        (I)batch_count,
+                        val_batch_stride,
+                        &batched_size)));
+
+                *buffer_size = std::max(*buffer_size, batched_size);
+            }
+
             *buffer_size = std::max(static_cast<size_t>(4), *buffer_size);
             return rocsparse_status_success;
         }
@@ -160,21 +207,84 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
     // STAGE 3 - perform SpSM computation
     if(stage == rocsparse_spsm_stage_compute || stage == rocsparse_spsm_stage_auto)
     {
+        // Strided batches are solved together, the batch index is passed
+        // through the grid
+        if(batch_count > 1)
+        {
+            if(matA->format == rocsparse_format_csr)
+            {
+                return rocsparse_csrsm_solve_strided_batched_template(
+                    handle,
+                    trans_A,
+                    trans_B,
+                    (J)matA->rows,
+                    (trans_B == rocsparse_operation_none ? (J)matB->cols : (J)matB->rows),
+                    (I)matA->nnz,
+                    (const T*)alpha,
+                    matA->descr,
+                    (const T*)matA->const_val_data,
+                    val_batch_stride,
+                    (const I*)matA->const_row_data,
+                    (const J*)matA->const_col_data,
+                    (const T*)matB->const_values,
+                    (J)matB->ld,
+                    B_batch_stride,
+                    (T*)matC->values,
+                    (J)matC->ld,
+                    matC->batch_stride,
+                    (J)batch_count,
+                    matA->info,
+                    rocsparse_solve_policy_auto,
+                    temp_buffer);
+            }
+            else if(matA->format == rocsparse_format_coo)
+            {
+                return rocsparse_coosm_solve_strided_batched_template(
+                    handle,
+                    trans_A,
+                    trans_B,
+                    (I)matA->rows,
+                    (trans_B == rocsparse_operation_none ? (I)matB->cols : (I)matB->rows),
+                    matA->nnz,
+                    (const T*)alpha,
+                    matA->descr,
+                    (const T*)matA->const_val_data,
+                    val_batch_stride,
+                    (const I*)matA->const_row_data,
+                    (const I*)matA->const_col_data,
+                    (const T*)matB->const_values,
+                    (I)matB->ld,
+                    B_batch_stride,
+                    (T*)matC->values,
+                    (I)matC->ld,
+                    matC->batch_stride,
+                    (I)batch_count,
+                    matA->info,
+                    rocsparse_solve_policy_auto,
+                    temp_buffer);
+            }
+            else
+            {
+                return rocsparse_status_not_implemented;
+            }
+        }
+
         // copy B to C and perform in-place using C
         if(matB->rows > 0 && matB->cols > 0)
         {
-            hipMemcpy2D(matC->values,
-                        matC->ld * sizeof(T),
-                        matB->values,
-                        matB->ld * sizeof(T),
-                        (J)matB->rows * sizeof(T),
-                        (J)matB->cols,
-                        hipMemcpyDeviceToDevice);
+            RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(matC->values,
+                                                 matC->ld * sizeof(T),
+                                                 matB->const_values,
+                                                 matB->ld * sizeof(T),
+                                                 (J)matB->rows * sizeof(T),
+                                                 (J)matB->cols,
+                                                 hipMemcpyDeviceToDevice,
+                                                 handle->stream));
         }
 
         if(matA->format == rocsparse_format_csr)
         {
-            return rocsparse_csrsm_solve_template(
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsm_solve_template(
                 handle,
                 trans_A,
                 trans_B,
@@ -190,11 +300,11 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
                 (J)matC->ld,
                 matA->info,
                 rocsparse_solve_policy_auto,
-                temp_buffer);
+                temp_buffer));
         }
         else if(matA->format == rocsparse_format_coo)
         {
-            return rocsparse_coosm_solve_template(
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_coosm_solve_template(
                 handle,
                 trans_A,
                 trans_B,
@@ -210,12 +320,14 @@ rocsparse_status rocsparse_spsm_template(rocsparse_handle            handle,
                 (I)matC->ld,
                 matA->info,
                 rocsparse_solve_policy_auto,
-                temp_buffer);
+                temp_buffer));
         }
         else
         {
             return rocsparse_status_not_implemented;
         }
+
+        return rocsparse_status_success;
     }
 
     return rocsparse_status_not_implemented;
@@ -327,10 +439,10 @@ try
               "rocsparse_spsm",
               trans_A,
               trans_B,
-              (const void*&)alpha,
-              (const void*&)matA,
-              (const void*&)matB,
-              (const void*&)matC,
+              rocsparse_scalar_arg{alpha, compute_type},
+              matA,
+              matB,
+              matC,
               compute_type,
               alg,
               stage,
@@ -392,6 +504,29 @@ try
         return rocsparse_status_not_implemented;
     }
 
+    // Check batch counts, A and B can either be shared by all batches or
+    // have the same batch count as C
+    if((matA->batch_count != 1 && matA->batch_count != matC->batch_count)
+       || (matB->batch_count != 1 && matB->batch_count != matC->batch_count))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Batched SpSM requires all matrices to share the sparsity pattern
+    if(matC->batch_count > 1)
+    {
+        if(matA->offsets_batch_stride != 0)
+        {
+            return rocsparse_status_not_implemented;
+        }
+    }
+
+    // Profiling
+    rocsparse_profile_scope profile(
+        handle,
+        "rocsparse_spsm",
+        rocsparse_profile_models::spsm(matA, matB, matC, stage, temp_buffer));
+
     return rocsparse_spsm_dynamic_dispatch(matA->row_type,
                                            matA->col_type,
                                            compute_type,
@@ -49,7 +49,7 @@ rocsparse_status rocsparse_inclusive_scan(rocsparse_handle handle, J m_, I* ptr_
 
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
-        temp_storage_ptr = handle->buffer;
+        temp_storage_ptr = handle->get_buffer();
         temp_alloc       = false;
     }
     else
@@ -1204,7 +1204,8 @@ struct rocsparse_csritilu0_driver_t<rocsparse_itilu0_alg_async_inplace>
 
             size_t buffer_size = 0;
             // quick compute of unnz.
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(handle_->buffer, 0, sizeof(I), handle_->stream));
+            I* d_unnz = (I*)handle_->get_buffer();
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(d_unnz, 0, sizeof(I), handle_->stream));
             kernel_compute_unnz_dispatch<BLOCKSIZE, I, J>(m_,
                                                           handle_->wavefront_size,
                                                           handle_->stream,
@@ -1214,11 +1215,11 @@ struct rocsparse_csritilu0_driver_t<rocsparse_itilu0_alg_async_inplace>
                                                           ptr_ + 1,
                                                           ind_,
                                                           base_,
-                                                          (I*)handle_->buffer,
+                                                          d_unnz,
                                                           nullptr);
             I unnz;
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-                &unnz, (I*)handle_->buffer, sizeof(I), hipMemcpyDeviceToHost, handle_->stream));
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(&unnz, d_unnz, sizeof(I), hipMemcpyDeviceToHost, handle_->stream));
             RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle_->stream));
 
             using layout_t = buffer_layout_inplace_t;
@@ -1275,7 +1276,8 @@ struct rocsparse_csritilu0_driver_t<rocsparse_itilu0_alg_async_inplace>
         {
             void* __restrict__ buffer_ = buffer__;
             // quick compute of unnz.
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(handle_->buffer, 0, sizeof(I) * 2, handle_->stream));
+            I* d_hb = (I*)handle_->get_buffer();
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(d_hb, 0, sizeof(I) * 2, handle_->stream));
             kernel_compute_unnz_dispatch<BLOCKSIZE, I, J>(m_,
                                                           handle_->wavefront_size,
                                                           handle_->stream,
@@ -1284,11 +1286,11 @@ struct rocsparse_csritilu0_driver_t<rocsparse_itilu0_alg_async_inplace>
                                                           ptr_ + 1,
                                                           ind_,
                                                           base_,
-                                                          ((I*)handle_->buffer),
-                                                          ((I*)handle_->buffer) + 1);
+                                                          d_hb,
+                                                          d_hb + 1);
             I hb[2];
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-                hb, (I*)handle_->buffer, sizeof(I) * 2, hipMemcpyDeviceToHost, handle_->stream));
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(hb, d_hb, sizeof(I) * 2, hipMemcpyDeviceToHost, handle_->stream));
             RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle_->stream));
             const I unnz     = hb[0];
             const I nnz_diag = hb[1];
@@ -1349,7 +1351,7 @@ struct rocsparse_csritilu0_driver_t<rocsparse_itilu0_alg_async_inplace>
                 }
                 else
                 {
-                    csc_col_ind = (J*)handle_->buffer;
+                    csc_col_ind = (J*)handle_->get_buffer();
                 }
             }
 
@@ -1421,7 +1423,7 @@ struct rocsparse_csritilu0_driver_t<rocsparse_itilu0_alg_async_inplace>
             RETURN_IF_ROCSPARSE_ERROR(
                 rocsparse_coo2csr_template(handle_, csc_col_ind, unnz, m_, p_uptr, base_));
 
-            if(p_coo_row_ind == nullptr && csc_col_ind != handle_->buffer)
+            if(p_coo_row_ind == nullptr && csc_col_ind != handle_->get_buffer())
             {
                 RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(csc_col_ind, handle_->stream));
             }
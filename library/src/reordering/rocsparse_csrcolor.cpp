@@ -240,7 +240,7 @@ static rocsparse_status rocsparse_csrcolor_assign_uncolored(rocsparse_handle han
     //
     if(handle->buffer_size >= temp_storage_bytes)
     {
-        d_temp_storage = handle->buffer;
+        d_temp_storage = handle->get_buffer();
         d_temp_alloc   = false;
     }
     else
@@ -21,10 +21,12 @@
  *
  * ************************************************************************ */
 
+#include "config.h"
 #include "definitions.h"
 #include "handle.h"
 #include "rocsparse.h"
 #include "utility.h"
+#include <cstring>
 #include <iomanip>
 #include <map>
 
@@ -96,6 +98,105 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief create handle pool
+ *******************************************************************************/
+rocsparse_status rocsparse_create_handle_pool(rocsparse_handle_pool* pool)
+try
+{
+    if(pool == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *pool = new _rocsparse_handle_pool;
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief destroy handle pool
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_handle_pool(rocsparse_handle_pool pool)
+try
+{
+    if(pool == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    delete pool;
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief acquire handle from handle pool
+ *******************************************************************************/
+rocsparse_status rocsparse_handle_pool_acquire(rocsparse_handle_pool pool,
+                                               rocsparse_handle*     handle)
+try
+{
+    if(pool == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    int device;
+    RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+
+    *handle = pool->acquire(device);
+    if(*handle == nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_handle(handle));
+    }
+
+    log_trace(*handle, "rocsparse_handle_pool_acquire", (const void*&)pool);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief release handle to handle pool
+ *******************************************************************************/
+rocsparse_status rocsparse_handle_pool_release(rocsparse_handle_pool pool,
+                                               rocsparse_handle      handle)
+try
+{
+    if(pool == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_handle_pool_release", (const void*&)pool);
+
+    pool->release(handle);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  * \brief Indicates whether the scalar value pointers are on the host or device.
  * Set pointer mode, can be host or device
@@ -176,6 +277,288 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief Set the release threshold of the workspace pool.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_workspace_pool_release_threshold(rocsparse_handle handle,
+                                                                size_t           nbytes)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_set_workspace_pool_release_threshold", nbytes);
+
+    handle->workspace_pool->set_release_threshold(nbytes);
+
+    // Release what exceeds the new threshold
+    RETURN_IF_HIP_ERROR(handle->workspace_pool->trim(nbytes));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get the release threshold of the workspace pool.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_workspace_pool_release_threshold(rocsparse_handle handle,
+                                                                size_t*          nbytes)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(nbytes == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *nbytes = handle->workspace_pool->get_release_threshold();
+    log_trace(handle, "rocsparse_get_workspace_pool_release_threshold", *nbytes);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Release the cached memory of the workspace pool.
+ *******************************************************************************/
+rocsparse_status rocsparse_workspace_pool_trim(rocsparse_handle handle)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_workspace_pool_trim");
+
+    RETURN_IF_HIP_ERROR(handle->workspace_pool->trim(0));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get the memory usage of the workspace pool.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_workspace_pool_usage(rocsparse_handle handle,
+                                                    size_t*          nbytes_cached,
+                                                    size_t*          nbytes_high_water)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(nbytes_cached == nullptr || nbytes_high_water == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    const rocsparse_workspace_pool::stats_t stats = handle->workspace_pool->get_stats();
+
+    *nbytes_cached     = stats.nbytes_cached;
+    *nbytes_high_water = stats.nbytes_high_water;
+
+    log_trace(handle, "rocsparse_get_workspace_pool_usage", *nbytes_cached, *nbytes_high_water);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get the counters of the workspace pool.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_workspace_pool_counters(rocsparse_handle handle,
+                                                       size_t*          nrequests,
+                                                       size_t*          nhits)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(nrequests == nullptr || nhits == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    const rocsparse_workspace_pool::stats_t stats = handle->workspace_pool->get_stats();
+
+    *nrequests = stats.nrequests;
+    *nhits     = stats.nhits;
+
+    log_trace(handle, "rocsparse_get_workspace_pool_counters", *nrequests, *nhits);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get the profile report of the handle
+ *******************************************************************************/
+rocsparse_status
+    rocsparse_get_profile_report(rocsparse_handle handle, size_t* report_size, char* report)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle,
+              "rocsparse_get_profile_report",
+              (const void*&)report_size,
+              (const void*&)report);
+
+    if(report_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    const std::string json = (handle->profile != nullptr)
+                                 ? handle->profile->report(handle->device)
+                                 : rocsparse_profile().report(handle->device);
+
+    if(report == nullptr)
+    {
+        *report_size = json.size() + 1;
+        return rocsparse_status_success;
+    }
+
+    if(*report_size < json.size() + 1)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    std::memcpy(report, json.c_str(), json.size() + 1);
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Reset the profile of the handle
+ *******************************************************************************/
+rocsparse_status rocsparse_reset_profile(rocsparse_handle handle)
+try
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_reset_profile");
+
+    if(handle->profile != nullptr)
+    {
+        handle->profile->reset();
+    }
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Set a runtime configuration entry
+ *******************************************************************************/
+rocsparse_status rocsparse_set_config(const char* name, const char* value)
+try
+{
+    if(name == nullptr || value == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return ROCSPARSE_CONFIG.set(name, value);
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Get a runtime configuration entry
+ *******************************************************************************/
+rocsparse_status rocsparse_get_config(const char* name, size_t* value_size, char* value)
+try
+{
+    if(name == nullptr || value_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    std::string text;
+    RETURN_IF_ROCSPARSE_ERROR(ROCSPARSE_CONFIG.get(name, text));
+
+    if(value == nullptr)
+    {
+        *value_size = text.size() + 1;
+        return rocsparse_status_success;
+    }
+
+    if(*value_size < text.size() + 1)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    std::memcpy(value, text.c_str(), text.size() + 1);
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief Load a runtime configuration file
+ *******************************************************************************/
+rocsparse_status rocsparse_load_config(const char* filename)
+try
+{
+    if(filename == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return ROCSPARSE_CONFIG.load(filename);
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  * \brief Get rocSPARSE version
  * version % 100        = patch level
@@ -4201,6 +4584,40 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief rocsparse_ell_set_strided_batch sets the ELL sparse matrix batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_ell_set_strided_batch(rocsparse_spmat_descr descr,
+                                                 int                   batch_count,
+                                                 int64_t               batch_stride)
+try
+{
+    return rocsparse_coo_set_strided_batch(descr, batch_count, batch_stride);
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief rocsparse_bsr_set_strided_batch sets the BSR sparse matrix batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_bsr_set_strided_batch(rocsparse_spmat_descr descr,
+                                                 int                   batch_count,
+                                                 int64_t               offsets_batch_stride,
+                                                 int64_t               columns_values_batch_stride)
+try
+{
+    return rocsparse_csr_set_strided_batch(
+        descr, batch_count, offsets_batch_stride, columns_values_batch_stride);
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  * \brief rocsparse_spmat_get_attribute gets the sparse matrix attribute.
  *******************************************************************************/
@@ -4376,6 +4793,9 @@ try
         (*descr)->values       = values;
         (*descr)->const_values = values;
         (*descr)->data_type    = data_type;
+
+        (*descr)->batch_count  = 1;
+        (*descr)->batch_stride = 0;
     }
     catch(const rocsparse_status& status)
     {
@@ -4431,6 +4851,9 @@ try
         new_descr->const_values = values;
         new_descr->data_type    = data_type;
 
+        new_descr->batch_count  = 1;
+        new_descr->batch_stride = 0;
+
         *descr = new_descr;
     }
     catch(const rocsparse_status& status)
@@ -4614,6 +5037,78 @@ catch(...)
     return exception_to_rocsparse_status();
 }
 
+/********************************************************************************
+ * \brief rocsparse_dnvec_get_strided_batch gets the dense vector batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnvec_get_strided_batch(rocsparse_const_dnvec_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride)
+try
+{
+    // Check for valid pointers
+    if(descr == nullptr || batch_count == nullptr || batch_stride == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *batch_count  = descr->batch_count;
+    *batch_stride = descr->batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
+/********************************************************************************
+ * \brief rocsparse_dnvec_set_strided_batch sets the dense vector batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnvec_set_strided_batch(rocsparse_dnvec_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride)
+try
+{
+    // Check for valid pointers
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    if(batch_count <= 0 || batch_stride < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(batch_count > 1 && batch_stride < descr->size)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    descr->batch_count  = batch_count;
+    descr->batch_stride = batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    return exception_to_rocsparse_status();
+}
+
 /********************************************************************************
  * \brief rocsparse_create_dnmat_descr creates a descriptor holding the dense
  * matrix data, size and properties. It must be called prior to all subsequent
@@ -0,0 +1,1102 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "capture.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+#ifdef WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#ifdef ROCSPARSE_WITH_ROCSPARSEIO
+#include <rocsparseio.h>
+#endif
+
+namespace
+{
+    size_t sizeof_datatype(rocsparse_datatype type)
+    {
+        switch(type)
+        {
+        case rocsparse_datatype_i8_r:
+        case rocsparse_datatype_u8_r:
+            return 1;
+        case rocsparse_datatype_f32_r:
+        case rocsparse_datatype_i32_r:
+        case rocsparse_datatype_u32_r:
+            return 4;
+        case rocsparse_datatype_f64_r:
+        case rocsparse_datatype_f32_c:
+            return 8;
+        case rocsparse_datatype_f64_c:
+            return 16;
+        }
+        return 0;
+    }
+
+    size_t sizeof_indextype(rocsparse_indextype type)
+    {
+        switch(type)
+        {
+        case rocsparse_indextype_u16:
+            return 2;
+        case rocsparse_indextype_i32:
+            return 4;
+        case rocsparse_indextype_i64:
+            return 8;
+        }
+        return 0;
+    }
+
+    //
+    // SHA-256, see FIPS 180-4.
+    //
+    class sha256
+    {
+    public:
+        void update(const void* data, size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+            this->m_size += size;
+            while(size > 0)
+            {
+                const size_t n = std::min(size, sizeof(this->m_block) - this->m_fill);
+                std::memcpy(this->m_block + this->m_fill, bytes, n);
+
+                this->m_fill += n;
+                bytes += n;
+                size -= n;
+
+                if(this->m_fill == sizeof(this->m_block))
+                {
+                    this->compress();
+                    this->m_fill = 0;
+                }
+            }
+        }
+
+        void update(const std::string& str)
+        {
+            // The terminating character separates consecutive strings
+            this->update(str.c_str(), str.size() + 1);
+        }
+
+        std::array<unsigned char, 32> digest()
+        {
+            const uint64_t bits = this->m_size * 8;
+
+            const unsigned char pad = 0x80;
+            this->update(&pad, 1);
+
+            const unsigned char zero = 0;
+            while(this->m_fill != 56)
+            {
+                this->update(&zero, 1);
+            }
+
+            unsigned char length[8];
+            for(int i = 0; i < 8; ++i)
+            {
+                length[i] = static_cast<unsigned char>(bits >> (56 - 8 * i));
+            }
+            this->update(length, 8);
+
+            std::array<unsigned char, 32> digest;
+            for(int i = 0; i < 32; ++i)
+            {
+                digest[i] = static_cast<unsigned char>(this->m_state[i / 4] >> (24 - 8 * (i % 4)));
+            }
+            return digest;
+        }
+
+    private:
+        static uint32_t rotr(uint32_t x, int n)
+        {
+            return (x >> n) | (x << (32 - n));
+        }
+
+        void compress()
+        {
+            static constexpr uint32_t k[64]
+                = {0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+                   0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+                   0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+                   0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                   0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+                   0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+                   0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+                   0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                   0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+                   0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+                   0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+            uint32_t w[64];
+            for(int i = 0; i < 16; ++i)
+            {
+                w[i] = (uint32_t(this->m_block[4 * i]) << 24)
+                       | (uint32_t(this->m_block[4 * i + 1]) << 16)
+                       | (uint32_t(this->m_block[4 * i + 2]) << 8)
+                       | uint32_t(this->m_block[4 * i + 3]);
+            }
+
+            for(int i = 16; i < 64; ++i)
+            {
+                const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i]              = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+
+            uint32_t s[8];
+            std::memcpy(s, this->m_state, sizeof(s));
+
+            for(int i = 0; i < 64; ++i)
+            {
+                const uint32_t S1 = rotr(s[4], 6) ^ rotr(s[4], 11) ^ rotr(s[4], 25);
+                const uint32_t ch = (s[4] & s[5]) ^ (~s[4] & s[6]);
+                const uint32_t t1 = s[7] + S1 + ch + k[i] + w[i];
+                const uint32_t S0 = rotr(s[0], 2) ^ rotr(s[0], 13) ^ rotr(s[0], 22);
+                const uint32_t mj = (s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]);
+                const uint32_t t2 = S0 + mj;
+
+                s[7] = s[6];
+                s[6] = s[5];
+                s[5] = s[4];
+                s[4] = s[3] + t1;
+                s[3] = s[2];
+                s[2] = s[1];
+                s[1] = s[0];
+                s[0] = t1 + t2;
+            }
+
+            for(int i = 0; i < 8; ++i)
+            {
+                this->m_state[i] += s[i];
+            }
+        }
+
+        uint32_t m_state[8]
+            = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+               0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+        unsigned char m_block[64]{};
+        size_t        m_fill{};
+        uint64_t      m_size{};
+    };
+
+    std::string hexadecimal(const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+        std::ostringstream out;
+        out << std::hex << std::setfill('0');
+        for(size_t i = 0; i < size; ++i)
+        {
+            out << std::setw(2) << static_cast<unsigned int>(bytes[i]);
+        }
+        return out.str();
+    }
+
+    //
+    // Array of an operand, with its number of entries per batch, the stride
+    // between its batches and the size of its entries.
+    //
+    struct array_t
+    {
+        const void* data;
+        int64_t     count;
+        int64_t     stride;
+        size_t      size;
+    };
+
+    //
+    // Arrays of the operands, in the order they are written, none if the
+    // values of the operand cannot be written.
+    //
+    std::vector<array_t> operand_arrays(const _rocsparse_spmat_descr& A)
+    {
+        const size_t  row_size = sizeof_indextype(A.row_type);
+        const size_t  col_size = sizeof_indextype(A.col_type);
+        const size_t  val_size = sizeof_datatype(A.data_type);
+        const int64_t offsets  = A.offsets_batch_stride;
+        const int64_t indices  = A.columns_values_batch_stride;
+        const int64_t entries  = A.batch_stride;
+
+        switch(A.format)
+        {
+        case rocsparse_format_csr:
+        {
+            return {{A.const_row_data, A.rows + 1, offsets, row_size},
+                    {A.const_col_data, A.nnz, indices, col_size},
+                    {A.const_val_data, A.nnz, indices, val_size}};
+        }
+        case rocsparse_format_csc:
+        {
+            return {{A.const_col_data, A.cols + 1, offsets, col_size},
+                    {A.const_row_data, A.nnz, indices, row_size},
+                    {A.const_val_data, A.nnz, indices, val_size}};
+        }
+        case rocsparse_format_bsr:
+        {
+            const int64_t block_size = A.block_dim * A.block_dim;
+            return {{A.const_row_data, A.rows + 1, offsets, row_size},
+                    {A.const_col_data, A.nnz, indices, col_size},
+                    {A.const_val_data, A.nnz * block_size, indices, val_size}};
+        }
+        case rocsparse_format_coo:
+        {
+            return {{A.const_row_data, A.nnz, entries, row_size},
+                    {A.const_col_data, A.nnz, entries, col_size},
+                    {A.const_val_data, A.nnz, entries, val_size}};
+        }
+        case rocsparse_format_ell:
+        {
+            return {{A.const_col_data, A.rows * A.ell_width, entries, col_size},
+                    {A.const_val_data, A.rows * A.ell_width, entries, val_size}};
+        }
+        case rocsparse_format_coo_aos:
+        {
+            // There is no strided batched COO AoS matrix
+            if(A.batch_count > 1)
+            {
+                return {};
+            }
+
+            return {{A.const_ind_data, 2 * A.nnz, 0, row_size},
+                    {A.const_val_data, A.nnz, 0, val_size}};
+        }
+        case rocsparse_format_bell:
+        {
+            return {};
+        }
+        }
+        return {};
+    }
+
+    std::vector<array_t> operand_arrays(const _rocsparse_spvec_descr& x)
+    {
+        return {{x.const_idx_data, x.nnz, 0, sizeof_indextype(x.idx_type)},
+                {x.const_val_data, x.nnz, 0, sizeof_datatype(x.data_type)}};
+    }
+
+    std::vector<array_t> operand_arrays(const _rocsparse_dnvec_descr& x)
+    {
+        return {{x.const_values, x.size, x.batch_stride, sizeof_datatype(x.data_type)}};
+    }
+
+    std::vector<array_t> operand_arrays(const _rocsparse_dnmat_descr& A)
+    {
+        const bool    column = (A.order == rocsparse_order_column);
+        const int64_t m      = column ? A.rows : A.cols;
+        const int64_t n      = column ? A.cols : A.rows;
+        const int64_t count  = (m > 0 && n > 0) ? A.ld * (n - 1) + m : 0;
+
+        return {{A.const_values, count, A.batch_stride, sizeof_datatype(A.data_type)}};
+    }
+
+    std::vector<array_t> operand_arrays(const rocsparse_capture::operand_t& operand)
+    {
+        if(operand.kind == "spmat")
+        {
+            return operand_arrays(operand.spmat);
+        }
+        else if(operand.kind == "spvec")
+        {
+            return operand_arrays(operand.spvec);
+        }
+        else if(operand.kind == "dnvec")
+        {
+            return operand_arrays(operand.dnvec);
+        }
+        return operand_arrays(operand.dnmat);
+    }
+
+    // Number of entries of an array, all batches included
+    int64_t array_span(const array_t& array, int64_t batch_count)
+    {
+        return (array.count > 0) ? (batch_count - 1) * array.stride + array.count : 0;
+    }
+
+#ifdef ROCSPARSE_WITH_ROCSPARSEIO
+    bool io_type(rocsparse_datatype type, rocsparseio_type& io)
+    {
+        switch(type)
+        {
+        case rocsparse_datatype_f32_r:
+        {
+            io = rocsparseio_type_float32;
+            return true;
+        }
+        case rocsparse_datatype_f64_r:
+        {
+            io = rocsparseio_type_float64;
+            return true;
+        }
+        case rocsparse_datatype_f32_c:
+        {
+            io = rocsparseio_type_complex32;
+            return true;
+        }
+        case rocsparse_datatype_f64_c:
+        {
+            io = rocsparseio_type_complex64;
+            return true;
+        }
+        case rocsparse_datatype_i32_r:
+        {
+            io = rocsparseio_type_int32;
+            return true;
+        }
+        case rocsparse_datatype_i8_r:
+        case rocsparse_datatype_u8_r:
+        case rocsparse_datatype_u32_r:
+        {
+            return false;
+        }
+        }
+        return false;
+    }
+
+    bool io_type(rocsparse_indextype type, rocsparseio_type& io)
+    {
+        switch(type)
+        {
+        case rocsparse_indextype_i32:
+        {
+            io = rocsparseio_type_int32;
+            return true;
+        }
+        case rocsparse_indextype_i64:
+        {
+            io = rocsparseio_type_int64;
+            return true;
+        }
+        case rocsparse_indextype_u16:
+        {
+            return false;
+        }
+        }
+        return false;
+    }
+
+    rocsparseio_index_base io_base(rocsparse_index_base base)
+    {
+        return (base == rocsparse_index_base_one) ? rocsparseio_index_base_one
+                                                  : rocsparseio_index_base_zero;
+    }
+
+    int64_t get_index(const char* data, size_t size, int64_t i)
+    {
+        if(size == sizeof(int32_t))
+        {
+            int32_t x;
+            std::memcpy(&x, data + i * size, size);
+            return x;
+        }
+
+        int64_t x;
+        std::memcpy(&x, data + i * size, size);
+        return x;
+    }
+
+    void set_index(char* data, size_t size, int64_t i, int64_t value)
+    {
+        if(size == sizeof(int32_t))
+        {
+            const int32_t x = static_cast<int32_t>(value);
+            std::memcpy(data + i * size, &x, size);
+            return;
+        }
+
+        std::memcpy(data + i * size, &value, size);
+    }
+
+    //
+    // Write a batch of a sparse matrix, the pointers are the ones of the batch
+    // in the arrays of operand_arrays.
+    //
+    rocsparseio_status write_spmat(rocsparseio_handle            handle,
+                                   const _rocsparse_spmat_descr& A,
+                                   const std::vector<const char*>& p)
+    {
+        rocsparseio_type row_type;
+        rocsparseio_type col_type;
+        rocsparseio_type val_type;
+        if(!io_type(A.row_type, row_type) || !io_type(A.col_type, col_type)
+           || !io_type(A.data_type, val_type))
+        {
+            return rocsparseio_status_invalid_value;
+        }
+
+        const rocsparseio_index_base base = io_base(A.idx_base);
+
+        switch(A.format)
+        {
+        case rocsparse_format_csr:
+        {
+            return rocsparseio_write_sparse_csx(handle,
+                                                rocsparseio_direction_row,
+                                                A.rows,
+                                                A.cols,
+                                                A.nnz,
+                                                row_type,
+                                                p[0],
+                                                col_type,
+                                                p[1],
+                                                val_type,
+                                                p[2],
+                                                base);
+        }
+        case rocsparse_format_csc:
+        {
+            return rocsparseio_write_sparse_csx(handle,
+                                                rocsparseio_direction_column,
+                                                A.rows,
+                                                A.cols,
+                                                A.nnz,
+                                                col_type,
+                                                p[0],
+                                                row_type,
+                                                p[1],
+                                                val_type,
+                                                p[2],
+                                                base);
+        }
+        case rocsparse_format_bsr:
+        {
+            return rocsparseio_write_sparse_gebsx(handle,
+                                                  rocsparseio_direction_row,
+                                                  (A.block_dir == rocsparse_direction_column)
+                                                      ? rocsparseio_direction_column
+                                                      : rocsparseio_direction_row,
+                                                  A.rows,
+                                                  A.cols,
+                                                  A.nnz,
+                                                  A.block_dim,
+                                                  A.block_dim,
+                                                  row_type,
+                                                  p[0],
+                                                  col_type,
+                                                  p[1],
+                                                  val_type,
+                                                  p[2],
+                                                  base);
+        }
+        case rocsparse_format_coo:
+        {
+            return rocsparseio_write_sparse_coo(handle,
+                                                A.rows,
+                                                A.cols,
+                                                A.nnz,
+                                                row_type,
+                                                p[0],
+                                                col_type,
+                                                p[1],
+                                                val_type,
+                                                p[2],
+                                                base);
+        }
+        case rocsparse_format_coo_aos:
+        {
+            const size_t      size = sizeof_indextype(A.row_type);
+            std::vector<char> row(A.nnz * size);
+            std::vector<char> col(A.nnz * size);
+            for(int64_t i = 0; i < A.nnz; ++i)
+            {
+                std::memcpy(row.data() + i * size, p[0] + 2 * i * size, size);
+                std::memcpy(col.data() + i * size, p[0] + (2 * i + 1) * size, size);
+            }
+
+            return rocsparseio_write_sparse_coo(handle,
+                                                A.rows,
+                                                A.cols,
+                                                A.nnz,
+                                                row_type,
+                                                row.data(),
+                                                row_type,
+                                                col.data(),
+                                                val_type,
+                                                p[1],
+                                                base);
+        }
+        case rocsparse_format_ell:
+        {
+            // The entries of the row i are at i, i + rows, ..., padded with -1
+            const size_t      size     = sizeof_indextype(A.col_type);
+            const size_t      val_size = sizeof_datatype(A.data_type);
+            const int64_t     width    = A.ell_width;
+            std::vector<char> row(A.rows * width * size);
+            std::vector<char> col(A.rows * width * size);
+            std::vector<char> val(A.rows * width * val_size);
+
+            int64_t nnz = 0;
+            for(int64_t i = 0; i < A.rows; ++i)
+            {
+                for(int64_t k = 0; k < width; ++k)
+                {
+                    const int64_t j = get_index(p[0], size, k * A.rows + i) - A.idx_base;
+                    if(j >= 0 && j < A.cols)
+                    {
+                        set_index(row.data(), size, nnz, i + A.idx_base);
+                        set_index(col.data(), size, nnz, j + A.idx_base);
+                        std::memcpy(val.data() + nnz * val_size,
+                                    p[1] + (k * A.rows + i) * val_size,
+                                    val_size);
+                        ++nnz;
+                    }
+                }
+            }
+
+            return rocsparseio_write_sparse_coo(handle,
+                                                A.rows,
+                                                A.cols,
+                                                nnz,
+                                                col_type,
+                                                row.data(),
+                                                col_type,
+                                                col.data(),
+                                                val_type,
+                                                val.data(),
+                                                base);
+        }
+        case rocsparse_format_bell:
+        {
+            break;
+        }
+        }
+
+        return rocsparseio_status_invalid_value;
+    }
+
+    rocsparseio_status write_spvec(rocsparseio_handle            handle,
+                                   const _rocsparse_spvec_descr& x,
+                                   const std::vector<const char*>& p)
+    {
+        rocsparseio_type idx_type;
+        rocsparseio_type val_type;
+        if(!io_type(x.idx_type, idx_type) || !io_type(x.data_type, val_type))
+        {
+            return rocsparseio_status_invalid_value;
+        }
+
+        // Matrix of one row
+        const size_t      size = sizeof_indextype(x.idx_type);
+        std::vector<char> row(x.nnz * size);
+        for(int64_t i = 0; i < x.nnz; ++i)
+        {
+            set_index(row.data(), size, i, x.idx_base);
+        }
+
+        return rocsparseio_write_sparse_coo(handle,
+                                            1,
+                                            x.size,
+                                            x.nnz,
+                                            idx_type,
+                                            row.data(),
+                                            idx_type,
+                                            p[0],
+                                            val_type,
+                                            p[1],
+                                            io_base(x.idx_base));
+    }
+
+    rocsparseio_status write_dnvec(rocsparseio_handle            handle,
+                                   const _rocsparse_dnvec_descr& x,
+                                   const std::vector<const char*>& p)
+    {
+        rocsparseio_type val_type;
+        if(!io_type(x.data_type, val_type))
+        {
+            return rocsparseio_status_invalid_value;
+        }
+
+        return rocsparseio_write_dense_vector(handle, val_type, x.size, p[0], 1);
+    }
+
+    rocsparseio_status write_dnmat(rocsparseio_handle            handle,
+                                   const _rocsparse_dnmat_descr& A,
+                                   const std::vector<const char*>& p)
+    {
+        rocsparseio_type val_type;
+        if(!io_type(A.data_type, val_type))
+        {
+            return rocsparseio_status_invalid_value;
+        }
+
+        const rocsparseio_order order = (A.order == rocsparse_order_column)
+                                            ? rocsparseio_order_column
+                                            : rocsparseio_order_row;
+
+        return rocsparseio_write_dense_matrix(handle, order, A.rows, A.cols, val_type, p[0], A.ld);
+    }
+#endif
+}
+
+rocsparse_capture& rocsparse_capture::instance()
+{
+    static rocsparse_capture instance;
+    return instance;
+}
+
+rocsparse_capture::~rocsparse_capture()
+{
+    if(this->m_calls != nullptr)
+    {
+        std::fclose(this->m_calls);
+    }
+}
+
+void rocsparse_capture::start(const std::string& path, bool deduplicate, bool dense)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    if(this->m_calls != nullptr)
+    {
+        return;
+    }
+
+    this->m_path = path.empty() ? "rocsparse_capture" : path;
+
+    // The directory may exist already
+#ifdef WIN32
+    _mkdir(this->m_path.c_str());
+#else
+    mkdir(this->m_path.c_str(), 0755);
+#endif
+
+    const std::string calls = this->m_path + "/calls.txt";
+
+    this->m_calls = std::fopen(calls.c_str(), "w");
+    if(this->m_calls == nullptr)
+    {
+        std::cerr << "rocsparse error: cannot open capture file '" << calls << "'" << std::endl;
+        return;
+    }
+
+#ifndef ROCSPARSE_WITH_ROCSPARSEIO
+    std::cerr << "rocsparse warning: rocSPARSE is built without rocsparseio, the values of "
+                 "the captured operands are not written"
+              << std::endl;
+#endif
+
+    this->m_deduplicate = deduplicate;
+    this->m_dense       = dense;
+}
+
+bool rocsparse_capture::enabled(rocsparse_handle handle) const
+{
+    if((handle->layer_mode & rocsparse_layer_mode_capture) == 0 || this->m_calls == nullptr)
+    {
+        return false;
+    }
+
+    // Device arrays cannot be copied while the stream is captured into a graph
+    hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+    return hipStreamIsCapturing(handle->stream, &capture) == hipSuccess
+           && capture == hipStreamCaptureStatusNone;
+}
+
+std::string rocsparse_capture::write(const operand_t& operand)
+{
+    // Digest of the definition and of the values, operands with equal digests
+    // are the same operand
+    sha256 hash;
+    hash.update(operand.kind);
+    hash.update(operand.definition);
+    hash.update(&operand.data, sizeof(operand.data));
+    for(const std::vector<char>& array : operand.arrays)
+    {
+        const uint64_t size = array.size();
+        hash.update(&size, sizeof(size));
+        hash.update(array.data(), array.size());
+    }
+
+    const std::array<unsigned char, 32> digest = hash.digest();
+
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    if(this->m_deduplicate)
+    {
+        auto it = this->m_operands.find(digest);
+        if(it != this->m_operands.end())
+        {
+            return it->second;
+        }
+    }
+
+    const std::string id = this->m_deduplicate ? hexadecimal(digest.data(), digest.size())
+                                               : std::to_string(this->m_noperands++);
+
+    const bool data = operand.data && this->write_values(id, operand);
+
+    std::fprintf(this->m_calls,
+                 "%s %s %s data=%d\n",
+                 operand.kind.c_str(),
+                 id.c_str(),
+                 operand.definition.c_str(),
+                 data ? 1 : 0);
+
+    if(this->m_deduplicate)
+    {
+        this->m_operands[digest] = id;
+    }
+
+    return id;
+}
+
+bool rocsparse_capture::write_values(const std::string& id, const operand_t& operand)
+{
+#ifdef ROCSPARSE_WITH_ROCSPARSEIO
+    const std::vector<array_t> arrays = operand_arrays(operand);
+
+    for(int64_t b = 0; b < operand.batch_count; ++b)
+    {
+        std::vector<const char*> p;
+        for(size_t k = 0; k < arrays.size(); ++k)
+        {
+            p.push_back(operand.arrays[k].data() + b * arrays[k].stride * arrays[k].size);
+        }
+
+        const std::string filename = this->m_path + "/" + id + "_" + std::to_string(b) + ".bin";
+
+        rocsparseio_handle handle;
+        if(rocsparseio_open(&handle, rocsparseio_rwmode_write, filename.c_str())
+           != rocsparseio_status_success)
+        {
+            std::cerr << "rocsparse error: cannot open capture file '" << filename << "'"
+                      << std::endl;
+            return false;
+        }
+
+        rocsparseio_status status = rocsparseio_status_invalid_value;
+        if(operand.kind == "spmat")
+        {
+            status = write_spmat(handle, operand.spmat, p);
+        }
+        else if(operand.kind == "spvec")
+        {
+            status = write_spvec(handle, operand.spvec, p);
+        }
+        else if(operand.kind == "dnvec")
+        {
+            status = write_dnvec(handle, operand.dnvec, p);
+        }
+        else if(operand.kind == "dnmat")
+        {
+            status = write_dnmat(handle, operand.dnmat, p);
+        }
+
+        if(rocsparseio_close(handle) != rocsparseio_status_success
+           || status != rocsparseio_status_success)
+        {
+            std::cerr << "rocsparse error: cannot write capture file '" << filename << "'"
+                      << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void rocsparse_capture::call(const std::string& line)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    std::fprintf(this->m_calls, "%s\n", line.c_str());
+
+    // The directory stays readable if the process does not terminate normally
+    std::fflush(this->m_calls);
+}
+
+rocsparse_capture_call::rocsparse_capture_call(rocsparse_handle handle, const std::string& name)
+    : m_handle(handle)
+    , m_name(name)
+{
+}
+
+rocsparse_status rocsparse_capture_call::copy(const void*                   data,
+                                              size_t                        size,
+                                              rocsparse_capture::operand_t& operand)
+{
+    operand.arrays.emplace_back(size);
+    if(size == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    this->m_copied = true;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(operand.arrays.back().data(),
+                                       data,
+                                       size,
+                                       hipMemcpyDeviceToHost,
+                                       this->m_handle->stream));
+
+    return rocsparse_status_success;
+}
+
+void rocsparse_capture_call::operand(rocsparse_capture::operand_t& operand)
+{
+    // The values are written with rocsparseio, dense operands if asked for
+#ifdef ROCSPARSE_WITH_ROCSPARSEIO
+    const bool dense = (operand.kind == "dnvec" || operand.kind == "dnmat");
+    operand.data     = !dense || rocsparse_capture::instance().dense();
+#endif
+
+    const std::vector<array_t> arrays = operand_arrays(operand);
+    if(arrays.empty())
+    {
+        operand.data = false;
+    }
+
+    // Arrays that are not set
+    for(const array_t& array : arrays)
+    {
+        if(array.size == 0 || (array.data == nullptr && array_span(array, operand.batch_count) > 0))
+        {
+            operand.data = false;
+        }
+    }
+
+    for(size_t k = 0; k < arrays.size() && operand.data; ++k)
+    {
+        const int64_t span = array_span(arrays[k], operand.batch_count);
+        if(this->copy(arrays[k].data, span * arrays[k].size, operand) != rocsparse_status_success)
+        {
+            this->m_failed = true;
+        }
+    }
+
+    this->m_refs.emplace_back(this->m_args.size(), this->m_operands.size());
+    this->m_args.push_back(operand.kind);
+    this->m_operands.push_back(std::move(operand));
+}
+
+void rocsparse_capture_call::operator()(rocsparse_const_spmat_descr x)
+{
+    if(x == nullptr || !x->init)
+    {
+        (*this)(static_cast<const void*>(x));
+        return;
+    }
+
+    rocsparse_capture::operand_t operand;
+    operand.kind        = "spmat";
+    operand.spmat       = *x;
+    operand.batch_count = std::max<int64_t>(x->batch_count, 1);
+
+    const _rocsparse_mat_descr* descr = x->descr;
+
+    std::ostringstream definition;
+    definition << "format=" << x->format << " rows=" << x->rows << " cols=" << x->cols
+               << " nnz=" << x->nnz << " row_type=" << x->row_type << " col_type=" << x->col_type
+               << " data_type=" << x->data_type << " idx_base=" << x->idx_base
+               << " block_dir=" << x->block_dir << " block_dim=" << x->block_dim
+               << " ell_cols=" << x->ell_cols << " ell_width=" << x->ell_width
+               << " batch_count=" << x->batch_count << " batch_stride=" << x->batch_stride
+               << " offsets_batch_stride=" << x->offsets_batch_stride
+               << " columns_values_batch_stride=" << x->columns_values_batch_stride;
+    if(descr != nullptr)
+    {
+        definition << " matrix_type=" << descr->type << " fill_mode=" << descr->fill_mode
+                   << " diag_type=" << descr->diag_type
+                   << " storage_mode=" << descr->storage_mode;
+    }
+    operand.definition = definition.str();
+
+    this->operand(operand);
+}
+
+void rocsparse_capture_call::operator()(rocsparse_const_spvec_descr x)
+{
+    if(x == nullptr || !x->init)
+    {
+        (*this)(static_cast<const void*>(x));
+        return;
+    }
+
+    rocsparse_capture::operand_t operand;
+    operand.kind  = "spvec";
+    operand.spvec = *x;
+
+    std::ostringstream definition;
+    definition << "size=" << x->size << " nnz=" << x->nnz << " idx_type=" << x->idx_type
+               << " data_type=" << x->data_type << " idx_base=" << x->idx_base;
+    operand.definition = definition.str();
+
+    this->operand(operand);
+}
+
+void rocsparse_capture_call::operator()(rocsparse_const_dnvec_descr x)
+{
+    if(x == nullptr || !x->init)
+    {
+        (*this)(static_cast<const void*>(x));
+        return;
+    }
+
+    rocsparse_capture::operand_t operand;
+    operand.kind        = "dnvec";
+    operand.dnvec       = *x;
+    operand.batch_count = std::max<int64_t>(x->batch_count, 1);
+
+    std::ostringstream definition;
+    definition << "size=" << x->size << " data_type=" << x->data_type
+               << " batch_count=" << x->batch_count << " batch_stride=" << x->batch_stride;
+    operand.definition = definition.str();
+
+    this->operand(operand);
+}
+
+void rocsparse_capture_call::operator()(rocsparse_const_dnmat_descr x)
+{
+    if(x == nullptr || !x->init)
+    {
+        (*this)(static_cast<const void*>(x));
+        return;
+    }
+
+    rocsparse_capture::operand_t operand;
+    operand.kind        = "dnmat";
+    operand.dnmat       = *x;
+    operand.batch_count = std::max<int64_t>(x->batch_count, 1);
+
+    std::ostringstream definition;
+    definition << "rows=" << x->rows << " cols=" << x->cols << " ld=" << x->ld
+               << " order=" << x->order << " data_type=" << x->data_type
+               << " batch_count=" << x->batch_count << " batch_stride=" << x->batch_stride;
+    operand.definition = definition.str();
+
+    this->operand(operand);
+}
+
+void rocsparse_capture_call::operator()(const rocsparse_scalar_arg& x)
+{
+    const size_t size = sizeof_datatype(x.type);
+    if(x.value == nullptr || size == 0)
+    {
+        (*this)(x.value);
+        return;
+    }
+
+    this->m_scalars.push_back({this->m_args.size(), size, {}});
+    this->m_args.push_back("scalar");
+
+    scalar_t& scalar = this->m_scalars.back();
+    if(this->m_handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        std::memcpy(scalar.bytes, x.value, size);
+        return;
+    }
+
+    this->m_copied = true;
+    if(hipMemcpyAsync(scalar.bytes, x.value, size, hipMemcpyDeviceToHost, this->m_handle->stream)
+       != hipSuccess)
+    {
+        this->m_failed = true;
+    }
+}
+
+void rocsparse_capture_call::operator()(float x)
+{
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<float>::max_digits10) << x;
+    this->m_args.push_back(os.str());
+}
+
+void rocsparse_capture_call::operator()(double x)
+{
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<double>::max_digits10) << x;
+    this->m_args.push_back(os.str());
+}
+
+void rocsparse_capture_call::operator()(const rocsparse_float_complex& x)
+{
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<float>::max_digits10) << std::real(x) << ","
+       << std::imag(x);
+    this->m_args.push_back(os.str());
+}
+
+void rocsparse_capture_call::operator()(const rocsparse_double_complex& x)
+{
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<double>::max_digits10) << std::real(x) << ","
+       << std::imag(x);
+    this->m_args.push_back(os.str());
+}
+
+void rocsparse_capture_call::finish()
+{
+    if(this->m_copied && hipStreamSynchronize(this->m_handle->stream) != hipSuccess)
+    {
+        this->m_failed = true;
+    }
+
+    if(this->m_failed)
+    {
+        std::cerr << "rocsparse error: cannot capture the operands of " << this->m_name
+                  << std::endl;
+
+        for(rocsparse_capture::operand_t& operand : this->m_operands)
+        {
+            operand.data = false;
+            operand.arrays.clear();
+        }
+    }
+
+    rocsparse_capture& capture = rocsparse_capture::instance();
+
+    for(const auto& ref : this->m_refs)
+    {
+        const rocsparse_capture::operand_t& operand = this->m_operands[ref.second];
+        this->m_args[ref.first] = operand.kind + ":" + capture.write(operand);
+    }
+
+    for(const scalar_t& scalar : this->m_scalars)
+    {
+        this->m_args[scalar.arg] = this->m_failed
+                                       ? std::string("scalar:unknown")
+                                       : "scalar:" + hexadecimal(scalar.bytes, scalar.size);
+    }
+
+    std::string line = "call " + this->m_name;
+    for(const std::string& arg : this->m_args)
+    {
+        line += " " + arg;
+    }
+
+    capture.call(line);
+}
@@ -0,0 +1,345 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "config.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+constexpr rocsparse_config::key_t rocsparse_config::all[];
+
+const rocsparse_config::entry_t rocsparse_config::s_entries[rocsparse_config::size] = {
+#define CONFIG(name_, kind_, default_, choices_) {#name_, type_##kind_, default_, choices_},
+    ROCSPARSE_FOREACH_CONFIG
+#undef CONFIG
+};
+
+static std::string trim(const std::string& s)
+{
+    size_t begin = 0;
+    size_t end   = s.size();
+
+    while(begin < end && std::isspace(static_cast<unsigned char>(s[begin])))
+    {
+        ++begin;
+    }
+
+    while(end > begin && std::isspace(static_cast<unsigned char>(s[end - 1])))
+    {
+        --end;
+    }
+
+    return s.substr(begin, end - begin);
+}
+
+rocsparse_config& rocsparse_config::instance()
+{
+    static rocsparse_config instance;
+    return instance;
+}
+
+rocsparse_config::rocsparse_config()
+{
+    // Defaults
+    for(auto key : rocsparse_config::all)
+    {
+        parse(key, s_entries[key].default_value, this->m_values[key]);
+    }
+
+    // Configuration file
+    const char* filename = getenv("ROCSPARSE_CONFIG_FILE");
+    if(filename != nullptr)
+    {
+        if(this->load(filename) == rocsparse_status_internal_error)
+        {
+            std::cerr << "rocsparse error, cannot load configuration file " << filename
+                      << std::endl;
+        }
+    }
+
+    // Environment variables
+    for(auto key : rocsparse_config::all)
+    {
+        const std::string name  = std::string("ROCSPARSE_") + s_entries[key].name;
+        const char*       value = getenv(name.c_str());
+        if(value != nullptr)
+        {
+            if(parse(key, value, this->m_values[key]) != rocsparse_status_success)
+            {
+                std::cerr << "rocsparse error, invalid environment variable " << name << "="
+                          << value << ", keeping " << this->m_values[key].text << std::endl;
+            }
+        }
+    }
+
+    if(this->m_values[VERBOSE].number != 0)
+    {
+        for(auto key : rocsparse_config::all)
+        {
+            std::cout << "config ROCSPARSE_" << s_entries[key].name << " : "
+                      << this->m_values[key].text << std::endl;
+        }
+    }
+}
+
+bool rocsparse_config::find(const char* name, key_t& key)
+{
+    if(name == nullptr)
+    {
+        return false;
+    }
+
+    if(strncmp(name, "ROCSPARSE_", 10) == 0)
+    {
+        name += 10;
+    }
+
+    for(auto k : rocsparse_config::all)
+    {
+        if(strcmp(name, s_entries[k].name) == 0)
+        {
+            key = k;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+rocsparse_status rocsparse_config::parse(key_t key, const std::string& text, value_t& value)
+{
+    const entry_t&    entry = s_entries[key];
+    const std::string s     = trim(text);
+
+    switch(entry.type)
+    {
+    case type_bool:
+    {
+        if(s == "0" || s == "false" || s == "off")
+        {
+            value.number = 0;
+        }
+        else if(s == "1" || s == "true" || s == "on")
+        {
+            value.number = 1;
+        }
+        else
+        {
+            return rocsparse_status_invalid_value;
+        }
+        break;
+    }
+
+    case type_int:
+    case type_size:
+    {
+        if(s.empty())
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        char*     end = nullptr;
+        long long n   = strtoll(s.c_str(), &end, 0);
+
+        if(entry.type == type_size)
+        {
+            if(n < 0)
+            {
+                return rocsparse_status_invalid_value;
+            }
+
+            const char* suffixes = "KMG";
+            const char* suffix   = (*end != '\0') ? strchr(suffixes, toupper(*end)) : nullptr;
+            if(suffix != nullptr)
+            {
+                n <<= 10 * (suffix - suffixes + 1);
+                ++end;
+            }
+        }
+
+        if(*end != '\0')
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        value.number = n;
+        break;
+    }
+
+    case type_enum:
+    {
+        int64_t     index  = 0;
+        const char* choice = entry.choices;
+
+        while(true)
+        {
+            const char* sep = strchr(choice, '|');
+            size_t      len = (sep != nullptr) ? sep - choice : strlen(choice);
+
+            if(s.size() == len && strncmp(s.c_str(), choice, len) == 0)
+            {
+                break;
+            }
+
+            if(sep == nullptr)
+            {
+                return rocsparse_status_invalid_value;
+            }
+
+            choice = sep + 1;
+            ++index;
+        }
+
+        value.number = index;
+        break;
+    }
+
+    case type_string:
+    {
+        break;
+    }
+    }
+
+    value.text = s;
+    return rocsparse_status_success;
+}
+
+bool rocsparse_config::get_bool(key_t key) const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_values[key].number != 0;
+}
+
+int64_t rocsparse_config::get_int(key_t key) const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_values[key].number;
+}
+
+size_t rocsparse_config::get_size(key_t key) const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return static_cast<size_t>(this->m_values[key].number);
+}
+
+int64_t rocsparse_config::get_enum(key_t key) const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_values[key].number;
+}
+
+std::string rocsparse_config::get_string(key_t key) const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_values[key].text;
+}
+
+rocsparse_status rocsparse_config::set(const char* name, const char* value)
+{
+    key_t key;
+    if(!find(name, key))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(value == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    value_t                v;
+    const rocsparse_status status = parse(key, value, v);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_values[key] = v;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_config::get(const char* name, std::string& value) const
+{
+    key_t key;
+    if(!find(name, key))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    value = this->m_values[key].text;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_config::load(const char* filename)
+{
+    std::ifstream in(filename);
+    if(!in.is_open())
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    rocsparse_status status = rocsparse_status_success;
+
+    std::string line;
+    while(std::getline(in, line))
+    {
+        // Strip comment
+        const size_t comment = line.find('#');
+        if(comment != std::string::npos)
+        {
+            line.resize(comment);
+        }
+
+        line = trim(line);
+        if(line.empty())
+        {
+            continue;
+        }
+
+        const size_t eq = line.find('=');
+        if(eq == std::string::npos)
+        {
+            std::cerr << "rocsparse error, invalid configuration line '" << line << "' in "
+                      << filename << std::endl;
+            status = rocsparse_status_invalid_value;
+            continue;
+        }
+
+        const std::string name  = trim(line.substr(0, eq));
+        const std::string value = trim(line.substr(eq + 1));
+
+        if(this->set(name.c_str(), value.c_str()) != rocsparse_status_success)
+        {
+            std::cerr << "rocsparse error, invalid configuration entry " << name << " = " << value
+                      << " in " << filename << std::endl;
+            status = rocsparse_status_invalid_value;
+        }
+    }
+
+    return status;
+}
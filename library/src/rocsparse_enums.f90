@@ -109,6 +109,9 @@ module rocsparse_enums
         enumerator :: rocsparse_layer_mode_log_trace = 1
         enumerator :: rocsparse_layer_mode_log_bench = 2
         enumerator :: rocsparse_layer_mode_log_debug = 4
+        enumerator :: rocsparse_layer_mode_log_trace_binary = 8
+        enumerator :: rocsparse_layer_mode_profile = 16
+        enumerator :: rocsparse_layer_mode_capture = 32
     end enum
 
 !   rocsparse_status
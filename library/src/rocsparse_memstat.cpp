@@ -23,14 +23,21 @@
 
 #ifdef ROCSPARSE_WITH_MEMSTAT
 
-#include "envariables.h"
+#include "config.h"
 #include "memstat.h"
 #include "rocsparse-types.h"
+#include "workspace_pool.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 #include <vector>
 
 //
@@ -82,7 +89,6 @@ static std::string relfilename(const char* tag_)
 
 static double get_time_us(void)
 {
-    hipDeviceSynchronize();
     auto now = std::chrono::steady_clock::now();
     auto duration
         = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
@@ -220,7 +226,6 @@ public:
 
 private:
     memstat();
-    bool check() const;
     //
     // Destructor.
     //
@@ -228,7 +233,7 @@ private:
     {
         if(s_enabled)
         {
-            if(this->m_map.size() > 0)
+            if(this->count_live() > 0)
             {
                 std::cerr << "rocsparse memstat memory leaks detected, use Python script "
                              "'rocsparse-memstat.py' to postprocess file '"
@@ -256,46 +261,108 @@ private:
     };
 
     //
-    // map for hashing, vector for sorted events.
+    // Statistics of an allocation site, the histogram counts the allocations
+    // per power of two of their size.
     //
-    std::map<void*, stat> m_map;
-    std::vector<stat>     m_data;
-    double                m_start_time;
-    size_t                m_total_nbytes[memstat_mode::size]{};
-    int                   m_next_flush_report{};
-    std::string           m_report_filename;
+    static constexpr size_t nbins = 64;
+    struct tag_stat
+    {
+        size_t nallocs{};
+        size_t nfrees{};
+        size_t nbytes_live{};
+        size_t nbytes_peak{};
+        size_t nbytes_total{};
+        size_t histogram[nbins]{};
+    };
+
+    //
+    // Live allocations, allocation sites and the events not yet written to the
+    // report are sharded by address, such that concurrent threads rarely
+    // contend for the same lock.
+    //
+    static constexpr size_t nshards = 64;
+    struct alignas(64) shard
+    {
+        std::mutex                                mutex;
+        std::unordered_map<void*, stat>           live;
+        std::unordered_map<const char*, tag_stat> tags;
+        std::vector<stat>                         log;
+    };
+
+    static size_t shard_index(const void* p)
+    {
+        uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h % nshards;
+    }
+
+    //
+    // Maximum number of events held in memory by a shard before they are
+    // spilled to the report file.
+    //
+    static constexpr size_t log_capacity = 256;
+
+    shard m_shards[nshards];
+
+    std::atomic<size_t> m_next_index{};
+    std::atomic<size_t> m_total_nbytes[memstat_mode::size]{};
+    double              m_start_time;
+
+    //
+    // The log mutex guards the report file only.
+    //
+    std::mutex    m_log_mutex;
+    std::ofstream m_out;
+    bool          m_started{};
+    size_t        m_nevents{};
+
+    std::mutex                                     m_pools_mutex;
+    std::vector<rocsparse_workspace_pool::stats_t> m_workspace_pools;
+    std::string                                    m_report_filename;
 
 public:
     void set_filename(const char* filename)
     {
-        if(this->m_next_flush_report > 0)
+        std::lock_guard<std::mutex> lock(this->m_log_mutex);
+        if(this->m_out.is_open())
         {
             //
-            // Rename the file.
+            // Rename the file and keep streaming into it.
             //
+            this->m_out.close();
             std::rename(this->m_report_filename.c_str(), filename);
+            this->m_out.open(filename, std::ios_base::app);
         }
         this->m_report_filename = std::string(filename);
     }
 
     void add(void* address, size_t nbytes, memstat_mode::value_t mode, const char* tag);
+    void add_workspace_pool(const rocsparse_workspace_pool::stats_t& stats);
     void remove(void* address, const char* tag);
-    bool contains(void* address) const;
+    bool contains(void* address);
     void flush_report(bool finalize = false);
 
 private:
-    void report(std::ostream& out) const;
-    void report_legend(std::ostream& out) const;
-    void flush_report(std::ostream& out, bool finalize) const;
+    size_t count_live();
+    void   log(shard& s, const stat& event, std::vector<stat>& full);
+    void   spill(const std::vector<stat>& events, bool finalize);
+    void   report(std::ostream& out, const std::vector<stat>& events) const;
+    void   report_legend(std::ostream& out) const;
+    void   report_leaks(std::ostream& out);
+    void   report_tags(std::ostream& out, double t);
+    void   report_workspace_pools(std::ostream& out);
 };
 
 //
 // This forces instantation (but that's not the purpose of it).
 //
-bool memstat::s_enabled = ROCSPARSE_ENVARIABLES.get(rocsparse_envariables::MEMSTAT);
+bool memstat::s_enabled = rocsparse_config::instance().get_bool(rocsparse_config::MEMSTAT);
 bool memstat::s_force_managed
-    = ROCSPARSE_ENVARIABLES.get(rocsparse_envariables::MEMSTAT_FORCE_MANAGED);
-bool memstat::s_guards_enabled = ROCSPARSE_ENVARIABLES.get(rocsparse_envariables::MEMSTAT_GUARDS);
+    = rocsparse_config::instance().get_bool(rocsparse_config::MEMSTAT_FORCE_MANAGED);
+bool memstat::s_guards_enabled
+    = rocsparse_config::instance().get_bool(rocsparse_config::MEMSTAT_GUARDS);
 
 template <memstat_mode::value_t MODE>
 size_t memstat_allocator<MODE>::compute_nbytes(size_t s)
@@ -480,7 +547,7 @@ hipError_t memstat_allocator<MODE>::malloc(void** mem, size_t nbytes_)
     }
     case memstat_mode::device:
     {
-        err = hipMalloc(mem, nbytes);
+        err = rocsparse_workspace_pool::malloc(mem, nbytes);
         break;
     }
     case memstat_mode::managed:
@@ -536,11 +603,7 @@ hipError_t memstat_allocator<MODE>::malloc_async(void** mem, size_t nbytes_, hip
     }
     case memstat_mode::device:
     {
-#if HIP_VERSION >= 50300000
-        err = hipMallocAsync(mem, nbytes, stream);
-#else
-        err = hipMalloc(mem, nbytes);
-#endif
+        err = rocsparse_workspace_pool::malloc_async(mem, nbytes, stream);
         break;
     }
     case memstat_mode::managed:
@@ -637,11 +700,15 @@ hipError_t memstat_allocator<MODE>::free(void* d_)
             return hipHostFree(d);
         }
         case memstat_mode::managed:
-        case memstat_mode::device:
         {
-            // Free device memory
+            // Free managed memory
             return hipFree(d);
         }
+        case memstat_mode::device:
+        {
+            // Free device memory, or give it back to its workspace pool
+            return rocsparse_workspace_pool::free(d);
+        }
         }
     }
     return hipSuccess;
@@ -670,12 +737,8 @@ hipError_t memstat_allocator<MODE>::free_async(void* d_, hipStream_t stream)
         }
         case memstat_mode::device:
         {
-            // Free device memory
-#if HIP_VERSION >= 50300000
-            return hipFreeAsync(d, stream);
-#else
-            return hipFree(d);
-#endif
+            // Give device memory back to its workspace pool
+            return rocsparse_workspace_pool::free_async(d, stream);
         }
         }
     }
@@ -840,170 +903,369 @@ memstat::memstat()
 
 void memstat::add(void* address, size_t nbytes, memstat_mode::value_t mode, const char* tag)
 {
-    if(!contains(address))
+    const double t = get_time_us();
+
+    std::vector<stat> full;
+    stat              event;
+    event.index  = ++this->m_next_index;
+    event.nbytes = nbytes;
+    event.mode   = mode;
+    event.kind   = "malloc";
+    event.tag    = tag;
+    event.t      = t;
+
     {
-        double t = get_time_us();
+        shard&                      s = this->m_shards[shard_index(address)];
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if(s.live.find(address) != s.live.end())
+        {
+            std::cerr << " already exist" << std::endl;
+            exit(1);
+        }
+
         this->m_total_nbytes[mode] += nbytes;
-        const size_t index = this->m_next_flush_report + (this->m_data.size() + 1);
-        this->m_map[address]
-            = {index,
-               nbytes,
-               mode,
-               "malloc",
-               {this->m_total_nbytes[0], this->m_total_nbytes[1], this->m_total_nbytes[2]},
-               tag,
-               t};
-        this->m_data.push_back(
-            {index,
-             nbytes,
-             mode,
-             "malloc",
-             {this->m_total_nbytes[0], this->m_total_nbytes[1], this->m_total_nbytes[2]},
-             tag,
-             t});
-        memstat::instance().flush_report();
+        for(auto v : memstat_mode::all)
+        {
+            event.total_nbytes[v] = this->m_total_nbytes[v];
+        }
+        s.live[address] = event;
+        this->log(s, event, full);
     }
-    else
+
     {
-        std::cerr << " already exist" << std::endl;
-        exit(1);
+        shard&                      s = this->m_shards[shard_index(tag)];
+        std::lock_guard<std::mutex> lock(s.mutex);
+        tag_stat&                   ts = s.tags[tag];
+
+        size_t bin = 0;
+        while(bin + 1 < nbins && (size_t(1) << bin) < nbytes)
+        {
+            ++bin;
+        }
+
+        ++ts.nallocs;
+        ++ts.histogram[bin];
+        ts.nbytes_total += nbytes;
+        ts.nbytes_live += nbytes;
+        ts.nbytes_peak = std::max(ts.nbytes_peak, ts.nbytes_live);
     }
+
+    this->spill(full, false);
 }
 
-void memstat::flush_report(std::ostream& out, bool finalize) const
+void memstat::remove(void* address, const char* tag)
 {
-    if(this->m_data.size() >= 128 || finalize)
+    const double t = get_time_us();
+
+    std::vector<stat> full;
+    stat              event;
     {
-        const bool first = (0 == this->m_next_flush_report);
-        if(first)
+        shard&                      s = this->m_shards[shard_index(address)];
+        std::lock_guard<std::mutex> lock(s.mutex);
+        auto                        it = s.live.find(address);
+        if(it == s.live.end())
         {
-            out << "{ " << std::endl;
-            out << "\"legend\":";
-            this->report_legend(out);
-            out << "," << std::endl;
-            out << "\"results\": [ " << std::endl;
+            std::cerr << "ROCSPARSE MEMSTAT, address not found." << std::endl;
+            exit(1);
         }
-        else
+
+        event = it->second;
+        s.live.erase(it);
+
+        this->m_total_nbytes[event.mode] -= event.nbytes;
+        for(auto v : memstat_mode::all)
         {
-            out << ", " << std::endl;
+            event.total_nbytes[v] = this->m_total_nbytes[v];
         }
-        this->report(out);
-        if(finalize)
-        {
-            out << "], " << std::endl;
-            //
-            //
-            //
-            if(m_map.size() == 0)
-            {
-                out << "\"leaks\": []";
-            }
-            else
-            {
-                out << "\"leaks\": [";
-                bool first = true;
-                for(auto f : m_map)
-                {
-                    auto e = f.second;
-                    if(!first)
-                        out << "," << std::endl;
-                    //
-                    // Transform tag?
-                    //
-                    out << " { ";
-                    out << "  \"index\": \"" << e.index << "\"";
-                    out << ", "
-                        << "  \"mode\": \"" << memstat_mode::to_string(e.mode) << "\""
-                        << ", "
-                        << "  \"op\"  : \"" << e.kind << "\""
-                        << ", "
-                        << "  \"nbytes\" : \"" << e.nbytes << "\""
-                        << ", "
-                        << "   \"tag\": \"" << relfilename(e.tag) << "\""
-                        << " }";
-                    first = false;
-                }
 
-                out << "]";
-            }
+        stat free_event  = event;
+        free_event.index = ++this->m_next_index;
+        free_event.kind  = "free";
+        free_event.tag   = tag;
+        free_event.t     = t;
+        this->log(s, free_event, full);
+    }
 
-            out << "}" << std::endl;
-        }
+    //
+    // Live bytes are accounted to the allocation site.
+    //
+    {
+        shard&                      s = this->m_shards[shard_index(event.tag)];
+        std::lock_guard<std::mutex> lock(s.mutex);
+        tag_stat&                   ts = s.tags[event.tag];
+        ++ts.nfrees;
+        ts.nbytes_live -= event.nbytes;
+    }
+
+    this->spill(full, false);
+}
+
+void memstat::add_workspace_pool(const rocsparse_workspace_pool::stats_t& stats)
+{
+    std::lock_guard<std::mutex> lock(this->m_pools_mutex);
+    this->m_workspace_pools.push_back(stats);
+}
+
+bool memstat::contains(void* address)
+{
+    shard&                      s = this->m_shards[shard_index(address)];
+    std::lock_guard<std::mutex> lock(s.mutex);
+    return (s.live.find(address) != s.live.end());
+}
+
+size_t memstat::count_live()
+{
+    size_t n = 0;
+    for(auto& s : this->m_shards)
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        n += s.live.size();
+    }
+    return n;
+}
+
+//
+// Record an event in the log of the shard, the caller holds the shard mutex.
+// A full log is handed over in full, to be spilled once the shard mutex is
+// released.
+//
+void memstat::log(shard& s, const stat& event, std::vector<stat>& full)
+{
+    s.log.push_back(event);
+    if(s.log.size() >= log_capacity)
+    {
+        full.swap(s.log);
+        s.log.reserve(log_capacity);
     }
 }
 
 void memstat::flush_report(bool finalize)
 {
-    if(this->m_data.size() >= 128 || finalize)
+    std::vector<stat> events;
+    for(auto& s : this->m_shards)
     {
-        const bool    first = (0 == this->m_next_flush_report);
-        std::ofstream out(this->m_report_filename,
-                          (first) ? std::ios_base::out : std::ios_base::app);
-        this->flush_report(out, finalize);
-        out.close();
-        this->m_next_flush_report += std::min(m_data.size(), size_t(128));
-        this->m_data.clear();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        events.insert(events.end(), s.log.begin(), s.log.end());
+        s.log.clear();
     }
+
+    std::sort(events.begin(), events.end(), [](const stat& a, const stat& b) {
+        return a.index < b.index;
+    });
+
+    this->spill(events, finalize);
 }
 
-void memstat::remove(void* address, const char* tag)
+//
+// Stream events into the report file. The events are formatted before the
+// log mutex is taken, which is then held for the file output only. Events of
+// distinct shards are written in batches and are ordered by their index.
+//
+void memstat::spill(const std::vector<stat>& events, bool finalize)
 {
-    auto it = m_map.find(address);
-    if(it != m_map.end())
-    {
-        this->m_total_nbytes[it->second.mode] -= it->second.nbytes;
-        double       t     = get_time_us();
-        const size_t index = this->m_next_flush_report + (this->m_data.size() + 1);
-        this->m_data.push_back(
-            {index,
-             it->second.nbytes,
-             it->second.mode,
-             "free",
-             {this->m_total_nbytes[0], this->m_total_nbytes[1], this->m_total_nbytes[2]},
-             tag,
-             t});
-        memstat::instance().flush_report();
-        m_map.erase(address);
+    if(events.empty() && !finalize)
+    {
+        return;
+    }
+
+    std::ostringstream body;
+    this->report(body, events);
+
+    std::lock_guard<std::mutex> lock(this->m_log_mutex);
+
+    auto& out = this->m_out;
+    if(!out.is_open())
+    {
+        out.open(this->m_report_filename,
+                 (this->m_started) ? std::ios_base::app : std::ios_base::out);
+    }
+
+    if(!this->m_started)
+    {
+        out << "{ " << std::endl;
+        out << "\"legend\":";
+        this->report_legend(out);
+        out << "," << std::endl;
+        out << "\"results\": [ " << std::endl;
+        this->m_started = true;
+    }
+    else if(this->m_nevents > 0 && !events.empty())
+    {
+        out << ", " << std::endl;
+    }
+
+    out << body.str();
+    this->m_nevents += events.size();
+
+    if(finalize)
+    {
+        out << "], " << std::endl;
+        this->report_leaks(out);
+        out << "," << std::endl;
+        this->report_tags(out, get_time_us());
+        out << "," << std::endl;
+        this->report_workspace_pools(out);
+        out << "}" << std::endl;
+        out.close();
     }
     else
     {
-        std::cerr << "ROCSPARSE MEMSTAT, address not found." << std::endl;
-        exit(1);
+        out.flush();
+    }
+}
+
+void memstat::report_leaks(std::ostream& out)
+{
+    out << "\"leaks\": [";
+    bool first = true;
+    for(auto& s : this->m_shards)
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for(const auto& f : s.live)
+        {
+            const auto& e = f.second;
+            if(!first)
+                out << "," << std::endl;
+            out << " { ";
+            out << "  \"index\": \"" << e.index << "\"";
+            out << ", "
+                << "  \"mode\": \"" << memstat_mode::to_string(e.mode) << "\""
+                << ", "
+                << "  \"op\"  : \"" << e.kind << "\""
+                << ", "
+                << "  \"nbytes\" : \"" << e.nbytes << "\""
+                << ", "
+                << "   \"tag\": \"" << relfilename(e.tag) << "\""
+                << " }";
+            first = false;
+        }
+    }
+    out << "]";
+}
+
+//
+// Statistics per allocation site. Tags of the same site can be distinct
+// literals in different translation units, they are merged by name.
+//
+void memstat::report_tags(std::ostream& out, double t)
+{
+    std::map<std::string, tag_stat> tags;
+    for(auto& s : this->m_shards)
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for(const auto& f : s.tags)
+        {
+            tag_stat&       ts = tags[relfilename(f.first)];
+            const tag_stat& e  = f.second;
+            ts.nallocs += e.nallocs;
+            ts.nfrees += e.nfrees;
+            ts.nbytes_live += e.nbytes_live;
+            ts.nbytes_peak += e.nbytes_peak;
+            ts.nbytes_total += e.nbytes_total;
+            for(size_t i = 0; i < nbins; ++i)
+            {
+                ts.histogram[i] += e.histogram[i];
+            }
+        }
+    }
+
+    const double seconds = (t - this->m_start_time) / 1e6;
+
+    out << "\"tags\": [";
+    bool first = true;
+    for(const auto& f : tags)
+    {
+        const tag_stat& e = f.second;
+        if(!first)
+            out << "," << std::endl;
+        out << " { ";
+        out << "  \"tag\": \"" << f.first << "\""
+            << ", "
+            << "  \"nallocs\": \"" << e.nallocs << "\""
+            << ", "
+            << "  \"nfrees\": \"" << e.nfrees << "\""
+            << ", "
+            << "  \"nbytes_live\": \"" << e.nbytes_live << "\""
+            << ", "
+            << "  \"nbytes_peak\": \"" << e.nbytes_peak << "\""
+            << ", "
+            << "  \"nbytes_total\": \"" << e.nbytes_total << "\""
+            << ", "
+            << "  \"allocs_per_s\": \"" << ((seconds > 0.0) ? e.nallocs / seconds : 0.0) << "\""
+            << ", "
+            << "  \"histogram\": {";
+        bool first_bin = true;
+        for(size_t i = 0; i < nbins; ++i)
+        {
+            if(e.histogram[i] > 0)
+            {
+                out << (first_bin ? " " : ", ") << "\"" << (size_t(1) << i) << "\": \""
+                    << e.histogram[i] << "\"";
+                first_bin = false;
+            }
+        }
+        out << " } }";
+        first = false;
     }
+    out << "]";
 }
 
-bool memstat::contains(void* address) const
+//
+// Counters of the workspace pools of the released handles.
+//
+void memstat::report_workspace_pools(std::ostream& out)
 {
-    return (m_map.find(address) != m_map.end());
+    std::lock_guard<std::mutex> lock(this->m_pools_mutex);
+    out << "\"workspace_pools\": [";
+    for(size_t i = 0; i < this->m_workspace_pools.size(); ++i)
+    {
+        const auto& p = this->m_workspace_pools[i];
+        if(i > 0)
+            out << "," << std::endl;
+        out << " { ";
+        out << "  \"nrequests\": \"" << p.nrequests << "\""
+            << ", "
+            << "  \"nhits\": \"" << p.nhits << "\""
+            << ", "
+            << "  \"nreleases\": \"" << p.nreleases << "\""
+            << ", "
+            << "  \"nbytes_in_use\": \"" << p.nbytes_in_use << "\""
+            << ", "
+            << "  \"nbytes_cached\": \"" << p.nbytes_cached << "\""
+            << ", "
+            << "  \"nbytes_high_water\": \"" << p.nbytes_high_water << "\""
+            << " }";
+    }
+    out << "]";
 }
 
 //
 // Flush lines.
 //
-void memstat::report(std::ostream& out) const
+void memstat::report(std::ostream& out, const std::vector<stat>& events) const
 {
-    for(int i = 0; i < m_data.size(); ++i)
+    for(size_t i = 0; i < events.size(); ++i)
     {
         if(i > 0)
             out << "," << std::endl;
         out << " { ";
-        out << "  \"index\": \"" << m_data[i].index << "\"";
+        out << "  \"index\": \"" << events[i].index << "\"";
         out << ", "
-            << " \"time\": \"" << (m_data[i].t - m_start_time) / 1e3 << "\"";
+            << " \"time\": \"" << (events[i].t - m_start_time) / 1e3 << "\"";
         for(auto v : memstat_mode::all)
         {
             out << ", "
                 << "\"nbytes_" << memstat_mode::to_string(v) << "\" : \""
-                << m_data[i].total_nbytes[v] << "\"";
+                << events[i].total_nbytes[v] << "\"";
         }
         out << ", "
-            << "  \"mode\": \"" << memstat_mode::to_string(m_data[i].mode) << "\""
+            << "  \"mode\": \"" << memstat_mode::to_string(events[i].mode) << "\""
             << ", "
-            << "  \"op\"  : \"" << m_data[i].kind << "\""
+            << "  \"op\"  : \"" << events[i].kind << "\""
             << ", "
-            << "  \"nbytes\" : \"" << m_data[i].nbytes << "\""
+            << "  \"nbytes\" : \"" << events[i].nbytes << "\""
             << ", "
-            << "   \"tag\": \"" << relfilename(m_data[i].tag) << "\""
+            << "   \"tag\": \"" << relfilename(events[i].tag) << "\""
             << " }";
     }
 }
@@ -1027,6 +1289,14 @@ void memstat::report_legend(std::ostream& out) const
     out << " ]";
 }
 
+void rocsparse_memstat_workspace_pool(const rocsparse_workspace_pool::stats_t& stats)
+{
+    if(memstat::s_enabled)
+    {
+        memstat::instance().add_workspace_pool(stats);
+    }
+}
+
 extern "C" {
 
 hipError_t rocsparse_hip_free(void* mem, const char* tag)
@@ -0,0 +1,702 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "profile.h"
+#include "definitions.h"
+#include "handle.h"
+#include "profile_models.h"
+
+#include <sstream>
+
+/*******************************************************************************
+ * Profile
+ ******************************************************************************/
+//
+// Pending calls are resolved by waiting on the oldest events, once the
+// device falls that far behind.
+//
+static constexpr size_t rocsparse_profile_max_pending = 1024;
+
+rocsparse_profile::~rocsparse_profile()
+{
+    for(auto& pending : this->m_pending)
+    {
+        this->m_events.push_back(pending.start);
+        this->m_events.push_back(pending.stop);
+    }
+
+    for(auto event : this->m_events)
+    {
+        hipEventDestroy(event);
+    }
+}
+
+rocsparse_status rocsparse_profile::acquire_events(hipEvent_t* start, hipEvent_t* stop)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    while(this->m_events.size() < 2)
+    {
+        hipEvent_t event;
+        RETURN_IF_HIP_ERROR(hipEventCreate(&event));
+        this->m_events.push_back(event);
+    }
+
+    *stop = this->m_events.back();
+    this->m_events.pop_back();
+    *start = this->m_events.back();
+    this->m_events.pop_back();
+
+    return rocsparse_status_success;
+}
+
+void rocsparse_profile::release_events(hipEvent_t start, hipEvent_t stop)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    this->m_events.push_back(start);
+    this->m_events.push_back(stop);
+}
+
+void rocsparse_profile::record(const char*                    name,
+                               const rocsparse_profile_model& model,
+                               double                         host_time,
+                               hipEvent_t                     start,
+                               hipEvent_t                     stop)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    stats_t& stats = this->m_stats[std::make_pair(std::string(name),
+                                                  std::string(model.stage ? model.stage : ""))];
+
+    if(stats.ncalls == 0 || host_time < stats.host_time_min)
+    {
+        stats.host_time_min = host_time;
+    }
+
+    if(stats.ncalls == 0 || host_time > stats.host_time_max)
+    {
+        stats.host_time_max = host_time;
+    }
+
+    ++stats.ncalls;
+    stats.host_time_total += host_time;
+    stats.flops += model.flops;
+    stats.bytes += model.bytes;
+
+    if(start != nullptr)
+    {
+        this->m_pending.push_back({&stats, start, stop});
+    }
+
+    this->resolve(this->m_pending.size() >= rocsparse_profile_max_pending);
+}
+
+void rocsparse_profile::resolve(bool wait)
+{
+    size_t nresolved = 0;
+
+    for(auto& pending : this->m_pending)
+    {
+        if(wait)
+        {
+            hipEventSynchronize(pending.stop);
+        }
+        else if(hipEventQuery(pending.stop) != hipSuccess)
+        {
+            break;
+        }
+
+        float ms;
+        if(hipEventElapsedTime(&ms, pending.start, pending.stop) == hipSuccess)
+        {
+            stats_t&     stats       = *pending.stats;
+            const double device_time = 1e3 * ms;
+
+            if(stats.ndevice_calls == 0 || device_time < stats.device_time_min)
+            {
+                stats.device_time_min = device_time;
+            }
+
+            if(stats.ndevice_calls == 0 || device_time > stats.device_time_max)
+            {
+                stats.device_time_max = device_time;
+            }
+
+            ++stats.ndevice_calls;
+            stats.device_time_total += device_time;
+        }
+
+        this->m_events.push_back(pending.start);
+        this->m_events.push_back(pending.stop);
+        ++nresolved;
+    }
+
+    this->m_pending.erase(this->m_pending.begin(), this->m_pending.begin() + nresolved);
+}
+
+std::string rocsparse_profile::report(int device)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    this->resolve(true);
+
+    std::ostringstream out;
+    out << "{" << std::endl;
+    out << "  \"device\": " << device << "," << std::endl;
+    out << "  \"routines\": [";
+
+    bool first = true;
+    for(const auto& it : this->m_stats)
+    {
+        const stats_t& stats = it.second;
+
+        out << (first ? "" : ",") << std::endl;
+        out << "    {" << std::endl;
+        out << "      \"name\": \"" << it.first.first << "\"," << std::endl;
+        out << "      \"stage\": \"" << it.first.second << "\"," << std::endl;
+        out << "      \"calls\": " << stats.ncalls << "," << std::endl;
+        out << "      \"host_time_us\": {\"total\": " << stats.host_time_total
+            << ", \"min\": " << stats.host_time_min << ", \"max\": " << stats.host_time_max
+            << ", \"mean\": " << stats.host_time_total / stats.ncalls << "}," << std::endl;
+        out << "      \"device_calls\": " << stats.ndevice_calls << "," << std::endl;
+        out << "      \"device_time_us\": {\"total\": " << stats.device_time_total
+            << ", \"min\": " << stats.device_time_min << ", \"max\": " << stats.device_time_max
+            << ", \"mean\": "
+            << ((stats.ndevice_calls > 0) ? stats.device_time_total / stats.ndevice_calls : 0.0)
+            << "}," << std::endl;
+
+        // Rates are only meaningful if every call has been timed on the device
+        const bool   timed = stats.ndevice_calls == stats.ncalls && stats.device_time_total > 0.0;
+        const double gflop = stats.flops / 1e9;
+        const double gbyte = stats.bytes / 1e9;
+
+        out << "      \"gflop\": " << gflop << "," << std::endl;
+        out << "      \"gbyte\": " << gbyte << "," << std::endl;
+        out << "      \"gflop_per_s\": " << (timed ? gflop / (stats.device_time_total / 1e6) : 0.0)
+            << "," << std::endl;
+        out << "      \"gbyte_per_s\": " << (timed ? gbyte / (stats.device_time_total / 1e6) : 0.0)
+            << std::endl;
+        out << "    }";
+
+        first = false;
+    }
+
+    out << std::endl << "  ]" << std::endl;
+    out << "}" << std::endl;
+
+    return out.str();
+}
+
+void rocsparse_profile::reset()
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    this->resolve(true);
+    this->m_stats.clear();
+}
+
+/*******************************************************************************
+ * Profile scope
+ ******************************************************************************/
+rocsparse_profile_scope::rocsparse_profile_scope(rocsparse_handle               handle,
+                                                 const char*                    name,
+                                                 const rocsparse_profile_model& model)
+{
+    if(handle == nullptr || handle->profile == nullptr)
+    {
+        return;
+    }
+
+    this->m_profile = handle->profile;
+    this->m_name    = name;
+    this->m_model   = model;
+    this->m_stream  = handle->stream;
+
+    // Events cannot be timed while the stream is captured into a graph
+    hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(this->m_stream, &capture) == hipSuccess
+       && capture == hipStreamCaptureStatusNone
+       && this->m_profile->acquire_events(&this->m_start, &this->m_stop)
+              == rocsparse_status_success)
+    {
+        if(hipEventRecord(this->m_start, this->m_stream) != hipSuccess)
+        {
+            this->m_profile->release_events(this->m_start, this->m_stop);
+            this->m_start = nullptr;
+            this->m_stop  = nullptr;
+        }
+    }
+
+    this->m_begin = std::chrono::high_resolution_clock::now();
+}
+
+rocsparse_profile_scope::~rocsparse_profile_scope()
+{
+    if(this->m_profile == nullptr)
+    {
+        return;
+    }
+
+    const double host_time = std::chrono::duration<double, std::micro>(
+                                 std::chrono::high_resolution_clock::now() - this->m_begin)
+                                 .count();
+
+    if(this->m_start != nullptr && hipEventRecord(this->m_stop, this->m_stream) != hipSuccess)
+    {
+        this->m_profile->release_events(this->m_start, this->m_stop);
+        this->m_start = nullptr;
+        this->m_stop  = nullptr;
+    }
+
+    try
+    {
+        this->m_profile->record(
+            this->m_name, this->m_model, host_time, this->m_start, this->m_stop);
+    }
+    catch(...)
+    {
+        // Profiling must never alter the status of the routine
+    }
+}
+
+/*******************************************************************************
+ * Models
+ ******************************************************************************/
+namespace
+{
+    double sizeof_datatype(rocsparse_datatype type)
+    {
+        switch(type)
+        {
+        case rocsparse_datatype_i8_r:
+        case rocsparse_datatype_u8_r:
+            return 1.0;
+        case rocsparse_datatype_f32_r:
+        case rocsparse_datatype_i32_r:
+        case rocsparse_datatype_u32_r:
+            return 4.0;
+        case rocsparse_datatype_f64_r:
+        case rocsparse_datatype_f32_c:
+            return 8.0;
+        case rocsparse_datatype_f64_c:
+            return 16.0;
+        }
+        return 0.0;
+    }
+
+    double sizeof_indextype(rocsparse_indextype type)
+    {
+        switch(type)
+        {
+        case rocsparse_indextype_u16:
+            return 2.0;
+        case rocsparse_indextype_i32:
+            return 4.0;
+        case rocsparse_indextype_i64:
+            return 8.0;
+        }
+        return 0.0;
+    }
+
+    //
+    // Number of stored entries of a sparse matrix.
+    //
+    double spmat_entries(rocsparse_const_spmat_descr mat)
+    {
+        switch(mat->format)
+        {
+        case rocsparse_format_coo:
+        case rocsparse_format_coo_aos:
+        case rocsparse_format_csr:
+        case rocsparse_format_csc:
+            return double(mat->nnz);
+        case rocsparse_format_ell:
+            return double(mat->rows) * mat->ell_width;
+        case rocsparse_format_bell:
+            return double(mat->rows) * mat->ell_cols * mat->block_dim;
+        case rocsparse_format_bsr:
+            return double(mat->nnz) * mat->block_dim * mat->block_dim;
+        }
+        return 0.0;
+    }
+
+    //
+    // Bytes of the sparsity pattern of a sparse matrix.
+    //
+    double spmat_index_bytes(rocsparse_const_spmat_descr mat)
+    {
+        const double row_size = sizeof_indextype(mat->row_type);
+        const double col_size = sizeof_indextype(mat->col_type);
+
+        switch(mat->format)
+        {
+        case rocsparse_format_coo:
+        case rocsparse_format_coo_aos:
+            return double(mat->nnz) * (row_size + col_size);
+        case rocsparse_format_csr:
+        case rocsparse_format_bsr:
+            return (mat->rows + 1.0) * row_size + double(mat->nnz) * col_size;
+        case rocsparse_format_csc:
+            return (mat->cols + 1.0) * col_size + double(mat->nnz) * row_size;
+        case rocsparse_format_ell:
+            return double(mat->rows) * mat->ell_width * col_size;
+        case rocsparse_format_bell:
+            return double(mat->rows) / mat->block_dim * mat->ell_cols * col_size;
+        }
+        return 0.0;
+    }
+
+    double spmat_value_bytes(rocsparse_const_spmat_descr mat)
+    {
+        return spmat_entries(mat) * sizeof_datatype(mat->data_type);
+    }
+
+    double dnvec_bytes(rocsparse_const_dnvec_descr vec)
+    {
+        return double(vec->size) * sizeof_datatype(vec->data_type);
+    }
+
+    double dnmat_bytes(rocsparse_const_dnmat_descr mat)
+    {
+        return double(mat->rows) * mat->cols * sizeof_datatype(mat->data_type);
+    }
+
+    const char stage_buffer_size[] = "buffer_size";
+    const char stage_preprocess[]  = "preprocess";
+    const char stage_compute[]     = "compute";
+
+    //
+    // Stage name of the SpMV, SpSV, SpMM and SpSM stages, auto stages are
+    // either a buffer size query or a compute.
+    //
+    template <typename S>
+    const char* stage_name(S stage, const void* temp_buffer)
+    {
+        switch(stage)
+        {
+        case S(0):
+            return (temp_buffer == nullptr) ? stage_buffer_size : stage_compute;
+        case S(1):
+            return stage_buffer_size;
+        case S(2):
+            return stage_preprocess;
+        case S(3):
+            return stage_compute;
+        }
+        return "";
+    }
+}
+
+rocsparse_profile_model rocsparse_profile_models::spmv(rocsparse_const_spmat_descr mat,
+                                                       rocsparse_const_dnvec_descr x,
+                                                       rocsparse_const_dnvec_descr y,
+                                                       rocsparse_spmv_stage        stage,
+                                                       const void*                 temp_buffer)
+{
+    rocsparse_profile_model model;
+    model.stage = stage_name(stage, temp_buffer);
+
+    if(model.stage != stage_compute)
+    {
+        return model;
+    }
+
+    // y = alpha * op(A) * x + beta * y, all batches share the sparsity pattern. The
+    // value of beta is not known on the host, y is assumed to be read.
+    const double batch_count = double(y->batch_count);
+
+    model.flops = batch_count * rocsparse_spmv_flops(y->size, spmat_entries(mat), true);
+    model.bytes = rocsparse_spmv_bytes(spmat_index_bytes(mat),
+                                       batch_count * spmat_value_bytes(mat),
+                                       batch_count * dnvec_bytes(x),
+                                       batch_count * dnvec_bytes(y),
+                                       true);
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::spmv_fused(rocsparse_const_spmat_descr mat,
+                                                             rocsparse_const_dnvec_descr x,
+                                                             rocsparse_const_dnvec_descr y,
+                                                             rocsparse_const_dnvec_descr z,
+                                                             rocsparse_const_dnvec_descr w,
+                                                             rocsparse_spmv_stage        stage,
+                                                             const void* temp_buffer)
+{
+    rocsparse_profile_model model = spmv(mat, x, y, stage, temp_buffer);
+
+    if(model.stage != stage_compute)
+    {
+        return model;
+    }
+
+    // dot = z^H * y, y is read once by the fused kernel
+    if(z != nullptr)
+    {
+        model.flops += 2.0 * y->size;
+        model.bytes += dnvec_bytes(z);
+    }
+
+    // w = gamma * y + delta * w
+    if(w != nullptr)
+    {
+        model.flops += 3.0 * w->size;
+        model.bytes += 2.0 * dnvec_bytes(w);
+    }
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::spsv(rocsparse_const_spmat_descr mat,
+                                                       rocsparse_const_dnvec_descr x,
+                                                       rocsparse_const_dnvec_descr y,
+                                                       rocsparse_spsv_stage        stage,
+                                                       const void*                 temp_buffer)
+{
+    rocsparse_profile_model model;
+    model.stage = stage_name(stage, temp_buffer);
+
+    if(model.stage != stage_compute)
+    {
+        return model;
+    }
+
+    // op(A) * y = alpha * x, solved for each batch
+    const bool   non_unit    = mat->descr->diag_type == rocsparse_diag_type_non_unit;
+    const double batch_count = double(y->batch_count);
+
+    model.flops = batch_count * rocsparse_spsv_flops(y->size, spmat_entries(mat), non_unit);
+    model.bytes = rocsparse_spsv_bytes(spmat_index_bytes(mat),
+                                       batch_count * spmat_value_bytes(mat),
+                                       batch_count * dnvec_bytes(x),
+                                       batch_count * dnvec_bytes(y));
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::spmm(rocsparse_const_spmat_descr mat_A,
+                                                       rocsparse_const_dnmat_descr mat_B,
+                                                       rocsparse_const_dnmat_descr mat_C,
+                                                       rocsparse_spmm_stage        stage,
+                                                       const void*                 temp_buffer)
+{
+    rocsparse_profile_model model;
+    model.stage = stage_name(stage, temp_buffer);
+
+    if(model.stage != stage_compute)
+    {
+        return model;
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C, C is assumed to be read
+    const double batch_count = double(mat_C->batch_count);
+    const double nnz_C       = double(mat_C->rows) * mat_C->cols;
+
+    model.flops
+        = batch_count * rocsparse_spmm_flops(mat_C->cols, spmat_entries(mat_A), nnz_C, true);
+    model.bytes = rocsparse_spmm_bytes(spmat_index_bytes(mat_A),
+                                       batch_count * spmat_value_bytes(mat_A),
+                                       batch_count * dnmat_bytes(mat_B),
+                                       batch_count * dnmat_bytes(mat_C),
+                                       true);
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::spsm(rocsparse_const_spmat_descr matA,
+                                                       rocsparse_const_dnmat_descr matB,
+                                                       rocsparse_const_dnmat_descr matC,
+                                                       rocsparse_spsm_stage        stage,
+                                                       const void*                 temp_buffer)
+{
+    rocsparse_profile_model model;
+    model.stage = stage_name(stage, temp_buffer);
+
+    if(model.stage != stage_compute)
+    {
+        return model;
+    }
+
+    // op(A) * C = alpha * op(B), solved for each right-hand side and batch
+    const bool   non_unit    = matA->descr->diag_type == rocsparse_diag_type_non_unit;
+    const double batch_count = double(matC->batch_count);
+    const double m           = double(matA->rows);
+    const double nrhs        = double(matC->rows) * matC->cols / (m > 0.0 ? m : 1.0);
+
+    model.flops = batch_count * rocsparse_spsm_flops(m, nrhs, spmat_entries(matA), non_unit);
+    model.bytes = rocsparse_spsm_bytes(spmat_index_bytes(matA),
+                                       batch_count * spmat_value_bytes(matA),
+                                       batch_count * dnmat_bytes(matB),
+                                       batch_count * dnmat_bytes(matC));
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::sddmm(rocsparse_operation         opA,
+                                                        rocsparse_const_dnmat_descr A,
+                                                        rocsparse_const_dnmat_descr B,
+                                                        rocsparse_const_spmat_descr C)
+{
+    rocsparse_profile_model model;
+
+    // C = alpha * (op(A) * op(B)) o spy(C) + beta * C, C is assumed to be read
+    const double k     = double((opA == rocsparse_operation_none) ? A->cols : A->rows);
+    const double nnz_C = spmat_entries(C);
+
+    model.flops = rocsparse_sddmm_flops(nnz_C, k, true);
+    model.bytes = rocsparse_sddmm_bytes(
+        spmat_index_bytes(C), nnz_C, k, sizeof_datatype(C->data_type), true);
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::spgemm(rocsparse_const_spmat_descr A,
+                                                         rocsparse_const_spmat_descr B,
+                                                         rocsparse_const_spmat_descr D,
+                                                         rocsparse_const_spmat_descr C,
+                                                         rocsparse_spgemm_stage      stage)
+{
+    rocsparse_profile_model model;
+
+    switch(stage)
+    {
+    case rocsparse_spgemm_stage_auto:
+        model.stage = "auto";
+        break;
+    case rocsparse_spgemm_stage_buffer_size:
+        model.stage = stage_buffer_size;
+        break;
+    case rocsparse_spgemm_stage_nnz:
+        model.stage = "nnz";
+        break;
+    case rocsparse_spgemm_stage_compute:
+        model.stage = stage_compute;
+        break;
+    case rocsparse_spgemm_stage_symbolic:
+        model.stage = "symbolic";
+        break;
+    case rocsparse_spgemm_stage_numeric:
+        model.stage = "numeric";
+        break;
+    }
+
+    if(stage != rocsparse_spgemm_stage_compute && stage != rocsparse_spgemm_stage_numeric)
+    {
+        return model;
+    }
+
+    // The number of intermediate products is not known without a symbolic
+    // pass, only the memory traffic of the operands is modelled
+    model.bytes = spmat_index_bytes(A) + spmat_value_bytes(A) + spmat_index_bytes(B)
+                  + spmat_value_bytes(B) + spmat_index_bytes(C) + spmat_value_bytes(C);
+
+    if(D != nullptr)
+    {
+        model.flops = spmat_entries(D);
+        model.bytes += spmat_index_bytes(D) + spmat_value_bytes(D);
+    }
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::spvv(rocsparse_const_spvec_descr x,
+                                                       rocsparse_const_dnvec_descr y,
+                                                       const void*                 temp_buffer)
+{
+    rocsparse_profile_model model;
+    model.stage = (temp_buffer == nullptr) ? stage_buffer_size : stage_compute;
+
+    if(model.stage != stage_compute)
+    {
+        return model;
+    }
+
+    // result = x^T * y, or x^H * y
+    model.flops = rocsparse_spvv_flops(x->nnz);
+    model.bytes = rocsparse_spvv_bytes(x->nnz,
+                                       sizeof_indextype(x->idx_type),
+                                       sizeof_datatype(x->data_type),
+                                       sizeof_datatype(y->data_type));
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::axpby(rocsparse_const_spvec_descr x,
+                                                        rocsparse_const_dnvec_descr y)
+{
+    rocsparse_profile_model model;
+
+    // y = alpha * x + beta * y
+    model.flops = rocsparse_axpby_flops(x->nnz);
+    model.bytes = rocsparse_axpby_bytes(x->nnz,
+                                        sizeof_indextype(x->idx_type),
+                                        sizeof_datatype(x->data_type),
+                                        sizeof_datatype(y->data_type));
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::gather(rocsparse_const_dnvec_descr y,
+                                                         rocsparse_const_spvec_descr x)
+{
+    rocsparse_profile_model model;
+
+    // x = y(x_ind)
+    model.bytes = rocsparse_gather_bytes(x->nnz,
+                                         sizeof_indextype(x->idx_type),
+                                         sizeof_datatype(x->data_type),
+                                         sizeof_datatype(y->data_type));
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::scatter(rocsparse_const_spvec_descr x,
+                                                          rocsparse_const_dnvec_descr y)
+{
+    rocsparse_profile_model model;
+
+    // y(x_ind) = x
+    model.bytes = rocsparse_scatter_bytes(x->nnz,
+                                          sizeof_indextype(x->idx_type),
+                                          sizeof_datatype(x->data_type),
+                                          sizeof_datatype(y->data_type));
+
+    return model;
+}
+
+rocsparse_profile_model rocsparse_profile_models::rot(rocsparse_const_spvec_descr x,
+                                                      rocsparse_const_dnvec_descr y)
+{
+    rocsparse_profile_model model;
+
+    // x = c * x + s * y(x_ind), y(x_ind) = c * y(x_ind) - s * x
+    model.flops = rocsparse_rot_flops(x->nnz);
+    model.bytes = rocsparse_rot_bytes(x->nnz,
+                                      sizeof_indextype(x->idx_type),
+                                      sizeof_datatype(x->data_type),
+                                      sizeof_datatype(y->data_type));
+
+    return model;
+}
@@ -0,0 +1,409 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+//
+// Trace file layout: header, followed by records.
+//
+struct rocsparse_trace_header
+{
+    char     magic[8]; // "RSPTRACE"
+    uint32_t version;
+    uint32_t record_size;
+};
+
+//
+// Single producer, single consumer ring of records. The producer is the
+// thread owning the ring, the consumer is the flusher. Once the owning thread
+// exits, the ring is retired and handed to the next new thread after it has
+// been drained.
+//
+struct rocsparse_trace_ring
+{
+    static constexpr uint64_t capacity = 4096;
+
+    std::atomic<uint64_t>  head{};
+    std::atomic<uint64_t>  tail{};
+    std::atomic<uint64_t>  dropped{};
+    std::atomic<bool>      retired{};
+    uint32_t               thread{};
+    rocsparse_trace_record records[capacity];
+};
+
+//
+// Ring of the calling thread, retired when the thread exits.
+//
+struct rocsparse_trace_local_ring
+{
+    std::shared_ptr<rocsparse_trace_ring> ring;
+
+    ~rocsparse_trace_local_ring()
+    {
+        if(this->ring != nullptr)
+        {
+            this->ring->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+//
+// Key of the string tables, which does not own the characters.
+//
+struct rocsparse_trace_string_ref
+{
+    const char* data;
+    size_t      size;
+
+    bool operator==(const rocsparse_trace_string_ref& that) const
+    {
+        return this->size == that.size && std::memcmp(this->data, that.data, this->size) == 0;
+    }
+};
+
+struct rocsparse_trace_string_hash
+{
+    size_t operator()(const rocsparse_trace_string_ref& s) const
+    {
+        // FNV-1a
+        uint64_t h = 14695981039346656037ULL;
+        for(size_t i = 0; i < s.size; ++i)
+        {
+            h = (h ^ static_cast<unsigned char>(s.data[i])) * 1099511628211ULL;
+        }
+        return static_cast<size_t>(h);
+    }
+};
+
+//
+// Strings owned by a table, the references in the table stay valid as the
+// storage never moves its elements.
+//
+struct rocsparse_trace_string_table
+{
+    std::deque<std::string>                                                           storage;
+    std::unordered_map<rocsparse_trace_string_ref, uint32_t, rocsparse_trace_string_hash> ids;
+
+    const uint32_t* find(const rocsparse_trace_string_ref& key) const
+    {
+        auto it = this->ids.find(key);
+        return (it != this->ids.end()) ? &it->second : nullptr;
+    }
+
+    void insert(const rocsparse_trace_string_ref& key, uint32_t id)
+    {
+        this->storage.emplace_back(key.data, key.size);
+        const std::string& s = this->storage.back();
+        this->ids.emplace(rocsparse_trace_string_ref{s.data(), s.size()}, id);
+    }
+};
+
+struct rocsparse_trace::impl
+{
+    std::chrono::steady_clock::time_point start_time{std::chrono::steady_clock::now()};
+
+    FILE* file{};
+
+    // Rings of the threads that recorded, and drained rings of exited threads.
+    std::mutex                                         rings_mutex;
+    std::vector<std::shared_ptr<rocsparse_trace_ring>> rings;
+    std::vector<std::shared_ptr<rocsparse_trace_ring>> free_rings;
+    uint32_t                                           nthreads{};
+
+    // String table and the definitions not yet written.
+    std::mutex                                    strings_mutex;
+    rocsparse_trace_string_table                  strings;
+    std::vector<std::pair<uint32_t, std::string>> pending_strings;
+
+    // Flusher.
+    std::mutex              flush_mutex;
+    std::condition_variable flush_cv;
+    bool                    stop{};
+    std::thread             flusher;
+
+    static constexpr std::chrono::milliseconds flush_period{10};
+
+    rocsparse_trace_ring& local_ring()
+    {
+        thread_local rocsparse_trace_local_ring local;
+        if(local.ring == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(this->rings_mutex);
+            if(this->free_rings.empty())
+            {
+                local.ring = std::make_shared<rocsparse_trace_ring>();
+            }
+            else
+            {
+                local.ring = std::move(this->free_rings.back());
+                this->free_rings.pop_back();
+                local.ring->retired.store(false, std::memory_order_relaxed);
+            }
+
+            local.ring->thread = this->nthreads++;
+            this->rings.push_back(local.ring);
+        }
+        return *local.ring;
+    }
+
+    void write_strings()
+    {
+        std::vector<std::pair<uint32_t, std::string>> pending;
+        {
+            std::lock_guard<std::mutex> lock(this->strings_mutex);
+            pending.swap(this->pending_strings);
+        }
+
+        static constexpr size_t max_len = sizeof(rocsparse_trace_record::args);
+        for(const auto& p : pending)
+        {
+            rocsparse_trace_record r{};
+            r.kind  = rocsparse_trace_record::kind_string;
+            r.id    = p.first;
+            r.nargs = static_cast<uint16_t>(std::min(p.second.size(), max_len));
+            std::memcpy(r.args, p.second.data(), r.nargs);
+            std::fwrite(&r, sizeof(r), 1, this->file);
+        }
+    }
+
+    void drain()
+    {
+        //
+        // Definitions first, the decoder does not rely on it though.
+        //
+        this->write_strings();
+
+        std::vector<std::shared_ptr<rocsparse_trace_ring>> rings;
+        {
+            std::lock_guard<std::mutex> lock(this->rings_mutex);
+            rings = this->rings;
+        }
+
+        for(auto& ring : rings)
+        {
+            const uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+            const uint64_t head = ring->head.load(std::memory_order_acquire);
+
+            for(uint64_t i = tail; i < head;)
+            {
+                // Contiguous part of the ring
+                const uint64_t begin = i % rocsparse_trace_ring::capacity;
+                const uint64_t count
+                    = std::min(head - i, rocsparse_trace_ring::capacity - begin);
+                std::fwrite(
+                    &ring->records[begin], sizeof(rocsparse_trace_record), count, this->file);
+                i += count;
+            }
+
+            ring->tail.store(head, std::memory_order_release);
+
+            const uint64_t dropped = ring->dropped.exchange(0, std::memory_order_relaxed);
+            if(dropped > 0)
+            {
+                rocsparse_trace_record r{};
+                r.kind     = rocsparse_trace_record::kind_dropped;
+                r.thread   = ring->thread;
+                r.nargs    = 1;
+                r.types[0] = rocsparse_trace_record::type_uint;
+                r.args[0]  = dropped;
+                std::fwrite(&r, sizeof(r), 1, this->file);
+            }
+        }
+
+        //
+        // Rings of exited threads are empty now, as their threads cannot record
+        // anymore once retired.
+        //
+        {
+            std::lock_guard<std::mutex> lock(this->rings_mutex);
+            for(auto it = this->rings.begin(); it != this->rings.end();)
+            {
+                rocsparse_trace_ring& ring = **it;
+                if(ring.retired.load(std::memory_order_acquire)
+                   && ring.head.load(std::memory_order_relaxed)
+                          == ring.tail.load(std::memory_order_relaxed)
+                   && ring.dropped.load(std::memory_order_relaxed) == 0)
+                {
+                    this->free_rings.push_back(std::move(*it));
+                    it = this->rings.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        std::fflush(this->file);
+    }
+
+    void flush_loop()
+    {
+        std::unique_lock<std::mutex> lock(this->flush_mutex);
+        while(!this->stop)
+        {
+            this->flush_cv.wait_for(lock, flush_period);
+            this->drain();
+        }
+    }
+};
+
+constexpr std::chrono::milliseconds rocsparse_trace::impl::flush_period;
+
+rocsparse_trace& rocsparse_trace::instance()
+{
+    static rocsparse_trace trace;
+    return trace;
+}
+
+rocsparse_trace::rocsparse_trace()
+    : m_impl(new impl)
+{
+}
+
+rocsparse_trace::~rocsparse_trace()
+{
+    if(this->m_started)
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->m_impl->flush_mutex);
+            this->m_impl->stop = true;
+        }
+        this->m_impl->flush_cv.notify_one();
+        this->m_impl->flusher.join();
+
+        // Records of the last period
+        this->m_impl->drain();
+        std::fclose(this->m_impl->file);
+    }
+    delete this->m_impl;
+}
+
+void rocsparse_trace::start(const std::string& filename)
+{
+    static std::once_flag flag;
+    std::call_once(flag, [this, &filename]() {
+        const char* path = filename.empty() ? "rocsparse_trace.bin" : filename.c_str();
+
+        this->m_impl->file = std::fopen(path, "wb");
+        if(this->m_impl->file == nullptr)
+        {
+            std::cerr << "rocsparse error: cannot open binary trace file '" << path << "'"
+                      << std::endl;
+            return;
+        }
+
+        const rocsparse_trace_header header{
+            {'R', 'S', 'P', 'T', 'R', 'A', 'C', 'E'}, 1, sizeof(rocsparse_trace_record)};
+        std::fwrite(&header, sizeof(header), 1, this->m_impl->file);
+
+        this->m_impl->flusher = std::thread([this]() { this->m_impl->flush_loop(); });
+        this->m_started.store(true, std::memory_order_release);
+    });
+}
+
+uint64_t rocsparse_trace::timestamp() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+                                                                - this->m_impl->start_time)
+        .count();
+}
+
+uint32_t rocsparse_trace::intern(const char* str, size_t len)
+{
+    //
+    // Per thread cache, such that the table lock is only taken once per string.
+    //
+    thread_local rocsparse_trace_string_table cache;
+
+    // Nothing is allocated, unless the string is new to the thread
+    const rocsparse_trace_string_ref key{str, len};
+    const uint32_t*                  cached = cache.find(key);
+    if(cached != nullptr)
+    {
+        return *cached;
+    }
+
+    uint32_t id;
+    {
+        std::lock_guard<std::mutex> lock(this->m_impl->strings_mutex);
+        const uint32_t*             known = this->m_impl->strings.find(key);
+        if(known != nullptr)
+        {
+            id = *known;
+        }
+        else
+        {
+            id = static_cast<uint32_t>(this->m_impl->strings.storage.size());
+            this->m_impl->strings.insert(key, id);
+            this->m_impl->pending_strings.emplace_back(id, std::string(str, len));
+        }
+    }
+
+    cache.insert(key, id);
+    return id;
+}
+
+rocsparse_trace_record* rocsparse_trace::acquire()
+{
+    rocsparse_trace_ring& ring = this->m_impl->local_ring();
+
+    const uint64_t head = ring.head.load(std::memory_order_relaxed);
+    if(head - ring.tail.load(std::memory_order_acquire) >= rocsparse_trace_ring::capacity)
+    {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    rocsparse_trace_record* record = &ring.records[head % rocsparse_trace_ring::capacity];
+    record->thread                 = ring.thread;
+    return record;
+}
+
+void rocsparse_trace::commit()
+{
+    rocsparse_trace_ring& ring = this->m_impl->local_ring();
+
+    const uint64_t head = ring.head.load(std::memory_order_relaxed) + 1;
+    ring.head.store(head, std::memory_order_release);
+
+    // Wake up the flusher early when the ring fills up
+    if(head - ring.tail.load(std::memory_order_relaxed) == rocsparse_trace_ring::capacity / 2)
+    {
+        this->m_impl->flush_cv.notify_one();
+    }
+}
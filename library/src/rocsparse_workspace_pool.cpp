@@ -0,0 +1,571 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "workspace_pool.h"
+
+#include <algorithm>
+#include <shared_mutex>
+#include <utility>
+
+//
+// Pools of the streams, and owners of the blocks handed out by the pools.
+//
+struct rocsparse_workspace_pool_registry
+{
+    //
+    // The owners are split into shards, such that releasing a block only contends with
+    // the blocks of the same shard.
+    //
+    static constexpr size_t nshards = 64;
+
+    struct shard_t
+    {
+        std::mutex                                                         mutex;
+        std::unordered_map<void*, std::weak_ptr<rocsparse_workspace_pool>> owners;
+    };
+
+    std::shared_timed_mutex mutex;
+    std::map<std::pair<int, hipStream_t>, std::weak_ptr<rocsparse_workspace_pool>> pools;
+
+    shard_t shards[nshards];
+
+    static rocsparse_workspace_pool_registry& instance()
+    {
+        //
+        // Never destroyed, such that handles can be released during static destruction.
+        //
+        static rocsparse_workspace_pool_registry* registry
+            = new rocsparse_workspace_pool_registry;
+        return *registry;
+    }
+
+    shard_t& shard(void* mem)
+    {
+        // Blocks are aligned to at least 256 bytes
+        return this->shards[(reinterpret_cast<uintptr_t>(mem) >> 8) % nshards];
+    }
+
+    //
+    // Pool of the stream on the current device, if any.
+    //
+    std::shared_ptr<rocsparse_workspace_pool> find(hipStream_t stream)
+    {
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return nullptr;
+        }
+
+        std::shared_lock<std::shared_timed_mutex> lock(this->mutex);
+        auto it = this->pools.find(std::make_pair(device, stream));
+        return (it != this->pools.end()) ? it->second.lock() : nullptr;
+    }
+
+    //
+    // Pool of the null stream on the current device, or any other pool of the device.
+    //
+    std::shared_ptr<rocsparse_workspace_pool> find_any()
+    {
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return nullptr;
+        }
+
+        std::shared_lock<std::shared_timed_mutex> lock(this->mutex);
+        for(auto it = this->pools.lower_bound(std::make_pair(device, hipStream_t(nullptr)));
+            it != this->pools.end() && it->first.first == device;
+            ++it)
+        {
+            std::shared_ptr<rocsparse_workspace_pool> pool = it->second.lock();
+            if(pool != nullptr)
+            {
+                return pool;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void add_owner(void* mem, const std::shared_ptr<rocsparse_workspace_pool>& pool)
+    {
+        shard_t&                    s = this->shard(mem);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.owners[mem] = pool;
+    }
+
+    //
+    // Remove the owner of a block, returns the pool if it is still alive.
+    //
+    std::shared_ptr<rocsparse_workspace_pool> release_owner(void* mem)
+    {
+        shard_t&                    s = this->shard(mem);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        auto                        it = s.owners.find(mem);
+        if(it == s.owners.end())
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<rocsparse_workspace_pool> pool = it->second.lock();
+        s.owners.erase(it);
+        return pool;
+    }
+};
+
+static hipError_t device_malloc_async(void** mem, size_t nbytes, hipStream_t stream)
+{
+#if HIP_VERSION >= 50300000
+    return hipMallocAsync(mem, nbytes, stream);
+#else
+    return hipMalloc(mem, nbytes);
+#endif
+}
+
+static hipError_t device_free_async(void* mem, hipStream_t stream)
+{
+#if HIP_VERSION >= 50300000
+    return hipFreeAsync(mem, stream);
+#else
+    return hipFree(mem);
+#endif
+}
+
+rocsparse_workspace_pool::rocsparse_workspace_pool(int         device,
+                                                   hipStream_t stream,
+                                                   size_t      release_threshold)
+    : m_device(device)
+    , m_stream(stream)
+    , m_release_threshold(release_threshold)
+{
+}
+
+rocsparse_workspace_pool::~rocsparse_workspace_pool()
+{
+    auto& registry = rocsparse_workspace_pool_registry::instance();
+
+    {
+        std::unique_lock<std::shared_timed_mutex> lock(registry.mutex);
+
+        // The stream might have been given a new pool in the meantime
+        auto it = registry.pools.find(std::make_pair(this->m_device, this->m_stream));
+        if(it != registry.pools.end() && it->second.expired())
+        {
+            registry.pools.erase(it);
+        }
+    }
+
+    // Blocks still in use are released to the device when they are freed
+    for(const auto& b : this->m_in_use)
+    {
+        registry.release_owner(b.first);
+    }
+
+#ifdef ROCSPARSE_WITH_MEMSTAT
+    rocsparse_memstat_workspace_pool(this->m_stats);
+#endif
+
+    // The streams might already be destroyed, release synchronously
+    for(const auto& b : this->m_cached)
+    {
+        hipEventSynchronize(b.second.event);
+        hipEventDestroy(b.second.event);
+        hipFree(b.second.ptr);
+    }
+}
+
+std::shared_ptr<rocsparse_workspace_pool>
+    rocsparse_workspace_pool::acquire(int device, hipStream_t stream, size_t release_threshold)
+{
+    auto& registry = rocsparse_workspace_pool_registry::instance();
+
+    std::unique_lock<std::shared_timed_mutex> lock(registry.mutex);
+
+    auto& entry = registry.pools[std::make_pair(device, stream)];
+
+    std::shared_ptr<rocsparse_workspace_pool> pool = entry.lock();
+    if(pool == nullptr)
+    {
+        pool  = std::make_shared<rocsparse_workspace_pool>(device, stream, release_threshold);
+        entry = pool;
+    }
+
+    return pool;
+}
+
+void rocsparse_workspace_pool::set_release_threshold(size_t nbytes)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_release_threshold = nbytes;
+}
+
+size_t rocsparse_workspace_pool::get_release_threshold() const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_release_threshold;
+}
+
+rocsparse_workspace_pool::stats_t rocsparse_workspace_pool::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_stats;
+}
+
+hipError_t rocsparse_workspace_pool::trim(size_t nbytes)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->release(nbytes);
+}
+
+size_t rocsparse_workspace_pool::size_class(size_t nbytes)
+{
+    //
+    // Powers of two from 256 bytes up to 1 MB, multiples of 2 MB beyond.
+    //
+    static constexpr size_t min_class   = 256;
+    static constexpr size_t large_class = size_t(1) << 20;
+    static constexpr size_t large_align = size_t(2) << 20;
+
+    if(nbytes <= large_class)
+    {
+        size_t c = min_class;
+        while(c < nbytes)
+        {
+            c <<= 1;
+        }
+        return c;
+    }
+
+    return ((nbytes - 1) / large_align + 1) * large_align;
+}
+
+hipError_t rocsparse_workspace_pool::allocate(void**      mem,
+                                              size_t      nbytes,
+                                              bool        stream_ordered,
+                                              hipStream_t stream)
+{
+    const size_t nbytes_class = size_class(nbytes);
+
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    ++this->m_stats.nrequests;
+
+    auto it = this->m_cached.find(nbytes_class);
+    if(it != this->m_cached.end())
+    {
+        block_t b = it->second;
+
+        //
+        // Wait for the last user of the block. A request on the stream the block has been
+        // released on is ordered after it already.
+        //
+        hipError_t err = hipSuccess;
+        if(stream_ordered == false)
+        {
+            err = hipEventSynchronize(b.event);
+        }
+        else if(stream != b.stream)
+        {
+            err = hipStreamWaitEvent(stream, b.event, 0);
+        }
+
+        if(err != hipSuccess)
+        {
+            return err;
+        }
+
+        this->m_cached.erase(it);
+
+        this->m_stats.nbytes_cached -= b.nbytes;
+        this->m_stats.nbytes_in_use += b.nbytes;
+        ++this->m_stats.nhits;
+
+        b.stream              = stream;
+        this->m_in_use[b.ptr] = b;
+        mem[0]                = b.ptr;
+        return hipSuccess;
+    }
+
+    hipError_t err = stream_ordered ? device_malloc_async(mem, nbytes_class, stream)
+                                    : hipMalloc(mem, nbytes_class);
+    if(err != hipSuccess)
+    {
+        //
+        // Give the cached memory back to the device and try again.
+        //
+        (void)hipGetLastError();
+        err = this->release(0);
+        if(err != hipSuccess)
+        {
+            return err;
+        }
+
+        if(stream_ordered)
+        {
+            err = device_malloc_async(mem, nbytes_class, stream);
+        }
+        else
+        {
+            // The blocks are released in order of the stream of the pool
+            err = hipStreamSynchronize(this->m_stream);
+            if(err != hipSuccess)
+            {
+                return err;
+            }
+
+            err = hipMalloc(mem, nbytes_class);
+        }
+
+        if(err != hipSuccess)
+        {
+            return err;
+        }
+    }
+
+    this->m_in_use[mem[0]] = {mem[0], nbytes_class, stream_ordered, stream, nullptr};
+    this->m_stats.nbytes_in_use += nbytes_class;
+    this->m_stats.nbytes_high_water
+        = std::max(this->m_stats.nbytes_high_water,
+                   this->m_stats.nbytes_in_use + this->m_stats.nbytes_cached);
+
+    return hipSuccess;
+}
+
+hipError_t rocsparse_workspace_pool::deallocate(void* mem, const hipStream_t* stream)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    auto it = this->m_in_use.find(mem);
+    if(it == this->m_in_use.end())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    block_t b = it->second;
+    this->m_in_use.erase(it);
+    this->m_stats.nbytes_in_use -= b.nbytes;
+
+    if(stream != nullptr)
+    {
+        b.stream = stream[0];
+    }
+
+    //
+    // Blocks released on another device go back to the device right away.
+    //
+    int device;
+    if(hipGetDevice(&device) != hipSuccess || device != this->m_device)
+    {
+        ++this->m_stats.nreleases;
+        return this->release_block(b, b.stream);
+    }
+
+    hipError_t err = hipSuccess;
+    if(b.event == nullptr)
+    {
+        err = hipEventCreateWithFlags(&b.event, hipEventDisableTiming);
+    }
+
+    //
+    // The block can be handed out again once the work queued on the stream so far is
+    // done, without synchronizing the device.
+    //
+    if(err == hipSuccess)
+    {
+        err = hipEventRecord(b.event, b.stream);
+    }
+
+    if(err != hipSuccess)
+    {
+        ++this->m_stats.nreleases;
+        (void)this->release_block(b, b.stream);
+        return err;
+    }
+
+    this->m_stats.nbytes_cached += b.nbytes;
+    this->m_cached.emplace(b.nbytes, b);
+
+    if(this->m_stats.nbytes_cached > this->m_release_threshold)
+    {
+        return this->release(this->m_release_threshold);
+    }
+
+    return hipSuccess;
+}
+
+hipError_t rocsparse_workspace_pool::release(size_t nbytes)
+{
+    //
+    // Largest blocks first. The stream of the pool is alive, as long as a handle
+    // holds the pool.
+    //
+    while(this->m_stats.nbytes_cached > nbytes && !this->m_cached.empty())
+    {
+        auto    it = std::prev(this->m_cached.end());
+        block_t b  = it->second;
+        this->m_cached.erase(it);
+
+        this->m_stats.nbytes_cached -= b.nbytes;
+        ++this->m_stats.nreleases;
+
+        hipError_t err = this->release_block(b, this->m_stream);
+        if(err != hipSuccess)
+        {
+            return err;
+        }
+    }
+
+    return hipSuccess;
+}
+
+hipError_t rocsparse_workspace_pool::release_block(const block_t& b, hipStream_t stream)
+{
+    //
+    // Blocks allocated in stream order are returned in order of the stream, once the
+    // last user of the block is done. hipFree synchronizes the device for the others.
+    //
+    hipError_t err = hipSuccess;
+    if(b.stream_ordered)
+    {
+        if(b.event != nullptr && b.stream != stream)
+        {
+            err = hipStreamWaitEvent(stream, b.event, 0);
+        }
+
+        if(err == hipSuccess)
+        {
+            err = device_free_async(b.ptr, stream);
+        }
+    }
+    else
+    {
+        err = hipFree(b.ptr);
+    }
+
+    if(b.event != nullptr)
+    {
+        hipError_t err_event = hipEventDestroy(b.event);
+        if(err == hipSuccess)
+        {
+            err = err_event;
+        }
+    }
+
+    return err;
+}
+
+hipError_t rocsparse_workspace_pool::malloc(void** mem, size_t nbytes)
+{
+    if(nbytes == 0)
+    {
+        return hipMalloc(mem, nbytes);
+    }
+
+    auto& registry = rocsparse_workspace_pool_registry::instance();
+
+    // Keeps the pool alive, even if the last handle holding it is destroyed concurrently
+    std::shared_ptr<rocsparse_workspace_pool> pool = registry.find_any();
+    if(pool == nullptr)
+    {
+        return hipMalloc(mem, nbytes);
+    }
+
+    //
+    // Synchronous requests are owned by the null stream, which is ordered after the
+    // work of all blocking streams as hipFree is.
+    //
+    hipError_t err = pool->allocate(mem, nbytes, false, nullptr);
+    if(err != hipSuccess)
+    {
+        return err;
+    }
+
+    registry.add_owner(mem[0], pool);
+    return hipSuccess;
+}
+
+hipError_t rocsparse_workspace_pool::free(void* mem)
+{
+    if(mem == nullptr)
+    {
+        return hipSuccess;
+    }
+
+    auto& registry = rocsparse_workspace_pool_registry::instance();
+
+    std::shared_ptr<rocsparse_workspace_pool> pool = registry.release_owner(mem);
+    if(pool == nullptr)
+    {
+        return hipFree(mem);
+    }
+
+    // Released in order of the stream owning the block
+    return pool->deallocate(mem, nullptr);
+}
+
+hipError_t rocsparse_workspace_pool::malloc_async(void** mem, size_t nbytes, hipStream_t stream)
+{
+    if(nbytes == 0)
+    {
+        return device_malloc_async(mem, nbytes, stream);
+    }
+
+    auto& registry = rocsparse_workspace_pool_registry::instance();
+
+    // Keeps the pool alive, even if the last handle holding it is destroyed concurrently
+    std::shared_ptr<rocsparse_workspace_pool> pool = registry.find(stream);
+    if(pool == nullptr)
+    {
+        return device_malloc_async(mem, nbytes, stream);
+    }
+
+    hipError_t err = pool->allocate(mem, nbytes, true, stream);
+    if(err != hipSuccess)
+    {
+        return err;
+    }
+
+    registry.add_owner(mem[0], pool);
+    return hipSuccess;
+}
+
+hipError_t rocsparse_workspace_pool::free_async(void* mem, hipStream_t stream)
+{
+    if(mem == nullptr)
+    {
+        return hipSuccess;
+    }
+
+    auto& registry = rocsparse_workspace_pool_registry::instance();
+
+    std::shared_ptr<rocsparse_workspace_pool> pool = registry.release_owner(mem);
+    if(pool == nullptr)
+    {
+        return device_free_async(mem, stream);
+    }
+
+    return pool->deallocate(mem, &stream);
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief profile_models.h defines the flop and byte models of the generic routines,
+ *  shared by the profiling layer and the client benchmarks.
+ *
+ *  All counts are plain numbers of floating point operations and bytes. Sizes of
+ *  index and value arrays are passed in bytes such that the models do not depend
+ *  on the index and data types of the operands. The flag \p beta states whether the
+ *  output is read, i.e. whether a non-zero beta is applied.
+ */
+
+#pragma once
+
+/*
+ * ===========================================================================
+ *    level 1 SPARSE
+ * ===========================================================================
+ */
+
+/*! \brief Flops of y = alpha * x + beta * y, x sparse with \p nnz entries. */
+constexpr double rocsparse_axpby_flops(double nnz)
+{
+    return 3.0 * nnz;
+}
+
+/*! \brief Bytes of y = alpha * x + beta * y, y is read and written at the indices of x. */
+constexpr double
+    rocsparse_axpby_bytes(double nnz, double index_size, double x_size, double y_size)
+{
+    return nnz * (index_size + x_size + 2.0 * y_size);
+}
+
+/*! \brief Flops of the dot product of a sparse and a dense vector. */
+constexpr double rocsparse_spvv_flops(double nnz)
+{
+    return 2.0 * nnz;
+}
+
+/*! \brief Bytes of the dot product of a sparse and a dense vector. */
+constexpr double
+    rocsparse_spvv_bytes(double nnz, double index_size, double x_size, double y_size)
+{
+    return nnz * (index_size + x_size + y_size);
+}
+
+/*! \brief Bytes of x = y(x_ind), also used for the scatter y(x_ind) = x. */
+constexpr double
+    rocsparse_gather_bytes(double nnz, double index_size, double x_size, double y_size)
+{
+    return nnz * (index_size + x_size + y_size);
+}
+
+/*! \brief Bytes of y(x_ind) = x. */
+constexpr double
+    rocsparse_scatter_bytes(double nnz, double index_size, double x_size, double y_size)
+{
+    return rocsparse_gather_bytes(nnz, index_size, x_size, y_size);
+}
+
+/*! \brief Flops of the Givens rotation of a sparse and a dense vector. */
+constexpr double rocsparse_rot_flops(double nnz)
+{
+    return 6.0 * nnz;
+}
+
+/*! \brief Bytes of the Givens rotation, x and y(x_ind) are read and written. */
+constexpr double
+    rocsparse_rot_bytes(double nnz, double index_size, double x_size, double y_size)
+{
+    return nnz * (index_size + 2.0 * x_size + 2.0 * y_size);
+}
+
+/*
+ * ===========================================================================
+ *    level 2 SPARSE
+ * ===========================================================================
+ */
+
+/*! \brief Flops of y = alpha * op(A) * x + beta * y, A with \p entries stored values. */
+constexpr double rocsparse_spmv_flops(double m, double entries, bool beta)
+{
+    return 2.0 * entries + (beta ? m : 0.0);
+}
+
+/*! \brief Bytes of y = alpha * op(A) * x + beta * y.
+ *
+ *  \p index_bytes and \p value_bytes are the sizes of the sparsity pattern and of
+ *  the values of A, \p x_bytes and \p y_bytes the sizes of the dense vectors.
+ */
+constexpr double rocsparse_spmv_bytes(
+    double index_bytes, double value_bytes, double x_bytes, double y_bytes, bool beta)
+{
+    return index_bytes + value_bytes + x_bytes + (beta ? 2.0 : 1.0) * y_bytes;
+}
+
+/*! \brief Flops of op(A) * y = alpha * x, A of size \p m with \p entries stored values. */
+constexpr double rocsparse_spsv_flops(double m, double entries, bool non_unit)
+{
+    return 2.0 * entries + m + (non_unit ? m : 0.0);
+}
+
+/*! \brief Bytes of op(A) * y = alpha * x. */
+constexpr double
+    rocsparse_spsv_bytes(double index_bytes, double value_bytes, double x_bytes, double y_bytes)
+{
+    return index_bytes + value_bytes + x_bytes + y_bytes;
+}
+
+/*
+ * ===========================================================================
+ *    level 3 SPARSE
+ * ===========================================================================
+ */
+
+/*! \brief Flops of C = alpha * op(A) * op(B) + beta * C, C with \p n columns and
+ *  \p nnz_C entries.
+ */
+constexpr double rocsparse_spmm_flops(double n, double entries_A, double nnz_C, bool beta)
+{
+    return 2.0 * entries_A * n + (beta ? nnz_C : 0.0);
+}
+
+/*! \brief Bytes of C = alpha * op(A) * op(B) + beta * C. */
+constexpr double rocsparse_spmm_bytes(
+    double index_bytes, double value_bytes, double B_bytes, double C_bytes, bool beta)
+{
+    return index_bytes + value_bytes + B_bytes + (beta ? 2.0 : 1.0) * C_bytes;
+}
+
+/*! \brief Flops of op(A) * C = alpha * op(B), solved for \p nrhs right-hand sides. */
+constexpr double rocsparse_spsm_flops(double m, double nrhs, double entries, bool non_unit)
+{
+    return nrhs * rocsparse_spsv_flops(m, entries, non_unit);
+}
+
+/*! \brief Bytes of op(A) * C = alpha * op(B). */
+constexpr double
+    rocsparse_spsm_bytes(double index_bytes, double value_bytes, double B_bytes, double C_bytes)
+{
+    return index_bytes + value_bytes + B_bytes + C_bytes;
+}
+
+/*! \brief Flops of C = alpha * (op(A) * op(B)) o spy(C) + beta * C, a dot product of
+ *  length \p k per entry of C.
+ */
+constexpr double rocsparse_sddmm_flops(double nnz, double k, bool beta)
+{
+    return nnz * (2.0 * k + (beta ? 2.0 : 0.0));
+}
+
+/*! \brief Bytes of the SDDMM, a row of op(A) and a column of op(B) are read per entry of C. */
+constexpr double
+    rocsparse_sddmm_bytes(double index_bytes, double nnz, double k, double value_size, bool beta)
+{
+    return index_bytes + nnz * (2.0 * k + (beta ? 1.0 : 0.0)) * value_size;
+}
@@ -364,7 +364,7 @@ try
     // Logging
     log_trace(handle,
               "rocsparse_check_spmat",
-              (const void*&)mat,
+              mat,
               (const void*&)data_status,
               stage,
               (const void*&)buffer_size,
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+
+# ########################################################################
+# Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+# ########################################################################
+
+#
+# Join the sparsity features written by rocsparse-features with the timings of
+# rocsparse-bench JSON files, and optionally fit per routine performance models.
+#
+# The join key is the matrix name, the 'import' column of rocsparse-bench, together
+# with M when both sides report it. The raw data of the timings is required, the
+# benchmarks must not be run with --bench-no-rawdata.
+#
+# Model: log(time) = c0 + sum_k c_k * log(1 + feature_k), least squares per routine.
+#
+
+import argparse
+import csv
+import json
+import math
+import sys
+
+def read_features(filenames):
+    features = {}
+    columns = []
+    for filename in filenames:
+        with open(filename, "r") as f:
+            for row in csv.DictReader(f):
+                if not columns:
+                    columns = [c for c in row.keys() if c != "name"]
+                features.setdefault(row["name"], []).append(row)
+    return features, columns
+
+def read_timings(filenames):
+    timings = []
+    for filename in filenames:
+        with open(filename, "r") as f:
+            case = json.load(f)
+        for result in case["results"]:
+            tg = result["timing"]
+            if "raw_legend" not in tg or "raw_data" not in tg:
+                print("//rocsparse-bench-features::warning no raw data in '" + filename + "', skipped.")
+                break
+            keys = tg["raw_legend"].split()
+            values = tg["raw_data"].split()
+            item = dict(zip(keys, values))
+            item["time"] = float(tg["time"][0])
+            item["cmdline"] = result["cmdline"]
+            timings.append(item)
+    return timings
+
+def join(features, timings):
+    joined = []
+    for item in timings:
+        name = item.get("import")
+        if name not in features:
+            continue
+        candidates = features[name]
+        if "M" in item:
+            matching = [c for c in candidates if c["m"] == item["M"]]
+            candidates = matching if matching else candidates
+        joined.append((item, candidates[0]))
+    return joined
+
+def fit(joined, columns):
+    try:
+        import numpy
+    except ImportError:
+        print("//rocsparse-bench-features::error numpy is required to fit models.")
+        sys.exit(1)
+
+    by_function = {}
+    for item, feature in joined:
+        by_function.setdefault(item.get("function", "unknown"), []).append((item, feature))
+
+    models = {}
+    for function, samples in sorted(by_function.items()):
+        if len(samples) <= len(columns):
+            print("//rocsparse-bench-features::warning not enough samples to fit '" + function + "' (" + str(len(samples)) + ")")
+            continue
+        A = numpy.array([[1.0] + [math.log1p(max(float(feature[c]), 0.0)) for c in columns] for _, feature in samples])
+        b = numpy.array([math.log(max(item["time"], 1e-12)) for item, _ in samples])
+        coefficients, _, _, _ = numpy.linalg.lstsq(A, b, rcond=None)
+        residual = A.dot(coefficients) - b
+        models[function] = {"samples": len(samples),
+                            "rmse_log_time": float(math.sqrt(numpy.mean(residual * residual))),
+                            "intercept": float(coefficients[0]),
+                            "coefficients": dict(zip(columns, [float(c) for c in coefficients[1:]]))}
+    return models
+
+def main():
+    parser = argparse.ArgumentParser(description="Join rocsparse-features output with rocsparse-bench timings.")
+    parser.add_argument('-f', '--features', required=True, nargs='+', help='CSV files written by rocsparse-features')
+    parser.add_argument('-o', '--output', required=False, default='features.csv', help='joined CSV output')
+    parser.add_argument('-m', '--model', required=False, default=None, help='fit per routine models and write them to this JSON file')
+    parser.add_argument('-c', '--columns', required=False, default=None, help='comma separated features used by the models (default: all)')
+    parser.add_argument('-v', '--verbose', required=False, default=False, action="store_true")
+    parser.add_argument('timings', nargs='+', help='JSON files written by rocsparse-bench')
+    user_args = parser.parse_args()
+
+    features, columns = read_features(user_args.features)
+    timings = read_timings(user_args.timings)
+    joined = join(features, timings)
+
+    if user_args.verbose:
+        print('//rocsparse-bench-features  - ' + str(len(timings)) + ' timings, ' + str(len(joined)) + ' joined')
+
+    with open(user_args.output, "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(["function", "name", "time"] + columns + ["cmdline"])
+        for item, feature in joined:
+            writer.writerow([item.get("function", ""), feature["name"], item["time"]] + [feature[c] for c in columns] + [item["cmdline"]])
+
+    if user_args.model is not None:
+        model_columns = user_args.columns.split(",") if user_args.columns else columns
+        unknown = [c for c in model_columns if c not in columns]
+        if unknown:
+            print("//rocsparse-bench-features::error unknown features " + ", ".join(unknown))
+            sys.exit(1)
+        models = fit(joined, model_columns)
+        with open(user_args.model, "w") as f:
+            json.dump(models, f, indent=2)
+
+if __name__ == "__main__":
+    main()
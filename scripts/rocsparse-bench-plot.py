@@ -38,10 +38,10 @@ import rocsparse_bench_gnuplot_helper
 
 #
 # EXPORT TO PDF WITH GNUPLOT
-# arg plot: "all", "gflops", "time", "bandwidth"
+# arg plot: "all", "gflops", "time", "bandwidth", "roofline"
 #
 #
-def export_gnuplot(plot, obasename,xargs, yargs, results,verbose = False,debug = False,linear=False):
+def export_gnuplot(plot, obasename,xargs, yargs, results,verbose = False,debug = False,linear=False,roofline=None):
 
     datafile = open(obasename + ".dat", "w+")
     len_xargs = len(xargs)
@@ -64,6 +64,15 @@ def export_gnuplot(plot, obasename,xargs, yargs, results,verbose = False,debug =
             bandwidth1 = max(float(tg["bandwidth"][1]), min_allowed_yvalue)
             bandwidth2 = max(float(tg["bandwidth"][2]), min_allowed_yvalue)
 
+            # Roofline, only exported by rocsparse-bench --roofline.
+            intensity = 0.0
+            bandwidth_fraction = 0.0
+            flops_fraction = 0.0
+            if "roofline" in tg:
+                intensity = float(tg["roofline"]["intensity"])
+                bandwidth_fraction = float(tg["roofline"]["bandwidth"])
+                flops_fraction = float(tg["roofline"]["flops"])
+
             datafile.write(os.path.basename(os.path.splitext(xargs[ixarg])[0]) + " " +
                            str(time0) + " " +
                            str(time1) + " " +
@@ -73,7 +82,10 @@ def export_gnuplot(plot, obasename,xargs, yargs, results,verbose = False,debug =
                            str(flops2) + " " +
                            str(bandwidth0) + " " +
                            str(bandwidth1) + " "+
-                           str(bandwidth2) + "\n")
+                           str(bandwidth2) + " " +
+                           str(intensity) + " " +
+                           str(bandwidth_fraction) + " " +
+                           str(flops_fraction) + "\n")
         datafile.write("\n")
         datafile.write("\n")
     datafile.close();
@@ -153,8 +165,16 @@ def export_gnuplot(plot, obasename,xargs, yargs, results,verbose = False,debug =
                                                  8,9,10,
                                                  yargs,
                                                  linear)
+
+        if roofline is not None:
+            export_roofline(cmdfile, obasename + "_roofline" + filename_extension, obasename, num_curves, yargs, roofline)
+    elif plot == "roofline":
+        if roofline is None:
+            print("//rocsparse-bench-plot::error no roofline data, run rocsparse-bench with --roofline")
+            exit(1)
+        export_roofline(cmdfile, obasename + filename_extension, obasename, num_curves, yargs, roofline)
     else:
-        print("//rocsparse-bench-plot::error invalid plot keyword '"+plot+"', must be 'all' (default), 'time', 'gflops' or 'bandwidth' ")
+        print("//rocsparse-bench-plot::error invalid plot keyword '"+plot+"', must be 'all' (default), 'time', 'gflops', 'bandwidth' or 'roofline' ")
         exit(1)
     cmdfile.close();
 
@@ -169,6 +189,19 @@ def export_gnuplot(plot, obasename,xargs, yargs, results,verbose = False,debug =
 
 
 
+def export_roofline(cmdfile, ofilename, obasename, num_curves, yargs, roofline):
+    rocsparse_bench_gnuplot_helper.roofline(cmdfile,
+                                            ofilename,
+                                            'Roofline',
+                                            range(num_curves),
+                                            obasename + ".dat",
+                                            11,5,
+                                            yargs,
+                                            float(roofline["bandwidth"]),
+                                            [["single", float(roofline["flops single"])],
+                                             ["double", float(roofline["flops double"])]])
+
+
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('-w', '--workingdir',     required=False, default = './')
@@ -193,6 +226,7 @@ def main():
     xargs = case['xargs']
     yargs = case['yargs']
     results = case['results']
+    roofline = case.get('roofline')
     num_samples = len(results)
     len_xargs = len(xargs)
 
@@ -200,7 +234,7 @@ def main():
         print('//rocsparse-bench-plot')
         print('//rocsparse-bench-plot  - file : \'' + unknown_args[0] + '\'')
 
-    export_gnuplot(plot, obasename, xargs,yargs, results, verbose, debug, linear)
+    export_gnuplot(plot, obasename, xargs,yargs, results, verbose, debug, linear, roofline)
 
 if __name__ == "__main__":
     main()
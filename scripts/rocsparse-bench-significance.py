@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+
+# ########################################################################
+# Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+# ########################################################################
+
+#
+# Statistical performance regression analysis of rocsparse-bench results.
+#
+# Unlike rocsparse-bench-regression.py, which compares the medians of two results against a
+# fixed tolerance, each case is analyzed from the time of every run, exported in the
+# 'samples' of the rocsparse-bench .json files:
+# - the candidate, the last result, is compared to the previous ones with a one-sided
+#   Mann-Whitney U test or a bootstrap of the ratio of the medians,
+# - change points are detected across the history of the case by binary segmentation,
+#   which reveals slow drifts invisible between two consecutive results.
+#
+# Results are either .json files given in chronological order, or the revisions of an
+# SQLite store of rocsparse-bench-sweep.py. Significant slowdowns are ranked by effect.
+#
+
+import argparse
+import json
+import math
+import os
+import random
+import socket
+import sqlite3
+import sys
+
+#
+# STATISTICS
+#
+def median(v):
+    s = sorted(v)
+    n = len(s)
+    return 0.5 * (s[n // 2 - 1] + s[n // 2]) if n % 2 == 0 else s[n // 2]
+
+def ranks(v):
+    # Ranks of the values, ties are given their average rank.
+    order = sorted(range(len(v)), key=lambda i: v[i])
+    r = [0.0] * len(v)
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and v[order[j + 1]] == v[order[i]]:
+            j += 1
+        for k in range(i, j + 1):
+            r[order[k]] = 0.5 * (i + j) + 1.0
+        i = j + 1
+    return r
+
+exact_counts = {}
+def exact_u_counts(n, m):
+    # Number of arrangements of n and m values for each value of the statistic U of m.
+    if (n, m) not in exact_counts:
+        if n == 0 or m == 0:
+            exact_counts[(n, m)] = [1]
+        else:
+            a = exact_u_counts(n - 1, m)
+            b = exact_u_counts(n, m - 1)
+            c = [0] * (n * m + 1)
+            for u in range(len(b)):
+                c[u] += b[u]
+            for u in range(len(a)):
+                c[u + m] += a[u]
+            exact_counts[(n, m)] = c
+    return exact_counts[(n, m)]
+
+def normal_sf(z):
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+#
+# One-sided Mann-Whitney U test, p-value of y being stochastically greater than x.
+# The distribution is exact for small samples without ties, approximated otherwise.
+#
+def mann_whitney(x, y):
+    n, m = len(x), len(y)
+    r = ranks(list(x) + list(y))
+    u = sum(r[n:]) - 0.5 * m * (m + 1)
+    ties = len(set(x) | set(y)) != n + m
+    if not ties and n <= 30 and m <= 30:
+        counts = exact_u_counts(n, m)
+        return sum(counts[int(math.ceil(u)):]) / float(sum(counts))
+
+    nm = n + m
+    tie_sum = 0.0
+    for t in set(list(x) + list(y)):
+        c = (list(x) + list(y)).count(t)
+        tie_sum += c ** 3 - c
+    variance = n * m / 12.0 * ((nm + 1) - tie_sum / (nm * (nm - 1)))
+    if variance <= 0.0:
+        return 1.0
+    return normal_sf((u - 0.5 * n * m - 0.5) / math.sqrt(variance))
+
+#
+# Bootstrap of the ratio of the medians, p-value of y not being slower than x.
+#
+def bootstrap(x, y, nboots, rng):
+    nslower = 0
+    for _ in range(nboots):
+        bx = [x[rng.randrange(len(x))] for _ in x]
+        by = [y[rng.randrange(len(y))] for _ in y]
+        if median(by) > median(bx):
+            nslower += 1
+    return (nboots - nslower + 1) / float(nboots + 1)
+
+def significance(x, y, user_args, rng):
+    if user_args.test == 'bootstrap':
+        return bootstrap(x, y, user_args.nboots, rng)
+    return mann_whitney(x, y)
+
+#
+# Change points of a history of results by binary segmentation: the split maximizing the
+# significance of the difference between its two sides is kept if it passes the test,
+# corrected for the number of candidate splits, and both sides are segmented again.
+#
+def change_points(history, alpha, min_effect, lo=0, hi=None):
+    hi = len(history) if hi is None else hi
+    if hi - lo < 2:
+        return []
+    best = None
+    for k in range(lo + 1, hi):
+        left = [t for h in history[lo:k] for t in h]
+        right = [t for h in history[k:hi] for t in h]
+        effect = median(right) / median(left) - 1.0
+        p = min(mann_whitney(left, right), mann_whitney(right, left))
+        if best is None or p < best[1]:
+            best = (k, p, effect)
+    k, p, effect = best
+    if p * (hi - lo - 1) >= alpha or abs(effect) < min_effect:
+        return []
+    return change_points(history, alpha, min_effect, lo, k) + [(k, p, effect)] \
+        + change_points(history, alpha, min_effect, k, hi)
+
+#
+# RESULTS
+#
+def sample_key(cmdline):
+    words = cmdline.split()[1:]
+    key = []
+    i = 0
+    while i < len(words):
+        if words[i] in ('-d', '--device'):
+            i += 2
+        else:
+            key.append(words[i])
+            i += 1
+    return ' '.join(key)
+
+def load_files(filenames):
+    labels = [os.path.basename(os.path.splitext(f)[0]) for f in filenames]
+    cases = {}
+    for index, filename in enumerate(filenames):
+        with open(filename, 'r') as f:
+            results = json.load(f)['results']
+        for result in results:
+            tg = result['timing']
+            samples = tg.get('samples', {}).get('time', [tg['time'][0]])
+            cases.setdefault(sample_key(result['cmdline']), {})[index] = [float(t) for t in samples]
+    return labels, cases
+
+def load_store(filename, host):
+    db = sqlite3.connect(filename)
+    labels = [r for (r,) in db.execute("SELECT rev FROM runs WHERE host = ? GROUP BY rev ORDER BY MIN(date)", (host,))]
+    cases = {}
+    for rev, key, samples, time in db.execute("SELECT runs.rev, results.sample_key, results.samples, results.time "
+                                              "FROM results JOIN runs ON results.run_id = runs.id "
+                                              "WHERE runs.host = ? AND runs.status = 0", (host,)):
+        values = json.loads(samples) if samples else [time]
+        cases.setdefault(key, {}).setdefault(labels.index(rev), []).extend(values)
+    return labels, cases
+
+#
+# ANALYSIS
+#
+def analyze(labels, cases, user_args):
+    rng = random.Random(user_args.seed)
+    candidate = len(labels) - 1
+    findings = []
+    nsmall = 0
+    for key in sorted(cases):
+        if user_args.filter not in key:
+            continue
+        case = cases[key]
+        indices = sorted(case)
+        if candidate not in case or len(indices) < 2:
+            continue
+
+        #
+        # Candidate against the pooled previous results.
+        #
+        baseline = [t for i in indices[:-1][-user_args.window:] for t in case[i]]
+        current = case[candidate]
+        if len(baseline) < 2 or len(current) < 2:
+            nsmall += 1
+        else:
+            effect = median(current) / median(baseline) - 1.0
+            p = significance(baseline, current, user_args, rng)
+            if p < user_args.alpha and effect > user_args.min_effect:
+                findings.append((effect, p, 'candidate', labels[candidate], key))
+
+        #
+        # Change points across the history, slowdowns only.
+        #
+        if len(indices) > 2:
+            history = [case[i] for i in indices]
+            for k, p, effect in change_points(history, user_args.alpha, user_args.min_effect):
+                if effect > 0.0:
+                    findings.append((effect, p, 'change-point', labels[indices[k]], key))
+
+    if nsmall > 0:
+        print('//rocsparse-bench-significance::warning ' + str(nsmall)
+              + ' cases without enough samples, run rocsparse-bench with --bench-n > 1.')
+    return sorted(findings, key=lambda f: (-f[0], f[1]))
+
+def main():
+    parser = argparse.ArgumentParser(formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     description="Rank the statistically significant slowdowns of rocsparse-bench results.")
+    parser.add_argument('files', nargs='*', help='.json results of rocsparse-bench, in chronological order, the last one is the candidate')
+    parser.add_argument('--db', required=False, default=None, help='SQLite store of rocsparse-bench-sweep.py, instead of files')
+    parser.add_argument('--host', required=False, default=None, help='host of the store (default: this host)')
+    parser.add_argument('--test', required=False, default='mann-whitney', choices=['mann-whitney', 'bootstrap'])
+    parser.add_argument('--alpha', required=False, type=float, default=0.01, help='significance level (default: 0.01)')
+    parser.add_argument('--min-effect', required=False, type=float, default=0.02,
+                        help='minimum relative slowdown to report (default: 0.02)')
+    parser.add_argument('--window', required=False, type=int, default=1,
+                        help='number of previous results the candidate is compared to (default: 1)')
+    parser.add_argument('--nboots', required=False, type=int, default=1000, help='bootstrap resamples (default: 1000)')
+    parser.add_argument('--seed', required=False, type=int, default=0)
+    parser.add_argument('-f', '--filter', required=False, default='', help='substring of the cases')
+    parser.add_argument('-v', '--verbose', required=False, default=False, action="store_true")
+    user_args = parser.parse_args()
+
+    if user_args.db:
+        labels, cases = load_store(user_args.db, user_args.host if user_args.host else socket.gethostname())
+    elif len(user_args.files) >= 2:
+        labels, cases = load_files(user_args.files)
+    else:
+        print('//rocsparse-bench-significance::error at least two .json files or a --db store are required.')
+        sys.exit(1)
+
+    if user_args.verbose:
+        print('//rocsparse-bench-significance ' + str(len(cases)) + ' cases, history: ' + ', '.join(labels))
+
+    findings = analyze(labels, cases, user_args)
+    print('{:>4} {:>9} {:>10} {:<13} {:<24} {}'.format('rank', 'slowdown', 'p-value', 'kind', 'from', 'case'))
+    for rank, (effect, p, kind, label, key) in enumerate(findings):
+        print('{:>4} {:>+8.1f}% {:>10.2e} {:<13} {:<24} {}'.format(rank + 1, effect * 100.0, p, kind, label, key))
+
+    #
+    # Fail on the slowdowns starting at the candidate.
+    #
+    failed = [f for f in findings if f[3] == labels[-1]]
+    print('//rocsparse-bench-significance ' + str(len(findings)) + ' significant slowdowns, '
+          + str(len(failed)) + ' from ' + labels[-1])
+    if failed:
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
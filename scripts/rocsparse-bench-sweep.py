@@ -0,0 +1,395 @@
+#!/usr/bin/env python3
+
+# ########################################################################
+# Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+# ########################################################################
+
+#
+# Sweep executor for rocsparse-bench.
+#
+# The 'run' command executes the 'cmdlines' of a .json file, as rocsparse-bench-execute.py
+# does, but:
+# - cmdlines are split into cases, one per value of the --bench-x option,
+# - cases are sharded across several rocsparse-bench processes and devices,
+# - each completed case is checkpointed into an SQLite result store keyed by
+#   (git revision, host, case), so an interrupted sweep resumes where it stopped.
+#
+# The 'history' and 'regress' commands query the store, the latter compares a revision
+# against the historic results of the previous ones.
+#
+
+import argparse
+import concurrent.futures
+import datetime
+import glob
+import hashlib
+import json
+import os
+import queue
+import socket
+import sqlite3
+import statistics
+import subprocess
+import sys
+
+DATA_DIR_VARIABLE = '${ROCSPARSE_BENCH_DATA_DIR}'
+
+SCHEMA = """
+CREATE TABLE IF NOT EXISTS runs(
+  id       INTEGER PRIMARY KEY,
+  rev      TEXT NOT NULL,
+  host     TEXT NOT NULL,
+  case_key TEXT NOT NULL,
+  device   INTEGER,
+  date     TEXT NOT NULL,
+  status   INTEGER NOT NULL,
+  UNIQUE(rev, host, case_key));
+
+CREATE TABLE IF NOT EXISTS results(
+  run_id         INTEGER NOT NULL REFERENCES runs(id) ON DELETE CASCADE,
+  sample_key     TEXT NOT NULL,
+  time           REAL,
+  time_low       REAL,
+  time_high      REAL,
+  flops          REAL,
+  flops_low      REAL,
+  flops_high     REAL,
+  bandwidth      REAL,
+  bandwidth_low  REAL,
+  bandwidth_high REAL,
+  raw_legend     TEXT,
+  raw_data       TEXT,
+  samples        TEXT);
+
+CREATE INDEX IF NOT EXISTS results_sample_key ON results(sample_key);
+"""
+
+def open_store(filename):
+    db = sqlite3.connect(filename)
+    db.execute("PRAGMA foreign_keys = ON")
+    db.executescript(SCHEMA)
+    return db
+
+#
+# CASES
+#
+def is_option(word):
+    return word.startswith('-')
+
+def expand_word(word, datadir):
+    w = word.replace(DATA_DIR_VARIABLE, datadir) if datadir else word
+    gw = sorted(glob.glob(w))
+    return gw if len(gw) != 0 else [w]
+
+def strip_option(words, names, nargs):
+    stripped = []
+    i = 0
+    while i < len(words):
+        if words[i] in names:
+            i += 1 + nargs
+        else:
+            stripped.append(words[i])
+            i += 1
+    return stripped
+
+#
+# Split a cmdline into cases, one per value of the --bench-x option. Cases are kept with the
+# data directory variable unexpanded, so that their keys do not depend on the host.
+#
+def split_cmdline(cmdline, datadir):
+    words = strip_option(cmdline.split(), ['--bench-o'], 1)
+    if '--bench-x' not in words:
+        # rocsparse-bench exports results only when --bench-x is present.
+        words = ['--bench-x'] + words
+
+    i = words.index('--bench-x')
+    if i + 1 >= len(words) or not is_option(words[i + 1]):
+        print("//rocsparse-bench-sweep::error wrong position of option --bench-x in '" + cmdline + "'")
+        sys.exit(1)
+
+    j = i + 2
+    while j < len(words) and not is_option(words[j]):
+        j += 1
+
+    values = []
+    for w in words[i + 2:j]:
+        for g in expand_word(w, datadir):
+            values.append(g.replace(datadir, DATA_DIR_VARIABLE, 1) if datadir and g.startswith(datadir) else g)
+
+    return [words[:i + 2] + [v] + words[j:] for v in values]
+
+def case_key(words):
+    return ' '.join(words)
+
+#
+# Key of a sample, its command line without the program name, device and data directory.
+#
+def sample_key(cmdline, datadir):
+    words = strip_option(cmdline.split()[1:], ['-d', '--device'], 1)
+    key = ' '.join(words)
+    if datadir:
+        key = key.replace(datadir, DATA_DIR_VARIABLE)
+    return key
+
+#
+# RUN
+#
+def run_case(prog, words, device, datadir, workdir, timeout):
+    name = hashlib.sha1(case_key(words).encode()).hexdigest()[:16]
+    ofilename = os.path.join(workdir, 'case_' + name + '.json')
+    logfilename = os.path.join(workdir, 'case_' + name + '.log')
+
+    args = [prog]
+    for w in words:
+        args += expand_word(w, datadir)
+    if device is not None:
+        args = [prog] + strip_option(args[1:], ['-d', '--device'], 1) + ['--device', str(device)]
+    args += ['--bench-o', ofilename]
+
+    with open(logfilename, 'w') as log:
+        try:
+            rc = subprocess.run(args, stdout=log, stderr=subprocess.STDOUT, timeout=timeout).returncode
+        except subprocess.TimeoutExpired:
+            rc = -1
+
+    results = None
+    if rc == 0:
+        try:
+            with open(ofilename, 'r') as f:
+                results = json.load(f)['results']
+        except (OSError, ValueError, KeyError):
+            rc = -2
+
+    if rc == 0:
+        os.remove(ofilename)
+        os.remove(logfilename)
+    return rc, results, logfilename
+
+def store_case(db, rev, host, key, device, rc, results, datadir):
+    date = datetime.datetime.now().isoformat(timespec='seconds')
+    with db:
+        db.execute("DELETE FROM runs WHERE rev = ? AND host = ? AND case_key = ?", (rev, host, key))
+        cursor = db.execute("INSERT INTO runs(rev, host, case_key, device, date, status) VALUES(?, ?, ?, ?, ?, ?)",
+                            (rev, host, key, device, date, rc))
+        run_id = cursor.lastrowid
+        for result in (results or []):
+            tg = result['timing']
+            samples = tg.get('samples', {}).get('time')
+            db.execute("INSERT INTO results VALUES(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)",
+                       (run_id, sample_key(result['cmdline'], datadir),
+                        float(tg['time'][0]), float(tg['time'][1]), float(tg['time'][2]),
+                        float(tg['flops'][0]), float(tg['flops'][1]), float(tg['flops'][2]),
+                        float(tg['bandwidth'][0]), float(tg['bandwidth'][1]), float(tg['bandwidth'][2]),
+                        tg.get('raw_legend'), tg.get('raw_data'),
+                        json.dumps([float(t) for t in samples]) if samples else None))
+
+def bench_revision(prog):
+    out = subprocess.run([prog, '--version'], stdout=subprocess.PIPE, universal_newlines=True)
+    if out.returncode != 0:
+        print('//rocsparse-bench-sweep::error unable to get the version of ' + prog)
+        sys.exit(1)
+    return out.stdout.strip()
+
+def command_run(user_args):
+    datadir = os.getenv('ROCSPARSE_BENCH_DATA_DIR')
+    prog = os.path.join(user_args.workingdir, 'rocsparse-bench')
+    if not os.path.isfile(prog):
+        print("**** Error: unable to find " + prog)
+        sys.exit(1)
+
+    with open(user_args.input, 'r') as f:
+        cmdlines = json.load(f)['cmdlines']
+
+    cases = []
+    for cmdline in cmdlines:
+        if DATA_DIR_VARIABLE in cmdline and datadir is None:
+            print('//rocsparse-bench-sweep:error You must define environment variable ROCSPARSE_BENCH_DATA_DIR as the directory of sparse matrices.')
+            sys.exit(1)
+        cases += split_cmdline(cmdline, datadir)
+
+    rev = user_args.rev if user_args.rev else bench_revision(prog)
+    host = user_args.host if user_args.host else socket.gethostname()
+    db = open_store(user_args.db)
+
+    done = set()
+    if not user_args.force:
+        for (key,) in db.execute("SELECT case_key FROM runs WHERE rev = ? AND host = ? AND status = 0", (rev, host)):
+            done.add(key)
+
+    todo = [c for c in cases if case_key(c) not in done]
+    print('//rocsparse-bench-sweep rev ' + rev + ', host ' + host + ': ' + str(len(cases)) + ' cases, '
+          + str(len(cases) - len(todo)) + ' already done, ' + str(len(todo)) + ' to run')
+
+    workdir = user_args.tmpdir
+    os.makedirs(workdir, exist_ok=True)
+
+    # One slot per process, processes are spread over the devices.
+    devices = [int(d) for d in user_args.devices.split(',')] if user_args.devices else [None]
+    slots = queue.Queue()
+    for _ in range(user_args.jobs):
+        for d in devices:
+            slots.put(d)
+
+    def task(words):
+        device = slots.get()
+        try:
+            return device, run_case(prog, words, device, datadir, workdir, user_args.timeout)
+        finally:
+            slots.put(device)
+
+    nfailed = 0
+    executor = concurrent.futures.ThreadPoolExecutor(max_workers=slots.qsize())
+    try:
+        futures = {executor.submit(task, words): words for words in todo}
+        for icase, future in enumerate(concurrent.futures.as_completed(futures)):
+            words = futures[future]
+            device, (rc, results, logfilename) = future.result()
+            store_case(db, rev, host, case_key(words), device, rc, results, datadir)
+            status = 'done' if rc == 0 else 'failed (err=' + str(rc) + ', see ' + logfilename + ')'
+            if rc != 0:
+                nfailed += 1
+            if user_args.verbose or rc != 0:
+                print('//rocsparse-bench-sweep [' + str(icase + 1) + '/' + str(len(todo)) + '] ' + case_key(words) + ': ' + status)
+    except KeyboardInterrupt:
+        print('//rocsparse-bench-sweep interrupted, completed cases are stored, run again to resume.')
+        for future in futures:
+            future.cancel()
+        executor.shutdown(wait=False)
+        sys.exit(1)
+    executor.shutdown()
+
+    if nfailed > 0:
+        print('//rocsparse-bench-sweep ' + str(nfailed) + ' failed cases')
+        sys.exit(1)
+
+#
+# QUERIES
+#
+def revisions(db, host):
+    # Revisions in chronological order of their first run.
+    return [r for (r,) in db.execute("SELECT rev FROM runs WHERE host = ? GROUP BY rev ORDER BY MIN(date)", (host,))]
+
+def sample_times(db, host, rev, pattern):
+    times = {}
+    for key, t in db.execute("SELECT results.sample_key, results.time FROM results JOIN runs ON results.run_id = runs.id "
+                             "WHERE runs.host = ? AND runs.rev = ? AND runs.status = 0 AND results.sample_key LIKE ?",
+                             (host, rev, '%' + pattern + '%')):
+        times.setdefault(key, []).append(t)
+    return times
+
+def command_history(user_args):
+    db = open_store(user_args.db)
+    host = user_args.host if user_args.host else socket.gethostname()
+    revs = revisions(db, host)
+    history = {}
+    for rev in revs:
+        for key, t in sample_times(db, host, rev, user_args.filter).items():
+            history.setdefault(key, []).append((rev, statistics.median(t)))
+    for key in sorted(history):
+        print(key)
+        for rev, t in history[key]:
+            print('    {:<40} {:>12.4f} ms'.format(rev, t))
+
+def command_regress(user_args):
+    db = open_store(user_args.db)
+    host = user_args.host if user_args.host else socket.gethostname()
+    revs = revisions(db, host)
+    if not revs:
+        print('//rocsparse-bench-sweep::error no results for host ' + host)
+        sys.exit(1)
+
+    rev = user_args.rev if user_args.rev else revs[-1]
+    if user_args.baseline:
+        baseline = user_args.baseline.split(',')
+    else:
+        previous = revs[:revs.index(rev)] if rev in revs else revs
+        baseline = previous[-user_args.window:]
+    if not baseline:
+        print('//rocsparse-bench-sweep::error no baseline revision for ' + rev)
+        sys.exit(1)
+
+    current = sample_times(db, host, rev, user_args.filter)
+    history = {}
+    for b in baseline:
+        for key, t in sample_times(db, host, b, user_args.filter).items():
+            history.setdefault(key, []).extend(t)
+
+    nregressions = 0
+    print('//rocsparse-bench-sweep rev ' + rev + ' against ' + ', '.join(baseline))
+    for key in sorted(current):
+        if key not in history:
+            continue
+        t = statistics.median(current[key])
+        reference = statistics.median(history[key])
+        ratio = t / reference if reference > 0 else 1.0
+        regressed = ratio > 1.0 + user_args.threshold
+        if regressed:
+            nregressions += 1
+        if regressed or user_args.verbose:
+            print('{:<10} {:>12.4f} ms {:>12.4f} ms {:>+8.1f}% {}'.format('REGRESSION' if regressed else 'ok',
+                                                                     reference, t, (ratio - 1.0) * 100.0, key))
+
+    print('//rocsparse-bench-sweep ' + str(nregressions) + ' regressions')
+    if nregressions > 0:
+        sys.exit(1)
+
+def main():
+    parser = argparse.ArgumentParser(formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     description="Execute rocsparse-bench sweeps into an SQLite result store and query it.")
+    parser.add_argument('--db', required=False, default='rocsparse-bench.db', help='SQLite result store')
+    parser.add_argument('--host', required=False, default=None, help='host name (default: this host)')
+    parser.add_argument('-v', '--verbose', required=False, default=False, action="store_true")
+    commands = parser.add_subparsers(dest='command')
+
+    run = commands.add_parser('run', help='execute the cmdlines of a .json file, resuming completed cases')
+    run.add_argument('input', help="the .json file with an array 'cmdlines'")
+    run.add_argument('-w', '--workingdir', required=False, default='./', help='directory of rocsparse-bench')
+    run.add_argument('-j', '--jobs', required=False, type=int, default=1, help='processes per device')
+    run.add_argument('--devices', required=False, default=None, help='comma separated device ids')
+    run.add_argument('--rev', required=False, default=None, help='revision (default: rocsparse-bench --version)')
+    run.add_argument('--tmpdir', required=False, default='rocsparse-bench-sweep', help='directory of the case outputs')
+    run.add_argument('--timeout', required=False, type=float, default=None, help='timeout of a case in seconds')
+    run.add_argument('--force', required=False, default=False, action="store_true", help='rerun completed cases')
+
+    history = commands.add_parser('history', help='print the median time of each sample per revision')
+    history.add_argument('-f', '--filter', required=False, default='', help='substring of the samples')
+
+    regress = commands.add_parser('regress', help='compare a revision against the previous ones')
+    regress.add_argument('--rev', required=False, default=None, help='revision to check (default: latest)')
+    regress.add_argument('--baseline', required=False, default=None, help='comma separated baseline revisions')
+    regress.add_argument('--window', required=False, type=int, default=5, help='number of previous revisions (default: 5)')
+    regress.add_argument('--threshold', required=False, type=float, default=0.05, help='relative slowdown (default: 0.05)')
+    regress.add_argument('-f', '--filter', required=False, default='', help='substring of the samples')
+
+    user_args = parser.parse_args()
+    if user_args.command == 'run':
+        command_run(user_args)
+    elif user_args.command == 'history':
+        command_history(user_args)
+    elif user_args.command == 'regress':
+        command_regress(user_args)
+    else:
+        parser.print_help()
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -122,7 +122,8 @@ def main():
     with open(unknown_args[0],"r") as f:
         case=json.load(f)
 
-    results = case['results']
+    # events are spilled per shard, restore their order
+    results = sorted(case['results'], key = lambda r: int(r['index']))
     legend =  case['legend']
     if verbose:
         print('//rocsparse-memstat-plot')
@@ -48,12 +48,35 @@ def export_csv(obasename, delim, legend, results, verbose = False,debug = False)
         out.write('\n')
     out.close()
 
+##
+def print_tags(tags, top):
+    tags = sorted(tags, key = lambda t: int(t['nbytes_peak']), reverse = True)
+    if top > 0:
+        tags = tags[:top]
+    print('//rocsparse-memstat allocation sites, sorted by peak bytes:')
+    print(f"{'peak bytes':>14} {'live bytes':>14} {'allocs':>10} {'allocs/s':>12}  tag")
+    for t in tags:
+        print(f"{int(t['nbytes_peak']):>14} {int(t['nbytes_live']):>14} {int(t['nallocs']):>10} {float(t['allocs_per_s']):>12.1f}  {t['tag']}")
+        bins = sorted(t['histogram'].items(), key = lambda b: int(b[0]))
+        print(' ' * 16 + 'sizes: ' + ', '.join(f"<= {b[0]}: {b[1]}" for b in bins))
+
+def export_tags_csv(filename, delim, tags, verbose = False):
+    if verbose:
+        print('//rocsparse-memstat  - tags file : \'' + filename + '\'')
+    legend = ['tag', 'nallocs', 'nfrees', 'nbytes_live', 'nbytes_peak', 'nbytes_total', 'allocs_per_s']
+    with open(filename, "w+") as out:
+        out.write(delim.join(legend) + '\n')
+        for t in tags:
+            out.write(delim.join(("\"" + t[k] + "\"") if k == 'tag' else t[k] for k in legend) + '\n')
+
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('-w', '--workingdir',     required=False, default = './')
     parser.add_argument('-o', '--obasename',    required=False, default = 'a.csv')
     parser.add_argument('-v', '--verbose',         required=False, default = False, action = "store_true")
     parser.add_argument('-d', '--debug',         required=False, default = False, action = "store_true")
+    parser.add_argument('-t', '--top',           required=False, default = 10, type = int, help = 'number of allocation sites to print, 0 for all')
+    parser.add_argument('--tags-csv',            required=False, default = None, help = 'export the allocation site statistics')
     user_args, unknown_args = parser.parse_known_args()
     verbose=user_args.verbose
     debug=user_args.debug
@@ -63,7 +86,8 @@ def main():
     with open(unknown_args[0],"r") as f:
         case=json.load(f)
 
-    results = case['results']
+    # events are spilled per shard, restore their order
+    results = sorted(case['results'], key = lambda r: int(r['index']))
     legend =  case['legend']
     leaks=case['leaks']
     if (len(leaks)==0):
@@ -74,6 +98,21 @@ def main():
             print(f"mode: {leaks[j]['mode']}",end="")
             print(f", size: {leaks[j]['nbytes']} bytes",end="")
             print(f", location: {leaks[j]['tag']}")
+    pools=case.get('workspace_pools',[])
+    for j in range(len(pools)):
+        nrequests=int(pools[j]['nrequests'])
+        nhits=int(pools[j]['nhits'])
+        print(f"//rocsparse-memstat workspace pool {j}: requests: {nrequests}",end="")
+        print(f", hits: {nhits}",end="")
+        if nrequests > 0:
+            print(f" ({100.0 * nhits / nrequests:.1f}%)",end="")
+        print(f", releases: {pools[j]['nreleases']}",end="")
+        print(f", high water: {pools[j]['nbytes_high_water']} bytes")
+    tags=case.get('tags',[])
+    if len(tags) > 0:
+        print_tags(tags, user_args.top)
+        if user_args.tags_csv is not None:
+            export_tags_csv(user_args.tags_csv, ', ', tags, verbose)
     if verbose:
         print('//rocsparse-memstat  - input file :  \'' + unknown_args[0] + '\'')
 
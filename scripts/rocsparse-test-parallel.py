@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+
+# ########################################################################
+# Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+# ########################################################################
+
+#
+# Parallel execution of rocsparse-test.
+#
+# The test cases are listed with --gtest_list_tests and grouped into chunks of consecutive
+# cases, so that cases sharing a matrix stay in the same process and benefit from its matrix
+# cache (see ROCSPARSE_CLIENTS_MATRIX_CACHE_SIZE). Chunks are balanced from the durations of
+# the previous executions, stored in a .json file, and scheduled longest first on a pool of
+# rocsparse-test processes spread over the devices.
+#
+
+import argparse
+import concurrent.futures
+import json
+import os
+import queue
+import statistics
+import subprocess
+import sys
+
+# A filter is given as a single argument, whose length is limited by the system.
+MAX_FILTER_LENGTH = 100000
+
+def list_tests(prog, gtest_filter):
+    out = subprocess.run([prog, '--gtest_list_tests', '--gtest_filter=' + gtest_filter],
+                         stdout=subprocess.PIPE, universal_newlines=True)
+    if out.returncode != 0:
+        print('//rocsparse-test-parallel::error unable to list the tests of ' + prog)
+        sys.exit(1)
+
+    names = []
+    suite = None
+    for line in out.stdout.splitlines():
+        if not line.strip():
+            continue
+        if not line.startswith(' '):
+            # Skip the output of the initialization, suites end with a '.'.
+            word = line.split('#')[0].strip()
+            suite = word if word.endswith('.') else None
+        elif suite is not None:
+            names.append(suite + line.split('#')[0].strip())
+    return names
+
+def make_chunks(names, durations, nchunks):
+    known = [durations[n] for n in names if n in durations]
+    default = statistics.median(known) if known else 1.0
+    cost = [durations.get(n, default) for n in names]
+    target = sum(cost) / max(1, nchunks)
+
+    chunks = []
+    chunk, chunk_cost, chunk_length = [], 0.0, 0
+    for name, c in zip(names, cost):
+        if chunk and (chunk_cost + c > target or chunk_length + len(name) + 1 > MAX_FILTER_LENGTH):
+            chunks.append((chunk_cost, chunk))
+            chunk, chunk_cost, chunk_length = [], 0.0, 0
+        chunk.append(name)
+        chunk_cost += c
+        chunk_length += len(name) + 1
+    if chunk:
+        chunks.append((chunk_cost, chunk))
+
+    # Longest first.
+    return sorted(chunks, key=lambda c: -c[0])
+
+def run_chunk(prog, index, names, device, workdir, extra_args):
+    ofilename = os.path.join(workdir, 'chunk_' + str(index) + '.json')
+    logfilename = os.path.join(workdir, 'chunk_' + str(index) + '.log')
+    args = [prog, '--gtest_filter=' + ':'.join(names), '--gtest_output=json:' + ofilename] + extra_args
+    if device is not None:
+        args += ['--device', str(device)]
+
+    with open(logfilename, 'w') as log:
+        rc = subprocess.run(args, stdout=log, stderr=subprocess.STDOUT).returncode
+
+    times, failures = {}, []
+    try:
+        with open(ofilename, 'r') as f:
+            report = json.load(f)
+        for suite in report['testsuites']:
+            for test in suite['testsuite']:
+                name = test['classname'] + '.' + test['name']
+                times[name] = float(test['time'].rstrip('s'))
+                if 'failures' in test:
+                    failures.append(name)
+        os.remove(ofilename)
+    except (OSError, ValueError, KeyError):
+        # The process crashed, all the cases of the chunk are reported.
+        rc = rc if rc != 0 else -1
+        failures = [n for n in names if n not in times]
+
+    if rc == 0:
+        os.remove(logfilename)
+    return rc, times, failures, logfilename
+
+def main():
+    parser = argparse.ArgumentParser(formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     description="Execute rocsparse-test in parallel processes, extra arguments are given to rocsparse-test.")
+    parser.add_argument('-w', '--workingdir', required=False, default='./', help='directory of rocsparse-test')
+    parser.add_argument('-j', '--jobs', required=False, type=int, default=1, help='processes per device')
+    parser.add_argument('--devices', required=False, default=None, help='comma separated device ids')
+    parser.add_argument('--gtest_filter', required=False, default='*', help='filter of the cases')
+    parser.add_argument('--durations', required=False, default='rocsparse-test-durations.json',
+                        help='durations of the cases, read and updated')
+    parser.add_argument('--chunks', required=False, type=int, default=4, help='chunks per process (default: 4)')
+    parser.add_argument('--tmpdir', required=False, default='rocsparse-test-parallel', help='directory of the outputs')
+    parser.add_argument('-v', '--verbose', required=False, default=False, action="store_true")
+    user_args, extra_args = parser.parse_known_args()
+
+    prog = os.path.join(user_args.workingdir, 'rocsparse-test')
+    if not os.path.isfile(prog):
+        print("**** Error: unable to find " + prog)
+        sys.exit(1)
+
+    durations = {}
+    if os.path.isfile(user_args.durations):
+        with open(user_args.durations, 'r') as f:
+            durations = json.load(f)
+
+    names = list_tests(prog, user_args.gtest_filter)
+    devices = [int(d) for d in user_args.devices.split(',')] if user_args.devices else [None]
+    slots = queue.Queue()
+    for _ in range(user_args.jobs):
+        for d in devices:
+            slots.put(d)
+    nprocesses = slots.qsize()
+
+    chunks = make_chunks(names, durations, nprocesses * user_args.chunks)
+    print('//rocsparse-test-parallel ' + str(len(names)) + ' cases, ' + str(len(chunks)) + ' chunks, '
+          + str(nprocesses) + ' processes')
+    os.makedirs(user_args.tmpdir, exist_ok=True)
+
+    def task(index, chunk):
+        device = slots.get()
+        try:
+            return run_chunk(prog, index, chunk, device, user_args.tmpdir, extra_args)
+        finally:
+            slots.put(device)
+
+    failures = []
+    nfailed_chunks = 0
+    with concurrent.futures.ThreadPoolExecutor(max_workers=nprocesses) as executor:
+        futures = [executor.submit(task, index, chunk) for index, (cost, chunk) in enumerate(chunks)]
+        for done, future in enumerate(concurrent.futures.as_completed(futures)):
+            rc, times, chunk_failures, logfilename = future.result()
+            durations.update(times)
+            failures += chunk_failures
+            if rc != 0:
+                nfailed_chunks += 1
+                print('//rocsparse-test-parallel chunk failed (err=' + str(rc) + ', see ' + logfilename + ')')
+            elif user_args.verbose:
+                print('//rocsparse-test-parallel [' + str(done + 1) + '/' + str(len(chunks)) + '] ' + str(len(times)) + ' cases done')
+
+    with open(user_args.durations, 'w') as f:
+        json.dump(durations, f, indent=1, sort_keys=True)
+
+    for name in sorted(failures):
+        print('//rocsparse-test-parallel FAILED ' + name)
+    print('//rocsparse-test-parallel ' + str(len(names) - len(failures)) + ' passed, ' + str(len(failures)) + ' failed')
+    if failures or nfailed_chunks > 0:
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
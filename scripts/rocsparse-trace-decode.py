@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+
+# ########################################################################
+# Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+# ########################################################################
+
+#
+# Decode a binary trace written with ROCSPARSE_LAYER including
+# rocsparse_layer_mode_log_trace_binary into the text trace format.
+#
+
+import argparse
+import struct
+import sys
+
+MAX_ARGS = 40
+
+KIND_CALL = 0
+KIND_STRING = 1
+KIND_DROPPED = 2
+
+TYPE_INT = 0
+TYPE_UINT = 1
+TYPE_FLOAT = 2
+TYPE_POINTER = 3
+TYPE_STRING = 4
+TYPE_CHAR = 5
+
+FLAG_TRUNCATED = 0x1
+
+HEADER = struct.Struct('<8sII')
+RECORD = struct.Struct('<QQIIHHI%dB%dQ' % (MAX_ARGS, MAX_ARGS))
+
+def read_records(filename):
+    with open(filename, 'rb') as f:
+        magic, version, record_size = HEADER.unpack(f.read(HEADER.size))
+        if magic != b'RSPTRACE':
+            sys.exit('rocsparse-trace-decode: \'' + filename + '\' is not a rocsparse binary trace')
+        if version != 1 or record_size != RECORD.size:
+            sys.exit('rocsparse-trace-decode: unsupported trace version ' + str(version))
+        while True:
+            data = f.read(RECORD.size)
+            if len(data) < RECORD.size:
+                break
+            yield RECORD.unpack(data)
+
+def format_float(x):
+    # Default formatting of std::ostream
+    return '%g' % x
+
+def format_arg(t, v, strings):
+    if t == TYPE_INT:
+        return str(v - (1 << 64) if v >= (1 << 63) else v)
+    if t == TYPE_UINT:
+        return str(v)
+    if t == TYPE_FLOAT:
+        return format_float(struct.unpack('<d', struct.pack('<Q', v))[0])
+    if t == TYPE_POINTER:
+        return '0' if v == 0 else hex(v)
+    if t == TYPE_STRING:
+        return strings.get(v, '<string %d>' % v)
+    if t == TYPE_CHAR:
+        return chr(v)
+    return '<type %d>' % t
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a rocsparse binary trace into the text trace format.')
+    parser.add_argument('filename')
+    parser.add_argument('-o', '--output', required=False, default=None)
+    parser.add_argument('--handle', required=False, default=None, help='only decode the calls of this handle, e.g. 0x5581f3a0')
+    parser.add_argument('--sort', required=False, default=False, action='store_true', help='sort the calls by time stamp')
+    parser.add_argument('--timestamps', required=False, default=False, action='store_true', help='prefix the calls with their time stamp in microseconds')
+    user_args = parser.parse_args()
+
+    handle = int(user_args.handle, 16) if user_args.handle is not None else None
+
+    strings = {}
+    calls = []
+    ndropped = 0
+    ntruncated = 0
+    for r in read_records(user_args.filename):
+        timestamp, h, thread, id, kind, nargs, flags = r[:7]
+        types = r[7:7 + MAX_ARGS]
+        args = r[7 + MAX_ARGS:]
+        if kind == KIND_STRING:
+            raw = struct.pack('<%dQ' % MAX_ARGS, *args)[:nargs]
+            strings[id] = raw.decode('utf-8', 'replace')
+        elif kind == KIND_DROPPED:
+            ndropped += args[0]
+        elif kind == KIND_CALL:
+            if handle is not None and h != handle:
+                continue
+            if flags & FLAG_TRUNCATED:
+                ntruncated += 1
+            calls.append((timestamp, id, types[:nargs], args[:nargs]))
+
+    if user_args.sort:
+        calls.sort(key=lambda c: c[0])
+
+    out = open(user_args.output, 'w') if user_args.output is not None else sys.stdout
+    for timestamp, id, types, args in calls:
+        line = [strings.get(id, '<routine %d>' % id)]
+        for t, v in zip(types, args):
+            line.append(format_arg(t, v, strings))
+        out.write('\n')
+        if user_args.timestamps:
+            out.write('%.3f ' % (timestamp / 1e3))
+        out.write(','.join(line))
+    if out is not sys.stdout:
+        out.close()
+
+    if ndropped > 0:
+        print('//rocsparse-trace-decode: %d calls were dropped, the trace rings were full.' % ndropped, file=sys.stderr)
+    if ntruncated > 0:
+        print('//rocsparse-trace-decode: %d calls have truncated arguments.' % ntruncated, file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
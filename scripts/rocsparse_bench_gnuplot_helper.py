@@ -121,6 +121,32 @@ def curve(out,ofilename,title,indices,ifilename,x_range,y_label,col_index, title
     out.write("\n")
 
 
+#
+# Roofline chart: achieved GFlops against arithmetic intensity, bounded by the peak bandwidth
+# and the peak compute of each precision.
+#
+def roofline(out,ofilename,title,indices,ifilename,x_col_index,y_col_index,titles,bandwidth,peaks):
+    nplots = len(indices)
+    out.write("reset\n")
+    out.write("set grid\n")
+    out.write("set term pdfcairo enhanced color font 'Helvetica,9'\n")
+    out.write("set output \"" + ofilename + "\"\n")
+    out.write("set termoption noenhanced\n")
+    out.write("set xlabel \"Arithmetic intensity (Flop/Byte)\"\n")
+    out.write("set ylabel \"GFlops\"\n")
+    out.write("set logscale xy\n")
+    out.write("set xrange [1e-3:1e3]\n")
+    out.write("set size ratio 0.5\n")
+    out.write("set key left top\n")
+    out.write("set title '" + title +"'\n")
+    out.write("plot '"+ifilename+"' index "+str(indices[0])+" using "+str(x_col_index)+":"+str(y_col_index)+" with points pointtype 7 title '"+ titles[0] +"'")
+    for i in range(1,nplots):
+        out.write(",\\\n '' index "+str(indices[i])+" using "+str(x_col_index)+":"+str(y_col_index)+" with points pointtype 7 title '"+titles[i]+"'")
+    for name, peak in peaks:
+        out.write(",\\\n (x * " + str(bandwidth) + " < " + str(peak) + " ? x * " + str(bandwidth) + " : " + str(peak) + ") with lines dashtype 2 title 'roofline " + name + "'")
+    out.write("\n")
+
+
 def call(ifilename):
     cmdgnuplot = ["gnuplot", ifilename]
     proc = subprocess.Popen(cmdgnuplot)